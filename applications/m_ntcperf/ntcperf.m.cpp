@@ -0,0 +1,1494 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntccfg_bind.h>
+#include <ntcf_system.h>
+#include <ntsd_message.h>
+#include <ntsd_messageheader.h>
+#include <ntsd_messageparser.h>
+#include <ntsd_messagetype.h>
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlt_currenttime.h>
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadutil.h>
+#include <bsls_atomic.h>
+#include <bsls_log.h>
+#include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace benchmark {
+
+//
+// Measuring End-to-End Throughput and Latency
+//
+// This application measures the messages per second, bytes per second, and
+// latency distribution achieved by each supported driver when exchanging
+// messages of the 'ntsd' test protocol between pairs of stream sockets
+// connected over the loopback interface. Each message carries in its header
+// the time at which it was sent, so the latency of a message is measured as
+// the difference between the time the message is parsed by its receiver and
+// the time stamped in its header.
+//
+// The following workloads are supported:
+//
+// ping-pong:  Each client keeps 'depth' requests in flight. The server
+//             responds to each request with a response of the configured
+//             response size. The client records the round-trip latency of
+//             each response and immediately sends the next request.
+//
+// streaming:  Each client keeps 'depth' messages in flight, as measured by
+//             the completion of the send of each message, and the server
+//             records the one-way latency of each message without replying.
+//
+// fan-out:    The server publishes each message to all connections, keeping
+//             'depth' rounds of publication in flight, and each client records
+//             the one-way latency of each message.
+//
+// Skewing the Load Across Threads
+//
+// The first 'hot' client connections are pinned to the first I/O thread and
+// busy-wait for 'work' microseconds after each message they process, to
+// simulate expensive application callbacks. The remaining connections are
+// pinned to each thread in turn, so the connections sharing the first thread
+// with the hot connections are delayed by them. Measure the tail latency
+// with and without '--stealing', which lets idle threads run the callbacks
+// of connections pinned to the busy thread.
+//
+// For each combination of driver and workload the application prints a
+// single line containing a JSON object to standard output. Diagnostics are
+// printed to standard error.
+//
+
+/// Enumerate the workloads measured by this application.
+struct Workload {
+  public:
+    /// Enumerate the workloads measured by this application.
+    enum Value {
+        /// The client sends requests and the server sends responses.
+        e_PING_PONG = 0,
+
+        /// The client sends a unidirectional stream of messages.
+        e_STREAMING = 1,
+
+        /// The server publishes each message to every client.
+        e_FAN_OUT = 2
+    };
+
+    /// Return the string representation exactly matching the enumerator
+    /// name corresponding to the specified enumeration 'value'.
+    static const char* toString(Value value);
+
+    /// Load into the specified 'result' the enumerator matching the
+    /// specified 'string'. Return 0 on success, and a non-zero value with
+    /// no effect on 'result' otherwise.
+    static int fromString(Value* result, const bsl::string& string);
+};
+
+const char* Workload::toString(Value value)
+{
+    switch (value) {
+    case e_PING_PONG:
+        return "ping-pong";
+    case e_STREAMING:
+        return "streaming";
+    case e_FAN_OUT:
+        return "fan-out";
+    }
+
+    return "???";
+}
+
+int Workload::fromString(Value* result, const bsl::string& string)
+{
+    if (string == "ping-pong") {
+        *result = e_PING_PONG;
+        return 0;
+    }
+
+    if (string == "streaming") {
+        *result = e_STREAMING;
+        return 0;
+    }
+
+    if (string == "fan-out") {
+        *result = e_FAN_OUT;
+        return 0;
+    }
+
+    return -1;
+}
+
+/// Describe the parameters of the benchmark.
+struct Parameters {
+    /// Create new parameters having the default values.
+    Parameters();
+
+    /// The names of the drivers to measure. If empty, measure each
+    /// supported driver.
+    bsl::vector<bsl::string> d_driverNames;
+
+    /// The workloads to measure. If empty, measure each workload.
+    bsl::vector<Workload::Value> d_workloads;
+
+    /// The transport used by each connection.
+    ntsa::Transport::Value d_transport;
+
+    /// The number of I/O threads driven by the interface.
+    bsl::size_t d_numThreads;
+
+    /// The number of connections.
+    bsl::size_t d_numConnections;
+
+    /// The number of messages, or rounds of publication, kept in flight
+    /// per connection.
+    bsl::size_t d_depth;
+
+    /// The size of the payload of each request.
+    bsl::size_t d_requestSize;
+
+    /// The size of the payload of each response.
+    bsl::size_t d_responseSize;
+
+    /// The duration during which messages are exchanged but not recorded.
+    bsls::TimeInterval d_warmup;
+
+    /// The duration during which messages are recorded.
+    bsls::TimeInterval d_duration;
+
+    /// The number of client connections pinned to the first thread that
+    /// simulate expensive processing of each message.
+    bsl::size_t d_numHotConnections;
+
+    /// The number of microseconds each hot connection busy-waits after
+    /// processing each message.
+    bsl::size_t d_work;
+
+    /// The flag indicating idle threads steal the callbacks of connections
+    /// pinned to busy threads.
+    bool d_strandStealing;
+};
+
+Parameters::Parameters()
+: d_driverNames()
+, d_workloads()
+, d_transport(ntsa::Transport::e_TCP_IPV4_STREAM)
+, d_numThreads(1)
+, d_numConnections(1)
+, d_depth(1)
+, d_requestSize(64)
+, d_responseSize(64)
+, d_warmup(1.0)
+, d_duration(5.0)
+, d_numHotConnections(0)
+, d_work(0)
+, d_strandStealing(false)
+{
+}
+
+/// Describe the state of a measurement shared by each connection.
+struct State {
+    /// Create a new state for the specified 'workload' according to the
+    /// specified 'parameters'.
+    State(const Parameters& parameters, Workload::Value workload);
+
+    /// The parameters of the benchmark.
+    const Parameters& d_parameters;
+
+    /// The workload being measured.
+    Workload::Value d_workload;
+
+    /// The flag indicating messages should continue to be sent.
+    bsls::AtomicBool d_running;
+
+    /// The flag indicating received messages should be recorded.
+    bsls::AtomicBool d_recording;
+};
+
+State::State(const Parameters& parameters, Workload::Value workload)
+: d_parameters(parameters)
+, d_workload(workload)
+, d_running(true)
+, d_recording(false)
+{
+}
+
+/// Provide a mechanism to accumulate the messages, bytes, and latencies
+/// measured by a connection. This class is thread safe.
+class Statistics
+{
+    bslmt::Mutex               d_mutex;
+    bsl::vector<bsl::int64_t>  d_latencies;
+    bsl::uint64_t              d_numMessages;
+    bsl::uint64_t              d_numBytes;
+
+  private:
+    Statistics(const Statistics&) BSLS_KEYWORD_DELETED;
+    Statistics& operator=(const Statistics&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create new statistics. Optionally specify a 'basicAllocator' used to
+    /// supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used.
+    explicit Statistics(bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~Statistics();
+
+    /// Record the receipt of a message having the specified 'numBytes'
+    /// that took the specified 'latency' to arrive.
+    void record(bsl::size_t numBytes, const bsls::TimeInterval& latency);
+
+    /// Append to the specified 'latencies' each latency recorded, in
+    /// microseconds, and add to the specified 'numMessages' and 'numBytes'
+    /// the number of messages and bytes recorded.
+    void collect(bsl::vector<bsl::int64_t>* latencies,
+                 bsl::uint64_t*             numMessages,
+                 bsl::uint64_t*             numBytes);
+};
+
+Statistics::Statistics(bslma::Allocator* basicAllocator)
+: d_mutex()
+, d_latencies(basicAllocator)
+, d_numMessages(0)
+, d_numBytes(0)
+{
+}
+
+Statistics::~Statistics()
+{
+}
+
+void Statistics::record(bsl::size_t               numBytes,
+                        const bsls::TimeInterval& latency)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    d_latencies.push_back(latency.totalMicroseconds());
+    d_numMessages += 1;
+    d_numBytes    += numBytes;
+}
+
+void Statistics::collect(bsl::vector<bsl::int64_t>* latencies,
+                         bsl::uint64_t*             numMessages,
+                         bsl::uint64_t*             numBytes)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    latencies->insert(latencies->end(),
+                      d_latencies.begin(),
+                      d_latencies.end());
+
+    *numMessages += d_numMessages;
+    *numBytes    += d_numBytes;
+}
+
+/// Process the closure of a socket by posting to the specified
+/// 'semaphore'.
+void processClose(bslmt::Semaphore* semaphore)
+{
+    semaphore->post();
+}
+
+/// Provide a mechanism to send, receive, and measure messages of the 'ntsd'
+/// test protocol exchanged over a stream socket.
+class Connection
+{
+    State*                              d_state_p;
+    bsl::shared_ptr<ntci::StreamSocket> d_streamSocket_sp;
+    bool                                d_client;
+    bool                                d_hot;
+    bslmt::Mutex                        d_parserMutex;
+    ntsd::MessageParser                 d_parser;
+    bsl::shared_ptr<bdlbb::Blob>        d_readQueue_sp;
+    bsl::shared_ptr<bdlbb::Blob>        d_payload_sp;
+    bsls::AtomicUint                    d_transactionId;
+    Statistics                          d_statistics;
+    bslma::Allocator*                   d_allocator_p;
+
+  private:
+    Connection(const Connection&) BSLS_KEYWORD_DELETED;
+    Connection& operator=(const Connection&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Process the receipt of the specified 'data' or the specified
+    /// 'event'.
+    void processReceive(const bsl::shared_ptr<ntci::Receiver>& receiver,
+                        const bsl::shared_ptr<bdlbb::Blob>&    data,
+                        const ntca::ReceiveEvent&              event);
+
+    /// Process the completion of the send of a message described by the
+    /// specified 'event'.
+    void processSend(const bsl::shared_ptr<ntci::Sender>& sender,
+                     const ntca::SendEvent&               event);
+
+    /// Process the specified 'message' parsed from the read queue.
+    void processMessage(const ntsd::Message& message);
+
+    /// Busy-wait for the configured duration of work if this connection
+    /// is hot.
+    void work();
+
+    /// Receive at least the specified 'minSize' number of bytes.
+    void receive(bsl::size_t minSize);
+
+    /// Send a message of the specified 'type' having the specified
+    /// 'transactionId' and 'timestamp'. If the specified 'notify' flag is
+    /// true, send the next message when the send of this message
+    /// completes.
+    void send(ntsd::MessageType::Value  type,
+              bsl::uint32_t             transactionId,
+              const bsls::TimeInterval& timestamp,
+              bool                      notify);
+
+  public:
+    /// Create a new connection measuring the specified 'workload' according
+    /// to the specified 'parameters' over the specified 'streamSocket'
+    /// acting in the role of a client if the specified 'client' flag is
+    /// true, and in the role of a server otherwise, simulating expensive
+    /// processing of each message if the specified 'hot' flag is true.
+    /// Optionally specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
+    Connection(State*                                     state,
+               const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+               bool                                       client,
+               bool                                       hot,
+               bslma::Allocator*                          basicAllocator = 0);
+
+    /// Destroy this object.
+    ~Connection();
+
+    /// Begin receiving messages and, if the workload is driven by this
+    /// connection, begin sending messages.
+    void start();
+
+    /// Close the connection and post to the specified 'semaphore' when the
+    /// connection is closed.
+    void close(bslmt::Semaphore* semaphore);
+
+    /// Return the statistics measured by this connection.
+    Statistics& statistics();
+
+    /// Return the stream socket.
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket() const;
+};
+
+Connection::Connection(State*                                     state,
+                       const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+                       bool                                       client,
+                       bool                                       hot,
+                       bslma::Allocator* basicAllocator)
+: d_state_p(state)
+, d_streamSocket_sp(streamSocket)
+, d_client(client)
+, d_hot(hot)
+, d_parserMutex()
+, d_parser(basicAllocator)
+, d_readQueue_sp(streamSocket->createIncomingBlob())
+, d_payload_sp(streamSocket->createOutgoingBlob())
+, d_transactionId(0)
+, d_statistics(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    const bsl::size_t payloadSize = d_client
+                                        ? d_state_p->d_parameters.d_requestSize
+                                        : d_state_p->d_parameters.d_responseSize;
+
+    if (payloadSize > 0) {
+        const bsl::string payload(payloadSize, 'x', d_allocator_p);
+        bdlbb::BlobUtil::append(d_payload_sp.get(),
+                                payload.data(),
+                                static_cast<int>(payload.size()));
+    }
+}
+
+Connection::~Connection()
+{
+}
+
+void Connection::processReceive(
+    const bsl::shared_ptr<ntci::Receiver>& receiver,
+    const bsl::shared_ptr<bdlbb::Blob>&    data,
+    const ntca::ReceiveEvent&              event)
+{
+    NTCCFG_WARNING_UNUSED(receiver);
+
+    if (event.type() == ntca::ReceiveEventType::e_ERROR) {
+        if (event.context().error() != ntsa::Error::e_EOF &&
+            d_state_p->d_running)
+        {
+            BSLS_LOG_ERROR("Failed to receive: %s",
+                           event.context().error().text().c_str());
+        }
+        return;
+    }
+
+    int numNeeded = 0;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_parserMutex);
+
+        bdlbb::BlobUtil::append(d_readQueue_sp.get(), *data);
+
+        ntsa::Error error = d_parser.parse(
+            &numNeeded,
+            d_readQueue_sp.get(),
+            NTCCFG_BIND(&Connection::processMessage,
+                        this,
+                        NTCCFG_BIND_PLACEHOLDER_1));
+        if (error) {
+            BSLS_LOG_ERROR("Failed to parse: %s", error.text().c_str());
+            return;
+        }
+
+        // The number of bytes needed by the parser includes the bytes
+        // already queued but not yet parsed.
+
+        const int numQueued = d_readQueue_sp->length();
+        numNeeded = numNeeded > numQueued ? numNeeded - numQueued : 1;
+    }
+
+    this->receive(static_cast<bsl::size_t>(numNeeded));
+}
+
+void Connection::processSend(const bsl::shared_ptr<ntci::Sender>& sender,
+                             const ntca::SendEvent&               event)
+{
+    NTCCFG_WARNING_UNUSED(sender);
+
+    if (event.type() == ntca::SendEventType::e_ERROR) {
+        return;
+    }
+
+    this->work();
+
+    if (d_state_p->d_running) {
+        this->send(ntsd::MessageType::e_REQUEST,
+                   ++d_transactionId,
+                   bdlt::CurrentTime::now(),
+                   true);
+    }
+}
+
+void Connection::processMessage(const ntsd::Message& message)
+{
+    const bsls::TimeInterval now = bdlt::CurrentTime::now();
+
+    if (message.type() == ntsd::MessageType::e_REQUEST &&
+        d_state_p->d_workload == Workload::e_PING_PONG)
+    {
+        if (d_state_p->d_running) {
+            this->send(ntsd::MessageType::e_RESPONSE,
+                       message.transactionId(),
+                       message.requestTimestamp(),
+                       false);
+        }
+        return;
+    }
+
+    if (d_state_p->d_recording) {
+        d_statistics.record(
+            sizeof(ntsd::MessageHeader) + message.payload().length(),
+            now - message.requestTimestamp());
+    }
+
+    this->work();
+
+    if (message.type() == ntsd::MessageType::e_RESPONSE &&
+        d_state_p->d_running)
+    {
+        this->send(ntsd::MessageType::e_REQUEST,
+                   ++d_transactionId,
+                   d_hot ? bdlt::CurrentTime::now() : now,
+                   false);
+    }
+}
+
+void Connection::work()
+{
+    if (!d_hot || d_state_p->d_parameters.d_work == 0) {
+        return;
+    }
+
+    const bsls::Types::Int64 deadline =
+        bsls::TimeUtil::getTimer() +
+        static_cast<bsls::Types::Int64>(d_state_p->d_parameters.d_work) *
+            1000;
+
+    while (bsls::TimeUtil::getTimer() < deadline) {
+    }
+}
+
+void Connection::receive(bsl::size_t minSize)
+{
+    ntca::ReceiveOptions receiveOptions;
+    receiveOptions.setMinSize(minSize);
+    receiveOptions.setMaxSize(bsl::max(minSize, bsl::size_t(64 * 1024)));
+
+    ntci::ReceiveCallback receiveCallback =
+        d_streamSocket_sp->createReceiveCallback(
+            NTCCFG_BIND(&Connection::processReceive,
+                        this,
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2,
+                        NTCCFG_BIND_PLACEHOLDER_3),
+            d_allocator_p);
+
+    ntsa::Error error =
+        d_streamSocket_sp->receive(receiveOptions, receiveCallback);
+    if (error && d_state_p->d_running) {
+        BSLS_LOG_ERROR("Failed to initiate receive: %s",
+                       error.text().c_str());
+    }
+}
+
+void Connection::send(ntsd::MessageType::Value  type,
+                      bsl::uint32_t             transactionId,
+                      const bsls::TimeInterval& timestamp,
+                      bool                      notify)
+{
+    const bsl::uint32_t payloadSize =
+        static_cast<bsl::uint32_t>(d_payload_sp->length());
+
+    ntsd::Message message(d_allocator_p);
+    message.setType(type);
+    message.setTransactionId(transactionId);
+    message.setRequestTimestamp(timestamp);
+
+    if (type == ntsd::MessageType::e_RESPONSE) {
+        message.setResponseSize(payloadSize);
+    }
+    else {
+        message.setRequestSize(payloadSize);
+    }
+
+    message.setPayload(*d_payload_sp);
+
+    bsl::shared_ptr<bdlbb::Blob> data = d_streamSocket_sp->createOutgoingBlob();
+
+    ntsa::Error error = message.encode(data.get());
+    BSLS_ASSERT_OPT(!error);
+
+    if (notify) {
+        ntci::SendCallback sendCallback =
+            d_streamSocket_sp->createSendCallback(
+                NTCCFG_BIND(&Connection::processSend,
+                            this,
+                            NTCCFG_BIND_PLACEHOLDER_1,
+                            NTCCFG_BIND_PLACEHOLDER_2),
+                d_allocator_p);
+
+        error =
+            d_streamSocket_sp->send(*data, ntca::SendOptions(), sendCallback);
+    }
+    else {
+        error = d_streamSocket_sp->send(*data, ntca::SendOptions());
+    }
+
+    if (error && d_state_p->d_running) {
+        BSLS_LOG_ERROR("Failed to send: %s", error.text().c_str());
+    }
+}
+
+void Connection::start()
+{
+    this->receive(sizeof(ntsd::MessageHeader));
+
+    if (!d_client) {
+        return;
+    }
+
+    const bsl::size_t depth = d_state_p->d_parameters.d_depth;
+
+    if (d_state_p->d_workload == Workload::e_PING_PONG) {
+        for (bsl::size_t i = 0; i < depth; ++i) {
+            this->send(ntsd::MessageType::e_REQUEST,
+                       ++d_transactionId,
+                       bdlt::CurrentTime::now(),
+                       false);
+        }
+    }
+    else if (d_state_p->d_workload == Workload::e_STREAMING) {
+        for (bsl::size_t i = 0; i < depth; ++i) {
+            this->send(ntsd::MessageType::e_REQUEST,
+                       ++d_transactionId,
+                       bdlt::CurrentTime::now(),
+                       true);
+        }
+    }
+}
+
+void Connection::close(bslmt::Semaphore* semaphore)
+{
+    ntci::CloseCallback closeCallback =
+        d_streamSocket_sp->createCloseCallback(
+            NTCCFG_BIND(&processClose, semaphore),
+            d_allocator_p);
+
+    d_streamSocket_sp->close(closeCallback);
+}
+
+Statistics& Connection::statistics()
+{
+    return d_statistics;
+}
+
+const bsl::shared_ptr<ntci::StreamSocket>& Connection::streamSocket() const
+{
+    return d_streamSocket_sp;
+}
+
+/// Provide a mechanism to publish each message to a set of stream sockets,
+/// keeping a configured number of rounds of publication in flight.
+class Publisher
+{
+    State*                                           d_state_p;
+    bsl::vector<bsl::shared_ptr<ntci::StreamSocket> > d_streamSockets;
+    bsl::shared_ptr<bdlbb::Blob>                     d_payload_sp;
+    bsls::AtomicUint64                               d_numCompleted;
+    bsls::AtomicUint                                 d_transactionId;
+    bslma::Allocator*                                d_allocator_p;
+
+  private:
+    Publisher(const Publisher&) BSLS_KEYWORD_DELETED;
+    Publisher& operator=(const Publisher&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Process the completion of the send of a message described by the
+    /// specified 'event'.
+    void processSend(const bsl::shared_ptr<ntci::Sender>& sender,
+                     const ntca::SendEvent&               event);
+
+    /// Send a message to each stream socket.
+    void publish();
+
+  public:
+    /// Create a new publisher measuring the specified 'state' that
+    /// publishes messages to the specified 'streamSockets'. Optionally
+    /// specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
+    Publisher(State*                                                 state,
+              const bsl::vector<bsl::shared_ptr<ntci::StreamSocket> >& streamSockets,
+              bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~Publisher();
+
+    /// Begin publishing messages.
+    void start();
+};
+
+Publisher::Publisher(
+    State*                                                   state,
+    const bsl::vector<bsl::shared_ptr<ntci::StreamSocket> >& streamSockets,
+    bslma::Allocator*                                        basicAllocator)
+: d_state_p(state)
+, d_streamSockets(streamSockets, basicAllocator)
+, d_payload_sp()
+, d_numCompleted(0)
+, d_transactionId(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_OPT(!d_streamSockets.empty());
+
+    d_payload_sp = d_streamSockets.front()->createOutgoingBlob();
+
+    const bsl::size_t payloadSize = d_state_p->d_parameters.d_requestSize;
+    if (payloadSize > 0) {
+        const bsl::string payload(payloadSize, 'x', d_allocator_p);
+        bdlbb::BlobUtil::append(d_payload_sp.get(),
+                                payload.data(),
+                                static_cast<int>(payload.size()));
+    }
+}
+
+Publisher::~Publisher()
+{
+}
+
+void Publisher::processSend(const bsl::shared_ptr<ntci::Sender>& sender,
+                            const ntca::SendEvent&               event)
+{
+    NTCCFG_WARNING_UNUSED(sender);
+
+    if (event.type() == ntca::SendEventType::e_ERROR) {
+        return;
+    }
+
+    // Begin the next round of publication each time a number of sends
+    // equal to the number of stream sockets has completed.
+
+    const bsl::uint64_t numCompleted = ++d_numCompleted;
+    if (numCompleted % d_streamSockets.size() == 0 && d_state_p->d_running) {
+        this->publish();
+    }
+}
+
+void Publisher::publish()
+{
+    ntsd::Message message(d_allocator_p);
+    message.setType(ntsd::MessageType::e_REQUEST);
+    message.setTransactionId(++d_transactionId);
+    message.setRequestSize(
+        static_cast<bsl::uint32_t>(d_payload_sp->length()));
+    message.setRequestTimestamp(bdlt::CurrentTime::now());
+    message.setPayload(*d_payload_sp);
+
+    bsl::shared_ptr<bdlbb::Blob> data =
+        d_streamSockets.front()->createOutgoingBlob();
+
+    ntsa::Error error = message.encode(data.get());
+    BSLS_ASSERT_OPT(!error);
+
+    for (bsl::size_t i = 0; i < d_streamSockets.size(); ++i) {
+        ntci::SendCallback sendCallback =
+            d_streamSockets[i]->createSendCallback(
+                NTCCFG_BIND(&Publisher::processSend,
+                            this,
+                            NTCCFG_BIND_PLACEHOLDER_1,
+                            NTCCFG_BIND_PLACEHOLDER_2),
+                d_allocator_p);
+
+        error = d_streamSockets[i]->send(*data,
+                                         ntca::SendOptions(),
+                                         sendCallback);
+        if (error && d_state_p->d_running) {
+            BSLS_LOG_ERROR("Failed to publish: %s", error.text().c_str());
+        }
+    }
+}
+
+void Publisher::start()
+{
+    for (bsl::size_t i = 0; i < d_state_p->d_parameters.d_depth; ++i) {
+        this->publish();
+    }
+}
+
+/// Describe the result of measuring a workload.
+struct Result {
+    /// Create a new result. Optionally specify a 'basicAllocator' used to
+    /// supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used.
+    explicit Result(bslma::Allocator* basicAllocator = 0);
+
+    /// The latency of each message recorded, in microseconds.
+    bsl::vector<bsl::int64_t> d_latencies;
+
+    /// The number of messages recorded.
+    bsl::uint64_t d_numMessages;
+
+    /// The number of bytes recorded.
+    bsl::uint64_t d_numBytes;
+
+    /// The duration during which messages were recorded.
+    bsls::TimeInterval d_elapsed;
+};
+
+Result::Result(bslma::Allocator* basicAllocator)
+: d_latencies(basicAllocator)
+, d_numMessages(0)
+, d_numBytes(0)
+, d_elapsed()
+{
+}
+
+/// Return the specified 'percentile' of the specified sorted 'latencies',
+/// or 0 if 'latencies' is empty.
+bsl::int64_t percentile(const bsl::vector<bsl::int64_t>& latencies,
+                        double                           percentile)
+{
+    if (latencies.empty()) {
+        return 0;
+    }
+
+    bsl::size_t index =
+        static_cast<bsl::size_t>(percentile * latencies.size());
+    if (index >= latencies.size()) {
+        index = latencies.size() - 1;
+    }
+
+    return latencies[index];
+}
+
+/// Print the specified 'result' of measuring the specified 'workload' using
+/// the specified 'driverName' according to the specified 'parameters' as a
+/// single line containing a JSON object to the specified 'stream'.
+void print(bsl::ostream&      stream,
+           const bsl::string& driverName,
+           Workload::Value    workload,
+           const Parameters&  parameters,
+           Result*            result)
+{
+    bsl::sort(result->d_latencies.begin(), result->d_latencies.end());
+
+    const double elapsed = result->d_elapsed.totalSecondsAsDouble();
+
+    const double messagesPerSecond =
+        elapsed > 0 ? static_cast<double>(result->d_numMessages) / elapsed
+                    : 0.0;
+
+    const double bytesPerSecond =
+        elapsed > 0 ? static_cast<double>(result->d_numBytes) / elapsed : 0.0;
+
+    const bsl::vector<bsl::int64_t>& latencies = result->d_latencies;
+
+    bsl::ostringstream ss;
+    ss << bsl::fixed << bsl::setprecision(2);
+
+    ss << "{\"driver\":\"" << driverName << "\""
+       << ",\"workload\":\"" << Workload::toString(workload) << "\""
+       << ",\"transport\":\"" << ntsa::Transport::toString(parameters.d_transport)
+       << "\""
+       << ",\"threads\":" << parameters.d_numThreads
+       << ",\"connections\":" << parameters.d_numConnections
+       << ",\"depth\":" << parameters.d_depth
+       << ",\"requestSize\":" << parameters.d_requestSize
+       << ",\"responseSize\":" << parameters.d_responseSize
+       << ",\"hot\":" << parameters.d_numHotConnections
+       << ",\"work\":" << parameters.d_work
+       << ",\"stealing\":"
+       << (parameters.d_strandStealing ? "true" : "false")
+       << ",\"duration\":" << elapsed
+       << ",\"messages\":" << result->d_numMessages
+       << ",\"bytes\":" << result->d_numBytes
+       << ",\"messagesPerSecond\":" << messagesPerSecond
+       << ",\"bytesPerSecond\":" << bytesPerSecond
+       << ",\"latency\":{"
+       << "\"min\":" << (latencies.empty() ? 0 : latencies.front())
+       << ",\"p50\":" << percentile(latencies, 0.50)
+       << ",\"p90\":" << percentile(latencies, 0.90)
+       << ",\"p99\":" << percentile(latencies, 0.99)
+       << ",\"p999\":" << percentile(latencies, 0.999)
+       << ",\"max\":" << (latencies.empty() ? 0 : latencies.back())
+       << "}}";
+
+    stream << ss.str() << bsl::endl;
+}
+
+/// Process the acceptance of the specified 'streamSocket' described by the
+/// specified 'event' by loading it into the specified 'result' and posting
+/// to the specified 'semaphore'.
+void processAccept(bsl::shared_ptr<ntci::StreamSocket>*   result,
+                   bslmt::Semaphore*                      semaphore,
+                   const bsl::shared_ptr<ntci::Acceptor>& acceptor,
+                   const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+                   const ntca::AcceptEvent&                   event)
+{
+    NTCCFG_WARNING_UNUSED(acceptor);
+
+    if (event.type() == ntca::AcceptEventType::e_COMPLETE) {
+        *result = streamSocket;
+    }
+    else {
+        BSLS_LOG_ERROR("Failed to accept: %s",
+                       event.context().error().text().c_str());
+    }
+
+    semaphore->post();
+}
+
+/// Process the connection described by the specified 'event' by loading
+/// its error into the specified 'result' and posting to the specified
+/// 'semaphore'.
+void processConnect(ntsa::Error*                            result,
+                    bslmt::Semaphore*                       semaphore,
+                    const bsl::shared_ptr<ntci::Connector>& connector,
+                    const ntca::ConnectEvent&               event)
+{
+    NTCCFG_WARNING_UNUSED(connector);
+
+    if (event.type() == ntca::ConnectEventType::e_ERROR) {
+        *result = event.context().error();
+    }
+
+    semaphore->post();
+}
+
+/// Measure the specified 'workload' using the specified 'interface'
+/// according to the specified 'parameters'. Load the measurements into the
+/// specified 'result'. Return the error.
+ntsa::Error measure(Result*                                 result,
+                    const bsl::shared_ptr<ntci::Interface>& interface,
+                    const Parameters&                       parameters,
+                    Workload::Value                         workload)
+{
+    ntsa::Error error;
+
+    bslma::Allocator* allocator = bslma::Default::defaultAllocator();
+
+    State state(parameters, workload);
+
+    // Create a listener socket bound to an ephemeral endpoint on the
+    // loopback interface.
+
+    ntsa::Endpoint sourceEndpoint;
+    if (parameters.d_transport == ntsa::Transport::e_LOCAL_STREAM) {
+        sourceEndpoint.makeLocal(ntsa::LocalName::generateUnique());
+    }
+    else if (parameters.d_transport == ntsa::Transport::e_TCP_IPV6_STREAM) {
+        sourceEndpoint.makeIp(
+            ntsa::IpEndpoint(ntsa::Ipv6Address::loopback(), 0));
+    }
+    else {
+        sourceEndpoint.makeIp(
+            ntsa::IpEndpoint(ntsa::Ipv4Address::loopback(), 0));
+    }
+
+    ntca::ListenerSocketOptions listenerSocketOptions;
+    listenerSocketOptions.setTransport(parameters.d_transport);
+    listenerSocketOptions.setSourceEndpoint(sourceEndpoint);
+    listenerSocketOptions.setBacklog(parameters.d_numConnections);
+
+    bsl::shared_ptr<ntci::ListenerSocket> listenerSocket =
+        interface->createListenerSocket(listenerSocketOptions, allocator);
+
+    error = listenerSocket->open();
+    if (error) {
+        return error;
+    }
+
+    error = listenerSocket->listen();
+    if (error) {
+        return error;
+    }
+
+    // Connect each client to the server.
+
+    bsl::vector<bsl::shared_ptr<Connection> > clients(allocator);
+    bsl::vector<bsl::shared_ptr<Connection> > servers(allocator);
+
+    for (bsl::size_t i = 0; i < parameters.d_numConnections; ++i) {
+        const bool hot = i < parameters.d_numHotConnections;
+
+        // Pin each hot client to the first thread, and each other client to
+        // each thread in turn.
+
+        ntca::LoadBalancingOptions loadBalancingOptions;
+        loadBalancingOptions.setThreadIndex(
+            hot ? 0 : i % parameters.d_numThreads);
+
+        ntca::StreamSocketOptions streamSocketOptions;
+        streamSocketOptions.setTransport(parameters.d_transport);
+        streamSocketOptions.setLoadBalancingOptions(loadBalancingOptions);
+
+        bsl::shared_ptr<ntci::StreamSocket> clientSocket =
+            interface->createStreamSocket(streamSocketOptions, allocator);
+
+        bsl::shared_ptr<ntci::StreamSocket> serverSocket;
+
+        bslmt::Semaphore acceptSemaphore;
+        bslmt::Semaphore connectSemaphore;
+        ntsa::Error      connectError;
+
+        ntci::AcceptCallback acceptCallback =
+            listenerSocket->createAcceptCallback(
+                NTCCFG_BIND(&processAccept,
+                            &serverSocket,
+                            &acceptSemaphore,
+                            NTCCFG_BIND_PLACEHOLDER_1,
+                            NTCCFG_BIND_PLACEHOLDER_2,
+                            NTCCFG_BIND_PLACEHOLDER_3),
+                allocator);
+
+        error = listenerSocket->accept(ntca::AcceptOptions(), acceptCallback);
+        if (error) {
+            return error;
+        }
+
+        ntci::ConnectCallback connectCallback =
+            clientSocket->createConnectCallback(
+                NTCCFG_BIND(&processConnect,
+                            &connectError,
+                            &connectSemaphore,
+                            NTCCFG_BIND_PLACEHOLDER_1,
+                            NTCCFG_BIND_PLACEHOLDER_2),
+                allocator);
+
+        error = clientSocket->connect(listenerSocket->sourceEndpoint(),
+                                      ntca::ConnectOptions(),
+                                      connectCallback);
+        if (error) {
+            return error;
+        }
+
+        connectSemaphore.wait();
+        acceptSemaphore.wait();
+
+        if (connectError) {
+            return connectError;
+        }
+
+        if (!serverSocket) {
+            return ntsa::Error(ntsa::Error::e_CONNECTION_DEAD);
+        }
+
+        clients.push_back(bsl::allocate_shared<Connection>(allocator,
+                                                           &state,
+                                                           clientSocket,
+                                                           true,
+                                                           hot,
+                                                           allocator));
+
+        servers.push_back(bsl::allocate_shared<Connection>(allocator,
+                                                           &state,
+                                                           serverSocket,
+                                                           false,
+                                                           false,
+                                                           allocator));
+    }
+
+    // Begin exchanging messages.
+
+    for (bsl::size_t i = 0; i < servers.size(); ++i) {
+        servers[i]->start();
+    }
+
+    for (bsl::size_t i = 0; i < clients.size(); ++i) {
+        clients[i]->start();
+    }
+
+    bsl::shared_ptr<Publisher> publisher;
+    if (workload == Workload::e_FAN_OUT) {
+        bsl::vector<bsl::shared_ptr<ntci::StreamSocket> > streamSockets(
+            allocator);
+        for (bsl::size_t i = 0; i < servers.size(); ++i) {
+            streamSockets.push_back(servers[i]->streamSocket());
+        }
+
+        publisher = bsl::allocate_shared<Publisher>(allocator,
+                                                    &state,
+                                                    streamSockets,
+                                                    allocator);
+        publisher->start();
+    }
+
+    // Warm up, then record for the configured duration.
+
+    if (parameters.d_warmup > bsls::TimeInterval()) {
+        bslmt::ThreadUtil::sleep(parameters.d_warmup);
+    }
+
+    const bsls::TimeInterval startTime = bdlt::CurrentTime::now();
+    state.d_recording = true;
+
+    bslmt::ThreadUtil::sleep(parameters.d_duration);
+
+    state.d_recording = false;
+    result->d_elapsed = bdlt::CurrentTime::now() - startTime;
+
+    state.d_running = false;
+
+    // Close each socket and wait for the closure to complete before the
+    // connections are destroyed.
+
+    bslmt::Semaphore closeSemaphore;
+
+    for (bsl::size_t i = 0; i < clients.size(); ++i) {
+        clients[i]->close(&closeSemaphore);
+    }
+
+    for (bsl::size_t i = 0; i < servers.size(); ++i) {
+        servers[i]->close(&closeSemaphore);
+    }
+
+    ntci::CloseCallback closeCallback = listenerSocket->createCloseCallback(
+        NTCCFG_BIND(&processClose, &closeSemaphore),
+        allocator);
+
+    listenerSocket->close(closeCallback);
+
+    for (bsl::size_t i = 0; i < clients.size() + servers.size() + 1; ++i) {
+        closeSemaphore.wait();
+    }
+
+    for (bsl::size_t i = 0; i < clients.size(); ++i) {
+        clients[i]->statistics().collect(&result->d_latencies,
+                                         &result->d_numMessages,
+                                         &result->d_numBytes);
+    }
+
+    for (bsl::size_t i = 0; i < servers.size(); ++i) {
+        servers[i]->statistics().collect(&result->d_latencies,
+                                         &result->d_numMessages,
+                                         &result->d_numBytes);
+    }
+
+    return ntsa::Error();
+}
+
+/// Measure each workload using each driver according to the specified
+/// 'parameters'. Return 0 on success and a non-zero value otherwise.
+int execute(const Parameters& parameters)
+{
+    bsl::vector<bsl::string> driverNames = parameters.d_driverNames;
+    if (driverNames.empty()) {
+        ntcf::System::loadDriverSupport(&driverNames, false);
+    }
+
+    bsl::vector<Workload::Value> workloads = parameters.d_workloads;
+    if (workloads.empty()) {
+        workloads.push_back(Workload::e_PING_PONG);
+        workloads.push_back(Workload::e_STREAMING);
+        workloads.push_back(Workload::e_FAN_OUT);
+    }
+
+    int rc = 0;
+
+    for (bsl::size_t i = 0; i < driverNames.size(); ++i) {
+        const bsl::string& driverName = driverNames[i];
+
+        if (!ntcf::System::testDriverSupport(driverName, false)) {
+            bsl::cerr << "Driver '" << driverName << "' is not supported"
+                      << bsl::endl;
+            rc = 1;
+            continue;
+        }
+
+        for (bsl::size_t j = 0; j < workloads.size(); ++j) {
+            const Workload::Value workload = workloads[j];
+
+            ntca::InterfaceConfig interfaceConfig;
+            interfaceConfig.setDriverName(driverName);
+            interfaceConfig.setThreadName("ntcperf");
+            interfaceConfig.setMinThreads(parameters.d_numThreads);
+            interfaceConfig.setMaxThreads(parameters.d_numThreads);
+            interfaceConfig.setDynamicLoadBalancing(false);
+            interfaceConfig.setStrandStealing(parameters.d_strandStealing);
+
+            bsl::shared_ptr<ntci::Interface> interface =
+                ntcf::System::createInterface(interfaceConfig);
+
+            ntsa::Error error = interface->start();
+            if (error) {
+                bsl::cerr << "Failed to start driver '" << driverName
+                          << "': " << error << bsl::endl;
+                rc = 1;
+                continue;
+            }
+
+            Result result;
+            error = measure(&result, interface, parameters, workload);
+
+            interface->shutdown();
+            interface->linger();
+
+            if (error) {
+                bsl::cerr << "Failed to measure workload '"
+                          << Workload::toString(workload) << "' using driver '"
+                          << driverName << "': " << error << bsl::endl;
+                rc = 1;
+                continue;
+            }
+
+            print(bsl::cout, driverName, workload, parameters, &result);
+        }
+    }
+
+    return rc;
+}
+
+}  // close namespace benchmark
+
+void help()
+{
+    bsl::cout
+        << "usage: <program> [options]\n"
+           "  -d, --driver <name>       Measure the driver, may be repeated "
+           "(default: all supported)\n"
+           "  -w, --workload <name>     Measure the workload: ping-pong, "
+           "streaming, or fan-out,\n"
+           "                            may be repeated (default: all)\n"
+           "  -t, --transport <name>    The transport: tcp, tcp6, or local "
+           "(default: tcp)\n"
+           "  -T, --threads <n>         The number of I/O threads (default: "
+           "1)\n"
+           "  -c, --connections <n>     The number of connections (default: "
+           "1)\n"
+           "  -q, --depth <n>           The messages in flight per "
+           "connection (default: 1)\n"
+           "  -s, --request-size <n>    The request payload size (default: "
+           "64)\n"
+           "  -r, --response-size <n>   The response payload size (default: "
+           "64)\n"
+           "  -W, --warmup <seconds>    The warmup duration (default: 1)\n"
+           "  -D, --duration <seconds>  The measured duration (default: 5)\n"
+           "  -k, --hot <n>             The client connections pinned to "
+           "the first thread\n"
+           "                            that simulate work (default: 0)\n"
+           "  -x, --work <us>           The microseconds of work per message "
+           "of each hot\n"
+           "                            connection (default: 0)\n"
+           "  -S, --stealing            Let idle threads steal the callbacks "
+           "of busy threads\n"
+           "  -v, --verbosity <level>   The logging verbosity (default: 0)"
+        << bsl::endl;
+}
+
+int main(int argc, char** argv)
+{
+    ntcf::System::initialize();
+    ntcf::System::ignore(ntscfg::Signal::e_PIPE);
+
+    benchmark::Parameters parameters;
+
+    int verbosity = 0;
+    {
+        int i = 1;
+        while (i < argc) {
+            if ((0 == std::strcmp(argv[i], "-?")) ||
+                (0 == std::strcmp(argv[i], "--help")))
+            {
+                help();
+                return 0;
+            }
+
+            const bool isLast = (i + 1 >= argc);
+
+            if (0 == std::strcmp(argv[i], "-d") ||
+                0 == std::strcmp(argv[i], "--driver"))
+            {
+                if (isLast) {
+                    help();
+                    return 1;
+                }
+                parameters.d_driverNames.push_back(argv[i + 1]);
+                i += 2;
+                continue;
+            }
+
+            if (0 == std::strcmp(argv[i], "-w") ||
+                0 == std::strcmp(argv[i], "--workload"))
+            {
+                benchmark::Workload::Value workload;
+                if (isLast ||
+                    0 != benchmark::Workload::fromString(&workload,
+                                                         argv[i + 1]))
+                {
+                    help();
+                    return 1;
+                }
+                parameters.d_workloads.push_back(workload);
+                i += 2;
+                continue;
+            }
+
+            if (0 == std::strcmp(argv[i], "-t") ||
+                0 == std::strcmp(argv[i], "--transport"))
+            {
+                if (isLast) {
+                    help();
+                    return 1;
+                }
+                if (0 == std::strcmp(argv[i + 1], "tcp")) {
+                    parameters.d_transport =
+                        ntsa::Transport::e_TCP_IPV4_STREAM;
+                }
+                else if (0 == std::strcmp(argv[i + 1], "tcp6")) {
+                    parameters.d_transport =
+                        ntsa::Transport::e_TCP_IPV6_STREAM;
+                }
+                else if (0 == std::strcmp(argv[i + 1], "local")) {
+                    parameters.d_transport = ntsa::Transport::e_LOCAL_STREAM;
+                }
+                else {
+                    help();
+                    return 1;
+                }
+                i += 2;
+                continue;
+            }
+
+            if (0 == std::strcmp(argv[i], "-T") ||
+                0 == std::strcmp(argv[i], "--threads"))
+            {
+                if (isLast) {
+                    help();
+                    return 1;
+                }
+                parameters.d_numThreads = std::atoi(argv[i + 1]);
+                i += 2;
+                continue;
+            }
+
+            if (0 == std::strcmp(argv[i], "-c") ||
+                0 == std::strcmp(argv[i], "--connections"))
+            {
+                if (isLast) {
+                    help();
+                    return 1;
+                }
+                parameters.d_numConnections = std::atoi(argv[i + 1]);
+                i += 2;
+                continue;
+            }
+
+            if (0 == std::strcmp(argv[i], "-q") ||
+                0 == std::strcmp(argv[i], "--depth"))
+            {
+                if (isLast) {
+                    help();
+                    return 1;
+                }
+                parameters.d_depth = std::atoi(argv[i + 1]);
+                i += 2;
+                continue;
+            }
+
+            if (0 == std::strcmp(argv[i], "-s") ||
+                0 == std::strcmp(argv[i], "--request-size"))
+            {
+                if (isLast) {
+                    help();
+                    return 1;
+                }
+                parameters.d_requestSize = std::atoi(argv[i + 1]);
+                i += 2;
+                continue;
+            }
+
+            if (0 == std::strcmp(argv[i], "-r") ||
+                0 == std::strcmp(argv[i], "--response-size"))
+            {
+                if (isLast) {
+                    help();
+                    return 1;
+                }
+                parameters.d_responseSize = std::atoi(argv[i + 1]);
+                i += 2;
+                continue;
+            }
+
+            if (0 == std::strcmp(argv[i], "-W") ||
+                0 == std::strcmp(argv[i], "--warmup"))
+            {
+                if (isLast) {
+                    help();
+                    return 1;
+                }
+                parameters.d_warmup = bsls::TimeInterval(
+                    std::atof(argv[i + 1]));
+                i += 2;
+                continue;
+            }
+
+            if (0 == std::strcmp(argv[i], "-D") ||
+                0 == std::strcmp(argv[i], "--duration"))
+            {
+                if (isLast) {
+                    help();
+                    return 1;
+                }
+                parameters.d_duration = bsls::TimeInterval(
+                    std::atof(argv[i + 1]));
+                i += 2;
+                continue;
+            }
+
+            if (0 == std::strcmp(argv[i], "-k") ||
+                0 == std::strcmp(argv[i], "--hot"))
+            {
+                if (isLast) {
+                    help();
+                    return 1;
+                }
+                parameters.d_numHotConnections = std::atoi(argv[i + 1]);
+                i += 2;
+                continue;
+            }
+
+            if (0 == std::strcmp(argv[i], "-x") ||
+                0 == std::strcmp(argv[i], "--work"))
+            {
+                if (isLast) {
+                    help();
+                    return 1;
+                }
+                parameters.d_work = std::atoi(argv[i + 1]);
+                i += 2;
+                continue;
+            }
+
+            if (0 == std::strcmp(argv[i], "-S") ||
+                0 == std::strcmp(argv[i], "--stealing"))
+            {
+                parameters.d_strandStealing = true;
+                i += 1;
+                continue;
+            }
+
+            if (0 == std::strcmp(argv[i], "-v") ||
+                0 == std::strcmp(argv[i], "--verbosity"))
+            {
+                if (isLast) {
+                    help();
+                    return 1;
+                }
+                verbosity = std::atoi(argv[i + 1]);
+                i += 2;
+                continue;
+            }
+
+            bsl::cerr << "Invalid option: " << argv[i] << bsl::endl;
+            return 1;
+        }
+    }
+
+    if (parameters.d_numThreads == 0 || parameters.d_numConnections == 0 ||
+        parameters.d_depth == 0)
+    {
+        bsl::cerr << "The number of threads, connections, and the depth must "
+                     "be positive"
+                  << bsl::endl;
+        return 1;
+    }
+
+    switch (verbosity) {
+      case 0:
+        break;
+      case 1:
+        bsls::Log::setSeverityThreshold(bsls::LogSeverity::e_ERROR);
+        break;
+      case 2:
+        bsls::Log::setSeverityThreshold(bsls::LogSeverity::e_WARN);
+        break;
+      case 3:
+        bsls::Log::setSeverityThreshold(bsls::LogSeverity::e_INFO);
+        break;
+      case 4:
+        bsls::Log::setSeverityThreshold(bsls::LogSeverity::e_DEBUG);
+        break;
+      default:
+        bsls::Log::setSeverityThreshold(bsls::LogSeverity::e_TRACE);
+        break;
+    }
+
+    return benchmark::execute(parameters);
+}
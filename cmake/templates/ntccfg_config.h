@@ -115,6 +115,11 @@ namespace ntccfg {
 // minimum to a configured maximum.
 #define NTC_BUILD_WITH_THREAD_SCALING @NTF_BUILD_WITH_THREAD_SCALING@
 
+// Build with support for awaiting asynchronous operations from C++20
+// coroutines. This support is only available when the compiler supports
+// coroutines.
+#define NTC_BUILD_WITH_COROUTINES @NTF_BUILD_WITH_COROUTINES@
+
 // Build with support for deprecated features.
 #define NTC_BUILD_WITH_DEPRECATED_FEATURES @NTF_BUILD_WITH_DEPRECATED_FEATURES@
 
@@ -113,6 +113,10 @@ IF NOT DEFINED NTF_CONFIGURE_WITH_THREAD_SCALING (
     set NTF_CONFIGURE_WITH_THREAD_SCALING=1
 )
 
+IF NOT DEFINED NTF_CONFIGURE_WITH_COROUTINES (
+    set NTF_CONFIGURE_WITH_COROUTINES=1
+)
+
 IF NOT DEFINED NTF_CONFIGURE_WITH_DEPRECATED_FEATURES (
     set NTF_CONFIGURE_WITH_DEPRECATED_FEATURES=1
 )
@@ -157,6 +161,10 @@ IF NOT DEFINED NTF_CONFIGURE_WITH_RECURSIVE_MUTEXES (
     set NTF_CONFIGURE_WITH_RECURSIVE_MUTEXES=0
 )
 
+IF NOT DEFINED NTF_CONFIGURE_WITH_APPLICATIONS (
+    set NTF_CONFIGURE_WITH_APPLICATIONS=1
+)
+
 IF NOT DEFINED NTF_CONFIGURE_WITH_USAGE_EXAMPLES (
     set NTF_CONFIGURE_WITH_USAGE_EXAMPLES=1
 )
@@ -300,6 +308,9 @@ if not "%1"=="" (
     if "%1"=="--with-thread-scaling" (
         set NTF_CONFIGURE_WITH_THREAD_SCALING=1
     )
+    if "%1"=="--with-coroutines" (
+        set NTF_CONFIGURE_WITH_COROUTINES=1
+    )
     if "%1"=="--with-deprecated-features" (
         set NTF_CONFIGURE_WITH_DEPRECATED_FEATURES=1
     )
@@ -338,6 +349,9 @@ if not "%1"=="" (
         set NTF_CONFIGURE_WITH_RECURSIVE_MUTEXES=1
     )
 
+    if "%1"=="--with-applications" (
+        set NTF_CONFIGURE_WITH_APPLICATIONS=1
+    )
     if "%1"=="--with-usage-examples" (
         set NTF_CONFIGURE_WITH_USAGE_EXAMPLES=1
     )
@@ -416,6 +430,9 @@ if not "%1"=="" (
     if "%1"=="--without-thread-scaling" (
         set NTF_CONFIGURE_WITH_THREAD_SCALING=0
     )
+    if "%1"=="--without-coroutines" (
+        set NTF_CONFIGURE_WITH_COROUTINES=0
+    )
     if "%1"=="--without-deprecated-features" (
         set NTF_CONFIGURE_WITH_DEPRECATED_FEATURES=0
     )
@@ -454,6 +471,9 @@ if not "%1"=="" (
         set NTF_CONFIGURE_WITH_RECURSIVE_MUTEXES=0
     )
 
+    if "%1"=="--without-applications" (
+        set NTF_CONFIGURE_WITH_APPLICATIONS=0
+    )
     if "%1"=="--without-usage-examples" (
         set NTF_CONFIGURE_WITH_USAGE_EXAMPLES=0
     )
@@ -802,6 +822,7 @@ echo     --with-iocp                      Enable the proactor driver that depend
 
 echo     --with-dynamic-load-balancing    Enable processing I/O on any thread, rather than a single thread
 echo     --with-thread-scaling            Enable automatic scaling of thread pools
+echo     --with-coroutines                Enable awaiting asynchronous operations from C++20 coroutines
 echo     --with-deprecated-features       Enable deprecated features
 echo     --with-logging                   Build with logging
 echo     --with-metrics                   Build with metrics
@@ -814,6 +835,7 @@ echo     --with-warnings-as-errors        Build with warnings as errors
 echo     --with-documentation             Build documentation
 echo     --with-documentation-internal    Build documentation of internals
 
+echo     --with-applications              Build applications
 echo     --with-usage-examples            Build usage examples
 echo     --with-mocks                     Build mocks
 echo     --with-integration-tests         Build integration tests
@@ -56,6 +56,10 @@ DatagramSocketOptions::DatagramSocketOptions()
 , d_timestampOutgoingData()
 , d_timestampIncomingData()
 , d_zeroCopyThreshold()
+, d_maxMessagesPerSend()
+, d_maxMessagesPerReceive()
+, d_udpSegmentationOffload()
+, d_udpReceiveOffload()
 , d_loadBalancingOptions()
 {
 }
@@ -94,6 +98,10 @@ DatagramSocketOptions::DatagramSocketOptions(
 , d_timestampOutgoingData(other.d_timestampOutgoingData)
 , d_timestampIncomingData(other.d_timestampIncomingData)
 , d_zeroCopyThreshold(other.d_zeroCopyThreshold)
+, d_maxMessagesPerSend(other.d_maxMessagesPerSend)
+, d_maxMessagesPerReceive(other.d_maxMessagesPerReceive)
+, d_udpSegmentationOffload(other.d_udpSegmentationOffload)
+, d_udpReceiveOffload(other.d_udpReceiveOffload)
 , d_loadBalancingOptions(other.d_loadBalancingOptions)
 {
 }
@@ -138,6 +146,10 @@ DatagramSocketOptions& DatagramSocketOptions::operator=(
         d_timestampOutgoingData     = other.d_timestampOutgoingData;
         d_timestampIncomingData     = other.d_timestampIncomingData;
         d_zeroCopyThreshold         = other.d_zeroCopyThreshold;
+        d_maxMessagesPerSend        = other.d_maxMessagesPerSend;
+        d_maxMessagesPerReceive     = other.d_maxMessagesPerReceive;
+        d_udpSegmentationOffload    = other.d_udpSegmentationOffload;
+        d_udpReceiveOffload         = other.d_udpReceiveOffload;
         d_loadBalancingOptions      = other.d_loadBalancingOptions;
     }
 
@@ -307,6 +319,26 @@ void DatagramSocketOptions::setZeroCopyThreshold(bsl::size_t value)
     d_zeroCopyThreshold = value;
 }
 
+void DatagramSocketOptions::setMaxMessagesPerSend(bsl::size_t value)
+{
+    d_maxMessagesPerSend = value;
+}
+
+void DatagramSocketOptions::setMaxMessagesPerReceive(bsl::size_t value)
+{
+    d_maxMessagesPerReceive = value;
+}
+
+void DatagramSocketOptions::setUdpSegmentationOffload(bsl::size_t value)
+{
+    d_udpSegmentationOffload = value;
+}
+
+void DatagramSocketOptions::setUdpReceiveOffload(bool value)
+{
+    d_udpReceiveOffload = value;
+}
+
 void DatagramSocketOptions::setLoadBalancingOptions(
     const ntca::LoadBalancingOptions& value)
 {
@@ -501,6 +533,30 @@ const bdlb::NullableValue<bsl::size_t>& DatagramSocketOptions::
     return d_zeroCopyThreshold;
 }
 
+const bdlb::NullableValue<bsl::size_t>& DatagramSocketOptions::
+    maxMessagesPerSend() const
+{
+    return d_maxMessagesPerSend;
+}
+
+const bdlb::NullableValue<bsl::size_t>& DatagramSocketOptions::
+    maxMessagesPerReceive() const
+{
+    return d_maxMessagesPerReceive;
+}
+
+const bdlb::NullableValue<bsl::size_t>& DatagramSocketOptions::
+    udpSegmentationOffload() const
+{
+    return d_udpSegmentationOffload;
+}
+
+const bdlb::NullableValue<bool>& DatagramSocketOptions::udpReceiveOffload()
+    const
+{
+    return d_udpReceiveOffload;
+}
+
 bsl::ostream& DatagramSocketOptions::print(bsl::ostream& stream,
                                            int           level,
                                            int           spacesPerLevel) const
@@ -542,6 +598,11 @@ bsl::ostream& DatagramSocketOptions::print(bsl::ostream& stream,
     printer.printAttribute("timestampOutgoingData", d_timestampOutgoingData);
     printer.printAttribute("timestampIncomingData", d_timestampIncomingData);
     printer.printAttribute("zeroCopyThreshold", d_zeroCopyThreshold);
+    printer.printAttribute("maxMessagesPerSend", d_maxMessagesPerSend);
+    printer.printAttribute("maxMessagesPerReceive", d_maxMessagesPerReceive);
+    printer.printAttribute("udpSegmentationOffload",
+                           d_udpSegmentationOffload);
+    printer.printAttribute("udpReceiveOffload", d_udpReceiveOffload);
     printer.printAttribute("loadBalancingOptions", d_loadBalancingOptions);
     printer.end();
     return stream;
@@ -583,6 +644,10 @@ bool operator==(const DatagramSocketOptions& lhs,
            lhs.timestampOutgoingData() == rhs.timestampOutgoingData() &&
            lhs.timestampIncomingData() == rhs.timestampIncomingData() &&
            lhs.zeroCopyThreshold() == rhs.zeroCopyThreshold() &&
+           lhs.maxMessagesPerSend() == rhs.maxMessagesPerSend() &&
+           lhs.maxMessagesPerReceive() == rhs.maxMessagesPerReceive() &&
+           lhs.udpSegmentationOffload() == rhs.udpSegmentationOffload() &&
+           lhs.udpReceiveOffload() == rhs.udpReceiveOffload() &&
            lhs.loadBalancingOptions() == rhs.loadBalancingOptions();
 }
 
@@ -187,6 +187,30 @@ namespace ntca {
 /// The minimum number of bytes that must be available to send in order to
 /// attempt a zero-copy send.
 ///
+/// @li @b maxMessagesPerSend:
+/// The maximum number of datagrams to send in a single system call, when the
+/// operating system supports sending multiple datagrams at once. Datagrams are
+/// sent one per system call when this value is 1.
+///
+/// @li @b maxMessagesPerReceive:
+/// The maximum number of datagrams to receive in a single system call, when
+/// the operating system supports receiving multiple datagrams at once.
+/// Datagrams are received one per system call when this value is 1.
+///
+/// @li @b udpSegmentationOffload:
+/// The size of each datagram into which the operating system or network
+/// interface segments the data of each datagram sent, so that a single send
+/// operation transmits multiple datagrams to the same endpoint. Datagrams are
+/// not segmented when this value is zero or null.
+///
+/// @li @b udpReceiveOffload:
+/// The flag that indicates the operating system or network interface may
+/// coalesce multiple datagrams received from the same peer into a single
+/// receive operation. Coalesced datagrams are split back into individual
+/// datagrams before being made available to the user. Note that the maximum
+/// datagram size should be large enough to store all the datagrams that may
+/// be coalesced into a single receive operation, i.e., its default value.
+///
 /// @li @b loadBalancingOptions:
 /// The configurable parameters used select a reactor or proactor that drives
 /// the I/O for the socket.
@@ -229,6 +253,10 @@ class DatagramSocketOptions
     bdlb::NullableValue<bool>            d_timestampOutgoingData;
     bdlb::NullableValue<bool>            d_timestampIncomingData;
     bdlb::NullableValue<bsl::size_t>     d_zeroCopyThreshold;
+    bdlb::NullableValue<bsl::size_t>     d_maxMessagesPerSend;
+    bdlb::NullableValue<bsl::size_t>     d_maxMessagesPerReceive;
+    bdlb::NullableValue<bsl::size_t>     d_udpSegmentationOffload;
+    bdlb::NullableValue<bool>            d_udpReceiveOffload;
     ntca::LoadBalancingOptions           d_loadBalancingOptions;
 
   public:
@@ -358,6 +386,22 @@ class DatagramSocketOptions
     /// to attempt a zero-copy send to the specified 'value'.
     void setZeroCopyThreshold(bsl::size_t value);
 
+    /// Set the maximum number of datagrams to send in a single system call to
+    /// the specified 'value'.
+    void setMaxMessagesPerSend(bsl::size_t value);
+
+    /// Set the maximum number of datagrams to receive in a single system call
+    /// to the specified 'value'.
+    void setMaxMessagesPerReceive(bsl::size_t value);
+
+    /// Set the size of each datagram into which the data of each datagram
+    /// sent is segmented to the specified 'value'.
+    void setUdpSegmentationOffload(bsl::size_t value);
+
+    /// Set the flag that indicates multiple datagrams received may be
+    /// coalesced into a single receive operation to the specified 'value'.
+    void setUdpReceiveOffload(bool value);
+
     /// Set the load balancing options to the specified 'value'.
     void setLoadBalancingOptions(const ntca::LoadBalancingOptions& value);
 
@@ -466,6 +510,21 @@ class DatagramSocketOptions
     /// order to attempt a zero-copy send.
     const bdlb::NullableValue<bsl::size_t>& zeroCopyThreshold() const;
 
+    /// Return the maximum number of datagrams to send in a single system call.
+    const bdlb::NullableValue<bsl::size_t>& maxMessagesPerSend() const;
+
+    /// Return the maximum number of datagrams to receive in a single system
+    /// call.
+    const bdlb::NullableValue<bsl::size_t>& maxMessagesPerReceive() const;
+
+    /// Return the size of each datagram into which the data of each datagram
+    /// sent is segmented.
+    const bdlb::NullableValue<bsl::size_t>& udpSegmentationOffload() const;
+
+    /// Return the flag that indicates multiple datagrams received may be
+    /// coalesced into a single receive operation.
+    const bdlb::NullableValue<bool>& udpReceiveOffload() const;
+
     /// Return the load balancing options.
     const ntca::LoadBalancingOptions& loadBalancingOptions() const;
 
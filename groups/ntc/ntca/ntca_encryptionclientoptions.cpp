@@ -27,6 +27,7 @@ EncryptionClientOptions::EncryptionClientOptions(
     bslma::Allocator* basicAllocator)
 : d_options(basicAllocator)
 , d_optionsMap(basicAllocator)
+, d_sessionCacheSize()
 {
 }
 
@@ -35,6 +36,7 @@ EncryptionClientOptions::EncryptionClientOptions(
     bslma::Allocator*              basicAllocator)
 : d_options(other.d_options, basicAllocator)
 , d_optionsMap(other.d_optionsMap, basicAllocator)
+, d_sessionCacheSize(other.d_sessionCacheSize)
 {
 }
 
@@ -46,8 +48,9 @@ EncryptionClientOptions& EncryptionClientOptions::operator=(
     const EncryptionClientOptions& other)
 {
     if (this != &other) {
-        d_options    = other.d_options;
-        d_optionsMap = other.d_optionsMap;
+        d_options          = other.d_options;
+        d_optionsMap       = other.d_optionsMap;
+        d_sessionCacheSize = other.d_sessionCacheSize;
     }
 
     return *this;
@@ -57,6 +60,7 @@ void EncryptionClientOptions::reset()
 {
     d_options.reset();
     d_optionsMap.clear();
+    d_sessionCacheSize.reset();
 }
 
 void EncryptionClientOptions::setMinMethod(
@@ -236,6 +240,11 @@ void EncryptionClientOptions::addOverrides(
     }
 }
 
+void EncryptionClientOptions::setSessionCacheSize(bsl::size_t value)
+{
+    d_sessionCacheSize = value;
+}
+
 ntca::EncryptionMethod::Value EncryptionClientOptions::minMethod() const
 {
     return d_options.minMethod();
@@ -276,6 +285,12 @@ const ntca::EncryptionResourceVector& EncryptionClientOptions::resources()
     return d_options.resources();
 }
 
+const bdlb::NullableValue<bsl::size_t>& EncryptionClientOptions::
+    sessionCacheSize() const
+{
+    return d_sessionCacheSize;
+}
+
 void EncryptionClientOptions::loadServerNameList(
     bsl::vector<bsl::string>* result) const
 {
@@ -315,7 +330,9 @@ bool EncryptionClientOptions::loadServerNameOptions(
 bool EncryptionClientOptions::equals(
     const EncryptionClientOptions& other) const
 {
-    return d_options == other.d_options && d_optionsMap == other.d_optionsMap;
+    return d_options == other.d_options &&
+           d_optionsMap == other.d_optionsMap &&
+           d_sessionCacheSize == other.d_sessionCacheSize;
 }
 
 bsl::ostream& EncryptionClientOptions::print(bsl::ostream& stream,
@@ -348,6 +365,11 @@ bsl::ostream& EncryptionClientOptions::print(bsl::ostream& stream,
 
     printer.printAttribute("map", d_optionsMap);
 
+    if (!d_sessionCacheSize.isNull()) {
+        printer.printAttribute("sessionCacheSize",
+                               d_sessionCacheSize.value());
+    }
+
     printer.end();
     return stream;
 }
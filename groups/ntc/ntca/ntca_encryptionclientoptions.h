@@ -81,6 +81,13 @@ namespace ntca {
 /// name. Note that a server name, in this context, may be an IP address,
 /// domain name, or domain name wildcard such as "*.example.com".
 ///
+/// @li @b sessionCacheSize:
+/// The maximum number of sessions, identified by the server name and the
+/// endpoint of the server, cached so that subsequent connections to the same
+/// server may resume a previous session instead of performing a full
+/// handshake. If not specified or zero, sessions are not cached unless a
+/// session cache is explicitly installed into the encryption client.
+///
 /// @par Thread Safety
 /// This class is not thread safe.
 ///
@@ -89,8 +96,9 @@ class EncryptionClientOptions
 {
     typedef bsl::map<bsl::string, ntca::EncryptionOptions> OptionsMap;
 
-    ntca::EncryptionOptions d_options;
-    OptionsMap              d_optionsMap;
+    ntca::EncryptionOptions          d_options;
+    OptionsMap                       d_optionsMap;
+    bdlb::NullableValue<bsl::size_t> d_sessionCacheSize;
 
   public:
     /// Create new encryption client options.  Optionally specify a
@@ -303,6 +311,11 @@ class EncryptionClientOptions
     void addOverrides(const bsl::string&             serverName,
                       const ntca::EncryptionOptions& options);
 
+    /// Set the maximum number of sessions cached for resumption to the
+    /// specified 'value'. Note that a 'value' of zero disables the session
+    /// cache.
+    void setSessionCacheSize(bsl::size_t value);
+
     /// Return the minimum permitted encryption method, inclusive.
     ntca::EncryptionMethod::Value minMethod() const;
 
@@ -325,6 +338,9 @@ class EncryptionClientOptions
     /// Return the resources.
     const ntca::EncryptionResourceVector& resources() const;
 
+    /// Return the maximum number of sessions cached for resumption.
+    const bdlb::NullableValue<bsl::size_t>& sessionCacheSize() const;
+
     /// Load into the specified 'result' the names of each registered server.
     /// Note that 'serverName' may be an IP address, domain name, or domain
     /// name wildcard such as "*.example.com". Also note that the first name
@@ -57,6 +57,7 @@ InterfaceConfig::InterfaceConfig(bslma::Allocator* basicAllocator)
 , d_timestampOutgoingData()
 , d_timestampIncomingData()
 , d_zeroCopyThreshold()
+, d_zeroCopyReceive()
 , d_keepAlive()
 , d_noDelay()
 , d_debugFlag()
@@ -71,10 +72,17 @@ InterfaceConfig::InterfaceConfig(bslma::Allocator* basicAllocator)
 , d_multicastTimeToLive()
 , d_multicastInterface()
 , d_dynamicLoadBalancing()
+, d_chronologySharding()
+, d_interestJournal()
+, d_listenerSharding()
+, d_strandStealing()
+, d_handshakeThreads()
+, d_handshakeQueueSize()
 , d_driverMetrics()
 , d_driverMetricsPerWaiter()
 , d_socketMetrics()
 , d_socketMetricsPerHandle()
+, d_socketMetricsPerThread()
 , d_resolverEnabled()
 , d_resolverConfig(basicAllocator)
 {
@@ -114,6 +122,7 @@ InterfaceConfig::InterfaceConfig(const InterfaceConfig& other,
 , d_timestampOutgoingData(other.d_timestampOutgoingData)
 , d_timestampIncomingData(other.d_timestampIncomingData)
 , d_zeroCopyThreshold(other.d_zeroCopyThreshold)
+, d_zeroCopyReceive(other.d_zeroCopyReceive)
 , d_keepAlive(other.d_keepAlive)
 , d_noDelay(other.d_noDelay)
 , d_debugFlag(other.d_debugFlag)
@@ -128,10 +137,17 @@ InterfaceConfig::InterfaceConfig(const InterfaceConfig& other,
 , d_multicastTimeToLive(other.d_multicastTimeToLive)
 , d_multicastInterface(other.d_multicastInterface)
 , d_dynamicLoadBalancing(other.d_dynamicLoadBalancing)
+, d_chronologySharding(other.d_chronologySharding)
+, d_interestJournal(other.d_interestJournal)
+, d_listenerSharding(other.d_listenerSharding)
+, d_strandStealing(other.d_strandStealing)
+, d_handshakeThreads(other.d_handshakeThreads)
+, d_handshakeQueueSize(other.d_handshakeQueueSize)
 , d_driverMetrics(other.d_driverMetrics)
 , d_driverMetricsPerWaiter(other.d_driverMetricsPerWaiter)
 , d_socketMetrics(other.d_socketMetrics)
 , d_socketMetricsPerHandle(other.d_socketMetricsPerHandle)
+, d_socketMetricsPerThread(other.d_socketMetricsPerThread)
 , d_resolverEnabled(other.d_resolverEnabled)
 , d_resolverConfig(other.d_resolverConfig, basicAllocator)
 {
@@ -178,6 +194,7 @@ InterfaceConfig& InterfaceConfig::operator=(const InterfaceConfig& other)
         d_timestampOutgoingData     = other.d_timestampOutgoingData;
         d_timestampIncomingData     = other.d_timestampIncomingData;
         d_zeroCopyThreshold         = other.d_zeroCopyThreshold;
+        d_zeroCopyReceive           = other.d_zeroCopyReceive;
         d_keepAlive                 = other.d_keepAlive;
         d_noDelay                   = other.d_noDelay;
         d_debugFlag                 = other.d_debugFlag;
@@ -192,10 +209,17 @@ InterfaceConfig& InterfaceConfig::operator=(const InterfaceConfig& other)
         d_multicastTimeToLive       = other.d_multicastTimeToLive;
         d_multicastInterface        = other.d_multicastInterface;
         d_dynamicLoadBalancing      = other.d_dynamicLoadBalancing;
+        d_chronologySharding        = other.d_chronologySharding;
+        d_interestJournal           = other.d_interestJournal;
+        d_listenerSharding          = other.d_listenerSharding;
+        d_strandStealing            = other.d_strandStealing;
+        d_handshakeThreads          = other.d_handshakeThreads;
+        d_handshakeQueueSize        = other.d_handshakeQueueSize;
         d_driverMetrics             = other.d_driverMetrics;
         d_driverMetricsPerWaiter    = other.d_driverMetricsPerWaiter;
         d_socketMetrics             = other.d_socketMetrics;
         d_socketMetricsPerHandle    = other.d_socketMetricsPerHandle;
+        d_socketMetricsPerThread    = other.d_socketMetricsPerThread;
         d_resolverEnabled           = other.d_resolverEnabled;
         d_resolverConfig            = other.d_resolverConfig;
     }
@@ -363,6 +387,11 @@ void InterfaceConfig::setZeroCopyThreshold(size_t value)
     d_zeroCopyThreshold = value;
 }
 
+void InterfaceConfig::setZeroCopyReceive(bool value)
+{
+    d_zeroCopyReceive = value;
+}
+
 void InterfaceConfig::setKeepAlive(bool value)
 {
     d_keepAlive = value;
@@ -433,6 +462,36 @@ void InterfaceConfig::setDynamicLoadBalancing(bool value)
     d_dynamicLoadBalancing = value;
 }
 
+void InterfaceConfig::setChronologySharding(bool value)
+{
+    d_chronologySharding = value;
+}
+
+void InterfaceConfig::setInterestJournal(bool value)
+{
+    d_interestJournal = value;
+}
+
+void InterfaceConfig::setListenerSharding(bool value)
+{
+    d_listenerSharding = value;
+}
+
+void InterfaceConfig::setStrandStealing(bool value)
+{
+    d_strandStealing = value;
+}
+
+void InterfaceConfig::setHandshakeThreads(bsl::size_t value)
+{
+    d_handshakeThreads = value;
+}
+
+void InterfaceConfig::setHandshakeQueueSize(bsl::size_t value)
+{
+    d_handshakeQueueSize = value;
+}
+
 void InterfaceConfig::setDriverMetrics(bool value)
 {
     d_driverMetrics = value;
@@ -453,6 +512,11 @@ void InterfaceConfig::setSocketMetricsPerHandle(bool value)
     d_socketMetricsPerHandle = value;
 }
 
+void InterfaceConfig::setSocketMetricsPerThread(bool value)
+{
+    d_socketMetricsPerThread = value;
+}
+
 void InterfaceConfig::setResolverEnabled(bool value)
 {
     d_resolverEnabled = value;
@@ -638,6 +702,11 @@ const bdlb::NullableValue<bsl::size_t>& InterfaceConfig::zeroCopyThreshold()
     return d_zeroCopyThreshold;
 }
 
+const bdlb::NullableValue<bool>& InterfaceConfig::zeroCopyReceive() const
+{
+    return d_zeroCopyReceive;
+}
+
 const bdlb::NullableValue<bool>& InterfaceConfig::keepAlive() const
 {
     return d_keepAlive;
@@ -712,6 +781,38 @@ const bdlb::NullableValue<bool>& InterfaceConfig::dynamicLoadBalancing() const
     return d_dynamicLoadBalancing;
 }
 
+const bdlb::NullableValue<bool>& InterfaceConfig::chronologySharding() const
+{
+    return d_chronologySharding;
+}
+
+const bdlb::NullableValue<bool>& InterfaceConfig::interestJournal() const
+{
+    return d_interestJournal;
+}
+
+const bdlb::NullableValue<bool>& InterfaceConfig::listenerSharding() const
+{
+    return d_listenerSharding;
+}
+
+const bdlb::NullableValue<bool>& InterfaceConfig::strandStealing() const
+{
+    return d_strandStealing;
+}
+
+const bdlb::NullableValue<bsl::size_t>& InterfaceConfig::handshakeThreads()
+    const
+{
+    return d_handshakeThreads;
+}
+
+const bdlb::NullableValue<bsl::size_t>& InterfaceConfig::handshakeQueueSize()
+    const
+{
+    return d_handshakeQueueSize;
+}
+
 const bdlb::NullableValue<bool>& InterfaceConfig::driverMetrics() const
 {
     return d_driverMetrics;
@@ -734,6 +835,12 @@ const bdlb::NullableValue<bool>& InterfaceConfig::socketMetricsPerHandle()
     return d_socketMetricsPerHandle;
 }
 
+const bdlb::NullableValue<bool>& InterfaceConfig::socketMetricsPerThread()
+    const
+{
+    return d_socketMetricsPerThread;
+}
+
 const bdlb::NullableValue<bool>& InterfaceConfig::resolverEnabled() const
 {
     return d_resolverEnabled;
@@ -881,6 +988,10 @@ bsl::ostream& InterfaceConfig::print(bsl::ostream& stream,
         printer.printAttribute("zeroCopyThreshold", d_zeroCopyThreshold);
     }
 
+    if (!d_zeroCopyReceive.isNull()) {
+        printer.printAttribute("zeroCopyReceive", d_zeroCopyReceive);
+    }
+
     if (!d_keepAlive.isNull()) {
         printer.printAttribute("keepAlive", d_keepAlive);
     }
@@ -938,6 +1049,30 @@ bsl::ostream& InterfaceConfig::print(bsl::ostream& stream,
         printer.printAttribute("dynamicLoadBalancing", d_dynamicLoadBalancing);
     }
 
+    if (!d_chronologySharding.isNull()) {
+        printer.printAttribute("chronologySharding", d_chronologySharding);
+    }
+
+    if (!d_interestJournal.isNull()) {
+        printer.printAttribute("interestJournal", d_interestJournal);
+    }
+
+    if (!d_listenerSharding.isNull()) {
+        printer.printAttribute("listenerSharding", d_listenerSharding);
+    }
+
+    if (!d_strandStealing.isNull()) {
+        printer.printAttribute("strandStealing", d_strandStealing);
+    }
+
+    if (!d_handshakeThreads.isNull()) {
+        printer.printAttribute("handshakeThreads", d_handshakeThreads);
+    }
+
+    if (!d_handshakeQueueSize.isNull()) {
+        printer.printAttribute("handshakeQueueSize", d_handshakeQueueSize);
+    }
+
     if (!d_driverMetrics.isNull()) {
         printer.printAttribute("driverMetrics", d_driverMetrics);
     }
@@ -956,6 +1091,11 @@ bsl::ostream& InterfaceConfig::print(bsl::ostream& stream,
                                d_socketMetricsPerHandle);
     }
 
+    if (!d_socketMetricsPerThread.isNull()) {
+        printer.printAttribute("socketMetricsPerThread",
+                               d_socketMetricsPerThread);
+    }
+
     if (!d_resolverEnabled.isNull()) {
         printer.printAttribute("resolverEnabled", d_resolverEnabled);
     }
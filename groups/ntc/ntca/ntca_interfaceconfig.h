@@ -206,6 +206,12 @@ namespace ntca {
 /// The minimum number of bytes that must be available to send in order to
 /// attempt a zero-copy send.
 ///
+/// @li @b zeroCopyReceive:
+/// The flag that indicates incoming data should be received by mapping the
+/// pages of the socket receive buffer into memory rather than copying them,
+/// where supported by the operating system. Note that this option is only
+/// implemented by reactors; proactors always copy incoming data.
+///
 /// @li @b keepAlive:
 /// That flag that indicates the operating system implementation should
 /// periodically emit transport-level "keep-alive" packets.
@@ -273,6 +279,56 @@ namespace ntca {
 /// When set to false, this option indicates the user favors greater efficiency
 /// and throughput at the expense of a larger variance in latency.
 ///
+/// @li @b chronologySharding:
+/// The flag that indicates the timers and deferred functions of a reactor
+/// shared among all threads are partitioned into one shard per thread, so
+/// that each thread announces its own timers and deferred functions without
+/// contending on a lock shared with the other threads. This value is ignored
+/// unless I/O is balanced across threads dynamically.
+///
+/// @li @b interestJournal:
+/// The flag that indicates changes to the interest in the events of a socket
+/// made by an I/O thread are journaled, coalesced, and applied to the polling
+/// device once before that thread next blocks, rather than applied to the
+/// polling device immediately.
+///
+/// @li @b listenerSharding:
+/// The flag that indicates each listener socket is implemented by one socket
+/// per thread, each bound to the same endpoint with the "reuse port" option
+/// enabled and driven by that thread's reactor, so that the operating system
+/// distributes incoming connections among the threads and each connection is
+/// accepted and processed by the same thread. This value only applies to
+/// listener sockets whose options specify a TCP transport or source endpoint,
+/// and is ignored if I/O is balanced across threads dynamically or if the
+/// operating system does not support the "reuse port" option.
+///
+/// @li @b strandStealing:
+/// The flag that indicates the callbacks of each socket are invoked on a
+/// strand that is queued to the thread driving the socket's reactor when it
+/// has callbacks to invoke, and that may be stolen and invoked by any other
+/// thread that has no callbacks of its own to invoke. The readiness of each
+/// socket is still detected and processed by the thread driving the socket's
+/// reactor; only the invocation of callbacks migrates, and the callbacks of
+/// each socket are never invoked concurrently or out of order. When enabled,
+/// the strand returned by 'ntci::StreamSocket::strand()' is this callback
+/// strand, and functors passed to 'ntci::StreamSocket::execute()' are also
+/// executed on it, sequenced with the callbacks of the socket. This value
+/// only applies when I/O is balanced across more than one thread
+/// statically, and is ignored otherwise.
+///
+/// @li @b handshakeThreads:
+/// The number of threads dedicated to processing the handshakes of sockets
+/// upgrading to encrypted communication, so that the computation required
+/// by each handshake does not delay the processing of other sockets driven
+/// by the I/O threads. The default value is null, indicating handshakes are
+/// processed by the I/O thread that receives the handshake data.
+///
+/// @li @b handshakeQueueSize:
+/// The maximum number of handshake steps that may be pending processing by
+/// the handshake threads. Handshake steps that cannot be queued are instead
+/// processed by the I/O thread that receives the handshake data. This value
+/// is ignored unless the number of handshake threads is greater than zero.
+///
 /// @li @b driverMetrics:
 /// The flag that indicates driver metrics should be collected.
 ///
@@ -286,6 +342,13 @@ namespace ntca {
 /// @li @b socketMetricsPerHandle:
 /// The flag that indicates socket metrics per handle should be collected.
 ///
+/// @li @b socketMetricsPerThread:
+/// The flag that indicates socket metrics should be accumulated separately by
+/// each I/O thread, without a lock, and merged when the metrics are
+/// collected, so that threads measuring the same metrics do not contend.
+/// Otherwise, the I/O threads update the metrics under a shared lock. The
+/// statistics published are unchanged.
+///
 /// @li @b resolverEnabled:
 /// The flag that indicates this interface should run an asynchronous resolver.
 /// The default value is null, indicating that a default resolver is *not* run.
@@ -341,6 +404,7 @@ class InterfaceConfig
     bdlb::NullableValue<bool>        d_timestampOutgoingData;
     bdlb::NullableValue<bool>        d_timestampIncomingData;
     bdlb::NullableValue<bsl::size_t> d_zeroCopyThreshold;
+    bdlb::NullableValue<bool>        d_zeroCopyReceive;
 
     bdlb::NullableValue<bool>        d_keepAlive;
     bdlb::NullableValue<bool>        d_noDelay;
@@ -358,11 +422,19 @@ class InterfaceConfig
     bdlb::NullableValue<ntsa::IpAddress> d_multicastInterface;
 
     bdlb::NullableValue<bool> d_dynamicLoadBalancing;
+    bdlb::NullableValue<bool> d_chronologySharding;
+    bdlb::NullableValue<bool> d_interestJournal;
+    bdlb::NullableValue<bool> d_listenerSharding;
+    bdlb::NullableValue<bool> d_strandStealing;
+
+    bdlb::NullableValue<bsl::size_t> d_handshakeThreads;
+    bdlb::NullableValue<bsl::size_t> d_handshakeQueueSize;
 
     bdlb::NullableValue<bool> d_driverMetrics;
     bdlb::NullableValue<bool> d_driverMetricsPerWaiter;
     bdlb::NullableValue<bool> d_socketMetrics;
     bdlb::NullableValue<bool> d_socketMetricsPerHandle;
+    bdlb::NullableValue<bool> d_socketMetricsPerThread;
 
     bdlb::NullableValue<bool>                 d_resolverEnabled;
     bdlb::NullableValue<ntca::ResolverConfig> d_resolverConfig;
@@ -500,6 +572,11 @@ class InterfaceConfig
     /// to attempt a zero-copy send to the specified 'value'.
     void setZeroCopyThreshold(size_t value);
 
+    /// Set the flag that indicates incoming data should be received by
+    /// mapping the pages of the socket receive buffer into memory rather than
+    /// copying them to the specified 'value'.
+    void setZeroCopyReceive(bool value);
+
     /// Set the flag enable protocol-level keep-alive messages to the
     /// specified 'value'.
     void setKeepAlive(bool value);
@@ -552,6 +629,34 @@ class InterfaceConfig
     /// to the specified 'value'.
     void setDynamicLoadBalancing(bool value);
 
+    /// Set the flag that indicates the timers and deferred functions of a
+    /// reactor shared among all threads are partitioned into one shard per
+    /// thread to the specified 'value'.
+    void setChronologySharding(bool value);
+
+    /// Set the flag that indicates changes to the interest in the events of
+    /// a socket made by an I/O thread are journaled and applied once before
+    /// that thread next blocks to the specified 'value'.
+    void setInterestJournal(bool value);
+
+    /// Set the flag that indicates each listener socket is implemented by
+    /// one socket per thread, each bound to the same endpoint with the
+    /// "reuse port" option enabled, to the specified 'value'.
+    void setListenerSharding(bool value);
+
+    /// Set the flag that indicates the strands of sockets may be stolen by
+    /// idle threads to the specified 'value'.
+    void setStrandStealing(bool value);
+
+    /// Set the number of threads dedicated to processing the handshakes of
+    /// sockets upgrading to encrypted communication to the specified
+    /// 'value'.
+    void setHandshakeThreads(bsl::size_t value);
+
+    /// Set the maximum number of handshake steps that may be pending
+    /// processing by the handshake threads to the specified 'value'.
+    void setHandshakeQueueSize(bsl::size_t value);
+
     /// Set the flag that indicates driver metrics should be collected to
     /// the specified 'value'.
     void setDriverMetrics(bool value);
@@ -568,6 +673,11 @@ class InterfaceConfig
     /// collected to the specified 'value'.
     void setSocketMetricsPerHandle(bool value);
 
+    /// Set the flag that indicates socket metrics should be accumulated
+    /// separately by each thread and merged when collected to the specified
+    /// 'value'.
+    void setSocketMetricsPerThread(bool value);
+
     /// Set the flag that indicates this interface should run an
     /// asynchronous resolver to the specified 'value'. The default value is
     /// null, indicating that a default resolver is *not* run.
@@ -691,6 +801,11 @@ class InterfaceConfig
     /// order to attempt a zero-copy send.
     const bdlb::NullableValue<bsl::size_t>& zeroCopyThreshold() const;
 
+    /// Return the flag that indicates incoming data should be received by
+    /// mapping the pages of the socket receive buffer into memory rather than
+    /// copying them.
+    const bdlb::NullableValue<bool>& zeroCopyReceive() const;
+
     /// Return the flag enable protocol-level keep-alive messages.
     const bdlb::NullableValue<bool>& keepAlive() const;
 
@@ -740,6 +855,33 @@ class InterfaceConfig
     /// dynamically rather than statically at the time of socket creation.
     const bdlb::NullableValue<bool>& dynamicLoadBalancing() const;
 
+    /// Return the flag that indicates the timers and deferred functions of a
+    /// reactor shared among all threads are partitioned into one shard per
+    /// thread.
+    const bdlb::NullableValue<bool>& chronologySharding() const;
+
+    /// Return the flag that indicates changes to the interest in the events
+    /// of a socket made by an I/O thread are journaled and applied once
+    /// before that thread next blocks.
+    const bdlb::NullableValue<bool>& interestJournal() const;
+
+    /// Return the flag that indicates each listener socket is implemented by
+    /// one socket per thread, each bound to the same endpoint with the
+    /// "reuse port" option enabled.
+    const bdlb::NullableValue<bool>& listenerSharding() const;
+
+    /// Return the flag that indicates the strands of sockets may be stolen
+    /// by idle threads.
+    const bdlb::NullableValue<bool>& strandStealing() const;
+
+    /// Return the number of threads dedicated to processing the handshakes
+    /// of sockets upgrading to encrypted communication.
+    const bdlb::NullableValue<bsl::size_t>& handshakeThreads() const;
+
+    /// Return the maximum number of handshake steps that may be pending
+    /// processing by the handshake threads.
+    const bdlb::NullableValue<bsl::size_t>& handshakeQueueSize() const;
+
     /// Set the flag that indicates driver metrics should be collected to
     /// the specified 'value'.
     const bdlb::NullableValue<bool>& driverMetrics() const;
@@ -756,6 +898,10 @@ class InterfaceConfig
     /// collected to the specified 'value'.
     const bdlb::NullableValue<bool>& socketMetricsPerHandle() const;
 
+    /// Return the flag that indicates socket metrics should be accumulated
+    /// separately by each thread and merged when collected.
+    const bdlb::NullableValue<bool>& socketMetricsPerThread() const;
+
     /// Return the flag that indicates this interface should run an
     /// asynchronous resolver. The default value is null, indicating that a
     /// default resolver is *not* run.
@@ -64,6 +64,8 @@ ListenerSocketOptions::ListenerSocketOptions()
 , d_timestampOutgoingData()
 , d_timestampIncomingData()
 , d_zeroCopyThreshold()
+, d_zeroCopyReceive()
+, d_reusePort()
 , d_loadBalancingOptions()
 {
 }
@@ -104,6 +106,8 @@ ListenerSocketOptions::ListenerSocketOptions(
 , d_timestampOutgoingData(other.d_timestampOutgoingData)
 , d_timestampIncomingData(other.d_timestampIncomingData)
 , d_zeroCopyThreshold(other.d_zeroCopyThreshold)
+, d_zeroCopyReceive(other.d_zeroCopyReceive)
+, d_reusePort(other.d_reusePort)
 , d_loadBalancingOptions(other.d_loadBalancingOptions)
 {
 }
@@ -152,6 +156,8 @@ ListenerSocketOptions& ListenerSocketOptions::operator=(
         d_timestampOutgoingData     = other.d_timestampOutgoingData;
         d_timestampIncomingData     = other.d_timestampIncomingData;
         d_zeroCopyThreshold         = other.d_zeroCopyThreshold;
+        d_zeroCopyReceive           = other.d_zeroCopyReceive;
+        d_reusePort                 = other.d_reusePort;
         d_loadBalancingOptions      = other.d_loadBalancingOptions;
     }
 
@@ -331,6 +337,16 @@ void ListenerSocketOptions::setZeroCopyThreshold(bsl::size_t value)
     d_zeroCopyThreshold = value;
 }
 
+void ListenerSocketOptions::setZeroCopyReceive(bool value)
+{
+    d_zeroCopyReceive = value;
+}
+
+void ListenerSocketOptions::setReusePort(bool value)
+{
+    d_reusePort = value;
+}
+
 void ListenerSocketOptions::setLoadBalancingOptions(
     const ntca::LoadBalancingOptions& value)
 {
@@ -529,6 +545,16 @@ const bdlb::NullableValue<bsl::size_t>& ListenerSocketOptions::
     return d_zeroCopyThreshold;
 }
 
+const bdlb::NullableValue<bool>& ListenerSocketOptions::zeroCopyReceive() const
+{
+    return d_zeroCopyReceive;
+}
+
+const bdlb::NullableValue<bool>& ListenerSocketOptions::reusePort() const
+{
+    return d_reusePort;
+}
+
 const ntca::LoadBalancingOptions& ListenerSocketOptions::loadBalancingOptions()
     const
 {
@@ -578,6 +604,8 @@ bsl::ostream& ListenerSocketOptions::print(bsl::ostream& stream,
     printer.printAttribute("timestampOutgoingData", d_timestampOutgoingData);
     printer.printAttribute("timestampIncomingData", d_timestampIncomingData);
     printer.printAttribute("zeroCopyThreshold", d_zeroCopyThreshold);
+    printer.printAttribute("zeroCopyReceive", d_zeroCopyReceive);
+    printer.printAttribute("reusePort", d_reusePort);
     printer.printAttribute("loadBalancingOptions", d_loadBalancingOptions);
     printer.end();
     return stream;
@@ -619,6 +647,8 @@ bool operator==(const ListenerSocketOptions& lhs,
            lhs.timestampOutgoingData() == rhs.timestampOutgoingData() &&
            lhs.timestampIncomingData() == rhs.timestampIncomingData() &&
            lhs.zeroCopyThreshold() == rhs.zeroCopyThreshold() &&
+           lhs.zeroCopyReceive() == rhs.zeroCopyReceive() &&
+           lhs.reusePort() == rhs.reusePort() &&
            lhs.loadBalancingOptions() == rhs.loadBalancingOptions();
 }
 
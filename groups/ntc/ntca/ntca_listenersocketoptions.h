@@ -203,6 +203,21 @@ namespace ntca {
 /// The minimum number of bytes that must be available to send in order to
 /// attempt a zero-copy send.
 ///
+/// @li @b zeroCopyReceive:
+/// The flag that indicates incoming data should be received by mapping the
+/// pages of the socket receive buffer into memory rather than copying them,
+/// where supported by the operating system. The regions of memory into which
+/// pages are mapped are retained by each socket and reused once the data
+/// mapped into them is released, but each receive still remaps the pages of
+/// its region, so this option only benefits connections that receive large
+/// amounts of data in each receive operation. Note that this option is only
+/// implemented by reactors; proactors always copy incoming data.
+///
+/// @li @b reusePort:
+/// The flag that indicates the operating system should allow multiple sockets
+/// to bind to and listen on the same address and port, distributing incoming
+/// connections among them.
+///
 /// @li @b loadBalancingOptions:
 /// The configurable parameters used select a reactor or proactor that drives
 /// the I/O for the socket.
@@ -247,6 +262,8 @@ class ListenerSocketOptions
     bdlb::NullableValue<bool>           d_timestampOutgoingData;
     bdlb::NullableValue<bool>           d_timestampIncomingData;
     bdlb::NullableValue<bsl::size_t>    d_zeroCopyThreshold;
+    bdlb::NullableValue<bool>           d_zeroCopyReceive;
+    bdlb::NullableValue<bool>           d_reusePort;
     ntca::LoadBalancingOptions          d_loadBalancingOptions;
 
   public:
@@ -382,6 +399,15 @@ class ListenerSocketOptions
     /// to attempt a zero-copy send to the specified 'value'.
     void setZeroCopyThreshold(size_t value);
 
+    /// Set the flag that indicates incoming data should be received by
+    /// mapping the pages of the socket receive buffer into memory rather
+    /// than copying them to the specified 'value'.
+    void setZeroCopyReceive(bool value);
+
+    /// Set the option to allow multiple sockets to bind to and listen on the
+    /// same address and port according to the specified 'value' flag.
+    void setReusePort(bool value);
+
     /// Set the load balancing options to the specified 'value'.
     void setLoadBalancingOptions(const ntca::LoadBalancingOptions& value);
 
@@ -497,6 +523,15 @@ class ListenerSocketOptions
     /// order to attempt a zero-copy send.
     const bdlb::NullableValue<bsl::size_t>& zeroCopyThreshold() const;
 
+    /// Return the flag that indicates incoming data should be received by
+    /// mapping the pages of the socket receive buffer into memory rather
+    /// than copying them.
+    const bdlb::NullableValue<bool>& zeroCopyReceive() const;
+
+    /// Return the option to allow multiple sockets to bind to and listen on
+    /// the same address and port.
+    const bdlb::NullableValue<bool>& reusePort() const;
+
     /// Return the load balancing options.
     const ntca::LoadBalancingOptions& loadBalancingOptions() const;
 
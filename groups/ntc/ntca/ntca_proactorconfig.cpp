@@ -35,6 +35,15 @@ ProactorConfig::ProactorConfig(bslma::Allocator* basicAllocator)
 , d_metricCollection()
 , d_metricCollectionPerWaiter()
 , d_metricCollectionPerSocket()
+, d_providedBufferCount()
+, d_multishotReceive()
+, d_multishotAccept()
+, d_fixedFileCount()
+, d_submissionPolling()
+, d_submissionPollingCpu()
+, d_submissionPollingIdleTime()
+, d_timerWheel()
+, d_timerWheelResolution()
 {
 }
 
@@ -51,6 +60,15 @@ ProactorConfig::ProactorConfig(const ProactorConfig& original,
 , d_metricCollection(original.d_metricCollection)
 , d_metricCollectionPerWaiter(original.d_metricCollectionPerWaiter)
 , d_metricCollectionPerSocket(original.d_metricCollectionPerSocket)
+, d_providedBufferCount(original.d_providedBufferCount)
+, d_multishotReceive(original.d_multishotReceive)
+, d_multishotAccept(original.d_multishotAccept)
+, d_fixedFileCount(original.d_fixedFileCount)
+, d_submissionPolling(original.d_submissionPolling)
+, d_submissionPollingCpu(original.d_submissionPollingCpu)
+, d_submissionPollingIdleTime(original.d_submissionPollingIdleTime)
+, d_timerWheel(original.d_timerWheel)
+, d_timerWheelResolution(original.d_timerWheelResolution)
 {
 }
 
@@ -72,6 +90,15 @@ ProactorConfig& ProactorConfig::operator=(const ProactorConfig& other)
         d_metricCollection          = other.d_metricCollection;
         d_metricCollectionPerWaiter = other.d_metricCollectionPerWaiter;
         d_metricCollectionPerSocket = other.d_metricCollectionPerSocket;
+        d_providedBufferCount       = other.d_providedBufferCount;
+        d_multishotReceive          = other.d_multishotReceive;
+        d_multishotAccept           = other.d_multishotAccept;
+        d_fixedFileCount            = other.d_fixedFileCount;
+        d_submissionPolling         = other.d_submissionPolling;
+        d_submissionPollingCpu      = other.d_submissionPollingCpu;
+        d_submissionPollingIdleTime = other.d_submissionPollingIdleTime;
+        d_timerWheel                = other.d_timerWheel;
+        d_timerWheelResolution      = other.d_timerWheelResolution;
     }
 
     return *this;
@@ -90,6 +117,15 @@ void ProactorConfig::reset()
     d_metricCollection.reset();
     d_metricCollectionPerWaiter.reset();
     d_metricCollectionPerSocket.reset();
+    d_providedBufferCount.reset();
+    d_multishotReceive.reset();
+    d_multishotAccept.reset();
+    d_fixedFileCount.reset();
+    d_submissionPolling.reset();
+    d_submissionPollingCpu.reset();
+    d_submissionPollingIdleTime.reset();
+    d_timerWheel.reset();
+    d_timerWheelResolution.reset();
 }
 
 void ProactorConfig::setDriverMechanism(const ntca::DriverMechanism& value)
@@ -147,6 +183,52 @@ void ProactorConfig::setMetricCollectionPerSocket(bool value)
     d_metricCollectionPerSocket = value;
 }
 
+void ProactorConfig::setProvidedBufferCount(bsl::size_t value)
+{
+    d_providedBufferCount = value;
+}
+
+void ProactorConfig::setMultishotReceive(bool value)
+{
+    d_multishotReceive = value;
+}
+
+void ProactorConfig::setMultishotAccept(bool value)
+{
+    d_multishotAccept = value;
+}
+
+void ProactorConfig::setFixedFileCount(bsl::size_t value)
+{
+    d_fixedFileCount = value;
+}
+
+void ProactorConfig::setSubmissionPolling(bool value)
+{
+    d_submissionPolling = value;
+}
+
+void ProactorConfig::setSubmissionPollingCpu(bsl::size_t value)
+{
+    d_submissionPollingCpu = value;
+}
+
+void ProactorConfig::setSubmissionPollingIdleTime(
+    const bsls::TimeInterval& value)
+{
+    d_submissionPollingIdleTime = value;
+}
+
+void ProactorConfig::setTimerWheel(bool value)
+{
+    d_timerWheel = value;
+}
+
+void ProactorConfig::setTimerWheelResolution(const bsls::TimeInterval& value)
+{
+    d_timerWheelResolution = value;
+}
+
 const bdlb::NullableValue<ntca::DriverMechanism>& ProactorConfig::
     driverMechanism() const
 {
@@ -208,6 +290,55 @@ const bdlb::NullableValue<bool>& ProactorConfig::metricCollectionPerSocket()
     return d_metricCollectionPerSocket;
 }
 
+const bdlb::NullableValue<bsl::size_t>& ProactorConfig::providedBufferCount()
+    const
+{
+    return d_providedBufferCount;
+}
+
+const bdlb::NullableValue<bool>& ProactorConfig::multishotReceive() const
+{
+    return d_multishotReceive;
+}
+
+const bdlb::NullableValue<bool>& ProactorConfig::multishotAccept() const
+{
+    return d_multishotAccept;
+}
+
+const bdlb::NullableValue<bsl::size_t>& ProactorConfig::fixedFileCount() const
+{
+    return d_fixedFileCount;
+}
+
+const bdlb::NullableValue<bool>& ProactorConfig::submissionPolling() const
+{
+    return d_submissionPolling;
+}
+
+const bdlb::NullableValue<bsl::size_t>& ProactorConfig::submissionPollingCpu()
+    const
+{
+    return d_submissionPollingCpu;
+}
+
+const bdlb::NullableValue<bsls::TimeInterval>& ProactorConfig::
+    submissionPollingIdleTime() const
+{
+    return d_submissionPollingIdleTime;
+}
+
+const bdlb::NullableValue<bool>& ProactorConfig::timerWheel() const
+{
+    return d_timerWheel;
+}
+
+const bdlb::NullableValue<bsls::TimeInterval>& ProactorConfig::
+    timerWheelResolution() const
+{
+    return d_timerWheelResolution;
+}
+
 bool ProactorConfig::equals(const ProactorConfig& other) const
 {
     return d_driverMechanism == other.d_driverMechanism &&
@@ -220,7 +351,16 @@ bool ProactorConfig::equals(const ProactorConfig& other) const
            d_maxCyclesPerWait == other.d_maxCyclesPerWait &&
            d_metricCollection == other.d_metricCollection &&
            d_metricCollectionPerWaiter == other.d_metricCollectionPerWaiter &&
-           d_metricCollectionPerSocket == other.d_metricCollectionPerSocket;
+           d_metricCollectionPerSocket == other.d_metricCollectionPerSocket &&
+           d_providedBufferCount == other.d_providedBufferCount &&
+           d_multishotReceive == other.d_multishotReceive &&
+           d_multishotAccept == other.d_multishotAccept &&
+           d_fixedFileCount == other.d_fixedFileCount &&
+           d_submissionPolling == other.d_submissionPolling &&
+           d_submissionPollingCpu == other.d_submissionPollingCpu &&
+           d_submissionPollingIdleTime == other.d_submissionPollingIdleTime &&
+           d_timerWheel == other.d_timerWheel &&
+           d_timerWheelResolution == other.d_timerWheelResolution;
 }
 
 bool ProactorConfig::less(const ProactorConfig& other) const
@@ -297,7 +437,79 @@ bool ProactorConfig::less(const ProactorConfig& other) const
         return false;
     }
 
-    return d_metricCollectionPerSocket < other.d_metricCollectionPerSocket;
+    if (d_metricCollectionPerSocket < other.d_metricCollectionPerSocket) {
+        return true;
+    }
+
+    if (other.d_metricCollectionPerSocket < d_metricCollectionPerSocket) {
+        return false;
+    }
+
+    if (d_providedBufferCount < other.d_providedBufferCount) {
+        return true;
+    }
+
+    if (other.d_providedBufferCount < d_providedBufferCount) {
+        return false;
+    }
+
+    if (d_multishotReceive < other.d_multishotReceive) {
+        return true;
+    }
+
+    if (other.d_multishotReceive < d_multishotReceive) {
+        return false;
+    }
+
+    if (d_multishotAccept < other.d_multishotAccept) {
+        return true;
+    }
+
+    if (other.d_multishotAccept < d_multishotAccept) {
+        return false;
+    }
+
+    if (d_fixedFileCount < other.d_fixedFileCount) {
+        return true;
+    }
+
+    if (other.d_fixedFileCount < d_fixedFileCount) {
+        return false;
+    }
+
+    if (d_submissionPolling < other.d_submissionPolling) {
+        return true;
+    }
+
+    if (other.d_submissionPolling < d_submissionPolling) {
+        return false;
+    }
+
+    if (d_submissionPollingCpu < other.d_submissionPollingCpu) {
+        return true;
+    }
+
+    if (other.d_submissionPollingCpu < d_submissionPollingCpu) {
+        return false;
+    }
+
+    if (d_submissionPollingIdleTime < other.d_submissionPollingIdleTime) {
+        return true;
+    }
+
+    if (other.d_submissionPollingIdleTime < d_submissionPollingIdleTime) {
+        return false;
+    }
+
+    if (d_timerWheel < other.d_timerWheel) {
+        return true;
+    }
+
+    if (other.d_timerWheel < d_timerWheel) {
+        return false;
+    }
+
+    return d_timerWheelResolution < other.d_timerWheelResolution;
 }
 
 bsl::ostream& ProactorConfig::print(bsl::ostream& stream,
@@ -319,6 +531,16 @@ bsl::ostream& ProactorConfig::print(bsl::ostream& stream,
                            d_metricCollectionPerWaiter);
     printer.printAttribute("metricCollectionPerSocket",
                            d_metricCollectionPerSocket);
+    printer.printAttribute("providedBufferCount", d_providedBufferCount);
+    printer.printAttribute("multishotReceive", d_multishotReceive);
+    printer.printAttribute("multishotAccept", d_multishotAccept);
+    printer.printAttribute("fixedFileCount", d_fixedFileCount);
+    printer.printAttribute("submissionPolling", d_submissionPolling);
+    printer.printAttribute("submissionPollingCpu", d_submissionPollingCpu);
+    printer.printAttribute("submissionPollingIdleTime",
+                           d_submissionPollingIdleTime);
+    printer.printAttribute("timerWheel", d_timerWheel);
+    printer.printAttribute("timerWheelResolution", d_timerWheelResolution);
     printer.end();
     return stream;
 }
@@ -24,6 +24,7 @@ BSLS_IDENT("$Id: $")
 #include <ntcscm_version.h>
 #include <bdlb_nullablevalue.h>
 #include <bslh_hash.h>
+#include <bsls_timeinterval.h>
 #include <bsl_iosfwd.h>
 #include <bsl_string.h>
 
@@ -78,6 +79,90 @@ namespace ntca {
 /// The flag that indicates the collection of metrics per socket is enabled or
 /// disabled.
 ///
+/// @li @b providedBufferCount:
+/// The number of buffers the proactor registers with the operating system from
+/// which the operating system selects the buffer into which incoming data is
+/// copied at the time that data arrives, rather than each stream socket
+/// reserving the capacity of its next receive when that receive is initiated.
+/// Provided buffers are drawn from the incoming blob buffer factory of the
+/// proactor and only one buffer is consumed per completed receive, so that
+/// idle connections do not pin receive memory. The default value is null,
+/// indicating that provided buffers are not used. Note that provided buffers
+/// are only supported by certain drivers on certain platforms (e.g. "iouring"
+/// on Linux 5.19 and later); on other drivers this value is ignored.
+///
+/// @li @b multishotReceive:
+/// The flag that indicates a single receive operation initiated for a stream
+/// socket should remain pending in the operating system and complete each time
+/// data arrives, rather than completing once and being initiated again.
+/// Multishot receive operations require provided buffers and a proactor driven
+/// by a single thread. The default value is null, indicating each receive
+/// operation completes once.
+///
+/// @li @b multishotAccept:
+/// The flag that indicates a single accept operation initiated for a listener
+/// socket should remain pending and complete each time a connection is
+/// accepted from the backlog, rather than being initiated again for each
+/// connection. Connections accepted while no accept is requested are staged
+/// until requested. The default value is null, indicating that each accept is
+/// initiated individually. Note that multishot accept is only supported by
+/// certain drivers on certain platforms (e.g. "iouring" on Linux 5.19 and
+/// later, and only when the proactor is driven by a single thread); on other
+/// drivers this value is ignored.
+///
+/// @li @b fixedFileCount:
+/// The maximum number of socket handles the proactor registers with the
+/// operating system in a table of fixed files, so that each operation refers
+/// to the socket by its index in the table rather than by its handle, which
+/// the operating system would otherwise look up and reference count for each
+/// operation. Each socket, including each accepted socket, is installed into
+/// the table when it is attached to the proactor and removed when it is
+/// detached; sockets attached once the table is full are operated upon by
+/// their handles. The default value is null, indicating that no table of fixed
+/// files is registered. Note that fixed files are only supported by certain
+/// drivers on certain platforms (e.g. "iouring"); on other drivers this value
+/// is ignored.
+///
+/// @li @b submissionPolling:
+/// The flag that indicates the operating system should dedicate a kernel
+/// thread to poll the submission queue for newly initiated operations, so that
+/// initiating an operation does not require a system call. The default value
+/// is null, indicating that the submission queue is drained by a system call
+/// made by the thread that initiates the operation or waits for its
+/// completion. Note that submission polling is only supported by certain
+/// drivers on certain platforms (e.g. "iouring" on Linux 5.11 and later); on
+/// other drivers this value is ignored.
+///
+/// @li @b submissionPollingCpu:
+/// The index of the CPU to which the kernel thread polling the submission
+/// queue is bound. The default value is null, indicating the kernel thread is
+/// not bound to any particular CPU. This value is ignored unless submission
+/// polling is enabled.
+///
+/// @li @b submissionPollingIdleTime:
+/// The duration, at millisecond resolution, for which the kernel thread
+/// polling the submission queue continues to poll after the queue becomes
+/// empty, before it goes to sleep and must be explicitly woken up. The default
+/// value is null, indicating the operating system default is used. This value
+/// is ignored unless submission polling is enabled.
+///
+/// @li @b timerWheel:
+/// The flag that indicates the deadlines of timers are indexed by a
+/// hierarchical timing wheel rather than a skip list. A timing wheel schedules
+/// and cancels timers in constant time regardless of how many timers are
+/// scheduled, at the expense of announcing each timer up to one tick of the
+/// wheel after its deadline. The default value is null, indicating deadlines
+/// are indexed by a skip list, which announces each timer at its deadline but
+/// whose cost of scheduling and cancelling timers grows logarithmically with
+/// the number of timers scheduled.
+///
+/// @li @b timerWheelResolution:
+/// The duration of each tick of the timing wheel indexing the deadlines of
+/// timers, which bounds how late after its deadline each timer may be
+/// announced. The default value is null, indicating a resolution of one
+/// millisecond. This value is ignored unless deadlines are indexed by a timing
+/// wheel.
+///
 /// @par Thread Safety
 /// This class is not thread safe.
 ///
@@ -95,6 +180,15 @@ class ProactorConfig
     bdlb::NullableValue<bool>                  d_metricCollection;
     bdlb::NullableValue<bool>                  d_metricCollectionPerWaiter;
     bdlb::NullableValue<bool>                  d_metricCollectionPerSocket;
+    bdlb::NullableValue<bsl::size_t>           d_providedBufferCount;
+    bdlb::NullableValue<bool>                  d_multishotReceive;
+    bdlb::NullableValue<bool>                  d_multishotAccept;
+    bdlb::NullableValue<bsl::size_t>           d_fixedFileCount;
+    bdlb::NullableValue<bool>                  d_submissionPolling;
+    bdlb::NullableValue<bsl::size_t>           d_submissionPollingCpu;
+    bdlb::NullableValue<bsls::TimeInterval>    d_submissionPollingIdleTime;
+    bdlb::NullableValue<bool>                  d_timerWheel;
+    bdlb::NullableValue<bsls::TimeInterval>    d_timerWheelResolution;
 
   public:
     /// Create a new driver configuration. Optionally specify a
@@ -175,6 +269,47 @@ class ProactorConfig
     /// according to the specified 'value'.
     void setMetricCollectionPerSocket(bool value);
 
+    /// Set the number of buffers registered with the operating system from
+    /// which the operating system selects the buffer into which incoming data
+    /// is copied at the time that data arrives to the specified 'value'.
+    void setProvidedBufferCount(bsl::size_t value);
+
+    /// Set the flag that indicates a single receive operation initiated for a
+    /// stream socket should remain pending and complete each time data arrives
+    /// to the specified 'value'.
+    void setMultishotReceive(bool value);
+
+    /// Set the flag that indicates a single accept operation initiated for a
+    /// listener socket should remain pending and complete each time a
+    /// connection is accepted to the specified 'value'.
+    void setMultishotAccept(bool value);
+
+    /// Set the maximum number of socket handles registered with the operating
+    /// system in a table of fixed files to the specified 'value'.
+    void setFixedFileCount(bsl::size_t value);
+
+    /// Set the flag that indicates the operating system should dedicate a
+    /// kernel thread to poll the submission queue to the specified 'value'.
+    void setSubmissionPolling(bool value);
+
+    /// Set the index of the CPU to which the kernel thread polling the
+    /// submission queue is bound to the specified 'value'.
+    void setSubmissionPollingCpu(bsl::size_t value);
+
+    /// Set the duration for which the kernel thread polling the submission
+    /// queue continues to poll after the queue becomes empty to the specified
+    /// 'value'.
+    void setSubmissionPollingIdleTime(const bsls::TimeInterval& value);
+
+    /// Set the flag that indicates the deadlines of timers are indexed by a
+    /// hierarchical timing wheel rather than a skip list to the specified
+    /// 'value'.
+    void setTimerWheel(bool value);
+
+    /// Set the duration of each tick of the timing wheel indexing the
+    /// deadlines of timers to the specified 'value'.
+    void setTimerWheelResolution(const bsls::TimeInterval& value);
+
     /// Return the mechanism of the driver. The returned value identifies
     /// an externally-created and owned mechanism, injected into this
     /// framework. If the value is null, the required mechanisms for each
@@ -221,6 +356,48 @@ class ProactorConfig
     /// is enabled or disabled.
     const bdlb::NullableValue<bool>& metricCollectionPerSocket() const;
 
+    /// Return the number of buffers registered with the operating system from
+    /// which the operating system selects the buffer into which incoming data
+    /// is copied at the time that data arrives. If the value is null, provided
+    /// buffers are not used.
+    const bdlb::NullableValue<bsl::size_t>& providedBufferCount() const;
+
+    /// Return the flag that indicates a single receive operation initiated for
+    /// a stream socket should remain pending and complete each time data
+    /// arrives.
+    const bdlb::NullableValue<bool>& multishotReceive() const;
+
+    /// Return the flag that indicates a single accept operation initiated for
+    /// a listener socket should remain pending and complete each time a
+    /// connection is accepted.
+    const bdlb::NullableValue<bool>& multishotAccept() const;
+
+    /// Return the maximum number of socket handles registered with the
+    /// operating system in a table of fixed files.
+    const bdlb::NullableValue<bsl::size_t>& fixedFileCount() const;
+
+    /// Return the flag that indicates the operating system should dedicate a
+    /// kernel thread to poll the submission queue.
+    const bdlb::NullableValue<bool>& submissionPolling() const;
+
+    /// Return the index of the CPU to which the kernel thread polling the
+    /// submission queue is bound.
+    const bdlb::NullableValue<bsl::size_t>& submissionPollingCpu() const;
+
+    /// Return the duration for which the kernel thread polling the submission
+    /// queue continues to poll after the queue becomes empty.
+    const bdlb::NullableValue<bsls::TimeInterval>& submissionPollingIdleTime()
+        const;
+
+    /// Return the flag that indicates the deadlines of timers are indexed by a
+    /// hierarchical timing wheel rather than a skip list.
+    const bdlb::NullableValue<bool>& timerWheel() const;
+
+    /// Return the duration of each tick of the timing wheel indexing the
+    /// deadlines of timers.
+    const bdlb::NullableValue<bsls::TimeInterval>& timerWheelResolution()
+        const;
+
     /// Return true if this object has the same value as the specified
     /// 'other' object, otherwise return false.
     bool equals(const ProactorConfig& other) const;
@@ -296,6 +473,15 @@ void hashAppend(HASH_ALGORITHM& algorithm, const ProactorConfig& value)
     hashAppend(algorithm, value.metricCollection());
     hashAppend(algorithm, value.metricCollectionPerWaiter());
     hashAppend(algorithm, value.metricCollectionPerSocket());
+    hashAppend(algorithm, value.providedBufferCount());
+    hashAppend(algorithm, value.multishotReceive());
+    hashAppend(algorithm, value.multishotAccept());
+    hashAppend(algorithm, value.fixedFileCount());
+    hashAppend(algorithm, value.submissionPolling());
+    hashAppend(algorithm, value.submissionPollingCpu());
+    hashAppend(algorithm, value.submissionPollingIdleTime());
+    hashAppend(algorithm, value.timerWheel());
+    hashAppend(algorithm, value.timerWheelResolution());
 }
 
 }  // close package namespace
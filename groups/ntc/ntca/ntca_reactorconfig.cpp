@@ -39,6 +39,10 @@ ReactorConfig::ReactorConfig(bslma::Allocator* basicAllocator)
 , d_autoDetach()
 , d_trigger()
 , d_oneShot()
+, d_timerWheel()
+, d_timerWheelResolution()
+, d_chronologySharding()
+, d_interestJournal()
 {
 }
 
@@ -59,6 +63,10 @@ ReactorConfig::ReactorConfig(const ReactorConfig& original,
 , d_autoDetach(original.d_autoDetach)
 , d_trigger(original.d_trigger)
 , d_oneShot(original.d_oneShot)
+, d_timerWheel(original.d_timerWheel)
+, d_timerWheelResolution(original.d_timerWheelResolution)
+, d_chronologySharding(original.d_chronologySharding)
+, d_interestJournal(original.d_interestJournal)
 {
 }
 
@@ -84,6 +92,10 @@ ReactorConfig& ReactorConfig::operator=(const ReactorConfig& other)
         d_autoDetach                = other.d_autoDetach;
         d_trigger                   = other.d_trigger;
         d_oneShot                   = other.d_oneShot;
+        d_timerWheel                = other.d_timerWheel;
+        d_timerWheelResolution      = other.d_timerWheelResolution;
+        d_chronologySharding        = other.d_chronologySharding;
+        d_interestJournal           = other.d_interestJournal;
     }
 
     return *this;
@@ -106,6 +118,10 @@ void ReactorConfig::reset()
     d_autoDetach.reset();
     d_trigger.reset();
     d_oneShot.reset();
+    d_timerWheel.reset();
+    d_timerWheelResolution.reset();
+    d_chronologySharding.reset();
+    d_interestJournal.reset();
 }
 
 void ReactorConfig::setDriverMechanism(const ntca::DriverMechanism& value)
@@ -183,6 +199,26 @@ void ReactorConfig::setOneShot(bool value)
     d_oneShot = value;
 }
 
+void ReactorConfig::setTimerWheel(bool value)
+{
+    d_timerWheel = value;
+}
+
+void ReactorConfig::setTimerWheelResolution(const bsls::TimeInterval& value)
+{
+    d_timerWheelResolution = value;
+}
+
+void ReactorConfig::setChronologySharding(bool value)
+{
+    d_chronologySharding = value;
+}
+
+void ReactorConfig::setInterestJournal(bool value)
+{
+    d_interestJournal = value;
+}
+
 const bdlb::NullableValue<ntca::DriverMechanism>& ReactorConfig::
     driverMechanism() const
 {
@@ -262,6 +298,27 @@ const bdlb::NullableValue<bool>& ReactorConfig::oneShot() const
     return d_oneShot;
 }
 
+const bdlb::NullableValue<bool>& ReactorConfig::timerWheel() const
+{
+    return d_timerWheel;
+}
+
+const bdlb::NullableValue<bsls::TimeInterval>& ReactorConfig::
+    timerWheelResolution() const
+{
+    return d_timerWheelResolution;
+}
+
+const bdlb::NullableValue<bool>& ReactorConfig::chronologySharding() const
+{
+    return d_chronologySharding;
+}
+
+const bdlb::NullableValue<bool>& ReactorConfig::interestJournal() const
+{
+    return d_interestJournal;
+}
+
 bool ReactorConfig::equals(const ReactorConfig& other) const
 {
     return d_driverMechanism == other.d_driverMechanism &&
@@ -277,7 +334,11 @@ bool ReactorConfig::equals(const ReactorConfig& other) const
            d_metricCollectionPerSocket == other.d_metricCollectionPerSocket &&
            d_autoAttach == other.d_autoAttach &&
            d_autoDetach == other.d_autoDetach &&
-           d_trigger == other.d_trigger && d_oneShot == other.d_oneShot;
+           d_trigger == other.d_trigger && d_oneShot == other.d_oneShot &&
+           d_timerWheel == other.d_timerWheel &&
+           d_timerWheelResolution == other.d_timerWheelResolution &&
+           d_chronologySharding == other.d_chronologySharding &&
+           d_interestJournal == other.d_interestJournal;
 }
 
 bool ReactorConfig::less(const ReactorConfig& other) const
@@ -394,7 +455,39 @@ bool ReactorConfig::less(const ReactorConfig& other) const
         return false;
     }
 
-    return d_oneShot < other.d_oneShot;
+    if (d_oneShot < other.d_oneShot) {
+        return true;
+    }
+
+    if (other.d_oneShot < d_oneShot) {
+        return false;
+    }
+
+    if (d_timerWheel < other.d_timerWheel) {
+        return true;
+    }
+
+    if (other.d_timerWheel < d_timerWheel) {
+        return false;
+    }
+
+    if (d_timerWheelResolution < other.d_timerWheelResolution) {
+        return true;
+    }
+
+    if (other.d_timerWheelResolution < d_timerWheelResolution) {
+        return false;
+    }
+
+    if (d_chronologySharding < other.d_chronologySharding) {
+        return true;
+    }
+
+    if (other.d_chronologySharding < d_chronologySharding) {
+        return false;
+    }
+
+    return d_interestJournal < other.d_interestJournal;
 }
 
 bsl::ostream& ReactorConfig::print(bsl::ostream& stream,
@@ -420,6 +513,10 @@ bsl::ostream& ReactorConfig::print(bsl::ostream& stream,
     printer.printAttribute("autoDetach", d_autoDetach);
     printer.printAttribute("trigger", d_trigger);
     printer.printAttribute("oneShot", d_oneShot);
+    printer.printAttribute("timerWheel", d_timerWheel);
+    printer.printAttribute("timerWheelResolution", d_timerWheelResolution);
+    printer.printAttribute("chronologySharding", d_chronologySharding);
+    printer.printAttribute("interestJournal", d_interestJournal);
 
     printer.end();
     return stream;
@@ -25,6 +25,7 @@ BSLS_IDENT("$Id: $")
 #include <ntcscm_version.h>
 #include <bdlb_nullablevalue.h>
 #include <bslh_hash.h>
+#include <bsls_timeinterval.h>
 #include <bsl_iosfwd.h>
 #include <bsl_string.h>
 
@@ -138,6 +139,41 @@ namespace ntca {
 /// event is not subsequently raised until the conditions are "reset". The
 /// default value is unset, or effectively for events to be level-triggered.
 ///
+/// @li @b timerWheel:
+/// The flag that indicates the deadlines of timers are indexed by a
+/// hierarchical timing wheel rather than a skip list. A timing wheel schedules
+/// and cancels timers in constant time regardless of how many timers are
+/// scheduled, at the expense of announcing each timer up to one tick of the
+/// wheel after its deadline. The default value is null, indicating deadlines
+/// are indexed by a skip list, which announces each timer at its deadline but
+/// whose cost of scheduling and cancelling timers grows logarithmically with
+/// the number of timers scheduled.
+///
+/// @li @b timerWheelResolution:
+/// The duration of each tick of the timing wheel indexing the deadlines of
+/// timers, which bounds how late after its deadline each timer may be
+/// announced. The default value is null, indicating a resolution of one
+/// millisecond. This value is ignored unless deadlines are indexed by a timing
+/// wheel.
+///
+/// @li @b chronologySharding:
+/// The flag that indicates the timers and deferred functions of a reactor
+/// driven by multiple threads are partitioned into one shard per thread, so
+/// that each thread announces its own timers and deferred functions without
+/// contending on a lock shared with the other threads. Timers are pinned to
+/// the shard of the thread that created them. The default value is null,
+/// indicating the timers and deferred functions are not sharded. This value is
+/// ignored unless the maximum number of threads is greater than one.
+///
+/// @li @b interestJournal:
+/// The flag that indicates changes to the interest in the events of a socket
+/// made by a thread while it is waiting on the reactor are recorded in a
+/// per-thread journal, coalesced, and applied to the polling device once
+/// before that thread next blocks, rather than applied to the polling device
+/// immediately. The default value is null, indicating changes in interest are
+/// applied immediately. This value is currently only honored by reactors
+/// implemented using the 'epoll' API.
+///
 /// @par Thread Safety
 /// This class is not thread safe.
 ///
@@ -159,6 +195,10 @@ class ReactorConfig
     bdlb::NullableValue<bool>                  d_autoDetach;
     bdlb::NullableValue<ntca::ReactorEventTrigger::Value> d_trigger;
     bdlb::NullableValue<bool>                             d_oneShot;
+    bdlb::NullableValue<bool>                             d_timerWheel;
+    bdlb::NullableValue<bsls::TimeInterval> d_timerWheelResolution;
+    bdlb::NullableValue<bool>                             d_chronologySharding;
+    bdlb::NullableValue<bool>                             d_interestJournal;
 
   public:
     /// Create a new driver configuration. Optionally specify a
@@ -264,6 +304,25 @@ class ReactorConfig
     /// readable or writable.
     void setOneShot(bool value);
 
+    /// Set the flag that indicates the deadlines of timers are indexed by a
+    /// hierarchical timing wheel rather than a skip list to the specified
+    /// 'value'.
+    void setTimerWheel(bool value);
+
+    /// Set the duration of each tick of the timing wheel indexing the
+    /// deadlines of timers to the specified 'value'.
+    void setTimerWheelResolution(const bsls::TimeInterval& value);
+
+    /// Set the flag that indicates the timers and deferred functions of a
+    /// reactor driven by multiple threads are partitioned into one shard per
+    /// thread to the specified 'value'.
+    void setChronologySharding(bool value);
+
+    /// Set the flag that indicates changes to the interest in the events of a
+    /// socket made by a waiting thread are journaled and applied once before
+    /// that thread next blocks to the specified 'value'.
+    void setInterestJournal(bool value);
+
     /// Return the mechanism of the driver. The returned value identifies
     /// an externally-created and owned mechanism, injected into this
     /// framework. If the value is null, the required mechanisms for each
@@ -334,6 +393,25 @@ class ReactorConfig
     /// the reactor will again detect the socket is readable or writable.
     const bdlb::NullableValue<bool>& oneShot() const;
 
+    /// Return the flag that indicates the deadlines of timers are indexed by a
+    /// hierarchical timing wheel rather than a skip list.
+    const bdlb::NullableValue<bool>& timerWheel() const;
+
+    /// Return the duration of each tick of the timing wheel indexing the
+    /// deadlines of timers.
+    const bdlb::NullableValue<bsls::TimeInterval>& timerWheelResolution()
+        const;
+
+    /// Return the flag that indicates the timers and deferred functions of a
+    /// reactor driven by multiple threads are partitioned into one shard per
+    /// thread.
+    const bdlb::NullableValue<bool>& chronologySharding() const;
+
+    /// Return the flag that indicates changes to the interest in the events of
+    /// a socket made by a waiting thread are journaled and applied once before
+    /// that thread next blocks.
+    const bdlb::NullableValue<bool>& interestJournal() const;
+
     /// Return true if this object has the same value as the specified
     /// 'other' object, otherwise return false.
     bool equals(const ReactorConfig& other) const;
@@ -413,6 +491,10 @@ void hashAppend(HASH_ALGORITHM& algorithm, const ReactorConfig& value)
     hashAppend(algorithm, value.autoDetach());
     hashAppend(algorithm, value.trigger());
     hashAppend(algorithm, value.oneShot());
+    hashAppend(algorithm, value.timerWheel());
+    hashAppend(algorithm, value.timerWheelResolution());
+    hashAppend(algorithm, value.chronologySharding());
+    hashAppend(algorithm, value.interestJournal());
 }
 
 }  // close package namespace
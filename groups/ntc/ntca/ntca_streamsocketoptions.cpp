@@ -54,6 +54,7 @@ StreamSocketOptions::StreamSocketOptions()
 , d_timestampOutgoingData()
 , d_timestampIncomingData()
 , d_zeroCopyThreshold()
+, d_zeroCopyReceive()
 , d_loadBalancingOptions()
 {
 }
@@ -89,6 +90,7 @@ StreamSocketOptions::StreamSocketOptions(const StreamSocketOptions& other)
 , d_timestampOutgoingData(other.d_timestampOutgoingData)
 , d_timestampIncomingData(other.d_timestampIncomingData)
 , d_zeroCopyThreshold(other.d_zeroCopyThreshold)
+, d_zeroCopyReceive(other.d_zeroCopyReceive)
 , d_loadBalancingOptions(other.d_loadBalancingOptions)
 {
 }
@@ -133,6 +135,7 @@ StreamSocketOptions& StreamSocketOptions::operator=(
         d_timestampOutgoingData     = other.d_timestampOutgoingData;
         d_timestampIncomingData     = other.d_timestampIncomingData;
         d_zeroCopyThreshold         = other.d_zeroCopyThreshold;
+        d_zeroCopyReceive           = other.d_zeroCopyReceive;
         d_loadBalancingOptions      = other.d_loadBalancingOptions;
     }
 
@@ -292,6 +295,11 @@ void StreamSocketOptions::setZeroCopyThreshold(size_t value)
     d_zeroCopyThreshold = value;
 }
 
+void StreamSocketOptions::setZeroCopyReceive(bool value)
+{
+    d_zeroCopyReceive = value;
+}
+
 void StreamSocketOptions::setLoadBalancingOptions(
     const ntca::LoadBalancingOptions& value)
 {
@@ -473,6 +481,11 @@ const bdlb::NullableValue<bsl::size_t>& StreamSocketOptions::
     return d_zeroCopyThreshold;
 }
 
+const bdlb::NullableValue<bool>& StreamSocketOptions::zeroCopyReceive() const
+{
+    return d_zeroCopyReceive;
+}
+
 bool StreamSocketOptions::abortiveClose() const
 {
     return (!d_lingerFlag.isNull() && d_lingerFlag.value() == true &&
@@ -516,6 +529,7 @@ bsl::ostream& StreamSocketOptions::print(bsl::ostream& stream,
     printer.printAttribute("timestampOutgoingData", d_timestampOutgoingData);
     printer.printAttribute("timestampIncomingData", d_timestampIncomingData);
     printer.printAttribute("zeroCopyThreshold", d_zeroCopyThreshold);
+    printer.printAttribute("zeroCopyReceive", d_zeroCopyReceive);
     printer.printAttribute("loadBalancingOptions", d_loadBalancingOptions);
     printer.end();
     return stream;
@@ -552,6 +566,7 @@ bool operator==(const StreamSocketOptions& lhs, const StreamSocketOptions& rhs)
            lhs.timestampOutgoingData() == rhs.timestampOutgoingData() &&
            lhs.timestampIncomingData() == rhs.timestampIncomingData() &&
            lhs.zeroCopyThreshold() == rhs.zeroCopyThreshold() &&
+           lhs.zeroCopyReceive() == rhs.zeroCopyReceive() &&
            lhs.loadBalancingOptions() == rhs.loadBalancingOptions();
 }
 
@@ -185,6 +185,16 @@ namespace ntca {
 /// The minimum number of bytes that must be available to send in order to
 /// attempt a zero-copy send.
 ///
+/// @li @b zeroCopyReceive:
+/// The flag that indicates incoming data should be received by mapping the
+/// pages of the socket receive buffer into memory rather than copying them,
+/// where supported by the operating system. The regions of memory into which
+/// pages are mapped are retained by each socket and reused once the data
+/// mapped into them is released, but each receive still remaps the pages of
+/// its region, so this option only benefits connections that receive large
+/// amounts of data in each receive operation. Note that this option is only
+/// implemented by reactors; proactors always copy incoming data.
+///
 /// @li @b loadBalancingOptions:
 /// The configurable parameters used select a
 ///   reactor or proactor that drives the I/O for the socket.
@@ -225,6 +235,7 @@ class StreamSocketOptions
     bdlb::NullableValue<bool>           d_timestampOutgoingData;
     bdlb::NullableValue<bool>           d_timestampIncomingData;
     bdlb::NullableValue<bsl::size_t>    d_zeroCopyThreshold;
+    bdlb::NullableValue<bool>           d_zeroCopyReceive;
     ntca::LoadBalancingOptions          d_loadBalancingOptions;
 
   public:
@@ -347,6 +358,11 @@ class StreamSocketOptions
     /// to attempt a zero-copy send to the specified 'value'.
     void setZeroCopyThreshold(size_t value);
 
+    /// Set the flag that indicates incoming data should be received by
+    /// mapping the pages of the socket receive buffer into memory rather
+    /// than copying them to the specified 'value'.
+    void setZeroCopyReceive(bool value);
+
     /// Set the load balancing options to the specified 'value'.
     void setLoadBalancingOptions(const ntca::LoadBalancingOptions& value);
 
@@ -450,6 +466,11 @@ class StreamSocketOptions
     /// order to attempt a zero-copy send.
     const bdlb::NullableValue<bsl::size_t>& zeroCopyThreshold() const;
 
+    /// Return the flag that indicates incoming data should be received by
+    /// mapping the pages of the socket receive buffer into memory rather
+    /// than copying them.
+    const bdlb::NullableValue<bool>& zeroCopyReceive() const;
+
     /// Return the load balancing options.
     const ntca::LoadBalancingOptions& loadBalancingOptions() const;
 
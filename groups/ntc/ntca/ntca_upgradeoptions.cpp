@@ -27,7 +27,9 @@ bool UpgradeOptions::equals(const UpgradeOptions& other) const
 {
     return (d_token == other.d_token && d_serverName == other.d_serverName &&
             d_validation == other.d_validation &&
-            d_deadline == other.d_deadline && d_recurse == other.d_recurse);
+            d_deadline == other.d_deadline && d_recurse == other.d_recurse &&
+            d_offload == other.d_offload &&
+            d_handshakeInline == other.d_handshakeInline);
 }
 
 bool UpgradeOptions::less(const UpgradeOptions& other) const
@@ -64,7 +66,23 @@ bool UpgradeOptions::less(const UpgradeOptions& other) const
         return false;
     }
 
-    return d_recurse < other.d_recurse;
+    if (d_recurse < other.d_recurse) {
+        return true;
+    }
+
+    if (other.d_recurse < d_recurse) {
+        return false;
+    }
+
+    if (d_offload < other.d_offload) {
+        return true;
+    }
+
+    if (other.d_offload < d_offload) {
+        return false;
+    }
+
+    return d_handshakeInline < other.d_handshakeInline;
 }
 
 bsl::ostream& UpgradeOptions::print(bsl::ostream& stream,
@@ -91,6 +109,8 @@ bsl::ostream& UpgradeOptions::print(bsl::ostream& stream,
     }
 
     printer.printAttribute("recurse", d_recurse);
+    printer.printAttribute("offload", d_offload);
+    printer.printAttribute("handshakeInline", d_handshakeInline);
     printer.end();
     return stream;
 }
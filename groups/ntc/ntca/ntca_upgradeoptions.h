@@ -66,6 +66,29 @@ namespace ntca {
 /// constraints are already satisified at the time the asynchronous operation
 /// is initiated.
 ///
+/// @li @b offload:
+/// Install the traffic keys negotiated during the handshake into the
+/// operating system, so that TLS records are encrypted and decrypted by the
+/// kernel instead of in user space. The peer must support the negotiated
+/// protocol version and cipher in a standard manner, and both peers must
+/// request offloading. The upgrade completes only once the traffic keys are
+/// installed, and fails, closing the connection, if either the encryption
+/// session or the socket does not support offloading. Once offloaded,
+/// session tickets received from the peer are discarded, a "close_notify"
+/// alert received from the peer is treated as the end of the data, and
+/// shutting down the connection for sending sends a "close_notify" alert
+/// before shutting down the socket. Note that once offloaded, the
+/// connection cannot be downgraded, and that the connection fails if the
+/// peer sends any other post-handshake message, such as a TLS 1.3 key
+/// update. Also note that offloading is only supported by sockets driven by
+/// reactors: proactor sockets fail to upgrade if offloading is requested.
+///
+/// @li @b handshakeInline:
+/// Process each step of the handshake on the I/O thread that receives the
+/// handshake data, even when the interface dedicates threads to processing
+/// handshakes. This is useful for handshakes that require little
+/// computation, e.g. those resuming a previous session.
+///
 /// @par Thread Safety
 /// This class is not thread safe.
 ///
@@ -80,6 +103,8 @@ class UpgradeOptions
     bdlb::NullableValue<ntca::EncryptionValidation> d_validation;
     bdlb::NullableValue<bsls::TimeInterval>         d_deadline;
     bool                                            d_recurse;
+    bool                                            d_offload;
+    bool                                            d_handshakeInline;
 
   public:
     /// Create new upgrade options having the default value. Optionally specify
@@ -150,6 +175,17 @@ class UpgradeOptions
     /// the asynchronous operation is initiated.
     void setRecurse(bool value);
 
+    /// Set the flag that indicates the traffic keys negotiated during the
+    /// handshake should be installed into the operating system, if
+    /// supported, to the specified 'value'.
+    void setOffload(bool value);
+
+    /// Set the flag that indicates each step of the handshake is processed
+    /// on the I/O thread that receives the handshake data, even when the
+    /// interface dedicates threads to processing handshakes, to the
+    /// specified 'value'.
+    void setHandshakeInline(bool value);
+
     /// Return the token used to cancel the operation.
     const bdlb::NullableValue<ntca::UpgradeToken>& token() const;
 
@@ -167,6 +203,16 @@ class UpgradeOptions
     /// the asynchronous operation is initiated, otherwise return false.
     bool recurse() const;
 
+    /// Return true if the traffic keys negotiated during the handshake
+    /// should be installed into the operating system, if supported,
+    /// otherwise return false.
+    bool offload() const;
+
+    /// Return true if each step of the handshake is processed on the I/O
+    /// thread that receives the handshake data, even when the interface
+    /// dedicates threads to processing handshakes, otherwise return false.
+    bool handshakeInline() const;
+
     /// Return true if this object has the same value as the specified
     /// 'other' object, otherwise return false.
     bool equals(const UpgradeOptions& other) const;
@@ -234,6 +280,8 @@ UpgradeOptions::UpgradeOptions(bslma::Allocator* basicAllocator)
 , d_validation(basicAllocator)
 , d_deadline()
 , d_recurse(false)
+, d_offload(false)
+, d_handshakeInline(false)
 {
 }
 
@@ -245,6 +293,8 @@ UpgradeOptions::UpgradeOptions(const UpgradeOptions& original,
 , d_validation(original.d_validation, basicAllocator)
 , d_deadline(original.d_deadline)
 , d_recurse(original.d_recurse)
+, d_offload(original.d_offload)
+, d_handshakeInline(original.d_handshakeInline)
 {
 }
 
@@ -257,11 +307,13 @@ NTCCFG_INLINE
 UpgradeOptions& UpgradeOptions::operator=(const UpgradeOptions& other)
 {
     if (this != &other) {
-        d_token      = other.d_token;
-        d_serverName = other.d_serverName;
-        d_validation = other.d_validation;
-        d_deadline   = other.d_deadline;
-        d_recurse    = other.d_recurse;
+        d_token           = other.d_token;
+        d_serverName      = other.d_serverName;
+        d_validation      = other.d_validation;
+        d_deadline        = other.d_deadline;
+        d_recurse         = other.d_recurse;
+        d_offload         = other.d_offload;
+        d_handshakeInline = other.d_handshakeInline;
     }
 
     return *this;
@@ -274,7 +326,9 @@ void UpgradeOptions::reset()
     d_serverName.reset();
     d_validation.reset();
     d_deadline.reset();
-    d_recurse = false;
+    d_recurse         = false;
+    d_offload         = false;
+    d_handshakeInline = false;
 }
 
 NTCCFG_INLINE
@@ -389,6 +443,18 @@ void UpgradeOptions::setRecurse(bool value)
     d_recurse = value;
 }
 
+NTCCFG_INLINE
+void UpgradeOptions::setOffload(bool value)
+{
+    d_offload = value;
+}
+
+NTCCFG_INLINE
+void UpgradeOptions::setHandshakeInline(bool value)
+{
+    d_handshakeInline = value;
+}
+
 NTCCFG_INLINE
 const bdlb::NullableValue<ntca::UpgradeToken>& UpgradeOptions::token() const
 {
@@ -420,6 +486,18 @@ bool UpgradeOptions::recurse() const
     return d_recurse;
 }
 
+NTCCFG_INLINE
+bool UpgradeOptions::offload() const
+{
+    return d_offload;
+}
+
+NTCCFG_INLINE
+bool UpgradeOptions::handshakeInline() const
+{
+    return d_handshakeInline;
+}
+
 NTCCFG_INLINE
 bsl::ostream& operator<<(bsl::ostream& stream, const UpgradeOptions& object)
 {
@@ -453,6 +531,8 @@ void hashAppend(HASH_ALGORITHM& algorithm, const UpgradeOptions& value)
     hashAppend(algorithm, value.serverName());
     hashAppend(algorithm, value.deadline());
     hashAppend(algorithm, value.recurse());
+    hashAppend(algorithm, value.offload());
+    hashAppend(algorithm, value.handshakeInline());
 }
 
 }  // close package namespace
@@ -0,0 +1,611 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCCFG_INPLACEFUNCTOR
+#define INCLUDED_NTCCFG_INPLACEFUNCTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_inline.h>
+#include <ntcscm_version.h>
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_assert.h>
+#include <bslmf_integralconstant.h>
+#include <bslmf_isnothrowmoveconstructible.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_alignedbuffer.h>
+#include <bsls_alignmentfromtype.h>
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_keyword.h>
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+
+/// @internal @brief
+/// The default number of bytes of storage in which an
+/// 'ntccfg::InplaceFunctor' stores its callable object without allocating
+/// memory. Note that the default is sufficient to store the binding of a
+/// member function to a shared pointer and an event describing an endpoint,
+/// which includes the path of a Unix domain socket.
+///
+/// @ingroup module_ntccfg
+#ifndef NTCCFG_INPLACE_FUNCTOR_CAPACITY
+#define NTCCFG_INPLACE_FUNCTOR_CAPACITY 256
+#endif
+
+namespace BloombergLP {
+namespace ntccfg {
+
+/// @internal @brief
+/// Provide a move-only function taking no arguments and returning void that
+/// stores small callable objects without allocating memory.
+///
+/// @details
+/// Provide a callable object wrapper, similar to 'bsl::function<void()>',
+/// that stores any callable object whose size does not exceed the specified
+/// 'CAPACITY' in storage embedded within this object, rather than only those
+/// callable objects that fit in the much smaller buffer reserved by
+/// 'bsl::function'. Callable objects larger than the 'CAPACITY' are stored in
+/// memory supplied by the allocator of this object. Objects of this class may
+/// be moved but not copied, so that the stored callable object is never
+/// copied once it is stored, and moving an object of this class never
+/// allocates memory when the allocators of the source and destination are the
+/// same.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntccfg
+template <bsl::size_t CAPACITY = NTCCFG_INPLACE_FUNCTOR_CAPACITY>
+class InplaceFunctor
+{
+    /// This struct describes the operations on a stored callable object.
+    struct Manager {
+        /// Invoke the callable object stored at the specified 'storage'.
+        void (*d_invoke)(void* storage);
+
+        /// Move the callable object stored at the specified 'source',
+        /// allocated by the specified 'sourceAllocator', to the specified
+        /// 'destination', allocated by the specified 'destinationAllocator',
+        /// then destroy the callable object at the 'source'.
+        void (*d_move)(void*             destination,
+                       bslma::Allocator* destinationAllocator,
+                       void*             source,
+                       bslma::Allocator* sourceAllocator);
+
+        /// Destroy the callable object stored at the specified 'storage',
+        /// allocated by the specified 'allocator'.
+        void (*d_destroy)(void* storage, bslma::Allocator* allocator);
+
+        /// The flag indicating the callable object is stored inline.
+        bool d_inplace;
+    };
+
+    /// Provide the operations on a callable object of the specified
+    /// 'CALLABLE' type stored inline.
+    template <typename CALLABLE>
+    struct InplaceManager {
+        static void invoke(void* storage);
+
+        static void move(void*             destination,
+                         bslma::Allocator* destinationAllocator,
+                         void*             source,
+                         bslma::Allocator* sourceAllocator);
+
+        static void destroy(void* storage, bslma::Allocator* allocator);
+
+        /// Return the operations on the 'CALLABLE' type.
+        static const Manager* manager();
+    };
+
+    /// Provide the operations on a callable object of the specified
+    /// 'CALLABLE' type stored in memory supplied by an allocator.
+    template <typename CALLABLE>
+    struct OutplaceManager {
+        static void invoke(void* storage);
+
+        static void move(void*             destination,
+                         bslma::Allocator* destinationAllocator,
+                         void*             source,
+                         bslma::Allocator* sourceAllocator);
+
+        static void destroy(void* storage, bslma::Allocator* allocator);
+
+        /// Return the operations on the 'CALLABLE' type.
+        static const Manager* manager();
+    };
+
+    /// Provide the operations on a 'bsl::function' stored inline that
+    /// retains the allocator with which it was created, so that its target
+    /// is transferred, rather than copied, each time it is moved.
+    struct FunctionManager {
+        static void invoke(void* storage);
+
+        static void move(void*             destination,
+                         bslma::Allocator* destinationAllocator,
+                         void*             source,
+                         bslma::Allocator* sourceAllocator);
+
+        static void destroy(void* storage, bslma::Allocator* allocator);
+
+        /// Return the operations on a 'bsl::function'.
+        static const Manager* manager();
+    };
+
+    /// Provide a metafunction that indicates whether a callable object of
+    /// the specified 'CALLABLE' type is stored inline.
+    template <typename CALLABLE>
+    struct Fits
+    : bsl::integral_constant<bool,
+                             (sizeof(CALLABLE) <= CAPACITY &&
+                              bsls::AlignmentFromType<CALLABLE>::VALUE <=
+                                  bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT)> {
+    };
+
+    BSLMF_ASSERT(CAPACITY >= sizeof(void*));
+
+    bsls::AlignedBuffer<CAPACITY> d_storage;
+    const Manager*                d_manager_p;
+    bslma::Allocator*             d_allocator_p;
+
+  private:
+    InplaceFunctor(const InplaceFunctor&) BSLS_KEYWORD_DELETED;
+    InplaceFunctor& operator=(const InplaceFunctor&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Store a copy of the specified 'callable' inline.
+    template <typename CALLABLE>
+    void store(const CALLABLE& callable, bsl::true_type);
+
+    /// Store a copy of the specified 'callable' in memory supplied by the
+    /// allocator of this object.
+    template <typename CALLABLE>
+    void store(const CALLABLE& callable, bsl::false_type);
+
+    /// Move the callable object stored by the specified 'other' object,
+    /// if any, to this object, which must be empty, leaving the 'other'
+    /// object empty.
+    void acquire(InplaceFunctor* other);
+
+  public:
+    /// Create a new functor that stores no callable object. Optionally
+    /// specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
+    explicit InplaceFunctor(bslma::Allocator* basicAllocator = 0);
+
+    /// Create a new functor that stores a copy of the specified 'callable'
+    /// object, which must be invocable with no arguments. Optionally
+    /// specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used. Note that memory is allocated only if the size of the
+    /// 'callable' object exceeds the 'CAPACITY' of this class.
+    template <typename CALLABLE>
+    InplaceFunctor(const CALLABLE&   callable,
+                   bslma::Allocator* basicAllocator = 0);  // IMPLICIT
+
+    /// Create a new functor that stores a copy of the specified 'function',
+    /// or stores no callable object if the 'function' is empty. Optionally
+    /// specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
+    InplaceFunctor(const bsl::function<void()>& function,
+                   bslma::Allocator*            basicAllocator = 0);
+
+    /// Create a new functor that stores the specified 'function', moved
+    /// rather than copied, or stores no callable object if the 'function' is
+    /// empty, leaving the 'function' in a valid but unspecified state.
+    /// Optionally specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used. Note that the stored function retains the allocator of the
+    /// 'function', so that its target is never copied, regardless of its
+    /// size, and neither storing nor moving it allocates memory.
+    InplaceFunctor(bslmf::MovableRef<bsl::function<void()> > function,
+                   bslma::Allocator* basicAllocator = 0);
+
+    /// Create a new functor that stores the callable object stored by the
+    /// specified 'original' object, if any, leaving the 'original' object
+    /// empty. Use the allocator of the 'original' object to supply memory.
+    InplaceFunctor(bslmf::MovableRef<InplaceFunctor> original)
+        BSLS_KEYWORD_NOEXCEPT;  // IMPLICIT
+
+    /// Create a new functor that stores the callable object stored by the
+    /// specified 'original' object, if any, leaving the 'original' object
+    /// empty. Use the specified 'basicAllocator' to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
+    InplaceFunctor(bslmf::MovableRef<InplaceFunctor> original,
+                   bslma::Allocator*                 basicAllocator);
+
+    /// Destroy this object.
+    ~InplaceFunctor();
+
+    /// Store the callable object stored by the specified 'other' object, if
+    /// any, in this object, leaving the 'other' object empty. Return a
+    /// reference to this modifiable object.
+    InplaceFunctor& operator=(bslmf::MovableRef<InplaceFunctor> other);
+
+    /// Destroy the callable object stored by this object, if any.
+    void reset();
+
+    /// Invoke the stored callable object. The behavior is undefined unless
+    /// this object stores a callable object.
+    void operator()() const;
+
+    /// Return true if this object stores a callable object, otherwise
+    /// return false.
+    operator bool() const;
+
+    /// Return true if this object stores a callable object inline, i.e.,
+    /// without having allocated memory to store it, otherwise return false.
+    bool isInplace() const;
+
+    /// Return the allocator used to supply memory.
+    bslma::Allocator* allocator() const;
+
+    /// Return the number of bytes of storage in which callable objects are
+    /// stored without allocating memory.
+    static bsl::size_t capacity();
+
+    /// Return true if a callable object of the specified 'CALLABLE' type is
+    /// stored without allocating memory, otherwise return false.
+    template <typename CALLABLE>
+    static bool fits();
+
+    /// Defines the traits of this type. These traits can be used to select,
+    /// at compile-time, the most efficient algorithm to manipulate objects
+    /// of this type.
+    BSLMF_NESTED_TRAIT_DECLARATION(InplaceFunctor,
+                                   bslma::UsesBslmaAllocator);
+    BSLMF_NESTED_TRAIT_DECLARATION(InplaceFunctor,
+                                   bsl::is_nothrow_move_constructible);
+};
+
+template <bsl::size_t CAPACITY>
+template <typename CALLABLE>
+void InplaceFunctor<CAPACITY>::InplaceManager<CALLABLE>::invoke(void* storage)
+{
+    (*static_cast<CALLABLE*>(storage))();
+}
+
+template <bsl::size_t CAPACITY>
+template <typename CALLABLE>
+void InplaceFunctor<CAPACITY>::InplaceManager<CALLABLE>::move(
+    void*             destination,
+    bslma::Allocator* destinationAllocator,
+    void*             source,
+    bslma::Allocator* /* sourceAllocator */)
+{
+    CALLABLE* sourceCallable = static_cast<CALLABLE*>(source);
+
+    bslma::ConstructionUtil::construct(
+        static_cast<CALLABLE*>(destination),
+        destinationAllocator,
+        bslmf::MovableRefUtil::move(*sourceCallable));
+
+    sourceCallable->~CALLABLE();
+}
+
+template <bsl::size_t CAPACITY>
+template <typename CALLABLE>
+void InplaceFunctor<CAPACITY>::InplaceManager<CALLABLE>::destroy(
+    void* storage,
+    bslma::Allocator* /* allocator */)
+{
+    static_cast<CALLABLE*>(storage)->~CALLABLE();
+}
+
+template <bsl::size_t CAPACITY>
+template <typename CALLABLE>
+const typename InplaceFunctor<CAPACITY>::Manager* InplaceFunctor<
+    CAPACITY>::InplaceManager<CALLABLE>::manager()
+{
+    static const Manager k_MANAGER = {&invoke, &move, &destroy, true};
+    return &k_MANAGER;
+}
+
+template <bsl::size_t CAPACITY>
+template <typename CALLABLE>
+void InplaceFunctor<CAPACITY>::OutplaceManager<CALLABLE>::invoke(
+    void* storage)
+{
+    (**static_cast<CALLABLE**>(storage))();
+}
+
+template <bsl::size_t CAPACITY>
+template <typename CALLABLE>
+void InplaceFunctor<CAPACITY>::OutplaceManager<CALLABLE>::move(
+    void*             destination,
+    bslma::Allocator* destinationAllocator,
+    void*             source,
+    bslma::Allocator* sourceAllocator)
+{
+    CALLABLE* sourceCallable = *static_cast<CALLABLE**>(source);
+
+    if (destinationAllocator == sourceAllocator) {
+        *static_cast<CALLABLE**>(destination) = sourceCallable;
+        return;
+    }
+
+    CALLABLE* destinationCallable = static_cast<CALLABLE*>(
+        destinationAllocator->allocate(sizeof(CALLABLE)));
+
+    bslma::ConstructionUtil::construct(
+        destinationCallable,
+        destinationAllocator,
+        bslmf::MovableRefUtil::move(*sourceCallable));
+
+    *static_cast<CALLABLE**>(destination) = destinationCallable;
+
+    sourceCallable->~CALLABLE();
+    sourceAllocator->deallocate(sourceCallable);
+}
+
+template <bsl::size_t CAPACITY>
+template <typename CALLABLE>
+void InplaceFunctor<CAPACITY>::OutplaceManager<CALLABLE>::destroy(
+    void*             storage,
+    bslma::Allocator* allocator)
+{
+    CALLABLE* callable = *static_cast<CALLABLE**>(storage);
+
+    callable->~CALLABLE();
+    allocator->deallocate(callable);
+}
+
+template <bsl::size_t CAPACITY>
+template <typename CALLABLE>
+const typename InplaceFunctor<CAPACITY>::Manager* InplaceFunctor<
+    CAPACITY>::OutplaceManager<CALLABLE>::manager()
+{
+    static const Manager k_MANAGER = {&invoke, &move, &destroy, false};
+    return &k_MANAGER;
+}
+
+template <bsl::size_t CAPACITY>
+void InplaceFunctor<CAPACITY>::FunctionManager::invoke(void* storage)
+{
+    (*static_cast<bsl::function<void()>*>(storage))();
+}
+
+template <bsl::size_t CAPACITY>
+void InplaceFunctor<CAPACITY>::FunctionManager::move(
+    void* destination,
+    bslma::Allocator* /* destinationAllocator */,
+    void* source,
+    bslma::Allocator* /* sourceAllocator */)
+{
+    typedef bsl::function<void()> Function;
+
+    Function* sourceFunction = static_cast<Function*>(source);
+
+    new (destination) Function(bslmf::MovableRefUtil::move(*sourceFunction));
+
+    sourceFunction->~Function();
+}
+
+template <bsl::size_t CAPACITY>
+void InplaceFunctor<CAPACITY>::FunctionManager::destroy(
+    void* storage,
+    bslma::Allocator* /* allocator */)
+{
+    typedef bsl::function<void()> Function;
+
+    static_cast<Function*>(storage)->~Function();
+}
+
+template <bsl::size_t CAPACITY>
+const typename InplaceFunctor<CAPACITY>::Manager* InplaceFunctor<
+    CAPACITY>::FunctionManager::manager()
+{
+    static const Manager k_MANAGER = {&invoke, &move, &destroy, true};
+    return &k_MANAGER;
+}
+
+template <bsl::size_t CAPACITY>
+template <typename CALLABLE>
+NTCCFG_INLINE void InplaceFunctor<CAPACITY>::store(const CALLABLE& callable,
+                                                   bsl::true_type)
+{
+    bslma::ConstructionUtil::construct(
+        reinterpret_cast<CALLABLE*>(d_storage.buffer()),
+        d_allocator_p,
+        callable);
+
+    d_manager_p = InplaceManager<CALLABLE>::manager();
+}
+
+template <bsl::size_t CAPACITY>
+template <typename CALLABLE>
+NTCCFG_INLINE void InplaceFunctor<CAPACITY>::store(const CALLABLE& callable,
+                                                   bsl::false_type)
+{
+    CALLABLE* object =
+        static_cast<CALLABLE*>(d_allocator_p->allocate(sizeof(CALLABLE)));
+
+    bslma::ConstructionUtil::construct(object, d_allocator_p, callable);
+
+    *reinterpret_cast<CALLABLE**>(d_storage.buffer()) = object;
+
+    d_manager_p = OutplaceManager<CALLABLE>::manager();
+}
+
+template <bsl::size_t CAPACITY>
+NTCCFG_INLINE void InplaceFunctor<CAPACITY>::acquire(InplaceFunctor* other)
+{
+    BSLS_ASSERT(d_manager_p == 0);
+
+    if (other->d_manager_p != 0) {
+        other->d_manager_p->d_move(d_storage.buffer(),
+                                   d_allocator_p,
+                                   other->d_storage.buffer(),
+                                   other->d_allocator_p);
+
+        d_manager_p        = other->d_manager_p;
+        other->d_manager_p = 0;
+    }
+}
+
+template <bsl::size_t CAPACITY>
+NTCCFG_INLINE InplaceFunctor<CAPACITY>::InplaceFunctor(
+    bslma::Allocator* basicAllocator)
+: d_storage()
+, d_manager_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <bsl::size_t CAPACITY>
+template <typename CALLABLE>
+NTCCFG_INLINE InplaceFunctor<CAPACITY>::InplaceFunctor(
+    const CALLABLE&   callable,
+    bslma::Allocator* basicAllocator)
+: d_storage()
+, d_manager_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    this->store(callable, Fits<CALLABLE>());
+}
+
+template <bsl::size_t CAPACITY>
+NTCCFG_INLINE InplaceFunctor<CAPACITY>::InplaceFunctor(
+    const bsl::function<void()>& function,
+    bslma::Allocator*            basicAllocator)
+: d_storage()
+, d_manager_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (function) {
+        this->store(function, Fits<bsl::function<void()> >());
+    }
+}
+
+template <bsl::size_t CAPACITY>
+NTCCFG_INLINE InplaceFunctor<CAPACITY>::InplaceFunctor(
+    bslmf::MovableRef<bsl::function<void()> > function,
+    bslma::Allocator*                         basicAllocator)
+: d_storage()
+, d_manager_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    typedef bsl::function<void()> Function;
+
+    BSLMF_ASSERT(Fits<Function>::value);
+
+    Function& source = bslmf::MovableRefUtil::access(function);
+
+    if (source) {
+        new (d_storage.buffer()) Function(bslmf::MovableRefUtil::move(source));
+        d_manager_p = FunctionManager::manager();
+    }
+}
+
+template <bsl::size_t CAPACITY>
+NTCCFG_INLINE InplaceFunctor<CAPACITY>::InplaceFunctor(
+    bslmf::MovableRef<InplaceFunctor> original) BSLS_KEYWORD_NOEXCEPT
+: d_storage()
+, d_manager_p(0)
+, d_allocator_p(bslmf::MovableRefUtil::access(original).d_allocator_p)
+{
+    this->acquire(&bslmf::MovableRefUtil::access(original));
+}
+
+template <bsl::size_t CAPACITY>
+NTCCFG_INLINE InplaceFunctor<CAPACITY>::InplaceFunctor(
+    bslmf::MovableRef<InplaceFunctor> original,
+    bslma::Allocator*                 basicAllocator)
+: d_storage()
+, d_manager_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    this->acquire(&bslmf::MovableRefUtil::access(original));
+}
+
+template <bsl::size_t CAPACITY>
+NTCCFG_INLINE InplaceFunctor<CAPACITY>::~InplaceFunctor()
+{
+    this->reset();
+}
+
+template <bsl::size_t CAPACITY>
+NTCCFG_INLINE InplaceFunctor<CAPACITY>& InplaceFunctor<CAPACITY>::operator=(
+    bslmf::MovableRef<InplaceFunctor> other)
+{
+    InplaceFunctor& source = bslmf::MovableRefUtil::access(other);
+
+    if (this != &source) {
+        this->reset();
+        this->acquire(&source);
+    }
+
+    return *this;
+}
+
+template <bsl::size_t CAPACITY>
+NTCCFG_INLINE void InplaceFunctor<CAPACITY>::reset()
+{
+    if (d_manager_p != 0) {
+        d_manager_p->d_destroy(d_storage.buffer(), d_allocator_p);
+        d_manager_p = 0;
+    }
+}
+
+template <bsl::size_t CAPACITY>
+NTCCFG_INLINE void InplaceFunctor<CAPACITY>::operator()() const
+{
+    BSLS_ASSERT(d_manager_p != 0);
+
+    d_manager_p->d_invoke(const_cast<char*>(d_storage.buffer()));
+}
+
+template <bsl::size_t CAPACITY>
+NTCCFG_INLINE InplaceFunctor<CAPACITY>::operator bool() const
+{
+    return d_manager_p != 0;
+}
+
+template <bsl::size_t CAPACITY>
+NTCCFG_INLINE bool InplaceFunctor<CAPACITY>::isInplace() const
+{
+    return d_manager_p != 0 && d_manager_p->d_inplace;
+}
+
+template <bsl::size_t CAPACITY>
+NTCCFG_INLINE bslma::Allocator* InplaceFunctor<CAPACITY>::allocator() const
+{
+    return d_allocator_p;
+}
+
+template <bsl::size_t CAPACITY>
+NTCCFG_INLINE bsl::size_t InplaceFunctor<CAPACITY>::capacity()
+{
+    return CAPACITY;
+}
+
+template <bsl::size_t CAPACITY>
+template <typename CALLABLE>
+NTCCFG_INLINE bool InplaceFunctor<CAPACITY>::fits()
+{
+    return Fits<CALLABLE>::value;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
@@ -0,0 +1,264 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntccfg_inplacefunctor.h>
+
+#include <ntccfg_test.h>
+
+#include <bdlf_bind.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslmf_movableref.h>
+#include <bsls_assert.h>
+#include <bsl_cstring.h>
+#include <bsl_functional.h>
+#include <bsl_memory.h>
+
+using namespace BloombergLP;
+
+namespace test {
+
+/// Provide a callable object of the specified 'SIZE' that increments a
+/// counter when invoked.
+template <bsl::size_t SIZE>
+class Counter
+{
+    int* d_count_p;
+    char d_padding[SIZE];
+
+  public:
+    /// Create a new callable object that increments the specified 'count'.
+    explicit Counter(int* count)
+    : d_count_p(count)
+    {
+        bsl::memset(d_padding, 0, sizeof d_padding);
+    }
+
+    /// Increment the count.
+    void operator()() const
+    {
+        ++(*d_count_p);
+    }
+};
+
+/// Increment the specified 'count' by the specified 'amount'.
+void increment(int* count, const bsl::shared_ptr<int>& amount)
+{
+    *count += *amount;
+}
+
+}  // close namespace test
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Callable objects no larger than the capacity are stored and
+    // invoked without allocating memory.
+
+    ntccfg::TestAllocator ta;
+    {
+        typedef ntccfg::InplaceFunctor<64> Functor;
+
+        int count = 0;
+
+        Functor empty(&ta);
+        NTCCFG_TEST_FALSE(empty);
+        NTCCFG_TEST_FALSE(empty.isInplace());
+
+        Functor functor(test::Counter<32>(&count), &ta);
+        NTCCFG_TEST_TRUE(functor);
+        NTCCFG_TEST_TRUE(functor.isInplace());
+        NTCCFG_TEST_EQ(ta.numBlocksInUse(), 0);
+
+        functor();
+        functor();
+        NTCCFG_TEST_EQ(count, 2);
+
+        bsl::shared_ptr<int> amount;
+        amount.createInplace(&ta, 10);
+
+        const bsl::int64_t numBlocksInUse = ta.numBlocksInUse();
+
+        Functor bound(bdlf::BindUtil::bind(&test::increment, &count, amount),
+                      &ta);
+        NTCCFG_TEST_TRUE(bound.isInplace());
+        NTCCFG_TEST_EQ(ta.numBlocksInUse(), numBlocksInUse);
+
+        bound();
+        NTCCFG_TEST_EQ(count, 12);
+
+        functor.reset();
+        NTCCFG_TEST_FALSE(functor);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: Callable objects larger than the capacity are stored in memory
+    // supplied by the allocator.
+
+    ntccfg::TestAllocator ta;
+    {
+        typedef ntccfg::InplaceFunctor<64> Functor;
+
+        int count = 0;
+
+        NTCCFG_TEST_TRUE(Functor::fits<test::Counter<32> >());
+        NTCCFG_TEST_FALSE(Functor::fits<test::Counter<128> >());
+
+        Functor functor(test::Counter<128>(&count), &ta);
+        NTCCFG_TEST_TRUE(functor);
+        NTCCFG_TEST_FALSE(functor.isInplace());
+        NTCCFG_TEST_EQ(ta.numBlocksInUse(), 1);
+
+        functor();
+        NTCCFG_TEST_EQ(count, 1);
+
+        functor.reset();
+        NTCCFG_TEST_EQ(ta.numBlocksInUse(), 0);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(3)
+{
+    // Concern: Moving a functor transfers the callable object, leaving the
+    // source empty, and allocates memory only when the allocators differ.
+
+    ntccfg::TestAllocator ta;
+    ntccfg::TestAllocator tb;
+    {
+        typedef ntccfg::InplaceFunctor<64> Functor;
+
+        int count = 0;
+
+        Functor small(test::Counter<32>(&count), &ta);
+        Functor large(test::Counter<128>(&count), &ta);
+
+        NTCCFG_TEST_EQ(ta.numBlocksInUse(), 1);
+
+        Functor smallMoved(bslmf::MovableRefUtil::move(small));
+        NTCCFG_TEST_FALSE(small);
+        NTCCFG_TEST_TRUE(smallMoved.isInplace());
+        NTCCFG_TEST_EQ(smallMoved.allocator(), &ta);
+
+        Functor largeMoved(bslmf::MovableRefUtil::move(large));
+        NTCCFG_TEST_FALSE(large);
+        NTCCFG_TEST_FALSE(largeMoved.isInplace());
+        NTCCFG_TEST_EQ(ta.numBlocksInUse(), 1);
+
+        smallMoved();
+        largeMoved();
+        NTCCFG_TEST_EQ(count, 2);
+
+        Functor largeElsewhere(bslmf::MovableRefUtil::move(largeMoved), &tb);
+        NTCCFG_TEST_FALSE(largeMoved);
+        NTCCFG_TEST_EQ(ta.numBlocksInUse(), 0);
+        NTCCFG_TEST_EQ(tb.numBlocksInUse(), 1);
+
+        Functor assigned(&tb);
+        assigned = bslmf::MovableRefUtil::move(smallMoved);
+        NTCCFG_TEST_FALSE(smallMoved);
+
+        assigned();
+        largeElsewhere();
+        NTCCFG_TEST_EQ(count, 4);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+    NTCCFG_TEST_ASSERT(tb.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(4)
+{
+    // Concern: A functor created from an empty 'bsl::function' is empty.
+
+    ntccfg::TestAllocator ta;
+    {
+        typedef ntccfg::InplaceFunctor<> Functor;
+
+        int count = 0;
+
+        bsl::function<void()> empty;
+        Functor               functor1(empty, &ta);
+        NTCCFG_TEST_FALSE(functor1);
+
+        bsl::function<void()> function = test::Counter<8>(&count);
+        Functor               functor2(function, &ta);
+        NTCCFG_TEST_TRUE(functor2);
+        NTCCFG_TEST_TRUE(functor2.isInplace());
+
+        functor2();
+        NTCCFG_TEST_EQ(count, 1);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(5)
+{
+    // Concern: A functor created by moving a 'bsl::function' takes its target
+    // without copying it, even when the target exceeds the small object
+    // buffer of the 'bsl::function', and moving the functor to a functor
+    // using a different allocator does not allocate memory.
+
+    ntccfg::TestAllocator ta;
+    ntccfg::TestAllocator tb;
+    ntccfg::TestAllocator tc;
+    {
+        typedef ntccfg::InplaceFunctor<> Functor;
+
+        int count = 0;
+
+        bsl::function<void()> function(bsl::allocator_arg,
+                                       &ta,
+                                       test::Counter<512>(&count));
+
+        const bsl::int64_t numBlocksInUse = ta.numBlocksInUse();
+        NTCCFG_TEST_GT(numBlocksInUse, 0);
+
+        Functor functor(bslmf::MovableRefUtil::move(function), &tb);
+        NTCCFG_TEST_TRUE(functor);
+        NTCCFG_TEST_TRUE(functor.isInplace());
+        NTCCFG_TEST_EQ(ta.numBlocksInUse(), numBlocksInUse);
+        NTCCFG_TEST_EQ(tb.numBlocksInUse(), 0);
+
+        Functor moved(bslmf::MovableRefUtil::move(functor), &tc);
+        NTCCFG_TEST_FALSE(functor);
+        NTCCFG_TEST_EQ(ta.numBlocksInUse(), numBlocksInUse);
+        NTCCFG_TEST_EQ(tc.numBlocksInUse(), 0);
+
+        moved();
+        NTCCFG_TEST_EQ(count, 1);
+
+        moved.reset();
+
+        bsl::function<void()> empty;
+        Functor               emptyFunctor(bslmf::MovableRefUtil::move(empty),
+                                           &tb);
+        NTCCFG_TEST_FALSE(emptyFunctor);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+    NTCCFG_TEST_ASSERT(tb.numBlocksInUse() == 0);
+    NTCCFG_TEST_ASSERT(tc.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+    NTCCFG_TEST_REGISTER(3);
+    NTCCFG_TEST_REGISTER(4);
+    NTCCFG_TEST_REGISTER(5);
+}
+NTCCFG_TEST_DRIVER_END;
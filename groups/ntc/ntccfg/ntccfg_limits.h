@@ -165,6 +165,22 @@ namespace ntccfg {
 /// @ingroup module_ntccfg
 #define NTCCFG_DEFAULT_DATAGRAM_SOCKET_MAX_MESSAGE_SIZE 65507
 
+/// The default maximum number of messages a datagram socket sends in a single
+/// system call. The default value is 1, indicating messages are sent one at
+/// a time.
+///
+/// @ingroup module_ntccfg
+#define NTCCFG_DEFAULT_DATAGRAM_SOCKET_MAX_MESSAGES_PER_SEND 1
+
+/// The default maximum number of messages a datagram socket receives in a
+/// single system call. The default value is 1, indicating messages are
+/// received one at a time. Note that a datagram socket reserves capacity to
+/// store the maximum datagram size for each message it may receive in a
+/// single system call.
+///
+/// @ingroup module_ntccfg
+#define NTCCFG_DEFAULT_DATAGRAM_SOCKET_MAX_MESSAGES_PER_RECEIVE 1
+
 /// The default recommended threshold of data at which to begin to attempt
 /// zero-copy transmission.
 ///
@@ -217,6 +233,60 @@ namespace ntccfg {
 /// @ingroup module_ntccfg
 #define NTCCFG_DEFAULT_MAX_CYCLES_PER_WAIT 1
 
+/// The default desire to index the deadlines of timers using a hierarchical
+/// timing wheel rather than a skip list. The default value is false.
+///
+/// @ingroup module_ntccfg
+#define NTCCFG_DEFAULT_TIMER_WHEEL false
+
+/// The default duration, in microseconds, of each tick of a timing wheel
+/// indexing the deadlines of timers. The default value is 1000.
+///
+/// @ingroup module_ntccfg
+#define NTCCFG_DEFAULT_TIMER_WHEEL_RESOLUTION 1000
+
+/// The default desire to partition the timers and deferred functions of a
+/// reactor driven by multiple threads into one shard per thread. The default
+/// value is false.
+///
+/// @ingroup module_ntccfg
+#define NTCCFG_DEFAULT_CHRONOLOGY_SHARDING false
+
+/// The default desire to journal changes to the interest in the events of a
+/// socket made by a waiting thread and apply them once before that thread
+/// next blocks. The default value is false.
+///
+/// @ingroup module_ntccfg
+#define NTCCFG_DEFAULT_INTEREST_JOURNAL false
+
+/// The default desire to implement each listener socket by one socket per
+/// thread, each bound to the same endpoint with the "reuse port" option
+/// enabled. The default value is false.
+///
+/// @ingroup module_ntccfg
+#define NTCCFG_DEFAULT_LISTENER_SHARDING false
+
+/// The default desire to allow idle I/O threads to steal the strands of
+/// sockets driven by other I/O threads. The default value is false,
+/// indicating the callbacks of each socket are invoked by the thread that
+/// drives the socket's reactor.
+///
+/// @ingroup module_ntccfg
+#define NTCCFG_DEFAULT_STRAND_STEALING false
+
+/// The default number of threads dedicated to processing the handshakes of
+/// sockets upgrading to encrypted communication. The default value is zero,
+/// indicating handshakes are processed by the I/O threads.
+///
+/// @ingroup module_ntccfg
+#define NTCCFG_DEFAULT_HANDSHAKE_THREADS 0
+
+/// The default maximum number of handshake steps that may be pending
+/// processing by the threads dedicated to processing handshakes.
+///
+/// @ingroup module_ntccfg
+#define NTCCFG_DEFAULT_HANDSHAKE_QUEUE_SIZE 1024
+
 /// The default desire to perform dynamic load balancing, unless otherwise
 /// specified. The default value is false, indicating that, by default, sockets
 /// are statically load-balanced onto I/O threads.
@@ -246,6 +316,12 @@ namespace ntccfg {
 /// @ingroup module_ntccfg
 #define NTCCFG_DEFAULT_SOCKET_METRICS_PER_HANDLE false
 
+/// The default behavior to accumulate socket metrics separately by each
+/// thread. The default value is false.
+///
+/// @ingroup module_ntccfg
+#define NTCCFG_DEFAULT_SOCKET_METRICS_PER_THREAD false
+
 /// The default number of scatter/gather buffers stored in a buffer array
 /// arena. The default value is 64.
 ///
@@ -24,6 +24,7 @@ BSLS_IDENT("$Id: $")
 #include <ntccfg_foreach.h>
 #include <ntccfg_function.h>
 #include <ntccfg_inline.h>
+#include <ntccfg_inplacefunctor.h>
 #include <ntccfg_likely.h>
 #include <ntccfg_limits.h>
 #include <ntccfg_lock.h>
@@ -20,7 +20,10 @@ BSLS_IDENT_RCSID(ntcd_encryption_cpp, "$Id$ $CSID$")
 
 #include <ntci_log.h>
 #include <ntcs_datapool.h>
+#include <ntcs_encryptionsessioncache.h>
 #include <ntsa_data.h>
+#include <bdlb_guid.h>
+#include <bdlb_guidutil.h>
 #include <bdlb_random.h>
 #include <bdlb_string.h>
 #include <bdlbb_blobstreambuf.h>
@@ -126,6 +129,83 @@ ntsa::Error decodeDistinguishedName(ntsa::DistinguishedName* result,
     return ntsa::Error();
 }
 
+// Encode the specified 'text' prefixed by its length to the specified
+// 'destination'. Return the error.
+ntsa::Error encodeString(bsl::streambuf* destination, const bsl::string& text)
+{
+    bdlb::BigEndianUint32 bigEndianTextLength;
+    bigEndianTextLength = static_cast<unsigned int>(text.size());
+
+    if (sizeof bigEndianTextLength !=
+        destination->sputn(reinterpret_cast<const char*>(&bigEndianTextLength),
+                           sizeof bigEndianTextLength))
+    {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    if (text.size() != NTCCFG_WARNING_PROMOTE(
+                           bsl::size_t,
+                           destination->sputn(text.c_str(), text.size())))
+    {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    return ntsa::Error();
+}
+
+// Decode into the specified 'result' text prefixed by its length from the
+// specified 'source'. Return the error.
+ntsa::Error decodeString(bsl::string* result, bsl::streambuf* source)
+{
+    result->clear();
+
+    bdlb::BigEndianUint32 bigEndianTextLength;
+
+    if (sizeof bigEndianTextLength !=
+        source->sgetn(reinterpret_cast<char*>(&bigEndianTextLength),
+                      sizeof bigEndianTextLength))
+    {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    bsl::size_t textLength = static_cast<unsigned int>(bigEndianTextLength);
+    if (textLength == 0) {
+        return ntsa::Error();
+    }
+
+    result->resize(textLength);
+
+    if (result->size() !=
+        NTCCFG_WARNING_PROMOTE(
+            bsl::size_t,
+            source->sgetn(&result->front(), result->size())))
+    {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    return ntsa::Error();
+}
+
+// Load into the specified 'result' a new session cache having the specified
+// 'sessionCacheSize', if defined and non-zero. Allocate memory using the
+// specified 'allocator'.
+void createSessionCache(
+    bsl::shared_ptr<ntci::EncryptionSessionCache>* result,
+    const bdlb::NullableValue<bsl::size_t>&        sessionCacheSize,
+    bslma::Allocator*                              allocator)
+{
+    result->reset();
+
+    if (!sessionCacheSize.isNull() && sessionCacheSize.value() > 0) {
+        bsl::shared_ptr<ntcs::EncryptionSessionCache> sessionCache;
+        sessionCache.createInplace(allocator,
+                                   sessionCacheSize.value(),
+                                   allocator);
+
+        *result = sessionCache;
+    }
+}
+
 }  // close unnamed namespace
 
 EncryptionKey::EncryptionKey()
@@ -636,6 +716,7 @@ bsl::ostream& operator<<(bsl::ostream&                      stream,
 EncryptionHandshake::EncryptionHandshake(bslma::Allocator* basicAllocator)
 : d_role(ntca::EncryptionRole::e_CLIENT)
 , d_certificate_sp()
+, d_sessionId(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -644,6 +725,7 @@ EncryptionHandshake::EncryptionHandshake(const EncryptionHandshake& original,
                                          bslma::Allocator* basicAllocator)
 : d_role(original.d_role)
 , d_certificate_sp(original.d_certificate_sp)
+, d_sessionId(original.d_sessionId, basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -658,6 +740,7 @@ EncryptionHandshake& EncryptionHandshake::operator=(
     if (this != &other) {
         d_role           = other.d_role;
         d_certificate_sp = other.d_certificate_sp;
+        d_sessionId      = other.d_sessionId;
     }
 
     return *this;
@@ -674,6 +757,11 @@ void EncryptionHandshake::setCertificate(
     d_certificate_sp = certificate;
 }
 
+void EncryptionHandshake::setSessionId(const bsl::string& sessionId)
+{
+    d_sessionId = sessionId;
+}
+
 ntsa::Error EncryptionHandshake::decode(bsl::streambuf* source)
 {
     ntsa::Error error;
@@ -704,6 +792,11 @@ ntsa::Error EncryptionHandshake::decode(bsl::streambuf* source)
         return error;
     }
 
+    error = decodeString(&d_sessionId, source);
+    if (error) {
+        return error;
+    }
+
     return ntsa::Error();
 }
 
@@ -734,6 +827,11 @@ ntsa::Error EncryptionHandshake::encode(bsl::streambuf* destination) const
         return error;
     }
 
+    error = encodeString(destination, d_sessionId);
+    if (error) {
+        return error;
+    }
+
     return ntsa::Error();
 }
 
@@ -748,6 +846,11 @@ const bsl::shared_ptr<ntcd::EncryptionCertificate>& EncryptionHandshake::
     return d_certificate_sp;
 }
 
+const bsl::string& EncryptionHandshake::sessionId() const
+{
+    return d_sessionId;
+}
+
 // FREE OPERATORS
 bsl::ostream& operator<<(bsl::ostream&                    stream,
                          const ntcd::EncryptionHandshake& object)
@@ -758,6 +861,10 @@ bsl::ostream& operator<<(bsl::ostream&                    stream,
         stream << " certificate = " << *object.certificate();
     }
 
+    if (!object.sessionId().empty()) {
+        stream << " sessionId = " << object.sessionId();
+    }
+
     stream << " ]";
 
     return stream;
@@ -840,6 +947,7 @@ ntsa::Error Encryption::enqueueOutgoingHello()
         ntcd::EncryptionHandshake handshake;
         handshake.setRole(d_role);
         handshake.setCertificate(d_sourceCertificate_sp);
+        handshake.setSessionId(d_sessionId);
 
         NTCI_LOG_TRACE("Encryption enqueuing outgoing hello in role %s",
                        ntca::EncryptionRole::toString(d_role));
@@ -1205,6 +1313,12 @@ ntsa::Error Encryption::processIncomingHello()
 
         if (d_role == ntca::EncryptionRole::e_CLIENT) {
             BSLS_ASSERT(d_remoteCertificate_sp);
+
+            error = this->completeSession(handshake.sessionId());
+            if (error) {
+                return error;
+            }
+
             d_handshakeState = e_ESTABLISHED;
             {
                 bslmt::UnLockGuard<bslmt::Mutex> guard(&d_mutex);
@@ -1213,6 +1327,11 @@ ntsa::Error Encryption::processIncomingHello()
             d_handshakeCallback = ntci::Encryption::HandshakeCallback();
         }
         else {
+            error = this->acceptSession(handshake.sessionId(), name);
+            if (error) {
+                return error;
+            }
+
             error = this->enqueueOutgoingHello();
             if (error) {
                 return error;
@@ -1389,6 +1508,106 @@ ntsa::Error Encryption::process()
     return ntsa::Error();
 }
 
+bsl::string Encryption::clientSessionKey() const
+{
+    bsl::string result;
+
+    if (d_serverName.isNull() && d_remoteEndpoint.isNull()) {
+        return result;
+    }
+
+    if (!d_serverName.isNull()) {
+        result.append(d_serverName.value());
+    }
+
+    result.append(1, '@');
+
+    if (!d_remoteEndpoint.isNull()) {
+        result.append(d_remoteEndpoint.value().text());
+    }
+
+    return result;
+}
+
+ntsa::Error Encryption::acceptSession(const bsl::string& sessionId,
+                                      const bsl::string& name)
+{
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    d_sessionId.clear();
+    d_sessionResumed = false;
+
+    if (!d_sessionCache_sp) {
+        return ntsa::Error();
+    }
+
+    // The state of a session cached by the server is the name of the client
+    // that established it: a session may only be resumed by the same client.
+
+    if (!sessionId.empty()) {
+        bsl::vector<char> session;
+        error = d_sessionCache_sp->load(&session, sessionId);
+        if (!error && bsl::string(session.begin(), session.end()) == name) {
+            NTCI_LOG_TRACE("Encryption resuming session %s",
+                           sessionId.c_str());
+
+            d_sessionId      = sessionId;
+            d_sessionResumed = true;
+
+            return ntsa::Error();
+        }
+    }
+
+    bsl::stringstream ss;
+    ss << bdlb::GuidUtil::generate();
+
+    d_sessionId = ss.str();
+
+    error = d_sessionCache_sp->store(
+        d_sessionId,
+        bsl::vector<char>(name.begin(), name.end()));
+    if (error) {
+        return error;
+    }
+
+    NTCI_LOG_TRACE("Encryption caching session %s", d_sessionId.c_str());
+
+    return ntsa::Error();
+}
+
+ntsa::Error Encryption::completeSession(const bsl::string& sessionId)
+{
+    ntsa::Error error;
+
+    d_sessionResumed = !d_sessionId.empty() && d_sessionId == sessionId;
+    d_sessionId      = sessionId;
+
+    if (!d_sessionCache_sp) {
+        return ntsa::Error();
+    }
+
+    const bsl::string key = this->clientSessionKey();
+    if (key.empty()) {
+        return ntsa::Error();
+    }
+
+    if (d_sessionId.empty()) {
+        d_sessionCache_sp->remove(key);
+        return ntsa::Error();
+    }
+
+    error = d_sessionCache_sp->store(
+        key,
+        bsl::vector<char>(d_sessionId.begin(), d_sessionId.end()));
+    if (error) {
+        return error;
+    }
+
+    return ntsa::Error();
+}
+
 Encryption::Encryption(
     ntca::EncryptionRole::Value                         role,
     const bsl::shared_ptr<ntcd::EncryptionCertificate>& certificate,
@@ -1413,6 +1632,11 @@ Encryption::Encryption(
 , d_sourceKey_sp(key)
 , d_remoteCertificate_sp()
 , d_remoteKey_sp()
+, d_sessionCache_sp()
+, d_serverName()
+, d_remoteEndpoint()
+, d_sessionId(basicAllocator)
+, d_sessionResumed(false)
 , d_allocator_p(basicAllocator)
 {
 }
@@ -1427,6 +1651,19 @@ void Encryption::authorizePeer(const bsl::string& name)
     d_authorizationSet.insert(name);
 }
 
+void Encryption::setSessionCache(
+    const bsl::shared_ptr<ntci::EncryptionSessionCache>& sessionCache)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    d_sessionCache_sp = sessionCache;
+}
+
+void Encryption::setRemoteEndpoint(const ntsa::Endpoint& endpoint)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    d_remoteEndpoint = endpoint;
+}
+
 ntsa::Error Encryption::initiateHandshake(const HandshakeCallback& callback)
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
@@ -1440,6 +1677,23 @@ ntsa::Error Encryption::initiateHandshake(const HandshakeCallback& callback)
     d_handshakeCallback = callback;
 
     if (d_role == ntca::EncryptionRole::e_CLIENT) {
+        // Offer the session previously established with the same server, if
+        // any, for resumption.
+
+        d_sessionId.clear();
+        d_sessionResumed = false;
+
+        if (d_sessionCache_sp) {
+            const bsl::string key = this->clientSessionKey();
+            if (!key.empty()) {
+                bsl::vector<char> session;
+                error = d_sessionCache_sp->load(&session, key);
+                if (!error) {
+                    d_sessionId.assign(session.begin(), session.end());
+                }
+            }
+        }
+
         error = this->enqueueOutgoingHello();
         if (error) {
             return error;
@@ -1451,6 +1705,18 @@ ntsa::Error Encryption::initiateHandshake(const HandshakeCallback& callback)
     return this->process();
 }
 
+ntsa::Error Encryption::initiateHandshake(
+    const ntca::UpgradeOptions& upgradeOptions,
+    const HandshakeCallback&    callback)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_serverName = upgradeOptions.serverName();
+    }
+
+    return this->initiateHandshake(callback);
+}
+
 ntsa::Error Encryption::pushIncomingCipherText(const bdlbb::Blob& input)
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
@@ -1611,6 +1877,71 @@ bsl::shared_ptr<ntci::EncryptionKey> Encryption::privateKey() const
     return d_sourceKey_sp;
 }
 
+bool Encryption::isSessionResumed() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    return d_sessionResumed;
+}
+
+ntsa::Error Encryption::exportTrafficKeys(ntsa::TrafficKeys* result)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    result->reset();
+
+    if (d_handshakeState != e_ESTABLISHED || !d_shutdownState.canSend() ||
+        !d_shutdownState.canReceive())
+    {
+        return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+    }
+
+    if (!d_incomingHeader.isNull() || d_incomingCipherText_sp->length() > 0 ||
+        d_outgoingCipherText_sp->length() > 0)
+    {
+        return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+    }
+
+    // Derive the keys and IVs from a different seed for each direction, so
+    // that the keys this session sends with are the keys the peer receives
+    // with.
+
+    const bsl::uint8_t k_CLIENT_SEED = 0x43;
+    const bsl::uint8_t k_SERVER_SEED = 0x53;
+
+    bsl::uint8_t clientKey[16];
+    bsl::uint8_t clientIv[12];
+    bsl::uint8_t serverKey[16];
+    bsl::uint8_t serverIv[12];
+
+    for (bsl::size_t i = 0; i < sizeof clientKey; ++i) {
+        clientKey[i] = static_cast<bsl::uint8_t>(k_CLIENT_SEED + i);
+        serverKey[i] = static_cast<bsl::uint8_t>(k_SERVER_SEED + i);
+    }
+
+    for (bsl::size_t i = 0; i < sizeof clientIv; ++i) {
+        clientIv[i] = static_cast<bsl::uint8_t>(k_CLIENT_SEED ^ i);
+        serverIv[i] = static_cast<bsl::uint8_t>(k_SERVER_SEED ^ i);
+    }
+
+    result->setVersion(ntsa::TrafficKeys::k_TLS_V1_3);
+    result->setCipher(ntsa::TrafficCipher::e_AES_128_GCM);
+
+    if (d_role == ntca::EncryptionRole::e_CLIENT) {
+        result->setSendKey(clientKey, sizeof clientKey);
+        result->setSendIv(clientIv, sizeof clientIv);
+        result->setReceiveKey(serverKey, sizeof serverKey);
+        result->setReceiveIv(serverIv, sizeof serverIv);
+    }
+    else {
+        result->setSendKey(serverKey, sizeof serverKey);
+        result->setSendIv(serverIv, sizeof serverIv);
+        result->setReceiveKey(clientKey, sizeof clientKey);
+        result->setReceiveIv(clientIv, sizeof clientIv);
+    }
+
+    return ntsa::Error();
+}
+
 /// Return the allocator.
 bslma::Allocator* Encryption::allocator() const
 {
@@ -1622,8 +1953,13 @@ EncryptionClient::EncryptionClient(
     bslma::Allocator*                    basicAllocator)
 : d_options(options, basicAllocator)
 , d_dataPool_sp()
+, d_sessionCache_sp()
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
+    createSessionCache(&d_sessionCache_sp,
+                       d_options.sessionCacheSize(),
+                       d_allocator_p);
+
     bsl::shared_ptr<ntcs::DataPool> dataPool;
     dataPool.createInplace(d_allocator_p, d_allocator_p);
 
@@ -1636,8 +1972,13 @@ EncryptionClient::EncryptionClient(
     bslma::Allocator*                                basicAllocator)
 : d_options(options, basicAllocator)
 , d_dataPool_sp()
+, d_sessionCache_sp()
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
+    createSessionCache(&d_sessionCache_sp,
+                       d_options.sessionCacheSize(),
+                       d_allocator_p);
+
     bsl::shared_ptr<ntcs::DataPool> dataPool;
     dataPool.createInplace(d_allocator_p,
                            blobBufferFactory,
@@ -1653,8 +1994,12 @@ EncryptionClient::EncryptionClient(
     bslma::Allocator*                      basicAllocator)
 : d_options(options, basicAllocator)
 , d_dataPool_sp(dataPool)
+, d_sessionCache_sp()
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
+    createSessionCache(&d_sessionCache_sp,
+                       d_options.sessionCacheSize(),
+                       d_allocator_p);
 }
 
 EncryptionClient::~EncryptionClient()
@@ -1705,18 +2050,38 @@ ntsa::Error EncryptionClient::createEncryption(
                              d_dataPool_sp,
                              allocator);
 
+    encryption->setSessionCache(d_sessionCache_sp);
+
     *result = encryption;
 #endif
     return ntsa::Error();
 }
 
+ntsa::Error EncryptionClient::setSessionCache(
+    const bsl::shared_ptr<ntci::EncryptionSessionCache>& sessionCache)
+{
+    d_sessionCache_sp = sessionCache;
+    return ntsa::Error();
+}
+
+bsl::shared_ptr<ntci::EncryptionSessionCache> EncryptionClient::sessionCache()
+    const
+{
+    return d_sessionCache_sp;
+}
+
 EncryptionServer::EncryptionServer(
     const ntca::EncryptionServerOptions& options,
     bslma::Allocator*                    basicAllocator)
 : d_options(options, basicAllocator)
 , d_dataPool_sp()
+, d_sessionCache_sp()
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
+    createSessionCache(&d_sessionCache_sp,
+                       d_options.sessionCacheSize(),
+                       d_allocator_p);
+
     bsl::shared_ptr<ntcs::DataPool> dataPool;
     dataPool.createInplace(d_allocator_p, d_allocator_p);
 
@@ -1729,8 +2094,13 @@ EncryptionServer::EncryptionServer(
     bslma::Allocator*                                basicAllocator)
 : d_options(options, basicAllocator)
 , d_dataPool_sp()
+, d_sessionCache_sp()
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
+    createSessionCache(&d_sessionCache_sp,
+                       d_options.sessionCacheSize(),
+                       d_allocator_p);
+
     bsl::shared_ptr<ntcs::DataPool> dataPool;
     dataPool.createInplace(d_allocator_p,
                            blobBufferFactory,
@@ -1746,8 +2116,12 @@ EncryptionServer::EncryptionServer(
     bslma::Allocator*                      basicAllocator)
 : d_options(options, basicAllocator)
 , d_dataPool_sp(dataPool)
+, d_sessionCache_sp()
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
+    createSessionCache(&d_sessionCache_sp,
+                       d_options.sessionCacheSize(),
+                       d_allocator_p);
 }
 
 EncryptionServer::~EncryptionServer()
@@ -1798,12 +2172,27 @@ ntsa::Error EncryptionServer::createEncryption(
                              d_dataPool_sp,
                              allocator);
 
+    encryption->setSessionCache(d_sessionCache_sp);
+
     *result = encryption;
 #endif
 
     return ntsa::Error();
 }
 
+ntsa::Error EncryptionServer::setSessionCache(
+    const bsl::shared_ptr<ntci::EncryptionSessionCache>& sessionCache)
+{
+    d_sessionCache_sp = sessionCache;
+    return ntsa::Error();
+}
+
+bsl::shared_ptr<ntci::EncryptionSessionCache> EncryptionServer::sessionCache()
+    const
+{
+    return d_sessionCache_sp;
+}
+
 EncryptionDriver::EncryptionDriver(bslma::Allocator* basicAllocator)
 : d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
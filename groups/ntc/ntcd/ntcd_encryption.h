@@ -25,9 +25,11 @@ BSLS_IDENT("$Id: $")
 #include <ntci_encryptioncertificate.h>
 #include <ntci_encryptiondriver.h>
 #include <ntci_encryptionkey.h>
+#include <ntci_encryptionsessioncache.h>
 #include <ntcs_shutdownstate.h>
 #include <ntcscm_version.h>
 #include <ntsa_data.h>
+#include <ntsa_endpoint.h>
 #include <bdlb_bigendian.h>
 #include <bdlb_nullablevalue.h>
 #include <bdlbb_blob.h>
@@ -347,6 +349,7 @@ class EncryptionHandshake
 {
     ntca::EncryptionRole::Value                  d_role;
     bsl::shared_ptr<ntcd::EncryptionCertificate> d_certificate_sp;
+    bsl::string                                  d_sessionId;
     bslma::Allocator*                            d_allocator_p;
 
   public:
@@ -378,6 +381,12 @@ class EncryptionHandshake
     void setCertificate(
         const bsl::shared_ptr<ntcd::EncryptionCertificate>& certificate);
 
+    /// Set the identifier of the session offered for resumption, in the
+    /// client role, or the identifier of the session established, in the
+    /// server role, to the specified 'sessionId'. Note that an empty
+    /// 'sessionId' indicates no session is offered or cached.
+    void setSessionId(const bsl::string& sessionId);
+
     /// Decode this object from the specified 'source'. Return the error.
     ntsa::Error decode(bsl::streambuf* source);
 
@@ -389,6 +398,11 @@ class EncryptionHandshake
 
     /// Return the name of the encryption endpoint.
     const bsl::shared_ptr<ntcd::EncryptionCertificate>& certificate() const;
+
+    /// Return the identifier of the session offered for resumption, in the
+    /// client role, or the identifier of the session established, in the
+    /// server role.
+    const bsl::string& sessionId() const;
 };
 
 // FREE OPERATORS
@@ -491,6 +505,11 @@ class Encryption : public ntci::Encryption
     bsl::shared_ptr<ntcd::EncryptionKey>             d_sourceKey_sp;
     bsl::shared_ptr<ntcd::EncryptionCertificate>     d_remoteCertificate_sp;
     bsl::shared_ptr<ntcd::EncryptionKey>             d_remoteKey_sp;
+    bsl::shared_ptr<ntci::EncryptionSessionCache>    d_sessionCache_sp;
+    bdlb::NullableValue<bsl::string>                 d_serverName;
+    bdlb::NullableValue<ntsa::Endpoint>              d_remoteEndpoint;
+    bsl::string                                      d_sessionId;
+    bool                                             d_sessionResumed;
     bslma::Allocator*                                d_allocator_p;
 
   private:
@@ -542,6 +561,21 @@ class Encryption : public ntci::Encryption
     /// Return the error.
     ntsa::Error process();
 
+    /// Return the key identifying the session cached by a client for the
+    /// server name and the remote endpoint, or the empty string if neither
+    /// is defined.
+    bsl::string clientSessionKey() const;
+
+    /// Resume the session having the specified 'sessionId' offered by the
+    /// client having the specified 'name', if cached, otherwise cache a new
+    /// session established with that client. Return the error.
+    ntsa::Error acceptSession(const bsl::string& sessionId,
+                              const bsl::string& name);
+
+    /// Record the specified 'sessionId' of the session established by the
+    /// server, and cache it for resumption. Return the error.
+    ntsa::Error completeSession(const bsl::string& sessionId);
+
   public:
     /// Create a new encryption operating in the specified 'role' from an
     /// encryption endpoint having the specified 'name'. Allocate data using
@@ -560,11 +594,29 @@ class Encryption : public ntci::Encryption
     /// Authorize handshakes with peers having the specified 'name'.
     void authorizePeer(const bsl::string& name);
 
+    /// Cache established sessions in the specified 'sessionCache' and
+    /// attempt to resume the sessions cached therein. If 'sessionCache' is
+    /// null, disable session caching. The behavior is undefined unless this
+    /// function is called before the handshake is initiated.
+    void setSessionCache(
+        const bsl::shared_ptr<ntci::EncryptionSessionCache>& sessionCache);
+
+    /// Set the endpoint of the peer to the specified 'endpoint'.
+    void setRemoteEndpoint(const ntsa::Endpoint& endpoint)
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Initiate the handshake to begin the session. Invoke the specified
     /// 'callback' when the handshake completes. Return the error.
     ntsa::Error initiateHandshake(const HandshakeCallback& callback)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Initiate the handshake to begin the session according to the
+    /// specified 'upgradeOptions'. Invoke the specified 'callback' when the
+    /// handshake completes. Return the error.
+    ntsa::Error initiateHandshake(const ntca::UpgradeOptions& upgradeOptions,
+                                  const HandshakeCallback&    callback)
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Add the specified 'input' containing ciphertext read from the peer.
     /// Return 0 on success and a non-zero value otherwise.
     ntsa::Error pushIncomingCipherText(const bdlbb::Blob& input)
@@ -636,6 +688,20 @@ class Encryption : public ntci::Encryption
     bsl::shared_ptr<ntci::EncryptionKey> privateKey() const
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Return true if the handshake resumed a session previously
+    /// established with the peer, otherwise return false.
+    bool isSessionResumed() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Load into the specified 'result' traffic keys describing a TLS 1.3
+    /// session protected by AES-128-GCM whose keys are derived only from
+    /// the direction of each record, so that two peers exporting their keys
+    /// agree on them. Return the error. Note that the records exchanged by
+    /// this session are not TLS records: the session may only be continued
+    /// by the operating system if the peer also exports its keys to the
+    /// operating system.
+    ntsa::Error exportTrafficKeys(ntsa::TrafficKeys* result)
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Return the allocator.
     bslma::Allocator* allocator() const;
 };
@@ -649,9 +715,10 @@ class Encryption : public ntci::Encryption
 /// @ingroup module_ntcd
 class EncryptionClient : public ntci::EncryptionClient
 {
-    ntca::EncryptionClientOptions   d_options;
-    bsl::shared_ptr<ntci::DataPool> d_dataPool_sp;
-    bslma::Allocator*               d_allocator_p;
+    ntca::EncryptionClientOptions                 d_options;
+    bsl::shared_ptr<ntci::DataPool>               d_dataPool_sp;
+    bsl::shared_ptr<ntci::EncryptionSessionCache> d_sessionCache_sp;
+    bslma::Allocator*                             d_allocator_p;
 
   private:
     EncryptionClient(const EncryptionClient&) BSLS_KEYWORD_DELETED;
@@ -694,6 +761,19 @@ class EncryptionClient : public ntci::EncryptionClient
     ntsa::Error createEncryption(bsl::shared_ptr<ntci::Encryption>* result,
                                  bslma::Allocator* basicAllocator = 0)
         BSLS_KEYWORD_OVERRIDE;
+
+    /// Cache the sessions established by each encryption session
+    /// subsequently created by this object in the specified 'sessionCache'.
+    /// If 'sessionCache' is null, disable session caching. Return the
+    /// error.
+    ntsa::Error setSessionCache(
+        const bsl::shared_ptr<ntci::EncryptionSessionCache>& sessionCache)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the cache of sessions used by each encryption session created
+    /// by this object, if any.
+    bsl::shared_ptr<ntci::EncryptionSessionCache> sessionCache() const
+        BSLS_KEYWORD_OVERRIDE;
 };
 
 /// @internal @brief
@@ -703,9 +783,10 @@ class EncryptionClient : public ntci::EncryptionClient
 /// This class is thread safe.
 class EncryptionServer : public ntci::EncryptionServer
 {
-    ntca::EncryptionServerOptions   d_options;
-    bsl::shared_ptr<ntci::DataPool> d_dataPool_sp;
-    bslma::Allocator*               d_allocator_p;
+    ntca::EncryptionServerOptions                 d_options;
+    bsl::shared_ptr<ntci::DataPool>               d_dataPool_sp;
+    bsl::shared_ptr<ntci::EncryptionSessionCache> d_sessionCache_sp;
+    bslma::Allocator*                             d_allocator_p;
 
   private:
     EncryptionServer(const EncryptionServer&) BSLS_KEYWORD_DELETED;
@@ -748,6 +829,19 @@ class EncryptionServer : public ntci::EncryptionServer
     virtual ntsa::Error createEncryption(
         bsl::shared_ptr<ntci::Encryption>* result,
         bslma::Allocator* basicAllocator = 0) BSLS_KEYWORD_OVERRIDE;
+
+    /// Cache the sessions established by each encryption session
+    /// subsequently created by this object in the specified 'sessionCache'.
+    /// If 'sessionCache' is null, disable session caching. Return the
+    /// error.
+    ntsa::Error setSessionCache(
+        const bsl::shared_ptr<ntci::EncryptionSessionCache>& sessionCache)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the cache of sessions used by each encryption session created
+    /// by this object, if any.
+    bsl::shared_ptr<ntci::EncryptionSessionCache> sessionCache() const
+        BSLS_KEYWORD_OVERRIDE;
 };
 
 /// @internal @brief
@@ -19,6 +19,7 @@
 #include <ntccfg_test.h>
 #include <ntci_log.h>
 #include <ntcs_datapool.h>
+#include <ntcs_encryptionsessioncache.h>
 
 #include <bdlb_print.h>
 #include <bdlbb_blob.h>
@@ -73,6 +74,8 @@ struct Parameters {
     , d_clientRejectsServer(false)
     , d_serverRejectsClient(false)
     , d_success(true)
+    , d_exportTrafficKeys(false)
+    , d_resumeSessions(false)
     {
     }
 
@@ -81,6 +84,8 @@ struct Parameters {
     bool        d_clientRejectsServer;
     bool        d_serverRejectsClient;
     bool        d_success;
+    bool        d_exportTrafficKeys;
+    bool        d_resumeSessions;
 };
 
 void logParameters(const char* label, const test::Parameters& parameters)
@@ -296,6 +301,84 @@ void cycleHandshake(const bsl::shared_ptr<ntcd::Encryption>& clientSession,
     }
 }
 
+void exportTrafficKeys(
+    const bsl::shared_ptr<ntcd::Encryption>& clientSession,
+    const bsl::shared_ptr<ntcd::Encryption>& serverSession,
+    const bsl::shared_ptr<ntci::DataPool>&   dataPool,
+    bdlbb::Blob*                             clientPlaintextRead,
+    bdlbb::Blob*                             serverPlaintextRead)
+{
+    // Export the traffic keys from the specified 'clientSession' and
+    // 'serverSession' after exchanging any outgoing cipher text between
+    // them, and verify the keys each session sends with are the keys its
+    // peer receives with.
+
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    ntsa::TrafficKeys clientKeys;
+    ntsa::TrafficKeys serverKeys;
+
+    if (clientSession->hasOutgoingCipherText()) {
+        error = clientSession->exportTrafficKeys(&clientKeys);
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+    }
+
+    while (clientSession->hasOutgoingCipherText() ||
+           serverSession->hasOutgoingCipherText())
+    {
+        if (clientSession->hasOutgoingCipherText()) {
+            bdlbb::Blob data(dataPool->outgoingBlobBufferFactory().get());
+            error = clientSession->popOutgoingCipherText(&data);
+            NTCCFG_TEST_FALSE(error);
+
+            error = serverSession->pushIncomingCipherText(data);
+            NTCCFG_TEST_FALSE(error);
+        }
+
+        if (serverSession->hasOutgoingCipherText()) {
+            bdlbb::Blob data(dataPool->outgoingBlobBufferFactory().get());
+            error = serverSession->popOutgoingCipherText(&data);
+            NTCCFG_TEST_FALSE(error);
+
+            error = clientSession->pushIncomingCipherText(data);
+            NTCCFG_TEST_FALSE(error);
+        }
+    }
+
+    if (clientSession->hasIncomingPlainText()) {
+        error = clientSession->popIncomingPlainText(clientPlaintextRead);
+        NTCCFG_TEST_FALSE(error);
+    }
+
+    if (serverSession->hasIncomingPlainText()) {
+        error = serverSession->popIncomingPlainText(serverPlaintextRead);
+        NTCCFG_TEST_FALSE(error);
+    }
+
+    error = clientSession->exportTrafficKeys(&clientKeys);
+    NTCCFG_TEST_OK(error);
+
+    error = serverSession->exportTrafficKeys(&serverKeys);
+    NTCCFG_TEST_OK(error);
+
+    NTCI_LOG_STREAM_DEBUG << "Client traffic keys = " << clientKeys
+                          << NTCI_LOG_STREAM_END;
+
+    NTCCFG_TEST_EQ(clientKeys.version(), ntsa::TrafficKeys::k_TLS_V1_3);
+    NTCCFG_TEST_EQ(clientKeys.cipher(), ntsa::TrafficCipher::e_AES_128_GCM);
+
+    NTCCFG_TEST_EQ(clientKeys.sendKey().size(), 16);
+    NTCCFG_TEST_EQ(clientKeys.sendIv().size(), 12);
+
+    NTCCFG_TEST_TRUE(clientKeys.sendKey() == serverKeys.receiveKey());
+    NTCCFG_TEST_TRUE(clientKeys.sendIv() == serverKeys.receiveIv());
+    NTCCFG_TEST_TRUE(clientKeys.receiveKey() == serverKeys.sendKey());
+    NTCCFG_TEST_TRUE(clientKeys.receiveIv() == serverKeys.sendIv());
+    NTCCFG_TEST_TRUE(clientKeys.sendKey() != clientKeys.receiveKey());
+}
+
 void cycleShutdown(const bsl::shared_ptr<ntcd::Encryption>& clientSession,
                    const bsl::shared_ptr<ntcd::Encryption>& serverSession,
                    const bsl::shared_ptr<ntci::DataPool>&   dataPool,
@@ -500,33 +583,18 @@ void execute(const test::Parameters&                        parameters,
                                         serverCertificateOptions);
     NTCCFG_TEST_OK(error);
 
-    // Create the client session.
+    // Create the session caches, if any.
 
-    bsl::shared_ptr<ntcd::Encryption> clientSession;
-    clientSession.createInplace(allocator,
-                                ntca::EncryptionRole::e_CLIENT,
-                                clientCertificate,
-                                clientKey,
-                                dataPool,
-                                allocator);
-
-    if (!parameters.d_clientRejectsServer) {
-        clientSession->authorizePeer("server");
-    }
+    bsl::shared_ptr<ntcs::EncryptionSessionCache> clientSessionCache;
+    bsl::shared_ptr<ntcs::EncryptionSessionCache> serverSessionCache;
 
-    // Create the server session.
+    if (parameters.d_resumeSessions) {
+        clientSessionCache.createInplace(allocator, 16, allocator);
+        serverSessionCache.createInplace(allocator, 16, allocator);
+    }
 
+    bsl::shared_ptr<ntcd::Encryption> clientSession;
     bsl::shared_ptr<ntcd::Encryption> serverSession;
-    serverSession.createInplace(allocator,
-                                ntca::EncryptionRole::e_SERVER,
-                                serverCertificate,
-                                serverKey,
-                                dataPool,
-                                allocator);
-
-    if (!parameters.d_serverRejectsClient) {
-        serverSession->authorizePeer("client");
-    }
 
     // Create the test state variables.
 
@@ -562,9 +630,51 @@ void execute(const test::Parameters&                        parameters,
                       usageIteration + 1,
                       parameters.d_numReuses + 1);
 
+        // Create the sessions, or reuse the sessions created for the first
+        // iteration unless testing sessions are resumed by new sessions.
+
+        if (usageIteration == 0 || parameters.d_resumeSessions) {
+            // Create the client session.
+
+            clientSession.createInplace(allocator,
+                                        ntca::EncryptionRole::e_CLIENT,
+                                        clientCertificate,
+                                        clientKey,
+                                        dataPool,
+                                        allocator);
+
+            if (!parameters.d_clientRejectsServer) {
+                clientSession->authorizePeer("server");
+            }
+
+            clientSession->setSessionCache(clientSessionCache);
+
+            // Create the server session.
+
+            serverSession.createInplace(allocator,
+                                        ntca::EncryptionRole::e_SERVER,
+                                        serverCertificate,
+                                        serverKey,
+                                        dataPool,
+                                        allocator);
+
+            if (!parameters.d_serverRejectsClient) {
+                serverSession->authorizePeer("client");
+            }
+
+            serverSession->setSessionCache(serverSessionCache);
+        }
+
         bool clientHandshakeComplete = false;
         bool serverHandshakeComplete = false;
 
+        if (parameters.d_exportTrafficKeys) {
+            ntsa::TrafficKeys keys;
+            error = clientSession->exportTrafficKeys(&keys);
+            NTCCFG_TEST_EQ(error,
+                           ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED));
+        }
+
         bdlbb::Blob clientPlaintextRead(
             dataPool->incomingBlobBufferFactory().get(),
             allocator);
@@ -579,7 +689,14 @@ void execute(const test::Parameters&                        parameters,
 
             NTCI_LOG_INFO("Client handshake initiating");
 
+            ntca::UpgradeOptions upgradeOptions;
+            upgradeOptions.setServerName("server");
+
+            clientSession->setRemoteEndpoint(
+                ntsa::Endpoint("10.0.0.1:12345"));
+
             error = clientSession->initiateHandshake(
+                upgradeOptions,
                 NTCCFG_BIND(&test::processClientHandshakeComplete,
                             NTCCFG_BIND_PLACEHOLDER_1,
                             clientSession,
@@ -640,6 +757,25 @@ void execute(const test::Parameters&                        parameters,
         NTCCFG_TEST_TRUE(clientHandshakeComplete);
         NTCCFG_TEST_TRUE(serverHandshakeComplete);
 
+        // Ensure each handshake after the first resumes the session
+        // established by the first handshake, if sessions are cached.
+
+        {
+            const bool resumed =
+                parameters.d_resumeSessions && usageIteration > 0;
+
+            NTCCFG_TEST_EQ(clientSession->isSessionResumed(), resumed);
+            NTCCFG_TEST_EQ(serverSession->isSessionResumed(), resumed);
+        }
+
+        if (parameters.d_exportTrafficKeys) {
+            test::exportTrafficKeys(clientSession,
+                                    serverSession,
+                                    dataPool,
+                                    &clientPlaintextRead,
+                                    &serverPlaintextRead);
+        }
+
         // Send data immediately before the shutdown is initiated.
 
         {
@@ -706,6 +842,16 @@ void execute(const test::Parameters&                        parameters,
                       parameters.d_numReuses + 1);
     }
 
+    if (parameters.d_resumeSessions) {
+        NTCCFG_TEST_EQ(clientSessionCache->size(), 1);
+        NTCCFG_TEST_EQ(clientSessionCache->numHits(), parameters.d_numReuses);
+        NTCCFG_TEST_EQ(clientSessionCache->numMisses(), 1);
+
+        NTCCFG_TEST_EQ(serverSessionCache->size(), 1);
+        NTCCFG_TEST_EQ(serverSessionCache->numHits(), parameters.d_numReuses);
+        NTCCFG_TEST_EQ(serverSessionCache->numMisses(), 0);
+    }
+
     NTCI_LOG_INFO("Test complete");
 }
 
@@ -881,6 +1027,52 @@ NTCCFG_TEST_CASE(5)
     NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+NTCCFG_TEST_CASE(6)
+{
+    // Concern: Traffic keys are exported after the handshake.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        bsl::shared_ptr<ntcd::EncryptionDriver> driver;
+        driver.createInplace(&ta, &ta);
+
+        test::Parameters parameters;
+        parameters.d_bufferSize          = 32;
+        parameters.d_clientRejectsServer = false;
+        parameters.d_serverRejectsClient = false;
+        parameters.d_success             = true;
+        parameters.d_exportTrafficKeys   = true;
+
+        test::execute(parameters, driver, &ta);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(7)
+{
+    // Concern: Sessions established by a previous handshake are resumed by
+    // subsequent handshakes.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        bsl::shared_ptr<ntcd::EncryptionDriver> driver;
+        driver.createInplace(&ta, &ta);
+
+        test::Parameters parameters;
+        parameters.d_bufferSize          = 32;
+        parameters.d_numReuses           = 3;
+        parameters.d_clientRejectsServer = false;
+        parameters.d_serverRejectsClient = false;
+        parameters.d_success             = true;
+        parameters.d_resumeSessions      = true;
+
+        test::execute(parameters, driver, &ta);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
@@ -888,5 +1080,7 @@ NTCCFG_TEST_DRIVER
     NTCCFG_TEST_REGISTER(3);
     NTCCFG_TEST_REGISTER(4);
     NTCCFG_TEST_REGISTER(5);
+    NTCCFG_TEST_REGISTER(6);
+    NTCCFG_TEST_REGISTER(7);
 }
 NTCCFG_TEST_DRIVER_END;
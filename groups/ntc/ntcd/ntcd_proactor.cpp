@@ -1793,6 +1793,12 @@ void Proactor::moveAndExecute(FunctorSequence* functorSequence,
     this->interruptAll();
 }
 
+void Proactor::executeInplace(InplaceFunctor* functor)
+{
+    d_chronology_sp->defer(functor);
+    this->interruptAll();
+}
+
 bsl::shared_ptr<ntci::Timer> Proactor::createTimer(
     const ntca::TimerOptions&                  options,
     const bsl::shared_ptr<ntci::TimerSession>& session,
@@ -370,6 +370,10 @@ class Proactor : public ntci::Proactor,
     void moveAndExecute(FunctorSequence* functorSequence,
                         const Functor&   functor) BSLS_KEYWORD_OVERRIDE;
 
+    /// Defer the execution of the callable object stored by the specified
+    /// 'functor', leaving the 'functor' empty.
+    void executeInplace(InplaceFunctor* functor) BSLS_KEYWORD_OVERRIDE;
+
     /// Create a new timer according to the specified 'options' that invokes
     /// the specified 'session' for each timer event on this object's
     /// 'strand()', if defined, or on an unspecified thread otherwise.
@@ -1485,6 +1485,12 @@ void Reactor::moveAndExecute(FunctorSequence* functorSequence,
     this->interruptAll();
 }
 
+void Reactor::executeInplace(InplaceFunctor* functor)
+{
+    d_chronology_sp->defer(functor);
+    this->interruptAll();
+}
+
 bsl::shared_ptr<ntci::Timer> Reactor::createTimer(
     const ntca::TimerOptions&                  options,
     const bsl::shared_ptr<ntci::TimerSession>& session,
@@ -183,6 +183,7 @@ BSLS_IDENT("$Id: $")
 #include <ntci_encryptionkeystorage.h>
 #include <ntci_encryptionserver.h>
 #include <ntci_encryptionserverfactory.h>
+#include <ntci_encryptionsessioncache.h>
 #include <ntci_executor.h>
 #include <ntci_getdomainnamecallback.h>
 #include <ntci_getdomainnamecallbackfactory.h>
@@ -26,6 +26,7 @@ BSLS_IDENT_RCSID(ntcf_system_cpp, "$Id$ $CSID$")
 #include <ntcs_authorization.h>
 #include <ntcs_compat.h>
 #include <ntcs_datapool.h>
+#include <ntcs_encryptionsessioncache.h>
 #include <ntcs_global.h>
 #include <ntcs_metrics.h>
 #include <ntcs_plugin.h>
@@ -1392,6 +1393,139 @@ ntsa::Error System::createEncryptionServer(
                                                     basicAllocator);
 }
 
+ntsa::Error System::createEncryptionClient(
+    bsl::shared_ptr<ntci::EncryptionClient>*             result,
+    const ntca::EncryptionClientOptions&                 options,
+    const bsl::shared_ptr<ntci::EncryptionSessionCache>& sessionCache,
+    bslma::Allocator*                                    basicAllocator)
+{
+    ntsa::Error error;
+
+    error = ntcf::System::createEncryptionClient(result,
+                                                  options,
+                                                  basicAllocator);
+    if (error) {
+        return error;
+    }
+
+    return (*result)->setSessionCache(sessionCache);
+}
+
+ntsa::Error System::createEncryptionClient(
+    bsl::shared_ptr<ntci::EncryptionClient>*             result,
+    const ntca::EncryptionClientOptions&                 options,
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&     blobBufferFactory,
+    const bsl::shared_ptr<ntci::EncryptionSessionCache>& sessionCache,
+    bslma::Allocator*                                    basicAllocator)
+{
+    ntsa::Error error;
+
+    error = ntcf::System::createEncryptionClient(result,
+                                                  options,
+                                                  blobBufferFactory,
+                                                  basicAllocator);
+    if (error) {
+        return error;
+    }
+
+    return (*result)->setSessionCache(sessionCache);
+}
+
+ntsa::Error System::createEncryptionClient(
+    bsl::shared_ptr<ntci::EncryptionClient>*             result,
+    const ntca::EncryptionClientOptions&                 options,
+    const bsl::shared_ptr<ntci::DataPool>&               dataPool,
+    const bsl::shared_ptr<ntci::EncryptionSessionCache>& sessionCache,
+    bslma::Allocator*                                    basicAllocator)
+{
+    ntsa::Error error;
+
+    error = ntcf::System::createEncryptionClient(result,
+                                                  options,
+                                                  dataPool,
+                                                  basicAllocator);
+    if (error) {
+        return error;
+    }
+
+    return (*result)->setSessionCache(sessionCache);
+}
+
+ntsa::Error System::createEncryptionServer(
+    bsl::shared_ptr<ntci::EncryptionServer>*             result,
+    const ntca::EncryptionServerOptions&                 options,
+    const bsl::shared_ptr<ntci::EncryptionSessionCache>& sessionCache,
+    bslma::Allocator*                                    basicAllocator)
+{
+    ntsa::Error error;
+
+    error = ntcf::System::createEncryptionServer(result,
+                                                  options,
+                                                  basicAllocator);
+    if (error) {
+        return error;
+    }
+
+    return (*result)->setSessionCache(sessionCache);
+}
+
+ntsa::Error System::createEncryptionServer(
+    bsl::shared_ptr<ntci::EncryptionServer>*             result,
+    const ntca::EncryptionServerOptions&                 options,
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&     blobBufferFactory,
+    const bsl::shared_ptr<ntci::EncryptionSessionCache>& sessionCache,
+    bslma::Allocator*                                    basicAllocator)
+{
+    ntsa::Error error;
+
+    error = ntcf::System::createEncryptionServer(result,
+                                                  options,
+                                                  blobBufferFactory,
+                                                  basicAllocator);
+    if (error) {
+        return error;
+    }
+
+    return (*result)->setSessionCache(sessionCache);
+}
+
+ntsa::Error System::createEncryptionServer(
+    bsl::shared_ptr<ntci::EncryptionServer>*             result,
+    const ntca::EncryptionServerOptions&                 options,
+    const bsl::shared_ptr<ntci::DataPool>&               dataPool,
+    const bsl::shared_ptr<ntci::EncryptionSessionCache>& sessionCache,
+    bslma::Allocator*                                    basicAllocator)
+{
+    ntsa::Error error;
+
+    error = ntcf::System::createEncryptionServer(result,
+                                                  options,
+                                                  dataPool,
+                                                  basicAllocator);
+    if (error) {
+        return error;
+    }
+
+    return (*result)->setSessionCache(sessionCache);
+}
+
+bsl::shared_ptr<ntci::EncryptionSessionCache> System::
+    createEncryptionSessionCache(bsl::size_t       capacity,
+                                 bslma::Allocator* basicAllocator)
+{
+    ntsa::Error error;
+
+    error = ntcf::System::initialize();
+    BSLS_ASSERT_OPT(!error);
+
+    bslma::Allocator* allocator = bslma::Default::allocator(basicAllocator);
+
+    bsl::shared_ptr<ntcs::EncryptionSessionCache> sessionCache;
+    sessionCache.createInplace(allocator, capacity, allocator);
+
+    return sessionCache;
+}
+
 ntsa::Error System::createEncryptionResource(
     bsl::shared_ptr<ntci::EncryptionResource>* result,
     bslma::Allocator*                          basicAllocator)
@@ -574,6 +574,43 @@ struct System {
         const bsl::shared_ptr<ntci::DataPool>&   dataPool,
         bslma::Allocator*                        basicAllocator = 0);
 
+    /// Load into the specified 'result' a new encryption client with the
+    /// specified 'options' that caches the sessions it establishes in the
+    /// specified 'sessionCache'. Optionally specify a 'basicAllocator' used
+    /// to supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used. Return the error.
+    static ntsa::Error createEncryptionClient(
+        bsl::shared_ptr<ntci::EncryptionClient>*             result,
+        const ntca::EncryptionClientOptions&                 options,
+        const bsl::shared_ptr<ntci::EncryptionSessionCache>& sessionCache,
+        bslma::Allocator* basicAllocator = 0);
+
+    /// Load into the specified 'result' a new encryption client with the
+    /// specified 'options' that caches the sessions it establishes in the
+    /// specified 'sessionCache'. Allocate blob buffers using the specified
+    /// 'blobBufferFactory'. Optionally specify a 'basicAllocator' used to
+    /// supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used. Return the error.
+    static ntsa::Error createEncryptionClient(
+        bsl::shared_ptr<ntci::EncryptionClient>*             result,
+        const ntca::EncryptionClientOptions&                 options,
+        const bsl::shared_ptr<bdlbb::BlobBufferFactory>&     blobBufferFactory,
+        const bsl::shared_ptr<ntci::EncryptionSessionCache>& sessionCache,
+        bslma::Allocator* basicAllocator = 0);
+
+    /// Load into the specified 'result' a new encryption client with the
+    /// specified 'options' that caches the sessions it establishes in the
+    /// specified 'sessionCache'. Allocate data containers using the
+    /// specified 'dataPool'. Optionally specify a 'basicAllocator' used to
+    /// supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used. Return the error.
+    static ntsa::Error createEncryptionClient(
+        bsl::shared_ptr<ntci::EncryptionClient>*             result,
+        const ntca::EncryptionClientOptions&                 options,
+        const bsl::shared_ptr<ntci::DataPool>&               dataPool,
+        const bsl::shared_ptr<ntci::EncryptionSessionCache>& sessionCache,
+        bslma::Allocator* basicAllocator = 0);
+
     /// Load into the specified 'result' a new encryption client with the
     /// specified 'options'. Optionally specify a 'basicAllocator' used to
     /// supply memory. If 'basicAllocator' is 0, the currently installed
@@ -605,6 +642,54 @@ struct System {
         const bsl::shared_ptr<ntci::DataPool>&   dataPool,
         bslma::Allocator*                        basicAllocator = 0);
 
+    /// Load into the specified 'result' a new encryption server with the
+    /// specified 'options' that caches the sessions it establishes in the
+    /// specified 'sessionCache'. Optionally specify a 'basicAllocator' used
+    /// to supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used. Return the error.
+    static ntsa::Error createEncryptionServer(
+        bsl::shared_ptr<ntci::EncryptionServer>*             result,
+        const ntca::EncryptionServerOptions&                 options,
+        const bsl::shared_ptr<ntci::EncryptionSessionCache>& sessionCache,
+        bslma::Allocator* basicAllocator = 0);
+
+    /// Load into the specified 'result' a new encryption server with the
+    /// specified 'options' that caches the sessions it establishes in the
+    /// specified 'sessionCache'. Allocate blob buffers using the specified
+    /// 'blobBufferFactory'. Optionally specify a 'basicAllocator' used to
+    /// supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used. Return the error.
+    static ntsa::Error createEncryptionServer(
+        bsl::shared_ptr<ntci::EncryptionServer>*             result,
+        const ntca::EncryptionServerOptions&                 options,
+        const bsl::shared_ptr<bdlbb::BlobBufferFactory>&     blobBufferFactory,
+        const bsl::shared_ptr<ntci::EncryptionSessionCache>& sessionCache,
+        bslma::Allocator* basicAllocator = 0);
+
+    /// Load into the specified 'result' a new encryption server with the
+    /// specified 'options' that caches the sessions it establishes in the
+    /// specified 'sessionCache'. Allocate data containers using the
+    /// specified 'dataPool'. Optionally specify a 'basicAllocator' used to
+    /// supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used. Return the error.
+    static ntsa::Error createEncryptionServer(
+        bsl::shared_ptr<ntci::EncryptionServer>*             result,
+        const ntca::EncryptionServerOptions&                 options,
+        const bsl::shared_ptr<ntci::DataPool>&               dataPool,
+        const bsl::shared_ptr<ntci::EncryptionSessionCache>& sessionCache,
+        bslma::Allocator* basicAllocator = 0);
+
+    /// Return a new cache of encryption sessions that stores at most the
+    /// specified 'capacity' number of sessions, suitable for installing into
+    /// encryption clients or servers so that subsequent handshakes may
+    /// resume a previous session. Optionally specify a 'basicAllocator' used
+    /// to supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used. The behavior is undefined unless
+    /// '0 < capacity'.
+    static bsl::shared_ptr<ntci::EncryptionSessionCache>
+    createEncryptionSessionCache(bsl::size_t       capacity,
+                                 bslma::Allocator* basicAllocator = 0);
+
     /// Load into the specified 'result' a new encryption resource. Optionally
     /// specify a 'basicAllocator' used to supply memory. If 'basicAllocator'
     /// is 0, the currently installed default allocator is used. Return the
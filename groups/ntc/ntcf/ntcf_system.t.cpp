@@ -18,6 +18,7 @@
 #include <ntccfg_bind.h>
 #include <ntccfg_test.h>
 #include <ntcd_datautil.h>
+#include <ntci_coroutine.h>
 #include <ntci_log.h>
 #include <ntcs_blobutil.h>
 #include <ntcs_datapool.h>
@@ -14267,6 +14268,228 @@ NTCCFG_TEST_CASE(81)
     NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+#if NTCI_COROUTINE_ENABLED
+
+namespace case82 {
+
+// Provide a coroutine that starts eagerly and destroys itself once it
+// returns.
+struct Task {
+    struct promise_type {
+        Task get_return_object()
+        {
+            return Task();
+        }
+
+        std::suspend_never initial_suspend() noexcept
+        {
+            return std::suspend_never();
+        }
+
+        std::suspend_never final_suspend() noexcept
+        {
+            return std::suspend_never();
+        }
+
+        void return_void()
+        {
+        }
+
+        void unhandled_exception()
+        {
+            bsl::abort();
+        }
+    };
+};
+
+// Accept a connection from the specified 'listener' and load the accepted
+// socket into the specified 'result', then post to the specified
+// 'semaphore'.
+Task accept(ntci::CoroutineListenerSocket*       listener,
+            bsl::shared_ptr<ntci::StreamSocket>* result,
+            bslmt::Semaphore*                    semaphore)
+{
+    ntci::AcceptResult acceptResult;
+    ntsa::Error        error =
+        co_await listener->accept(&acceptResult, ntca::AcceptOptions());
+    NTCCFG_TEST_OK(error);
+
+    *result = acceptResult.streamSocket();
+
+    semaphore->post();
+}
+
+// Receive the specified 'numMessages' each of the specified 'messageSize'
+// from the specified 'socket' and send each back to its peer, then post to
+// the specified 'semaphore'.
+Task serve(ntci::CoroutineStreamSocket* socket,
+           bsl::size_t                  numMessages,
+           bsl::size_t                  messageSize,
+           bslmt::Semaphore*            semaphore)
+{
+    ntca::ReceiveOptions receiveOptions;
+    receiveOptions.setMinSize(messageSize);
+    receiveOptions.setMaxSize(messageSize);
+
+    for (bsl::size_t i = 0; i < numMessages; ++i) {
+        ntci::ReceiveResult receiveResult;
+        ntsa::Error         error =
+            co_await socket->receive(&receiveResult, receiveOptions);
+        NTCCFG_TEST_OK(error);
+        NTCCFG_TEST_EQ(receiveResult.data()->length(), messageSize);
+
+        ntci::SendResult sendResult;
+        error = co_await socket->send(&sendResult,
+                                      *receiveResult.data(),
+                                      ntca::SendOptions());
+        NTCCFG_TEST_OK(error);
+    }
+
+    semaphore->post();
+}
+
+// Connect the specified 'socket' to the specified 'endpoint', then send the
+// specified 'numMessages' each of the specified 'messageSize' and receive
+// each echoed back, sleeping between each message, then post to the
+// specified 'semaphore'.
+Task request(ntci::CoroutineStreamSocket* socket,
+             ntsa::Endpoint               endpoint,
+             bsl::size_t                  numMessages,
+             bsl::size_t                  messageSize,
+             bslmt::Semaphore*            semaphore)
+{
+    ntci::ConnectResult connectResult;
+    ntsa::Error         error = co_await socket->connect(&connectResult,
+                                                 endpoint,
+                                                 ntca::ConnectOptions());
+    NTCCFG_TEST_OK(error);
+
+    ntca::ReceiveOptions receiveOptions;
+    receiveOptions.setMinSize(messageSize);
+    receiveOptions.setMaxSize(messageSize);
+
+    for (bsl::size_t i = 0; i < numMessages; ++i) {
+        bsl::shared_ptr<bdlbb::Blob> data =
+            socket->streamSocket()->createOutgoingBlob();
+        ntcd::DataUtil::generateData(data.get(), messageSize, i);
+
+        ntci::SendResult sendResult;
+        error = co_await socket->send(&sendResult, *data, ntca::SendOptions());
+        NTCCFG_TEST_OK(error);
+
+        ntci::ReceiveResult receiveResult;
+        error = co_await socket->receive(&receiveResult, receiveOptions);
+        NTCCFG_TEST_OK(error);
+
+        NTCCFG_TEST_EQ(bdlbb::BlobUtil::compare(*receiveResult.data(), *data),
+                       0);
+
+        error = co_await socket->sleep(bsls::TimeInterval(0, 1000000));
+        NTCCFG_TEST_OK(error);
+    }
+
+    semaphore->post();
+}
+
+}  // close namespace case82
+
+#endif
+
+NTCCFG_TEST_CASE(82)
+{
+    // Concern: Coroutines may await connect, accept, send, receive, and
+    // sleep operations on sockets, and are resumed once each operation
+    // completes.
+
+#if NTCI_COROUTINE_ENABLED
+
+    ntccfg::TestAllocator ta;
+    {
+        const bsl::size_t k_NUM_MESSAGES = 10;
+        const bsl::size_t k_MESSAGE_SIZE = 1024;
+
+        ntsa::Error error;
+
+        ntca::InterfaceConfig interfaceConfig;
+        interfaceConfig.setThreadName("test");
+        interfaceConfig.setMinThreads(1);
+        interfaceConfig.setMaxThreads(1);
+
+        bsl::shared_ptr<ntci::Interface> interface =
+            ntcf::System::createInterface(interfaceConfig, &ta);
+
+        ntci::InterfaceStopGuard interfaceGuard(interface);
+
+        error = interface->start();
+        NTCCFG_TEST_OK(error);
+
+        ntca::ListenerSocketOptions listenerSocketOptions;
+        listenerSocketOptions.setTransport(ntsa::Transport::e_TCP_IPV4_STREAM);
+        listenerSocketOptions.setSourceEndpoint(ntsa::Endpoint(
+            ntsa::IpEndpoint(ntsa::Ipv4Address::loopback(), 0)));
+
+        bsl::shared_ptr<ntci::ListenerSocket> listenerSocket =
+            interface->createListenerSocket(listenerSocketOptions, &ta);
+
+        ntci::ListenerSocketCloseGuard listenerGuard(listenerSocket);
+
+        error = listenerSocket->open();
+        NTCCFG_TEST_OK(error);
+
+        error = listenerSocket->listen();
+        NTCCFG_TEST_OK(error);
+
+        ntca::StreamSocketOptions streamSocketOptions;
+        streamSocketOptions.setTransport(ntsa::Transport::e_TCP_IPV4_STREAM);
+
+        bsl::shared_ptr<ntci::StreamSocket> clientSocket =
+            interface->createStreamSocket(streamSocketOptions, &ta);
+
+        ntci::StreamSocketCloseGuard clientGuard(clientSocket);
+
+        error = clientSocket->open();
+        NTCCFG_TEST_OK(error);
+
+        bsl::shared_ptr<ntci::StreamSocket> serverSocket;
+
+        bslmt::Semaphore acceptSemaphore;
+        bslmt::Semaphore clientSemaphore;
+        bslmt::Semaphore serverSemaphore;
+
+        {
+            ntci::CoroutineListenerSocket listener(listenerSocket, &ta);
+            ntci::CoroutineStreamSocket   client(clientSocket, &ta);
+
+            case82::accept(&listener, &serverSocket, &acceptSemaphore);
+
+            case82::request(&client,
+                            listenerSocket->sourceEndpoint(),
+                            k_NUM_MESSAGES,
+                            k_MESSAGE_SIZE,
+                            &clientSemaphore);
+
+            acceptSemaphore.wait();
+
+            ntci::StreamSocketCloseGuard serverGuard(serverSocket);
+
+            {
+                ntci::CoroutineStreamSocket server(serverSocket, &ta);
+
+                case82::serve(&server,
+                              k_NUM_MESSAGES,
+                              k_MESSAGE_SIZE,
+                              &serverSemaphore);
+
+                clientSemaphore.wait();
+                serverSemaphore.wait();
+            }
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+
+#endif
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
@@ -14350,5 +14573,6 @@ NTCCFG_TEST_DRIVER
     NTCCFG_TEST_REGISTER(79);
     NTCCFG_TEST_REGISTER(80);
     NTCCFG_TEST_REGISTER(81);
+    NTCCFG_TEST_REGISTER(82);
 }
 NTCCFG_TEST_DRIVER_END;
@@ -18,45 +18,48 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(ntci_acceptfuture_cpp, "$Id$ $CSID$")
 
-#include <bdlf_memfn.h>
-#include <bslmt_lockguard.h>
-#include <bslscm_versiontag.h>
-
-#if BSL_VERSION >= BSL_MAKE_VERSION(3, 80)
-#define NTCI_ACCEPTFUTURE_TIMEOUT bslmt::Condition::e_TIMED_OUT
-#else
-#define NTCI_ACCEPTFUTURE_TIMEOUT -1
-#endif
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+#include <bslma_default.h>
 
 namespace BloombergLP {
 namespace ntci {
 
 void AcceptFuture::arrive(
+    const bsl::shared_ptr<ResultQueue>&        resultQueue,
+    unsigned int                               generation,
     const bsl::shared_ptr<ntci::Acceptor>&     acceptor,
     const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
     const ntca::AcceptEvent&                   event)
 {
     NTCCFG_WARNING_UNUSED(acceptor);
 
-    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-
     AcceptResult result;
     result.setAcceptor(acceptor);
     result.setStreamSocket(streamSocket);
     result.setEvent(event);
 
-    d_resultQueue.push_back(result);
+    resultQueue->push(result, generation);
+}
 
-    d_condition.signal();
+void AcceptFuture::arm(unsigned int generation)
+{
+    this->setFunction(bdlf::BindUtil::bind(&AcceptFuture::arrive,
+                                           d_resultQueue_sp,
+                                           generation,
+                                           bdlf::PlaceHolders::_1,
+                                           bdlf::PlaceHolders::_2,
+                                           bdlf::PlaceHolders::_3));
 }
 
 AcceptFuture::AcceptFuture(bslma::Allocator* basicAllocator)
 : ntci::AcceptCallback(basicAllocator)
-, d_mutex()
-, d_condition()
-, d_resultQueue(basicAllocator)
+, d_resultQueue_sp()
 {
-    this->setFunction(bdlf::MemFnUtil::memFn(&AcceptFuture::arrive, this));
+    bslma::Allocator* allocator = bslma::Default::allocator(basicAllocator);
+    d_resultQueue_sp.createInplace(allocator, allocator);
+
+    this->arm(d_resultQueue_sp->generation());
 }
 
 AcceptFuture::~AcceptFuture()
@@ -65,40 +68,21 @@ AcceptFuture::~AcceptFuture()
 
 ntsa::Error AcceptFuture::wait(ntci::AcceptResult* result)
 {
-    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-
-    while (d_resultQueue.empty()) {
-        d_condition.wait(&d_mutex);
-    }
-
-    *result = d_resultQueue.front();
-    d_resultQueue.pop_front();
-
-    return ntsa::Error();
+    return d_resultQueue_sp->pop(result);
 }
 
 ntsa::Error AcceptFuture::wait(ntci::AcceptResult*       result,
                                const bsls::TimeInterval& timeout)
 {
-    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-
-    while (d_resultQueue.empty()) {
-        int rc = d_condition.timedWait(&d_mutex, timeout);
-        if (rc == 0) {
-            break;
-        }
-        else if (rc == NTCI_ACCEPTFUTURE_TIMEOUT) {
-            return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
-        }
-        else {
-            return ntsa::Error(ntsa::Error::e_INVALID);
-        }
-    }
-
-    *result = d_resultQueue.front();
-    d_resultQueue.pop_front();
-
-    return ntsa::Error();
+    return d_resultQueue_sp->pop(result, timeout);
+}
+
+void AcceptFuture::rearm()
+{
+    const unsigned int generation = d_resultQueue_sp->reset();
+
+    this->ntci::AcceptCallback::reset();
+    this->arm(generation);
 }
 
 }  // close package namespace
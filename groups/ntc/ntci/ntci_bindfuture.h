@@ -22,12 +22,10 @@ BSLS_IDENT("$Id: $")
 #include <ntccfg_platform.h>
 #include <ntci_bindcallback.h>
 #include <ntci_bindresult.h>
+#include <ntci_futurestate.h>
 #include <ntcscm_version.h>
 #include <ntsa_error.h>
-#include <bslmt_condition.h>
-#include <bslmt_mutex.h>
 #include <bsls_timeinterval.h>
-#include <bsl_list.h>
 #include <bsl_memory.h>
 
 namespace BloombergLP {
@@ -38,6 +36,13 @@ namespace ntci {
 
 /// Provide a future asynchronous result of a bind operation.
 ///
+/// @details
+/// The results of this future are stored in a queue shared with the
+/// callback of this future and each copy of it. An operation still pending
+/// when this future is rearmed or destroyed completes into that queue, which
+/// outlives this future until the last copy of its callback is destroyed,
+/// and its result is discarded.
+///
 /// @par Thread Safety
 /// This class is thread safe.
 ///
@@ -45,21 +50,27 @@ namespace ntci {
 class BindFuture : public ntci::BindCallback
 {
     /// Define a type alias for a queue of results.
-    typedef bsl::list<ntci::BindResult> ResultQueue;
+    typedef ntci::FutureQueue<ntci::BindResult> ResultQueue;
 
-    bslmt::Mutex     d_mutex;
-    bslmt::Condition d_condition;
-    ResultQueue      d_resultQueue;
+    bsl::shared_ptr<ResultQueue> d_resultQueue_sp;
 
   private:
     BindFuture(const BindFuture&) BSLS_KEYWORD_DELETED;
     BindFuture& operator=(const BindFuture&) BSLS_KEYWORD_DELETED;
 
   private:
-    /// Arrive at a bind result from the specified 'binder' according to
-    /// the specified 'event'.
-    void arrive(const bsl::shared_ptr<ntci::Bindable>& bindable,
-                const ntca::BindEvent&                 event);
+    /// Arrive at a bind result from the specified 'binder' according to the
+    /// specified 'event'. Push the result onto the specified 'resultQueue'
+    /// unless the specified 'generation' identifies an operation whose result
+    /// is no longer accepted.
+    static void arrive(const bsl::shared_ptr<ResultQueue>&    resultQueue,
+                       unsigned int                           generation,
+                       const bsl::shared_ptr<ntci::Bindable>& bindable,
+                       const ntca::BindEvent&                 event);
+
+    /// Assign the callback to arrive at the results of the operation
+    /// identified by the specified 'generation'.
+    void arm(unsigned int generation);
 
   public:
     /// Create a new bind result. Optionally specify a 'basicAllocator'
@@ -79,6 +90,14 @@ class BindFuture : public ntci::BindCallback
     /// the error.
     ntsa::Error wait(ntci::BindResult*         result,
                      const bsls::TimeInterval& timeout);
+
+    /// Discard any results available and reject the result of any operation
+    /// still pending, so that this future may be reused to wait for the
+    /// result of a new operation, e.g. after a wait times out. Note that
+    /// this function allocates a new callback: copies of the callback of
+    /// this future made before this function is called, notably by the
+    /// operations still pending, no longer complete this future.
+    void rearm();
 };
 
 }  // close package namespace
@@ -47,6 +47,19 @@ namespace ntci {
 /// Provide a bindable function to be invoked on an optional strand with an
 /// optional authorization mechanism.
 ///
+/// @details
+/// The function is stored once, when the callback is created, in an invoker
+/// shared by each copy of the callback. Deferring an invocation onto a
+/// strand binds only the shared invoker and the arguments into an
+/// 'ntci::Executor::InplaceFunctor', so the function is never copied for
+/// each invocation. Note that the function remains a 'bsl::function', since
+/// it is part of the interface of, e.g., 'ntci::SendCallback' and
+/// 'ntci::ReceiveCallback': creating a callback allocates the invoker and,
+/// when the target of the function exceeds the small object buffer of a
+/// 'bsl::function', a copy of that target. Only the deferral of each
+/// invocation is free of allocations, and only while the invoker and the
+/// arguments fit within the capacity of an 'ntci::Executor::InplaceFunctor'.
+///
 /// @par Thread Safety
 /// This class is not thread safe.
 ///
@@ -1245,10 +1258,11 @@ NTCCFG_INLINE ntsa::Error Callback<SIGNATURE>::execute(
         return d_invoker_sp->call0();
     }
     else {
-        bsl::function<void()> dispatch =
-            bdlf::BindUtil::bind(&Invoker<SIGNATURE>::call0, d_invoker_sp);
+        ntci::Executor::InplaceFunctor dispatch(
+            bdlf::BindUtil::bind(&Invoker<SIGNATURE>::call0, d_invoker_sp),
+            d_allocator_p);
 
-        d_strand_sp->execute(dispatch);
+        d_strand_sp->executeInplace(&dispatch);
         return ntsa::Error(ntsa::Error::e_PENDING);
     }
 }
@@ -1267,12 +1281,13 @@ NTCCFG_INLINE ntsa::Error Callback<SIGNATURE>::execute(
         return d_invoker_sp->call1(arg1);
     }
     else {
-        bsl::function<void()> dispatch =
+        ntci::Executor::InplaceFunctor dispatch(
             bdlf::BindUtil::bind(&InvokerType::template call1<ARG1>,
                                  d_invoker_sp,
-                                 arg1);
+                                 arg1),
+            d_allocator_p);
 
-        d_strand_sp->execute(dispatch);
+        d_strand_sp->executeInplace(&dispatch);
         return ntsa::Error(ntsa::Error::e_PENDING);
     }
 }
@@ -1292,13 +1307,14 @@ NTCCFG_INLINE ntsa::Error Callback<SIGNATURE>::execute(
         return d_invoker_sp->call2(arg1, arg2);
     }
     else {
-        bsl::function<void()> dispatch =
+        ntci::Executor::InplaceFunctor dispatch(
             bdlf::BindUtil::bind(&InvokerType::template call2<ARG1, ARG2>,
                                  d_invoker_sp,
                                  arg1,
-                                 arg2);
+                                 arg2),
+            d_allocator_p);
 
-        d_strand_sp->execute(dispatch);
+        d_strand_sp->executeInplace(&dispatch);
         return ntsa::Error(ntsa::Error::e_PENDING);
     }
 }
@@ -1319,14 +1335,16 @@ NTCCFG_INLINE ntsa::Error Callback<SIGNATURE>::execute(
         return d_invoker_sp->call3(arg1, arg2, arg3);
     }
     else {
-        bsl::function<void()> dispatch = bdlf::BindUtil::bind(
-            &InvokerType::template call3<ARG1, ARG2, ARG3>,
-            d_invoker_sp,
-            arg1,
-            arg2,
-            arg3);
-
-        d_strand_sp->execute(dispatch);
+        ntci::Executor::InplaceFunctor dispatch(
+            bdlf::BindUtil::bind(
+                &InvokerType::template call3<ARG1, ARG2, ARG3>,
+                d_invoker_sp,
+                arg1,
+                arg2,
+                arg3),
+            d_allocator_p);
+
+        d_strand_sp->executeInplace(&dispatch);
         return ntsa::Error(ntsa::Error::e_PENDING);
     }
 }
@@ -1348,15 +1366,17 @@ NTCCFG_INLINE ntsa::Error Callback<SIGNATURE>::execute(
         return d_invoker_sp->call4(arg1, arg2, arg3, arg4);
     }
     else {
-        bsl::function<void()> dispatch = bdlf::BindUtil::bind(
-            &InvokerType::template call4<ARG1, ARG2, ARG3, ARG4>,
-            d_invoker_sp,
-            arg1,
-            arg2,
-            arg3,
-            arg4);
-
-        d_strand_sp->execute(dispatch);
+        ntci::Executor::InplaceFunctor dispatch(
+            bdlf::BindUtil::bind(
+                &InvokerType::template call4<ARG1, ARG2, ARG3, ARG4>,
+                d_invoker_sp,
+                arg1,
+                arg2,
+                arg3,
+                arg4),
+            d_allocator_p);
+
+        d_strand_sp->executeInplace(&dispatch);
         return ntsa::Error(ntsa::Error::e_PENDING);
     }
 }
@@ -1383,16 +1403,18 @@ NTCCFG_INLINE ntsa::Error Callback<SIGNATURE>::execute(
         return d_invoker_sp->call5(arg1, arg2, arg3, arg4, arg5);
     }
     else {
-        bsl::function<void()> dispatch = bdlf::BindUtil::bind(
-            &InvokerType::template call5<ARG1, ARG2, ARG3, ARG4, ARG5>,
-            d_invoker_sp,
-            arg1,
-            arg2,
-            arg3,
-            arg4,
-            arg5);
-
-        d_strand_sp->execute(dispatch);
+        ntci::Executor::InplaceFunctor dispatch(
+            bdlf::BindUtil::bind(
+                &InvokerType::template call5<ARG1, ARG2, ARG3, ARG4, ARG5>,
+                d_invoker_sp,
+                arg1,
+                arg2,
+                arg3,
+                arg4,
+                arg5),
+            d_allocator_p);
+
+        d_strand_sp->executeInplace(&dispatch);
         return ntsa::Error(ntsa::Error::e_PENDING);
     }
 }
@@ -1421,17 +1443,20 @@ NTCCFG_INLINE ntsa::Error Callback<SIGNATURE>::execute(
         return d_invoker_sp->call6(arg1, arg2, arg3, arg4, arg5, arg6);
     }
     else {
-        bsl::function<void()> dispatch = bdlf::BindUtil::bind(
-            &InvokerType::template call6<ARG1, ARG2, ARG3, ARG4, ARG5, ARG6>,
-            d_invoker_sp,
-            arg1,
-            arg2,
-            arg3,
-            arg4,
-            arg5,
-            arg6);
-
-        d_strand_sp->execute(dispatch);
+        ntci::Executor::InplaceFunctor dispatch(
+            bdlf::BindUtil::bind(
+                &InvokerType::
+                    template call6<ARG1, ARG2, ARG3, ARG4, ARG5, ARG6>,
+                d_invoker_sp,
+                arg1,
+                arg2,
+                arg3,
+                arg4,
+                arg5,
+                arg6),
+            d_allocator_p);
+
+        d_strand_sp->executeInplace(&dispatch);
         return ntsa::Error(ntsa::Error::e_PENDING);
     }
 }
@@ -1462,19 +1487,21 @@ NTCCFG_INLINE ntsa::Error Callback<SIGNATURE>::execute(
         return d_invoker_sp->call7(arg1, arg2, arg3, arg4, arg5, arg6, arg7);
     }
     else {
-        bsl::function<void()> dispatch = bdlf::BindUtil::bind(
-            &InvokerType::
-                template call7<ARG1, ARG2, ARG3, ARG4, ARG5, ARG6, ARG7>,
-            d_invoker_sp,
-            arg1,
-            arg2,
-            arg3,
-            arg4,
-            arg5,
-            arg6,
-            arg7);
-
-        d_strand_sp->execute(dispatch);
+        ntci::Executor::InplaceFunctor dispatch(
+            bdlf::BindUtil::bind(
+                &InvokerType::
+                    template call7<ARG1, ARG2, ARG3, ARG4, ARG5, ARG6, ARG7>,
+                d_invoker_sp,
+                arg1,
+                arg2,
+                arg3,
+                arg4,
+                arg5,
+                arg6,
+                arg7),
+            d_allocator_p);
+
+        d_strand_sp->executeInplace(&dispatch);
         return ntsa::Error(ntsa::Error::e_PENDING);
     }
 }
@@ -1508,20 +1535,28 @@ NTCCFG_INLINE ntsa::Error Callback<SIGNATURE>::execute(
             ->call8(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
     }
     else {
-        bsl::function<void()> dispatch = bdlf::BindUtil::bind(
-            &InvokerType::
-                template call8<ARG1, ARG2, ARG3, ARG4, ARG5, ARG6, ARG7, ARG8>,
-            d_invoker_sp,
-            arg1,
-            arg2,
-            arg3,
-            arg4,
-            arg5,
-            arg6,
-            arg7,
-            arg8);
-
-        d_strand_sp->execute(dispatch);
+        ntci::Executor::InplaceFunctor dispatch(
+            bdlf::BindUtil::bind(
+                &InvokerType::template call8<ARG1,
+                                             ARG2,
+                                             ARG3,
+                                             ARG4,
+                                             ARG5,
+                                             ARG6,
+                                             ARG7,
+                                             ARG8>,
+                d_invoker_sp,
+                arg1,
+                arg2,
+                arg3,
+                arg4,
+                arg5,
+                arg6,
+                arg7,
+                arg8),
+            d_allocator_p);
+
+        d_strand_sp->executeInplace(&dispatch);
         return ntsa::Error(ntsa::Error::e_PENDING);
     }
 }
@@ -1557,7 +1592,7 @@ NTCCFG_INLINE ntsa::Error Callback<SIGNATURE>::execute(
             ->call9(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
     }
     else {
-        bsl::function<void()> dispatch =
+        ntci::Executor::InplaceFunctor dispatch(
             bdlf::BindUtil::bind(&InvokerType::template call9<ARG1,
                                                               ARG2,
                                                               ARG3,
@@ -1576,9 +1611,10 @@ NTCCFG_INLINE ntsa::Error Callback<SIGNATURE>::execute(
                                  arg6,
                                  arg7,
                                  arg8,
-                                 arg9);
+                                 arg9),
+            d_allocator_p);
 
-        d_strand_sp->execute(dispatch);
+        d_strand_sp->executeInplace(&dispatch);
         return ntsa::Error(ntsa::Error::e_PENDING);
     }
 }
@@ -1602,15 +1638,16 @@ NTCCFG_INLINE ntsa::Error Callback<SIGNATURE>::dispatch(
         return d_invoker_sp->call0();
     }
     else {
-        bsl::function<void()> dispatch =
-            bdlf::BindUtil::bind(&Invoker<SIGNATURE>::call0, d_invoker_sp);
+        ntci::Executor::InplaceFunctor dispatch(
+            bdlf::BindUtil::bind(&Invoker<SIGNATURE>::call0, d_invoker_sp),
+            d_allocator_p);
 
         if (d_strand_sp) {
-            d_strand_sp->execute(dispatch);
+            d_strand_sp->executeInplace(&dispatch);
             return ntsa::Error(ntsa::Error::e_PENDING);
         }
         else if (executor) {
-            executor->execute(dispatch);
+            executor->executeInplace(&dispatch);
             return ntsa::Error(ntsa::Error::e_PENDING);
         }
         else {
@@ -1639,17 +1676,18 @@ NTCCFG_INLINE ntsa::Error Callback<SIGNATURE>::dispatch(
         return d_invoker_sp->call1(arg1);
     }
     else {
-        bsl::function<void()> dispatch =
+        ntci::Executor::InplaceFunctor dispatch(
             bdlf::BindUtil::bind(&InvokerType::template call1<ARG1>,
                                  d_invoker_sp,
-                                 arg1);
+                                 arg1),
+            d_allocator_p);
 
         if (d_strand_sp) {
-            d_strand_sp->execute(dispatch);
+            d_strand_sp->executeInplace(&dispatch);
             return ntsa::Error(ntsa::Error::e_PENDING);
         }
         else if (executor) {
-            executor->execute(dispatch);
+            executor->executeInplace(&dispatch);
             return ntsa::Error(ntsa::Error::e_PENDING);
         }
         else {
@@ -1679,18 +1717,19 @@ NTCCFG_INLINE ntsa::Error Callback<SIGNATURE>::dispatch(
         return d_invoker_sp->call2(arg1, arg2);
     }
     else {
-        bsl::function<void()> dispatch =
+        ntci::Executor::InplaceFunctor dispatch(
             bdlf::BindUtil::bind(&InvokerType::template call2<ARG1, ARG2>,
                                  d_invoker_sp,
                                  arg1,
-                                 arg2);
+                                 arg2),
+            d_allocator_p);
 
         if (d_strand_sp) {
-            d_strand_sp->execute(dispatch);
+            d_strand_sp->executeInplace(&dispatch);
             return ntsa::Error(ntsa::Error::e_PENDING);
         }
         else if (executor) {
-            executor->execute(dispatch);
+            executor->executeInplace(&dispatch);
             return ntsa::Error(ntsa::Error::e_PENDING);
         }
         else {
@@ -1721,19 +1760,21 @@ NTCCFG_INLINE ntsa::Error Callback<SIGNATURE>::dispatch(
         return d_invoker_sp->call3(arg1, arg2, arg3);
     }
     else {
-        bsl::function<void()> dispatch = bdlf::BindUtil::bind(
-            &InvokerType::template call3<ARG1, ARG2, ARG3>,
-            d_invoker_sp,
-            arg1,
-            arg2,
-            arg3);
+        ntci::Executor::InplaceFunctor dispatch(
+            bdlf::BindUtil::bind(
+                &InvokerType::template call3<ARG1, ARG2, ARG3>,
+                d_invoker_sp,
+                arg1,
+                arg2,
+                arg3),
+            d_allocator_p);
 
         if (d_strand_sp) {
-            d_strand_sp->execute(dispatch);
+            d_strand_sp->executeInplace(&dispatch);
             return ntsa::Error(ntsa::Error::e_PENDING);
         }
         else if (executor) {
-            executor->execute(dispatch);
+            executor->executeInplace(&dispatch);
             return ntsa::Error(ntsa::Error::e_PENDING);
         }
         else {
@@ -1769,20 +1810,22 @@ NTCCFG_INLINE ntsa::Error Callback<SIGNATURE>::dispatch(
         return d_invoker_sp->call4(arg1, arg2, arg3, arg4);
     }
     else {
-        bsl::function<void()> dispatch = bdlf::BindUtil::bind(
-            &InvokerType::template call4<ARG1, ARG2, ARG3, ARG4>,
-            d_invoker_sp,
-            arg1,
-            arg2,
-            arg3,
-            arg4);
+        ntci::Executor::InplaceFunctor dispatch(
+            bdlf::BindUtil::bind(
+                &InvokerType::template call4<ARG1, ARG2, ARG3, ARG4>,
+                d_invoker_sp,
+                arg1,
+                arg2,
+                arg3,
+                arg4),
+            d_allocator_p);
 
         if (d_strand_sp) {
-            d_strand_sp->execute(dispatch);
+            d_strand_sp->executeInplace(&dispatch);
             return ntsa::Error(ntsa::Error::e_PENDING);
         }
         else if (executor) {
-            executor->execute(dispatch);
+            executor->executeInplace(&dispatch);
             return ntsa::Error(ntsa::Error::e_PENDING);
         }
         else {
@@ -1820,21 +1863,23 @@ NTCCFG_INLINE ntsa::Error Callback<SIGNATURE>::dispatch(
         return d_invoker_sp->call5(arg1, arg2, arg3, arg4, arg5);
     }
     else {
-        bsl::function<void()> dispatch = bdlf::BindUtil::bind(
-            &InvokerType::template call5<ARG1, ARG2, ARG3, ARG4, ARG5>,
-            d_invoker_sp,
-            arg1,
-            arg2,
-            arg3,
-            arg4,
-            arg5);
+        ntci::Executor::InplaceFunctor dispatch(
+            bdlf::BindUtil::bind(
+                &InvokerType::template call5<ARG1, ARG2, ARG3, ARG4, ARG5>,
+                d_invoker_sp,
+                arg1,
+                arg2,
+                arg3,
+                arg4,
+                arg5),
+            d_allocator_p);
 
         if (d_strand_sp) {
-            d_strand_sp->execute(dispatch);
+            d_strand_sp->executeInplace(&dispatch);
             return ntsa::Error(ntsa::Error::e_PENDING);
         }
         else if (executor) {
-            executor->execute(dispatch);
+            executor->executeInplace(&dispatch);
             return ntsa::Error(ntsa::Error::e_PENDING);
         }
         else {
@@ -1874,22 +1919,25 @@ NTCCFG_INLINE ntsa::Error Callback<SIGNATURE>::dispatch(
         return d_invoker_sp->call6(arg1, arg2, arg3, arg4, arg5, arg6);
     }
     else {
-        bsl::function<void()> dispatch = bdlf::BindUtil::bind(
-            &InvokerType::template call6<ARG1, ARG2, ARG3, ARG4, ARG5, ARG6>,
-            d_invoker_sp,
-            arg1,
-            arg2,
-            arg3,
-            arg4,
-            arg5,
-            arg6);
+        ntci::Executor::InplaceFunctor dispatch(
+            bdlf::BindUtil::bind(
+                &InvokerType::
+                    template call6<ARG1, ARG2, ARG3, ARG4, ARG5, ARG6>,
+                d_invoker_sp,
+                arg1,
+                arg2,
+                arg3,
+                arg4,
+                arg5,
+                arg6),
+            d_allocator_p);
 
         if (d_strand_sp) {
-            d_strand_sp->execute(dispatch);
+            d_strand_sp->executeInplace(&dispatch);
             return ntsa::Error(ntsa::Error::e_PENDING);
         }
         else if (executor) {
-            executor->execute(dispatch);
+            executor->executeInplace(&dispatch);
             return ntsa::Error(ntsa::Error::e_PENDING);
         }
         else {
@@ -1931,24 +1979,26 @@ NTCCFG_INLINE ntsa::Error Callback<SIGNATURE>::dispatch(
         return d_invoker_sp->call7(arg1, arg2, arg3, arg4, arg5, arg6, arg7);
     }
     else {
-        bsl::function<void()> dispatch = bdlf::BindUtil::bind(
-            &InvokerType::
-                template call7<ARG1, ARG2, ARG3, ARG4, ARG5, ARG6, ARG7>,
-            d_invoker_sp,
-            arg1,
-            arg2,
-            arg3,
-            arg4,
-            arg5,
-            arg6,
-            arg7);
+        ntci::Executor::InplaceFunctor dispatch(
+            bdlf::BindUtil::bind(
+                &InvokerType::
+                    template call7<ARG1, ARG2, ARG3, ARG4, ARG5, ARG6, ARG7>,
+                d_invoker_sp,
+                arg1,
+                arg2,
+                arg3,
+                arg4,
+                arg5,
+                arg6,
+                arg7),
+            d_allocator_p);
 
         if (d_strand_sp) {
-            d_strand_sp->execute(dispatch);
+            d_strand_sp->executeInplace(&dispatch);
             return ntsa::Error(ntsa::Error::e_PENDING);
         }
         else if (executor) {
-            executor->execute(dispatch);
+            executor->executeInplace(&dispatch);
             return ntsa::Error(ntsa::Error::e_PENDING);
         }
         else {
@@ -1993,25 +2043,33 @@ NTCCFG_INLINE ntsa::Error Callback<SIGNATURE>::dispatch(
             ->call8(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
     }
     else {
-        bsl::function<void()> dispatch = bdlf::BindUtil::bind(
-            &InvokerType::
-                template call8<ARG1, ARG2, ARG3, ARG4, ARG5, ARG6, ARG7, ARG8>,
-            d_invoker_sp,
-            arg1,
-            arg2,
-            arg3,
-            arg4,
-            arg5,
-            arg6,
-            arg7,
-            arg8);
+        ntci::Executor::InplaceFunctor dispatch(
+            bdlf::BindUtil::bind(
+                &InvokerType::template call8<ARG1,
+                                             ARG2,
+                                             ARG3,
+                                             ARG4,
+                                             ARG5,
+                                             ARG6,
+                                             ARG7,
+                                             ARG8>,
+                d_invoker_sp,
+                arg1,
+                arg2,
+                arg3,
+                arg4,
+                arg5,
+                arg6,
+                arg7,
+                arg8),
+            d_allocator_p);
 
         if (d_strand_sp) {
-            d_strand_sp->execute(dispatch);
+            d_strand_sp->executeInplace(&dispatch);
             return ntsa::Error(ntsa::Error::e_PENDING);
         }
         else if (executor) {
-            executor->execute(dispatch);
+            executor->executeInplace(&dispatch);
             return ntsa::Error(ntsa::Error::e_PENDING);
         }
         else {
@@ -2058,7 +2116,7 @@ NTCCFG_INLINE ntsa::Error Callback<SIGNATURE>::dispatch(
             ->call9(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
     }
     else {
-        bsl::function<void()> dispatch =
+        ntci::Executor::InplaceFunctor dispatch(
             bdlf::BindUtil::bind(&InvokerType::template call9<ARG1,
                                                               ARG2,
                                                               ARG3,
@@ -2077,14 +2135,15 @@ NTCCFG_INLINE ntsa::Error Callback<SIGNATURE>::dispatch(
                                  arg6,
                                  arg7,
                                  arg8,
-                                 arg9);
+                                 arg9),
+            d_allocator_p);
 
         if (d_strand_sp) {
-            d_strand_sp->execute(dispatch);
+            d_strand_sp->executeInplace(&dispatch);
             return ntsa::Error(ntsa::Error::e_PENDING);
         }
         else if (executor) {
-            executor->execute(dispatch);
+            executor->executeInplace(&dispatch);
             return ntsa::Error(ntsa::Error::e_PENDING);
         }
         else {
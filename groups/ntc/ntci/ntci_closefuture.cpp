@@ -18,37 +18,35 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(ntci_closefuture_cpp, "$Id$ $CSID$")
 
-#include <bdlf_memfn.h>
-#include <bslmt_lockguard.h>
-#include <bslscm_versiontag.h>
-
-#if BSL_VERSION >= BSL_MAKE_VERSION(3, 80)
-#define NTCI_CLOSEFUTURE_TIMEOUT bslmt::Condition::e_TIMED_OUT
-#else
-#define NTCI_CLOSEFUTURE_TIMEOUT -1
-#endif
+#include <bdlf_bind.h>
+#include <bslma_default.h>
 
 namespace BloombergLP {
 namespace ntci {
 
-void CloseFuture::arrive()
+void CloseFuture::arrive(const bsl::shared_ptr<ResultQueue>& resultQueue,
+                         unsigned int                        generation)
 {
-    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-
     CloseResult result;
 
-    d_resultQueue.push_back(result);
+    resultQueue->push(result, generation);
+}
 
-    d_condition.signal();
+void CloseFuture::arm(unsigned int generation)
+{
+    this->setFunction(bdlf::BindUtil::bind(&CloseFuture::arrive,
+                                           d_resultQueue_sp,
+                                           generation));
 }
 
 CloseFuture::CloseFuture(bslma::Allocator* basicAllocator)
 : ntci::CloseCallback(basicAllocator)
-, d_mutex()
-, d_condition()
-, d_resultQueue(basicAllocator)
+, d_resultQueue_sp()
 {
-    this->setFunction(bdlf::MemFnUtil::memFn(&CloseFuture::arrive, this));
+    bslma::Allocator* allocator = bslma::Default::allocator(basicAllocator);
+    d_resultQueue_sp.createInplace(allocator, allocator);
+
+    this->arm(d_resultQueue_sp->generation());
 }
 
 CloseFuture::~CloseFuture()
@@ -57,40 +55,21 @@ CloseFuture::~CloseFuture()
 
 ntsa::Error CloseFuture::wait(ntci::CloseResult* result)
 {
-    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-
-    while (d_resultQueue.empty()) {
-        d_condition.wait(&d_mutex);
-    }
-
-    *result = d_resultQueue.front();
-    d_resultQueue.pop_front();
-
-    return ntsa::Error();
+    return d_resultQueue_sp->pop(result);
 }
 
 ntsa::Error CloseFuture::wait(ntci::CloseResult*        result,
                               const bsls::TimeInterval& timeout)
 {
-    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-
-    while (d_resultQueue.empty()) {
-        int rc = d_condition.timedWait(&d_mutex, timeout);
-        if (rc == 0) {
-            break;
-        }
-        else if (rc == NTCI_CLOSEFUTURE_TIMEOUT) {
-            return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
-        }
-        else {
-            return ntsa::Error(ntsa::Error::e_INVALID);
-        }
-    }
+    return d_resultQueue_sp->pop(result, timeout);
+}
 
-    *result = d_resultQueue.front();
-    d_resultQueue.pop_front();
+void CloseFuture::rearm()
+{
+    const unsigned int generation = d_resultQueue_sp->reset();
 
-    return ntsa::Error();
+    this->ntci::CloseCallback::reset();
+    this->arm(generation);
 }
 
 }  // close package namespace
@@ -0,0 +1,672 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntci_coroutine.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntci_coroutine_cpp, "$Id$ $CSID$")
+
+#if NTCI_COROUTINE_ENABLED
+
+#include <ntca_timeroptions.h>
+#include <bdlf_memfn.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace ntci {
+
+CoroutineOperation::CoroutineOperation()
+: d_state(e_IDLE)
+, d_handle()
+, d_error()
+{
+}
+
+CoroutineOperation::~CoroutineOperation()
+{
+    BSLS_ASSERT(d_state.loadAcquire() != e_SUSPENDED);
+}
+
+void CoroutineOperation::start()
+{
+    BSLS_ASSERT(d_state.loadAcquire() == e_IDLE);
+
+    d_handle = std::coroutine_handle<>();
+    d_error  = ntsa::Error();
+
+    d_state.storeRelease(e_PENDING);
+}
+
+void CoroutineOperation::complete(const ntsa::Error& error)
+{
+    d_error = error;
+
+    const int previous = d_state.swapAcqRel(e_COMPLETE);
+    BSLS_ASSERT(previous == e_PENDING || previous == e_SUSPENDED);
+
+    if (previous == e_SUSPENDED) {
+        d_handle.resume();
+    }
+}
+
+bool CoroutineOperation::suspend(std::coroutine_handle<> handle)
+{
+    d_handle = handle;
+
+    return d_state.testAndSwapAcqRel(e_PENDING, e_SUSPENDED) ==
+           e_PENDING;
+}
+
+ntsa::Error CoroutineOperation::finish()
+{
+    BSLS_ASSERT(d_state.loadAcquire() == e_COMPLETE);
+
+    ntsa::Error error = d_error;
+
+    d_handle = std::coroutine_handle<>();
+    d_state.storeRelease(e_IDLE);
+
+    return error;
+}
+
+bool CoroutineOperation::isPending() const
+{
+    return d_state.loadAcquire() != e_IDLE;
+}
+
+bool CoroutineOperation::isComplete() const
+{
+    return d_state.loadAcquire() == e_COMPLETE;
+}
+
+CoroutineAwaitable::CoroutineAwaitable(ntci::CoroutineOperation* operation)
+: d_operation_p(operation)
+{
+}
+
+bool CoroutineAwaitable::await_ready() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_operation_p->isComplete();
+}
+
+bool CoroutineAwaitable::await_suspend(std::coroutine_handle<> handle)
+    BSLS_KEYWORD_NOEXCEPT
+{
+    return d_operation_p->suspend(handle);
+}
+
+ntsa::Error CoroutineAwaitable::await_resume() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_operation_p->finish();
+}
+
+void CoroutineTimer::processTimer(const bsl::shared_ptr<ntci::Timer>& timer,
+                                  const ntca::TimerEvent&             event)
+{
+    NTCCFG_WARNING_UNUSED(timer);
+
+    if (!d_operation.isPending() || d_operation.isComplete()) {
+        return;
+    }
+
+    if (event.type() == ntca::TimerEventType::e_DEADLINE) {
+        d_operation.complete(ntsa::Error());
+    }
+    else if (event.type() == ntca::TimerEventType::e_CANCELED) {
+        d_operation.complete(ntsa::Error(ntsa::Error::e_CANCELLED));
+    }
+}
+
+CoroutineTimer::CoroutineTimer(
+    ntci::TimerFactory*                  timerFactory,
+    const bsl::shared_ptr<ntci::Strand>& strand,
+    bslma::Allocator*                    basicAllocator)
+: d_operation()
+, d_timer_sp()
+{
+    // The timer is not one-shot so that it may be rescheduled after each
+    // deadline, and its closure is not announced because it is only closed
+    // when this object is destroyed.
+
+    ntca::TimerOptions timerOptions;
+    timerOptions.setOneShot(false);
+    timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
+
+    ntci::TimerCallback timerCallback(
+        bdlf::MemFnUtil::memFn(&CoroutineTimer::processTimer, this),
+        strand,
+        basicAllocator);
+
+    d_timer_sp = timerFactory->createTimer(timerOptions,
+                                           timerCallback,
+                                           basicAllocator);
+}
+
+CoroutineTimer::~CoroutineTimer()
+{
+    if (d_timer_sp) {
+        d_timer_sp->close();
+        d_timer_sp.reset();
+    }
+}
+
+ntci::CoroutineAwaitable CoroutineTimer::sleep(
+    const bsls::TimeInterval& duration)
+{
+    d_operation.start();
+
+    ntsa::Error error;
+    if (d_timer_sp) {
+        error = d_timer_sp->schedule(d_timer_sp->currentTime() + duration);
+    }
+    else {
+        error = ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    if (error) {
+        d_operation.complete(error);
+    }
+
+    return ntci::CoroutineAwaitable(&d_operation);
+}
+
+void CoroutineTimer::cancel()
+{
+    if (d_timer_sp) {
+        d_timer_sp->cancel();
+    }
+}
+
+void CoroutineStreamSocket::processConnect(
+    const bsl::shared_ptr<ntci::Connector>& connector,
+    const ntca::ConnectEvent&               event)
+{
+    // The connect callback is invoked after each failed attempt: only the
+    // establishment of the connection or the failure of the last attempt
+    // completes the operation.
+
+    if (event.type() == ntca::ConnectEventType::e_ERROR &&
+        event.context().attemptsRemaining() > 0)
+    {
+        return;
+    }
+
+    d_connectResult_p->setConnector(connector);
+    d_connectResult_p->setEvent(event);
+
+    d_connectOperation.complete(event.context().error());
+}
+
+void CoroutineStreamSocket::processUpgrade(
+    const bsl::shared_ptr<ntci::Upgradable>& upgradable,
+    const ntca::UpgradeEvent&                event)
+{
+    NTCCFG_WARNING_UNUSED(upgradable);
+
+    *d_upgradeResult_p = event;
+
+    d_upgradeOperation.complete(event.context().error());
+}
+
+void CoroutineStreamSocket::processSend(
+    const bsl::shared_ptr<ntci::Sender>& sender,
+    const ntca::SendEvent&               event)
+{
+    d_sendResult_p->setSender(sender);
+    d_sendResult_p->setEvent(event);
+
+    d_sendOperation.complete(event.context().error());
+}
+
+void CoroutineStreamSocket::processReceive(
+    const bsl::shared_ptr<ntci::Receiver>& receiver,
+    const bsl::shared_ptr<bdlbb::Blob>&    data,
+    const ntca::ReceiveEvent&              event)
+{
+    d_receiveResult_p->setReceiver(receiver);
+    d_receiveResult_p->setData(data);
+    d_receiveResult_p->setEvent(event);
+
+    d_receiveOperation.complete(event.context().error());
+}
+
+void CoroutineStreamSocket::processClose()
+{
+    d_closeOperation.complete(ntsa::Error());
+}
+
+CoroutineStreamSocket::CoroutineStreamSocket(
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    bslma::Allocator*                          basicAllocator)
+: d_streamSocket_sp(streamSocket)
+, d_connectOperation()
+, d_connectResult_p(0)
+, d_connectCallback(
+      bdlf::MemFnUtil::memFn(&CoroutineStreamSocket::processConnect, this),
+      streamSocket->strand(),
+      basicAllocator)
+, d_upgradeOperation()
+, d_upgradeResult_p(0)
+, d_upgradeCallback(
+      bdlf::MemFnUtil::memFn(&CoroutineStreamSocket::processUpgrade, this),
+      streamSocket->strand(),
+      basicAllocator)
+, d_sendOperation()
+, d_sendResult_p(0)
+, d_sendCallback(
+      bdlf::MemFnUtil::memFn(&CoroutineStreamSocket::processSend, this),
+      streamSocket->strand(),
+      basicAllocator)
+, d_receiveOperation()
+, d_receiveResult_p(0)
+, d_receiveCallback(
+      bdlf::MemFnUtil::memFn(&CoroutineStreamSocket::processReceive, this),
+      streamSocket->strand(),
+      basicAllocator)
+, d_closeOperation()
+, d_closeCallback(
+      bdlf::MemFnUtil::memFn(&CoroutineStreamSocket::processClose, this),
+      streamSocket->strand(),
+      basicAllocator)
+, d_timer(streamSocket.get(), streamSocket->strand(), basicAllocator)
+{
+}
+
+CoroutineStreamSocket::~CoroutineStreamSocket()
+{
+}
+
+ntci::CoroutineAwaitable CoroutineStreamSocket::connect(
+    ntci::ConnectResult*        result,
+    const ntsa::Endpoint&       endpoint,
+    const ntca::ConnectOptions& options)
+{
+    d_connectResult_p = result;
+    d_connectOperation.start();
+
+    ntsa::Error error =
+        d_streamSocket_sp->connect(endpoint, options, d_connectCallback);
+    if (error) {
+        d_connectOperation.complete(error);
+    }
+
+    return ntci::CoroutineAwaitable(&d_connectOperation);
+}
+
+ntci::CoroutineAwaitable CoroutineStreamSocket::connect(
+    ntci::ConnectResult*        result,
+    const bsl::string&          name,
+    const ntca::ConnectOptions& options)
+{
+    d_connectResult_p = result;
+    d_connectOperation.start();
+
+    ntsa::Error error =
+        d_streamSocket_sp->connect(name, options, d_connectCallback);
+    if (error) {
+        d_connectOperation.complete(error);
+    }
+
+    return ntci::CoroutineAwaitable(&d_connectOperation);
+}
+
+ntci::CoroutineAwaitable CoroutineStreamSocket::upgrade(
+    ntca::UpgradeEvent*                            result,
+    const bsl::shared_ptr<ntci::EncryptionClient>& encryptionClient,
+    const ntca::UpgradeOptions&                    options)
+{
+    d_upgradeResult_p = result;
+    d_upgradeOperation.start();
+
+    ntsa::Error error = d_streamSocket_sp->upgrade(encryptionClient,
+                                                   options,
+                                                   d_upgradeCallback);
+    if (error) {
+        d_upgradeOperation.complete(error);
+    }
+
+    return ntci::CoroutineAwaitable(&d_upgradeOperation);
+}
+
+ntci::CoroutineAwaitable CoroutineStreamSocket::upgrade(
+    ntca::UpgradeEvent*                            result,
+    const bsl::shared_ptr<ntci::EncryptionServer>& encryptionServer,
+    const ntca::UpgradeOptions&                    options)
+{
+    d_upgradeResult_p = result;
+    d_upgradeOperation.start();
+
+    ntsa::Error error = d_streamSocket_sp->upgrade(encryptionServer,
+                                                   options,
+                                                   d_upgradeCallback);
+    if (error) {
+        d_upgradeOperation.complete(error);
+    }
+
+    return ntci::CoroutineAwaitable(&d_upgradeOperation);
+}
+
+ntci::CoroutineAwaitable CoroutineStreamSocket::send(
+    ntci::SendResult*        result,
+    const bdlbb::Blob&       data,
+    const ntca::SendOptions& options)
+{
+    d_sendResult_p = result;
+    d_sendOperation.start();
+
+    ntsa::Error error = d_streamSocket_sp->send(data, options, d_sendCallback);
+    if (error) {
+        d_sendOperation.complete(error);
+    }
+
+    return ntci::CoroutineAwaitable(&d_sendOperation);
+}
+
+ntci::CoroutineAwaitable CoroutineStreamSocket::send(
+    ntci::SendResult*        result,
+    const ntsa::Data&        data,
+    const ntca::SendOptions& options)
+{
+    d_sendResult_p = result;
+    d_sendOperation.start();
+
+    ntsa::Error error = d_streamSocket_sp->send(data, options, d_sendCallback);
+    if (error) {
+        d_sendOperation.complete(error);
+    }
+
+    return ntci::CoroutineAwaitable(&d_sendOperation);
+}
+
+ntci::CoroutineAwaitable CoroutineStreamSocket::receive(
+    ntci::ReceiveResult*        result,
+    const ntca::ReceiveOptions& options)
+{
+    d_receiveResult_p = result;
+    d_receiveOperation.start();
+
+    ntsa::Error error = d_streamSocket_sp->receive(options, d_receiveCallback);
+    if (error) {
+        d_receiveOperation.complete(error);
+    }
+
+    return ntci::CoroutineAwaitable(&d_receiveOperation);
+}
+
+ntci::CoroutineAwaitable CoroutineStreamSocket::sleep(
+    const bsls::TimeInterval& duration)
+{
+    return d_timer.sleep(duration);
+}
+
+ntci::CoroutineAwaitable CoroutineStreamSocket::close()
+{
+    d_closeOperation.start();
+    d_streamSocket_sp->close(d_closeCallback);
+
+    return ntci::CoroutineAwaitable(&d_closeOperation);
+}
+
+const bsl::shared_ptr<ntci::StreamSocket>& CoroutineStreamSocket::
+    streamSocket() const
+{
+    return d_streamSocket_sp;
+}
+
+void CoroutineListenerSocket::processAccept(
+    const bsl::shared_ptr<ntci::Acceptor>&     acceptor,
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    const ntca::AcceptEvent&                   event)
+{
+    d_acceptResult_p->setAcceptor(acceptor);
+    d_acceptResult_p->setStreamSocket(streamSocket);
+    d_acceptResult_p->setEvent(event);
+
+    d_acceptOperation.complete(event.context().error());
+}
+
+void CoroutineListenerSocket::processClose()
+{
+    d_closeOperation.complete(ntsa::Error());
+}
+
+CoroutineListenerSocket::CoroutineListenerSocket(
+    const bsl::shared_ptr<ntci::ListenerSocket>& listenerSocket,
+    bslma::Allocator*                            basicAllocator)
+: d_listenerSocket_sp(listenerSocket)
+, d_acceptOperation()
+, d_acceptResult_p(0)
+, d_acceptCallback(
+      bdlf::MemFnUtil::memFn(&CoroutineListenerSocket::processAccept, this),
+      listenerSocket->strand(),
+      basicAllocator)
+, d_closeOperation()
+, d_closeCallback(
+      bdlf::MemFnUtil::memFn(&CoroutineListenerSocket::processClose, this),
+      listenerSocket->strand(),
+      basicAllocator)
+, d_timer(listenerSocket.get(), listenerSocket->strand(), basicAllocator)
+{
+}
+
+CoroutineListenerSocket::~CoroutineListenerSocket()
+{
+}
+
+ntci::CoroutineAwaitable CoroutineListenerSocket::accept(
+    ntci::AcceptResult*        result,
+    const ntca::AcceptOptions& options)
+{
+    d_acceptResult_p = result;
+    d_acceptOperation.start();
+
+    ntsa::Error error =
+        d_listenerSocket_sp->accept(options, d_acceptCallback);
+    if (error) {
+        d_acceptOperation.complete(error);
+    }
+
+    return ntci::CoroutineAwaitable(&d_acceptOperation);
+}
+
+ntci::CoroutineAwaitable CoroutineListenerSocket::sleep(
+    const bsls::TimeInterval& duration)
+{
+    return d_timer.sleep(duration);
+}
+
+ntci::CoroutineAwaitable CoroutineListenerSocket::close()
+{
+    d_closeOperation.start();
+    d_listenerSocket_sp->close(d_closeCallback);
+
+    return ntci::CoroutineAwaitable(&d_closeOperation);
+}
+
+const bsl::shared_ptr<ntci::ListenerSocket>& CoroutineListenerSocket::
+    listenerSocket() const
+{
+    return d_listenerSocket_sp;
+}
+
+void CoroutineDatagramSocket::processConnect(
+    const bsl::shared_ptr<ntci::Connector>& connector,
+    const ntca::ConnectEvent&               event)
+{
+    if (event.type() == ntca::ConnectEventType::e_ERROR &&
+        event.context().attemptsRemaining() > 0)
+    {
+        return;
+    }
+
+    d_connectResult_p->setConnector(connector);
+    d_connectResult_p->setEvent(event);
+
+    d_connectOperation.complete(event.context().error());
+}
+
+void CoroutineDatagramSocket::processSend(
+    const bsl::shared_ptr<ntci::Sender>& sender,
+    const ntca::SendEvent&               event)
+{
+    d_sendResult_p->setSender(sender);
+    d_sendResult_p->setEvent(event);
+
+    d_sendOperation.complete(event.context().error());
+}
+
+void CoroutineDatagramSocket::processReceive(
+    const bsl::shared_ptr<ntci::Receiver>& receiver,
+    const bsl::shared_ptr<bdlbb::Blob>&    data,
+    const ntca::ReceiveEvent&              event)
+{
+    d_receiveResult_p->setReceiver(receiver);
+    d_receiveResult_p->setData(data);
+    d_receiveResult_p->setEvent(event);
+
+    d_receiveOperation.complete(event.context().error());
+}
+
+void CoroutineDatagramSocket::processClose()
+{
+    d_closeOperation.complete(ntsa::Error());
+}
+
+CoroutineDatagramSocket::CoroutineDatagramSocket(
+    const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
+    bslma::Allocator*                            basicAllocator)
+: d_datagramSocket_sp(datagramSocket)
+, d_connectOperation()
+, d_connectResult_p(0)
+, d_connectCallback(
+      bdlf::MemFnUtil::memFn(&CoroutineDatagramSocket::processConnect, this),
+      datagramSocket->strand(),
+      basicAllocator)
+, d_sendOperation()
+, d_sendResult_p(0)
+, d_sendCallback(
+      bdlf::MemFnUtil::memFn(&CoroutineDatagramSocket::processSend, this),
+      datagramSocket->strand(),
+      basicAllocator)
+, d_receiveOperation()
+, d_receiveResult_p(0)
+, d_receiveCallback(
+      bdlf::MemFnUtil::memFn(&CoroutineDatagramSocket::processReceive, this),
+      datagramSocket->strand(),
+      basicAllocator)
+, d_closeOperation()
+, d_closeCallback(
+      bdlf::MemFnUtil::memFn(&CoroutineDatagramSocket::processClose, this),
+      datagramSocket->strand(),
+      basicAllocator)
+, d_timer(datagramSocket.get(), datagramSocket->strand(), basicAllocator)
+{
+}
+
+CoroutineDatagramSocket::~CoroutineDatagramSocket()
+{
+}
+
+ntci::CoroutineAwaitable CoroutineDatagramSocket::connect(
+    ntci::ConnectResult*        result,
+    const ntsa::Endpoint&       endpoint,
+    const ntca::ConnectOptions& options)
+{
+    d_connectResult_p = result;
+    d_connectOperation.start();
+
+    ntsa::Error error =
+        d_datagramSocket_sp->connect(endpoint, options, d_connectCallback);
+    if (error) {
+        d_connectOperation.complete(error);
+    }
+
+    return ntci::CoroutineAwaitable(&d_connectOperation);
+}
+
+ntci::CoroutineAwaitable CoroutineDatagramSocket::send(
+    ntci::SendResult*        result,
+    const bdlbb::Blob&       data,
+    const ntca::SendOptions& options)
+{
+    d_sendResult_p = result;
+    d_sendOperation.start();
+
+    ntsa::Error error =
+        d_datagramSocket_sp->send(data, options, d_sendCallback);
+    if (error) {
+        d_sendOperation.complete(error);
+    }
+
+    return ntci::CoroutineAwaitable(&d_sendOperation);
+}
+
+ntci::CoroutineAwaitable CoroutineDatagramSocket::send(
+    ntci::SendResult*        result,
+    const ntsa::Data&        data,
+    const ntca::SendOptions& options)
+{
+    d_sendResult_p = result;
+    d_sendOperation.start();
+
+    ntsa::Error error =
+        d_datagramSocket_sp->send(data, options, d_sendCallback);
+    if (error) {
+        d_sendOperation.complete(error);
+    }
+
+    return ntci::CoroutineAwaitable(&d_sendOperation);
+}
+
+ntci::CoroutineAwaitable CoroutineDatagramSocket::receive(
+    ntci::ReceiveResult*        result,
+    const ntca::ReceiveOptions& options)
+{
+    d_receiveResult_p = result;
+    d_receiveOperation.start();
+
+    ntsa::Error error =
+        d_datagramSocket_sp->receive(options, d_receiveCallback);
+    if (error) {
+        d_receiveOperation.complete(error);
+    }
+
+    return ntci::CoroutineAwaitable(&d_receiveOperation);
+}
+
+ntci::CoroutineAwaitable CoroutineDatagramSocket::sleep(
+    const bsls::TimeInterval& duration)
+{
+    return d_timer.sleep(duration);
+}
+
+ntci::CoroutineAwaitable CoroutineDatagramSocket::close()
+{
+    d_closeOperation.start();
+    d_datagramSocket_sp->close(d_closeCallback);
+
+    return ntci::CoroutineAwaitable(&d_closeOperation);
+}
+
+const bsl::shared_ptr<ntci::DatagramSocket>& CoroutineDatagramSocket::
+    datagramSocket() const
+{
+    return d_datagramSocket_sp;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif  // NTCI_COROUTINE_ENABLED
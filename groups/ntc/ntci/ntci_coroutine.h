@@ -0,0 +1,619 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCI_COROUTINE
+#define INCLUDED_NTCI_COROUTINE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntca_acceptoptions.h>
+#include <ntca_connectoptions.h>
+#include <ntca_receiveoptions.h>
+#include <ntca_sendoptions.h>
+#include <ntca_upgradeevent.h>
+#include <ntca_upgradeoptions.h>
+#include <ntccfg_platform.h>
+#include <ntci_acceptcallback.h>
+#include <ntci_acceptresult.h>
+#include <ntci_closecallback.h>
+#include <ntci_connectcallback.h>
+#include <ntci_connectresult.h>
+#include <ntci_datagramsocket.h>
+#include <ntci_listenersocket.h>
+#include <ntci_receivecallback.h>
+#include <ntci_receiveresult.h>
+#include <ntci_sendcallback.h>
+#include <ntci_sendresult.h>
+#include <ntci_strand.h>
+#include <ntci_streamsocket.h>
+#include <ntci_timer.h>
+#include <ntci_timercallback.h>
+#include <ntci_timerfactory.h>
+#include <ntci_upgradecallback.h>
+#include <ntcscm_version.h>
+#include <ntsa_data.h>
+#include <ntsa_endpoint.h>
+#include <ntsa_error.h>
+#include <bdlbb_blob.h>
+#include <bsls_atomic.h>
+#include <bsls_timeinterval.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+
+// Coroutines are available only when enabled by the build configuration and
+// supported by both the compiler and the standard library.
+#if NTC_BUILD_WITH_COROUTINES
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define NTCI_COROUTINE_ENABLED 1
+#endif
+#endif
+#endif
+
+#ifndef NTCI_COROUTINE_ENABLED
+#define NTCI_COROUTINE_ENABLED 0
+#endif
+
+#if NTCI_COROUTINE_ENABLED
+#include <coroutine>
+#endif
+
+#if NTCI_COROUTINE_ENABLED
+
+namespace BloombergLP {
+namespace ntci {
+
+/// @internal @brief
+/// Provide the state of an asynchronous operation awaited by a coroutine.
+///
+/// @details
+/// An operation is started, then completed exactly once, typically by the
+/// callback of the asynchronous operation, and finally finished by the
+/// coroutine awaiting its completion. The coroutine is suspended only if the
+/// operation has not completed by the time the coroutine awaits it, in
+/// which case the coroutine is resumed by the thread that completes the
+/// operation. An operation may be restarted once finished, so that the
+/// state of an operation is reused by each await and no memory is allocated
+/// to await the operation.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntci_operation_coroutine
+class CoroutineOperation
+{
+    /// Enumerate the states of an operation.
+    enum State {
+        /// The operation is not started.
+        e_IDLE = 0,
+
+        /// The operation is started and has not completed.
+        e_PENDING = 1,
+
+        /// The operation has not completed and a coroutine is suspended
+        /// awaiting its completion.
+        e_SUSPENDED = 2,
+
+        /// The operation has completed.
+        e_COMPLETE = 3
+    };
+
+    bsls::AtomicInt         d_state;
+    std::coroutine_handle<> d_handle;
+    ntsa::Error             d_error;
+
+  private:
+    CoroutineOperation(const CoroutineOperation&) BSLS_KEYWORD_DELETED;
+    CoroutineOperation& operator=(const CoroutineOperation&)
+        BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new operation that is not started.
+    CoroutineOperation();
+
+    /// Destroy this object.
+    ~CoroutineOperation();
+
+    /// Start the operation. The behavior is undefined unless the operation
+    /// is not started or has been finished.
+    void start();
+
+    /// Complete the operation with the specified 'error'. If a coroutine is
+    /// suspended awaiting the completion of the operation, resume that
+    /// coroutine on the calling thread before this function returns. The
+    /// behavior is undefined unless the operation is started and has not
+    /// completed.
+    void complete(const ntsa::Error& error);
+
+    /// Suspend the coroutine identified by the specified 'handle' until the
+    /// operation completes. Return true if the coroutine is suspended, or
+    /// false if the operation has already completed, in which case the
+    /// coroutine should continue without suspending.
+    bool suspend(std::coroutine_handle<> handle);
+
+    /// Finish the completed operation so that it may be started again.
+    /// Return the error with which the operation completed.
+    ntsa::Error finish();
+
+    /// Return true if the operation is started and has not been finished,
+    /// otherwise return false.
+    bool isPending() const;
+
+    /// Return true if the operation has completed, otherwise return false.
+    bool isComplete() const;
+};
+
+/// @internal @brief
+/// Provide an awaitable asynchronous operation.
+///
+/// @details
+/// Provide an object that suspends a coroutine that awaits it until the
+/// operation completes, and results in the error with which the operation
+/// completed. An awaitable should be awaited immediately after it is
+/// created, and awaited at most once.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntci_operation_coroutine
+class CoroutineAwaitable
+{
+    ntci::CoroutineOperation* d_operation_p;
+
+  public:
+    /// Create a new awaitable for the specified started 'operation'.
+    explicit CoroutineAwaitable(ntci::CoroutineOperation* operation);
+
+    /// Return true if the operation has completed, so the awaiting
+    /// coroutine need not be suspended, otherwise return false.
+    bool await_ready() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Suspend the coroutine identified by the specified 'handle' until the
+    /// operation completes. Return true if the coroutine is suspended, or
+    /// false if the operation completed in the meantime.
+    bool await_suspend(std::coroutine_handle<> handle) BSLS_KEYWORD_NOEXCEPT;
+
+    /// Finish the operation and return the error with which it completed.
+    ntsa::Error await_resume() BSLS_KEYWORD_NOEXCEPT;
+};
+
+/// @internal @brief
+/// Provide an awaitable sleep driven by a timer.
+///
+/// @details
+/// Provide a timer, created once from a timer factory, that may be
+/// repeatedly scheduled to resume a coroutine after a duration elapses.
+/// The coroutine is resumed on the strand of the timer, if any.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntci_operation_coroutine
+class CoroutineTimer
+{
+    ntci::CoroutineOperation     d_operation;
+    bsl::shared_ptr<ntci::Timer> d_timer_sp;
+
+  private:
+    CoroutineTimer(const CoroutineTimer&) BSLS_KEYWORD_DELETED;
+    CoroutineTimer& operator=(const CoroutineTimer&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Process the specified 'event' announced by the specified 'timer'.
+    void processTimer(const bsl::shared_ptr<ntci::Timer>& timer,
+                      const ntca::TimerEvent&             event);
+
+  public:
+    /// Create a new coroutine timer created by the specified 'timerFactory'
+    /// whose events are announced on the specified 'strand'. Optionally
+    /// specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
+    CoroutineTimer(ntci::TimerFactory*                  timerFactory,
+                   const bsl::shared_ptr<ntci::Strand>& strand,
+                   bslma::Allocator*                    basicAllocator = 0);
+
+    /// Close the timer and destroy this object. The behavior is undefined
+    /// if a coroutine is suspended awaiting this timer.
+    ~CoroutineTimer();
+
+    /// Return an awaitable that resumes the awaiting coroutine once the
+    /// specified 'duration' elapses. The awaitable results in the error,
+    /// notably 'ntsa::Error::e_CANCELLED' if the sleep is cancelled.
+    ntci::CoroutineAwaitable sleep(const bsls::TimeInterval& duration);
+
+    /// Cancel the pending sleep, if any.
+    void cancel();
+};
+
+/// Provide coroutine awaitables for the asynchronous operations of a stream
+/// socket.
+///
+/// @details
+/// Provide awaitable 'connect', 'upgrade', 'send', 'receive', and 'sleep'
+/// operations for a stream socket, for use in C++20 coroutines. The callback
+/// of each kind of operation is created once, when this object is created,
+/// and shared by each operation of that kind, so that no memory is
+/// allocated to await an operation. Each callback is invoked on the strand
+/// of the socket, if any, and resumes the awaiting coroutine directly on that
+/// strand.
+///
+/// At most one operation of each kind may be pending at a time, and this
+/// object must outlive each pending operation. The result of each operation
+/// is loaded into the result object specified by the caller, which must
+/// remain valid until the operation completes.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @par Usage Example
+/// The following example illustrates how to send and receive data from a
+/// coroutine. Note that the coroutine return type, 'Task', is supplied by
+/// the user.
+///
+///     Task echo(bsl::shared_ptr<ntci::StreamSocket> streamSocket)
+///     {
+///         ntci::CoroutineStreamSocket socket(streamSocket);
+///
+///         while (true) {
+///             ntci::ReceiveResult receiveResult;
+///             ntca::ReceiveOptions receiveOptions;
+///             receiveOptions.setMinSize(1);
+///             receiveOptions.setMaxSize(1024);
+///
+///             ntsa::Error error =
+///                 co_await socket.receive(&receiveResult, receiveOptions);
+///             if (error) {
+///                 break;
+///             }
+///
+///             ntci::SendResult sendResult;
+///             error = co_await socket.send(&sendResult,
+///                                          *receiveResult.data(),
+///                                          ntca::SendOptions());
+///             if (error) {
+///                 break;
+///             }
+///         }
+///
+///         co_await socket.close();
+///     }
+///
+/// @ingroup module_ntci_operation_coroutine
+class CoroutineStreamSocket
+{
+    bsl::shared_ptr<ntci::StreamSocket> d_streamSocket_sp;
+    ntci::CoroutineOperation            d_connectOperation;
+    ntci::ConnectResult*                d_connectResult_p;
+    ntci::ConnectCallback               d_connectCallback;
+    ntci::CoroutineOperation            d_upgradeOperation;
+    ntca::UpgradeEvent*                 d_upgradeResult_p;
+    ntci::UpgradeCallback               d_upgradeCallback;
+    ntci::CoroutineOperation            d_sendOperation;
+    ntci::SendResult*                   d_sendResult_p;
+    ntci::SendCallback                  d_sendCallback;
+    ntci::CoroutineOperation            d_receiveOperation;
+    ntci::ReceiveResult*                d_receiveResult_p;
+    ntci::ReceiveCallback               d_receiveCallback;
+    ntci::CoroutineOperation            d_closeOperation;
+    ntci::CloseCallback                 d_closeCallback;
+    ntci::CoroutineTimer                d_timer;
+
+  private:
+    CoroutineStreamSocket(const CoroutineStreamSocket&) BSLS_KEYWORD_DELETED;
+    CoroutineStreamSocket& operator=(const CoroutineStreamSocket&)
+        BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Process the completion of a connect operation by the specified
+    /// 'connector' according to the specified 'event'.
+    void processConnect(const bsl::shared_ptr<ntci::Connector>& connector,
+                        const ntca::ConnectEvent&               event);
+
+    /// Process the completion of an upgrade operation by the specified
+    /// 'upgradable' according to the specified 'event'.
+    void processUpgrade(const bsl::shared_ptr<ntci::Upgradable>& upgradable,
+                        const ntca::UpgradeEvent&                event);
+
+    /// Process the completion of a send operation by the specified 'sender'
+    /// according to the specified 'event'.
+    void processSend(const bsl::shared_ptr<ntci::Sender>& sender,
+                     const ntca::SendEvent&               event);
+
+    /// Process the completion of a receive operation by the specified
+    /// 'receiver' of the specified 'data' according to the specified
+    /// 'event'.
+    void processReceive(const bsl::shared_ptr<ntci::Receiver>& receiver,
+                        const bsl::shared_ptr<bdlbb::Blob>&    data,
+                        const ntca::ReceiveEvent&              event);
+
+    /// Process the completion of a close operation.
+    void processClose();
+
+  public:
+    /// Create a new coroutine interface to the specified 'streamSocket'.
+    /// Optionally specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
+    explicit CoroutineStreamSocket(
+        const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+        bslma::Allocator*                          basicAllocator = 0);
+
+    /// Destroy this object. The behavior is undefined if any operation is
+    /// pending. Note that the stream socket is not closed.
+    ~CoroutineStreamSocket();
+
+    /// Return an awaitable that connects to the specified 'endpoint'
+    /// according to the specified 'options', loading the result into the
+    /// specified 'result'. The awaitable results in the error. Note that
+    /// the awaiting coroutine is resumed once the connection is established
+    /// or after the last connection attempt fails.
+    ntci::CoroutineAwaitable connect(ntci::ConnectResult*        result,
+                                     const ntsa::Endpoint&       endpoint,
+                                     const ntca::ConnectOptions& options);
+
+    /// Return an awaitable that connects to the resolution of the specified
+    /// 'name' according to the specified 'options', loading the result
+    /// into the specified 'result'. The awaitable results in the error.
+    ntci::CoroutineAwaitable connect(ntci::ConnectResult*        result,
+                                     const bsl::string&          name,
+                                     const ntca::ConnectOptions& options);
+
+    /// Return an awaitable that upgrades from unencrypted to encrypted
+    /// communication using the specified 'encryptionClient' according to
+    /// the specified 'options', loading the result into the specified
+    /// 'result'. The awaitable results in the error.
+    ntci::CoroutineAwaitable upgrade(
+        ntca::UpgradeEvent*                            result,
+        const bsl::shared_ptr<ntci::EncryptionClient>& encryptionClient,
+        const ntca::UpgradeOptions&                    options);
+
+    /// Return an awaitable that upgrades from unencrypted to encrypted
+    /// communication using the specified 'encryptionServer' according to
+    /// the specified 'options', loading the result into the specified
+    /// 'result'. The awaitable results in the error.
+    ntci::CoroutineAwaitable upgrade(
+        ntca::UpgradeEvent*                            result,
+        const bsl::shared_ptr<ntci::EncryptionServer>& encryptionServer,
+        const ntca::UpgradeOptions&                    options);
+
+    /// Return an awaitable that sends the specified 'data' according to the
+    /// specified 'options', loading the result into the specified 'result'.
+    /// The awaitable results in the error.
+    ntci::CoroutineAwaitable send(ntci::SendResult*        result,
+                                  const bdlbb::Blob&       data,
+                                  const ntca::SendOptions& options);
+
+    /// Return an awaitable that sends the specified 'data' according to the
+    /// specified 'options', loading the result into the specified 'result'.
+    /// The awaitable results in the error.
+    ntci::CoroutineAwaitable send(ntci::SendResult*        result,
+                                  const ntsa::Data&        data,
+                                  const ntca::SendOptions& options);
+
+    /// Return an awaitable that receives data according to the specified
+    /// 'options', loading the result into the specified 'result'. The
+    /// awaitable results in the error, notably 'ntsa::Error::e_EOF' if the
+    /// peer has shut down the connection.
+    ntci::CoroutineAwaitable receive(ntci::ReceiveResult*        result,
+                                     const ntca::ReceiveOptions& options);
+
+    /// Return an awaitable that resumes the awaiting coroutine once the
+    /// specified 'duration' elapses. The awaitable results in the error.
+    ntci::CoroutineAwaitable sleep(const bsls::TimeInterval& duration);
+
+    /// Return an awaitable that closes the socket. The awaitable results in
+    /// the error.
+    ntci::CoroutineAwaitable close();
+
+    /// Return the stream socket.
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket() const;
+};
+
+/// Provide coroutine awaitables for the asynchronous operations of a
+/// listener socket.
+///
+/// @details
+/// Provide awaitable 'accept' and 'sleep' operations for a listener socket,
+/// for use in C++20 coroutines. The callback of each kind of operation is
+/// created once, when this object is created, and shared by each operation
+/// of that kind, so that no memory is allocated to await an operation. Each
+/// callback is invoked on the strand of the socket, if any, and resumes the
+/// awaiting coroutine directly on that strand.
+///
+/// At most one operation of each kind may be pending at a time, and this
+/// object must outlive each pending operation.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntci_operation_coroutine
+class CoroutineListenerSocket
+{
+    bsl::shared_ptr<ntci::ListenerSocket> d_listenerSocket_sp;
+    ntci::CoroutineOperation              d_acceptOperation;
+    ntci::AcceptResult*                   d_acceptResult_p;
+    ntci::AcceptCallback                  d_acceptCallback;
+    ntci::CoroutineOperation              d_closeOperation;
+    ntci::CloseCallback                   d_closeCallback;
+    ntci::CoroutineTimer                  d_timer;
+
+  private:
+    CoroutineListenerSocket(const CoroutineListenerSocket&)
+        BSLS_KEYWORD_DELETED;
+    CoroutineListenerSocket& operator=(const CoroutineListenerSocket&)
+        BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Process the completion of an accept operation by the specified
+    /// 'acceptor' of the specified 'streamSocket' according to the
+    /// specified 'event'.
+    void processAccept(const bsl::shared_ptr<ntci::Acceptor>&     acceptor,
+                       const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+                       const ntca::AcceptEvent&                   event);
+
+    /// Process the completion of a close operation.
+    void processClose();
+
+  public:
+    /// Create a new coroutine interface to the specified 'listenerSocket'.
+    /// Optionally specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
+    explicit CoroutineListenerSocket(
+        const bsl::shared_ptr<ntci::ListenerSocket>& listenerSocket,
+        bslma::Allocator*                            basicAllocator = 0);
+
+    /// Destroy this object. The behavior is undefined if any operation is
+    /// pending. Note that the listener socket is not closed.
+    ~CoroutineListenerSocket();
+
+    /// Return an awaitable that accepts a connection according to the
+    /// specified 'options', loading the result into the specified 'result'.
+    /// The awaitable results in the error.
+    ntci::CoroutineAwaitable accept(ntci::AcceptResult*        result,
+                                    const ntca::AcceptOptions& options);
+
+    /// Return an awaitable that resumes the awaiting coroutine once the
+    /// specified 'duration' elapses. The awaitable results in the error.
+    ntci::CoroutineAwaitable sleep(const bsls::TimeInterval& duration);
+
+    /// Return an awaitable that closes the socket. The awaitable results in
+    /// the error.
+    ntci::CoroutineAwaitable close();
+
+    /// Return the listener socket.
+    const bsl::shared_ptr<ntci::ListenerSocket>& listenerSocket() const;
+};
+
+/// Provide coroutine awaitables for the asynchronous operations of a
+/// datagram socket.
+///
+/// @details
+/// Provide awaitable 'connect', 'send', 'receive', and 'sleep' operations
+/// for a datagram socket, for use in C++20 coroutines. The callback of each
+/// kind of operation is created once, when this object is created, and
+/// shared by each operation of that kind, so that no memory is allocated to
+/// await an operation. Each callback is invoked on the strand of the socket,
+/// if any, and resumes the awaiting coroutine directly on that strand.
+///
+/// At most one operation of each kind may be pending at a time, and this
+/// object must outlive each pending operation.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntci_operation_coroutine
+class CoroutineDatagramSocket
+{
+    bsl::shared_ptr<ntci::DatagramSocket> d_datagramSocket_sp;
+    ntci::CoroutineOperation              d_connectOperation;
+    ntci::ConnectResult*                  d_connectResult_p;
+    ntci::ConnectCallback                 d_connectCallback;
+    ntci::CoroutineOperation              d_sendOperation;
+    ntci::SendResult*                     d_sendResult_p;
+    ntci::SendCallback                    d_sendCallback;
+    ntci::CoroutineOperation              d_receiveOperation;
+    ntci::ReceiveResult*                  d_receiveResult_p;
+    ntci::ReceiveCallback                 d_receiveCallback;
+    ntci::CoroutineOperation              d_closeOperation;
+    ntci::CloseCallback                   d_closeCallback;
+    ntci::CoroutineTimer                  d_timer;
+
+  private:
+    CoroutineDatagramSocket(const CoroutineDatagramSocket&)
+        BSLS_KEYWORD_DELETED;
+    CoroutineDatagramSocket& operator=(const CoroutineDatagramSocket&)
+        BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Process the completion of a connect operation by the specified
+    /// 'connector' according to the specified 'event'.
+    void processConnect(const bsl::shared_ptr<ntci::Connector>& connector,
+                        const ntca::ConnectEvent&               event);
+
+    /// Process the completion of a send operation by the specified 'sender'
+    /// according to the specified 'event'.
+    void processSend(const bsl::shared_ptr<ntci::Sender>& sender,
+                     const ntca::SendEvent&               event);
+
+    /// Process the completion of a receive operation by the specified
+    /// 'receiver' of the specified 'data' according to the specified
+    /// 'event'.
+    void processReceive(const bsl::shared_ptr<ntci::Receiver>& receiver,
+                        const bsl::shared_ptr<bdlbb::Blob>&    data,
+                        const ntca::ReceiveEvent&              event);
+
+    /// Process the completion of a close operation.
+    void processClose();
+
+  public:
+    /// Create a new coroutine interface to the specified 'datagramSocket'.
+    /// Optionally specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
+    explicit CoroutineDatagramSocket(
+        const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
+        bslma::Allocator*                            basicAllocator = 0);
+
+    /// Destroy this object. The behavior is undefined if any operation is
+    /// pending. Note that the datagram socket is not closed.
+    ~CoroutineDatagramSocket();
+
+    /// Return an awaitable that connects to the specified 'endpoint'
+    /// according to the specified 'options', loading the result into the
+    /// specified 'result'. The awaitable results in the error.
+    ntci::CoroutineAwaitable connect(ntci::ConnectResult*        result,
+                                     const ntsa::Endpoint&       endpoint,
+                                     const ntca::ConnectOptions& options);
+
+    /// Return an awaitable that sends the specified 'data' according to the
+    /// specified 'options', loading the result into the specified 'result'.
+    /// The awaitable results in the error.
+    ntci::CoroutineAwaitable send(ntci::SendResult*        result,
+                                  const bdlbb::Blob&       data,
+                                  const ntca::SendOptions& options);
+
+    /// Return an awaitable that sends the specified 'data' according to the
+    /// specified 'options', loading the result into the specified 'result'.
+    /// The awaitable results in the error.
+    ntci::CoroutineAwaitable send(ntci::SendResult*        result,
+                                  const ntsa::Data&        data,
+                                  const ntca::SendOptions& options);
+
+    /// Return an awaitable that receives a datagram according to the
+    /// specified 'options', loading the result into the specified 'result'.
+    /// The awaitable results in the error.
+    ntci::CoroutineAwaitable receive(ntci::ReceiveResult*        result,
+                                     const ntca::ReceiveOptions& options);
+
+    /// Return an awaitable that resumes the awaiting coroutine once the
+    /// specified 'duration' elapses. The awaitable results in the error.
+    ntci::CoroutineAwaitable sleep(const bsls::TimeInterval& duration);
+
+    /// Return an awaitable that closes the socket. The awaitable results in
+    /// the error.
+    ntci::CoroutineAwaitable close();
+
+    /// Return the datagram socket.
+    const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket() const;
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif  // NTCI_COROUTINE_ENABLED
+#endif
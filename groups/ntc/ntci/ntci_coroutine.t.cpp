@@ -0,0 +1,148 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntci_coroutine.h>
+
+#include <ntccfg_test.h>
+
+#include <bsl_cstdlib.h>
+
+using namespace BloombergLP;
+
+#if NTCI_COROUTINE_ENABLED
+
+namespace test {
+
+// Provide a coroutine that starts eagerly and destroys itself once it
+// returns.
+struct Task {
+    struct promise_type {
+        Task get_return_object()
+        {
+            return Task();
+        }
+
+        std::suspend_never initial_suspend() noexcept
+        {
+            return std::suspend_never();
+        }
+
+        std::suspend_never final_suspend() noexcept
+        {
+            return std::suspend_never();
+        }
+
+        void return_void()
+        {
+        }
+
+        void unhandled_exception()
+        {
+            bsl::abort();
+        }
+    };
+};
+
+// Await the specified 'operation' the specified 'count' number of times,
+// loading the error of each completion into the specified 'error' and
+// incrementing the specified 'numCompleted' after each completion.
+Task awaitOperation(ntci::CoroutineOperation* operation,
+                    bsl::size_t               count,
+                    ntsa::Error*              error,
+                    bsl::size_t*              numCompleted)
+{
+    for (bsl::size_t i = 0; i < count; ++i) {
+        if (!operation->isPending()) {
+            operation->start();
+        }
+
+        *error = co_await ntci::CoroutineAwaitable(operation);
+        ++(*numCompleted);
+    }
+}
+
+}  // close namespace test
+
+#endif
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: An operation that completes before it is awaited does not
+    // suspend the awaiting coroutine.
+
+#if NTCI_COROUTINE_ENABLED
+
+    ntci::CoroutineOperation operation;
+
+    operation.start();
+    NTCCFG_TEST_TRUE(operation.isPending());
+    NTCCFG_TEST_FALSE(operation.isComplete());
+
+    operation.complete(ntsa::Error(ntsa::Error::e_EOF));
+    NTCCFG_TEST_TRUE(operation.isComplete());
+
+    ntsa::Error error;
+    bsl::size_t numCompleted = 0;
+
+    test::awaitOperation(&operation, 1, &error, &numCompleted);
+
+    NTCCFG_TEST_EQ(numCompleted, 1);
+    NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_EOF));
+    NTCCFG_TEST_FALSE(operation.isPending());
+
+#endif
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: An operation that completes after it is awaited resumes the
+    // suspended coroutine on the completing thread, and the operation may be
+    // awaited again once it is finished.
+
+#if NTCI_COROUTINE_ENABLED
+
+    ntci::CoroutineOperation operation;
+
+    ntsa::Error error;
+    bsl::size_t numCompleted = 0;
+
+    test::awaitOperation(&operation, 2, &error, &numCompleted);
+
+    NTCCFG_TEST_EQ(numCompleted, 0);
+    NTCCFG_TEST_TRUE(operation.isPending());
+    NTCCFG_TEST_FALSE(operation.isComplete());
+
+    operation.complete(ntsa::Error());
+
+    NTCCFG_TEST_EQ(numCompleted, 1);
+    NTCCFG_TEST_OK(error);
+    NTCCFG_TEST_TRUE(operation.isPending());
+    NTCCFG_TEST_FALSE(operation.isComplete());
+
+    operation.complete(ntsa::Error(ntsa::Error::e_CANCELLED));
+
+    NTCCFG_TEST_EQ(numCompleted, 2);
+    NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_CANCELLED));
+    NTCCFG_TEST_FALSE(operation.isPending());
+
+#endif
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+}
+NTCCFG_TEST_DRIVER_END;
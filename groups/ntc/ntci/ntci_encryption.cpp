@@ -25,6 +25,11 @@ Encryption::~Encryption()
 {
 }
 
+void Encryption::setRemoteEndpoint(const ntsa::Endpoint& endpoint)
+{
+    NTCCFG_WARNING_UNUSED(endpoint);
+}
+
 ntsa::Error Encryption::initiateHandshake(
         const HandshakeCallback& callback)
 {
@@ -169,5 +174,16 @@ ntsa::Error Encryption::serverNameIndication(bsl::string* result) const
     return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
 }
 
+bool Encryption::isSessionResumed() const
+{
+    return false;
+}
+
+ntsa::Error Encryption::exportTrafficKeys(ntsa::TrafficKeys* result)
+{
+    result->reset();
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
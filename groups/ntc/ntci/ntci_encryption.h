@@ -29,7 +29,9 @@ BSLS_IDENT("$Id: $")
 #include <ntcscm_version.h>
 #include <ntsa_buffer.h>
 #include <ntsa_data.h>
+#include <ntsa_endpoint.h>
 #include <ntsa_error.h>
+#include <ntsa_traffickeys.h>
 #include <bdlbb_blob.h>
 #include <bsl_functional.h>
 #include <bsl_memory.h>
@@ -67,6 +69,13 @@ class Encryption
     /// Destroy this object.
     virtual ~Encryption();
 
+    /// Set the endpoint of the peer to the specified 'endpoint'. Note that
+    /// sessions in the client role identify the session cached for
+    /// resumption by the server name indication and the endpoint of the
+    /// peer. The behavior is undefined unless this function is called before
+    /// the handshake is initiated.
+    virtual void setRemoteEndpoint(const ntsa::Endpoint& endpoint);
+
     /// Initiate the handshake to begin the session. Invoke the specified
     /// 'callback' when the handshake completes. Return the error.
     virtual ntsa::Error initiateHandshake(
@@ -171,6 +180,26 @@ class Encryption
     /// Return the error, for example, when no server name indication is 
     /// explicitly requested or accepted. 
     virtual ntsa::Error serverNameIndication(bsl::string* result) const;
+
+    /// Return true if the handshake resumed a session previously
+    /// established with the peer, otherwise return false.
+    virtual bool isSessionResumed() const;
+
+    /// Load into the specified 'result' the traffic keys negotiated by the
+    /// handshake and the sequence numbers of the next records sent and
+    /// received, so that the session may be continued by the operating
+    /// system. Return the error. Return 'e_WOULD_BLOCK' if the session has
+    /// buffered incoming cipher text that does not yet form a complete
+    /// record, or has outgoing cipher text that has not yet been popped,
+    /// in which case the export may be retried once that cipher text is
+    /// processed. Return 'e_NOT_IMPLEMENTED' if the keys cannot be exported,
+    /// for example, because the handshake is not finished or the negotiated
+    /// cipher is not supported by the operating system. Note that after the
+    /// keys are successfully exported, records must no longer be processed
+    /// by this session, and that the peer must not send post-handshake
+    /// messages other than session tickets, such as TLS 1.3 key updates,
+    /// that cannot be processed without this session.
+    virtual ntsa::Error exportTrafficKeys(ntsa::TrafficKeys* result);
 };
 
 }  // end namespace ntci
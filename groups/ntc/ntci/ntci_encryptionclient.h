@@ -21,6 +21,7 @@ BSLS_IDENT("$Id: $")
 
 #include <ntccfg_platform.h>
 #include <ntci_encryption.h>
+#include <ntci_encryptionsessioncache.h>
 #include <ntcscm_version.h>
 #include <bsl_iosfwd.h>
 #include <bsl_memory.h>
@@ -54,6 +55,19 @@ class EncryptionClient
     virtual ntsa::Error createEncryption(
         bsl::shared_ptr<ntci::Encryption>* result,
         bslma::Allocator*                  basicAllocator = 0) = 0;
+
+    /// Cache the sessions established by each encryption session
+    /// subsequently created by this object in the specified 'sessionCache',
+    /// so that handshakes with the same peer may resume a previous session.
+    /// If 'sessionCache' is null, disable session caching. Return the
+    /// error.
+    virtual ntsa::Error setSessionCache(
+        const bsl::shared_ptr<ntci::EncryptionSessionCache>& sessionCache);
+
+    /// Return the cache of sessions used by each encryption session created
+    /// by this object, if any.
+    virtual bsl::shared_ptr<ntci::EncryptionSessionCache> sessionCache()
+        const;
 };
 
 }  // end namespace ntci
@@ -25,5 +25,18 @@ EncryptionServer::~EncryptionServer()
 {
 }
 
+ntsa::Error EncryptionServer::setSessionCache(
+    const bsl::shared_ptr<ntci::EncryptionSessionCache>& sessionCache)
+{
+    NTCCFG_WARNING_UNUSED(sessionCache);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+bsl::shared_ptr<ntci::EncryptionSessionCache> EncryptionServer::sessionCache()
+    const
+{
+    return bsl::shared_ptr<ntci::EncryptionSessionCache>();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
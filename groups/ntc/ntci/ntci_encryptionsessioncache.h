@@ -0,0 +1,83 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCI_ENCRYPTIONSESSIONCACHE
+#define INCLUDED_NTCI_ENCRYPTIONSESSIONCACHE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_platform.h>
+#include <ntcscm_version.h>
+#include <ntsa_error.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ntci {
+
+/// Provide an interface to a cache of encryption sessions.
+///
+/// @details
+/// This class provides a mechanism to store the state of established
+/// encryption sessions so that subsequent handshakes may resume a previous
+/// session instead of performing a full handshake. Encryption clients
+/// identify each session by the server name indication and the endpoint of
+/// the server; encryption servers identify each session by its session
+/// identifier or by the key protecting its session ticket. The state of each
+/// session is opaque to the cache: it is encoded and decoded by the
+/// encryption driver that created the session. Implementations are expected
+/// to bound the number of sessions they store.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntci_encryption
+class EncryptionSessionCache
+{
+  public:
+    /// Destroy this object.
+    virtual ~EncryptionSessionCache();
+
+    /// Store the specified encoded 'session' identified by the specified
+    /// 'key', replacing any session previously stored under 'key'. Return
+    /// the error.
+    virtual ntsa::Error store(const bsl::string&       key,
+                              const bsl::vector<char>& session) = 0;
+
+    /// Load into the specified 'result' the encoded session identified by
+    /// the specified 'key'. Return the error, notably 'ntsa::Error::e_EOF'
+    /// if no session is stored under 'key'.
+    virtual ntsa::Error load(bsl::vector<char>* result,
+                             const bsl::string& key) = 0;
+
+    /// Remove the session identified by the specified 'key', e.g. because
+    /// the peer refused to resume it. Return the error, notably
+    /// 'ntsa::Error::e_EOF' if no session is stored under 'key'.
+    virtual ntsa::Error remove(const bsl::string& key) = 0;
+
+    /// Remove every session stored in the cache.
+    virtual void clear() = 0;
+
+    /// Return the number of sessions stored in the cache.
+    virtual bsl::size_t size() const = 0;
+
+    /// Return the maximum number of sessions stored in the cache.
+    virtual bsl::size_t capacity() const = 0;
+};
+
+}  // end namespace ntci
+}  // end namespace BloombergLP
+#endif
@@ -18,12 +18,41 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(ntci_executor_cpp, "$Id$ $CSID$")
 
+#include <bdlf_bind.h>
+#include <bslma_allocator.h>
+#include <bslmf_movableref.h>
+#include <bsls_assert.h>
+
 namespace BloombergLP {
 namespace ntci {
 
+namespace {
+
+// Invoke the specified 'functor'.
+void invokeShared(const bsl::shared_ptr<Executor::InplaceFunctor>& functor)
+{
+    (*functor)();
+}
+
+}  // close unnamed namespace
+
 Executor::~Executor()
 {
 }
 
+void Executor::executeInplace(InplaceFunctor* functor)
+{
+    BSLS_ASSERT(*functor);
+
+    bslma::Allocator* allocator = functor->allocator();
+
+    bsl::shared_ptr<InplaceFunctor> shared;
+    shared.createInplace(allocator,
+                         bslmf::MovableRefUtil::move(*functor),
+                         allocator);
+
+    this->execute(bdlf::BindUtil::bind(&invokeShared, shared));
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -43,6 +43,11 @@ class Executor
     /// This typedef defines a sequence of functors.
     typedef bsl::list<Functor> FunctorSequence;
 
+    /// Define a type alias for a deferred function that is moved, rather
+    /// than copied, and that stores its bound arguments without allocating
+    /// memory unless they exceed the capacity of the functor.
+    typedef ntccfg::InplaceFunctor<> InplaceFunctor;
+
     /// Destroy this object.
     virtual ~Executor();
 
@@ -54,6 +59,15 @@ class Executor
     /// 'functorSequence'.
     virtual void moveAndExecute(FunctorSequence* functorSequence,
                                 const Functor&   functor) = 0;
+
+    /// Defer the execution of the callable object stored by the specified
+    /// 'functor', leaving the 'functor' empty. The behavior is undefined
+    /// unless the 'functor' stores a callable object. Note that the default
+    /// implementation wraps the 'functor' in a 'Functor' and calls
+    /// 'execute'; derived classes that queue functors themselves should
+    /// override this function to store the 'functor' without allocating
+    /// memory.
+    virtual void executeInplace(InplaceFunctor* functor);
 };
 
 }  // close package namespace
@@ -0,0 +1,135 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntci_futurepool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntci_futurepool_cpp, "$Id$ $CSID$")
+
+#include <bslmt_threadutil.h>
+#include <bsls_assert.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ntci {
+
+namespace {
+
+// The maximum number of futures cached by each thread.
+const bsl::size_t k_MAX_CACHED = 32;
+
+// Describe a future cached by a thread.
+struct Entry {
+    const void*           d_type;
+    bslma::Allocator*     d_allocator_p;
+    bsl::shared_ptr<void> d_future_sp;
+};
+
+// Define a type alias for the futures cached by a thread.
+typedef bsl::vector<Entry> Cache;
+
+// Destroy the specified 'cache' of an exiting thread.
+extern "C" void ntci_futurepool_destroyCache(void* cache)
+{
+    bslma::Allocator* allocator = bslma::Default::globalAllocator();
+    allocator->deleteObject(static_cast<Cache*>(cache));
+}
+
+bslmt::ThreadUtil::Key s_key;
+
+struct Initializer {
+    Initializer()
+    {
+        int rc = bslmt::ThreadUtil::createKey(&s_key,
+                                              &ntci_futurepool_destroyCache);
+        BSLS_ASSERT_OPT(rc == 0);
+    }
+} s_initializer;
+
+// Return the cache of the calling thread, or 0 if the calling thread has no
+// cache.
+Cache* getCache()
+{
+    return static_cast<Cache*>(
+        const_cast<void*>(bslmt::ThreadUtil::getSpecific(s_key)));
+}
+
+// Return the cache of the calling thread, creating it if necessary.
+Cache* makeCache()
+{
+    Cache* cache = getCache();
+    if (cache == 0) {
+        bslma::Allocator* allocator = bslma::Default::globalAllocator();
+
+        cache = new (*allocator) Cache(allocator);
+        cache->reserve(k_MAX_CACHED);
+
+        int rc = bslmt::ThreadUtil::setSpecific(s_key, cache);
+        BSLS_ASSERT_OPT(rc == 0);
+    }
+
+    return cache;
+}
+
+}  // close unnamed namespace
+
+void FuturePoolUtil::acquire(bsl::shared_ptr<void>* result,
+                             const void*            type,
+                             Creator                creator,
+                             bslma::Allocator*      allocator)
+{
+    Cache* cache = makeCache();
+
+    for (Cache::iterator it = cache->begin(); it != cache->end(); ++it) {
+        if (it->d_type == type && it->d_allocator_p == allocator &&
+            it->d_future_sp.use_count() == 1)
+        {
+            *result = it->d_future_sp;
+            return;
+        }
+    }
+
+    *result = creator(allocator);
+
+    if (cache->size() < k_MAX_CACHED) {
+        Entry entry;
+        entry.d_type        = type;
+        entry.d_allocator_p = allocator;
+        entry.d_future_sp   = *result;
+
+        cache->push_back(entry);
+    }
+}
+
+void FuturePoolUtil::clear()
+{
+    Cache* cache = getCache();
+    if (cache != 0) {
+        cache->clear();
+    }
+}
+
+bsl::size_t FuturePoolUtil::size()
+{
+    Cache* cache = getCache();
+    if (cache != 0) {
+        return cache->size();
+    }
+
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
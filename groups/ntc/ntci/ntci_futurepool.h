@@ -0,0 +1,162 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCI_FUTUREPOOL
+#define INCLUDED_NTCI_FUTUREPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_platform.h>
+#include <ntcscm_version.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bsl_memory.h>
+
+namespace BloombergLP {
+namespace ntci {
+
+/// @internal @brief
+/// Provide utilities to cache futures for reuse by the thread that created
+/// them.
+///
+/// @details
+/// Each thread caches at most a fixed number of futures. A cached future is
+/// available for reuse once the cache holds the only reference to it. The
+/// futures cached by a thread are destroyed when the thread exits or when
+/// the thread calls 'clear'.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntci_operation
+struct FuturePoolUtil {
+    /// Define a type alias for a function that creates a new future using
+    /// the specified 'basicAllocator' to supply memory.
+    typedef bsl::shared_ptr<void> (*Creator)(
+        bslma::Allocator* basicAllocator);
+
+    /// Load into the specified 'result' a future of the type identified by
+    /// the specified 'type' allocated by the specified 'allocator' cached
+    /// by the calling thread and no longer referenced outside the cache. If
+    /// no such future is cached, create a new future using the specified
+    /// 'creator' and cache it, if the cache of the calling thread is not
+    /// full.
+    static void acquire(bsl::shared_ptr<void>* result,
+                        const void*            type,
+                        Creator                creator,
+                        bslma::Allocator*      allocator);
+
+    /// Destroy each future cached by the calling thread that is no longer
+    /// referenced outside the cache, and release the cache's reference to
+    /// each other future cached by the calling thread.
+    static void clear();
+
+    /// Return the number of futures cached by the calling thread.
+    static bsl::size_t size();
+};
+
+/// @internal @brief
+/// Provide a per-thread pool of futures of a parameterized type.
+///
+/// @details
+/// Provide a mechanism to acquire a future of the parameterized 'FUTURE'
+/// type, e.g. 'ntci::SendFuture', that reuses a future previously acquired
+/// by the calling thread once it is no longer referenced, so that a thread
+/// that repeatedly initiates an operation and waits for its completion
+/// allocates neither a future nor its callback for each operation. Each
+/// result pushed to a future must be waited for before the future is
+/// released. If a wait fails or times out while its operation is still
+/// pending, the future must be rearmed before it is released: the result of
+/// that operation is then rejected when it arrives, rather than received by
+/// the next wait on the reused future. Note that rearming a future allocates
+/// a new callback, so only the uncommon path of a timed out wait allocates.
+/// Also note that an operation still pending keeps the results queue of its
+/// future alive, so a cached future may be destroyed, e.g. when its thread
+/// exits or calls 'FuturePoolUtil::clear', while that operation is pending.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @par Usage Example
+/// The following example illustrates how to send data synchronously using a
+/// pooled future, waiting for the send to complete until a 'deadline'.
+///
+///     bsl::shared_ptr<ntci::SendFuture> sendFuture =
+///         ntci::FuturePool<ntci::SendFuture>::acquire();
+///
+///     error = streamSocket->send(data, ntca::SendOptions(), *sendFuture);
+///     BSLS_ASSERT(!error);
+///
+///     ntci::SendResult sendResult;
+///     error = sendFuture->wait(&sendResult, deadline);
+///     if (error) {
+///         sendFuture->rearm();
+///         return error;
+///     }
+///
+/// @ingroup module_ntci_operation
+template <typename FUTURE>
+class FuturePool
+{
+    /// The object whose address identifies the type of future pooled.
+    static const char k_TYPE;
+
+  private:
+    /// Return a new future created using the specified 'basicAllocator'.
+    static bsl::shared_ptr<void> create(bslma::Allocator* basicAllocator);
+
+  public:
+    /// Return a future cached by the calling thread that is no longer
+    /// referenced, or a new future if no such future is cached. Optionally
+    /// specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used. Note that futures are only reused by acquisitions that specify
+    /// the same allocator.
+    static bsl::shared_ptr<FUTURE> acquire(
+        bslma::Allocator* basicAllocator = 0);
+};
+
+template <typename FUTURE>
+const char FuturePool<FUTURE>::k_TYPE = 0;
+
+template <typename FUTURE>
+bsl::shared_ptr<void> FuturePool<FUTURE>::create(
+    bslma::Allocator* basicAllocator)
+{
+    bsl::shared_ptr<FUTURE> future;
+    future.createInplace(basicAllocator, basicAllocator);
+
+    return future;
+}
+
+template <typename FUTURE>
+bsl::shared_ptr<FUTURE> FuturePool<FUTURE>::acquire(
+    bslma::Allocator* basicAllocator)
+{
+    bslma::Allocator* allocator = bslma::Default::allocator(basicAllocator);
+
+    bsl::shared_ptr<void> future;
+    ntci::FuturePoolUtil::acquire(&future,
+                                  &k_TYPE,
+                                  &FuturePool<FUTURE>::create,
+                                  allocator);
+
+    return bsl::static_pointer_cast<FUTURE>(future);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
@@ -0,0 +1,374 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntci_futurestate.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntci_futurestate_cpp, "$Id$ $CSID$")
+
+#include <bslmt_lockguard.h>
+#include <bslmt_threadutil.h>
+#include <bslscm_versiontag.h>
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsl_climits.h>
+
+#if NTCCFG_FUTEX_ENABLED
+#include <errno.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#if BSL_VERSION >= BSL_MAKE_VERSION(3, 80)
+#define NTCI_FUTURESTATE_TIMEOUT bslmt::Condition::e_TIMED_OUT
+#else
+#define NTCI_FUTURESTATE_TIMEOUT -1
+#endif
+
+namespace BloombergLP {
+namespace ntci {
+
+namespace {
+
+// The minimum number of iterations a thread spins waiting for a result
+// before parking.
+const int k_MIN_SPIN_LIMIT = 16;
+
+// The maximum number of iterations a thread spins waiting for a result
+// before parking.
+const int k_MAX_SPIN_LIMIT = 4096;
+
+// The number of iterations a thread spins waiting for exclusive access to
+// the storage of the results before yielding the processor.
+const int k_LOCK_SPIN_LIMIT = 64;
+
+// Hint to the processor that the calling thread is spinning.
+void relax()
+{
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    __builtin_ia32_pause();
+#endif
+#endif
+}
+
+}  // close unnamed namespace
+
+#if NTCCFG_FUTEX_ENABLED
+
+int FutureState::load() const
+{
+    return __atomic_load_n(&d_value, __ATOMIC_ACQUIRE);
+}
+
+int FutureState::compareAndSwap(int expected, int desired)
+{
+    __atomic_compare_exchange_n(&d_value,
+                                &expected,
+                                desired,
+                                false,
+                                __ATOMIC_ACQ_REL,
+                                __ATOMIC_ACQUIRE);
+    return expected;
+}
+
+void FutureState::add(int delta)
+{
+    __atomic_fetch_add(&d_value, delta, __ATOMIC_ACQ_REL);
+}
+
+bool FutureState::park(int expected, const bsls::TimeInterval* timeout)
+{
+    long rc;
+
+    if (timeout == 0) {
+        rc = syscall(SYS_futex,
+                     &d_value,
+                     FUTEX_WAIT_PRIVATE,
+                     expected,
+                     0,
+                     0,
+                     0);
+    }
+    else {
+        struct timespec deadline;
+        deadline.tv_sec  = static_cast<time_t>(timeout->seconds());
+        deadline.tv_nsec = static_cast<long>(timeout->nanoseconds());
+
+        if (deadline.tv_sec < 0 || deadline.tv_nsec < 0) {
+            return true;
+        }
+
+        rc = syscall(SYS_futex,
+                     &d_value,
+                     FUTEX_WAIT_BITSET_PRIVATE | FUTEX_CLOCK_REALTIME,
+                     expected,
+                     &deadline,
+                     0,
+                     FUTEX_BITSET_MATCH_ANY);
+    }
+
+    return rc != 0 && errno == ETIMEDOUT;
+}
+
+void FutureState::unpark()
+{
+    syscall(SYS_futex, &d_value, FUTEX_WAKE_PRIVATE, INT_MAX, 0, 0, 0);
+}
+
+#else
+
+int FutureState::load() const
+{
+    return d_value.loadAcquire();
+}
+
+int FutureState::compareAndSwap(int expected, int desired)
+{
+    return d_value.testAndSwapAcqRel(expected, desired);
+}
+
+void FutureState::add(int delta)
+{
+    d_value.addAcqRel(delta);
+}
+
+bool FutureState::park(int expected, const bsls::TimeInterval* timeout)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    while (this->load() == expected) {
+        if (timeout == 0) {
+            d_condition.wait(&d_mutex);
+        }
+        else {
+            int rc = d_condition.timedWait(&d_mutex, *timeout);
+            if (rc == NTCI_FUTURESTATE_TIMEOUT) {
+                return true;
+            }
+            else if (rc != 0) {
+                return false;
+            }
+        }
+    }
+
+    return false;
+}
+
+void FutureState::unpark()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_condition.broadcast();
+}
+
+#endif
+
+int FutureState::lock()
+{
+    int numSpins = 0;
+
+    while (true) {
+        const int state = this->load();
+        if ((state & k_LOCKED) == 0) {
+            if (this->compareAndSwap(state, state | k_LOCKED) == state) {
+                return state | k_LOCKED;
+            }
+        }
+        else if (++numSpins < k_LOCK_SPIN_LIMIT) {
+            relax();
+        }
+        else {
+            numSpins = 0;
+            bslmt::ThreadUtil::yield();
+        }
+    }
+}
+
+ntsa::Error FutureState::wait(const bsls::TimeInterval* timeout)
+{
+    const int spinLimit = d_spinLimit.loadRelaxed();
+
+    int  numSpins = 0;
+    bool parked   = false;
+    bool expired  = false;
+
+    while (true) {
+        const int state = this->load();
+
+        if (state >= k_COUNT) {
+            if ((state & k_LOCKED) != 0) {
+                relax();
+                continue;
+            }
+
+            if (this->compareAndSwap(state, state | k_LOCKED) != state) {
+                continue;
+            }
+
+            // Adapt the number of iterations spun by the next wait: spin
+            // for about twice as long as this result took to arrive, and
+            // spin less each time spinning was insufficient.
+
+            int nextSpinLimit;
+            if (parked) {
+                nextSpinLimit = spinLimit - spinLimit / 8;
+            }
+            else {
+                nextSpinLimit = spinLimit + (2 * numSpins - spinLimit) / 8;
+            }
+
+            if (nextSpinLimit < k_MIN_SPIN_LIMIT) {
+                nextSpinLimit = k_MIN_SPIN_LIMIT;
+            }
+            else if (nextSpinLimit > k_MAX_SPIN_LIMIT) {
+                nextSpinLimit = k_MAX_SPIN_LIMIT;
+            }
+
+            d_spinLimit.storeRelaxed(nextSpinLimit);
+
+            return ntsa::Error();
+        }
+
+        if (expired) {
+            return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+        }
+
+        if (!parked && numSpins < spinLimit) {
+            ++numSpins;
+            relax();
+            continue;
+        }
+
+        if ((state & k_WAITING) == 0) {
+            if (this->compareAndSwap(state, state | k_WAITING) != state) {
+                continue;
+            }
+        }
+
+        parked  = true;
+        expired = this->park(state | k_WAITING, timeout);
+    }
+}
+
+FutureState::FutureState()
+: d_value(0)
+#if !NTCCFG_FUTEX_ENABLED
+, d_mutex()
+, d_condition()
+#endif
+, d_spinLimit(k_MIN_SPIN_LIMIT * 8)
+, d_generation(0)
+{
+}
+
+FutureState::~FutureState()
+{
+    BSLS_ASSERT((this->load() & k_LOCKED) == 0);
+}
+
+bsl::size_t FutureState::beginPush()
+{
+    const int state = this->lock();
+    return static_cast<bsl::size_t>(state / k_COUNT);
+}
+
+bool FutureState::beginPush(bsl::size_t* numAvailable,
+                            unsigned int generation)
+{
+    const int state = this->lock();
+
+    // The generation is only advanced while the storage of the results is
+    // locked, so a result accepted here cannot be discarded by a concurrent
+    // reset before it is stored.
+
+    if (d_generation.loadAcquire() != generation) {
+        this->add(-k_LOCKED);
+        return false;
+    }
+
+    *numAvailable = static_cast<bsl::size_t>(state / k_COUNT);
+    return true;
+}
+
+void FutureState::endPush()
+{
+    while (true) {
+        const int state = this->load();
+        BSLS_ASSERT((state & k_LOCKED) != 0);
+
+        const int next = (state & ~(k_LOCKED | k_WAITING)) + k_COUNT;
+
+        if (this->compareAndSwap(state, next) == state) {
+            if ((state & k_WAITING) != 0) {
+                this->unpark();
+            }
+            return;
+        }
+    }
+}
+
+ntsa::Error FutureState::beginPop()
+{
+    return this->wait(0);
+}
+
+ntsa::Error FutureState::beginPop(const bsls::TimeInterval& timeout)
+{
+    return this->wait(&timeout);
+}
+
+void FutureState::endPop()
+{
+    BSLS_ASSERT((this->load() & k_LOCKED) != 0);
+    BSLS_ASSERT(this->load() >= k_COUNT);
+
+    this->add(-(k_LOCKED + k_COUNT));
+}
+
+void FutureState::beginReset()
+{
+    this->lock();
+}
+
+unsigned int FutureState::endReset()
+{
+    const unsigned int generation = d_generation.addAcqRel(1);
+
+    while (true) {
+        const int state = this->load();
+        BSLS_ASSERT((state & k_LOCKED) != 0);
+
+        const int next = state & k_WAITING;
+
+        if (this->compareAndSwap(state, next) == state) {
+            return generation;
+        }
+    }
+}
+
+bsl::size_t FutureState::size() const
+{
+    return static_cast<bsl::size_t>(this->load() / k_COUNT);
+}
+
+unsigned int FutureState::generation() const
+{
+    return d_generation.loadAcquire();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
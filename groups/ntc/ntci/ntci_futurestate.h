@@ -0,0 +1,380 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCI_FUTURESTATE
+#define INCLUDED_NTCI_FUTURESTATE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_platform.h>
+#include <ntcscm_version.h>
+#include <ntsa_error.h>
+#include <bslma_allocator.h>
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bsls_atomic.h>
+#include <bsls_timeinterval.h>
+#include <bsl_list.h>
+
+namespace BloombergLP {
+namespace ntci {
+
+/// @internal @brief
+/// Provide the synchronization state of a future.
+///
+/// @details
+/// Provide a single atomic state word that counts the results available to
+/// be popped from a future, guards access to the storage of those results,
+/// and indicates whether any thread is parked waiting for a result. Pushing
+/// a result never blocks on a system call unless a thread is parked waiting
+/// for a result, and popping a result that is already available never blocks
+/// on a system call at all. A thread waiting for a result first spins for an
+/// adaptive number of iterations, tuned by how long previous results took
+/// to arrive, then parks on the state word itself: on Linux the thread parks
+/// on a futex; on other platforms the thread parks on a condition variable.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntci_operation
+class FutureState
+{
+    enum {
+        // Set when a thread is parked, or about to park, waiting for a
+        // result.
+        k_WAITING = 1,
+
+        // Set when a thread has exclusive access to the storage of the
+        // results.
+        k_LOCKED = 2,
+
+        // The increment of the number of results available.
+        k_COUNT = 4
+    };
+
+#if NTCCFG_FUTEX_ENABLED
+    int d_value;
+#else
+    bsls::AtomicInt  d_value;
+    bslmt::Mutex     d_mutex;
+    bslmt::Condition d_condition;
+#endif
+
+    bsls::AtomicInt  d_spinLimit;
+    bsls::AtomicUint d_generation;
+
+  private:
+    FutureState(const FutureState&) BSLS_KEYWORD_DELETED;
+    FutureState& operator=(const FutureState&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Return the current value of the state word.
+    int load() const;
+
+    /// Set the state word to the specified 'desired' value if it is equal
+    /// to the specified 'expected' value. Return the previous value of the
+    /// state word.
+    int compareAndSwap(int expected, int desired);
+
+    /// Add the specified 'delta' to the state word.
+    void add(int delta);
+
+    /// Park the calling thread while the state word has the specified
+    /// 'expected' value, or until the optionally specified 'timeout', in
+    /// absolute time since the Unix epoch, elapses. Return true if the
+    /// timeout elapsed, otherwise return false. Note that this function may
+    /// return spuriously.
+    bool park(int expected, const bsls::TimeInterval* timeout);
+
+    /// Unpark each thread parked on the state word.
+    void unpark();
+
+    /// Acquire exclusive access to the storage of the results. Return the
+    /// state word after the acquisition.
+    int lock();
+
+    /// Wait until a result is available or the optionally specified
+    /// 'timeout', in absolute time since the Unix epoch, elapses, then
+    /// acquire exclusive access to the storage of the results. Return the
+    /// error.
+    ntsa::Error wait(const bsls::TimeInterval* timeout);
+
+  public:
+    /// Create a new future state having no results available.
+    FutureState();
+
+    /// Destroy this object.
+    ~FutureState();
+
+    /// Acquire exclusive access to the storage of the results to push a
+    /// result. Return the number of results available. The behavior is
+    /// undefined unless 'endPush' is called after the result is stored.
+    bsl::size_t beginPush();
+
+    /// Release exclusive access to the storage of the results, incrementing
+    /// the number of results available, and unpark any thread waiting for
+    /// a result.
+    void endPush();
+
+    /// Acquire exclusive access to the storage of the results to push a
+    /// result of the operation identified by the specified 'generation' and
+    /// load into the specified 'numAvailable' the number of results
+    /// available. Return true if 'generation' is the current generation,
+    /// otherwise return false without acquiring exclusive access. The
+    /// behavior is undefined unless 'endPush' is called after the result is
+    /// stored, if this function returns true.
+    bool beginPush(bsl::size_t* numAvailable, unsigned int generation);
+
+    /// Wait until a result is available, then acquire exclusive access to
+    /// the storage of the results to pop that result. Return the error. The
+    /// behavior is undefined unless 'endPop' is called after the result is
+    /// removed.
+    ntsa::Error beginPop();
+
+    /// Wait until a result is available or the specified 'timeout', in
+    /// absolute time since the Unix epoch, elapses, then acquire exclusive
+    /// access to the storage of the results to pop that result. Return the
+    /// error, notably 'ntsa::Error::e_WOULD_BLOCK' if the timeout elapses
+    /// before a result is available. The behavior is undefined unless
+    /// 'endPop' is called after the result is removed, if no error is
+    /// returned.
+    ntsa::Error beginPop(const bsls::TimeInterval& timeout);
+
+    /// Release exclusive access to the storage of the results, decrementing
+    /// the number of results available.
+    void endPop();
+
+    /// Acquire exclusive access to the storage of the results to discard
+    /// each result available. The behavior is undefined unless 'endReset'
+    /// is called after the results are discarded.
+    void beginReset();
+
+    /// Release exclusive access to the storage of the results, resetting
+    /// the number of results available to zero and advancing the generation
+    /// so that results subsequently pushed for any previous generation are
+    /// discarded. Return the new generation.
+    unsigned int endReset();
+
+    /// Return the number of results available.
+    bsl::size_t size() const;
+
+    /// Return the generation of the operation whose results are accepted.
+    unsigned int generation() const;
+};
+
+/// @internal @brief
+/// Provide a queue of the results of a future.
+///
+/// @details
+/// Provide a queue of results, pushed by the callback of an asynchronous
+/// operation and popped by a thread waiting for the operation to complete,
+/// synchronized by a single 'ntci::FutureState'. The oldest result is stored
+/// inline, so a future that has at most one result outstanding at a time,
+/// which is the common case, allocates no memory to store its results.
+/// Results that arrive while the inline slot is occupied are stored in an
+/// overflow list. Results may be tagged with the generation of the operation
+/// that produced them: resetting the queue discards its results and rejects
+/// each result subsequently pushed for a previous generation.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntci_operation
+template <typename RESULT>
+class FutureQueue
+{
+    /// Define a type alias for a list of results.
+    typedef bsl::list<RESULT> ResultList;
+
+    ntci::FutureState d_state;
+    RESULT            d_slot;
+    ResultList        d_overflow;
+
+  private:
+    FutureQueue(const FutureQueue&) BSLS_KEYWORD_DELETED;
+    FutureQueue& operator=(const FutureQueue&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Load the oldest result into the specified 'result' and replace it
+    /// with the next oldest result, if any. The behavior is undefined
+    /// unless the caller has exclusive access to the storage of the
+    /// results and a result is available.
+    void take(RESULT* result);
+
+  public:
+    /// Create a new, empty queue of results. Optionally specify a
+    /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
+    /// the currently installed default allocator is used.
+    explicit FutureQueue(bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~FutureQueue();
+
+    /// Push the specified 'result' onto the queue and unpark any thread
+    /// waiting for a result.
+    void push(const RESULT& result);
+
+    /// Push the specified 'result' of the operation identified by the
+    /// specified 'generation' onto the queue and unpark any thread waiting
+    /// for a result. Return true if 'generation' is the current generation,
+    /// otherwise discard the 'result' and return false.
+    bool push(const RESULT& result, unsigned int generation);
+
+    /// Wait until a result is available, then pop the oldest result and
+    /// load it into the specified 'result'. Return the error.
+    ntsa::Error pop(RESULT* result);
+
+    /// Wait until a result is available or the specified 'timeout', in
+    /// absolute time since the Unix epoch, elapses, then pop the oldest
+    /// result and load it into the specified 'result'. Return the error,
+    /// notably 'ntsa::Error::e_WOULD_BLOCK' if the timeout elapses before a
+    /// result is available.
+    ntsa::Error pop(RESULT* result, const bsls::TimeInterval& timeout);
+
+    /// Discard each result available and advance the generation so that
+    /// results subsequently pushed for any previous generation are
+    /// discarded. Return the new generation.
+    unsigned int reset();
+
+    /// Return the number of results available.
+    bsl::size_t size() const;
+
+    /// Return the generation of the operation whose results are accepted.
+    unsigned int generation() const;
+};
+
+template <typename RESULT>
+NTCCFG_INLINE void FutureQueue<RESULT>::take(RESULT* result)
+{
+    *result = d_slot;
+
+    if (d_overflow.empty()) {
+        d_slot.reset();
+    }
+    else {
+        d_slot = d_overflow.front();
+        d_overflow.pop_front();
+    }
+}
+
+template <typename RESULT>
+NTCCFG_INLINE FutureQueue<RESULT>::FutureQueue(
+    bslma::Allocator* basicAllocator)
+: d_state()
+, d_slot(basicAllocator)
+, d_overflow(basicAllocator)
+{
+}
+
+template <typename RESULT>
+NTCCFG_INLINE FutureQueue<RESULT>::~FutureQueue()
+{
+}
+
+template <typename RESULT>
+NTCCFG_INLINE void FutureQueue<RESULT>::push(const RESULT& result)
+{
+    const bsl::size_t size = d_state.beginPush();
+
+    if (size == 0) {
+        d_slot = result;
+    }
+    else {
+        d_overflow.push_back(result);
+    }
+
+    d_state.endPush();
+}
+
+template <typename RESULT>
+NTCCFG_INLINE bool FutureQueue<RESULT>::push(const RESULT& result,
+                                             unsigned int  generation)
+{
+    bsl::size_t size = 0;
+    if (!d_state.beginPush(&size, generation)) {
+        return false;
+    }
+
+    if (size == 0) {
+        d_slot = result;
+    }
+    else {
+        d_overflow.push_back(result);
+    }
+
+    d_state.endPush();
+
+    return true;
+}
+
+template <typename RESULT>
+NTCCFG_INLINE ntsa::Error FutureQueue<RESULT>::pop(RESULT* result)
+{
+    ntsa::Error error = d_state.beginPop();
+    if (error) {
+        return error;
+    }
+
+    this->take(result);
+
+    d_state.endPop();
+
+    return ntsa::Error();
+}
+
+template <typename RESULT>
+NTCCFG_INLINE ntsa::Error FutureQueue<RESULT>::pop(
+    RESULT*                   result,
+    const bsls::TimeInterval& timeout)
+{
+    ntsa::Error error = d_state.beginPop(timeout);
+    if (error) {
+        return error;
+    }
+
+    this->take(result);
+
+    d_state.endPop();
+
+    return ntsa::Error();
+}
+
+template <typename RESULT>
+NTCCFG_INLINE unsigned int FutureQueue<RESULT>::reset()
+{
+    d_state.beginReset();
+
+    d_slot.reset();
+    d_overflow.clear();
+
+    return d_state.endReset();
+}
+
+template <typename RESULT>
+NTCCFG_INLINE bsl::size_t FutureQueue<RESULT>::size() const
+{
+    return d_state.size();
+}
+
+template <typename RESULT>
+NTCCFG_INLINE unsigned int FutureQueue<RESULT>::generation() const
+{
+    return d_state.generation();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
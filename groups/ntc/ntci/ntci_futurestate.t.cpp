@@ -0,0 +1,355 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntci_futurestate.h>
+
+#include <ntccfg_test.h>
+#include <ntci_futurepool.h>
+#include <ntci_sendfuture.h>
+
+#include <bdlt_currenttime.h>
+#include <bslmt_threadutil.h>
+#include <bsls_timeinterval.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+
+namespace test {
+
+// Provide a result of an operation that allocates memory.
+class Result
+{
+    bsl::string d_value;
+
+  public:
+    // Create a new result having an empty value. Optionally specify a
+    // 'basicAllocator' used to supply memory.
+    explicit Result(bslma::Allocator* basicAllocator = 0)
+    : d_value(basicAllocator)
+    {
+    }
+
+    // Create a new result having the same value as the specified
+    // 'original' object. Optionally specify a 'basicAllocator' used to
+    // supply memory.
+    Result(const Result& original, bslma::Allocator* basicAllocator = 0)
+    : d_value(original.d_value, basicAllocator)
+    {
+    }
+
+    // Assign the value of the specified 'other' object to this object.
+    // Return a reference to this modifiable object.
+    Result& operator=(const Result& other)
+    {
+        d_value = other.d_value;
+        return *this;
+    }
+
+    // Reset the value of this object to its value upon default
+    // construction.
+    void reset()
+    {
+        d_value.clear();
+    }
+
+    // Set the value of this object to the specified 'value'.
+    void setValue(const bsl::string& value)
+    {
+        d_value = value;
+    }
+
+    // Return the value of this object.
+    const bsl::string& value() const
+    {
+        return d_value;
+    }
+};
+
+// Provide a function that pushes a result onto a queue from another
+// thread.
+class Producer
+{
+    ntci::FutureQueue<test::Result>* d_queue_p;
+    bslma::Allocator*                d_allocator_p;
+
+  public:
+    // Create a new producer of results onto the specified 'queue' using the
+    // specified 'basicAllocator' to supply memory.
+    Producer(ntci::FutureQueue<test::Result>* queue,
+             bslma::Allocator*                basicAllocator)
+    : d_queue_p(queue)
+    , d_allocator_p(basicAllocator)
+    {
+    }
+
+    // Wait until the consumer is likely parked, then push a result.
+    void operator()()
+    {
+        bslmt::ThreadUtil::microSleep(10000);
+
+        test::Result result(d_allocator_p);
+        result.setValue("a string value that is too long to store inline");
+
+        d_queue_p->push(result);
+    }
+};
+
+}  // close namespace test
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Results pushed while the inline slot is occupied are popped in
+    // the order they were pushed.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntci::FutureQueue<test::Result> queue(&ta);
+        NTCCFG_TEST_EQ(queue.size(), 0);
+
+        for (bsl::size_t i = 0; i < 3; ++i) {
+            const char value = static_cast<char>('a' + i);
+
+            test::Result result(&ta);
+            result.setValue(bsl::string(10 + i, value, &ta));
+
+            queue.push(result);
+        }
+
+        NTCCFG_TEST_EQ(queue.size(), 3);
+
+        for (bsl::size_t i = 0; i < 3; ++i) {
+            const char value = static_cast<char>('a' + i);
+
+            test::Result result(&ta);
+            ntsa::Error  error = queue.pop(&result);
+            NTCCFG_TEST_OK(error);
+
+            NTCCFG_TEST_EQ(result.value(), bsl::string(10 + i, value, &ta));
+        }
+
+        NTCCFG_TEST_EQ(queue.size(), 0);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: A timed wait for a result that never arrives fails with
+    // 'ntsa::Error::e_WOULD_BLOCK', and the queue remains usable afterwards.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntci::FutureQueue<test::Result> queue(&ta);
+
+        test::Result result(&ta);
+        ntsa::Error  error;
+
+        error = queue.pop(&result, bsls::TimeInterval(0));
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+
+        error = queue.pop(&result,
+                          bdlt::CurrentTime::now() +
+                              bsls::TimeInterval(0, 10000000));
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+
+        test::Result other(&ta);
+        other.setValue("value");
+
+        queue.push(other);
+
+        error = queue.pop(&result, bsls::TimeInterval(0));
+        NTCCFG_TEST_OK(error);
+        NTCCFG_TEST_EQ(result.value(), "value");
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(3)
+{
+    // Concern: A result pushed by another thread unparks a thread waiting
+    // for that result.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntci::FutureQueue<test::Result> queue(&ta);
+
+        for (bsl::size_t i = 0; i < 10; ++i) {
+            bslmt::ThreadUtil::Handle handle;
+            int rc = bslmt::ThreadUtil::create(&handle,
+                                               test::Producer(&queue, &ta));
+            NTCCFG_TEST_EQ(rc, 0);
+
+            test::Result result(&ta);
+            ntsa::Error  error = queue.pop(&result);
+            NTCCFG_TEST_OK(error);
+            NTCCFG_TEST_FALSE(result.value().empty());
+
+            bslmt::ThreadUtil::join(handle);
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(4)
+{
+    // Concern: A pooled future is reused by the thread that acquired it once
+    // it is no longer referenced, and only then.
+
+    ntccfg::TestAllocator ta;
+    {
+        NTCCFG_TEST_EQ(ntci::FuturePoolUtil::size(), 0);
+
+        bsl::shared_ptr<ntci::SendFuture> first =
+            ntci::FuturePool<ntci::SendFuture>::acquire(&ta);
+
+        bsl::shared_ptr<ntci::SendFuture> second =
+            ntci::FuturePool<ntci::SendFuture>::acquire(&ta);
+
+        NTCCFG_TEST_NE(first.get(), second.get());
+        NTCCFG_TEST_EQ(ntci::FuturePoolUtil::size(), 2);
+
+        ntci::SendFuture* address = first.get();
+        first.reset();
+
+        bsl::shared_ptr<ntci::SendFuture> third =
+            ntci::FuturePool<ntci::SendFuture>::acquire(&ta);
+
+        NTCCFG_TEST_EQ(third.get(), address);
+        NTCCFG_TEST_EQ(ntci::FuturePoolUtil::size(), 2);
+
+        second.reset();
+        third.reset();
+
+        ntci::FuturePoolUtil::clear();
+        NTCCFG_TEST_EQ(ntci::FuturePoolUtil::size(), 0);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(5)
+{
+    // Concern: Resetting a queue discards the results available and rejects
+    // each result subsequently pushed for a previous generation.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntci::FutureQueue<test::Result> queue(&ta);
+
+        const unsigned int generation = queue.generation();
+
+        test::Result result(&ta);
+        result.setValue("a string value that is too long to store inline");
+
+        NTCCFG_TEST_TRUE(queue.push(result, generation));
+        NTCCFG_TEST_TRUE(queue.push(result, generation));
+        NTCCFG_TEST_EQ(queue.size(), 2);
+
+        const unsigned int nextGeneration = queue.reset();
+        NTCCFG_TEST_NE(nextGeneration, generation);
+        NTCCFG_TEST_EQ(queue.generation(), nextGeneration);
+        NTCCFG_TEST_EQ(queue.size(), 0);
+
+        NTCCFG_TEST_FALSE(queue.push(result, generation));
+        NTCCFG_TEST_EQ(queue.size(), 0);
+
+        test::Result other(&ta);
+        other.setValue("value");
+
+        NTCCFG_TEST_TRUE(queue.push(other, nextGeneration));
+        NTCCFG_TEST_EQ(queue.size(), 1);
+
+        ntsa::Error error = queue.pop(&result, bsls::TimeInterval(0));
+        NTCCFG_TEST_OK(error);
+        NTCCFG_TEST_EQ(result.value(), "value");
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(6)
+{
+    // Concern: The result of an operation still pending when a pooled
+    // future is rearmed after a timed out wait is not received by the next
+    // wait on that future when it is reused.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+
+        ntca::SendEvent event;
+        event.setType(ntca::SendEventType::e_COMPLETE);
+
+        ntci::SendCallback pending(&ta);
+        ntci::SendFuture*  address = 0;
+
+        {
+            bsl::shared_ptr<ntci::SendFuture> future =
+                ntci::FuturePool<ntci::SendFuture>::acquire(&ta);
+
+            address = future.get();
+
+            // Retain a copy of the callback, as an operation still pending
+            // would.
+
+            pending = *future;
+
+            ntci::SendResult result;
+            error = future->wait(&result, bsls::TimeInterval(0));
+            NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+
+            future->rearm();
+        }
+
+        bsl::shared_ptr<ntci::SendFuture> future =
+            ntci::FuturePool<ntci::SendFuture>::acquire(&ta);
+
+        NTCCFG_TEST_EQ(future.get(), address);
+
+        pending.execute(bsl::shared_ptr<ntci::Sender>(),
+                        event,
+                        ntci::Strand::unknown());
+
+        ntci::SendResult result;
+        error = future->wait(&result, bsls::TimeInterval(0));
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+
+        ntci::SendCallback current = *future;
+        current.execute(bsl::shared_ptr<ntci::Sender>(),
+                        event,
+                        ntci::Strand::unknown());
+
+        error = future->wait(&result, bsls::TimeInterval(0));
+        NTCCFG_TEST_OK(error);
+        NTCCFG_TEST_EQ(result.event().type(), ntca::SendEventType::e_COMPLETE);
+
+        pending.reset();
+        current.reset();
+        future.reset();
+
+        ntci::FuturePoolUtil::clear();
+        NTCCFG_TEST_EQ(ntci::FuturePoolUtil::size(), 0);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+    NTCCFG_TEST_REGISTER(3);
+    NTCCFG_TEST_REGISTER(4);
+    NTCCFG_TEST_REGISTER(5);
+    NTCCFG_TEST_REGISTER(6);
+}
+NTCCFG_TEST_DRIVER_END;
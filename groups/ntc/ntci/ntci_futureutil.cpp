@@ -0,0 +1,137 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntci_futureutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntci_futureutil_cpp, "$Id$ $CSID$")
+
+#include <ntci_futurepool.h>
+#include <ntci_receivefuture.h>
+#include <ntci_sendfuture.h>
+
+namespace BloombergLP {
+namespace ntci {
+
+ntsa::Error FutureUtil::send(
+    ntci::SendResult*                    result,
+    const bsl::shared_ptr<ntci::Sender>& sender,
+    const bdlbb::Blob&                   data,
+    const ntca::SendOptions&             options,
+    bslma::Allocator*                    basicAllocator)
+{
+    ntsa::Error error;
+
+    bsl::shared_ptr<ntci::SendFuture> future =
+        ntci::FuturePool<ntci::SendFuture>::acquire(basicAllocator);
+
+    error = sender->send(data, options, *future);
+    if (error) {
+        future->rearm();
+        return error;
+    }
+
+    error = future->wait(result);
+    if (error) {
+        future->rearm();
+        return error;
+    }
+
+    return result->event().context().error();
+}
+
+ntsa::Error FutureUtil::send(
+    ntci::SendResult*                    result,
+    const bsl::shared_ptr<ntci::Sender>& sender,
+    const bdlbb::Blob&                   data,
+    const ntca::SendOptions&             options,
+    const bsls::TimeInterval&            timeout,
+    bslma::Allocator*                    basicAllocator)
+{
+    ntsa::Error error;
+
+    bsl::shared_ptr<ntci::SendFuture> future =
+        ntci::FuturePool<ntci::SendFuture>::acquire(basicAllocator);
+
+    error = sender->send(data, options, *future);
+    if (error) {
+        future->rearm();
+        return error;
+    }
+
+    error = future->wait(result, timeout);
+    if (error) {
+        future->rearm();
+        return error;
+    }
+
+    return result->event().context().error();
+}
+
+ntsa::Error FutureUtil::receive(
+    ntci::ReceiveResult*                   result,
+    const bsl::shared_ptr<ntci::Receiver>& receiver,
+    const ntca::ReceiveOptions&            options,
+    bslma::Allocator*                      basicAllocator)
+{
+    ntsa::Error error;
+
+    bsl::shared_ptr<ntci::ReceiveFuture> future =
+        ntci::FuturePool<ntci::ReceiveFuture>::acquire(basicAllocator);
+
+    error = receiver->receive(options, *future);
+    if (error) {
+        future->rearm();
+        return error;
+    }
+
+    error = future->wait(result);
+    if (error) {
+        future->rearm();
+        return error;
+    }
+
+    return result->event().context().error();
+}
+
+ntsa::Error FutureUtil::receive(
+    ntci::ReceiveResult*                   result,
+    const bsl::shared_ptr<ntci::Receiver>& receiver,
+    const ntca::ReceiveOptions&            options,
+    const bsls::TimeInterval&              timeout,
+    bslma::Allocator*                      basicAllocator)
+{
+    ntsa::Error error;
+
+    bsl::shared_ptr<ntci::ReceiveFuture> future =
+        ntci::FuturePool<ntci::ReceiveFuture>::acquire(basicAllocator);
+
+    error = receiver->receive(options, *future);
+    if (error) {
+        future->rearm();
+        return error;
+    }
+
+    error = future->wait(result, timeout);
+    if (error) {
+        future->rearm();
+        return error;
+    }
+
+    return result->event().context().error();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
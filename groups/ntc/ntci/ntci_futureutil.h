@@ -0,0 +1,122 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCI_FUTUREUTIL
+#define INCLUDED_NTCI_FUTUREUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntca_receiveoptions.h>
+#include <ntca_sendoptions.h>
+#include <ntccfg_platform.h>
+#include <ntci_receiver.h>
+#include <ntci_receiveresult.h>
+#include <ntci_sender.h>
+#include <ntci_sendresult.h>
+#include <ntcscm_version.h>
+#include <ntsa_error.h>
+#include <bdlbb_blob.h>
+#include <bslma_allocator.h>
+#include <bsls_timeinterval.h>
+#include <bsl_memory.h>
+
+namespace BloombergLP {
+namespace ntci {
+
+/// @internal @brief
+/// Provide utilities to perform asynchronous operations synchronously.
+///
+/// @details
+/// Provide utilities to initiate an asynchronous operation and block the
+/// calling thread until that operation completes. Each function completes
+/// its operation into a future acquired from the pool of the calling thread,
+/// so that a thread that repeatedly performs operations synchronously
+/// allocates neither a future nor its callback for each operation. If the
+/// wait for an operation times out, the future is rearmed before it is
+/// returned to the pool, so the result of the abandoned operation is
+/// rejected when it arrives, even if the future has since been destroyed.
+/// Note that these functions must not be called
+/// from a thread that processes the events of the socket through which the
+/// operation is performed: the operation could not complete while that
+/// thread is blocked waiting for it.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntci_operation
+struct FutureUtil {
+    /// Send the specified 'data' through the specified 'sender' according
+    /// to the specified 'options' and wait for the send to complete, then
+    /// load the result into the specified 'result'. Optionally specify a
+    /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
+    /// the currently installed default allocator is used. Return the
+    /// error, notably the error with which the send completed.
+    static ntsa::Error send(
+        ntci::SendResult*                    result,
+        const bsl::shared_ptr<ntci::Sender>& sender,
+        const bdlbb::Blob&                   data,
+        const ntca::SendOptions&             options,
+        bslma::Allocator*                    basicAllocator = 0);
+
+    /// Send the specified 'data' through the specified 'sender' according
+    /// to the specified 'options' and wait for the send to complete or
+    /// until the specified 'timeout', in absolute time since the Unix
+    /// epoch, elapses, then load the result into the specified 'result'.
+    /// Optionally specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used. Return the error, notably the error with which the send
+    /// completed, or 'ntsa::Error::e_WOULD_BLOCK' if the timeout elapses
+    /// before the send completes.
+    static ntsa::Error send(
+        ntci::SendResult*                    result,
+        const bsl::shared_ptr<ntci::Sender>& sender,
+        const bdlbb::Blob&                   data,
+        const ntca::SendOptions&             options,
+        const bsls::TimeInterval&            timeout,
+        bslma::Allocator*                    basicAllocator = 0);
+
+    /// Receive data from the specified 'receiver' according to the
+    /// specified 'options' and wait for the receive to complete, then load
+    /// the result into the specified 'result'. Optionally specify a
+    /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
+    /// the currently installed default allocator is used. Return the
+    /// error, notably the error with which the receive completed.
+    static ntsa::Error receive(
+        ntci::ReceiveResult*                   result,
+        const bsl::shared_ptr<ntci::Receiver>& receiver,
+        const ntca::ReceiveOptions&            options,
+        bslma::Allocator*                      basicAllocator = 0);
+
+    /// Receive data from the specified 'receiver' according to the
+    /// specified 'options' and wait for the receive to complete or until
+    /// the specified 'timeout', in absolute time since the Unix epoch,
+    /// elapses, then load the result into the specified 'result'.
+    /// Optionally specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used. Return the error, notably the error with which the receive
+    /// completed, or 'ntsa::Error::e_WOULD_BLOCK' if the timeout elapses
+    /// before the receive completes.
+    static ntsa::Error receive(
+        ntci::ReceiveResult*                   result,
+        const bsl::shared_ptr<ntci::Receiver>& receiver,
+        const ntca::ReceiveOptions&            options,
+        const bsls::TimeInterval&              timeout,
+        bslma::Allocator*                      basicAllocator = 0);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
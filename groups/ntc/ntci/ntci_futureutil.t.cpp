@@ -0,0 +1,308 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntci_futureutil.h>
+
+#include <ntccfg_test.h>
+#include <ntci_futurepool.h>
+#include <ntci_sendfuture.h>
+
+#include <bdlbb_blob.h>
+#include <bslmt_threadutil.h>
+#include <bsls_timeinterval.h>
+
+using namespace BloombergLP;
+
+namespace test {
+
+// Provide a sender that either completes each send immediately or retains
+// its callback, as a send that is still pending would, until it is
+// explicitly completed.
+class Sender : public ntci::Sender
+{
+    bool                          d_pending;
+    ntci::SendCallback            d_callback;
+    bsl::shared_ptr<ntci::Strand> d_strand_sp;
+
+  private:
+    Sender(const Sender&) BSLS_KEYWORD_DELETED;
+    Sender& operator=(const Sender&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // Create a new sender that completes each send immediately. Optionally
+    // specify a 'basicAllocator' used to supply memory.
+    explicit Sender(bslma::Allocator* basicAllocator = 0)
+    : d_pending(false)
+    , d_callback(basicAllocator)
+    , d_strand_sp()
+    {
+    }
+
+    // Destroy this object.
+    ~Sender() BSLS_KEYWORD_OVERRIDE
+    {
+    }
+
+    // Set the flag indicating subsequent sends remain pending until
+    // completed to the specified 'value'.
+    void setPending(bool value)
+    {
+        d_pending = value;
+    }
+
+    // Complete the pending send, if any, and release its callback.
+    void complete()
+    {
+        if (d_callback) {
+            ntca::SendEvent event;
+            event.setType(ntca::SendEventType::e_COMPLETE);
+
+            d_callback.execute(bsl::shared_ptr<ntci::Sender>(),
+                               event,
+                               ntci::Strand::unknown());
+            d_callback.reset();
+        }
+    }
+
+    ntsa::Error send(const bdlbb::Blob&       data,
+                     const ntca::SendOptions& options) BSLS_KEYWORD_OVERRIDE
+    {
+        NTCCFG_WARNING_UNUSED(data);
+        NTCCFG_WARNING_UNUSED(options);
+
+        return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+    }
+
+    ntsa::Error send(const ntsa::Data&        data,
+                     const ntca::SendOptions& options) BSLS_KEYWORD_OVERRIDE
+    {
+        NTCCFG_WARNING_UNUSED(data);
+        NTCCFG_WARNING_UNUSED(options);
+
+        return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+    }
+
+    ntsa::Error send(const bdlbb::Blob&        data,
+                     const ntca::SendOptions&  options,
+                     const ntci::SendFunction& callback) BSLS_KEYWORD_OVERRIDE
+    {
+        NTCCFG_WARNING_UNUSED(data);
+        NTCCFG_WARNING_UNUSED(options);
+        NTCCFG_WARNING_UNUSED(callback);
+
+        return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+    }
+
+    ntsa::Error send(const bdlbb::Blob&        data,
+                     const ntca::SendOptions&  options,
+                     const ntci::SendCallback& callback) BSLS_KEYWORD_OVERRIDE
+    {
+        NTCCFG_WARNING_UNUSED(data);
+        NTCCFG_WARNING_UNUSED(options);
+
+        d_callback = callback;
+
+        if (!d_pending) {
+            this->complete();
+        }
+
+        return ntsa::Error();
+    }
+
+    ntsa::Error send(const ntsa::Data&         data,
+                     const ntca::SendOptions&  options,
+                     const ntci::SendFunction& callback) BSLS_KEYWORD_OVERRIDE
+    {
+        NTCCFG_WARNING_UNUSED(data);
+        NTCCFG_WARNING_UNUSED(options);
+        NTCCFG_WARNING_UNUSED(callback);
+
+        return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+    }
+
+    ntsa::Error send(const ntsa::Data&         data,
+                     const ntca::SendOptions&  options,
+                     const ntci::SendCallback& callback) BSLS_KEYWORD_OVERRIDE
+    {
+        NTCCFG_WARNING_UNUSED(data);
+        NTCCFG_WARNING_UNUSED(options);
+        NTCCFG_WARNING_UNUSED(callback);
+
+        return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+    }
+
+    ntsa::Error cancel(const ntca::SendToken& token) BSLS_KEYWORD_OVERRIDE
+    {
+        NTCCFG_WARNING_UNUSED(token);
+
+        return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+    }
+
+    const bsl::shared_ptr<ntci::Strand>& strand() const BSLS_KEYWORD_OVERRIDE
+    {
+        return d_strand_sp;
+    }
+};
+
+// Provide a function that sends data synchronously through a sender whose
+// send remains pending, until a timeout elapses, on another thread.
+class PendingSend
+{
+    bsl::shared_ptr<test::Sender> d_sender_sp;
+    bslma::Allocator*             d_allocator_p;
+
+  public:
+    // Create a new function that sends data through the specified 'sender'
+    // using the specified 'basicAllocator' to supply memory.
+    PendingSend(const bsl::shared_ptr<test::Sender>& sender,
+                bslma::Allocator*                    basicAllocator)
+    : d_sender_sp(sender)
+    , d_allocator_p(basicAllocator)
+    {
+    }
+
+    // Send data and ensure the send times out.
+    void operator()()
+    {
+        bdlbb::Blob      data(d_allocator_p);
+        ntci::SendResult result(d_allocator_p);
+
+        ntsa::Error error = ntci::FutureUtil::send(&result,
+                                                   d_sender_sp,
+                                                   data,
+                                                   ntca::SendOptions(),
+                                                   bsls::TimeInterval(0),
+                                                   d_allocator_p);
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+    }
+};
+
+}  // close namespace test
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: A send that completes is waited for through a pooled future,
+    // and the result of a send whose wait timed out is not received by the
+    // next send through the same pooled future.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+
+        bsl::shared_ptr<test::Sender> sender;
+        sender.createInplace(&ta, &ta);
+
+        bdlbb::Blob      data(&ta);
+        ntci::SendResult result(&ta);
+
+        error = ntci::FutureUtil::send(&result,
+                                       sender,
+                                       data,
+                                       ntca::SendOptions(),
+                                       &ta);
+        NTCCFG_TEST_OK(error);
+        NTCCFG_TEST_EQ(ntci::FuturePoolUtil::size(), 1);
+
+        sender->setPending(true);
+
+        error = ntci::FutureUtil::send(&result,
+                                       sender,
+                                       data,
+                                       ntca::SendOptions(),
+                                       bsls::TimeInterval(0),
+                                       &ta);
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+
+        sender->complete();
+
+        bsl::shared_ptr<ntci::SendFuture> future =
+            ntci::FuturePool<ntci::SendFuture>::acquire(&ta);
+        NTCCFG_TEST_EQ(ntci::FuturePoolUtil::size(), 1);
+
+        error = future->wait(&result, bsls::TimeInterval(0));
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+
+        future.reset();
+
+        ntci::FuturePoolUtil::clear();
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: A send whose wait timed out may complete after its pooled
+    // future is destroyed because the pool is cleared.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+
+        bsl::shared_ptr<test::Sender> sender;
+        sender.createInplace(&ta, &ta);
+
+        sender->setPending(true);
+
+        bdlbb::Blob      data(&ta);
+        ntci::SendResult result(&ta);
+
+        error = ntci::FutureUtil::send(&result,
+                                       sender,
+                                       data,
+                                       ntca::SendOptions(),
+                                       bsls::TimeInterval(0),
+                                       &ta);
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+
+        ntci::FuturePoolUtil::clear();
+        NTCCFG_TEST_EQ(ntci::FuturePoolUtil::size(), 0);
+
+        sender->complete();
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(3)
+{
+    // Concern: A send whose wait timed out may complete after its pooled
+    // future is destroyed because the thread that waited for it exits.
+
+    ntccfg::TestAllocator ta;
+    {
+        bsl::shared_ptr<test::Sender> sender;
+        sender.createInplace(&ta, &ta);
+
+        sender->setPending(true);
+
+        bslmt::ThreadUtil::Handle handle;
+        int rc = bslmt::ThreadUtil::create(&handle,
+                                           test::PendingSend(sender, &ta));
+        NTCCFG_TEST_EQ(rc, 0);
+
+        rc = bslmt::ThreadUtil::join(handle);
+        NTCCFG_TEST_EQ(rc, 0);
+
+        sender->complete();
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+    NTCCFG_TEST_REGISTER(3);
+}
+NTCCFG_TEST_DRIVER_END;
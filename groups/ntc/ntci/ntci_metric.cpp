@@ -21,10 +21,146 @@ BSLS_IDENT_RCSID(ntci_metric_cpp, "$Id$ $CSID$")
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bsls_assert.h>
+#include <bsl_cmath.h>
 
 namespace BloombergLP {
 namespace ntci {
 
+void MetricValue::collectSummary(bdld::DatumMutableArrayRef* array,
+                                 bsl::size_t*                index) const
+{
+    if (d_count > 0) {
+        array->data()[(*index)++] =
+            bdld::Datum::createDouble(static_cast<double>(d_count));
+        array->data()[(*index)++] = bdld::Datum::createDouble(this->total());
+        array->data()[(*index)++] = bdld::Datum::createDouble(this->minimum());
+        array->data()[(*index)++] = bdld::Datum::createDouble(this->average());
+        array->data()[(*index)++] = bdld::Datum::createDouble(this->maximum());
+    }
+    else {
+        array->data()[(*index)++] = bdld::Datum::createNull();
+        array->data()[(*index)++] = bdld::Datum::createNull();
+        array->data()[(*index)++] = bdld::Datum::createNull();
+        array->data()[(*index)++] = bdld::Datum::createNull();
+        array->data()[(*index)++] = bdld::Datum::createNull();
+    }
+}
+
+bsl::size_t MetricHistogramValue::bucketIndex(double value)
+{
+    if (!(value > 0)) {
+        return 0;
+    }
+
+    // Decompose the value such that value = mantissa * 2^exponent, where
+    // the mantissa is in the range [0.5, 1.0).
+
+    int    exponent = 0;
+    double mantissa = bsl::frexp(value, &exponent);
+
+    if (exponent <= k_MIN_EXPONENT) {
+        return 0;
+    }
+
+    if (exponent > k_MAX_EXPONENT) {
+        return k_NUM_BUCKETS - 1;
+    }
+
+    bsl::size_t subBucket = static_cast<bsl::size_t>(
+        (mantissa - 0.5) * 2 * k_NUM_SUB_BUCKETS);
+    if (subBucket >= static_cast<bsl::size_t>(k_NUM_SUB_BUCKETS)) {
+        subBucket = static_cast<bsl::size_t>(k_NUM_SUB_BUCKETS) - 1;
+    }
+
+    return static_cast<bsl::size_t>(exponent - k_MIN_EXPONENT - 1) *
+               k_NUM_SUB_BUCKETS +
+           subBucket;
+}
+
+double MetricHistogramValue::bucketValue(bsl::size_t index)
+{
+    const bsl::size_t numSubBuckets =
+        static_cast<bsl::size_t>(k_NUM_SUB_BUCKETS);
+
+    const int exponent =
+        static_cast<int>(index / numSubBuckets) + k_MIN_EXPONENT + 1;
+
+    const double subBucket = static_cast<double>(index % numSubBuckets);
+
+    const double mantissa = 0.5 + (subBucket + 0.5) / (2 * k_NUM_SUB_BUCKETS);
+
+    return bsl::ldexp(mantissa, exponent);
+}
+
+void MetricHistogramValue::merge(const MetricHistogramValue& other)
+{
+    if (other.d_summary.count() == 0) {
+        return;
+    }
+
+    d_summary.merge(other.d_summary);
+
+    for (bsl::size_t i = 0; i < static_cast<bsl::size_t>(k_NUM_BUCKETS); ++i)
+    {
+        d_buckets[i] += other.d_buckets[i];
+    }
+}
+
+void MetricHistogramValue::collectDistribution(
+    bdld::DatumMutableArrayRef* array,
+    bsl::size_t*                index) const
+{
+    d_summary.collectSummary(array, index);
+
+    if (d_summary.count() > 0) {
+        array->data()[(*index)++] =
+            bdld::Datum::createDouble(this->percentile(0.50));
+        array->data()[(*index)++] =
+            bdld::Datum::createDouble(this->percentile(0.90));
+        array->data()[(*index)++] =
+            bdld::Datum::createDouble(this->percentile(0.99));
+        array->data()[(*index)++] =
+            bdld::Datum::createDouble(this->percentile(0.999));
+    }
+    else {
+        array->data()[(*index)++] = bdld::Datum::createNull();
+        array->data()[(*index)++] = bdld::Datum::createNull();
+        array->data()[(*index)++] = bdld::Datum::createNull();
+        array->data()[(*index)++] = bdld::Datum::createNull();
+    }
+}
+
+double MetricHistogramValue::percentile(double percentile) const
+{
+    const bsl::uint64_t count = d_summary.count();
+    if (count == 0) {
+        return 0;
+    }
+
+    if (percentile >= 1.0) {
+        return d_summary.maximum();
+    }
+
+    bsl::uint64_t rank = static_cast<bsl::uint64_t>(
+        bsl::ceil(percentile * static_cast<double>(count)));
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    bsl::uint64_t cumulative = 0;
+    for (bsl::size_t i = 0; i < static_cast<bsl::size_t>(k_NUM_BUCKETS); ++i)
+    {
+        cumulative += d_buckets[i];
+        if (cumulative >= rank) {
+            const double estimate = bucketValue(i);
+            return bsl::min(bsl::max(estimate, d_summary.minimum()),
+                            d_summary.maximum());
+        }
+    }
+
+    return d_summary.maximum();
+}
+
 void Metric::load(ntci::MetricValue* result)
 {
     bsls::SpinLockGuard guard(&d_lock);
@@ -155,23 +291,169 @@ void Metric::collectSummary(bdld::DatumMutableArrayRef* array,
         d_value.reset();
     }
 
-    if (value.count() > 0) {
-        array->data()[(*index)++] =
-            bdld::Datum::createDouble(static_cast<double>(value.count()));
-        array->data()[(*index)++] = bdld::Datum::createDouble(value.total());
-        array->data()[(*index)++] = bdld::Datum::createDouble(value.minimum());
-        array->data()[(*index)++] = bdld::Datum::createDouble(value.average());
-        array->data()[(*index)++] = bdld::Datum::createDouble(value.maximum());
+    value.collectSummary(array, index);
+}
+
+void MetricHistogram::load(ntci::MetricHistogramValue* result)
+{
+    bsls::SpinLockGuard guard(&d_lock);
+
+    *result = d_value;
+    d_value.reset();
+}
+
+void MetricHistogram::collectDistribution(bdld::DatumMutableArrayRef* array,
+                                          bsl::size_t*                index)
+{
+    ntci::MetricHistogramValue value;
+    {
+        bsls::SpinLockGuard guard(&d_lock);
+
+        value = d_value;
+        d_value.reset();
     }
-    else {
-        array->data()[(*index)++] = bdld::Datum::createNull();
-        array->data()[(*index)++] = bdld::Datum::createNull();
-        array->data()[(*index)++] = bdld::Datum::createNull();
-        array->data()[(*index)++] = bdld::Datum::createNull();
-        array->data()[(*index)++] = bdld::Datum::createNull();
+
+    value.collectDistribution(array, index);
+}
+
+SingleWriterMetric::SingleWriterMetric()
+: d_epoch(0)
+, d_writerEpoch(static_cast<bsl::uint64_t>(-1))
+, d_count(0)
+, d_total(0)
+, d_minimum(0)
+, d_maximum(0)
+, d_last(0)
+{
+}
+
+void SingleWriterMetric::begin(bsl::uint64_t epoch)
+{
+    d_count.storeRelaxed(0);
+    d_total.storeRelaxed(encode(0));
+    d_minimum.storeRelaxed(encode(bsl::numeric_limits<double>::max()));
+    d_maximum.storeRelaxed(encode(bsl::numeric_limits<double>::min()));
+
+    // Publish the reset values before acknowledging the interval, so that a
+    // load that observes the acknowledgement observes no values measured in
+    // the previous interval.
+
+    d_writerEpoch.storeRelease(epoch);
+}
+
+void SingleWriterMetric::load(ntci::MetricValue* result)
+{
+    result->reset();
+
+    // Unless the writer has begun the current interval, no value has been
+    // measured since the previous load.
+
+    const bsl::uint64_t epoch = d_epoch.loadRelaxed();
+    if (d_writerEpoch.loadAcquire() != epoch) {
+        return;
+    }
+
+    const bsl::uint64_t count = d_count.loadRelaxed();
+    if (count == 0) {
+        return;
+    }
+
+    result->d_count   = count;
+    result->d_total   = decode(d_total.loadRelaxed());
+    result->d_minimum = decode(d_minimum.loadRelaxed());
+    result->d_maximum = decode(d_maximum.loadRelaxed());
+    result->d_last    = decode(d_last.loadRelaxed());
+
+    d_epoch.storeRelease(epoch + 1);
+}
+
+SingleWriterMetricHistogram::SingleWriterMetricHistogram(
+    bslma::Allocator* basicAllocator)
+: d_epoch(0)
+, d_writerEpoch(static_cast<bsl::uint64_t>(-1))
+, d_count(0)
+, d_total(0)
+, d_minimum(0)
+, d_maximum(0)
+, d_last(0)
+, d_buckets_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+SingleWriterMetricHistogram::~SingleWriterMetricHistogram()
+{
+    if (d_buckets_p) {
+        d_allocator_p->deallocate(d_buckets_p);
     }
 }
 
+void SingleWriterMetricHistogram::begin(bsl::uint64_t epoch)
+{
+    const bsl::size_t numBuckets =
+        static_cast<bsl::size_t>(ntci::MetricHistogramValue::k_NUM_BUCKETS);
+
+    if (d_buckets_p == 0) {
+        d_buckets_p = static_cast<bsls::AtomicUint*>(
+            d_allocator_p->allocate(sizeof(bsls::AtomicUint) * numBuckets));
+
+        for (bsl::size_t i = 0; i < numBuckets; ++i) {
+            new (d_buckets_p + i) bsls::AtomicUint(0);
+        }
+    }
+    else if (d_count.loadRelaxed() > 0) {
+        for (bsl::size_t i = 0; i < numBuckets; ++i) {
+            d_buckets_p[i].storeRelaxed(0);
+        }
+    }
+
+    d_count.storeRelaxed(0);
+    d_total.storeRelaxed(SingleWriterMetric::encode(0));
+    d_minimum.storeRelaxed(
+        SingleWriterMetric::encode(bsl::numeric_limits<double>::max()));
+    d_maximum.storeRelaxed(
+        SingleWriterMetric::encode(bsl::numeric_limits<double>::min()));
+
+    // Publish the reset values, and the bucket counts if just allocated,
+    // before acknowledging the interval.
+
+    d_writerEpoch.storeRelease(epoch);
+}
+
+void SingleWriterMetricHistogram::load(ntci::MetricHistogramValue* result)
+{
+    result->reset();
+
+    const bsl::uint64_t epoch = d_epoch.loadRelaxed();
+    if (d_writerEpoch.loadAcquire() != epoch) {
+        return;
+    }
+
+    const bsl::uint64_t count = d_count.loadRelaxed();
+    if (count == 0) {
+        return;
+    }
+
+    result->d_summary.d_count = count;
+    result->d_summary.d_total =
+        SingleWriterMetric::decode(d_total.loadRelaxed());
+    result->d_summary.d_minimum =
+        SingleWriterMetric::decode(d_minimum.loadRelaxed());
+    result->d_summary.d_maximum =
+        SingleWriterMetric::decode(d_maximum.loadRelaxed());
+    result->d_summary.d_last =
+        SingleWriterMetric::decode(d_last.loadRelaxed());
+
+    const bsl::size_t numBuckets =
+        static_cast<bsl::size_t>(ntci::MetricHistogramValue::k_NUM_BUCKETS);
+
+    for (bsl::size_t i = 0; i < numBuckets; ++i) {
+        result->d_buckets[i] = d_buckets_p[i].loadRelaxed();
+    }
+
+    d_epoch.storeRelease(epoch + 1);
+}
+
 void MetricTotal::load(double* result)
 {
     bsls::SpinLockGuard guard(&d_lock);
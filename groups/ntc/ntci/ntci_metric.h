@@ -22,8 +22,12 @@ BSLS_IDENT("$Id: $")
 #include <ntccfg_platform.h>
 #include <ntci_monitorable.h>
 #include <ntcscm_version.h>
+#include <bslma_allocator.h>
+#include <bsls_atomic.h>
 #include <bsls_spinlock.h>
 #include <bsl_algorithm.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
 #include <bsl_limits.h>
 #include <bsl_string.h>
 #include <bsl_vector.h>
@@ -31,6 +35,9 @@ BSLS_IDENT("$Id: $")
 namespace BloombergLP {
 namespace ntci {
 
+class SingleWriterMetric;
+class SingleWriterMetricHistogram;
+
 /// @internal @brief
 /// Describe the metadata for a metric.
 ///
@@ -56,6 +63,9 @@ class MetricValue
     double        d_maximum;  // The maximum metric value
     double        d_last;     // The last update
 
+    friend class SingleWriterMetric;
+    friend class SingleWriterMetricHistogram;
+
   public:
     /// Create a new metric snapshot having default values.
     MetricValue();
@@ -66,6 +76,16 @@ class MetricValue
     /// Update the snapshot with the specified measured 'value'.
     void update(double value);
 
+    /// Update the snapshot with each value measured by the specified
+    /// 'other' snapshot.
+    void merge(const MetricValue& other);
+
+    /// Load the count, total, minimum, average, and maximum of the
+    /// snapshot into the specified 'array', starting at '*index' and
+    /// modifying the indexes used.
+    void collectSummary(bdld::DatumMutableArrayRef* array,
+                        bsl::size_t*                index) const;
+
     /// Number of times the metric has been collected.
     bsl::uint64_t count() const;
 
@@ -200,6 +220,235 @@ class MetricTotal
     void collectTotal(bdld::DatumMutableArrayRef* array, bsl::size_t* index);
 };
 
+/// @internal @brief
+/// Describe a snapshot of the distribution of values measured for a metric.
+///
+/// @details
+/// Values are counted in a fixed number of log-linear buckets: each power of
+/// two in the range (2^k_MIN_EXPONENT, 2^k_MAX_EXPONENT] is divided into
+/// 'k_NUM_SUB_BUCKETS' linear sub-buckets, so the relative error of each
+/// percentile estimated from the distribution is bounded by
+/// 1 / (2 * k_NUM_SUB_BUCKETS) independent of the magnitude or units of the
+/// measured values. Values outside of that range are counted in the first or
+/// last bucket. The minimum and maximum are tracked exactly, and each
+/// estimated percentile is clamped to them. The memory used by a snapshot is
+/// fixed and independent of the number of values measured.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+class MetricHistogramValue
+{
+  public:
+    enum {
+        /// The number of linear sub-buckets per power of two.
+        k_NUM_SUB_BUCKETS = 8,
+
+        /// The exponent of the power of two below which all values are
+        /// counted in the first bucket.
+        k_MIN_EXPONENT = -32,
+
+        /// The exponent of the power of two above which all values are
+        /// counted in the last bucket.
+        k_MAX_EXPONENT = 32,
+
+        /// The number of buckets.
+        k_NUM_BUCKETS = (k_MAX_EXPONENT - k_MIN_EXPONENT) * k_NUM_SUB_BUCKETS
+    };
+
+  private:
+    ntci::MetricValue d_summary;                 // The summary of values
+    bsl::uint32_t     d_buckets[k_NUM_BUCKETS];  // The bucket counts
+
+    friend class SingleWriterMetricHistogram;
+
+  private:
+    /// Return the index of the bucket that counts the specified 'value'.
+    static bsl::size_t bucketIndex(double value);
+
+    /// Return the value at the midpoint of the bucket at the specified
+    /// 'index'.
+    static double bucketValue(bsl::size_t index);
+
+  public:
+    /// Create a new metric snapshot having default values.
+    MetricHistogramValue();
+
+    /// Reset the values to their defaults.
+    void reset();
+
+    /// Update the snapshot with the specified measured 'value'.
+    void update(double value);
+
+    /// Update the snapshot with each value measured by the specified
+    /// 'other' snapshot.
+    void merge(const MetricHistogramValue& other);
+
+    /// Load the count, total, minimum, average, maximum, and the 50th,
+    /// 90th, 99th, and 99.9th percentiles of the snapshot into the
+    /// specified 'array', starting at '*index' and modifying the indexes
+    /// used.
+    void collectDistribution(bdld::DatumMutableArrayRef* array,
+                             bsl::size_t*                index) const;
+
+    /// Return the summary of the measured values.
+    const ntci::MetricValue& summary() const;
+
+    /// Return the estimate of the specified 'percentile', in the range
+    /// [0.0, 1.0], of the measured values, or 0 if no values have been
+    /// measured.
+    double percentile(double percentile) const;
+};
+
+/// Provide a measurement defined by the total, minimum, average, maximum,
+/// and the estimated distribution of the recorded values.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntci_metrics
+class MetricHistogram
+{
+    bsls::SpinLock             d_lock;
+    ntci::MetricHistogramValue d_value;
+
+  public:
+    /// Create a new metric having default values.
+    MetricHistogram();
+
+    /// Update the snapshot with the specified measured 'value'.
+    void update(double value);
+
+    /// Load the value of the metric into the specified 'result'.
+    void load(ntci::MetricHistogramValue* result);
+
+    /// Load the count, total, minimum, average, maximum, and the 50th,
+    /// 90th, 99th, and 99.9th percentiles of the metric into the specified
+    /// 'array', starting at '*index' and modifying the indexes used.
+    void collectDistribution(bdld::DatumMutableArrayRef* array,
+                             bsl::size_t*                index);
+};
+
+/// Provide a measurement defined by the total, minimum, average, and
+/// maximum of the recorded values, updated by a single writer without
+/// synchronization.
+///
+/// @details
+/// Each value is stored in its own atomic variable accessed with relaxed
+/// memory ordering, so an update is a handful of plain loads and stores
+/// rather than a read-modify-write under a lock. Loading the metric ends the
+/// current measurement interval; the writer resets the values when it first
+/// updates the metric after the interval has ended. Note that a value
+/// measured by the writer while the metric is being loaded may be omitted
+/// from both intervals.
+///
+/// @par Thread Safety
+/// This class is thread safe provided that 'update' is not called
+/// concurrently by more than one thread and 'load' is not called
+/// concurrently by more than one thread.
+///
+/// @ingroup module_ntci_metrics
+class SingleWriterMetric
+{
+    bsls::AtomicUint64 d_epoch;        // The interval requested by loads
+    bsls::AtomicUint64 d_writerEpoch;  // The interval begun by the writer
+    bsls::AtomicUint64 d_count;        // The number of values
+    bsls::AtomicUint64 d_total;        // The encoded total of the values
+    bsls::AtomicUint64 d_minimum;      // The encoded minimum value
+    bsls::AtomicUint64 d_maximum;      // The encoded maximum value
+    bsls::AtomicUint64 d_last;         // The encoded last value
+
+  private:
+    SingleWriterMetric(const SingleWriterMetric&) BSLS_KEYWORD_DELETED;
+    SingleWriterMetric& operator=(const SingleWriterMetric&)
+        BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Reset the values and begin the measurement interval identified by
+    /// the specified 'epoch'.
+    void begin(bsl::uint64_t epoch);
+
+  public:
+    /// Create a new metric having default values.
+    SingleWriterMetric();
+
+    /// Update the metric with the specified measured 'value'. The behavior
+    /// is undefined if this function is called concurrently by more than
+    /// one thread.
+    void update(double value);
+
+    /// Load the values measured since the last call to this function into
+    /// the specified 'result' and begin a new measurement interval. The
+    /// behavior is undefined if this function is called concurrently by
+    /// more than one thread.
+    void load(ntci::MetricValue* result);
+
+    /// Return the specified 'value' encoded as an unsigned integer.
+    static bsl::uint64_t encode(double value);
+
+    /// Return the value encoded as the specified unsigned integer 'value'.
+    static double decode(bsl::uint64_t value);
+};
+
+/// Provide a measurement defined by the total, minimum, average, maximum,
+/// and the estimated distribution of the recorded values, updated by a
+/// single writer without synchronization.
+///
+/// @details
+/// The measurements are stored and collected as described for
+/// 'ntci::SingleWriterMetric'. The bucket counts are allocated when the
+/// metric is first updated, so a metric that is never updated occupies no
+/// more space than a 'ntci::SingleWriterMetric'.
+///
+/// @par Thread Safety
+/// This class is thread safe provided that 'update' is not called
+/// concurrently by more than one thread and 'load' is not called
+/// concurrently by more than one thread.
+///
+/// @ingroup module_ntci_metrics
+class SingleWriterMetricHistogram
+{
+    bsls::AtomicUint64 d_epoch;        // The interval requested by loads
+    bsls::AtomicUint64 d_writerEpoch;  // The interval begun by the writer
+    bsls::AtomicUint64 d_count;        // The number of values
+    bsls::AtomicUint64 d_total;        // The encoded total of the values
+    bsls::AtomicUint64 d_minimum;      // The encoded minimum value
+    bsls::AtomicUint64 d_maximum;      // The encoded maximum value
+    bsls::AtomicUint64 d_last;         // The encoded last value
+    bsls::AtomicUint*  d_buckets_p;    // The bucket counts, if allocated
+    bslma::Allocator*  d_allocator_p;  // The memory allocator
+
+  private:
+    SingleWriterMetricHistogram(const SingleWriterMetricHistogram&)
+        BSLS_KEYWORD_DELETED;
+    SingleWriterMetricHistogram& operator=(
+        const SingleWriterMetricHistogram&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Reset the values, allocating the bucket counts if necessary, and
+    /// begin the measurement interval identified by the specified 'epoch'.
+    void begin(bsl::uint64_t epoch);
+
+  public:
+    /// Create a new metric having default values. Optionally specify a
+    /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
+    /// the currently installed default allocator is used.
+    explicit SingleWriterMetricHistogram(bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~SingleWriterMetricHistogram();
+
+    /// Update the metric with the specified measured 'value'. The behavior
+    /// is undefined if this function is called concurrently by more than
+    /// one thread.
+    void update(double value);
+
+    /// Load the values measured since the last call to this function into
+    /// the specified 'result' and begin a new measurement interval. The
+    /// behavior is undefined if this function is called concurrently by
+    /// more than one thread.
+    void load(ntci::MetricHistogramValue* result);
+};
+
 #define NTCI_METRIC_METADATA_COUNT(name)                                      \
     {                                                                         \
         #name ".count", ntci::Monitorable::e_SUM                              \
@@ -235,6 +484,18 @@ class MetricTotal
         NTCI_METRIC_METADATA_MIN(name), NTCI_METRIC_METADATA_AVG(name),       \
         NTCI_METRIC_METADATA_MAX(name)
 
+#define NTCI_METRIC_METADATA_PERCENTILE(name, percentile)                     \
+    {                                                                         \
+        #name "." #percentile, ntci::Monitorable::e_HISTOGRAM                 \
+    }
+
+#define NTCI_METRIC_METADATA_DISTRIBUTION(name)                               \
+    NTCI_METRIC_METADATA_SUMMARY(name),                                       \
+        NTCI_METRIC_METADATA_PERCENTILE(name, p50),                           \
+        NTCI_METRIC_METADATA_PERCENTILE(name, p90),                           \
+        NTCI_METRIC_METADATA_PERCENTILE(name, p99),                           \
+        NTCI_METRIC_METADATA_PERCENTILE(name, p999)
+
 NTCCFG_INLINE
 MetricValue::MetricValue()
 : d_count(0)
@@ -265,6 +526,18 @@ void MetricValue::update(double value)
     d_last     = value;
 }
 
+NTCCFG_INLINE
+void MetricValue::merge(const MetricValue& other)
+{
+    if (other.d_count > 0) {
+        d_count   += other.d_count;
+        d_total   += other.d_total;
+        d_minimum  = bsl::min(d_minimum, other.d_minimum);
+        d_maximum  = bsl::max(d_maximum, other.d_maximum);
+        d_last     = other.d_last;
+    }
+}
+
 NTCCFG_INLINE
 bsl::uint64_t MetricValue::count() const
 {
@@ -315,6 +588,115 @@ void Metric::update(double value)
     d_value.update(value);
 }
 
+NTCCFG_INLINE
+MetricHistogramValue::MetricHistogramValue()
+: d_summary()
+{
+    bsl::fill(d_buckets, d_buckets + k_NUM_BUCKETS, 0);
+}
+
+NTCCFG_INLINE
+void MetricHistogramValue::reset()
+{
+    if (d_summary.count() > 0) {
+        bsl::fill(d_buckets, d_buckets + k_NUM_BUCKETS, 0);
+    }
+
+    d_summary.reset();
+}
+
+NTCCFG_INLINE
+void MetricHistogramValue::update(double value)
+{
+    d_summary.update(value);
+    ++d_buckets[bucketIndex(value)];
+}
+
+NTCCFG_INLINE
+const ntci::MetricValue& MetricHistogramValue::summary() const
+{
+    return d_summary;
+}
+
+NTCCFG_INLINE
+MetricHistogram::MetricHistogram()
+: d_lock(bsls::SpinLock::s_unlocked)
+{
+}
+
+NTCCFG_INLINE
+void MetricHistogram::update(double value)
+{
+    bsls::SpinLockGuard guard(&d_lock);
+
+    d_value.update(value);
+}
+
+NTCCFG_INLINE
+bsl::uint64_t SingleWriterMetric::encode(double value)
+{
+    bsl::uint64_t result;
+    bsl::memcpy(&result, &value, sizeof result);
+    return result;
+}
+
+NTCCFG_INLINE
+double SingleWriterMetric::decode(bsl::uint64_t value)
+{
+    double result;
+    bsl::memcpy(&result, &value, sizeof result);
+    return result;
+}
+
+NTCCFG_INLINE
+void SingleWriterMetric::update(double value)
+{
+    const bsl::uint64_t epoch = d_epoch.loadRelaxed();
+    if (epoch != d_writerEpoch.loadRelaxed()) {
+        this->begin(epoch);
+    }
+
+    d_count.storeRelaxed(d_count.loadRelaxed() + 1);
+    d_total.storeRelaxed(encode(decode(d_total.loadRelaxed()) + value));
+
+    if (value < decode(d_minimum.loadRelaxed())) {
+        d_minimum.storeRelaxed(encode(value));
+    }
+
+    if (value > decode(d_maximum.loadRelaxed())) {
+        d_maximum.storeRelaxed(encode(value));
+    }
+
+    d_last.storeRelaxed(encode(value));
+}
+
+NTCCFG_INLINE
+void SingleWriterMetricHistogram::update(double value)
+{
+    const bsl::uint64_t epoch = d_epoch.loadRelaxed();
+    if (epoch != d_writerEpoch.loadRelaxed()) {
+        this->begin(epoch);
+    }
+
+    d_count.storeRelaxed(d_count.loadRelaxed() + 1);
+    d_total.storeRelaxed(SingleWriterMetric::encode(
+        SingleWriterMetric::decode(d_total.loadRelaxed()) + value));
+
+    if (value < SingleWriterMetric::decode(d_minimum.loadRelaxed())) {
+        d_minimum.storeRelaxed(SingleWriterMetric::encode(value));
+    }
+
+    if (value > SingleWriterMetric::decode(d_maximum.loadRelaxed())) {
+        d_maximum.storeRelaxed(SingleWriterMetric::encode(value));
+    }
+
+    d_last.storeRelaxed(SingleWriterMetric::encode(value));
+
+    bsls::AtomicUint& bucket =
+        d_buckets_p[ntci::MetricHistogramValue::bucketIndex(value)];
+    bucket.storeRelaxed(bucket.loadRelaxed() + 1);
+}
+
 NTCCFG_INLINE
 MetricTotal::MetricTotal()
 : d_lock(bsls::SpinLock::s_unlocked)
@@ -29,8 +29,14 @@ using namespace BloombergLP;
 //-----------------------------------------------------------------------------
 
 // [ 1]
+// [ 2]
+// [ 3]
+// [ 4]
 //-----------------------------------------------------------------------------
 // [ 1]
+// [ 2] MetricHistogramValue: percentiles are within the bucket precision
+// [ 3] MetricValue, MetricHistogramValue: merge
+// [ 4] SingleWriterMetric, SingleWriterMetricHistogram: intervals
 //-----------------------------------------------------------------------------
 
 NTCCFG_TEST_CASE(1)
@@ -44,8 +50,222 @@ NTCCFG_TEST_CASE(1)
     NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: Percentiles estimated by a histogram are within the relative
+    // error bounded by the number of sub-buckets, across magnitudes, and the
+    // histogram is empty after being reset.
+    // Plan: Measure the values 1..1000 scaled by several magnitudes and
+    // compare each estimated percentile to its exact value.
+
+    ntccfg::TestAllocator ta;
+    {
+        const double SCALES[] = {1e-6, 1e-3, 1.0, 1e3, 1e6};
+
+        const double PERCENTILES[] = {0.50, 0.90, 0.99, 0.999};
+
+        const double TOLERANCE =
+            1.0 / ntci::MetricHistogramValue::k_NUM_SUB_BUCKETS;
+
+        for (bsl::size_t i = 0; i < sizeof SCALES / sizeof SCALES[0]; ++i) {
+            const double scale = SCALES[i];
+
+            ntci::MetricHistogramValue value;
+
+            NTCCFG_TEST_EQ(value.summary().count(), 0);
+            NTCCFG_TEST_EQ(value.percentile(0.5), 0);
+
+            for (int j = 1; j <= 1000; ++j) {
+                value.update(j * scale);
+            }
+
+            NTCCFG_TEST_EQ(value.summary().count(), 1000);
+            NTCCFG_TEST_EQ(value.percentile(1.0), 1000 * scale);
+
+            for (bsl::size_t k = 0;
+                 k < sizeof PERCENTILES / sizeof PERCENTILES[0];
+                 ++k)
+            {
+                const double expected = PERCENTILES[k] * 1000 * scale;
+                const double found    = value.percentile(PERCENTILES[k]);
+
+                NTCCFG_TEST_LE(found, expected * (1 + TOLERANCE));
+                NTCCFG_TEST_GE(found, expected * (1 - TOLERANCE));
+            }
+
+            value.reset();
+
+            NTCCFG_TEST_EQ(value.summary().count(), 0);
+            NTCCFG_TEST_EQ(value.percentile(0.5), 0);
+
+            value.update(42 * scale);
+
+            NTCCFG_TEST_EQ(value.percentile(0.5), 42 * scale);
+        }
+
+        ntci::MetricHistogram metric;
+
+        metric.update(1.0);
+        metric.update(2.0);
+
+        ntci::MetricHistogramValue snapshot;
+        metric.load(&snapshot);
+
+        NTCCFG_TEST_EQ(snapshot.summary().count(), 2);
+        NTCCFG_TEST_EQ(snapshot.percentile(1.0), 2.0);
+
+        metric.load(&snapshot);
+
+        NTCCFG_TEST_EQ(snapshot.summary().count(), 0);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(3)
+{
+    // Concern: Merging snapshots measured separately is equivalent to
+    // measuring every value in a single snapshot.
+    // Plan: Measure the values 1..1000 split by parity into two snapshots,
+    // merge them, and compare the result to a snapshot of all the values.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntci::MetricValue even;
+        ntci::MetricValue odd;
+        ntci::MetricValue all;
+
+        ntci::MetricHistogramValue evenHistogram;
+        ntci::MetricHistogramValue oddHistogram;
+        ntci::MetricHistogramValue allHistogram;
+
+        for (int i = 1; i <= 1000; ++i) {
+            if (i % 2 == 0) {
+                even.update(i);
+                evenHistogram.update(i);
+            }
+            else {
+                odd.update(i);
+                oddHistogram.update(i);
+            }
+
+            all.update(i);
+            allHistogram.update(i);
+        }
+
+        ntci::MetricValue merged;
+        merged.merge(even);
+        merged.merge(ntci::MetricValue());
+        merged.merge(odd);
+
+        NTCCFG_TEST_EQ(merged.count(), all.count());
+        NTCCFG_TEST_EQ(merged.total(), all.total());
+        NTCCFG_TEST_EQ(merged.minimum(), all.minimum());
+        NTCCFG_TEST_EQ(merged.maximum(), all.maximum());
+
+        ntci::MetricHistogramValue mergedHistogram;
+        mergedHistogram.merge(evenHistogram);
+        mergedHistogram.merge(ntci::MetricHistogramValue());
+        mergedHistogram.merge(oddHistogram);
+
+        NTCCFG_TEST_EQ(mergedHistogram.summary().count(),
+                       allHistogram.summary().count());
+
+        NTCCFG_TEST_EQ(mergedHistogram.percentile(0.50),
+                       allHistogram.percentile(0.50));
+        NTCCFG_TEST_EQ(mergedHistogram.percentile(0.99),
+                       allHistogram.percentile(0.99));
+        NTCCFG_TEST_EQ(mergedHistogram.percentile(1.0),
+                       allHistogram.percentile(1.0));
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(4)
+{
+    // Concern: A single-writer metric reports the values measured since the
+    // previous load, equal to those measured by a metric updated under a
+    // lock, and reports nothing for an interval in which nothing was
+    // measured.
+    // Plan: Measure the values 1..1000 in a single-writer metric and
+    // histogram and in their locked equivalents, load each, and compare.
+    // Then load again without measuring and ensure the snapshots are empty,
+    // then measure one value and ensure only that value is reported.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntci::SingleWriterMetric          metric;
+        ntci::SingleWriterMetricHistogram histogram(&ta);
+
+        ntci::MetricValue          expected;
+        ntci::MetricHistogramValue expectedHistogram;
+
+        ntci::MetricValue          snapshot;
+        ntci::MetricHistogramValue snapshotHistogram;
+
+        metric.load(&snapshot);
+        histogram.load(&snapshotHistogram);
+
+        NTCCFG_TEST_EQ(snapshot.count(), 0);
+        NTCCFG_TEST_EQ(snapshotHistogram.summary().count(), 0);
+
+        NTCCFG_TEST_EQ(ta.numBlocksInUse(), 0);
+
+        for (int i = 1; i <= 1000; ++i) {
+            metric.update(i);
+            histogram.update(i);
+
+            expected.update(i);
+            expectedHistogram.update(i);
+        }
+
+        NTCCFG_TEST_EQ(ta.numBlocksInUse(), 1);
+
+        metric.load(&snapshot);
+        histogram.load(&snapshotHistogram);
+
+        NTCCFG_TEST_EQ(snapshot.count(), expected.count());
+        NTCCFG_TEST_EQ(snapshot.total(), expected.total());
+        NTCCFG_TEST_EQ(snapshot.minimum(), expected.minimum());
+        NTCCFG_TEST_EQ(snapshot.maximum(), expected.maximum());
+        NTCCFG_TEST_EQ(snapshot.last(), expected.last());
+
+        NTCCFG_TEST_EQ(snapshotHistogram.summary().count(),
+                       expectedHistogram.summary().count());
+        NTCCFG_TEST_EQ(snapshotHistogram.percentile(0.50),
+                       expectedHistogram.percentile(0.50));
+        NTCCFG_TEST_EQ(snapshotHistogram.percentile(0.99),
+                       expectedHistogram.percentile(0.99));
+        NTCCFG_TEST_EQ(snapshotHistogram.percentile(1.0),
+                       expectedHistogram.percentile(1.0));
+
+        metric.load(&snapshot);
+        histogram.load(&snapshotHistogram);
+
+        NTCCFG_TEST_EQ(snapshot.count(), 0);
+        NTCCFG_TEST_EQ(snapshotHistogram.summary().count(), 0);
+
+        metric.update(42);
+        histogram.update(42);
+
+        metric.load(&snapshot);
+        histogram.load(&snapshotHistogram);
+
+        NTCCFG_TEST_EQ(snapshot.count(), 1);
+        NTCCFG_TEST_EQ(snapshot.total(), 42);
+        NTCCFG_TEST_EQ(snapshot.minimum(), 42);
+        NTCCFG_TEST_EQ(snapshot.maximum(), 42);
+
+        NTCCFG_TEST_EQ(snapshotHistogram.summary().count(), 1);
+        NTCCFG_TEST_EQ(snapshotHistogram.percentile(0.50), 42);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+    NTCCFG_TEST_REGISTER(3);
+    NTCCFG_TEST_REGISTER(4);
 }
 NTCCFG_TEST_DRIVER_END;
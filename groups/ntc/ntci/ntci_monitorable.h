@@ -118,11 +118,19 @@ class Monitorable : public virtual Identifiable
         // the result is the maximum of the maximums over the aggregated
         // interval.
 
-        e_AVERAGE
+        e_AVERAGE,
         // The statistic represents the average of a number of measurements
         // over an interval. When statistics of this type are aggregated
         // the result is the sum of the averages divided by the number
         // of aggregated averages; i.e., the average of averages.
+
+        e_HISTOGRAM
+        // The statistic represents a percentile of a number of measurements
+        // over an interval, estimated from a histogram of those
+        // measurements. Percentiles cannot be aggregated exactly, so when
+        // statistics of this type are aggregated the result is the maximum
+        // of the percentiles over the aggregated interval; i.e., an upper
+        // bound.
     };
 
     enum StatisticTag {
@@ -25,5 +25,10 @@ Proactor::~Proactor()
 {
 }
 
+bool Proactor::supportsProvidedBuffers() const
+{
+    return false;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -185,6 +185,16 @@ class Proactor : public ntci::Driver, public ntci::ProactorPool
 
     /// Return the data pool.
     virtual const bsl::shared_ptr<ntci::DataPool>& dataPool() const = 0;
+
+    /// Return true if the proactor selects the buffer into which data
+    /// incoming to a stream socket is copied at the time that data arrives,
+    /// from a set of buffers it provides to the operating system, otherwise
+    /// return false. When this function returns true, stream sockets should
+    /// not reserve capacity in the destination of a receive operation before
+    /// that operation is initiated; the proactor appends each buffer it
+    /// selects to the destination when the operation completes. The default
+    /// implementation returns false.
+    virtual bool supportsProvidedBuffers() const;
 };
 
 }  // close package namespace
@@ -71,6 +71,15 @@ class ProactorMetrics : public ntci::Monitorable
     /// Log the specified 'duration' in the function to process a readable
     /// socket.
     virtual void logErrorCallback(const bsls::TimeInterval& duration) = 0;
+
+    /// Log the specified 'numRetries' attempts to reserve an entry in the
+    /// submission queue that had to be retried because another thread
+    /// reserved or published an entry concurrently, the specified 'numFull'
+    /// encounters of a full submission queue, and the specified
+    /// 'numWakeups' wakeups of a kernel thread polling the submission queue.
+    virtual void logSubmissionContention(bsl::size_t numRetries,
+                                         bsl::size_t numFull,
+                                         bsl::size_t numWakeups) = 0;
 };
 
 #if NTC_BUILD_WITH_METRICS
@@ -98,6 +107,12 @@ class ProactorMetrics : public ntci::Monitorable
         metrics->logSpuriousWakeup();                                         \
     }
 
+#define NTCI_PROACTORMETRICS_UPDATE_SUBMISSION_CONTENTION(                    \
+    numRetries, numFull, numWakeups)                                          \
+    if (metrics) {                                                            \
+        metrics->logSubmissionContention(numRetries, numFull, numWakeups);    \
+    }
+
 #define NTCI_PROACTORMETRICS_UPDATE_ERROR_CALLBACK_TIME_BEGIN()               \
     bsl::int64_t errorProcessingStartTime;                                    \
     if (metrics) {                                                            \
@@ -162,6 +177,8 @@ class ProactorMetrics : public ntci::Monitorable
 #define NTCI_PROACTORMETRICS_UPDATE_POLL(numReadable, numWritable, numErrors)
 #define NTCI_PROACTORMETRICS_UPDATE_DEFERRED_SOCKET()
 #define NTCI_PROACTORMETRICS_UPDATE_SPURIOUS_WAKEUP()
+#define NTCI_PROACTORMETRICS_UPDATE_SUBMISSION_CONTENTION(                    \
+    numRetries, numFull, numWakeups)
 #define NTCI_PROACTORMETRICS_UPDATE_ERROR_CALLBACK_TIME_BEGIN()
 #define NTCI_PROACTORMETRICS_UPDATE_ERROR_CALLBACK_TIME_END()
 #define NTCI_PROACTORMETRICS_UPDATE_WRITE_CALLBACK_TIME_BEGIN()
@@ -71,6 +71,13 @@ class ReactorMetrics : public ntci::Monitorable
     /// Log the specified 'duration' in the function to process a readable
     /// socket.
     virtual void logErrorCallback(const bsls::TimeInterval& duration) = 0;
+
+    /// Log the application of the specified 'numUpdates' changes in the
+    /// interest of sockets to the polling device using the specified
+    /// 'numApplied' system calls, i.e., saving 'numUpdates - numApplied'
+    /// system calls by coalescing redundant changes.
+    virtual void logInterestUpdates(bsl::size_t numUpdates,
+                                    bsl::size_t numApplied) = 0;
 };
 
 #if NTC_BUILD_WITH_METRICS
@@ -98,6 +105,11 @@ class ReactorMetrics : public ntci::Monitorable
         metrics->logSpuriousWakeup();                                         \
     }
 
+#define NTCI_REACTORMETRICS_UPDATE_INTEREST(numUpdates, numApplied)          \
+    if (metrics) {                                                            \
+        metrics->logInterestUpdates(numUpdates, numApplied);                  \
+    }
+
 #define NTCI_REACTORMETRICS_UPDATE_ERROR_CALLBACK_TIME_BEGIN()                \
     bsl::int64_t errorProcessingStartTime;                                    \
     if (metrics) {                                                            \
@@ -162,6 +174,7 @@ class ReactorMetrics : public ntci::Monitorable
 #define NTCI_REACTORMETRICS_UPDATE_POLL(numReadable, numWritable, numErrors)
 #define NTCI_REACTORMETRICS_UPDATE_DEFERRED_SOCKET()
 #define NTCI_REACTORMETRICS_UPDATE_SPURIOUS_WAKEUP()
+#define NTCI_REACTORMETRICS_UPDATE_INTEREST(numUpdates, numApplied)
 #define NTCI_REACTORMETRICS_UPDATE_ERROR_CALLBACK_TIME_BEGIN()
 #define NTCI_REACTORMETRICS_UPDATE_ERROR_CALLBACK_TIME_END()
 #define NTCI_REACTORMETRICS_UPDATE_WRITE_CALLBACK_TIME_BEGIN()
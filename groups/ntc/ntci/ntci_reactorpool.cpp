@@ -18,6 +18,8 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(ntci_reactorpool_cpp, "$Id$ $CSID$")
 
+#include <ntci_strand.h>
+
 namespace BloombergLP {
 namespace ntci {
 
@@ -25,5 +27,22 @@ ReactorPool::~ReactorPool()
 {
 }
 
+ntsa::Error ReactorPool::executeHandshake(const HandshakeFunctor& functor)
+{
+    NTCCFG_WARNING_UNUSED(functor);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+bsl::shared_ptr<ntci::Strand> ReactorPool::createCallbackStrand(
+    const bsl::shared_ptr<ntci::Reactor>& reactor,
+    bslma::Allocator*                     basicAllocator)
+{
+    NTCCFG_WARNING_UNUSED(reactor);
+    NTCCFG_WARNING_UNUSED(basicAllocator);
+
+    return bsl::shared_ptr<ntci::Strand>();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
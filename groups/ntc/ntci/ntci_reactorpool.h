@@ -22,6 +22,8 @@ BSLS_IDENT("$Id: $")
 #include <ntca_loadbalancingoptions.h>
 #include <ntccfg_platform.h>
 #include <ntcscm_version.h>
+#include <ntsa_error.h>
+#include <bslma_allocator.h>
 #include <bsl_memory.h>
 
 namespace BloombergLP {
@@ -29,6 +31,9 @@ namespace ntci {
 class Reactor;
 }
 namespace ntci {
+class Strand;
+}
+namespace ntci {
 
 /// Provide a pool of reactors within which sockets are load balanced.
 ///
@@ -39,6 +44,10 @@ namespace ntci {
 class ReactorPool
 {
   public:
+    /// Define a type alias for a function that processes a step of the
+    /// handshake of a socket upgrading to encrypted communication.
+    typedef NTCCFG_FUNCTION() HandshakeFunctor;
+
     /// Destroy this object.
     virtual ~ReactorPool();
 
@@ -71,6 +80,27 @@ class ReactorPool
 
     /// Return the maximum number of threads in the thread pool.
     virtual bsl::size_t maxThreads() const = 0;
+
+    /// Defer the execution of the specified 'functor', which processes a
+    /// step of the handshake of a socket upgrading to encrypted
+    /// communication, to a thread dedicated to processing handshakes.
+    /// Return the error, notably 'ntsa::Error::e_NOT_IMPLEMENTED' if this
+    /// pool does not dedicate threads to processing handshakes, or
+    /// 'ntsa::Error::e_LIMIT' if the maximum number of handshake steps are
+    /// already pending processing. If an error is returned the 'functor' is
+    /// not executed, and the caller is expected to process the step itself.
+    virtual ntsa::Error executeHandshake(const HandshakeFunctor& functor);
+
+    /// Return a new strand on which the callbacks of a socket driven by the
+    /// specified 'reactor' should be invoked, so that their invocation may
+    /// migrate to other threads of this pool while the 'reactor' is busy.
+    /// Optionally specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used. Return null if the callbacks should be invoked on the strand,
+    /// if any, on which the readiness of the socket is processed.
+    virtual bsl::shared_ptr<ntci::Strand> createCallbackStrand(
+        const bsl::shared_ptr<ntci::Reactor>& reactor,
+        bslma::Allocator*                     basicAllocator = 0);
 };
 
 }  // end namespace ntci
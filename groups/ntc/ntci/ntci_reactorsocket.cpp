@@ -51,5 +51,10 @@ const bsl::shared_ptr<ntci::Strand>& ReactorSocket::strand() const
     return ntci::Strand::unspecified();
 }
 
+const bsl::shared_ptr<ntci::Strand>& ReactorSocket::reactorStrand() const
+{
+    return this->strand();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -94,6 +94,11 @@ class ReactorSocket : public ntci::ReactorSocketBase, public ntsi::Descriptor
 
     /// Return the strand on which this object's functions should be called.
     virtual const bsl::shared_ptr<ntci::Strand>& strand() const;
+
+    /// Return the strand on which the readiness of the socket detected by
+    /// its reactor should be processed. By default, return the strand on
+    /// which this object's functions should be called.
+    virtual const bsl::shared_ptr<ntci::Strand>& reactorStrand() const;
 };
 
 NTCCFG_INLINE
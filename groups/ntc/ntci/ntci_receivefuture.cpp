@@ -18,44 +18,47 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(ntci_receivefuture_cpp, "$Id$ $CSID$")
 
-#include <bdlf_memfn.h>
-#include <bslmt_lockguard.h>
-#include <bslscm_versiontag.h>
-
-#if BSL_VERSION >= BSL_MAKE_VERSION(3, 80)
-#define NTCI_RECEIVEFUTURE_TIMEOUT bslmt::Condition::e_TIMED_OUT
-#else
-#define NTCI_RECEIVEFUTURE_TIMEOUT -1
-#endif
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+#include <bslma_default.h>
 
 namespace BloombergLP {
 namespace ntci {
 
-void ReceiveFuture::arrive(const bsl::shared_ptr<ntci::Receiver>& receiver,
+void ReceiveFuture::arrive(const bsl::shared_ptr<ResultQueue>&    resultQueue,
+                           unsigned int                           generation,
+                           const bsl::shared_ptr<ntci::Receiver>& receiver,
                            const bsl::shared_ptr<bdlbb::Blob>&    data,
                            const ntca::ReceiveEvent&              event)
 {
     NTCCFG_WARNING_UNUSED(receiver);
 
-    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-
     ReceiveResult result;
     result.setReceiver(receiver);
     result.setData(data);
     result.setEvent(event);
 
-    d_resultQueue.push_back(result);
+    resultQueue->push(result, generation);
+}
 
-    d_condition.signal();
+void ReceiveFuture::arm(unsigned int generation)
+{
+    this->setFunction(bdlf::BindUtil::bind(&ReceiveFuture::arrive,
+                                           d_resultQueue_sp,
+                                           generation,
+                                           bdlf::PlaceHolders::_1,
+                                           bdlf::PlaceHolders::_2,
+                                           bdlf::PlaceHolders::_3));
 }
 
 ReceiveFuture::ReceiveFuture(bslma::Allocator* basicAllocator)
 : ntci::ReceiveCallback(basicAllocator)
-, d_mutex()
-, d_condition()
-, d_resultQueue(basicAllocator)
+, d_resultQueue_sp()
 {
-    this->setFunction(bdlf::MemFnUtil::memFn(&ReceiveFuture::arrive, this));
+    bslma::Allocator* allocator = bslma::Default::allocator(basicAllocator);
+    d_resultQueue_sp.createInplace(allocator, allocator);
+
+    this->arm(d_resultQueue_sp->generation());
 }
 
 ReceiveFuture::~ReceiveFuture()
@@ -64,40 +67,21 @@ ReceiveFuture::~ReceiveFuture()
 
 ntsa::Error ReceiveFuture::wait(ntci::ReceiveResult* result)
 {
-    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-
-    while (d_resultQueue.empty()) {
-        d_condition.wait(&d_mutex);
-    }
-
-    *result = d_resultQueue.front();
-    d_resultQueue.pop_front();
-
-    return ntsa::Error();
+    return d_resultQueue_sp->pop(result);
 }
 
 ntsa::Error ReceiveFuture::wait(ntci::ReceiveResult*      result,
                                 const bsls::TimeInterval& timeout)
 {
-    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-
-    while (d_resultQueue.empty()) {
-        int rc = d_condition.timedWait(&d_mutex, timeout);
-        if (rc == 0) {
-            break;
-        }
-        else if (rc == NTCI_RECEIVEFUTURE_TIMEOUT) {
-            return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
-        }
-        else {
-            return ntsa::Error(ntsa::Error::e_INVALID);
-        }
-    }
-
-    *result = d_resultQueue.front();
-    d_resultQueue.pop_front();
-
-    return ntsa::Error();
+    return d_resultQueue_sp->pop(result, timeout);
+}
+
+void ReceiveFuture::rearm()
+{
+    const unsigned int generation = d_resultQueue_sp->reset();
+
+    this->ntci::ReceiveCallback::reset();
+    this->arm(generation);
 }
 
 }  // close package namespace
@@ -18,42 +18,44 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(ntci_sendfuture_cpp, "$Id$ $CSID$")
 
-#include <bdlf_memfn.h>
-#include <bslmt_lockguard.h>
-#include <bslscm_versiontag.h>
-
-#if BSL_VERSION >= BSL_MAKE_VERSION(3, 80)
-#define NTCI_SENDFUTURE_TIMEOUT bslmt::Condition::e_TIMED_OUT
-#else
-#define NTCI_SENDFUTURE_TIMEOUT -1
-#endif
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+#include <bslma_default.h>
 
 namespace BloombergLP {
 namespace ntci {
 
-void SendFuture::arrive(const bsl::shared_ptr<ntci::Sender>& sender,
+void SendFuture::arrive(const bsl::shared_ptr<ResultQueue>&  resultQueue,
+                        unsigned int                         generation,
+                        const bsl::shared_ptr<ntci::Sender>& sender,
                         const ntca::SendEvent&               event)
 {
     NTCCFG_WARNING_UNUSED(sender);
 
-    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-
     SendResult result;
     result.setSender(sender);
     result.setEvent(event);
 
-    d_resultQueue.push_back(result);
+    resultQueue->push(result, generation);
+}
 
-    d_condition.signal();
+void SendFuture::arm(unsigned int generation)
+{
+    this->setFunction(bdlf::BindUtil::bind(&SendFuture::arrive,
+                                           d_resultQueue_sp,
+                                           generation,
+                                           bdlf::PlaceHolders::_1,
+                                           bdlf::PlaceHolders::_2));
 }
 
 SendFuture::SendFuture(bslma::Allocator* basicAllocator)
 : ntci::SendCallback(basicAllocator)
-, d_mutex()
-, d_condition()
-, d_resultQueue(basicAllocator)
+, d_resultQueue_sp()
 {
-    this->setFunction(bdlf::MemFnUtil::memFn(&SendFuture::arrive, this));
+    bslma::Allocator* allocator = bslma::Default::allocator(basicAllocator);
+    d_resultQueue_sp.createInplace(allocator, allocator);
+
+    this->arm(d_resultQueue_sp->generation());
 }
 
 SendFuture::~SendFuture()
@@ -62,40 +64,21 @@ SendFuture::~SendFuture()
 
 ntsa::Error SendFuture::wait(ntci::SendResult* result)
 {
-    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-
-    while (d_resultQueue.empty()) {
-        d_condition.wait(&d_mutex);
-    }
-
-    *result = d_resultQueue.front();
-    d_resultQueue.pop_front();
-
-    return ntsa::Error();
+    return d_resultQueue_sp->pop(result);
 }
 
 ntsa::Error SendFuture::wait(ntci::SendResult*         result,
                              const bsls::TimeInterval& timeout)
 {
-    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-
-    while (d_resultQueue.empty()) {
-        int rc = d_condition.timedWait(&d_mutex, timeout);
-        if (rc == 0) {
-            break;
-        }
-        else if (rc == NTCI_SENDFUTURE_TIMEOUT) {
-            return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
-        }
-        else {
-            return ntsa::Error(ntsa::Error::e_INVALID);
-        }
-    }
-
-    *result = d_resultQueue.front();
-    d_resultQueue.pop_front();
-
-    return ntsa::Error();
+    return d_resultQueue_sp->pop(result, timeout);
+}
+
+void SendFuture::rearm()
+{
+    const unsigned int generation = d_resultQueue_sp->reset();
+
+    this->ntci::SendCallback::reset();
+    this->arm(generation);
 }
 
 }  // close package namespace
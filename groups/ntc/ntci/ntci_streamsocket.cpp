@@ -27,6 +27,20 @@ StreamSocket::~StreamSocket()
 {
 }
 
+ntsa::Error StreamSocket::receive(ntca::ReceiveContext*       context,
+                                  bsl::size_t*                numBytesReceived,
+                                  const ntsa::MutableBuffer&  buffer,
+                                  const ntca::ReceiveOptions& options)
+{
+    NTCCFG_WARNING_UNUSED(context);
+    NTCCFG_WARNING_UNUSED(buffer);
+    NTCCFG_WARNING_UNUSED(options);
+
+    *numBytesReceived = 0;
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
 ntsa::Error StreamSocket::setZeroCopyThreshold(bsl::size_t value)
 {
     NTCCFG_WARNING_UNUSED(value);
@@ -1362,6 +1362,31 @@ class StreamSocket : public ntsi::Descriptor,
                                 bdlbb::Blob*                data,
                                 const ntca::ReceiveOptions& options) = 0;
 
+    /// Dequeue received data according to the specified 'options' into the
+    /// caller-owned storage described by the specified 'buffer', and load
+    /// into the specified 'numBytesReceived' the number of bytes copied to
+    /// the 'buffer'. At most the lesser of 'options.maxSize()' and
+    /// 'buffer.size()' bytes are copied. If the read queue has sufficient
+    /// size to satisfy the read operation, synchronously copy the read queue
+    /// into the 'buffer'. Otherwise, if the read queue is empty and no
+    /// other read operations are queued, attempt to copy the socket receive
+    /// buffer directly into the 'buffer', bypassing the read queue, so that
+    /// no intermediate blob buffers are allocated or copied; any bytes so
+    /// copied that do not satisfy 'options.minSize()' are enqueued onto the
+    /// read queue. Return the error, notably 'ntsa::Error::e_WOULD_BLOCK' if
+    /// neither the read queue nor the socket receive buffer has sufficient
+    /// size to satisfy the read operation, 'ntsa::Error::e_EOF' if the read
+    /// queue is empty and the socket receive buffer has been shut down, or
+    /// 'ntsa::Error::e_INVALID' if 'options.minSize()' is greater than
+    /// 'buffer.size()'. All other errors indicate no more received data is
+    /// available at this time or will become available in the future. Note
+    /// that the default implementation returns
+    /// 'ntsa::Error::e_NOT_IMPLEMENTED'.
+    virtual ntsa::Error receive(ntca::ReceiveContext*       context,
+                                bsl::size_t*                numBytesReceived,
+                                const ntsa::MutableBuffer&  buffer,
+                                const ntca::ReceiveOptions& options);
+
     /// Dequeue received data according to the specified 'options'. If the
     /// read queue has sufficient size to satisfy the read operation,
     /// synchronously copy the read queue into an internally allocated data
@@ -63,6 +63,9 @@ const char* describeStatisticType(ntci::Monitorable::StatisticType type)
     case ntci::Monitorable::e_AVERAGE:
         return "AVERAGE";
         break;
+    case ntci::Monitorable::e_HISTOGRAM:
+        return "HISTOGRAM";
+        break;
     }
 
     return "UNKNOWN";
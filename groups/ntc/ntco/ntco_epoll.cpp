@@ -36,6 +36,7 @@ BSLS_IDENT_RCSID(ntco_epoll_cpp, "$Id$ $CSID$")
 #include <ntcs_controller.h>
 #include <ntcs_datapool.h>
 #include <ntcs_driver.h>
+#include <ntcs_interestjournal.h>
 #include <ntcs_nomenclature.h>
 #include <ntcs_reactormetrics.h>
 #include <ntcs_registry.h>
@@ -259,6 +260,20 @@ class Epoll : public ntci::Reactor,
                        ntcs::Interest interest,
                        UpdateType     type);
 
+    /// Update the specified 'entry' with the specified 'interest' in the
+    /// device, unless the calling thread is a waiter journaling changes in
+    /// interest, in which case record the change in the journal of the
+    /// calling thread to be applied before the calling thread next blocks.
+    /// The specified 'type' indicates whether events have been included or
+    /// excluded as a result of the update. Return the error.
+    ntsa::Error update(const bsl::shared_ptr<ntcs::RegistryEntry>& entry,
+                       ntcs::Interest                              interest,
+                       UpdateType                                  type);
+
+    /// Apply the changes in interest recorded in the journal of the
+    /// specified 'result' to the device, then clear the journal.
+    void flushJournal(Result* result);
+
     /// Remove the specified 'handle' from the device.
     ntsa::Error remove(ntsa::Handle handle);
 
@@ -536,6 +551,10 @@ class Epoll : public ntci::Reactor,
     void moveAndExecute(FunctorSequence* functorSequence,
                         const Functor&   functor) BSLS_KEYWORD_OVERRIDE;
 
+    /// Defer the execution of the callable object stored by the specified
+    /// 'functor', leaving the 'functor' empty.
+    void executeInplace(InplaceFunctor* functor) BSLS_KEYWORD_OVERRIDE;
+
     /// Create a new timer according to the specified 'options' that invokes
     /// the specified 'session' for each timer event on this object's
     /// 'strand()', if defined, or on an unspecified thread otherwise.
@@ -712,25 +731,32 @@ struct Epoll::Result {
     ntca::WaiterOptions                     d_options;
     bsl::shared_ptr<ntci::ReactorMetrics>   d_metrics_sp;
     bdlb::NullableValue<bsls::TimeInterval> d_earliestTimerDue;
+    ntcs::Chronology*                       d_shard_p;
+    ntcs::InterestJournal                   d_journal;
 
   private:
     Result(const Result&) BSLS_KEYWORD_DELETED;
     Result& operator=(const Result&) BSLS_KEYWORD_DELETED;
 
   public:
-    /// Create a new reactor result. Optionally specify a 'basicAllocator'
-    /// used to supply memory. If 'basicAllocator' is 0, the currently
-    /// installed default allocator is used.
-    explicit Result(bslma::Allocator* basicAllocator = 0);
+    /// Create a new reactor result for a waiter of the specified 'driver'.
+    /// Optionally specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
+    explicit Result(const ntcs::Driver* driver,
+                    bslma::Allocator*   basicAllocator = 0);
 
     /// Destroy this object.
     ~Result();
 };
 
-Epoll::Result::Result(bslma::Allocator* basicAllocator)
+Epoll::Result::Result(const ntcs::Driver* driver,
+                      bslma::Allocator*   basicAllocator)
 : d_options(basicAllocator)
 , d_metrics_sp()
 , d_earliestTimerDue()
+, d_shard_p(0)
+, d_journal(driver, basicAllocator)
 {
 }
 
@@ -854,6 +880,61 @@ ntsa::Error Epoll::update(ntsa::Handle   handle,
     }
 }
 
+NTCCFG_INLINE
+ntsa::Error Epoll::update(const bsl::shared_ptr<ntcs::RegistryEntry>& entry,
+                          ntcs::Interest                              interest,
+                          UpdateType                                  type)
+{
+    if (d_config.interestJournal().value()) {
+        ntcs::InterestJournal* journal = ntcs::InterestJournal::lookup(this);
+        if (journal != 0) {
+            journal->record(entry);
+            return ntsa::Error();
+        }
+    }
+
+    return this->update(entry->handle(), interest, type);
+}
+
+void Epoll::flushJournal(Epoll::Result* result)
+{
+    ntcs::InterestJournal* journal = &result->d_journal;
+
+    if (NTCCFG_LIKELY(journal->isEmpty())) {
+        return;
+    }
+
+    NTCS_METRICS_GET();
+
+    // Apply the interest of each entry at the time the journal is flushed,
+    // which coalesces every change to the entry recorded since the journal
+    // was last flushed. Note that an entry removed from the registry after
+    // its interest changed is skipped: updating the device would otherwise
+    // re-add its handle, which might since have been closed or reused.
+
+    bsl::size_t numApplied = 0;
+
+    const ntcs::InterestJournal::EntryVector& entries = journal->entries();
+
+    for (ntcs::InterestJournal::EntryVector::const_iterator it =
+             entries.begin();
+         it != entries.end();
+         ++it)
+    {
+        const bsl::shared_ptr<ntcs::RegistryEntry>& entry = *it;
+        if (!entry->active()) {
+            continue;
+        }
+
+        this->update(entry->handle(), entry->interest(), e_INCLUDE);
+        ++numApplied;
+    }
+
+    NTCS_METRICS_UPDATE_INTEREST(journal->numUpdates(), numApplied);
+
+    journal->clear();
+}
+
 NTCCFG_INLINE
 ntsa::Error Epoll::remove(ntsa::Handle handle)
 {
@@ -1159,6 +1240,46 @@ Epoll::Epoll(const ntca::ReactorConfig&         configuration,
         d_config.setMetricCollectionPerSocket(false);
     }
 
+    if (d_config.timerWheel().isNull()) {
+        d_config.setTimerWheel(NTCCFG_DEFAULT_TIMER_WHEEL);
+    }
+
+    if (d_config.timerWheelResolution().isNull()) {
+        bsls::TimeInterval timerWheelResolution;
+        timerWheelResolution.setTotalMicroseconds(
+            NTCCFG_DEFAULT_TIMER_WHEEL_RESOLUTION);
+
+        d_config.setTimerWheelResolution(timerWheelResolution);
+    }
+
+    if (d_config.timerWheel().value()) {
+        ntsa::Error error = d_chronology.configureTimerWheel(
+            d_config.timerWheelResolution().value());
+        if (error) {
+            d_config.setTimerWheel(false);
+        }
+    }
+
+    if (d_config.chronologySharding().isNull()) {
+        d_config.setChronologySharding(NTCCFG_DEFAULT_CHRONOLOGY_SHARDING);
+    }
+
+    if (d_config.chronologySharding().value()) {
+        ntsa::Error error = ntsa::Error(ntsa::Error::e_INVALID);
+        if (d_config.maxThreads().value() > 1) {
+            error = d_chronology.configureShards(
+                d_config.maxThreads().value());
+        }
+
+        if (error) {
+            d_config.setChronologySharding(false);
+        }
+    }
+
+    if (d_config.interestJournal().isNull()) {
+        d_config.setInterestJournal(NTCCFG_DEFAULT_INTEREST_JOURNAL);
+    }
+
     if (d_config.autoAttach().isNull()) {
         d_config.setAutoAttach(false);
     }
@@ -1301,7 +1422,8 @@ Epoll::~Epoll()
 
 ntci::Waiter Epoll::registerWaiter(const ntca::WaiterOptions& waiterOptions)
 {
-    Epoll::Result* result = new (*d_allocator_p) Epoll::Result(d_allocator_p);
+    Epoll::Result* result =
+        new (*d_allocator_p) Epoll::Result(this, d_allocator_p);
 
     result->d_options = waiterOptions;
 
@@ -1357,6 +1479,8 @@ ntci::Waiter Epoll::registerWaiter(const ntca::WaiterOptions& waiterOptions)
             bslmt::ThreadUtil::handleToId(principleThreadHandle.value())));
     }
 
+    result->d_shard_p = d_chronology.acquireShard();
+
     return result;
 }
 
@@ -1364,6 +1488,11 @@ void Epoll::deregisterWaiter(ntci::Waiter waiter)
 {
     Epoll::Result* result = static_cast<Epoll::Result*>(waiter);
 
+    if (result->d_shard_p != 0) {
+        d_chronology.releaseShard(result->d_shard_p);
+        result->d_shard_p = 0;
+    }
+
     bool nowEmpty = false;
 
     {
@@ -1447,7 +1576,7 @@ ntsa::Error Epoll::showReadable(
     if (NTCCFG_LIKELY(entry)) {
         ntcs::Interest interest = entry->showReadable(options);
 
-        error = this->update(entry->handle(), interest, e_INCLUDE);
+        error = this->update(entry, interest, e_INCLUDE);
         if (error) {
             return error;
         }
@@ -1505,7 +1634,7 @@ ntsa::Error Epoll::showReadable(ntsa::Handle                      handle,
         ntcs::Interest interest =
             entry->showReadableCallback(options, callback);
 
-        error = this->update(handle, interest, e_INCLUDE);
+        error = this->update(entry, interest, e_INCLUDE);
         if (error) {
             return error;
         }
@@ -1569,7 +1698,7 @@ ntsa::Error Epoll::showWritable(
     if (NTCCFG_LIKELY(entry)) {
         ntcs::Interest interest = entry->showWritable(options);
 
-        error = this->update(entry->handle(), interest, e_INCLUDE);
+        error = this->update(entry, interest, e_INCLUDE);
         if (error) {
             return error;
         }
@@ -1629,7 +1758,7 @@ ntsa::Error Epoll::showWritable(ntsa::Handle                      handle,
         ntcs::Interest interest =
             entry->showWritableCallback(options, callback);
 
-        error = this->update(handle, interest, e_INCLUDE);
+        error = this->update(entry, interest, e_INCLUDE);
         if (error) {
             return error;
         }
@@ -1692,7 +1821,7 @@ ntsa::Error Epoll::showError(
     if (NTCCFG_LIKELY(entry)) {
         ntcs::Interest interest = entry->showError(options);
 
-        error = this->update(entry->handle(), interest, e_INCLUDE);
+        error = this->update(entry, interest, e_INCLUDE);
         if (error) {
             return error;
         }
@@ -1752,7 +1881,7 @@ ntsa::Error Epoll::showError(ntsa::Handle                      handle,
     if (NTCCFG_LIKELY(found)) {
         ntcs::Interest interest = entry->showErrorCallback(options, callback);
 
-        error = this->update(handle, interest, e_INCLUDE);
+        error = this->update(entry, interest, e_INCLUDE);
         if (error) {
             return error;
         }
@@ -1798,7 +1927,7 @@ ntsa::Error Epoll::showNotifications(
     if (NTCCFG_LIKELY(entry)) {
         ntcs::Interest interest = entry->showNotifications();
 
-        error = this->update(entry->handle(), interest, e_INCLUDE);
+        error = this->update(entry, interest, e_INCLUDE);
         if (error) {
             return error;
         }
@@ -1842,7 +1971,7 @@ ntsa::Error Epoll::showNotifications(
     if (NTCCFG_LIKELY(found)) {
         ntcs::Interest interest = entry->showNotificationsCallback(callback);
 
-        error = this->update(handle, interest, e_INCLUDE);
+        error = this->update(entry, interest, e_INCLUDE);
         if (error) {
             return error;
         }
@@ -1887,11 +2016,11 @@ ntsa::Error Epoll::hideReadable(
         ntca::ReactorEventOptions options;
         ntcs::Interest            interest = entry->hideReadable(options);
         if (!d_config.autoDetach().value()) {
-            return this->update(entry->handle(), interest, e_EXCLUDE);
+            return this->update(entry, interest, e_EXCLUDE);
         }
         else {
             if (interest.wantReadableOrWritable()) {
-                return this->update(entry->handle(), interest, e_EXCLUDE);
+                return this->update(entry, interest, e_EXCLUDE);
             }
             else {
                 d_registry.remove(socket);
@@ -1912,11 +2041,11 @@ ntsa::Error Epoll::hideReadable(ntsa::Handle handle)
         ntca::ReactorEventOptions options;
         ntcs::Interest interest = entry->hideReadableCallback(options);
         if (!d_config.autoDetach().value()) {
-            return this->update(handle, interest, e_EXCLUDE);
+            return this->update(entry, interest, e_EXCLUDE);
         }
         else {
             if (interest.wantReadableOrWritable()) {
-                return this->update(handle, interest, e_EXCLUDE);
+                return this->update(entry, interest, e_EXCLUDE);
             }
             else {
                 d_registry.remove(handle);
@@ -1940,11 +2069,11 @@ ntsa::Error Epoll::hideWritable(
         ntca::ReactorEventOptions options;
         ntcs::Interest            interest = entry->hideWritable(options);
         if (!d_config.autoDetach().value()) {
-            return this->update(entry->handle(), interest, e_EXCLUDE);
+            return this->update(entry, interest, e_EXCLUDE);
         }
         else {
             if (interest.wantReadableOrWritable()) {
-                return this->update(entry->handle(), interest, e_EXCLUDE);
+                return this->update(entry, interest, e_EXCLUDE);
             }
             else {
                 d_registry.remove(socket);
@@ -1965,11 +2094,11 @@ ntsa::Error Epoll::hideWritable(ntsa::Handle handle)
         ntca::ReactorEventOptions options;
         ntcs::Interest interest = entry->hideWritableCallback(options);
         if (!d_config.autoDetach().value()) {
-            return this->update(handle, interest, e_EXCLUDE);
+            return this->update(entry, interest, e_EXCLUDE);
         }
         else {
             if (interest.wantReadableOrWritable()) {
-                return this->update(handle, interest, e_EXCLUDE);
+                return this->update(entry, interest, e_EXCLUDE);
             }
             else {
                 d_registry.remove(handle);
@@ -1993,11 +2122,11 @@ ntsa::Error Epoll::hideError(
         ntca::ReactorEventOptions options;
         ntcs::Interest            interest = entry->hideError(options);
         if (!d_config.autoDetach().value()) {
-            return this->update(entry->handle(), interest, e_EXCLUDE);
+            return this->update(entry, interest, e_EXCLUDE);
         }
         else {
             if (interest.wantReadableOrWritable()) {
-                return this->update(entry->handle(), interest, e_EXCLUDE);
+                return this->update(entry, interest, e_EXCLUDE);
             }
             else {
                 d_registry.remove(socket);
@@ -2018,11 +2147,11 @@ ntsa::Error Epoll::hideError(ntsa::Handle handle)
         ntca::ReactorEventOptions options;
         ntcs::Interest            interest = entry->hideErrorCallback(options);
         if (!d_config.autoDetach().value()) {
-            return this->update(handle, interest, e_EXCLUDE);
+            return this->update(entry, interest, e_EXCLUDE);
         }
         else {
             if (interest.wantReadableOrWritable()) {
-                return this->update(handle, interest, e_EXCLUDE);
+                return this->update(entry, interest, e_EXCLUDE);
             }
             else {
                 d_registry.remove(handle);
@@ -2045,12 +2174,12 @@ ntsa::Error Epoll::hideNotifications(
     if (NTCCFG_LIKELY(entry)) {
         ntcs::Interest interest = entry->hideNotifications();
         if (!d_config.autoDetach().value()) {
-            return this->update(entry->handle(), interest, e_EXCLUDE);
+            return this->update(entry, interest, e_EXCLUDE);
         }
         else {
             if (interest.wantReadableOrWritable())
             {  //wantReadableOrWritableOrError?
-                return this->update(entry->handle(), interest, e_EXCLUDE);
+                return this->update(entry, interest, e_EXCLUDE);
             }
             else {
                 d_registry.remove(socket);
@@ -2070,11 +2199,11 @@ ntsa::Error Epoll::hideNotifications(ntsa::Handle handle)
     if (NTCCFG_LIKELY(found)) {
         ntcs::Interest interest = entry->hideNotifications();
         if (!d_config.autoDetach().value()) {
-            return this->update(handle, interest, e_EXCLUDE);
+            return this->update(entry, interest, e_EXCLUDE);
         }
         else {
             if (interest.wantReadableOrWritable()) {
-                return this->update(handle, interest, e_EXCLUDE);
+                return this->update(entry, interest, e_EXCLUDE);
             }
             else {
                 d_registry.remove(handle);
@@ -2153,6 +2282,11 @@ void Epoll::run(ntci::Waiter waiter)
 
     NTCCFG_WARNING_UNUSED(result);
 
+    ntcs::ChronologyGuard chronologyGuard(result->d_shard_p);
+
+    ntcs::InterestJournalGuard journalGuard(
+        d_config.interestJournal().value() ? &result->d_journal : 0);
+
     NTCS_METRICS_GET();
 
     while (d_run) {
@@ -2230,6 +2364,8 @@ void Epoll::run(ntci::Waiter waiter)
         //     return ntsa::Error();
         // }
 
+        this->flushJournal(result);
+
         enum { MAX_EVENTS = 128 };
         struct ::epoll_event results[MAX_EVENTS];
 
@@ -2355,6 +2491,11 @@ void Epoll::run(ntci::Waiter waiter)
                         }
 
                         if (e.events == EPOLLHUP) {
+                            // Apply any journaled change in interest first, so
+                            // that the socket remains removed as if the change
+                            // had been applied immediately.
+
+                            this->flushJournal(result);
                             this->remove(entry->handle());
                         }
                     }
@@ -2377,9 +2518,7 @@ void Epoll::run(ntci::Waiter waiter)
                                     ntca::ReactorEventOptions options;
                                     ntcs::Interest            interest =
                                         entry->showReadable(options);
-                                    this->update(entry->handle(),
-                                                 interest,
-                                                 e_INCLUDE);
+                                    this->update(entry, interest, e_INCLUDE);
                                 }
                             }
                         }
@@ -2440,6 +2579,8 @@ void Epoll::run(ntci::Waiter waiter)
             }
         }
     }
+
+    this->flushJournal(result);
 }
 
 void Epoll::poll(ntci::Waiter waiter)
@@ -2453,6 +2594,11 @@ void Epoll::poll(ntci::Waiter waiter)
 
     NTCCFG_WARNING_UNUSED(result);
 
+    ntcs::ChronologyGuard chronologyGuard(result->d_shard_p);
+
+    ntcs::InterestJournalGuard journalGuard(
+        d_config.interestJournal().value() ? &result->d_journal : 0);
+
     NTCS_METRICS_GET();
 
     int wait = -1;
@@ -2529,6 +2675,8 @@ void Epoll::poll(ntci::Waiter waiter)
     //     return ntsa::Error();
     // }
 
+    this->flushJournal(result);
+
     enum { MAX_EVENTS = 128 };
     struct ::epoll_event results[MAX_EVENTS];
 
@@ -2650,6 +2798,11 @@ void Epoll::poll(ntci::Waiter waiter)
                     }
 
                     if (e.events == EPOLLHUP) {
+                        // Apply any journaled change in interest first, so
+                        // that the socket remains removed as if the change
+                        // had been applied immediately.
+
+                        this->flushJournal(result);
                         this->remove(entry->handle());
                     }
                 }
@@ -2670,9 +2823,7 @@ void Epoll::poll(ntci::Waiter waiter)
                                 ntca::ReactorEventOptions options;
                                 ntcs::Interest            interest =
                                     entry->showReadable(options);
-                                this->update(entry->handle(),
-                                             interest,
-                                             e_INCLUDE);
+                                this->update(entry, interest, e_INCLUDE);
                             }
                         }
                     }
@@ -2730,6 +2881,8 @@ void Epoll::poll(ntci::Waiter waiter)
             break;
         }
     }
+
+    this->flushJournal(result);
 }
 
 void Epoll::interruptOne()
@@ -2837,15 +2990,18 @@ void Epoll::clear()
 
 void Epoll::execute(const Functor& functor)
 {
-    d_chronology.defer(functor);
-    Epoll::interruptAll();
+    d_chronology.execute(functor);
 }
 
 void Epoll::moveAndExecute(FunctorSequence* functorSequence,
                            const Functor&   functor)
 {
-    d_chronology.defer(functorSequence, functor);
-    Epoll::interruptAll();
+    d_chronology.moveAndExecute(functorSequence, functor);
+}
+
+void Epoll::executeInplace(InplaceFunctor* functor)
+{
+    d_chronology.executeInplace(functor);
 }
 
 bsl::shared_ptr<ntci::Timer> Epoll::createTimer(
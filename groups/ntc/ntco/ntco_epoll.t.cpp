@@ -1195,11 +1195,175 @@ NTCCFG_TEST_CASE(3)
     NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+namespace test {
+namespace case4 {
+
+/// Process the writability of the socket identified by the specified
+/// 'event' polled by the specified 'reactor'. Arrive at the specified
+/// 'latch' and, unless the latch has been reached, lose then regain
+/// interest in the writability of the socket, from the waiter thread.
+ntsa::Error processWritable(ntci::Reactor*            reactor,
+                            bslmt::Latch*             latch,
+                            const ntca::ReactorEvent& event)
+{
+    latch->arrive();
+
+    if (latch->currentCount() != 0) {
+        ntca::ReactorEventOptions options;
+        options.setOneShot(true);
+
+        reactor->hideWritable(event.handle());
+        reactor->showWritable(
+            event.handle(),
+            options,
+            ntci::ReactorEventCallback(
+                NTCCFG_BIND(&test::case4::processWritable,
+                            reactor,
+                            latch,
+                            NTCCFG_BIND_PLACEHOLDER_1)));
+        reactor->hideWritable(event.handle());
+        reactor->showWritable(
+            event.handle(),
+            options,
+            ntci::ReactorEventCallback(
+                NTCCFG_BIND(&test::case4::processWritable,
+                            reactor,
+                            latch,
+                            NTCCFG_BIND_PLACEHOLDER_1)));
+    }
+
+    return ntsa::Error();
+}
+
+void processSocketDetached(bool* flag)
+{
+    *flag = true;
+}
+
+void execute(bslma::Allocator* allocator)
+{
+    ntsa::Error error;
+
+    const bsl::size_t k_NUM_EVENTS = 16;
+
+    // Create the user.
+
+    bsl::shared_ptr<ntci::User> user;
+
+    // Create the reactor, journaling changes in interest made while
+    // polling.
+
+    ntca::ReactorConfig reactorConfig;
+
+    reactorConfig.setMetricName("test");
+    reactorConfig.setMinThreads(1);
+    reactorConfig.setMaxThreads(1);
+    reactorConfig.setOneShot(true);
+    reactorConfig.setInterestJournal(true);
+
+    bsl::shared_ptr<ntco::EpollFactory> reactorFactory;
+    reactorFactory.createInplace(allocator, allocator);
+
+    bsl::shared_ptr<ntci::Reactor> reactor =
+        reactorFactory->createReactor(reactorConfig, user, allocator);
+
+    // Register this thread as the thread that will wait on the reactor.
+
+    ntci::Waiter waiter = reactor->registerWaiter(ntca::WaiterOptions());
+
+    // Create a connected pair of sockets and attach the client to the
+    // reactor.
+
+    bsl::shared_ptr<ntsi::StreamSocket> client;
+    bsl::shared_ptr<ntsi::StreamSocket> server;
+
+    error = ntsf::System::createStreamSocketPair(
+        &client,
+        &server,
+        ntsa::Transport::e_TCP_IPV4_STREAM,
+        allocator);
+    NTCCFG_TEST_OK(error);
+
+    error = client->setBlocking(false);
+    NTCCFG_TEST_OK(error);
+
+    error = reactor->attachSocket(client->handle());
+    NTCCFG_TEST_OK(error);
+
+    // Become interested in the writability of the client, once. Each time
+    // the client is polled as writable, the interest is regained from within
+    // the callback, which must be applied before the waiter next blocks for
+    // the client to be polled as writable again.
+
+    bslmt::Latch latch(k_NUM_EVENTS);
+
+    ntca::ReactorEventOptions options;
+    options.setOneShot(true);
+
+    error = reactor->showWritable(
+        client->handle(),
+        options,
+        ntci::ReactorEventCallback(
+            NTCCFG_BIND(&test::case4::processWritable,
+                        reactor.get(),
+                        &latch,
+                        NTCCFG_BIND_PLACEHOLDER_1)));
+    NTCCFG_TEST_OK(error);
+
+    while (!latch.tryWait()) {
+        reactor->poll(waiter);
+    }
+
+    // Detach the client from the reactor.
+
+    bool clientDetached = false;
+
+    error = reactor->detachSocket(
+        client->handle(),
+        ntci::SocketDetachedCallback(
+            NTCCFG_BIND(&test::case4::processSocketDetached,
+                        &clientDetached),
+            allocator));
+    NTCCFG_TEST_OK(error);
+
+    while (!clientDetached) {
+        reactor->poll(waiter);
+    }
+
+    NTCCFG_TEST_EQ(reactor->numSockets(), 0);
+
+    // Deregister the waiter.
+
+    reactor->deregisterWaiter(waiter);
+
+    client->close();
+    server->close();
+}
+
+}  // close namespace case4
+}  // close namespace test
+
+NTCCFG_TEST_CASE(4)
+{
+    // Concern: Changes in interest made by the waiter thread while polling
+    // are journaled and applied before the waiter next blocks.
+
+    NTCI_LOG_CONTEXT();
+    NTCI_LOG_CONTEXT_GUARD_OWNER("test");
+
+    ntccfg::TestAllocator ta;
+    {
+        test::case4::execute(&ta);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
     NTCCFG_TEST_REGISTER(2);
     NTCCFG_TEST_REGISTER(3);
+    NTCCFG_TEST_REGISTER(4);
 }
 NTCCFG_TEST_DRIVER_END;
 
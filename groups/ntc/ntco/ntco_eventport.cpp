@@ -473,6 +473,10 @@ class EventPort : public ntci::Reactor,
     // immediately followed by the specified 'functor', then clear the
     // 'functorSequence'.
 
+    void executeInplace(InplaceFunctor* functor) BSLS_KEYWORD_OVERRIDE;
+    // Defer the execution of the callable object stored by the specified
+    // 'functor', leaving the 'functor' empty.
+
     bsl::shared_ptr<ntci::Timer> createTimer(
         const ntca::TimerOptions&                  options,
         const bsl::shared_ptr<ntci::TimerSession>& session,
@@ -645,6 +649,7 @@ struct EventPort::Result {
   public:
     ntca::WaiterOptions                   d_options;
     bsl::shared_ptr<ntci::ReactorMetrics> d_metrics_sp;
+    ntcs::Chronology*                     d_shard_p;
 
   private:
     Result(const Result&) BSLS_KEYWORD_DELETED;
@@ -663,6 +668,7 @@ struct EventPort::Result {
 EventPort::Result::Result(bslma::Allocator* basicAllocator)
 : d_options(basicAllocator)
 , d_metrics_sp()
+, d_shard_p(0)
 {
 }
 
@@ -973,6 +979,42 @@ EventPort::EventPort(const ntca::ReactorConfig&         configuration,
         d_config.setMetricCollectionPerSocket(false);
     }
 
+    if (d_config.timerWheel().isNull()) {
+        d_config.setTimerWheel(NTCCFG_DEFAULT_TIMER_WHEEL);
+    }
+
+    if (d_config.timerWheelResolution().isNull()) {
+        bsls::TimeInterval timerWheelResolution;
+        timerWheelResolution.setTotalMicroseconds(
+            NTCCFG_DEFAULT_TIMER_WHEEL_RESOLUTION);
+
+        d_config.setTimerWheelResolution(timerWheelResolution);
+    }
+
+    if (d_config.timerWheel().value()) {
+        ntsa::Error error = d_chronology.configureTimerWheel(
+            d_config.timerWheelResolution().value());
+        if (error) {
+            d_config.setTimerWheel(false);
+        }
+    }
+
+    if (d_config.chronologySharding().isNull()) {
+        d_config.setChronologySharding(NTCCFG_DEFAULT_CHRONOLOGY_SHARDING);
+    }
+
+    if (d_config.chronologySharding().value()) {
+        ntsa::Error error = ntsa::Error(ntsa::Error::e_INVALID);
+        if (d_config.maxThreads().value() > 1) {
+            error = d_chronology.configureShards(
+                d_config.maxThreads().value());
+        }
+
+        if (error) {
+            d_config.setChronologySharding(false);
+        }
+    }
+
     if (d_config.autoAttach().isNull()) {
         d_config.setAutoAttach(false);
     }
@@ -1127,6 +1169,8 @@ ntci::Waiter EventPort::registerWaiter(
             bslmt::ThreadUtil::handleToId(principleThreadHandle.value())));
     }
 
+    result->d_shard_p = d_chronology.acquireShard();
+
     return result;
 }
 
@@ -1134,6 +1178,11 @@ void EventPort::deregisterWaiter(ntci::Waiter waiter)
 {
     EventPort::Result* result = static_cast<EventPort::Result*>(waiter);
 
+    if (result->d_shard_p != 0) {
+        d_chronology.releaseShard(result->d_shard_p);
+        result->d_shard_p = 0;
+    }
+
     bool nowEmpty = false;
 
     {
@@ -1784,6 +1833,8 @@ void EventPort::run(ntci::Waiter waiter)
 
     NTCCFG_WARNING_UNUSED(result);
 
+    ntcs::ChronologyGuard chronologyGuard(result->d_shard_p);
+
     NTCS_METRICS_GET();
 
     while (d_run) {
@@ -2030,6 +2081,8 @@ void EventPort::poll(ntci::Waiter waiter)
 
     NTCCFG_WARNING_UNUSED(result);
 
+    ntcs::ChronologyGuard chronologyGuard(result->d_shard_p);
+
     NTCS_METRICS_GET();
 
     int timeout = d_chronology.timeoutInMilliseconds();
@@ -2364,15 +2417,18 @@ void EventPort::clear()
 
 void EventPort::execute(const Functor& functor)
 {
-    d_chronology.defer(functor);
-    EventPort::interruptAll();
+    d_chronology.execute(functor);
 }
 
 void EventPort::moveAndExecute(FunctorSequence* functorSequence,
                                const Functor&   functor)
 {
-    d_chronology.defer(functorSequence, functor);
-    EventPort::interruptAll();
+    d_chronology.moveAndExecute(functorSequence, functor);
+}
+
+void EventPort::executeInplace(InplaceFunctor* functor)
+{
+    d_chronology.executeInplace(functor);
 }
 
 bsl::shared_ptr<ntci::Timer> EventPort::createTimer(
@@ -492,6 +492,10 @@ class Iocp : public ntci::Proactor,
     // immediately followed by the specified 'functor', then clear the
     // 'functorSequence'.
 
+    void executeInplace(InplaceFunctor* functor) BSLS_KEYWORD_OVERRIDE;
+    // Defer the execution of the callable object stored by the specified
+    // 'functor', leaving the 'functor' empty.
+
     bsl::shared_ptr<ntci::Timer> createTimer(
         const ntca::TimerOptions&                  options,
         const bsl::shared_ptr<ntci::TimerSession>& session,
@@ -1160,6 +1164,26 @@ Iocp::Iocp(const ntca::ProactorConfig&        configuration,
         d_config.setMetricCollectionPerSocket(false);
     }
 
+    if (d_config.timerWheel().isNull()) {
+        d_config.setTimerWheel(NTCCFG_DEFAULT_TIMER_WHEEL);
+    }
+
+    if (d_config.timerWheelResolution().isNull()) {
+        bsls::TimeInterval timerWheelResolution;
+        timerWheelResolution.setTotalMicroseconds(
+            NTCCFG_DEFAULT_TIMER_WHEEL_RESOLUTION);
+
+        d_config.setTimerWheelResolution(timerWheelResolution);
+    }
+
+    if (d_config.timerWheel().value()) {
+        ntsa::Error error = d_chronology.configureTimerWheel(
+            d_config.timerWheelResolution().value());
+        if (error) {
+            d_config.setTimerWheel(false);
+        }
+    }
+
     if (d_user_sp) {
         d_dataPool_sp = d_user_sp->dataPool();
     }
@@ -2654,6 +2678,12 @@ void Iocp::moveAndExecute(FunctorSequence* functorSequence,
     this->interruptAll();
 }
 
+void Iocp::executeInplace(InplaceFunctor* functor)
+{
+    d_chronology.defer(functor);
+    this->interruptAll();
+}
+
 bsl::shared_ptr<ntci::Timer> Iocp::createTimer(
     const ntca::TimerOptions&                  options,
     const bsl::shared_ptr<ntci::TimerSession>& session,
@@ -53,6 +53,7 @@ BSLS_IDENT_RCSID(ntco_ioring_cpp, "$Id$ $CSID$")
 #include <ntci_mutex.h>
 #include <ntcs_async.h>
 #include <ntcs_authorization.h>
+#include <ntcs_blobbufferfactory.h>
 #include <ntcs_chronology.h>
 #include <ntcs_datapool.h>
 #include <ntcs_driver.h>
@@ -69,6 +70,7 @@ BSLS_IDENT_RCSID(ntco_ioring_cpp, "$Id$ $CSID$")
 #include <ntsu_socketutil.h>
 
 #include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
 #include <bdlcc_objectpool.h>
 #include <bdlf_bind.h>
 #include <bdlf_memfn.h>
@@ -80,6 +82,7 @@ BSLS_IDENT_RCSID(ntco_ioring_cpp, "$Id$ $CSID$")
 #include <bslim_printer.h>
 #include <bslma_allocator.h>
 #include <bslma_default.h>
+#include <bslma_managedptr.h>
 #include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
 #include <bslmt_semaphore.h>
@@ -91,6 +94,7 @@ BSLS_IDENT_RCSID(ntco_ioring_cpp, "$Id$ $CSID$")
 #include <bsls_spinlock.h>
 #include <bsls_timeutil.h>
 
+#include <bsl_deque.h>
 #include <bsl_functional.h>
 #include <bsl_iosfwd.h>
 #include <bsl_list.h>
@@ -165,11 +169,19 @@ BSLS_IDENT_RCSID(ntco_ioring_cpp, "$Id$ $CSID$")
 #define NTCO_IORING_DEFAULT_SUBMISSION_MODE_TIMER                             \
     ntco::IoRingSubmissionMode::e_DEFERRED
 
+// The maximum number of bytes a multishot receive stages while no receive is
+// requested before the multishot receive is cancelled, so that a peer
+// sending to a socket whose receive flow control is applied cannot cause
+// unbounded memory growth. The multishot receive is re-armed when the staged
+// data is next requested.
+#define NTCO_IORING_MULTISHOT_RECEIVE_STAGED_MAX (256 * 1024)
+
 // Enable logging during debugging.
 #define NTCO_IORING_DEBUG 0
 
 #define NTCO_IORING_READER_BARRIER() __asm__ __volatile__("" ::: "memory")
 #define NTCO_IORING_WRITER_BARRIER() __asm__ __volatile__("" ::: "memory")
+#define NTCO_IORING_MEMORY_BARRIER() __sync_synchronize()
 
 #define NTCO_IORING_LOG_CREATED(ring)                                         \
     NTCI_LOG_TRACE("I/O ring file descriptor %d created", ring)
@@ -192,6 +204,10 @@ BSLS_IDENT_RCSID(ntco_ioring_cpp, "$Id$ $CSID$")
         }                                                                     \
     } while (false)
 
+#define NTCO_IORING_LOG_SUBMISSION_POLLING_FAILURE(error)                     \
+    NTCI_LOG_WARN("I/O ring failed to setup submission queue polling: %s",    \
+                  (error).text().c_str())
+
 #define NTCO_IORING_LOG_RLIMIT_MEMLOCK_RESULT(limit)                          \
     NTCI_LOG_TRACE("I/O ring RLIMIT_MEMLOCK current = %d, maximum = %d",      \
                    (int)((limit).rlim_cur),                                   \
@@ -341,6 +357,9 @@ BSLS_IDENT_RCSID(ntco_ioring_cpp, "$Id$ $CSID$")
 #define NTCO_IORING_LOG_SUBMISSION_QUEUE_FULL()                               \
     NTCI_LOG_TRACE("I/O ring submission queue is full")
 
+#define NTCO_IORING_LOG_SUBMISSION_QUEUE_WAKEUP()                             \
+    NTCI_LOG_TRACE("I/O ring waking submission queue polling thread")
+
 #define NTCO_IORING_LOG_SUBMISSION_FAILED(submission, error)                  \
     NTCI_LOG_TRACE("I/O ring failed to submit entry: %s",                     \
                    (error).text().c_str())
@@ -360,6 +379,25 @@ BSLS_IDENT_RCSID(ntco_ioring_cpp, "$Id$ $CSID$")
     NTCI_LOG_ERROR("I/O ring failed to map completion queue ring buffer: %s", \
                    (error).text().c_str());
 
+#define NTCO_IORING_LOG_BUFFER_RING_MAP_COMPLETE(group, count, size)         \
+    NTCI_LOG_TRACE("I/O ring registered buffer ring: "                        \
+                   "group = %u, count = %zu, size = %zu",                     \
+                   (unsigned int)(group),                                     \
+                   (bsl::size_t)(count),                                      \
+                   (bsl::size_t)(size))
+
+#define NTCO_IORING_LOG_BUFFER_RING_MAP_FAILED(error)                         \
+    NTCI_LOG_ERROR("I/O ring failed to register buffer ring: %s",             \
+                   (error).text().c_str());
+
+#define NTCO_IORING_LOG_FILE_TABLE_MAP_COMPLETE(capacity)                     \
+    NTCI_LOG_TRACE("I/O ring registered fixed file table: capacity = %zu",    \
+                   (bsl::size_t)(capacity))
+
+#define NTCO_IORING_LOG_FILE_TABLE_MAP_FAILED(error)                          \
+    NTCI_LOG_ERROR("I/O ring failed to register fixed file table: %s",        \
+                   (error).text().c_str());
+
 #define NTCO_IORING_LOG_COMPLETION_QUEUE_POPPING(index)                       \
     NTCI_LOG_TRACE(                                                           \
         "I/O ring popping completion queue entry at head index %u",           \
@@ -424,6 +462,9 @@ struct IoRingOperation {
         // Initiate a 'connect' system call.
         e_CONNECT = 16,
 
+        // Initiate a 'recv' system call.
+        e_RECV = 27,
+
         // Initiate a 'shutdown' system call.
         e_SHUTDOWN = 34,
 
@@ -604,6 +645,11 @@ struct IoRingWaiter {
 /// Describe the configurable parameters of an I/O ring.
 class IoRingConfig
 {
+    enum Flags {
+        k_SETUP_FLAG_SQPOLL = 1U << 1,
+        k_SETUP_FLAG_SQ_AFF = 1U << 2
+    };
+
     enum Features {
         k_FEATURE_FLAG_NODROP         = 1U << 1,
         k_FEATURE_FLAG_EXTRA_ARG      = 1U << 8,
@@ -669,6 +715,19 @@ class IoRingConfig
     /// Set the features the specified 'value'.
     void setFeatures(bsl::uint32_t value);
 
+    /// Set the flag that indicates a kernel thread polls the submission
+    /// queue (IORING_SETUP_SQPOLL) to the specified 'value'.
+    void setSubmissionQueuePolling(bool value);
+
+    /// Bind the kernel thread polling the submission queue to the CPU
+    /// having the specified 'value' index (IORING_SETUP_SQ_AFF).
+    void setSubmissionQueueThreadCpu(bsl::uint32_t value);
+
+    /// Set the number of milliseconds the kernel thread polling the
+    /// submission queue continues to poll after the submission queue becomes
+    /// empty to the specified 'value'.
+    void setSubmissionQueueThreadIdle(bsl::uint32_t value);
+
     /// Return the submission queue capacity.
     bsl::uint32_t submissionQueueCapacity() const;
 
@@ -729,6 +788,10 @@ class IoRingConfig
     /// Return the features.
     bsl::uint32_t features() const;
 
+    /// Return true if a kernel thread polls the submission queue
+    /// (IORING_SETUP_SQPOLL), otherwise return false.
+    bool isSubmissionQueuePolled() const;
+
     /// Return true if the kernel never drops completion queue entries, even
     /// when the completion queue is full (IORING_FEAT_NODROP), otherwise
     /// return false, indicating that submissions may fail until user space
@@ -836,13 +899,54 @@ struct IoRingSubmissionMode {
     static const char* toString(IoRingSubmissionMode::Value mode);
 };
 
+/// Enumerate the strategies by which an I/O ring receives data.
+struct IoRingReceiveMode {
+    /// Enumerate the strategies by which an I/O ring receives data.
+    enum Value {
+        /// Receive into the capacity of the caller-supplied blob.
+        e_DEFAULT = 0,
+
+        /// Receive into a buffer selected by the kernel from the provided
+        /// buffer ring, then append that buffer to the caller-supplied blob.
+        e_PROVIDED = 1,
+
+        /// Receive repeatedly into buffers selected by the kernel from the
+        /// provided buffer ring, staging each buffer until requested.
+        e_MULTISHOT = 2
+    };
+};
+
+/// Enumerate the strategies by which an I/O ring accepts connections.
+struct IoRingAcceptMode {
+    /// Enumerate the strategies by which an I/O ring accepts connections.
+    enum Value {
+        /// Accept a single connection per operation.
+        e_DEFAULT = 0,
+
+        /// Accept connections repeatedly from a single operation, staging
+        /// each connection until requested.
+        e_MULTISHOT = 1
+    };
+};
+
 /// Describe an I/O ring submission entry.
 ///
 /// @par Thread Safety
 /// This class is not thread safe.
 class IoRingSubmission
 {
-    enum Flags { k_DRAIN = 1U << 1, k_LINK = 1U << 2, k_ASYNC = 1U << 4 };
+    enum Flags {
+        k_FIXED_FILE    = 1U << 0,
+        k_DRAIN         = 1U << 1,
+        k_LINK          = 1U << 2,
+        k_ASYNC         = 1U << 4,
+        k_BUFFER_SELECT = 1U << 5
+    };
+
+    enum Priority {
+        k_ACCEPT_MULTISHOT  = 1U << 0,
+        k_RECEIVE_MULTISHOT = 1U << 1
+    };
 
     bsl::uint8_t  d_operation;    // opcode
     bsl::uint8_t  d_flags;        // flags
@@ -904,6 +1008,17 @@ class IoRingSubmission
         const bsl::shared_ptr<ntci::ProactorSocket>& socket,
         ntsa::Handle                                 handle);
 
+    /// Prepare the submission to initiate an operation to accept each
+    /// connection from the backlog of the specified 'socket' identified by
+    /// the specified 'handle', completing once per connection accepted
+    /// until the operation fails or is cancelled. Load into the specified
+    /// 'event' the event that indicates each connection is accepted. Return
+    /// the error.
+    ntsa::Error prepareMultishotAccept(
+        ntcs::Event*                                 event,
+        const bsl::shared_ptr<ntci::ProactorSocket>& socket,
+        ntsa::Handle                                 handle);
+
     /// Prepare the submission to initiate an operation to connect the
     /// specified 'socket' identified by the specified 'handle' to the
     /// specified 'endpoint'. Load into the specified 'event' the event that
@@ -1058,14 +1173,48 @@ class IoRingSubmission
         bdlbb::Blob*                                 destination,
         const ntsa::ReceiveOptions&                  options);
 
+    /// Prepare the submission to initiate an operation to dequeue the receive
+    /// buffer of the specified 'socket' identified by the specified 'handle'
+    /// into a buffer selected by the kernel from the provided buffer ring
+    /// identified by the specified 'group', each buffer having the specified
+    /// 'bufferSize'. If the specified 'mode' is
+    /// 'IoRingReceiveMode::e_MULTISHOT' the operation remains armed and
+    /// completes once for each buffer filled, otherwise the operation
+    /// completes once, copying at most the specified 'maxBytes', if
+    /// non-zero, and the selected buffer is appended to the specified
+    /// 'destination'. Load into the specified 'event' the event that
+    /// indicates the operation is complete. Return the error.
+    ntsa::Error prepareReceive(
+        ntcs::Event*                                 event,
+        const bsl::shared_ptr<ntci::ProactorSocket>& socket,
+        ntsa::Handle                                 handle,
+        bdlbb::Blob*                                 destination,
+        bsl::uint16_t                                group,
+        bsl::size_t                                  bufferSize,
+        bsl::size_t                                  maxBytes,
+        ntco::IoRingReceiveMode::Value               mode);
+
     /// Prepare the submission to cancel each operation associated with the
     /// specified 'handle'.
     void prepareCancellation(ntsa::Handle handle);
 
+    /// Prepare the submission to cancel each operation associated with the
+    /// file registered at the specified 'index' in the fixed file table.
+    void prepareFixedCancellation(bsl::uint32_t index);
+
+    /// Refer to the file on which the prepared operation is performed by the
+    /// specified 'index' in the fixed file table rather than by its handle.
+    void setFixedFile(bsl::uint32_t index);
+
     /// Prepare the submission to cancel an operation associated with the
     /// specified 'event'.
     void prepareCancellation(ntcs::Event* event);
 
+    /// Prepare the submission to stop the multishot operation associated
+    /// with the specified 'event'. Unlike a cancellation, the completions of
+    /// the operation that precede its termination are still processed.
+    void prepareMultishotCancellation(ntcs::Event* event);
+
     /// Return the handle.
     ntsa::Handle handle() const;
 
@@ -1112,15 +1261,16 @@ bsl::ostream& operator<<(bsl::ostream& stream, const IoRingSubmission& object);
 /// This class is thread safe.
 class IoRingSubmissionQueue
 {
-    // Define a type alias for a mutex.
-    typedef ntci::Mutex Mutex;
-
-    // Define a type alias for a mutex lock guard.
-    typedef ntci::LockGuard LockGuard;
+    enum Flags { k_NEED_WAKEUP = 1U << 0 };
 
-    mutable Mutex           d_mutex;
     int                     d_ring;
+    bsls::AtomicUint        d_reserved;
+    bsls::AtomicUint        d_published;
     bsls::AtomicUint        d_pending;
+    bsls::AtomicUint64      d_numRetries;
+    bsls::AtomicUint64      d_numFull;
+    bsls::AtomicUint64      d_numWakeups;
+    bool                    d_polled;
     void*                   d_memoryMap_p;
     bsl::uint32_t*          d_head_p;
     bsl::uint32_t*          d_tail_p;
@@ -1136,6 +1286,16 @@ class IoRingSubmissionQueue
     IoRingSubmissionQueue& operator=(const IoRingSubmissionQueue&)
         BSLS_KEYWORD_DELETED;
 
+  private:
+    // Instruct the kernel to drain the submission queue: enter the I/O ring
+    // or, if a kernel thread polls the submission queue, wake that thread
+    // if it is asleep. Return the error.
+    ntsa::Error drain();
+
+    // Wake the kernel thread polling the submission queue if that thread
+    // is asleep.
+    void wakeup();
+
   public:
     // Create a new, initially unmapped submission queue.
     IoRingSubmissionQueue();
@@ -1150,6 +1310,9 @@ class IoRingSubmissionQueue
     // Push the specified 'entry' onto the submission queue. If 'mode' is
     // immediate or the submission queue is "full", enter the I/O ring to
     // instruct the kernel to drain the submission queue. Return the error.
+    // Note that multiple threads may push concurrently: each thread reserves
+    // a distinct entry without locking, and entries are published to the
+    // kernel in the order in which they are reserved.
     ntsa::Error push(const ntco::IoRingSubmission& entry,
                      IoRingSubmissionMode::Value   mode);
 
@@ -1157,6 +1320,16 @@ class IoRingSubmissionQueue
     // submissions to zero.
     bsl::size_t gather();
 
+    // Load into the specified 'numRetries' the number of reservations that
+    // were retried because of a concurrent reservation or publication, into
+    // the specified 'numFull' the number of times the submission queue was
+    // found full, and into the specified 'numWakeups' the number of times
+    // the kernel thread polling the submission queue was woken up, each
+    // since the last call to this function, then reset each to zero.
+    void loadContention(bsl::size_t* numRetries,
+                        bsl::size_t* numFull,
+                        bsl::size_t* numWakeups);
+
     // Unmap the memory for the submission queue.
     void unmap();
 
@@ -1217,6 +1390,19 @@ class IoRingCompletion
     /// Return the flags.
     bsl::uint8_t flags() const;
 
+    /// Return true if the kernel selected a buffer from the provided buffer
+    /// ring to complete the operation (IORING_CQE_F_BUFFER), otherwise
+    /// return false.
+    bool hasBuffer() const;
+
+    /// Return the identifier of the buffer selected from the provided buffer
+    /// ring. The behavior is undefined unless 'hasBuffer()' is true.
+    bsl::uint16_t bufferId() const;
+
+    /// Return true if the operation remains armed and will generate further
+    /// completions (IORING_CQE_F_MORE), otherwise return false.
+    bool hasMore() const;
+
     /// Return true if the operation has succeeded, otherwise return false.
     bool hasSucceeded() const;
 
@@ -1308,17 +1494,174 @@ class IoRingCompletionQueue
     bsl::uint32_t capacity() const;
 };
 
+/// Provide a memory mapped ring of buffers registered with an I/O ring from
+/// which the kernel selects the buffer into which incoming data is copied at
+/// the time the data arrives (IORING_REGISTER_PBUF_RING).
+///
+/// @par Thread Safety
+/// This class is thread safe.
+class IoRingBufferRing
+{
+    // Define a type alias for a mutex.
+    typedef ntci::Mutex Mutex;
+
+    // Define a type alias for a mutex lock guard.
+    typedef ntci::LockGuard LockGuard;
+
+    // Define a type alias for a vector of blob buffers, indexed by buffer
+    // identifier.
+    typedef bsl::vector<bdlbb::BlobBuffer> BufferVector;
+
+    // Describes an entry in the ring (struct io_uring_buf).
+    struct Entry {
+        bsl::uint64_t d_address;
+        bsl::uint32_t d_length;
+        bsl::uint16_t d_bufferId;
+        bsl::uint16_t d_reserved;
+    };
+
+    mutable Mutex                             d_mutex;
+    int                                       d_ring;
+    void*                                     d_memoryMap_p;
+    bsl::size_t                               d_memoryMapSize;
+    Entry*                                    d_entryArray;
+    bsl::uint16_t*                            d_tail_p;
+    bsl::uint16_t                             d_tail;
+    bsl::uint16_t                             d_mask;
+    bsl::uint16_t                             d_group;
+    bsl::size_t                               d_bufferSize;
+    BufferVector                              d_bufferVector;
+    bsl::shared_ptr<bdlbb::BlobBufferFactory> d_blobBufferFactory_sp;
+    bslma::Allocator*                         d_allocator_p;
+
+  private:
+    IoRingBufferRing(const IoRingBufferRing&) BSLS_KEYWORD_DELETED;
+    IoRingBufferRing& operator=(const IoRingBufferRing&) BSLS_KEYWORD_DELETED;
+
+    // Publish the specified 'buffer' to the kernel at the specified
+    // 'bufferId'. The behavior is undefined unless 'd_mutex' is locked.
+    void publish(const bdlbb::BlobBuffer& buffer, bsl::uint16_t bufferId);
+
+  public:
+    // Create a new, initially unmapped buffer ring. Optionally specify a
+    // 'basicAllocator' used to supply memory. If 'basicAllocator' is 0, the
+    // currently installed default allocator is used.
+    explicit IoRingBufferRing(bslma::Allocator* basicAllocator = 0);
+
+    // Destroy this object.
+    ~IoRingBufferRing();
+
+    // Map the memory for a buffer ring having the specified 'count' entries,
+    // register it with the specified I/O 'ring' as the specified buffer
+    // 'group', and fill each entry with a buffer allocated from the
+    // specified 'blobBufferFactory'. Return the error. The behavior is
+    // undefined unless 'count' is a power of two no greater than 32768.
+    ntsa::Error map(
+        int                                              ring,
+        bsl::uint16_t                                    group,
+        bsl::size_t                                      count,
+        const bsl::shared_ptr<bdlbb::BlobBufferFactory>& blobBufferFactory);
+
+    // Load into the specified 'result' the buffer identified by the
+    // specified 'bufferId' that the kernel has filled with the specified
+    // 'numBytes', and replace that buffer in the ring with a new buffer
+    // allocated from the blob buffer factory. Return the error.
+    ntsa::Error acquire(bdlbb::BlobBuffer* result,
+                        bsl::uint16_t      bufferId,
+                        bsl::size_t        numBytes);
+
+    // Unregister the buffer ring and unmap its memory.
+    void unmap();
+
+    // Return the buffer group identifier.
+    bsl::uint16_t group() const;
+
+    // Return the size of each buffer in the ring.
+    bsl::size_t bufferSize() const;
+
+    // Return true if the buffer ring is mapped, otherwise return false.
+    bool isMapped() const;
+};
+
+/// Provide a table of files registered with an I/O ring so that operations
+/// may refer to a file by its index in the table, avoiding the lookup and
+/// reference counting of the file by the kernel for each operation
+/// (IORING_REGISTER_FILES).
+///
+/// @par Thread Safety
+/// This class is thread safe.
+class IoRingFileTable
+{
+    // Define a type alias for a mutex.
+    typedef ntci::Mutex Mutex;
+
+    // Define a type alias for a mutex lock guard.
+    typedef ntci::LockGuard LockGuard;
+
+    // Define a type alias for a vector of indexes.
+    typedef bsl::vector<bsl::uint32_t> IndexVector;
+
+    mutable Mutex     d_mutex;
+    int               d_ring;
+    bsl::size_t       d_capacity;
+    IndexVector       d_freeList;
+    bslma::Allocator* d_allocator_p;
+
+  private:
+    IoRingFileTable(const IoRingFileTable&) BSLS_KEYWORD_DELETED;
+    IoRingFileTable& operator=(const IoRingFileTable&) BSLS_KEYWORD_DELETED;
+
+    // Install the specified 'handle' at the specified 'index'. Return the
+    // error.
+    ntsa::Error update(bsl::uint32_t index, ntsa::Handle handle);
+
+  public:
+    // Create a new, initially unregistered file table. Optionally specify a
+    // 'basicAllocator' used to supply memory. If 'basicAllocator' is 0, the
+    // currently installed default allocator is used.
+    explicit IoRingFileTable(bslma::Allocator* basicAllocator = 0);
+
+    // Destroy this object.
+    ~IoRingFileTable();
+
+    // Register an initially empty table of the specified 'capacity' with the
+    // specified I/O 'ring'. Return the error.
+    ntsa::Error map(int ring, bsl::size_t capacity);
+
+    // Install the specified 'handle' in the table and load into the
+    // specified 'index' the index at which it is installed. Return the
+    // error, notably 'ntsa::Error::e_LIMIT' if the table is full.
+    ntsa::Error acquire(bsl::uint32_t* index, ntsa::Handle handle);
+
+    // Remove the file installed at the specified 'index' from the table.
+    void release(bsl::uint32_t index);
+
+    // Unregister the table.
+    void unmap();
+
+    // Return true if the table is registered, otherwise return false.
+    bool isMapped() const;
+};
+
 /// Provide an I/O ring device.
 ///
 /// @par Thread Safety
 /// This class is thread safe.
 class IoRingDevice
 {
-    enum { k_SUPPORTS_CANCEL_BY_HANDLE = 1 };
+    enum {
+        k_SUPPORTS_CANCEL_BY_HANDLE  = 1,
+        k_SUPPORTS_BUFFER_RING       = 2,
+        k_SUPPORTS_MULTISHOT_RECEIVE = 4,
+        k_SUPPORTS_MULTISHOT_ACCEPT  = 8,
+        k_SUPPORTS_CANCEL_BY_FIXED   = 16
+    };
 
     int                         d_ring;
     ntco::IoRingSubmissionQueue d_submissionQueue;
     ntco::IoRingCompletionQueue d_completionQueue;
+    ntco::IoRingBufferRing      d_bufferRing;
+    ntco::IoRingFileTable       d_fileTable;
     ntco::IoRingProbe           d_probe;
     ntco::IoRingConfig          d_params;
     bsl::uint32_t               d_flags;
@@ -1329,12 +1672,15 @@ class IoRingDevice
     IoRingDevice& operator=(const IoRingDevice&) BSLS_KEYWORD_DELETED;
 
   public:
-    // Create a new I/O ring with the specified suggested 'queueDepth'.
-    // Optionally specify a 'basicAllocator' used to supply memory. If
-    // 'basicAllocator' is 0, the currently installed default allocator is
-    // used.
-    explicit IoRingDevice(bsl::size_t       queueDepth,
-                          bslma::Allocator* basicAllocator = 0);
+    // Create a new I/O ring with the specified suggested 'queueDepth' and
+    // the flags and submission queue polling parameters of the specified
+    // 'parameters'. Optionally specify a 'basicAllocator' used to supply
+    // memory. If 'basicAllocator' is 0, the currently installed default
+    // allocator is used. Note that if the kernel does not support or permit
+    // submission queue polling, the I/O ring is created without it.
+    IoRingDevice(bsl::size_t               queueDepth,
+                 const ntco::IoRingConfig& parameters,
+                 bslma::Allocator*         basicAllocator = 0);
 
     // Destroy this object.
     ~IoRingDevice();
@@ -1362,6 +1708,45 @@ class IoRingDevice
     bsl::size_t flush(ntco::IoRingCompletion* entryList,
                       bsl::size_t             entryListCapacity);
 
+    // Register a ring of the specified 'count' buffers allocated from the
+    // specified 'blobBufferFactory' from which the kernel selects the buffer
+    // into which incoming data is copied. Return the error.
+    ntsa::Error mapBufferRing(
+        bsl::size_t                                      count,
+        const bsl::shared_ptr<bdlbb::BlobBufferFactory>& blobBufferFactory);
+
+    // Load into the specified 'result' the buffer selected from the buffer
+    // ring by the completion of the specified 'entry', and replenish the
+    // buffer ring. Return the error.
+    ntsa::Error acquireBuffer(bdlbb::BlobBuffer*            result,
+                              const ntco::IoRingCompletion& entry);
+
+    // Register a table of the specified 'capacity' files by which
+    // operations may refer to files by index. Return the error.
+    ntsa::Error mapFileTable(bsl::size_t capacity);
+
+    // Install the specified 'handle' in the fixed file table and load into
+    // the specified 'index' the index at which it is installed. Return the
+    // error.
+    ntsa::Error registerFile(bsl::uint32_t* index, ntsa::Handle handle);
+
+    // Remove the file installed at the specified 'index' from the fixed file
+    // table.
+    void deregisterFile(bsl::uint32_t index);
+
+    // Return the identifier of the group of the buffer ring.
+    bsl::uint16_t bufferGroup() const;
+
+    // Return the size of each buffer in the buffer ring.
+    bsl::size_t bufferSize() const;
+
+    // Load into the specified 'numRetries', 'numFull', and 'numWakeups' the
+    // contention encountered by submissions since the last call to this
+    // function, then reset that contention.
+    void loadSubmissionContention(bsl::size_t* numRetries,
+                                  bsl::size_t* numFull,
+                                  bsl::size_t* numWakeups);
+
     // Return the index of the head entry in the submission queue.
     bsl::uint32_t submissionQueueHead() const;
 
@@ -1402,6 +1787,37 @@ class IoRingDevice
     /// Return true if the kernel supports cancelling all pending operations
     /// by file descriptor (IORING_ASYNC_CANCEL_FD), otherwise return false.
     bool supportsCancelByHandle() const;
+
+    /// Return true if the kernel supports cancelling all pending operations
+    /// by index in the fixed file table (IORING_ASYNC_CANCEL_FD_FIXED),
+    /// otherwise return false.
+    bool supportsCancelByFixedHandle() const;
+
+    /// Return true if the kernel supports registering rings of provided
+    /// buffers (IORING_REGISTER_PBUF_RING), otherwise return false.
+    bool supportsBufferRing() const;
+
+    /// Return true if a buffer ring has been registered, otherwise return
+    /// false.
+    bool hasBufferRing() const;
+
+    /// Return true if the kernel supports receive operations that remain
+    /// armed after completion (IORING_RECV_MULTISHOT), otherwise return
+    /// false.
+    bool supportsMultishotReceive() const;
+
+    /// Return true if the kernel supports accept operations that remain
+    /// armed after completion (IORING_ACCEPT_MULTISHOT), otherwise return
+    /// false.
+    bool supportsMultishotAccept() const;
+
+    /// Return true if a fixed file table has been registered, otherwise
+    /// return false.
+    bool hasFileTable() const;
+
+    /// Return true if a kernel thread polls the submission queue
+    /// (IORING_SETUP_SQPOLL), otherwise return false.
+    bool isSubmissionQueuePolled() const;
 };
 
 /// Provide a testing mechanism for the 'io_uring' API.
@@ -1472,6 +1888,9 @@ class IoRingContext : public ntcs::ProactorDetachContext
     // Define a set of events.
     typedef bsl::unordered_set<ntcs::Event*> EventSet;
 
+    // Define a type alias for a queue of handles.
+    typedef bsl::deque<ntsa::Handle> HandleQueue;
+
     // Define a type alias for a mutex.
     typedef ntci::Mutex Mutex;
 
@@ -1481,16 +1900,52 @@ class IoRingContext : public ntcs::ProactorDetachContext
     ntsa::Handle      d_handle;
     Mutex             d_pendingEventSetMutex;
     EventSet          d_pendingEventSet;
+    Mutex             d_receiveMutex;
+    bdlbb::Blob*      d_receiveDestination_p;
+    bsl::size_t       d_receiveMaxBytes;
+    bsl::size_t       d_receiveMaxBuffers;
+    bdlbb::Blob       d_receiveStaged;
+    ntsa::Error       d_receiveError;
+    bool              d_receiveArmed;
+    bool              d_receiveStopping;
+    bool              d_receiveClosed;
+    Mutex             d_acceptMutex;
+    HandleQueue       d_acceptStaged;
+    ntsa::Error       d_acceptError;
+    bool              d_acceptRequested;
+    bool              d_acceptArmed;
+    bsls::AtomicInt   d_fixedFile;
     bslma::Allocator* d_allocator_p;
 
   private:
     IoRingContext(const IoRingContext&) BSLS_KEYWORD_DELETED;
     IoRingContext& operator=(const IoRingContext&) BSLS_KEYWORD_DELETED;
 
+    // Move the data staged by a multishot receive into the specified
+    // 'destination', up to the limits of the requested receive, and load
+    // into the specified 'numBytes' the number of bytes moved. The behavior
+    // is undefined unless 'd_receiveMutex' is locked.
+    void moveStaged(bdlbb::Blob* destination, bsl::size_t* numBytes);
+
   public:
     // Define a type alias for a vector of events.
     typedef bsl::vector<ntcs::Event*> EventList;
 
+    // Enumerate the actions required to drive a multishot operation.
+    enum Action {
+        // No further action is required.
+        e_ACTION_NONE,
+
+        // Submit the multishot operation.
+        e_ACTION_ARM,
+
+        // Announce the result of the requested operation.
+        e_ACTION_ANNOUNCE,
+
+        // Stop the multishot operation.
+        e_ACTION_STOP
+    };
+
     // Create a new context for the specified 'handle'. Optionally specify
     // a 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
     // the currently installed default allocator is used.
@@ -1512,6 +1967,78 @@ class IoRingContext : public ntcs::ProactorDetachContext
     // events.
     void loadPending(EventList* pendingEventList, bool remove);
 
+    // Request to receive into the specified 'destination' from the data
+    // staged by a multishot receive, moving at most the 'maxBytes' and
+    // 'maxBuffers' of the specified 'options', if non-zero. If data, an
+    // error, or the end of the stream is already staged, load the outcome
+    // into the specified 'numBytes' and 'error' and return
+    // 'e_ACTION_ANNOUNCE'. Otherwise, retain 'destination' until the
+    // multishot receive completes, and return 'e_ACTION_ARM' if the
+    // multishot receive must be submitted, or 'e_ACTION_NONE' if it is
+    // already armed.
+    Action requestReceive(bdlbb::Blob*                destination,
+                          bsl::size_t*                numBytes,
+                          ntsa::Error*                error,
+                          const ntsa::ReceiveOptions& options);
+
+    // Process the completion of a multishot receive that copied data into
+    // the specified 'buffer', or failed with the specified 'result', where
+    // the specified 'more' flag indicates whether the operation remains
+    // armed. If a destination is pending, load it into the specified
+    // 'destination', load the outcome into the specified 'numBytes' and
+    // 'error', and return 'e_ACTION_ANNOUNCE'. Otherwise, stage the
+    // outcome and return either 'e_ACTION_ARM' if the multishot receive
+    // must be resubmitted, 'e_ACTION_STOP' if the staged data has reached
+    // 'NTCO_IORING_MULTISHOT_RECEIVE_STAGED_MAX' and the multishot receive
+    // must be stopped until the staged data is requested, or
+    // 'e_ACTION_NONE'.
+    Action completeReceive(bdlbb::Blob**            destination,
+                           bsl::size_t*             numBytes,
+                           ntsa::Error*             error,
+                           const bdlbb::BlobBuffer& buffer,
+                           const ntsa::Error&       result,
+                           bool                     more);
+
+    // Forget the pending destination of a multishot receive and mark the
+    // multishot receive as no longer armed.
+    void abandonReceive();
+
+    // Forget that the multishot receive is being stopped, so that stopping
+    // it is attempted again by the next completion that stages data.
+    void abandonStop();
+
+    // Request to accept a connection staged by a multishot accept. If a
+    // connection or an error is already staged, load the outcome into the
+    // specified 'result' and 'error' and return 'e_ACTION_ANNOUNCE'.
+    // Otherwise, note the request until the multishot accept completes, and
+    // return 'e_ACTION_ARM' if the multishot accept must be submitted, or
+    // 'e_ACTION_NONE' if it is already armed.
+    Action requestAccept(ntsa::Handle* result, ntsa::Error* error);
+
+    // Process the completion of a multishot accept of the specified
+    // 'accepted' handle, or failed with the specified 'failure', where the
+    // specified 'more' flag indicates whether the operation remains armed.
+    // If an accept is requested, load the outcome into the specified
+    // 'result' and 'error' and return 'e_ACTION_ANNOUNCE'. Otherwise, stage
+    // the outcome and return 'e_ACTION_NONE'.
+    Action completeAccept(ntsa::Handle*      result,
+                          ntsa::Error*       error,
+                          ntsa::Handle       accepted,
+                          const ntsa::Error& failure,
+                          bool               more);
+
+    // Forget the pending request of a multishot accept and mark the
+    // multishot accept as no longer armed.
+    void abandonAccept();
+
+    // Set the index of the socket in the fixed file table to the specified
+    // 'index', or -1 if the socket is not installed in the table.
+    void setFixedFile(int index);
+
+    // Return the index of the socket in the fixed file table, or -1 if the
+    // socket is not installed in the table.
+    int fixedFile() const;
+
     // Return the handle.
     ntsa::Handle handle() const;
 };
@@ -1543,6 +2070,15 @@ struct IoRingUtil {
                      bsl::size_t               completions,
                      const bsls::TimeInterval& deadline);
 
+    // Wake the kernel thread polling the submission queue of the specified
+    // 'ring'. Return 0 on success and a non-zero value otherwise.
+    static int wakeup(int ring);
+
+    // Return the parameters of an I/O ring that implements the specified
+    // proactor 'configuration'.
+    static ntco::IoRingConfig configure(
+        const ntca::ProactorConfig& configuration);
+
     // Perform the specified control 'operation' on the specified 'ring' using
     // the specified 'count' number of the specified 'operand' array. Return
     // 0 on success and a non-zero value otherwise.
@@ -1579,6 +2115,8 @@ const char* IoRingOperation::toString(IoRingOperation::Value mode)
         return "ASYNC_CANCEL";
     case IoRingOperation::e_CONNECT:
         return "CONNECT";
+    case IoRingOperation::e_RECV:
+        return "RECV";
     case IoRingOperation::e_SHUTDOWN:
         return "SHUTDOWN";
     case IoRingOperation::e_SENDMSG_ZC:
@@ -1599,6 +2137,7 @@ int IoRingOperation::fromInt(Value* result, bsl::uint8_t number)
     case IoRingOperation::e_ACCEPT:
     case IoRingOperation::e_ASYNC_CANCEL:
     case IoRingOperation::e_CONNECT:
+    case IoRingOperation::e_RECV:
     case IoRingOperation::e_SHUTDOWN:
     case IoRingOperation::e_SENDMSG_ZC:
         *result = static_cast<IoRingOperation::Value>(number);
@@ -1845,8 +2384,6 @@ IoRingWaiter::~IoRingWaiter()
 
 IoRingConfig::IoRingConfig()
 {
-    NTCCFG_WARNING_UNUSED(d_submissionQueueThreadCpu);
-    NTCCFG_WARNING_UNUSED(d_submissionQueueThreadIdle);
     NTCCFG_WARNING_UNUSED(d_wq);
     NTCCFG_WARNING_UNUSED(d_reserved);
     NTCCFG_WARNING_UNUSED(d_submissionQueueOffsetToDropped);
@@ -1902,6 +2439,27 @@ void IoRingConfig::setFeatures(bsl::uint32_t value)
     d_features = value;
 }
 
+void IoRingConfig::setSubmissionQueuePolling(bool value)
+{
+    if (value) {
+        d_flags |= k_SETUP_FLAG_SQPOLL;
+    }
+    else {
+        d_flags &= ~static_cast<bsl::uint32_t>(k_SETUP_FLAG_SQPOLL);
+    }
+}
+
+void IoRingConfig::setSubmissionQueueThreadCpu(bsl::uint32_t value)
+{
+    d_submissionQueueThreadCpu  = value;
+    d_flags                    |= k_SETUP_FLAG_SQ_AFF;
+}
+
+void IoRingConfig::setSubmissionQueueThreadIdle(bsl::uint32_t value)
+{
+    d_submissionQueueThreadIdle = value;
+}
+
 bsl::uint32_t IoRingConfig::submissionQueueCapacity() const
 {
     return d_submissionQueueCapacity;
@@ -1982,6 +2540,11 @@ bsl::uint32_t IoRingConfig::features() const
     return d_features;
 }
 
+bool IoRingConfig::isSubmissionQueuePolled() const
+{
+    return (d_flags & k_SETUP_FLAG_SQPOLL) != 0;
+}
+
 bool IoRingConfig::supportsCompletionQueueOverflow() const
 {
     return (d_features & k_FEATURE_FLAG_NODROP) != 0;
@@ -2127,8 +2690,6 @@ IoRingSubmission::IoRingSubmission()
     BSLMF_ASSERT(sizeof(ntco::IoRingSubmission) == 128);
 #endif
 
-    NTCCFG_WARNING_UNUSED(d_priority);
-    NTCCFG_WARNING_UNUSED(d_index);
     NTCCFG_WARNING_UNUSED(d_personality);
     NTCCFG_WARNING_UNUSED(d_splice);
     NTCCFG_WARNING_UNUSED(d_command);
@@ -2245,6 +2806,30 @@ ntsa::Error IoRingSubmission::prepareAccept(
     return ntsa::Error();
 }
 
+ntsa::Error IoRingSubmission::prepareMultishotAccept(
+    ntcs::Event*                                 event,
+    const bsl::shared_ptr<ntci::ProactorSocket>& socket,
+    ntsa::Handle                                 handle)
+{
+    BSLS_ASSERT(event->d_status == ntcs::EventStatus::e_FREE);
+
+    event->d_type   = ntcs::EventType::e_ACCEPT;
+    event->d_status = ntcs::EventStatus::e_PENDING;
+    event->d_socket = socket;
+    event->d_user   = static_cast<bsl::uint64_t>(
+        ntco::IoRingAcceptMode::e_MULTISHOT);
+
+    // The peer address is not requested: the same event describes each
+    // connection accepted, so its storage cannot be shared between them.
+
+    d_operation = static_cast<bsl::uint8_t>(ntco::IoRingOperation::e_ACCEPT);
+    d_priority  = static_cast<bsl::uint16_t>(k_ACCEPT_MULTISHOT);
+    d_handle    = handle;
+    d_event     = reinterpret_cast<bsl::uint64_t>(event);
+
+    return ntsa::Error();
+}
+
 ntsa::Error IoRingSubmission::prepareConnect(
     ntcs::Event*                                 event,
     const bsl::shared_ptr<ntci::ProactorSocket>& socket,
@@ -3173,6 +3758,60 @@ ntsa::Error IoRingSubmission::prepareReceive(
     return ntsa::Error();
 }
 
+ntsa::Error IoRingSubmission::prepareReceive(
+    ntcs::Event*                                 event,
+    const bsl::shared_ptr<ntci::ProactorSocket>& socket,
+    ntsa::Handle                                 handle,
+    bdlbb::Blob*                                 destination,
+    bsl::uint16_t                                group,
+    bsl::size_t                                  bufferSize,
+    bsl::size_t                                  maxBytes,
+    ntco::IoRingReceiveMode::Value               mode)
+{
+    BSLS_ASSERT(event->d_status == ntcs::EventStatus::e_FREE);
+    BSLS_ASSERT(mode != ntco::IoRingReceiveMode::e_DEFAULT);
+
+    if (bufferSize == 0) {
+        return ntsa::Error::invalid();
+    }
+
+    if (mode == ntco::IoRingReceiveMode::e_PROVIDED && destination == 0) {
+        return ntsa::Error::invalid();
+    }
+
+    // The kernel selects the buffer, so the length must be zero to receive
+    // up to the size of the selected buffer. A multishot receive requires a
+    // zero length, so a limit is only applied to a single receive.
+
+    bsl::size_t numBytesMax = 0;
+    if (mode == ntco::IoRingReceiveMode::e_PROVIDED && maxBytes != 0 &&
+        maxBytes < bufferSize)
+    {
+        numBytesMax = maxBytes;
+    }
+
+    event->d_type          = ntcs::EventType::e_RECEIVE;
+    event->d_status        = ntcs::EventStatus::e_PENDING;
+    event->d_socket        = socket;
+    event->d_receiveData_p = destination;
+    event->d_numBytesAttempted =
+        numBytesMax != 0 ? numBytesMax : bufferSize;
+    event->d_user = static_cast<bsl::uint64_t>(mode);
+
+    d_operation = static_cast<bsl::uint8_t>(ntco::IoRingOperation::e_RECV);
+    d_flags     = static_cast<bsl::uint8_t>(k_BUFFER_SELECT);
+    d_handle    = handle;
+    d_event     = reinterpret_cast<__u64>(event);
+    d_index     = group;
+    d_count     = static_cast<bsl::uint32_t>(numBytesMax);
+
+    if (mode == ntco::IoRingReceiveMode::e_MULTISHOT) {
+        d_priority = static_cast<bsl::uint16_t>(k_RECEIVE_MULTISHOT);
+    }
+
+    return ntsa::Error();
+}
+
 void IoRingSubmission::prepareCancellation(ntsa::Handle handle)
 {
     const bsl::uint32_t k_CANCEL_ALL = 1U << 0;
@@ -3185,6 +3824,25 @@ void IoRingSubmission::prepareCancellation(ntsa::Handle handle)
     d_options = k_CANCEL_ALL | k_CANCEL_FD;
 }
 
+void IoRingSubmission::prepareFixedCancellation(bsl::uint32_t index)
+{
+    const bsl::uint32_t k_CANCEL_ALL      = 1U << 0;
+    const bsl::uint32_t k_CANCEL_FD       = 1U << 1;
+    const bsl::uint32_t k_CANCEL_FD_FIXED = 1U << 3;
+
+    d_operation =
+        static_cast<bsl::uint8_t>(ntco::IoRingOperation::e_ASYNC_CANCEL);
+
+    d_handle  = static_cast<bsl::int32_t>(index);
+    d_options = k_CANCEL_ALL | k_CANCEL_FD | k_CANCEL_FD_FIXED;
+}
+
+void IoRingSubmission::setFixedFile(bsl::uint32_t index)
+{
+    d_handle = static_cast<bsl::int32_t>(index);
+    d_flags  = static_cast<bsl::uint8_t>(d_flags | k_FIXED_FILE);
+}
+
 void IoRingSubmission::prepareCancellation(ntcs::Event* event)
 {
     BSLS_ASSERT(event->d_status == ntcs::EventStatus::e_CANCELLED);
@@ -3196,6 +3854,17 @@ void IoRingSubmission::prepareCancellation(ntcs::Event* event)
     d_address = reinterpret_cast<bsl::uint64_t>(event);
 }
 
+void IoRingSubmission::prepareMultishotCancellation(ntcs::Event* event)
+{
+    BSLS_ASSERT(event->d_status == ntcs::EventStatus::e_PENDING);
+
+    d_operation =
+        static_cast<bsl::uint8_t>(ntco::IoRingOperation::e_ASYNC_CANCEL);
+
+    d_handle  = -1;
+    d_address = reinterpret_cast<bsl::uint64_t>(event);
+}
+
 ntsa::Handle IoRingSubmission::handle() const
 {
     return static_cast<ntsa::Handle>(d_handle);
@@ -3275,9 +3944,14 @@ bsl::ostream& operator<<(bsl::ostream& stream, const IoRingSubmission& object)
 }
 
 IoRingSubmissionQueue::IoRingSubmissionQueue()
-: d_mutex()
-, d_ring(-1)
+: d_ring(-1)
+, d_reserved(0)
+, d_published(0)
 , d_pending(0)
+, d_numRetries(0)
+, d_numFull(0)
+, d_numWakeups(0)
+, d_polled(false)
 , d_memoryMap_p(0)
 , d_head_p(0)
 , d_tail_p(0)
@@ -3302,8 +3976,6 @@ ntsa::Error IoRingSubmissionQueue::map(int                       ring,
 {
     NTCI_LOG_CONTEXT();
 
-    LockGuard guard(&d_mutex);
-
     if (d_ring != -1 && d_memoryMap_p != 0) {
         return ntsa::Error::invalid();
     }
@@ -3373,6 +4045,10 @@ ntsa::Error IoRingSubmissionQueue::map(int                       ring,
 
     ::madvise(d_entryArray, entryArrayLength, MADV_DONTFORK);
 
+    d_reserved  = *d_tail_p;
+    d_published = *d_tail_p;
+    d_polled    = d_params.isSubmissionQueuePolled();
+
     NTCO_IORING_LOG_SUBMISSION_QUEUE_MAP_COMPLETE(*d_head_p,
                                                   *d_tail_p,
                                                   *d_mask_p,
@@ -3381,76 +4057,133 @@ ntsa::Error IoRingSubmissionQueue::map(int                       ring,
     return ntsa::Error();
 }
 
-ntsa::Error IoRingSubmissionQueue::push(const ntco::IoRingSubmission& entry,
-                                        IoRingSubmissionMode::Value   mode)
+ntsa::Error IoRingSubmissionQueue::drain()
 {
     NTCI_LOG_CONTEXT();
 
-    ntsa::Error error;
-    int         rc;
+    if (d_polled) {
+        this->wakeup();
+        return ntsa::Error();
+    }
 
-    NTCO_IORING_LOG_SUBMISSION(entry, mode);
+    const bsl::size_t numToSubmit = this->gather();
 
-    BSLS_ASSERT(entry.isValid());
+    NTCO_IORING_LOG_ENTER_STARTING(numToSubmit, 0);
+    int rc = ntco::IoRingUtil::enter(d_ring, numToSubmit, 0);
+    NTCO_IORING_LOG_ENTER_COMPLETE(numToSubmit, 0, rc);
 
-    LockGuard guard(&d_mutex);
+    if (rc < 0) {
+        ntsa::Error error(errno);
+        NTCO_IORING_LOG_PUSH_FAILURE(error);
+        return error;
+    }
 
-    while (true) {
-        bool force = false;
+    BSLS_ASSERT(static_cast<bsl::size_t>(rc) == numToSubmit);
 
-        bsl::uint32_t mask = *d_mask_p;
-        bsl::uint32_t head = *d_head_p;
-        bsl::uint32_t tail = *d_tail_p;
-        bsl::uint32_t next = tail + 1;
+    return ntsa::Error();
+}
 
-        NTCO_IORING_READER_BARRIER();
+void IoRingSubmissionQueue::wakeup()
+{
+    NTCI_LOG_CONTEXT();
 
-        bsl::uint32_t headIndex = head & mask;
-        bsl::uint32_t tailIndex = tail & mask;
-        bsl::uint32_t nextIndex = next & mask;
+    // The kernel thread sets the wakeup flag before going to sleep, then
+    // checks the tail of the submission queue once more, so the tail must be
+    // visible to the kernel before the flag is read.
 
-        NTCO_IORING_LOG_SUBMISSION_QUEUE_PUSHING(head,
-                                                 tail,
-                                                 next,
-                                                 headIndex,
-                                                 tailIndex,
-                                                 nextIndex);
+    NTCO_IORING_MEMORY_BARRIER();
 
-        if (NTCCFG_LIKELY(nextIndex != headIndex)) {
-            d_entryArray[tailIndex] = entry;
-            d_array_p[tailIndex]    = tailIndex;
-            *d_tail_p               = next;
-            ++d_pending;
+    if ((*d_flags_p & k_NEED_WAKEUP) != 0) {
+        NTCO_IORING_LOG_SUBMISSION_QUEUE_WAKEUP();
+        ++d_numWakeups;
+        ntco::IoRingUtil::wakeup(d_ring);
+    }
+}
 
-            NTCO_IORING_WRITER_BARRIER();
-        }
-        else {
-            NTCO_IORING_LOG_SUBMISSION_QUEUE_FULL();
-            force = true;
-        }
+ntsa::Error IoRingSubmissionQueue::push(const ntco::IoRingSubmission& entry,
+                                        IoRingSubmissionMode::Value   mode)
+{
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    NTCO_IORING_LOG_SUBMISSION(entry, mode);
+
+    BSLS_ASSERT(entry.isValid());
 
-        if (mode == ntco::IoRingSubmissionMode::e_IMMEDIATE || force) {
-            const bsl::size_t numToSubmit = this->gather();
+    const bsl::uint32_t mask     = *d_mask_p;
+    const bsl::uint32_t capacity = *d_ringEntries_p;
 
-            NTCO_IORING_LOG_ENTER_STARTING(numToSubmit, 0);
-            rc = ntco::IoRingUtil::enter(d_ring, numToSubmit, 0);
-            NTCO_IORING_LOG_ENTER_COMPLETE(numToSubmit, 0, rc);
+    // Reserve an entry by advancing the reservation sequence number, unless
+    // the entry has not yet been consumed by the kernel, in which case the
+    // submission queue is full and must first be drained.
 
-            if (rc < 0) {
-                error = ntsa::Error(errno);
-                NTCO_IORING_LOG_PUSH_FAILURE(error);
+    bsl::uint32_t head;
+    bsl::uint32_t tail;
+
+    while (true) {
+        tail = d_reserved.loadAcquire();
+
+        NTCO_IORING_READER_BARRIER();
+        head = *d_head_p;
+
+        if (NTCCFG_UNLIKELY(tail - head >= capacity)) {
+            NTCO_IORING_LOG_SUBMISSION_QUEUE_FULL();
+            ++d_numFull;
+
+            error = this->drain();
+            if (error) {
                 return error;
             }
 
-            BSLS_ASSERT(static_cast<bsl::size_t>(rc) == numToSubmit);
-        }
-
-        if (force) {
+            bslmt::ThreadUtil::yield();
             continue;
         }
-        else {
+
+        if (NTCCFG_LIKELY(d_reserved.testAndSwap(tail, tail + 1) == tail)) {
             break;
         }
+
+        ++d_numRetries;
+    }
+
+    const bsl::uint32_t next = tail + 1;
+
+    NTCO_IORING_LOG_SUBMISSION_QUEUE_PUSHING(head,
+                                             tail,
+                                             next,
+                                             head & mask,
+                                             tail & mask,
+                                             next & mask);
+
+    d_entryArray[tail & mask] = entry;
+    d_array_p[tail & mask]    = tail & mask;
+
+    // Publish the entry by advancing the tail of the submission queue, once
+    // all entries reserved before this entry have been published.
+
+    if (NTCCFG_UNLIKELY(d_published.loadAcquire() != tail)) {
+        ++d_numRetries;
+        do {
+            bslmt::ThreadUtil::yield();
+        } while (d_published.loadAcquire() != tail);
+    }
+
+    NTCO_IORING_WRITER_BARRIER();
+    *d_tail_p = next;
+    NTCO_IORING_WRITER_BARRIER();
+
+    d_published.storeRelease(next);
+    ++d_pending;
+
+    if (d_polled) {
+        this->wakeup();
+    }
+    else if (mode == ntco::IoRingSubmissionMode::e_IMMEDIATE) {
+        error = this->drain();
+        if (error) {
+            return error;
+        }
     }
 
     return ntsa::Error();
@@ -3461,6 +4194,15 @@ bsl::size_t IoRingSubmissionQueue::gather()
     return static_cast<bsl::size_t>(d_pending.swap(0));
 }
 
+void IoRingSubmissionQueue::loadContention(bsl::size_t* numRetries,
+                                           bsl::size_t* numFull,
+                                           bsl::size_t* numWakeups)
+{
+    *numRetries = static_cast<bsl::size_t>(d_numRetries.swap(0));
+    *numFull    = static_cast<bsl::size_t>(d_numFull.swap(0));
+    *numWakeups = static_cast<bsl::size_t>(d_numWakeups.swap(0));
+}
+
 void IoRingSubmissionQueue::unmap()
 {
     int rc;
@@ -3483,8 +4225,6 @@ void IoRingSubmissionQueue::unmap()
 
 bsl::uint32_t IoRingSubmissionQueue::head() const
 {
-    LockGuard guard(&d_mutex);
-
     if (d_memoryMap_p != 0) {
         NTCO_IORING_READER_BARRIER();
         return *d_head_p;
@@ -3496,8 +4236,6 @@ bsl::uint32_t IoRingSubmissionQueue::head() const
 
 bsl::uint32_t IoRingSubmissionQueue::tail() const
 {
-    LockGuard guard(&d_mutex);
-
     if (d_memoryMap_p != 0) {
         NTCO_IORING_READER_BARRIER();
         return *d_tail_p;
@@ -3602,6 +4340,24 @@ bool IoRingCompletion::hasSucceeded() const
     return d_result >= 0;
 }
 
+bool IoRingCompletion::hasBuffer() const
+{
+    const bsl::uint32_t k_CQE_F_BUFFER = 1U << 0;
+    return (d_flags & k_CQE_F_BUFFER) != 0;
+}
+
+bsl::uint16_t IoRingCompletion::bufferId() const
+{
+    const bsl::uint32_t k_CQE_BUFFER_SHIFT = 16;
+    return static_cast<bsl::uint16_t>(d_flags >> k_CQE_BUFFER_SHIFT);
+}
+
+bool IoRingCompletion::hasMore() const
+{
+    const bsl::uint32_t k_CQE_F_MORE = 1U << 1;
+    return (d_flags & k_CQE_F_MORE) != 0;
+}
+
 bool IoRingCompletion::hasFailed() const
 {
     return d_result < 0;
@@ -3817,13 +4573,403 @@ bsl::uint32_t IoRingCompletionQueue::capacity() const
     return d_params.completionQueueCapacity();
 }
 
-IoRingDevice::IoRingDevice(bsl::size_t       queueDepth,
-                           bslma::Allocator* basicAllocator)
+IoRingBufferRing::IoRingBufferRing(bslma::Allocator* basicAllocator)
+: d_mutex()
+, d_ring(-1)
+, d_memoryMap_p(0)
+, d_memoryMapSize(0)
+, d_entryArray(0)
+, d_tail_p(0)
+, d_tail(0)
+, d_mask(0)
+, d_group(0)
+, d_bufferSize(0)
+, d_bufferVector(basicAllocator)
+, d_blobBufferFactory_sp()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLMF_ASSERT(sizeof(Entry) == 16);
+}
+
+IoRingBufferRing::~IoRingBufferRing()
+{
+    this->unmap();
+}
+
+void IoRingBufferRing::publish(const bdlbb::BlobBuffer& buffer,
+                               bsl::uint16_t            bufferId)
+{
+    Entry* entry = &d_entryArray[d_tail & d_mask];
+
+    entry->d_address  = reinterpret_cast<bsl::uint64_t>(buffer.data());
+    entry->d_length   = static_cast<bsl::uint32_t>(buffer.size());
+    entry->d_bufferId = bufferId;
+
+    d_bufferVector[bufferId] = buffer;
+
+    ++d_tail;
+
+    NTCO_IORING_WRITER_BARRIER();
+
+    *d_tail_p = d_tail;
+}
+
+ntsa::Error IoRingBufferRing::map(
+    int                                              ring,
+    bsl::uint16_t                                    group,
+    bsl::size_t                                      count,
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>& blobBufferFactory)
+{
+    NTCI_LOG_CONTEXT();
+
+    LockGuard guard(&d_mutex);
+
+    if (d_memoryMap_p != 0) {
+        return ntsa::Error::invalid();
+    }
+
+    if (count == 0 || count > 32768 || (count & (count - 1)) != 0) {
+        return ntsa::Error::invalid();
+    }
+
+    // The kernel requires the ring to be page-aligned, which is guaranteed
+    // by an anonymous memory map.
+
+    const bsl::size_t memoryMapSize = count * sizeof(Entry);
+
+    void* memoryMap = ::mmap(0,
+                             memoryMapSize,
+                             PROT_READ | PROT_WRITE,
+                             MAP_ANONYMOUS | MAP_PRIVATE,
+                             -1,
+                             0);
+
+    if (memoryMap == MAP_FAILED) {
+        ntsa::Error error(errno);
+        NTCO_IORING_LOG_BUFFER_RING_MAP_FAILED(error);
+        return error;
+    }
+
+    bsl::memset(memoryMap, 0, memoryMapSize);
+
+    // struct io_uring_buf_reg
+
+    struct Registration {
+        bsl::uint64_t d_address;
+        bsl::uint32_t d_count;
+        bsl::uint16_t d_group;
+        bsl::uint16_t d_flags;
+        bsl::uint64_t d_reserved[3];
+    };
+
+    Registration registration;
+    bsl::memset(&registration, 0, sizeof registration);
+
+    registration.d_address = reinterpret_cast<bsl::uint64_t>(memoryMap);
+    registration.d_count   = static_cast<bsl::uint32_t>(count);
+    registration.d_group   = group;
+
+    const bsl::size_t k_REGISTER_PBUF_RING = 22;
+
+    int rc = ntco::IoRingUtil::control(ring,
+                                       k_REGISTER_PBUF_RING,
+                                       &registration,
+                                       1);
+    if (rc != 0) {
+        ntsa::Error error(errno);
+        NTCO_IORING_LOG_BUFFER_RING_MAP_FAILED(error);
+        ::munmap(memoryMap, memoryMapSize);
+        return error;
+    }
+
+    d_ring                 = ring;
+    d_memoryMap_p          = memoryMap;
+    d_memoryMapSize        = memoryMapSize;
+    d_entryArray           = reinterpret_cast<Entry*>(memoryMap);
+    d_tail_p               = &d_entryArray[0].d_reserved;
+    d_tail                 = 0;
+    d_mask                 = static_cast<bsl::uint16_t>(count - 1);
+    d_group                = group;
+    d_blobBufferFactory_sp = blobBufferFactory;
+
+    d_bufferVector.resize(count);
+
+    for (bsl::size_t i = 0; i < count; ++i) {
+        bdlbb::BlobBuffer buffer;
+        d_blobBufferFactory_sp->allocate(&buffer);
+
+        if (i == 0) {
+            d_bufferSize = static_cast<bsl::size_t>(buffer.size());
+        }
+
+        BSLS_ASSERT(static_cast<bsl::size_t>(buffer.size()) == d_bufferSize);
+
+        this->publish(buffer, static_cast<bsl::uint16_t>(i));
+    }
+
+    NTCO_IORING_LOG_BUFFER_RING_MAP_COMPLETE(group, count, d_bufferSize);
+
+    return ntsa::Error();
+}
+
+ntsa::Error IoRingBufferRing::acquire(bdlbb::BlobBuffer* result,
+                                      bsl::uint16_t      bufferId,
+                                      bsl::size_t        numBytes)
+{
+    LockGuard guard(&d_mutex);
+
+    // An unmapped ring, or an identifier outside of the ring, has no slot
+    // to republish.
+
+    if (d_memoryMap_p == 0) {
+        return ntsa::Error::invalid();
+    }
+
+    if (bufferId >= d_bufferVector.size()) {
+        return ntsa::Error::invalid();
+    }
+
+    // The kernel has consumed the slot: always republish the buffer, even
+    // when the completion is rejected, so the ring does not shrink.
+
+    if (numBytes > d_bufferSize) {
+        this->publish(d_bufferVector[bufferId], bufferId);
+        return ntsa::Error::invalid();
+    }
+
+    *result = d_bufferVector[bufferId];
+    result->setSize(static_cast<int>(numBytes));
+
+    bdlbb::BlobBuffer buffer;
+    d_blobBufferFactory_sp->allocate(&buffer);
+
+    this->publish(buffer, bufferId);
+
+    return ntsa::Error();
+}
+
+void IoRingBufferRing::unmap()
+{
+    LockGuard guard(&d_mutex);
+
+    if (d_memoryMap_p != 0) {
+        struct Registration {
+            bsl::uint64_t d_address;
+            bsl::uint32_t d_count;
+            bsl::uint16_t d_group;
+            bsl::uint16_t d_flags;
+            bsl::uint64_t d_reserved[3];
+        };
+
+        Registration registration;
+        bsl::memset(&registration, 0, sizeof registration);
+
+        registration.d_group = d_group;
+
+        const bsl::size_t k_UNREGISTER_PBUF_RING = 23;
+
+        ntco::IoRingUtil::control(d_ring,
+                                  k_UNREGISTER_PBUF_RING,
+                                  &registration,
+                                  1);
+
+        int rc = ::munmap(d_memoryMap_p, d_memoryMapSize);
+        BSLS_ASSERT(rc == 0);
+
+        d_memoryMap_p   = 0;
+        d_memoryMapSize = 0;
+        d_entryArray    = 0;
+        d_tail_p        = 0;
+
+        d_bufferVector.clear();
+        d_blobBufferFactory_sp.reset();
+    }
+}
+
+bsl::uint16_t IoRingBufferRing::group() const
+{
+    return d_group;
+}
+
+bsl::size_t IoRingBufferRing::bufferSize() const
+{
+    LockGuard guard(&d_mutex);
+    return d_bufferSize;
+}
+
+bool IoRingBufferRing::isMapped() const
+{
+    LockGuard guard(&d_mutex);
+    return d_memoryMap_p != 0;
+}
+
+IoRingFileTable::IoRingFileTable(bslma::Allocator* basicAllocator)
+: d_mutex()
+, d_ring(-1)
+, d_capacity(0)
+, d_freeList(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+IoRingFileTable::~IoRingFileTable()
+{
+    this->unmap();
+}
+
+ntsa::Error IoRingFileTable::update(bsl::uint32_t index, ntsa::Handle handle)
+{
+    // struct io_uring_files_update
+
+    struct Update {
+        bsl::uint32_t d_offset;
+        bsl::uint32_t d_reserved;
+        bsl::uint64_t d_handles;
+    };
+
+    bsl::int32_t value = static_cast<bsl::int32_t>(handle);
+
+    Update update;
+    update.d_offset   = index;
+    update.d_reserved = 0;
+    update.d_handles  = reinterpret_cast<bsl::uint64_t>(&value);
+
+    const bsl::size_t k_REGISTER_FILES_UPDATE = 6;
+
+    int rc = ntco::IoRingUtil::control(d_ring,
+                                       k_REGISTER_FILES_UPDATE,
+                                       &update,
+                                       1);
+    if (rc < 0) {
+        return ntsa::Error(errno);
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error IoRingFileTable::map(int ring, bsl::size_t capacity)
+{
+    NTCI_LOG_CONTEXT();
+
+    LockGuard guard(&d_mutex);
+
+    if (d_ring != -1) {
+        return ntsa::Error::invalid();
+    }
+
+    if (capacity == 0 ||
+        capacity > static_cast<bsl::size_t>(
+                       bsl::numeric_limits<bsl::int32_t>::max()))
+    {
+        return ntsa::Error::invalid();
+    }
+
+    // Register a sparse table: each entry is initially empty.
+
+    bsl::vector<bsl::int32_t> handles(capacity, -1, d_allocator_p);
+
+    const bsl::size_t k_REGISTER_FILES = 2;
+
+    int rc = ntco::IoRingUtil::control(ring,
+                                       k_REGISTER_FILES,
+                                       &handles[0],
+                                       capacity);
+    if (rc != 0) {
+        ntsa::Error error(errno);
+        NTCO_IORING_LOG_FILE_TABLE_MAP_FAILED(error);
+        return error;
+    }
+
+    d_ring     = ring;
+    d_capacity = capacity;
+
+    d_freeList.reserve(capacity);
+    for (bsl::size_t i = capacity; i > 0; --i) {
+        d_freeList.push_back(static_cast<bsl::uint32_t>(i - 1));
+    }
+
+    NTCO_IORING_LOG_FILE_TABLE_MAP_COMPLETE(capacity);
+
+    return ntsa::Error();
+}
+
+ntsa::Error IoRingFileTable::acquire(bsl::uint32_t* index,
+                                     ntsa::Handle   handle)
+{
+    LockGuard guard(&d_mutex);
+
+    if (d_ring == -1) {
+        return ntsa::Error::invalid();
+    }
+
+    if (d_freeList.empty()) {
+        return ntsa::Error(ntsa::Error::e_LIMIT);
+    }
+
+    const bsl::uint32_t candidate = d_freeList.back();
+
+    ntsa::Error error = this->update(candidate, handle);
+    if (error) {
+        return error;
+    }
+
+    d_freeList.pop_back();
+
+    *index = candidate;
+    return ntsa::Error();
+}
+
+void IoRingFileTable::release(bsl::uint32_t index)
+{
+    LockGuard guard(&d_mutex);
+
+    if (d_ring == -1) {
+        return;
+    }
+
+    BSLS_ASSERT(index < d_capacity);
+
+    // Operations already submitted that refer to the file by this index hold
+    // their own reference to the file, so the index may be reused
+    // immediately.
+
+    this->update(index, -1);
+
+    d_freeList.push_back(index);
+}
+
+void IoRingFileTable::unmap()
+{
+    LockGuard guard(&d_mutex);
+
+    if (d_ring != -1) {
+        const bsl::size_t k_UNREGISTER_FILES = 3;
+
+        ntco::IoRingUtil::control(d_ring, k_UNREGISTER_FILES, 0, 0);
+
+        d_ring     = -1;
+        d_capacity = 0;
+
+        d_freeList.clear();
+    }
+}
+
+bool IoRingFileTable::isMapped() const
+{
+    LockGuard guard(&d_mutex);
+    return d_ring != -1;
+}
+
+IoRingDevice::IoRingDevice(bsl::size_t               queueDepth,
+                           const ntco::IoRingConfig& parameters,
+                           bslma::Allocator*         basicAllocator)
 : d_ring(-1)
 , d_submissionQueue()
 , d_completionQueue()
+, d_bufferRing(basicAllocator)
+, d_fileTable(basicAllocator)
 , d_probe()
-, d_params()
+, d_params(parameters)
 , d_flags(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
@@ -3852,7 +4998,35 @@ IoRingDevice::IoRingDevice(bsl::size_t       queueDepth,
 
     BSLS_ASSERT_OPT(queueDepth <= bsl::numeric_limits<bsl::uint32_t>::max());
 
+    int major = 0;
+    int minor = 0;
+    int patch = 0;
+    int build = 0;
+
+    const bool versionKnown =
+        ntsscm::Version::systemVersion(&major, &minor, &patch, &build) == 0;
+
+    if (d_params.isSubmissionQueuePolled()) {
+        // Submission queue polling requires elevated privileges, and the
+        // registration of every file operated upon, before Linux 5.11.
+
+        if (!versionKnown ||
+            KERNEL_VERSION(major, minor, patch) < KERNEL_VERSION(5, 11, 0))
+        {
+            NTCO_IORING_LOG_SUBMISSION_POLLING_FAILURE(
+                ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED));
+            d_params.reset();
+        }
+    }
+
     d_ring = ntco::IoRingUtil::setup(queueDepth, &d_params);
+    if (d_ring < 0 && parameters.isSubmissionQueuePolled()) {
+        ntsa::Error error(errno);
+        NTCO_IORING_LOG_SUBMISSION_POLLING_FAILURE(error);
+        d_params.reset();
+        d_ring = ntco::IoRingUtil::setup(queueDepth, &d_params);
+    }
+
     if (d_ring < 0) {
         ntsa::Error error(errno);
         NTCO_IORING_LOG_SETUP_FAILURE(error);
@@ -3868,17 +5042,19 @@ IoRingDevice::IoRingDevice(bsl::size_t       queueDepth,
     error = d_submissionQueue.map(d_ring, d_params);
     BSLS_ASSERT_OPT(!error);
 
-    error = d_completionQueue.map(d_ring, d_params);
-    BSLS_ASSERT_OPT(!error);
-
-    int major = 0;
-    int minor = 0;
-    int patch = 0;
-    int build = 0;
-    rc        = ntsscm::Version::systemVersion(&major, &minor, &patch, &build);
-    if (rc == 0) {
+    error = d_completionQueue.map(d_ring, d_params);
+    BSLS_ASSERT_OPT(!error);
+
+    if (versionKnown) {
         if (KERNEL_VERSION(major, minor, patch) >= KERNEL_VERSION(5, 19, 0)) {
-            d_flags &= k_SUPPORTS_CANCEL_BY_HANDLE;
+            d_flags |= k_SUPPORTS_CANCEL_BY_HANDLE;
+            d_flags |= k_SUPPORTS_BUFFER_RING;
+            d_flags |= k_SUPPORTS_MULTISHOT_ACCEPT;
+        }
+
+        if (KERNEL_VERSION(major, minor, patch) >= KERNEL_VERSION(6, 0, 0)) {
+            d_flags |= k_SUPPORTS_MULTISHOT_RECEIVE;
+            d_flags |= k_SUPPORTS_CANCEL_BY_FIXED;
         }
     }
 }
@@ -3889,6 +5065,8 @@ IoRingDevice::~IoRingDevice()
 
     int rc;
 
+    d_fileTable.unmap();
+    d_bufferRing.unmap();
     d_completionQueue.unmap();
     d_submissionQueue.unmap();
 
@@ -4050,6 +5228,63 @@ bsl::size_t IoRingDevice::flush(ntco::IoRingCompletion* entryList,
 }
 
 // Return the index of the head entry in the submission queue.
+ntsa::Error IoRingDevice::mapBufferRing(
+    bsl::size_t                                      count,
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>& blobBufferFactory)
+{
+    if (!this->supportsBufferRing()) {
+        return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+    }
+
+    return d_bufferRing.map(d_ring, 0, count, blobBufferFactory);
+}
+
+ntsa::Error IoRingDevice::acquireBuffer(bdlbb::BlobBuffer*            result,
+                                        const ntco::IoRingCompletion& entry)
+{
+    BSLS_ASSERT(entry.hasBuffer());
+
+    bsl::size_t numBytes = 0;
+    if (!entry.hasFailed()) {
+        numBytes = entry.result();
+    }
+
+    return d_bufferRing.acquire(result, entry.bufferId(), numBytes);
+}
+
+ntsa::Error IoRingDevice::mapFileTable(bsl::size_t capacity)
+{
+    return d_fileTable.map(d_ring, capacity);
+}
+
+ntsa::Error IoRingDevice::registerFile(bsl::uint32_t* index,
+                                       ntsa::Handle   handle)
+{
+    return d_fileTable.acquire(index, handle);
+}
+
+void IoRingDevice::deregisterFile(bsl::uint32_t index)
+{
+    d_fileTable.release(index);
+}
+
+bsl::uint16_t IoRingDevice::bufferGroup() const
+{
+    return d_bufferRing.group();
+}
+
+bsl::size_t IoRingDevice::bufferSize() const
+{
+    return d_bufferRing.bufferSize();
+}
+
+void IoRingDevice::loadSubmissionContention(bsl::size_t* numRetries,
+                                            bsl::size_t* numFull,
+                                            bsl::size_t* numWakeups)
+{
+    d_submissionQueue.loadContention(numRetries, numFull, numWakeups);
+}
+
 bsl::uint32_t IoRingDevice::submissionQueueHead() const
 {
     return d_submissionQueue.head();
@@ -4111,12 +5346,62 @@ bool IoRingDevice::supportsCancelByHandle() const
     return ((d_flags & k_SUPPORTS_CANCEL_BY_HANDLE) != 0);
 }
 
+bool IoRingDevice::supportsCancelByFixedHandle() const
+{
+    return ((d_flags & k_SUPPORTS_CANCEL_BY_FIXED) != 0);
+}
+
+bool IoRingDevice::supportsBufferRing() const
+{
+    return ((d_flags & k_SUPPORTS_BUFFER_RING) != 0);
+}
+
+bool IoRingDevice::hasBufferRing() const
+{
+    return d_bufferRing.isMapped();
+}
+
+bool IoRingDevice::supportsMultishotReceive() const
+{
+    return ((d_flags & k_SUPPORTS_MULTISHOT_RECEIVE) != 0);
+}
+
+bool IoRingDevice::supportsMultishotAccept() const
+{
+    return ((d_flags & k_SUPPORTS_MULTISHOT_ACCEPT) != 0);
+}
+
+bool IoRingDevice::hasFileTable() const
+{
+    return d_fileTable.isMapped();
+}
+
+bool IoRingDevice::isSubmissionQueuePolled() const
+{
+    return d_params.isSubmissionQueuePolled();
+}
+
 IoRingContext::IoRingContext(ntsa::Handle      handle,
                              bslma::Allocator* basicAllocator)
 : ntcs::ProactorDetachContext()
 , d_handle(handle)
 , d_pendingEventSetMutex()
 , d_pendingEventSet(basicAllocator)
+, d_receiveMutex()
+, d_receiveDestination_p(0)
+, d_receiveMaxBytes(0)
+, d_receiveMaxBuffers(0)
+, d_receiveStaged(basicAllocator)
+, d_receiveError()
+, d_receiveArmed(false)
+, d_receiveStopping(false)
+, d_receiveClosed(false)
+, d_acceptMutex()
+, d_acceptStaged(basicAllocator)
+, d_acceptError()
+, d_acceptRequested(false)
+, d_acceptArmed(false)
+, d_fixedFile(-1)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     BSLS_ASSERT(handle != ntsa::k_INVALID_HANDLE);
@@ -4142,6 +5427,16 @@ IoRingContext::~IoRingContext()
     // invoke a callback when it is complete.
 
     // BSLS_ASSERT(d_pendingEventSet.empty());
+
+    // Close each connection accepted by a multishot accept but never
+    // requested.
+
+    for (HandleQueue::const_iterator it = d_acceptStaged.begin();
+         it != d_acceptStaged.end();
+         ++it)
+    {
+        ntsu::SocketUtil::close(*it);
+    }
 }
 
 ntsa::Error IoRingContext::registerEvent(ntcs::Event* event)
@@ -4184,6 +5479,314 @@ void IoRingContext::loadPending(EventList* pendingEventList, bool remove)
     }
 }
 
+void IoRingContext::moveStaged(bdlbb::Blob* destination,
+                               bsl::size_t* numBytes)
+{
+    bsl::size_t numBytesRemaining =
+        static_cast<bsl::size_t>(d_receiveStaged.length());
+    if (d_receiveMaxBytes != 0 && d_receiveMaxBytes < numBytesRemaining) {
+        numBytesRemaining = d_receiveMaxBytes;
+    }
+
+    bsl::size_t numBuffersRemaining =
+        static_cast<bsl::size_t>(d_receiveStaged.numDataBuffers());
+    if (d_receiveMaxBuffers != 0 && d_receiveMaxBuffers < numBuffersRemaining)
+    {
+        numBuffersRemaining = d_receiveMaxBuffers;
+    }
+
+    *numBytes = 0;
+
+    // Hand out whole staged buffers while they fit, then at most the leading
+    // portion of the next buffer. The staged blob is trimmed by removing
+    // buffers and re-prepending the remainder of a split buffer as an alias
+    // into the same memory, rather than by erasing bytes, which may move the
+    // remaining bytes over the portion already shared with the destination.
+
+    int numBuffersConsumed = 0;
+
+    while (numBytesRemaining > 0 && numBuffersRemaining > 0) {
+        const bdlbb::BlobBuffer& buffer =
+            d_receiveStaged.buffer(numBuffersConsumed);
+        const bsl::size_t size = static_cast<bsl::size_t>(buffer.size());
+
+        if (size <= numBytesRemaining) {
+            destination->appendDataBuffer(buffer);
+            *numBytes         += size;
+            numBytesRemaining -= size;
+            --numBuffersRemaining;
+            ++numBuffersConsumed;
+        }
+        else {
+            destination->appendDataBuffer(
+                bdlbb::BlobBuffer(buffer.buffer(),
+                                  static_cast<int>(numBytesRemaining)));
+
+            bsl::shared_ptr<char> remainderData(
+                buffer.buffer(),
+                buffer.data() + numBytesRemaining);
+
+            bdlbb::BlobBuffer remainder(
+                remainderData,
+                static_cast<int>(size - numBytesRemaining));
+
+            *numBytes         += numBytesRemaining;
+            numBytesRemaining  = 0;
+
+            d_receiveStaged.removeBuffers(0, numBuffersConsumed + 1);
+            d_receiveStaged.prependDataBuffer(remainder);
+            return;
+        }
+    }
+
+    if (numBuffersConsumed > 0) {
+        d_receiveStaged.removeBuffers(0, numBuffersConsumed);
+    }
+}
+
+IoRingContext::Action IoRingContext::requestReceive(
+    bdlbb::Blob*                destination,
+    bsl::size_t*                numBytes,
+    ntsa::Error*                error,
+    const ntsa::ReceiveOptions& options)
+{
+    LockGuard guard(&d_receiveMutex);
+
+    *numBytes = 0;
+    *error    = ntsa::Error();
+
+    BSLS_ASSERT(d_receiveDestination_p == 0);
+
+    d_receiveMaxBytes   = options.maxBytes();
+    d_receiveMaxBuffers = options.maxBuffers();
+
+    if (d_receiveStaged.length() > 0) {
+        this->moveStaged(destination, numBytes);
+        return e_ACTION_ANNOUNCE;
+    }
+
+    if (d_receiveError) {
+        *error         = d_receiveError;
+        d_receiveError = ntsa::Error();
+        return e_ACTION_ANNOUNCE;
+    }
+
+    if (d_receiveClosed) {
+        return e_ACTION_ANNOUNCE;
+    }
+
+    d_receiveDestination_p = destination;
+
+    if (!d_receiveArmed) {
+        d_receiveArmed = true;
+        return e_ACTION_ARM;
+    }
+
+    return e_ACTION_NONE;
+}
+
+IoRingContext::Action IoRingContext::completeReceive(
+    bdlbb::Blob**            destination,
+    bsl::size_t*             numBytes,
+    ntsa::Error*             error,
+    const bdlbb::BlobBuffer& buffer,
+    const ntsa::Error&       result,
+    bool                     more)
+{
+    LockGuard guard(&d_receiveMutex);
+
+    *destination = 0;
+    *numBytes    = 0;
+    *error       = ntsa::Error();
+
+    bool stopped = false;
+
+    if (!more) {
+        stopped           = d_receiveStopping;
+        d_receiveArmed    = false;
+        d_receiveStopping = false;
+    }
+
+    if (result) {
+        if (result.number() == ENOBUFS) {
+            // The kernel exhausted the buffer ring. The buffer ring is
+            // replenished as each completion is processed, so re-arm the
+            // operation if a receive is still pending.
+
+            if (d_receiveDestination_p != 0 && !d_receiveArmed) {
+                d_receiveArmed = true;
+                return e_ACTION_ARM;
+            }
+
+            return e_ACTION_NONE;
+        }
+
+        if (result == ntsa::Error::e_CANCELLED) {
+            // Re-arm a multishot receive stopped because too much data was
+            // staged if a receive has since been requested. Any other
+            // cancellation is the result of the socket being closed.
+
+            if (stopped && d_receiveDestination_p != 0) {
+                d_receiveArmed = true;
+                return e_ACTION_ARM;
+            }
+
+            return e_ACTION_NONE;
+        }
+
+        if (d_receiveDestination_p != 0) {
+            *destination           = d_receiveDestination_p;
+            *error                 = result;
+            d_receiveDestination_p = 0;
+            return e_ACTION_ANNOUNCE;
+        }
+
+        d_receiveError = result;
+        return e_ACTION_NONE;
+    }
+
+    if (buffer.size() == 0) {
+        d_receiveClosed = true;
+        d_receiveArmed  = false;
+
+        if (d_receiveDestination_p != 0) {
+            *destination           = d_receiveDestination_p;
+            d_receiveDestination_p = 0;
+            return e_ACTION_ANNOUNCE;
+        }
+
+        return e_ACTION_NONE;
+    }
+
+    d_receiveStaged.appendDataBuffer(buffer);
+
+    if (d_receiveDestination_p != 0) {
+        *destination           = d_receiveDestination_p;
+        d_receiveDestination_p = 0;
+        this->moveStaged(*destination, numBytes);
+        return e_ACTION_ANNOUNCE;
+    }
+
+    // Nothing is requested, e.g. because receive flow control is applied to
+    // the socket. Stop the multishot receive once enough data is staged
+    // rather than continuing to consume buffers from the buffer ring.
+
+    if (d_receiveArmed && !d_receiveStopping &&
+        static_cast<bsl::size_t>(d_receiveStaged.length()) >=
+            NTCO_IORING_MULTISHOT_RECEIVE_STAGED_MAX)
+    {
+        d_receiveStopping = true;
+        return e_ACTION_STOP;
+    }
+
+    return e_ACTION_NONE;
+}
+
+void IoRingContext::abandonReceive()
+{
+    LockGuard guard(&d_receiveMutex);
+
+    d_receiveDestination_p = 0;
+    d_receiveArmed         = false;
+    d_receiveStopping      = false;
+}
+
+void IoRingContext::abandonStop()
+{
+    LockGuard guard(&d_receiveMutex);
+
+    d_receiveStopping = false;
+}
+
+IoRingContext::Action IoRingContext::requestAccept(ntsa::Handle* result,
+                                                   ntsa::Error*  error)
+{
+    LockGuard guard(&d_acceptMutex);
+
+    *result = ntsa::k_INVALID_HANDLE;
+    *error  = ntsa::Error();
+
+    if (!d_acceptStaged.empty()) {
+        *result = d_acceptStaged.front();
+        d_acceptStaged.pop_front();
+        return e_ACTION_ANNOUNCE;
+    }
+
+    if (d_acceptError) {
+        *error        = d_acceptError;
+        d_acceptError = ntsa::Error();
+        return e_ACTION_ANNOUNCE;
+    }
+
+    d_acceptRequested = true;
+
+    if (!d_acceptArmed) {
+        d_acceptArmed = true;
+        return e_ACTION_ARM;
+    }
+
+    return e_ACTION_NONE;
+}
+
+IoRingContext::Action IoRingContext::completeAccept(
+    ntsa::Handle*      result,
+    ntsa::Error*       error,
+    ntsa::Handle       accepted,
+    const ntsa::Error& failure,
+    bool               more)
+{
+    LockGuard guard(&d_acceptMutex);
+
+    *result = ntsa::k_INVALID_HANDLE;
+    *error  = ntsa::Error();
+
+    if (!more) {
+        d_acceptArmed = false;
+    }
+
+    if (failure) {
+        if (failure == ntsa::Error::e_CANCELLED) {
+            return e_ACTION_NONE;
+        }
+
+        if (d_acceptRequested) {
+            d_acceptRequested = false;
+            *error            = failure;
+            return e_ACTION_ANNOUNCE;
+        }
+
+        d_acceptError = failure;
+        return e_ACTION_NONE;
+    }
+
+    if (d_acceptRequested) {
+        d_acceptRequested = false;
+        *result           = accepted;
+        return e_ACTION_ANNOUNCE;
+    }
+
+    d_acceptStaged.push_back(accepted);
+    return e_ACTION_NONE;
+}
+
+void IoRingContext::abandonAccept()
+{
+    LockGuard guard(&d_acceptMutex);
+
+    d_acceptRequested = false;
+    d_acceptArmed     = false;
+}
+
+void IoRingContext::setFixedFile(int index)
+{
+    d_fixedFile = index;
+}
+
+int IoRingContext::fixedFile() const
+{
+    return d_fixedFile;
+}
+
 ntsa::Handle IoRingContext::handle() const
 {
     return d_handle;
@@ -4265,6 +5868,50 @@ int IoRingUtil::enter(int                       ring,
                                       sizeof options));
 }
 
+int IoRingUtil::wakeup(int ring)
+{
+    const long          k_SYSTEM_CALL_ENTER                = 426;
+    const bsl::uint32_t k_SYSTEM_CALL_ENTER_FLAG_SQ_WAKEUP = 1U << 1;
+
+    return static_cast<int>(::syscall(k_SYSTEM_CALL_ENTER,
+                                      ring,
+                                      0,
+                                      0,
+                                      k_SYSTEM_CALL_ENTER_FLAG_SQ_WAKEUP,
+                                      reinterpret_cast<sigset_t*>(0),
+                                      _NSIG / 8));
+}
+
+ntco::IoRingConfig IoRingUtil::configure(
+    const ntca::ProactorConfig& configuration)
+{
+    ntco::IoRingConfig result;
+
+    if (!configuration.submissionPolling().isNull() &&
+        configuration.submissionPolling().value())
+    {
+        result.setSubmissionQueuePolling(true);
+
+        if (!configuration.submissionPollingCpu().isNull()) {
+            result.setSubmissionQueueThreadCpu(static_cast<bsl::uint32_t>(
+                configuration.submissionPollingCpu().value()));
+        }
+
+        if (!configuration.submissionPollingIdleTime().isNull()) {
+            const bsls::Types::Int64 idle =
+                configuration.submissionPollingIdleTime()
+                    .value()
+                    .totalMilliseconds();
+            if (idle > 0) {
+                result.setSubmissionQueueThreadIdle(
+                    static_cast<bsl::uint32_t>(idle));
+            }
+        }
+    }
+
+    return result;
+}
+
 int IoRingUtil::control(int         ring,
                         bsl::size_t operation,
                         void*       operand,
@@ -4315,7 +5962,7 @@ IoRingTest::~IoRingTest()
 
 IoRingDeviceTest::IoRingDeviceTest(bsl::size_t       queueDepth,
                                    bslma::Allocator* basicAllocator)
-: d_device(queueDepth, basicAllocator)
+: d_device(queueDepth, ntco::IoRingConfig(), basicAllocator)
 , d_eventPool(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
@@ -4545,6 +6192,33 @@ class IoRing : public ntci::Proactor,
     // configuration, otherwise return false.
     bool isWaiter() const;
 
+    // Submit an operation to accept each connection from the backlog of the
+    // specified 'socket' identified by the specified 'handle' and managed
+    // by the specified 'context', that remains armed after each connection
+    // is accepted, in the specified 'submissionMode'. Return the error.
+    ntsa::Error submitAccept(
+        const bsl::shared_ptr<ntci::ProactorSocket>& socket,
+        const bsl::shared_ptr<ntco::IoRingContext>&  context,
+        ntsa::Handle                                 handle,
+        ntco::IoRingSubmissionMode::Value            submissionMode);
+
+    // Submit an operation to receive data from the specified 'socket'
+    // identified by the specified 'handle' and managed by the specified
+    // 'context' into a buffer selected from the provided buffer ring, in
+    // the specified receive 'mode' and submission 'submissionMode'. If
+    // 'mode' is 'IoRingReceiveMode::e_PROVIDED', append the selected buffer
+    // to the specified 'destination' upon completion, receiving at most the
+    // specified 'maxBytes', or at most the buffer size if 'maxBytes' is
+    // zero. Return the error.
+    ntsa::Error submitReceive(
+        const bsl::shared_ptr<ntci::ProactorSocket>& socket,
+        const bsl::shared_ptr<ntco::IoRingContext>&  context,
+        ntsa::Handle                                 handle,
+        bdlbb::Blob*                                 destination,
+        bsl::size_t                                  maxBytes,
+        ntco::IoRingReceiveMode::Value               mode,
+        ntco::IoRingSubmissionMode::Value            submissionMode);
+
     // Return the number of proactors in the thread pool.
     bsl::size_t numProactors() const BSLS_KEYWORD_OVERRIDE;
 
@@ -4713,6 +6387,10 @@ class IoRing : public ntci::Proactor,
     void moveAndExecute(FunctorSequence* functorSequence,
                         const Functor&   functor) BSLS_KEYWORD_OVERRIDE;
 
+    /// Defer the execution of the callable object stored by the specified
+    /// 'functor', leaving the 'functor' empty.
+    void executeInplace(InplaceFunctor* functor) BSLS_KEYWORD_OVERRIDE;
+
     // Create a new timer according to the specified 'options' that invokes
     // the specified 'session' for each timer event on this object's
     // 'strand()', if defined, or on an unspecified thread otherwise.
@@ -4825,6 +6503,11 @@ class IoRing : public ntci::Proactor,
     const bsl::shared_ptr<ntci::DataPool>& dataPool() const
         BSLS_KEYWORD_OVERRIDE;
 
+    // Return true if the proactor selects the buffer into which data
+    // incoming to a stream socket is copied at the time that data arrives,
+    // otherwise return false.
+    bool supportsProvidedBuffers() const BSLS_KEYWORD_OVERRIDE;
+
     // Return the strand that guarantees sequential, non-current execution
     // of arbitrary functors on the unspecified threads processing events
     // for this object.
@@ -4888,6 +6571,15 @@ void IoRing::flush()
                 continue;
             }
 
+            if (NTCCFG_UNLIKELY(entry.hasBuffer())) {
+                bdlbb::BlobBuffer providedBuffer;
+                d_device.acquireBuffer(&providedBuffer, entry);
+            }
+
+            if (NTCCFG_UNLIKELY(entry.hasMore())) {
+                continue;
+            }
+
             bslma::ManagedPtr<ntcs::Event> event(entry.event(), &d_eventPool);
 
             if (event->d_socket) {
@@ -4952,6 +6644,28 @@ void IoRing::wait(ntci::Waiter waiter)
         d_semaphore.post();
     }
 
+#if NTC_BUILD_WITH_METRICS
+    {
+        IoRingWaiter* result = static_cast<IoRingWaiter*>(waiter);
+
+        NTCS_PROACTORMETRICS_GET();
+
+        if (metrics) {
+            bsl::size_t numRetries = 0;
+            bsl::size_t numFull    = 0;
+            bsl::size_t numWakeups = 0;
+
+            d_device.loadSubmissionContention(&numRetries,
+                                              &numFull,
+                                              &numWakeups);
+
+            NTCS_PROACTORMETRICS_UPDATE_SUBMISSION_CONTENTION(numRetries,
+                                                              numFull,
+                                                              numWakeups);
+        }
+    }
+#endif
+
     for (bsl::size_t entryIndex = 0; entryIndex < entryCount; ++entryIndex) {
         const ntco::IoRingCompletion& entry = entryList[entryIndex];
 
@@ -4961,8 +6675,21 @@ void IoRing::wait(ntci::Waiter waiter)
             continue;
         }
 
+        bdlbb::BlobBuffer providedBuffer;
+        if (NTCCFG_UNLIKELY(entry.hasBuffer())) {
+            d_device.acquireBuffer(&providedBuffer, entry);
+        }
+
         bslma::ManagedPtr<ntcs::Event> event(entry.event(), &d_eventPool);
 
+        if (NTCCFG_UNLIKELY(entry.hasMore())) {
+            // The operation remains armed, so the event must not be returned
+            // to the pool until its final completion is processed.
+
+            event.release();
+            event.load(entry.event(), 0, &bslma::ManagedPtrUtil::noOpDeleter);
+        }
+
         ntsa::Error eventError;
         if (entry.hasFailed()) {
             eventError     = entry.error();
@@ -4980,10 +6707,16 @@ void IoRing::wait(ntci::Waiter waiter)
         }
         else {
             if (event->d_status == ntcs::EventStatus::e_CANCELLED) {
+                if (event->d_type == ntcs::EventType::e_ACCEPT) {
+                    ntsu::SocketUtil::close(
+                        static_cast<ntsa::Handle>(entry.result()));
+                }
                 continue;
             }
             BSLS_ASSERT(event->d_status == ntcs::EventStatus::e_PENDING);
-            event->d_status = ntcs::EventStatus::e_COMPLETE;
+            if (!entry.hasMore()) {
+                event->d_status = ntcs::EventStatus::e_COMPLETE;
+            }
         }
 
         ntsa::Handle handle = ntsa::k_INVALID_HANDLE;
@@ -4991,7 +6724,9 @@ void IoRing::wait(ntci::Waiter waiter)
             handle = event->d_socket->handle();
         }
 
-        if (NTCCFG_UNLIKELY(!d_device.supportsCancelByHandle())) {
+        if (NTCCFG_UNLIKELY(!d_device.supportsCancelByHandle() &&
+                            !entry.hasMore()))
+        {
             if (event->d_socket) {
                 bsl::shared_ptr<ntco::IoRingContext> context =
                     bslstl::SharedPtrUtil::staticCast<ntco::IoRingContext>(
@@ -5004,7 +6739,18 @@ void IoRing::wait(ntci::Waiter waiter)
 
         if (entry.wasCanceled()) {
             NTCO_IORING_LOG_EVENT_CANCELLED(event);
-            continue;
+
+            // The termination of a multishot receive stopped because too
+            // much data was staged must be processed so that the receive
+            // may be re-armed.
+
+            if (event->d_type != ntcs::EventType::e_RECEIVE ||
+                event->d_user !=
+                    static_cast<bsl::uint64_t>(
+                        ntco::IoRingReceiveMode::e_MULTISHOT))
+            {
+                continue;
+            }
         }
 
         NTCO_IORING_LOG_EVENT_COMPLETE(event);
@@ -5016,9 +6762,53 @@ void IoRing::wait(ntci::Waiter waiter)
                     event->d_function();
                 }
             }
-        }
-        else if (event->d_type == ntcs::EventType::e_ACCEPT) {
-            BSLS_ASSERT(event->d_socket);
+        }
+        else if (event->d_type == ntcs::EventType::e_ACCEPT) {
+            BSLS_ASSERT(event->d_socket);
+
+            if (event->d_user == ntco::IoRingAcceptMode::e_MULTISHOT) {
+                ntsa::Handle accepted = ntsa::k_INVALID_HANDLE;
+                if (!eventError) {
+                    accepted = static_cast<ntsa::Handle>(entry.result());
+                }
+
+                bsl::shared_ptr<ntco::IoRingContext> socketContext =
+                    bslstl::SharedPtrUtil::staticCast<ntco::IoRingContext>(
+                        event->d_socket->getProactorContext());
+                if (handle == ntsa::k_INVALID_HANDLE || !socketContext) {
+                    if (accepted != ntsa::k_INVALID_HANDLE) {
+                        ntsu::SocketUtil::close(accepted);
+                    }
+                    continue;
+                }
+
+                ntsa::Handle target = ntsa::k_INVALID_HANDLE;
+                ntsa::Error  acceptError;
+
+                ntco::IoRingContext::Action action =
+                    socketContext->completeAccept(&target,
+                                                  &acceptError,
+                                                  accepted,
+                                                  eventError,
+                                                  entry.hasMore());
+
+                if (action == ntco::IoRingContext::e_ACTION_ANNOUNCE) {
+                    bsl::shared_ptr<ntsi::StreamSocket> streamSocket;
+                    if (!acceptError) {
+                        streamSocket =
+                            ntsf::System::createStreamSocket(target,
+                                                             d_allocator_p);
+                    }
+
+                    ntcs::Dispatch::announceAccepted(
+                        event->d_socket,
+                        acceptError,
+                        streamSocket,
+                        event->d_socket->strand());
+                }
+
+                continue;
+            }
 
             if (handle == ntsa::k_INVALID_HANDLE) {
                 continue;
@@ -5124,6 +6914,138 @@ void IoRing::wait(ntci::Waiter waiter)
                 continue;
             }
 
+            const ntco::IoRingReceiveMode::Value receiveMode =
+                static_cast<ntco::IoRingReceiveMode::Value>(event->d_user);
+
+            if (receiveMode == ntco::IoRingReceiveMode::e_MULTISHOT) {
+                bsl::shared_ptr<ntco::IoRingContext> socketContext =
+                    bslstl::SharedPtrUtil::staticCast<ntco::IoRingContext>(
+                        event->d_socket->getProactorContext());
+                if (!socketContext) {
+                    continue;
+                }
+
+                bdlbb::Blob* destination = 0;
+                bsl::size_t  numBytes    = 0;
+                ntsa::Error  receiveError;
+
+                ntco::IoRingContext::Action action =
+                    socketContext->completeReceive(&destination,
+                                                   &numBytes,
+                                                   &receiveError,
+                                                   providedBuffer,
+                                                   eventError,
+                                                   entry.hasMore());
+
+                if (action == ntco::IoRingContext::e_ACTION_STOP) {
+                    ntco::IoRingSubmission cancellation;
+                    cancellation.prepareMultishotCancellation(event.get());
+
+                    error = d_device.submit(
+                        cancellation,
+                        ntco::IoRingSubmissionMode::e_DEFERRED);
+                    if (error) {
+                        NTCO_IORING_LOG_PUSH_FAILURE(error);
+                        socketContext->abandonStop();
+                    }
+                }
+                else if (action == ntco::IoRingContext::e_ACTION_ARM) {
+                    error = this->submitReceive(
+                        event->d_socket,
+                        socketContext,
+                        handle,
+                        0,
+                        0,
+                        ntco::IoRingReceiveMode::e_MULTISHOT,
+                        ntco::IoRingSubmissionMode::e_DEFERRED);
+                    if (error) {
+                        socketContext->abandonReceive();
+
+                        ntcs::Dispatch::announceReceived(
+                            event->d_socket,
+                            error,
+                            ntsa::ReceiveContext(),
+                            event->d_socket->strand());
+                    }
+                }
+                else if (action == ntco::IoRingContext::e_ACTION_ANNOUNCE) {
+                    ntsa::ReceiveContext context;
+                    context.setBytesReceivable(numBytes);
+                    context.setBytesReceived(numBytes);
+
+                    ntcs::Dispatch::announceReceived(
+                        event->d_socket,
+                        receiveError,
+                        context,
+                        event->d_socket->strand());
+                }
+
+                continue;
+            }
+
+            if (receiveMode == ntco::IoRingReceiveMode::e_PROVIDED) {
+                if (eventError && eventError.number() == ENOBUFS) {
+                    // The kernel exhausted the buffer ring. The buffer ring
+                    // is replenished as each completion is processed, so
+                    // retry the operation.
+
+                    bsl::shared_ptr<ntco::IoRingContext> socketContext =
+                        bslstl::SharedPtrUtil::staticCast<
+                            ntco::IoRingContext>(
+                            event->d_socket->getProactorContext());
+                    if (!socketContext) {
+                        continue;
+                    }
+
+                    eventError = this->submitReceive(
+                        event->d_socket,
+                        socketContext,
+                        handle,
+                        event->d_receiveData_p,
+                        event->d_numBytesAttempted,
+                        ntco::IoRingReceiveMode::e_PROVIDED,
+                        ntco::IoRingSubmissionMode::e_DEFERRED);
+                    if (!eventError) {
+                        continue;
+                    }
+                }
+
+                ntsa::ReceiveContext context;
+                context.setBytesReceivable(event->d_numBytesAttempted);
+
+                if (eventError) {
+                    ntcs::Dispatch::announceReceived(
+                        event->d_socket,
+                        eventError,
+                        context,
+                        event->d_socket->strand());
+                }
+                else {
+                    bsl::size_t numBytes = entry.result();
+
+                    BSLS_ASSERT(event->d_receiveData_p);
+                    BSLS_ASSERT(static_cast<bsl::size_t>(
+                                    providedBuffer.size()) == numBytes);
+
+                    if (numBytes > 0) {
+                        event->d_receiveData_p->appendDataBuffer(
+                            providedBuffer);
+                    }
+
+                    event->d_numBytesCompleted = numBytes;
+
+                    context.setBytesReceived(numBytes);
+
+                    ntcs::Dispatch::announceReceived(
+                        event->d_socket,
+                        ntsa::Error(),
+                        context,
+                        event->d_socket->strand());
+                }
+
+                continue;
+            }
+
             ntsa::ReceiveContext context;
             context.setBytesReceivable(event->d_numBytesAttempted);
 
@@ -5253,7 +7175,9 @@ IoRing::IoRing(const ntca::ProactorConfig&        configuration,
                const bsl::shared_ptr<ntci::User>& user,
                bslma::Allocator*                  basicAllocator)
 : d_object("ntco::IoRing")
-, d_device(NTCO_IORING_QUEUE_DEPTH, basicAllocator)
+, d_device(NTCO_IORING_QUEUE_DEPTH,
+           ntco::IoRingUtil::configure(configuration),
+           basicAllocator)
 , d_eventPool(basicAllocator)
 , d_contextMapMutex()
 , d_contextMap(basicAllocator)
@@ -5336,6 +7260,26 @@ IoRing::IoRing(const ntca::ProactorConfig&        configuration,
         d_config.setMetricCollectionPerSocket(false);
     }
 
+    if (d_config.timerWheel().isNull()) {
+        d_config.setTimerWheel(NTCCFG_DEFAULT_TIMER_WHEEL);
+    }
+
+    if (d_config.timerWheelResolution().isNull()) {
+        bsls::TimeInterval timerWheelResolution;
+        timerWheelResolution.setTotalMicroseconds(
+            NTCCFG_DEFAULT_TIMER_WHEEL_RESOLUTION);
+
+        d_config.setTimerWheelResolution(timerWheelResolution);
+    }
+
+    if (d_config.timerWheel().value()) {
+        ntsa::Error error = d_chronology.configureTimerWheel(
+            d_config.timerWheelResolution().value());
+        if (error) {
+            d_config.setTimerWheel(false);
+        }
+    }
+
     if (d_user_sp) {
         d_dataPool_sp = d_user_sp->dataPool();
     }
@@ -5347,6 +7291,101 @@ IoRing::IoRing(const ntca::ProactorConfig&        configuration,
         d_dataPool_sp = dataPool;
     }
 
+    if (!d_config.providedBufferCount().isNull() &&
+        d_config.providedBufferCount().value() > 0)
+    {
+        // The kernel requires the number of entries in a buffer ring to be
+        // a power of two no greater than 32768.
+
+        bsl::size_t count = 1;
+        while (count < d_config.providedBufferCount().value() &&
+               count < 32768)
+        {
+            count <<= 1;
+        }
+
+        // Fill the ring from a pool of buffers sized the same as the
+        // incoming buffers of the data pool, so buffers released by the
+        // user after their data is consumed are recycled into the ring
+        // rather than returned to the allocator.
+
+        bsl::size_t bufferSize;
+        {
+            bdlbb::BlobBuffer buffer;
+            d_dataPool_sp->incomingBlobBufferFactory()->allocate(&buffer);
+            bufferSize = static_cast<bsl::size_t>(buffer.size());
+        }
+
+        bsl::shared_ptr<ntcs::BlobBufferPool> bufferPool;
+        bufferPool.createInplace(d_allocator_p, bufferSize, d_allocator_p);
+
+        bufferPool->reserve(count);
+
+        ntsa::Error error = d_device.mapBufferRing(count, bufferPool);
+        if (error) {
+            d_config.setProvidedBufferCount(0);
+        }
+        else {
+            d_config.setProvidedBufferCount(count);
+        }
+    }
+    else {
+        d_config.setProvidedBufferCount(0);
+    }
+
+    // A multishot receive stages data arriving while no receive is pending,
+    // so it is only safe when completions are processed by a single thread.
+
+    if (d_config.multishotReceive().isNull()) {
+        d_config.setMultishotReceive(false);
+    }
+
+    if (d_config.multishotReceive().value()) {
+        if (!d_device.hasBufferRing() ||
+            !d_device.supportsMultishotReceive() ||
+            d_config.maxThreads().value() > 1)
+        {
+            d_config.setMultishotReceive(false);
+        }
+    }
+
+    d_config.setSubmissionPolling(d_device.isSubmissionQueuePolled());
+
+    if (d_config.multishotAccept().isNull()) {
+        d_config.setMultishotAccept(false);
+    }
+
+    if (d_config.multishotAccept().value()) {
+        if (!d_device.supportsMultishotAccept() ||
+            d_config.maxThreads().value() > 1)
+        {
+            d_config.setMultishotAccept(false);
+        }
+    }
+
+    if (d_device.supportsCancelByHandle() &&
+        !d_device.supportsCancelByFixedHandle())
+    {
+        // Pending operations are cancelled by handle without being tracked
+        // individually, so sockets may only be operated on by their index in
+        // the fixed file table if they can also be cancelled by that index.
+
+        d_config.setFixedFileCount(0);
+    }
+
+    if (!d_config.fixedFileCount().isNull() &&
+        d_config.fixedFileCount().value() > 0)
+    {
+        ntsa::Error error =
+            d_device.mapFileTable(d_config.fixedFileCount().value());
+        if (error) {
+            d_config.setFixedFileCount(0);
+        }
+    }
+    else {
+        d_config.setFixedFileCount(0);
+    }
+
     if (d_user_sp) {
         d_resolver_sp = d_user_sp->resolver();
     }
@@ -5519,6 +7558,17 @@ ntsa::Error IoRing::attachSocket(
     bsl::shared_ptr<ntco::IoRingContext> context;
     context.createInplace(d_allocator_p, handle, d_allocator_p);
 
+    if (d_device.hasFileTable()) {
+        // Operate on the socket by its index in the fixed file table, if
+        // the table has room, otherwise operate on the socket by handle.
+
+        bsl::uint32_t index;
+        error = d_device.registerFile(&index, handle);
+        if (!error) {
+            context->setFixedFile(static_cast<int>(index));
+        }
+    }
+
     {
         LockGuard lockGuard(&d_contextMapMutex);
 
@@ -5527,6 +7577,10 @@ ntsa::Error IoRing::attachSocket(
                 .second;
 
         if (!insertResult) {
+            if (context->fixedFile() >= 0) {
+                d_device.deregisterFile(
+                    static_cast<bsl::uint32_t>(context->fixedFile()));
+            }
             return ntsa::Error::invalid();
         }
     }
@@ -5552,6 +7606,48 @@ ntsa::Error IoRing::accept(const bsl::shared_ptr<ntci::ProactorSocket>& socket)
     ntsa::Handle handle = context->handle();
     BSLS_ASSERT(handle != ntsa::k_INVALID_HANDLE);
 
+    if (d_config.multishotAccept().value()) {
+        ntsa::Handle accepted = ntsa::k_INVALID_HANDLE;
+        ntsa::Error  acceptError;
+
+        ntco::IoRingContext::Action action =
+            context->requestAccept(&accepted, &acceptError);
+
+        if (action == ntco::IoRingContext::e_ACTION_ARM) {
+            ntco::IoRingSubmissionMode::Value mode;
+            if (NTCCFG_LIKELY(isWaiter())) {
+                mode = NTCO_IORING_DEFAULT_SUBMISSION_MODE_ACCEPT;
+            }
+            else {
+                mode = ntco::IoRingSubmissionMode::e_IMMEDIATE;
+            }
+
+            error = this->submitAccept(socket, context, handle, mode);
+            if (error) {
+                context->abandonAccept();
+                return error;
+            }
+        }
+        else if (action == ntco::IoRingContext::e_ACTION_ANNOUNCE) {
+            // Announce the staged connection asynchronously: the caller may
+            // be holding a lock that the announcement acquires.
+
+            bsl::shared_ptr<ntsi::StreamSocket> streamSocket;
+            if (!acceptError) {
+                streamSocket =
+                    ntsf::System::createStreamSocket(accepted, d_allocator_p);
+            }
+
+            this->execute(NTCCFG_BIND(&ntcs::Dispatch::announceAccepted,
+                                      socket,
+                                      acceptError,
+                                      streamSocket,
+                                      socket->strand()));
+        }
+
+        return ntsa::Error();
+    }
+
     bslma::ManagedPtr<ntcs::Event> event =
         d_eventPool.getManagedObject(socket, context);
     if (NTCCFG_UNLIKELY(!event)) {
@@ -5564,6 +7660,10 @@ ntsa::Error IoRing::accept(const bsl::shared_ptr<ntci::ProactorSocket>& socket)
         return error;
     }
 
+    if (context->fixedFile() >= 0) {
+        entry.setFixedFile(static_cast<bsl::uint32_t>(context->fixedFile()));
+    }
+
     if (NTCCFG_UNLIKELY(!d_device.supportsCancelByHandle())) {
         context->registerEvent(event.get());
     }
@@ -5621,6 +7721,10 @@ ntsa::Error IoRing::connect(
         return error;
     }
 
+    if (context->fixedFile() >= 0) {
+        entry.setFixedFile(static_cast<bsl::uint32_t>(context->fixedFile()));
+    }
+
     if (NTCCFG_UNLIKELY(!d_device.supportsCancelByHandle())) {
         context->registerEvent(event.get());
     }
@@ -5678,6 +7782,10 @@ ntsa::Error IoRing::send(const bsl::shared_ptr<ntci::ProactorSocket>& socket,
         return error;
     }
 
+    if (context->fixedFile() >= 0) {
+        entry.setFixedFile(static_cast<bsl::uint32_t>(context->fixedFile()));
+    }
+
     if (NTCCFG_UNLIKELY(!d_device.supportsCancelByHandle())) {
         context->registerEvent(event.get());
     }
@@ -5735,6 +7843,10 @@ ntsa::Error IoRing::send(const bsl::shared_ptr<ntci::ProactorSocket>& socket,
         return error;
     }
 
+    if (context->fixedFile() >= 0) {
+        entry.setFixedFile(static_cast<bsl::uint32_t>(context->fixedFile()));
+    }
+
     if (NTCCFG_UNLIKELY(!d_device.supportsCancelByHandle())) {
         context->registerEvent(event.get());
     }
@@ -5781,6 +7893,71 @@ ntsa::Error IoRing::receive(
     ntsa::Handle handle = context->handle();
     BSLS_ASSERT(handle != ntsa::k_INVALID_HANDLE);
 
+    // Receive into the provided buffer ring only when the options request
+    // nothing but the data itself: meta data and zero-copy notifications
+    // are only available through 'recvmsg', below.
+
+    if (d_device.hasBufferRing() && socket->isStream() &&
+        !options.wantMetaData() && !options.zeroCopy())
+    {
+        ntco::IoRingSubmissionMode::Value mode;
+        if (NTCCFG_LIKELY(isWaiter())) {
+            mode = NTCO_IORING_DEFAULT_SUBMISSION_MODE_RECEIVE;
+        }
+        else {
+            mode = ntco::IoRingSubmissionMode::e_IMMEDIATE;
+        }
+
+        if (!d_config.multishotReceive().value()) {
+            return this->submitReceive(socket,
+                                       context,
+                                       handle,
+                                       data,
+                                       options.maxBytes(),
+                                       ntco::IoRingReceiveMode::e_PROVIDED,
+                                       mode);
+        }
+
+        bsl::size_t numBytes = 0;
+        ntsa::Error receiveError;
+
+        ntco::IoRingContext::Action action =
+            context->requestReceive(data,
+                                    &numBytes,
+                                    &receiveError,
+                                    options);
+
+        if (action == ntco::IoRingContext::e_ACTION_ARM) {
+            error = this->submitReceive(socket,
+                                        context,
+                                        handle,
+                                        0,
+                                        0,
+                                        ntco::IoRingReceiveMode::e_MULTISHOT,
+                                        mode);
+            if (error) {
+                context->abandonReceive();
+                return error;
+            }
+        }
+        else if (action == ntco::IoRingContext::e_ACTION_ANNOUNCE) {
+            // Announce the staged data asynchronously: the caller may be
+            // holding a lock that the announcement acquires.
+
+            ntsa::ReceiveContext receiveContext;
+            receiveContext.setBytesReceivable(numBytes);
+            receiveContext.setBytesReceived(numBytes);
+
+            this->execute(NTCCFG_BIND(&ntcs::Dispatch::announceReceived,
+                                      socket,
+                                      receiveError,
+                                      receiveContext,
+                                      socket->strand()));
+        }
+
+        return ntsa::Error();
+    }
+
     bslma::ManagedPtr<ntcs::Event> event =
         d_eventPool.getManagedObject(socket, context);
     if (NTCCFG_UNLIKELY(!event)) {
@@ -5793,6 +7970,10 @@ ntsa::Error IoRing::receive(
         return error;
     }
 
+    if (context->fixedFile() >= 0) {
+        entry.setFixedFile(static_cast<bsl::uint32_t>(context->fixedFile()));
+    }
+
     if (NTCCFG_UNLIKELY(!d_device.supportsCancelByHandle())) {
         context->registerEvent(event.get());
     }
@@ -5820,6 +8001,106 @@ ntsa::Error IoRing::receive(
     return ntsa::Error();
 }
 
+ntsa::Error IoRing::submitAccept(
+    const bsl::shared_ptr<ntci::ProactorSocket>& socket,
+    const bsl::shared_ptr<ntco::IoRingContext>&  context,
+    ntsa::Handle                                 handle,
+    ntco::IoRingSubmissionMode::Value            submissionMode)
+{
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    bslma::ManagedPtr<ntcs::Event> event =
+        d_eventPool.getManagedObject(socket, context);
+    if (NTCCFG_UNLIKELY(!event)) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    ntco::IoRingSubmission entry;
+    error = entry.prepareMultishotAccept(event.get(), socket, handle);
+    if (NTCCFG_UNLIKELY(error)) {
+        return error;
+    }
+
+    if (context->fixedFile() >= 0) {
+        entry.setFixedFile(static_cast<bsl::uint32_t>(context->fixedFile()));
+    }
+
+    if (NTCCFG_UNLIKELY(!d_device.supportsCancelByHandle())) {
+        context->registerEvent(event.get());
+    }
+
+    NTCO_IORING_LOG_EVENT_STARTING(event);
+
+    error = d_device.submit(entry, submissionMode);
+    if (NTCCFG_UNLIKELY(error)) {
+        if (NTCCFG_UNLIKELY(!d_device.supportsCancelByHandle())) {
+            context->completeEvent(event.get());
+        }
+        return error;
+    }
+
+    event.release();
+
+    return ntsa::Error();
+}
+
+ntsa::Error IoRing::submitReceive(
+    const bsl::shared_ptr<ntci::ProactorSocket>& socket,
+    const bsl::shared_ptr<ntco::IoRingContext>&  context,
+    ntsa::Handle                                 handle,
+    bdlbb::Blob*                                 destination,
+    bsl::size_t                                  maxBytes,
+    ntco::IoRingReceiveMode::Value               mode,
+    ntco::IoRingSubmissionMode::Value            submissionMode)
+{
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    bslma::ManagedPtr<ntcs::Event> event =
+        d_eventPool.getManagedObject(socket, context);
+    if (NTCCFG_UNLIKELY(!event)) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    ntco::IoRingSubmission entry;
+    error = entry.prepareReceive(event.get(),
+                                 socket,
+                                 handle,
+                                 destination,
+                                 d_device.bufferGroup(),
+                                 d_device.bufferSize(),
+                                 maxBytes,
+                                 mode);
+    if (NTCCFG_UNLIKELY(error)) {
+        return error;
+    }
+
+    if (context->fixedFile() >= 0) {
+        entry.setFixedFile(static_cast<bsl::uint32_t>(context->fixedFile()));
+    }
+
+    if (NTCCFG_UNLIKELY(!d_device.supportsCancelByHandle())) {
+        context->registerEvent(event.get());
+    }
+
+    NTCO_IORING_LOG_EVENT_STARTING(event);
+
+    error = d_device.submit(entry, submissionMode);
+    if (NTCCFG_UNLIKELY(error)) {
+        if (NTCCFG_UNLIKELY(!d_device.supportsCancelByHandle())) {
+            context->completeEvent(event.get());
+        }
+        return error;
+    }
+
+    event.release();
+
+    return ntsa::Error();
+}
+
 ntsa::Error IoRing::shutdown(
     const bsl::shared_ptr<ntci::ProactorSocket>& socket,
     ntsa::ShutdownType::Value                    direction)
@@ -5888,7 +8169,15 @@ ntsa::Error IoRing::cancel(const bsl::shared_ptr<ntci::ProactorSocket>& socket)
     }
     else {
         ntco::IoRingSubmission entry;
-        entry.prepareCancellation(handle);
+        if (context->fixedFile() >= 0 &&
+            d_device.supportsCancelByFixedHandle())
+        {
+            entry.prepareFixedCancellation(
+                static_cast<bsl::uint32_t>(context->fixedFile()));
+        }
+        else {
+            entry.prepareCancellation(handle);
+        }
 
         error =
             d_device.submit(entry, ntco::IoRingSubmissionMode::e_IMMEDIATE);
@@ -5928,6 +8217,12 @@ ntsa::Error IoRing::detachSocket(
         }
     }
 
+    const int fixedFile = context->fixedFile();
+    if (fixedFile >= 0) {
+        context->setFixedFile(-1);
+        d_device.deregisterFile(static_cast<bsl::uint32_t>(fixedFile));
+    }
+
     error = context->detach();
     if (error) {
         if (error == ntsa::Error(ntsa::Error::e_WOULD_BLOCK)) {
@@ -6168,6 +8463,12 @@ void IoRing::moveAndExecute(FunctorSequence* functorSequence,
     this->interruptAll();
 }
 
+void IoRing::executeInplace(InplaceFunctor* functor)
+{
+    d_chronology.defer(functor);
+    this->interruptAll();
+}
+
 bsl::shared_ptr<ntci::Timer> IoRing::createTimer(
     const ntca::TimerOptions&                  options,
     const bsl::shared_ptr<ntci::TimerSession>& session,
@@ -6343,6 +8644,11 @@ const bsl::shared_ptr<ntci::DataPool>& IoRing::dataPool() const
     return d_dataPool_sp;
 }
 
+bool IoRing::supportsProvidedBuffers() const
+{
+    return d_device.hasBufferRing();
+}
+
 const bsl::shared_ptr<ntci::Strand>& IoRing::strand() const
 {
     return ntci::Strand::unspecified();
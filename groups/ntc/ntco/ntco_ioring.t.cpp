@@ -245,6 +245,14 @@ class ProactorStreamSocket : public ntci::ProactorSocket,
     // receive buffer or the error callback if the receive fails. Return
     // the error.
 
+    ntsa::Error receive(const bsl::shared_ptr<bdlbb::Blob>& data,
+                        const ntsa::ReceiveOptions&         options);
+    // Recieve into the available capacity of the specified 'data' the
+    // transmission from the peer endpoint according to the specified
+    // 'options'. Invoke the receive callback when at least some of the
+    // data has been copied out of the socket receive buffer or the error
+    // callback if the receive fails. Return the error.
+
     ntsa::Error shutdown(ntsa::ShutdownType::Value direction);
     // Shutdown the stream socket in the specified 'direction'. Return the
     // error.
@@ -789,6 +797,18 @@ ntsa::Error ProactorStreamSocket::receive(
     return d_proactor_sp->receive(self, data.get(), ntsa::ReceiveOptions());
 }
 
+ntsa::Error ProactorStreamSocket::receive(
+    const bsl::shared_ptr<bdlbb::Blob>& data,
+    const ntsa::ReceiveOptions&         options)
+{
+    bsl::shared_ptr<ProactorStreamSocket> self = this->getSelf(this);
+
+    NTCCFG_TEST_FALSE(d_receiveData_sp);
+    d_receiveData_sp = data;
+
+    return d_proactor_sp->receive(self, data.get(), options);
+}
+
 ntsa::Error ProactorStreamSocket::shutdown(ntsa::ShutdownType::Value direction)
 {
     bsl::shared_ptr<ProactorStreamSocket> self = this->getSelf(this);
@@ -2351,12 +2371,568 @@ NTCCFG_TEST_CASE(4)
     NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+NTCCFG_TEST_CASE(5)
+{
+    // Concern: Stream sockets receive data into buffers selected by the
+    // kernel from a provided buffer ring, both when each receive operation
+    // is submitted individually and when a single multishot receive
+    // operation remains armed.
+
+    NTCI_LOG_CONTEXT();
+    NTCI_LOG_CONTEXT_GUARD_OWNER("test");
+
+    if (!ntco::IoRingFactory::isSupported()) {
+        return;
+    }
+
+    for (bsl::size_t variation = 0; variation < 2; ++variation) {
+        ntccfg::TestAllocator ta;
+        {
+            ntsa::Error error;
+
+            const bool multishot = (variation == 1);
+
+            // Create the blob buffer factory.
+
+            bdlbb::PooledBlobBufferFactory blobBufferFactory(32, &ta);
+
+            // Define the user.
+
+            bsl::shared_ptr<ntci::User> user;
+
+            // Create the proactor.
+
+            ntca::ProactorConfig proactorConfig;
+            proactorConfig.setMetricName("test");
+            proactorConfig.setMinThreads(1);
+            proactorConfig.setMaxThreads(1);
+            proactorConfig.setProvidedBufferCount(16);
+            proactorConfig.setMultishotReceive(multishot);
+
+            bsl::shared_ptr<ntco::IoRingFactory> proactorFactory;
+            proactorFactory.createInplace(&ta, &ta);
+
+            bsl::shared_ptr<ntci::Proactor> proactor =
+                proactorFactory->createProactor(proactorConfig, user, &ta);
+
+            NTCCFG_TEST_LOG_DEBUG << "Proactor provided buffers: "
+                                  << proactor->supportsProvidedBuffers()
+                                  << NTCCFG_TEST_LOG_END;
+
+            ntci::Waiter waiter =
+                proactor->registerWaiter(ntca::WaiterOptions());
+
+            // Create a listener, client, and server connected over the
+            // loopback address.
+
+            bsl::shared_ptr<test::case1::ProactorListenerSocket> listener;
+            listener.createInplace(&ta, proactor, &ta);
+
+            listener->abortOnError(true);
+
+            error = listener->listen();
+            NTCCFG_TEST_OK(error);
+
+            error = proactor->attachSocket(listener);
+            NTCCFG_TEST_OK(error);
+
+            bsl::shared_ptr<test::case1::ProactorStreamSocket> client;
+            client.createInplace(&ta, proactor, &ta);
+
+            client->abortOnError(true);
+
+            error = proactor->attachSocket(client);
+            NTCCFG_TEST_OK(error);
+
+            error = listener->accept();
+            NTCCFG_TEST_OK(error);
+
+            error = client->connect(listener->sourceEndpoint());
+            NTCCFG_TEST_OK(error);
+
+            while (!listener->pollForAccepted()) {
+                proactor->poll(waiter);
+            }
+
+            bsl::shared_ptr<test::case1::ProactorStreamSocket> server =
+                listener->accepted();
+
+            server->abortOnError(true);
+
+            error = proactor->attachSocket(server);
+            NTCCFG_TEST_OK(error);
+
+            while (!client->pollForConnected()) {
+                proactor->poll(waiter);
+            }
+
+            // Send data to the server and receive it, twice, so that the
+            // second receive either resubmits an operation or consumes data
+            // from the armed multishot operation.
+
+            const char* k_MESSAGE[2] = {"Hello", "World"};
+
+            for (bsl::size_t i = 0; i < 2; ++i) {
+                {
+                    bsl::shared_ptr<bdlbb::Blob> data;
+                    data.createInplace(&ta, &blobBufferFactory, &ta);
+
+                    bdlbb::BlobUtil::append(data.get(), k_MESSAGE[i], 5);
+
+                    error = client->send(data);
+                    NTCCFG_TEST_OK(error);
+                }
+
+                while (!client->pollForSent()) {
+                    proactor->poll(waiter);
+                }
+
+                bsl::shared_ptr<bdlbb::Blob> data;
+                data.createInplace(&ta, &blobBufferFactory, &ta);
+
+                if (!proactor->supportsProvidedBuffers()) {
+                    data->setLength(5);
+                    data->setLength(0);
+                }
+
+                error = server->receive(data);
+                NTCCFG_TEST_OK(error);
+
+                while (!server->pollForReceived()) {
+                    proactor->poll(waiter);
+                }
+
+                NTCCFG_TEST_EQ(data->length(), 5);
+
+                char content[5];
+                bdlbb::BlobUtil::copy(content, *data, 0, 5);
+
+                NTCCFG_TEST_EQ(bsl::string(content, 5),
+                               bsl::string(k_MESSAGE[i]));
+            }
+
+            // Send data to the server and receive it in portions smaller
+            // than what has been received, so that received buffers are
+            // split between the data handed out and the data retained for
+            // the next receive.
+
+            {
+                bsl::shared_ptr<bdlbb::Blob> data;
+                data.createInplace(&ta, &blobBufferFactory, &ta);
+
+                bdlbb::BlobUtil::append(data.get(), "HelloWorld", 10);
+
+                error = client->send(data);
+                NTCCFG_TEST_OK(error);
+            }
+
+            while (!client->pollForSent()) {
+                proactor->poll(waiter);
+            }
+
+            bsl::string received;
+            while (received.size() < 10) {
+                bsl::shared_ptr<bdlbb::Blob> data;
+                data.createInplace(&ta, &blobBufferFactory, &ta);
+
+                if (!proactor->supportsProvidedBuffers()) {
+                    data->setLength(3);
+                    data->setLength(0);
+                }
+
+                ntsa::ReceiveOptions receiveOptions;
+                receiveOptions.setMaxBytes(3);
+
+                error = server->receive(data, receiveOptions);
+                NTCCFG_TEST_OK(error);
+
+                while (!server->pollForReceived()) {
+                    proactor->poll(waiter);
+                }
+
+                NTCCFG_TEST_GT(data->length(), 0);
+                NTCCFG_TEST_LE(data->length(), 3);
+
+                bsl::vector<char> content(data->length());
+                bdlbb::BlobUtil::copy(&content[0], *data, 0, data->length());
+
+                received.append(content.begin(), content.end());
+            }
+
+            NTCCFG_TEST_EQ(received, bsl::string("HelloWorld"));
+
+            // Detach the sockets from the proactor.
+
+            error = proactor->detachSocket(server);
+            NTCCFG_TEST_OK(error);
+
+            while (!server->pollForDetached()) {
+                proactor->poll(waiter);
+            }
+
+            error = proactor->detachSocket(client);
+            NTCCFG_TEST_OK(error);
+
+            while (!client->pollForDetached()) {
+                proactor->poll(waiter);
+            }
+
+            error = proactor->detachSocket(listener);
+            NTCCFG_TEST_OK(error);
+
+            while (!listener->pollForDetached()) {
+                proactor->poll(waiter);
+            }
+
+            proactor->deregisterWaiter(waiter);
+        }
+        NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+    }
+}
+
+NTCCFG_TEST_CASE(6)
+{
+    // Concern: Listener sockets accept connections through a single
+    // multishot accept operation that remains armed, and sockets operated
+    // on by their index in the fixed file table send and receive data.
+
+    NTCI_LOG_CONTEXT();
+    NTCI_LOG_CONTEXT_GUARD_OWNER("test");
+
+    if (!ntco::IoRingFactory::isSupported()) {
+        return;
+    }
+
+    for (bsl::size_t variation = 0; variation < 2; ++variation) {
+        ntccfg::TestAllocator ta;
+        {
+            ntsa::Error error;
+
+            const bool multishot = (variation == 1);
+
+            // Create the blob buffer factory.
+
+            bdlbb::PooledBlobBufferFactory blobBufferFactory(32, &ta);
+
+            // Define the user.
+
+            bsl::shared_ptr<ntci::User> user;
+
+            // Create the proactor.
+
+            ntca::ProactorConfig proactorConfig;
+            proactorConfig.setMetricName("test");
+            proactorConfig.setMinThreads(1);
+            proactorConfig.setMaxThreads(1);
+            proactorConfig.setMultishotAccept(multishot);
+            proactorConfig.setFixedFileCount(16);
+
+            bsl::shared_ptr<ntco::IoRingFactory> proactorFactory;
+            proactorFactory.createInplace(&ta, &ta);
+
+            bsl::shared_ptr<ntci::Proactor> proactor =
+                proactorFactory->createProactor(proactorConfig, user, &ta);
+
+            ntci::Waiter waiter =
+                proactor->registerWaiter(ntca::WaiterOptions());
+
+            // Create a listener.
+
+            bsl::shared_ptr<test::case1::ProactorListenerSocket> listener;
+            listener.createInplace(&ta, proactor, &ta);
+
+            listener->abortOnError(true);
+
+            error = listener->listen();
+            NTCCFG_TEST_OK(error);
+
+            error = proactor->attachSocket(listener);
+            NTCCFG_TEST_OK(error);
+
+            // Connect two clients to the listener, one after the other, so
+            // that the second accept either resubmits an operation or
+            // consumes a connection from the armed multishot operation.
+
+            const bsl::size_t k_NUM_CONNECTIONS = 2;
+
+            bsl::vector<bsl::shared_ptr<test::case1::ProactorStreamSocket> >
+                clients(&ta);
+            bsl::vector<bsl::shared_ptr<test::case1::ProactorStreamSocket> >
+                servers(&ta);
+
+            for (bsl::size_t i = 0; i < k_NUM_CONNECTIONS; ++i) {
+                bsl::shared_ptr<test::case1::ProactorStreamSocket> client;
+                client.createInplace(&ta, proactor, &ta);
+
+                client->abortOnError(true);
+
+                error = proactor->attachSocket(client);
+                NTCCFG_TEST_OK(error);
+
+                error = listener->accept();
+                NTCCFG_TEST_OK(error);
+
+                error = client->connect(listener->sourceEndpoint());
+                NTCCFG_TEST_OK(error);
+
+                while (!listener->pollForAccepted()) {
+                    proactor->poll(waiter);
+                }
+
+                bsl::shared_ptr<test::case1::ProactorStreamSocket> server =
+                    listener->accepted();
+
+                server->abortOnError(true);
+
+                error = proactor->attachSocket(server);
+                NTCCFG_TEST_OK(error);
+
+                while (!client->pollForConnected()) {
+                    proactor->poll(waiter);
+                }
+
+                // Send data from the client to the server.
+
+                {
+                    bsl::shared_ptr<bdlbb::Blob> data;
+                    data.createInplace(&ta, &blobBufferFactory, &ta);
+
+                    bdlbb::BlobUtil::append(data.get(), "Hello", 5);
+
+                    error = client->send(data);
+                    NTCCFG_TEST_OK(error);
+                }
+
+                while (!client->pollForSent()) {
+                    proactor->poll(waiter);
+                }
+
+                bsl::shared_ptr<bdlbb::Blob> data;
+                data.createInplace(&ta, &blobBufferFactory, &ta);
+
+                data->setLength(5);
+                data->setLength(0);
+
+                error = server->receive(data);
+                NTCCFG_TEST_OK(error);
+
+                while (!server->pollForReceived()) {
+                    proactor->poll(waiter);
+                }
+
+                NTCCFG_TEST_EQ(data->length(), 5);
+
+                char content[5];
+                bdlbb::BlobUtil::copy(content, *data, 0, 5);
+
+                NTCCFG_TEST_EQ(bsl::string(content, 5), bsl::string("Hello"));
+
+                clients.push_back(client);
+                servers.push_back(server);
+            }
+
+            // Detach the sockets from the proactor.
+
+            for (bsl::size_t i = 0; i < k_NUM_CONNECTIONS; ++i) {
+                error = proactor->detachSocket(servers[i]);
+                NTCCFG_TEST_OK(error);
+
+                while (!servers[i]->pollForDetached()) {
+                    proactor->poll(waiter);
+                }
+
+                error = proactor->detachSocket(clients[i]);
+                NTCCFG_TEST_OK(error);
+
+                while (!clients[i]->pollForDetached()) {
+                    proactor->poll(waiter);
+                }
+            }
+
+            error = proactor->detachSocket(listener);
+            NTCCFG_TEST_OK(error);
+
+            while (!listener->pollForDetached()) {
+                proactor->poll(waiter);
+            }
+
+            proactor->deregisterWaiter(waiter);
+        }
+        NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+    }
+}
+
+NTCCFG_TEST_CASE(7)
+{
+    // Concern: Operations are initiated and complete when the submission
+    // queue is polled by a kernel thread, and when it is not.
+
+    NTCI_LOG_CONTEXT();
+    NTCI_LOG_CONTEXT_GUARD_OWNER("test");
+
+    if (!ntco::IoRingFactory::isSupported()) {
+        return;
+    }
+
+    for (bsl::size_t variation = 0; variation < 2; ++variation) {
+        ntccfg::TestAllocator ta;
+        {
+            ntsa::Error error;
+
+            const bool polling = (variation == 1);
+
+            // Create the blob buffer factory.
+
+            bdlbb::PooledBlobBufferFactory blobBufferFactory(32, &ta);
+
+            // Define the user.
+
+            bsl::shared_ptr<ntci::User> user;
+
+            // Create the proactor.
+
+            ntca::ProactorConfig proactorConfig;
+            proactorConfig.setMetricName("test");
+            proactorConfig.setMinThreads(1);
+            proactorConfig.setMaxThreads(1);
+            proactorConfig.setSubmissionPolling(polling);
+            proactorConfig.setSubmissionPollingIdleTime(
+                bsls::TimeInterval(0.01));
+
+            bsl::shared_ptr<ntco::IoRingFactory> proactorFactory;
+            proactorFactory.createInplace(&ta, &ta);
+
+            bsl::shared_ptr<ntci::Proactor> proactor =
+                proactorFactory->createProactor(proactorConfig, user, &ta);
+
+            ntci::Waiter waiter =
+                proactor->registerWaiter(ntca::WaiterOptions());
+
+            // Create a listener, client, and server connected over the
+            // loopback address.
+
+            bsl::shared_ptr<test::case1::ProactorListenerSocket> listener;
+            listener.createInplace(&ta, proactor, &ta);
+
+            listener->abortOnError(true);
+
+            error = listener->listen();
+            NTCCFG_TEST_OK(error);
+
+            error = proactor->attachSocket(listener);
+            NTCCFG_TEST_OK(error);
+
+            bsl::shared_ptr<test::case1::ProactorStreamSocket> client;
+            client.createInplace(&ta, proactor, &ta);
+
+            client->abortOnError(true);
+
+            error = proactor->attachSocket(client);
+            NTCCFG_TEST_OK(error);
+
+            error = listener->accept();
+            NTCCFG_TEST_OK(error);
+
+            error = client->connect(listener->sourceEndpoint());
+            NTCCFG_TEST_OK(error);
+
+            while (!listener->pollForAccepted()) {
+                proactor->poll(waiter);
+            }
+
+            bsl::shared_ptr<test::case1::ProactorStreamSocket> server =
+                listener->accepted();
+
+            server->abortOnError(true);
+
+            error = proactor->attachSocket(server);
+            NTCCFG_TEST_OK(error);
+
+            while (!client->pollForConnected()) {
+                proactor->poll(waiter);
+            }
+
+            // Send data to the server and receive it, twice.
+
+            const char* k_MESSAGE[2] = {"Hello", "World"};
+
+            for (bsl::size_t i = 0; i < 2; ++i) {
+                {
+                    bsl::shared_ptr<bdlbb::Blob> data;
+                    data.createInplace(&ta, &blobBufferFactory, &ta);
+
+                    bdlbb::BlobUtil::append(data.get(), k_MESSAGE[i], 5);
+
+                    error = client->send(data);
+                    NTCCFG_TEST_OK(error);
+                }
+
+                while (!client->pollForSent()) {
+                    proactor->poll(waiter);
+                }
+
+                bsl::shared_ptr<bdlbb::Blob> data;
+                data.createInplace(&ta, &blobBufferFactory, &ta);
+
+                if (!proactor->supportsProvidedBuffers()) {
+                    data->setLength(5);
+                    data->setLength(0);
+                }
+
+                error = server->receive(data);
+                NTCCFG_TEST_OK(error);
+
+                while (!server->pollForReceived()) {
+                    proactor->poll(waiter);
+                }
+
+                NTCCFG_TEST_EQ(data->length(), 5);
+
+                char content[5];
+                bdlbb::BlobUtil::copy(content, *data, 0, 5);
+
+                NTCCFG_TEST_EQ(bsl::string(content, 5),
+                               bsl::string(k_MESSAGE[i]));
+            }
+
+            // Detach the sockets from the proactor.
+
+            error = proactor->detachSocket(server);
+            NTCCFG_TEST_OK(error);
+
+            while (!server->pollForDetached()) {
+                proactor->poll(waiter);
+            }
+
+            error = proactor->detachSocket(client);
+            NTCCFG_TEST_OK(error);
+
+            while (!client->pollForDetached()) {
+                proactor->poll(waiter);
+            }
+
+            error = proactor->detachSocket(listener);
+            NTCCFG_TEST_OK(error);
+
+            while (!listener->pollForDetached()) {
+                proactor->poll(waiter);
+            }
+
+            proactor->deregisterWaiter(waiter);
+        }
+        NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+    }
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
     NTCCFG_TEST_REGISTER(2);
     NTCCFG_TEST_REGISTER(3);
     NTCCFG_TEST_REGISTER(4);
+    NTCCFG_TEST_REGISTER(5);
+    NTCCFG_TEST_REGISTER(6);
+    NTCCFG_TEST_REGISTER(7);
 }
 NTCCFG_TEST_DRIVER_END;
 
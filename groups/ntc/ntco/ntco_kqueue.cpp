@@ -493,6 +493,10 @@ class Kqueue : public ntci::Reactor,
     // immediately followed by the specified 'functor', then clear the
     // 'functorSequence'.
 
+    void executeInplace(InplaceFunctor* functor) BSLS_KEYWORD_OVERRIDE;
+    // Defer the execution of the callable object stored by the specified
+    // 'functor', leaving the 'functor' empty.
+
     bsl::shared_ptr<ntci::Timer> createTimer(
         const ntca::TimerOptions&                  options,
         const bsl::shared_ptr<ntci::TimerSession>& session,
@@ -665,6 +669,7 @@ struct Kqueue::Result {
   public:
     ntca::WaiterOptions                   d_options;
     bsl::shared_ptr<ntci::ReactorMetrics> d_metrics_sp;
+    ntcs::Chronology*                     d_shard_p;
 
   private:
     Result(const Result&) BSLS_KEYWORD_DELETED;
@@ -683,6 +688,7 @@ struct Kqueue::Result {
 Kqueue::Result::Result(bslma::Allocator* basicAllocator)
 : d_options(basicAllocator)
 , d_metrics_sp()
+, d_shard_p(0)
 {
 }
 
@@ -1149,6 +1155,42 @@ Kqueue::Kqueue(const ntca::ReactorConfig&         configuration,
         d_config.setMetricCollectionPerSocket(false);
     }
 
+    if (d_config.timerWheel().isNull()) {
+        d_config.setTimerWheel(NTCCFG_DEFAULT_TIMER_WHEEL);
+    }
+
+    if (d_config.timerWheelResolution().isNull()) {
+        bsls::TimeInterval timerWheelResolution;
+        timerWheelResolution.setTotalMicroseconds(
+            NTCCFG_DEFAULT_TIMER_WHEEL_RESOLUTION);
+
+        d_config.setTimerWheelResolution(timerWheelResolution);
+    }
+
+    if (d_config.timerWheel().value()) {
+        ntsa::Error error = d_chronology.configureTimerWheel(
+            d_config.timerWheelResolution().value());
+        if (error) {
+            d_config.setTimerWheel(false);
+        }
+    }
+
+    if (d_config.chronologySharding().isNull()) {
+        d_config.setChronologySharding(NTCCFG_DEFAULT_CHRONOLOGY_SHARDING);
+    }
+
+    if (d_config.chronologySharding().value()) {
+        ntsa::Error error = ntsa::Error(ntsa::Error::e_INVALID);
+        if (d_config.maxThreads().value() > 1) {
+            error = d_chronology.configureShards(
+                d_config.maxThreads().value());
+        }
+
+        if (error) {
+            d_config.setChronologySharding(false);
+        }
+    }
+
     if (d_config.autoAttach().isNull()) {
         d_config.setAutoAttach(false);
     }
@@ -1302,6 +1344,8 @@ ntci::Waiter Kqueue::registerWaiter(const ntca::WaiterOptions& waiterOptions)
             bslmt::ThreadUtil::handleToId(principleThreadHandle.value())));
     }
 
+    result->d_shard_p = d_chronology.acquireShard();
+
     return result;
 }
 
@@ -1309,6 +1353,11 @@ void Kqueue::deregisterWaiter(ntci::Waiter waiter)
 {
     Kqueue::Result* result = static_cast<Kqueue::Result*>(waiter);
 
+    if (result->d_shard_p != 0) {
+        d_chronology.releaseShard(result->d_shard_p);
+        result->d_shard_p = 0;
+    }
+
     bool nowEmpty = false;
 
     {
@@ -1956,6 +2005,8 @@ void Kqueue::run(ntci::Waiter waiter)
 
     NTCCFG_WARNING_UNUSED(result);
 
+    ntcs::ChronologyGuard chronologyGuard(result->d_shard_p);
+
     NTCS_METRICS_GET();
 
     while (d_run) {
@@ -2153,6 +2204,8 @@ void Kqueue::poll(ntci::Waiter waiter)
 
     NTCCFG_WARNING_UNUSED(result);
 
+    ntcs::ChronologyGuard chronologyGuard(result->d_shard_p);
+
     NTCS_METRICS_GET();
 
     enum { MAX_EVENTS = 128 };
@@ -2440,15 +2493,18 @@ void Kqueue::clear()
 
 void Kqueue::execute(const Functor& functor)
 {
-    d_chronology.defer(functor);
-    Kqueue::interruptAll();
+    d_chronology.execute(functor);
 }
 
 void Kqueue::moveAndExecute(FunctorSequence* functorSequence,
                             const Functor&   functor)
 {
-    d_chronology.defer(functorSequence, functor);
-    Kqueue::interruptAll();
+    d_chronology.moveAndExecute(functorSequence, functor);
+}
+
+void Kqueue::executeInplace(InplaceFunctor* functor)
+{
+    d_chronology.executeInplace(functor);
 }
 
 bsl::shared_ptr<ntci::Timer> Kqueue::createTimer(
@@ -504,6 +504,10 @@ class Poll : public ntci::Reactor,
     void moveAndExecute(FunctorSequence* functorSequence,
                         const Functor&   functor) BSLS_KEYWORD_OVERRIDE;
 
+    /// Defer the execution of the callable object stored by the specified
+    /// 'functor', leaving the 'functor' empty.
+    void executeInplace(InplaceFunctor* functor) BSLS_KEYWORD_OVERRIDE;
+
     /// Create a new timer according to the specified 'options' that invokes
     /// the specified 'session' for each timer event on this object's
     /// 'strand()', if defined, or on an unspecified thread otherwise.
@@ -687,6 +691,7 @@ struct Poll::Result {
     ntcs::RegistryEntryCatalog::ForEachCallback d_forEachCallback;
     bool                                        d_controllerHandleFound;
     bsl::size_t                                 d_controllerHandleIdx;
+    ntcs::Chronology*                           d_shard_p;
 
   private:
     Result(const Result&) BSLS_KEYWORD_DELETED;
@@ -710,6 +715,7 @@ Poll::Result::Result(bslma::Allocator* basicAllocator)
 , d_forEachCallback(NTCCFG_FUNCTION_INIT(basicAllocator))
 , d_controllerHandleFound(0)
 , d_controllerHandleIdx(0)
+, d_shard_p(0)
 {
 }
 
@@ -1050,6 +1056,42 @@ Poll::Poll(const ntca::ReactorConfig&         configuration,
         d_config.setMetricCollectionPerSocket(false);
     }
 
+    if (d_config.timerWheel().isNull()) {
+        d_config.setTimerWheel(NTCCFG_DEFAULT_TIMER_WHEEL);
+    }
+
+    if (d_config.timerWheelResolution().isNull()) {
+        bsls::TimeInterval timerWheelResolution;
+        timerWheelResolution.setTotalMicroseconds(
+            NTCCFG_DEFAULT_TIMER_WHEEL_RESOLUTION);
+
+        d_config.setTimerWheelResolution(timerWheelResolution);
+    }
+
+    if (d_config.timerWheel().value()) {
+        ntsa::Error error = d_chronology.configureTimerWheel(
+            d_config.timerWheelResolution().value());
+        if (error) {
+            d_config.setTimerWheel(false);
+        }
+    }
+
+    if (d_config.chronologySharding().isNull()) {
+        d_config.setChronologySharding(NTCCFG_DEFAULT_CHRONOLOGY_SHARDING);
+    }
+
+    if (d_config.chronologySharding().value()) {
+        ntsa::Error error = ntsa::Error(ntsa::Error::e_INVALID);
+        if (d_config.maxThreads().value() > 1) {
+            error = d_chronology.configureShards(
+                d_config.maxThreads().value());
+        }
+
+        if (error) {
+            d_config.setChronologySharding(false);
+        }
+    }
+
     if (d_config.autoAttach().isNull()) {
         d_config.setAutoAttach(false);
     }
@@ -1194,6 +1236,8 @@ ntci::Waiter Poll::registerWaiter(const ntca::WaiterOptions& waiterOptions)
             bslmt::ThreadUtil::handleToId(principleThreadHandle.value())));
     }
 
+    result->d_shard_p = d_chronology.acquireShard();
+
     return result;
 }
 
@@ -1201,6 +1245,11 @@ void Poll::deregisterWaiter(ntci::Waiter waiter)
 {
     Poll::Result* result = static_cast<Poll::Result*>(waiter);
 
+    if (result->d_shard_p != 0) {
+        d_chronology.releaseShard(result->d_shard_p);
+        result->d_shard_p = 0;
+    }
+
     bool nowEmpty = false;
 
     {
@@ -1987,6 +2036,8 @@ void Poll::run(ntci::Waiter waiter)
 
     NTCCFG_WARNING_UNUSED(result);
 
+    ntcs::ChronologyGuard chronologyGuard(result->d_shard_p);
+
     NTCS_METRICS_GET();
 
     while (d_run) {
@@ -2380,6 +2431,8 @@ void Poll::poll(ntci::Waiter waiter)
 
     NTCCFG_WARNING_UNUSED(result);
 
+    ntcs::ChronologyGuard chronologyGuard(result->d_shard_p);
+
     NTCS_METRICS_GET();
 
     if (d_config.maxThreads().value() > 1) {
@@ -2849,15 +2902,18 @@ void Poll::clear()
 
 void Poll::execute(const Functor& functor)
 {
-    d_chronology.defer(functor);
-    Poll::interruptAll();
+    d_chronology.execute(functor);
 }
 
 void Poll::moveAndExecute(FunctorSequence* functorSequence,
                           const Functor&   functor)
 {
-    d_chronology.defer(functorSequence, functor);
-    Poll::interruptAll();
+    d_chronology.moveAndExecute(functorSequence, functor);
+}
+
+void Poll::executeInplace(InplaceFunctor* functor)
+{
+    d_chronology.executeInplace(functor);
 }
 
 bsl::shared_ptr<ntci::Timer> Poll::createTimer(
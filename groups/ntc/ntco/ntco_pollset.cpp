@@ -505,6 +505,10 @@ class Pollset : public ntci::Reactor,
     // immediately followed by the specified 'functor', then clear the
     // 'functorSequence'.
 
+    void executeInplace(InplaceFunctor* functor) BSLS_KEYWORD_OVERRIDE;
+    // Defer the execution of the callable object stored by the specified
+    // 'functor', leaving the 'functor' empty.
+
     bsl::shared_ptr<ntci::Timer> createTimer(
         const ntca::TimerOptions&                  options,
         const bsl::shared_ptr<ntci::TimerSession>& session,
@@ -677,6 +681,7 @@ struct Pollset::Result {
   public:
     ntca::WaiterOptions                   d_options;
     bsl::shared_ptr<ntci::ReactorMetrics> d_metrics_sp;
+    ntcs::Chronology*                     d_shard_p;
 
   private:
     Result(const Result&) BSLS_KEYWORD_DELETED;
@@ -695,6 +700,7 @@ struct Pollset::Result {
 Pollset::Result::Result(bslma::Allocator* basicAllocator)
 : d_options(basicAllocator)
 , d_metrics_sp()
+, d_shard_p(0)
 {
 }
 
@@ -1108,6 +1114,42 @@ Pollset::Pollset(const ntca::ReactorConfig&         configuration,
         d_config.setMetricCollectionPerSocket(false);
     }
 
+    if (d_config.timerWheel().isNull()) {
+        d_config.setTimerWheel(NTCCFG_DEFAULT_TIMER_WHEEL);
+    }
+
+    if (d_config.timerWheelResolution().isNull()) {
+        bsls::TimeInterval timerWheelResolution;
+        timerWheelResolution.setTotalMicroseconds(
+            NTCCFG_DEFAULT_TIMER_WHEEL_RESOLUTION);
+
+        d_config.setTimerWheelResolution(timerWheelResolution);
+    }
+
+    if (d_config.timerWheel().value()) {
+        ntsa::Error error = d_chronology.configureTimerWheel(
+            d_config.timerWheelResolution().value());
+        if (error) {
+            d_config.setTimerWheel(false);
+        }
+    }
+
+    if (d_config.chronologySharding().isNull()) {
+        d_config.setChronologySharding(NTCCFG_DEFAULT_CHRONOLOGY_SHARDING);
+    }
+
+    if (d_config.chronologySharding().value()) {
+        ntsa::Error error = ntsa::Error(ntsa::Error::e_INVALID);
+        if (d_config.maxThreads().value() > 1) {
+            error = d_chronology.configureShards(
+                d_config.maxThreads().value());
+        }
+
+        if (error) {
+            d_config.setChronologySharding(false);
+        }
+    }
+
     if (d_config.autoAttach().isNull()) {
         d_config.setAutoAttach(false);
     }
@@ -1267,6 +1309,8 @@ ntci::Waiter Pollset::registerWaiter(const ntca::WaiterOptions& waiterOptions)
             bslmt::ThreadUtil::handleToId(principleThreadHandle.value())));
     }
 
+    result->d_shard_p = d_chronology.acquireShard();
+
     return result;
 }
 
@@ -1274,6 +1318,11 @@ void Pollset::deregisterWaiter(ntci::Waiter waiter)
 {
     Pollset::Result* result = static_cast<Pollset::Result*>(waiter);
 
+    if (result->d_shard_p != 0) {
+        d_chronology.releaseShard(result->d_shard_p);
+        result->d_shard_p = 0;
+    }
+
     bool nowEmpty = false;
 
     {
@@ -1922,6 +1971,8 @@ void Pollset::run(ntci::Waiter waiter)
 
     NTCCFG_WARNING_UNUSED(result);
 
+    ntcs::ChronologyGuard chronologyGuard(result->d_shard_p);
+
     NTCS_METRICS_GET();
 
     while (d_run) {
@@ -2255,6 +2306,8 @@ void Pollset::poll(ntci::Waiter waiter)
 
     NTCCFG_WARNING_UNUSED(result);
 
+    ntcs::ChronologyGuard chronologyGuard(result->d_shard_p);
+
     NTCS_METRICS_GET();
 
     if (d_config.maxThreads().value() > 1) {
@@ -2674,15 +2727,18 @@ void Pollset::clear()
 
 void Pollset::execute(const Functor& functor)
 {
-    d_chronology.defer(functor);
-    Pollset::interruptAll();
+    d_chronology.execute(functor);
 }
 
 void Pollset::moveAndExecute(FunctorSequence* functorSequence,
                              const Functor&   functor)
 {
-    d_chronology.defer(functorSequence, functor);
-    Pollset::interruptAll();
+    d_chronology.moveAndExecute(functorSequence, functor);
+}
+
+void Pollset::executeInplace(InplaceFunctor* functor)
+{
+    d_chronology.executeInplace(functor);
 }
 
 bsl::shared_ptr<ntci::Timer> Pollset::createTimer(
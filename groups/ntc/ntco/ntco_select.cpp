@@ -490,6 +490,10 @@ class Select : public ntci::Reactor,
     void moveAndExecute(FunctorSequence* functorSequence,
                         const Functor&   functor) BSLS_KEYWORD_OVERRIDE;
 
+    /// Defer the execution of the callable object stored by the specified
+    /// 'functor', leaving the 'functor' empty.
+    void executeInplace(InplaceFunctor* functor) BSLS_KEYWORD_OVERRIDE;
+
     /// Create a new timer according to the specified 'options' that invokes
     /// the specified 'session' for each timer event on this object's
     /// 'strand()', if defined, or on an unspecified thread otherwise.
@@ -664,6 +668,7 @@ struct Select::Result {
     fd_set                                d_readable;
     fd_set                                d_writable;
     fd_set                                d_exceptional;
+    ntcs::Chronology*                     d_shard_p;
 
   private:
     Result(const Result&) BSLS_KEYWORD_DELETED;
@@ -682,6 +687,7 @@ struct Select::Result {
 Select::Result::Result(bslma::Allocator* basicAllocator)
 : d_options(basicAllocator)
 , d_metrics_sp()
+, d_shard_p(0)
 {
 }
 
@@ -1083,6 +1089,42 @@ Select::Select(const ntca::ReactorConfig&         configuration,
         d_config.setMetricCollectionPerSocket(false);
     }
 
+    if (d_config.timerWheel().isNull()) {
+        d_config.setTimerWheel(NTCCFG_DEFAULT_TIMER_WHEEL);
+    }
+
+    if (d_config.timerWheelResolution().isNull()) {
+        bsls::TimeInterval timerWheelResolution;
+        timerWheelResolution.setTotalMicroseconds(
+            NTCCFG_DEFAULT_TIMER_WHEEL_RESOLUTION);
+
+        d_config.setTimerWheelResolution(timerWheelResolution);
+    }
+
+    if (d_config.timerWheel().value()) {
+        ntsa::Error error = d_chronology.configureTimerWheel(
+            d_config.timerWheelResolution().value());
+        if (error) {
+            d_config.setTimerWheel(false);
+        }
+    }
+
+    if (d_config.chronologySharding().isNull()) {
+        d_config.setChronologySharding(NTCCFG_DEFAULT_CHRONOLOGY_SHARDING);
+    }
+
+    if (d_config.chronologySharding().value()) {
+        ntsa::Error error = ntsa::Error(ntsa::Error::e_INVALID);
+        if (d_config.maxThreads().value() > 1) {
+            error = d_chronology.configureShards(
+                d_config.maxThreads().value());
+        }
+
+        if (error) {
+            d_config.setChronologySharding(false);
+        }
+    }
+
     if (d_config.autoAttach().isNull()) {
         d_config.setAutoAttach(false);
     }
@@ -1233,6 +1275,8 @@ ntci::Waiter Select::registerWaiter(const ntca::WaiterOptions& waiterOptions)
             bslmt::ThreadUtil::handleToId(principleThreadHandle.value())));
     }
 
+    result->d_shard_p = d_chronology.acquireShard();
+
     return result;
 }
 
@@ -1240,6 +1284,11 @@ void Select::deregisterWaiter(ntci::Waiter waiter)
 {
     Select::Result* result = static_cast<Select::Result*>(waiter);
 
+    if (result->d_shard_p != 0) {
+        d_chronology.releaseShard(result->d_shard_p);
+        result->d_shard_p = 0;
+    }
+
     bool nowEmpty = false;
 
     {
@@ -1889,6 +1938,8 @@ void Select::run(ntci::Waiter waiter)
 
     NTCCFG_WARNING_UNUSED(result);
 
+    ntcs::ChronologyGuard chronologyGuard(result->d_shard_p);
+
     NTCS_METRICS_GET();
 
     while (d_run) {
@@ -2331,6 +2382,8 @@ void Select::poll(ntci::Waiter waiter)
 
     NTCCFG_WARNING_UNUSED(result);
 
+    ntcs::ChronologyGuard chronologyGuard(result->d_shard_p);
+
     NTCS_METRICS_GET();
 
     if (d_config.maxThreads().value() > 1) {
@@ -2853,15 +2906,18 @@ void Select::clear()
 
 void Select::execute(const Functor& functor)
 {
-    d_chronology.defer(functor);
-    Select::interruptAll();
+    d_chronology.execute(functor);
 }
 
 void Select::moveAndExecute(FunctorSequence* functorSequence,
                             const Functor&   functor)
 {
-    d_chronology.defer(functorSequence, functor);
-    Select::interruptAll();
+    d_chronology.moveAndExecute(functorSequence, functor);
+}
+
+void Select::executeInplace(InplaceFunctor* functor)
+{
+    d_chronology.executeInplace(functor);
 }
 
 bsl::shared_ptr<ntci::Timer> Select::createTimer(
@@ -94,6 +94,10 @@ void* Interface::run(void* context)
     NTCI_LOG_CONTEXT_GUARD_OWNER(interface->d_config.metricName().c_str());
     NTCI_LOG_CONTEXT_GUARD_THREAD(runner->d_threadIndex);
 
+    if (interface->d_socketMetrics_sp) {
+        interface->d_socketMetrics_sp->attachThread(runner->d_threadIndex);
+    }
+
     bsl::string metricName;
     {
         bsl::stringstream ss;
@@ -480,10 +484,18 @@ Interface::Interface(
     d_user_sp->setDataPool(d_dataPool_sp);
 
     if (d_config.socketMetrics().valueOr(NTCCFG_DEFAULT_SOCKET_METRICS)) {
+        bsl::size_t numThreads = 0;
+        if (d_config.socketMetricsPerThread().valueOr(
+                NTCCFG_DEFAULT_SOCKET_METRICS_PER_THREAD))
+        {
+            numThreads = d_config.maxThreads();
+        }
+
         bsl::shared_ptr<ntcs::Metrics> metrics;
         metrics.createInplace(d_allocator_p,
                               "transport",
                               d_config.metricName(),
+                              numThreads,
                               d_allocator_p);
 
         d_socketMetrics_sp = metrics;
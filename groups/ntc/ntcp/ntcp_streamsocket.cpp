@@ -1135,12 +1135,18 @@ void StreamSocket::privateInitiateReceive(
         }
     }
 
-    ntcs::BlobBufferUtil::reserveCapacity(d_receiveBlob_sp.get(),
-                                          d_incomingBufferFactory_sp.get(),
-                                          d_metrics_sp.get(),
-                                          d_receiveQueue.lowWatermark(),
-                                          d_receiveFeedback.current(),
-                                          d_receiveFeedback.maximum());
+    // When the proactor provides the buffers into which incoming data is
+    // copied, do not reserve capacity for the receive: the proactor appends
+    // the buffer it selects only once data actually arrives.
+
+    if (NTCCFG_LIKELY(!proactorRef->supportsProvidedBuffers())) {
+        ntcs::BlobBufferUtil::reserveCapacity(d_receiveBlob_sp.get(),
+                                              d_incomingBufferFactory_sp.get(),
+                                              d_metrics_sp.get(),
+                                              d_receiveQueue.lowWatermark(),
+                                              d_receiveFeedback.current(),
+                                              d_receiveFeedback.maximum());
+    }
 
     error =
         proactorRef->receive(self, d_receiveBlob_sp.get(), d_receiveOptions);
@@ -3265,6 +3271,11 @@ ntsa::Error StreamSocket::privateUpgrade(
         bdlf::MemFnUtil::memFn(&StreamSocket::privateEncryptionHandshake,
                                this);
 
+    // Identify the peer so that a session previously established with it
+    // may be resumed.
+
+    d_encryption_sp->setRemoteEndpoint(d_remoteEndpoint);
+
     error =
         d_encryption_sp->initiateHandshake(upgradeOptions, handshakeCallback);
     if (error) {
@@ -4129,6 +4140,14 @@ ntsa::Error StreamSocket::upgrade(
         return ntsa::Error(ntsa::Error::e_INVALID);
     }
 
+    // Offloading encryption to the operating system is not supported for
+    // sockets driven by a proactor, since the proactor does not deliver the
+    // type of each record decrypted by the operating system.
+
+    if (options.offload()) {
+        return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+    }
+
     // Set the encryption session used to encrypt and decrypt data.
 
     d_encryption_sp = encryption;
@@ -4718,6 +4737,123 @@ ntsa::Error StreamSocket::receive(ntca::ReceiveContext*       context,
     return error;
 }
 
+ntsa::Error StreamSocket::receive(ntca::ReceiveContext*       context,
+                                  bsl::size_t*                numBytesReceived,
+                                  const ntsa::MutableBuffer&  buffer,
+                                  const ntca::ReceiveOptions& options)
+{
+    bsl::shared_ptr<StreamSocket> self = this->getSelf(this);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_CONTEXT_GUARD_DESCRIPTOR(d_publicHandle);
+    NTCI_LOG_CONTEXT_GUARD_SOURCE_ENDPOINT(d_sourceEndpoint);
+    NTCI_LOG_CONTEXT_GUARD_REMOTE_ENDPOINT(d_remoteEndpoint);
+
+    *numBytesReceived = 0;
+
+    if (NTCCFG_UNLIKELY(!d_openState.canReceive())) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    const bsl::size_t maxSize = bsl::min(options.maxSize(), buffer.size());
+
+    if (NTCCFG_UNLIKELY(options.minSize() > maxSize)) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    if (NTCCFG_UNLIKELY(d_receiveQueue.size() == 0 &&
+                        !d_shutdownState.canReceive()))
+    {
+        return ntsa::Error(ntsa::Error::e_EOF);
+    }
+
+    if (NTCCFG_LIKELY(d_receiveQueue.size() >= options.minSize())) {
+        bool receiveQueueHighWatermarkViolatedBefore =
+            d_receiveQueue.isHighWatermarkViolated();
+
+        bsl::size_t numBytesRemaining = maxSize;
+        bsl::size_t numBytesDequeued  = 0;
+
+        while (NTCCFG_LIKELY(d_receiveQueue.hasEntry())) {
+            if (numBytesRemaining == 0) {
+                break;
+            }
+
+            ntcq::ReceiveQueueEntry& entry = d_receiveQueue.frontEntry();
+
+            bsl::size_t numBytesToDequeue =
+                bsl::min(numBytesRemaining, entry.length());
+
+            numBytesDequeued += numBytesToDequeue;
+            BSLS_ASSERT(numBytesDequeued <= maxSize);
+
+            BSLS_ASSERT(numBytesRemaining >= numBytesToDequeue);
+            numBytesRemaining -= numBytesToDequeue;
+
+            if (numBytesToDequeue == entry.length()) {
+                NTCS_METRICS_UPDATE_READ_QUEUE_DELAY(entry.delay());
+
+                if (d_receiveQueue.popEntry()) {
+                    break;
+                }
+            }
+            else {
+                d_receiveQueue.popSize(numBytesToDequeue);
+                break;
+            }
+        }
+
+        BSLS_ASSERT(numBytesDequeued >= options.minSize());
+        BSLS_ASSERT(numBytesDequeued <= maxSize);
+
+        context->setTransport(d_transport);
+        context->setEndpoint(d_remoteEndpoint);
+
+        if (numBytesDequeued > 0) {
+            bdlbb::BlobUtil::copy(static_cast<char*>(buffer.data()),
+                                  *d_receiveQueue.data(),
+                                  0,
+                                  static_cast<int>(numBytesDequeued));
+
+            ntcs::BlobUtil::pop(d_receiveQueue.data(), numBytesDequeued);
+        }
+
+        *numBytesReceived = numBytesDequeued;
+
+        BSLS_ASSERT(d_receiveQueue.size() ==
+                    NTCCFG_WARNING_PROMOTE(bsl::size_t,
+                                           d_receiveQueue.data()->length()));
+
+        NTCP_STREAMSOCKET_LOG_READ_QUEUE_DRAINED(d_receiveQueue.size());
+
+        NTCS_METRICS_UPDATE_READ_QUEUE_SIZE(d_receiveQueue.size());
+
+        bool receiveQueueHighWatermarkViolatedAfter =
+            d_receiveQueue.isHighWatermarkViolated();
+
+        if (receiveQueueHighWatermarkViolatedBefore &&
+            !receiveQueueHighWatermarkViolatedAfter)
+        {
+            this->privateRelaxFlowControl(self,
+                                          ntca::FlowControlType::e_RECEIVE,
+                                          true,
+                                          false);
+        }
+
+        return ntsa::Error();
+    }
+
+    this->privateRelaxFlowControl(self,
+                                  ntca::FlowControlType::e_RECEIVE,
+                                  true,
+                                  false);
+
+    return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+}
+
 ntsa::Error StreamSocket::receive(const ntca::ReceiveOptions&  options,
                                   const ntci::ReceiveFunction& callback)
 {
@@ -5755,6 +5891,22 @@ void StreamSocket::moveAndExecute(FunctorSequence* functorSequence,
     }
 }
 
+void StreamSocket::executeInplace(InplaceFunctor* functor)
+{
+    if (d_proactorStrand_sp) {
+        d_proactorStrand_sp->executeInplace(functor);
+    }
+    else {
+        ntcs::ObserverRef<ntci::Proactor> proactorRef(&d_proactor);
+        if (proactorRef) {
+            proactorRef->executeInplace(functor);
+        }
+        else {
+            ntci::Executor::executeInplace(functor);
+        }
+    }
+}
+
 // MANIPULATROS (ntci::StrandFactory)
 bsl::shared_ptr<ntci::Strand> StreamSocket::createStrand(
     bslma::Allocator* basicAllocator)
@@ -965,6 +965,27 @@ class StreamSocket : public ntci::StreamSocket,
                         const ntca::ReceiveOptions& options)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Dequeue received data according to the specified 'options' into the
+    /// caller-owned storage described by the specified 'buffer', and load
+    /// into the specified 'numBytesReceived' the number of bytes copied to
+    /// the 'buffer'. If the read queue has sufficient size to satisfy the
+    /// read operation, synchronously copy the read queue into the 'buffer'.
+    /// Otherwise, asynchronously copy the socket receive buffer onto the
+    /// read queue as data in the socket receive buffer becomes available.
+    /// Return the error, notably 'ntsa::Error::e_WOULD_BLOCK' if the read
+    /// queue does not have sufficient size to satisfy the read operation, or
+    /// 'ntsa::Error::e_EOF' if the read queue is empty and the socket
+    /// receive buffer has been shut down. All other errors indicate no more
+    /// received data is available at this time or will become available in
+    /// the future. Note that the proactor always has a receive operation
+    /// outstanding into the read queue, so data is never copied from the
+    /// socket receive buffer directly into the 'buffer'.
+    ntsa::Error receive(ntca::ReceiveContext*       context,
+                        bsl::size_t*                numBytesReceived,
+                        const ntsa::MutableBuffer&  buffer,
+                        const ntca::ReceiveOptions& options)
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Dequeue received data according to the specified 'options'. If the
     /// read queue has sufficient size to satisfy the read operation,
     /// synchronously copy the read queue into an internally allocated data
@@ -1176,6 +1197,10 @@ class StreamSocket : public ntci::StreamSocket,
     void moveAndExecute(FunctorSequence* functorSequence,
                         const Functor&   functor) BSLS_KEYWORD_OVERRIDE;
 
+    /// Defer the execution of the callable object stored by the specified
+    /// 'functor', leaving the 'functor' empty.
+    void executeInplace(InplaceFunctor* functor) BSLS_KEYWORD_OVERRIDE;
+
     /// Create a new strand to serialize execution of functors. Optionally
     /// specify a 'basicAllocator' used to supply memory. If
     /// 'basicAllocator' is 0, the currently installed default allocator is
@@ -113,6 +113,9 @@ ReceiveCallbackQueueEntryPool::~ReceiveCallbackQueueEntryPool()
 ReceiveCallbackQueue::ReceiveCallbackQueue(bslma::Allocator* basicAllocator)
 : d_entryList(basicAllocator)
 , d_entryPool(basicAllocator)
+, d_entryIndex(basicAllocator)
+, d_tokenIndex(basicAllocator)
+, d_numRemoved(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
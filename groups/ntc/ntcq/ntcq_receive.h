@@ -28,6 +28,7 @@ BSLS_IDENT("$Id: $")
 #include <ntci_receiver.h>
 #include <ntci_strand.h>
 #include <ntci_timer.h>
+#include <ntcq_ring.h>
 #include <ntcs_callbackstate.h>
 #include <ntcs_watermarkutil.h>
 #include <ntcscm_version.h>
@@ -35,14 +36,18 @@ BSLS_IDENT("$Id: $")
 #include <bdlb_nullablevalue.h>
 #include <bdlbb_blob.h>
 #include <bdlcc_sharedobjectpool.h>
+#include <bslh_hash.h>
 #include <bsls_timeinterval.h>
 #include <bsls_timeutil.h>
+#include <bsl_algorithm.h>
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
-#include <bsl_list.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_unordered_multimap.h>
+#include <bsl_utility.h>
 #include <bsl_vector.h>
 
 namespace BloombergLP {
@@ -174,23 +179,47 @@ class ReceiveCallbackQueueEntryPool
 /// @internal @brief
 /// Provide a receive callback queue.
 ///
+/// @details
+/// Entries having a deadline are indexed by their address, and entries
+/// having a token are indexed by their token, so that an entry may be removed
+/// when its deadline expires or when it is canceled in constant time,
+/// regardless of the number of entries in the queue. An entry removed from
+/// the middle of the queue leaves an empty slot in place, to be discarded
+/// once it reaches the front of the queue.
+///
 /// @par Thread Safety
 /// This class is not thread safe.
 ///
 /// @ingroup module_ntcq
 class ReceiveCallbackQueue
 {
-    /// Define a type alias for a linked list of callback
-    /// entries.
-    typedef bsl::list<bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> >
+    /// Define a type alias for a ring of callback entries.
+    typedef ntcq::Ring<bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> >
         EntryList;
 
     /// Define a type alias for a pool of shared pointers to
     /// callback entries.
     typedef ntcq::ReceiveCallbackQueueEntryPool EntryPool;
 
+    /// Define a type alias for a map of the address of each entry having a
+    /// deadline to the sequence number of that entry in the ring.
+    typedef bsl::unordered_map<const ntcq::ReceiveCallbackQueueEntry*,
+                               bsl::uint64_t>
+        EntryIndex;
+
+    /// Define a type alias for a map of the token of each entry having a
+    /// token to the sequence number of that entry in the ring. Tokens are
+    /// chosen by the user and are not required to be unique, so a token may
+    /// map to the sequence numbers of several entries.
+    typedef bsl::
+        unordered_multimap<ntca::ReceiveToken, bsl::uint64_t, bslh::Hash<> >
+            TokenIndex;
+
     EntryList         d_entryList;
     EntryPool         d_entryPool;
+    EntryIndex        d_entryIndex;
+    TokenIndex        d_tokenIndex;
+    bsl::size_t       d_numRemoved;
     bslma::Allocator* d_allocator_p;
 
   private:
@@ -198,6 +227,29 @@ class ReceiveCallbackQueue
     ReceiveCallbackQueue& operator=(const ReceiveCallbackQueue&)
         BSLS_KEYWORD_DELETED;
 
+  private:
+    /// Index the specified 'entry' having the specified 'sequenceNumber' in
+    /// the ring by its address, if it has a deadline, and by its token, if
+    /// it has a token.
+    void indexEntry(const ntcq::ReceiveCallbackQueueEntry& entry,
+                    bsl::uint64_t                          sequenceNumber);
+
+    /// Remove the specified 'entry' having the specified 'sequenceNumber' in
+    /// the ring from the indexes.
+    void unindexEntry(const ntcq::ReceiveCallbackQueueEntry& entry,
+                      bsl::uint64_t                          sequenceNumber);
+
+    /// Remove the entry having the specified 'sequenceNumber' in the ring
+    /// and load it into the specified 'result'. Return the error.
+    ntsa::Error removeEntry(
+        bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>* result,
+        bsl::uint64_t                                     sequenceNumber);
+
+    /// Discard the empty slots left by removed entries from the front and
+    /// back of the ring, so that the slot at the front of the ring, if any,
+    /// holds an entry.
+    void discardRemovedEntries();
+
   public:
     /// Create a new receive callback queue having an unlimited size.
     /// Optionally specify a 'basicAllocator' used to supply memory. If
@@ -264,6 +316,14 @@ class ReceiveQueueEntry
     /// Create a new receive from message queue entry.
     ReceiveQueueEntry();
 
+    /// Reset the value of this object to its value upon default
+    /// construction.
+    void reset();
+
+    /// Efficiently exchange the value of this object with the value of the
+    /// specified 'other' object.
+    void swap(ReceiveQueueEntry& other);
+
     /// Set the endpoint to the specified 'endpoint'.
     void setEndpoint(const ntsa::Endpoint& endpoint);
 
@@ -296,6 +356,11 @@ class ReceiveQueueEntry
     bsls::TimeInterval delay() const;
 };
 
+/// Exchange the values of the specified 'a' and 'b' objects.
+///
+/// @related ntcq::ReceiveQueueEntry
+void swap(ReceiveQueueEntry& a, ReceiveQueueEntry& b);
+
 /// @internal @brief
 /// Provide a mechanism to advise how much data should be attempted to be
 /// copied from a receive buffer.
@@ -421,9 +486,9 @@ class ReceiveFeedback
 /// @ingroup module_ntcq
 class ReceiveQueue
 {
-    /// This typedef defines a linked list of structures that describe
-    /// the read queue.
-    typedef bsl::list<ReceiveQueueEntry> EntryList;
+    /// This typedef defines a ring of structures that describe the read
+    /// queue.
+    typedef ntcq::Ring<ReceiveQueueEntry> EntryList;
 
     EntryList                    d_entryList;
     bsl::shared_ptr<bdlbb::Blob> d_data_sp;
@@ -601,11 +666,96 @@ bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> ReceiveCallbackQueue::create()
     return d_entryPool.create();
 }
 
+NTCCFG_INLINE
+void ReceiveCallbackQueue::indexEntry(
+    const ntcq::ReceiveCallbackQueueEntry& entry,
+    bsl::uint64_t                          sequenceNumber)
+{
+    if (!entry.options().deadline().isNull()) {
+        d_entryIndex.insert(EntryIndex::value_type(&entry, sequenceNumber));
+    }
+
+    if (!entry.options().token().isNull()) {
+        d_tokenIndex.insert(TokenIndex::value_type(
+            entry.options().token().value(), sequenceNumber));
+    }
+}
+
+NTCCFG_INLINE
+void ReceiveCallbackQueue::unindexEntry(
+    const ntcq::ReceiveCallbackQueueEntry& entry,
+    bsl::uint64_t                          sequenceNumber)
+{
+    if (!d_entryIndex.empty()) {
+        EntryIndex::iterator it = d_entryIndex.find(&entry);
+        if (it != d_entryIndex.end() && it->second == sequenceNumber) {
+            d_entryIndex.erase(it);
+        }
+    }
+
+    if (!d_tokenIndex.empty() && !entry.options().token().isNull()) {
+        bsl::pair<TokenIndex::iterator, TokenIndex::iterator> range =
+            d_tokenIndex.equal_range(entry.options().token().value());
+        for (TokenIndex::iterator it = range.first; it != range.second; ++it)
+        {
+            if (it->second == sequenceNumber) {
+                d_tokenIndex.erase(it);
+                break;
+            }
+        }
+    }
+}
+
+NTCCFG_INLINE
+ntsa::Error ReceiveCallbackQueue::removeEntry(
+    bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>* result,
+    bsl::uint64_t                                     sequenceNumber)
+{
+    bsl::size_t index = 0;
+    if (!d_entryList.locate(&index, sequenceNumber)) {
+        return ntsa::Error(ntsa::Error::e_EOF);
+    }
+
+    bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& entry =
+        d_entryList[index];
+    BSLS_ASSERT(entry);
+
+    this->unindexEntry(*entry, sequenceNumber);
+
+    result->reset();
+    result->swap(entry);
+    ++d_numRemoved;
+
+    this->discardRemovedEntries();
+
+    return ntsa::Error();
+}
+
+NTCCFG_INLINE
+void ReceiveCallbackQueue::discardRemovedEntries()
+{
+    while (!d_entryList.empty() && !d_entryList.front()) {
+        BSLS_ASSERT(d_numRemoved > 0);
+        --d_numRemoved;
+        d_entryList.popFront();
+    }
+
+    while (!d_entryList.empty() && !d_entryList.back()) {
+        BSLS_ASSERT(d_numRemoved > 0);
+        --d_numRemoved;
+        d_entryList.popBack();
+    }
+}
+
 NTCCFG_INLINE
 ntsa::Error ReceiveCallbackQueue::push(
     const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& entry)
 {
-    d_entryList.push_back(entry);
+    const bsl::uint64_t sequenceNumber = d_entryList.nextSequenceNumber();
+
+    d_entryList.pushBack() = entry;
+    this->indexEntry(*entry, sequenceNumber);
+
     return ntsa::Error();
 }
 
@@ -615,9 +765,19 @@ ntsa::Error ReceiveCallbackQueue::pop(
     bsl::size_t                                       numBytesAvailable)
 {
     if (!d_entryList.empty()) {
-        if (numBytesAvailable >= d_entryList.front()->options().minSize()) {
-            *result = d_entryList.front();
-            d_entryList.pop_front();
+        bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& entry =
+            d_entryList.front();
+        BSLS_ASSERT(entry);
+
+        if (numBytesAvailable >= entry->options().minSize()) {
+            this->unindexEntry(*entry, d_entryList.sequenceNumber(0));
+
+            result->reset();
+            result->swap(entry);
+
+            d_entryList.popFront();
+            this->discardRemovedEntries();
+
             return ntsa::Error();
         }
         else {
@@ -633,13 +793,24 @@ NTCCFG_INLINE
 ntsa::Error ReceiveCallbackQueue::remove(
     const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& entry)
 {
-    for (EntryList::iterator it = d_entryList.begin(); it != d_entryList.end();
-         ++it)
-    {
-        const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& target = *it;
-        if (entry == target) {
-            d_entryList.erase(it);
-            return ntsa::Error();
+    if (!entry->options().deadline().isNull()) {
+        EntryIndex::const_iterator it = d_entryIndex.find(entry.get());
+        if (it == d_entryIndex.end()) {
+            return ntsa::Error(ntsa::Error::e_EOF);
+        }
+
+        bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> removed;
+        return this->removeEntry(&removed, it->second);
+    }
+
+    // Entries without a deadline are not indexed by their address, so fall
+    // back to a linear search.
+
+    for (bsl::size_t i = 0; i < d_entryList.size(); ++i) {
+        if (entry == d_entryList[i]) {
+            bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> removed;
+            return this->removeEntry(&removed,
+                                     d_entryList.sequenceNumber(i));
         }
     }
 
@@ -653,35 +824,49 @@ ntsa::Error ReceiveCallbackQueue::remove(
 {
     result->reset();
 
-    for (EntryList::iterator it = d_entryList.begin(); it != d_entryList.end();
+    // Remove the oldest entry having the token, if any.
+
+    bsl::pair<TokenIndex::const_iterator, TokenIndex::const_iterator> range =
+        d_tokenIndex.equal_range(token);
+    if (range.first == range.second) {
+        return ntsa::Error(ntsa::Error::e_EOF);
+    }
+
+    bsl::uint64_t sequenceNumber = range.first->second;
+    for (TokenIndex::const_iterator it = range.first; it != range.second;
          ++it)
     {
-        const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& entry = *it;
-
-        if (!entry->options().token().isNull()) {
-            if (entry->options().token().value() == token) {
-                *result = entry;
-                d_entryList.erase(it);
-                return ntsa::Error();
-            }
+        if (it->second < sequenceNumber) {
+            sequenceNumber = it->second;
         }
     }
 
-    return ntsa::Error(ntsa::Error::e_EOF);
+    return this->removeEntry(result, sequenceNumber);
 }
 
 NTCCFG_INLINE
 void ReceiveCallbackQueue::removeAll(
     bsl::vector<bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> >* result)
 {
-    result->insert(result->end(), d_entryList.begin(), d_entryList.end());
+    result->reserve(result->size() + d_entryList.size() - d_numRemoved);
+
+    for (bsl::size_t i = 0; i < d_entryList.size(); ++i) {
+        if (d_entryList[i]) {
+            result->push_back(d_entryList[i]);
+            d_entryList[i].reset();
+        }
+    }
+
     d_entryList.clear();
+    d_entryIndex.clear();
+    d_tokenIndex.clear();
+    d_numRemoved = 0;
 }
 
 NTCCFG_INLINE
 bsl::size_t ReceiveCallbackQueue::size() const
 {
-    return d_entryList.size();
+    return d_entryList.size() - d_numRemoved;
 }
 
 NTCCFG_INLINE
@@ -699,6 +884,24 @@ ReceiveQueueEntry::ReceiveQueueEntry()
 {
 }
 
+NTCCFG_INLINE
+void ReceiveQueueEntry::reset()
+{
+    d_endpoint.reset();
+    d_data_sp.reset();
+    d_length    = 0;
+    d_timestamp = 0;
+}
+
+NTCCFG_INLINE
+void ReceiveQueueEntry::swap(ReceiveQueueEntry& other)
+{
+    d_endpoint.swap(other.d_endpoint);
+    d_data_sp.swap(other.d_data_sp);
+    bsl::swap(d_length, other.d_length);
+    bsl::swap(d_timestamp, other.d_timestamp);
+}
+
 NTCCFG_INLINE
 void ReceiveQueueEntry::setEndpoint(const ntsa::Endpoint& endpoint)
 {
@@ -769,6 +972,12 @@ bsls::TimeInterval ReceiveQueueEntry::delay() const
     return delay;
 }
 
+NTCCFG_INLINE
+void swap(ReceiveQueueEntry& a, ReceiveQueueEntry& b)
+{
+    a.swap(b);
+}
+
 NTCCFG_INLINE
 ReceiveFeedback::ReceiveFeedback()
 : d_minimum(NTCCFG_DEFAULT_STREAM_SOCKET_MIN_INCOMING_TRANSFER_SIZE)
@@ -897,7 +1106,7 @@ bsl::size_t ReceiveFeedback::decreaseFactor() const
 NTCCFG_INLINE
 bool ReceiveQueue::pushEntry(const ReceiveQueueEntry& entry)
 {
-    d_entryList.push_back(entry);
+    d_entryList.pushBack() = entry;
 
     BSLS_ASSERT(entry.length() > 0);
     d_size += entry.length();
@@ -927,7 +1136,9 @@ bool ReceiveQueue::popEntry()
         d_watermarkHighWanted = true;
     }
 
-    d_entryList.pop_front();
+    d_entryList.front().reset();
+    d_entryList.popFront();
+
     return d_entryList.empty();
 }
 
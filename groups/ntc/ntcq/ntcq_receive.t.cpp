@@ -20,8 +20,13 @@
 #include <bdlf_bind.h>
 #include <bdlf_placeholder.h>
 #include <bslma_allocator.h>
+#include <ntsa_endpoint.h>
+#include <bdlbb_blob.h>
+#include <bdlbb_simpleblobbufferfactory.h>
 #include <bslma_default.h>
+#include <bslma_testallocator.h>
 #include <bsls_assert.h>
+#include <bsls_timeutil.h>
 
 using namespace BloombergLP;
 
@@ -36,6 +41,9 @@ using namespace BloombergLP;
 // [ 1]
 //-----------------------------------------------------------------------------
 // [ 1]
+// [ 5] Pushing and popping entries does not allocate in the steady state.
+// [ 6] Throughput of pushing and popping entries.
+// [ 7] Callback entries are removed from a large backlog in constant time.
 //-----------------------------------------------------------------------------
 
 namespace test {
@@ -812,11 +820,387 @@ NTCCFG_TEST_CASE(4)
 #endif
 }
 
+NTCCFG_TEST_CASE(5)
+{
+    // Concern: Pushing and popping entries and callback entries does not
+    // allocate memory once the queue has grown to its working capacity.
+
+    ntccfg::TestAllocator ta;
+    {
+        const bsl::size_t k_BLOB_BUFFER_SIZE = 32;
+        const bsl::size_t k_MESSAGE_SIZE     = 100;
+        const bsl::size_t k_DEPTH            = 256;
+        const bsl::size_t k_NUM_ROUNDS       = 16;
+
+        bdlbb::SimpleBlobBufferFactory blobBufferFactory(k_BLOB_BUFFER_SIZE,
+                                                         &ta);
+
+        bsl::shared_ptr<bdlbb::Blob> data;
+        data.createInplace(&ta, &blobBufferFactory, &ta);
+        data->setLength(k_MESSAGE_SIZE);
+
+        const ntsa::Endpoint endpoint("127.0.0.1:12345");
+
+        bslma::TestAllocator queueAllocator("queue");
+
+        {
+            ntcq::ReceiveQueue receiveQueue(&queueAllocator);
+
+            bsls::Types::Int64 numAllocations = 0;
+
+            for (bsl::size_t round = 0; round < k_NUM_ROUNDS; ++round) {
+                for (bsl::size_t i = 0; i < k_DEPTH; ++i) {
+                    ntcq::ReceiveQueueEntry entry;
+                    entry.setData(data);
+                    entry.setLength(k_MESSAGE_SIZE);
+
+                    if (i % 2 == 0) {
+                        entry.setEndpoint(endpoint);
+                    }
+
+                    receiveQueue.pushEntry(entry);
+                }
+
+                NTCCFG_TEST_EQ(receiveQueue.size(), k_DEPTH * k_MESSAGE_SIZE);
+
+                for (bsl::size_t i = 0; i < k_DEPTH; ++i) {
+                    ntcq::ReceiveQueueEntry& entry = receiveQueue.frontEntry();
+                    NTCCFG_TEST_EQ(entry.data(), data);
+                    NTCCFG_TEST_EQ(entry.length(), k_MESSAGE_SIZE);
+
+                    if (i % 2 == 0) {
+                        NTCCFG_TEST_FALSE(entry.endpoint().isNull());
+                        NTCCFG_TEST_EQ(entry.endpoint().value(), endpoint);
+                    }
+                    else {
+                        NTCCFG_TEST_TRUE(entry.endpoint().isNull());
+                    }
+
+                    receiveQueue.popEntry();
+                }
+
+                NTCCFG_TEST_FALSE(receiveQueue.hasEntry());
+
+                if (round == 0) {
+                    numAllocations = queueAllocator.numAllocations();
+                }
+                else {
+                    NTCCFG_TEST_EQ(queueAllocator.numAllocations(),
+                                   numAllocations);
+                }
+            }
+        }
+
+        NTCCFG_TEST_EQ(queueAllocator.numBlocksInUse(), 0);
+
+        {
+            typedef ntcq::ReceiveCallbackQueueEntry Entry;
+
+            ntcq::ReceiveCallbackQueue callbackQueue(&queueAllocator);
+
+            bsls::Types::Int64 numAllocations = 0;
+
+            for (bsl::size_t round = 0; round < k_NUM_ROUNDS; ++round) {
+                for (bsl::size_t i = 0; i < k_DEPTH; ++i) {
+                    ntsa::Error error = callbackQueue.push(
+                        callbackQueue.create());
+                    NTCCFG_TEST_OK(error);
+                }
+
+                NTCCFG_TEST_EQ(callbackQueue.size(), k_DEPTH);
+
+                for (bsl::size_t i = 0; i < k_DEPTH; ++i) {
+                    bsl::shared_ptr<Entry> entry;
+                    ntsa::Error error = callbackQueue.pop(&entry,
+                                                          k_MESSAGE_SIZE);
+                    NTCCFG_TEST_OK(error);
+                    NTCCFG_TEST_TRUE(entry);
+                }
+
+                NTCCFG_TEST_TRUE(callbackQueue.empty());
+
+                if (round == 0) {
+                    numAllocations = queueAllocator.numAllocations();
+                }
+                else {
+                    NTCCFG_TEST_EQ(queueAllocator.numAllocations(),
+                                   numAllocations);
+                }
+            }
+        }
+
+        NTCCFG_TEST_EQ(queueAllocator.numBlocksInUse(), 0);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(6)
+{
+    // Concern: Throughput of pushing and popping entries.
+
+    ntccfg::TestAllocator ta;
+    {
+        const bsl::size_t k_BLOB_BUFFER_SIZE = 32;
+        const bsl::size_t k_MESSAGE_SIZE     = 100;
+        const bsl::size_t k_DEPTH            = 64;
+        const bsl::size_t k_NUM_ROUNDS       = 10000;
+
+        bdlbb::SimpleBlobBufferFactory blobBufferFactory(k_BLOB_BUFFER_SIZE,
+                                                         &ta);
+
+        bsl::shared_ptr<bdlbb::Blob> data;
+        data.createInplace(&ta, &blobBufferFactory, &ta);
+        data->setLength(k_MESSAGE_SIZE);
+
+        ntcq::ReceiveQueue receiveQueue(&ta);
+
+        ntcq::ReceiveQueueEntry entry;
+        entry.setData(data);
+        entry.setLength(k_MESSAGE_SIZE);
+
+        const bsls::Types::Int64 t0 = bsls::TimeUtil::getTimer();
+
+        for (bsl::size_t round = 0; round < k_NUM_ROUNDS; ++round) {
+            for (bsl::size_t i = 0; i < k_DEPTH; ++i) {
+                receiveQueue.pushEntry(entry);
+            }
+
+            for (bsl::size_t i = 0; i < k_DEPTH; ++i) {
+                receiveQueue.popEntry();
+            }
+        }
+
+        const bsls::Types::Int64 t1 = bsls::TimeUtil::getTimer();
+
+        NTCCFG_TEST_FALSE(receiveQueue.hasEntry());
+        NTCCFG_TEST_EQ(receiveQueue.size(), 0);
+
+        const double numEntries =
+            static_cast<double>(k_DEPTH) * static_cast<double>(k_NUM_ROUNDS);
+        const double elapsed = static_cast<double>(t1 - t0);
+
+        NTCCFG_TEST_LOG_DEBUG << "Pushed and popped " << numEntries
+                              << " entries in " << elapsed / 1e6
+                              << " ms: " << elapsed / numEntries
+                              << " ns/entry" << NTCCFG_TEST_LOG_END;
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(7)
+{
+    // Concern: Callback entries are removed from a large backlog in constant
+    // time.
+
+    ntccfg::TestAllocator ta;
+    {
+        typedef ntcq::ReceiveCallbackQueueEntry Entry;
+
+        const bsl::size_t k_NUM_ENTRIES = 100000;
+
+        ntcq::ReceiveCallbackQueue callbackQueue(&ta);
+
+        bsl::vector<bsl::shared_ptr<Entry> > entryVector(&ta);
+        entryVector.reserve(k_NUM_ENTRIES);
+
+        for (bsl::size_t i = 0; i < k_NUM_ENTRIES; ++i) {
+            ntca::ReceiveToken token;
+            token.setValue(i);
+
+            ntca::ReceiveOptions options;
+            options.setToken(token);
+            options.setDeadline(bsls::TimeInterval(1000, 0));
+
+            bsl::shared_ptr<Entry> entry = callbackQueue.create();
+            entry->assign(ntci::ReceiveCallback(), options);
+
+            entryVector.push_back(entry);
+
+            ntsa::Error error = callbackQueue.push(entry);
+            NTCCFG_TEST_OK(error);
+        }
+
+        NTCCFG_TEST_EQ(callbackQueue.size(), k_NUM_ENTRIES);
+
+        // Cancel every odd entry by token, starting from the back of the
+        // queue, which is the worst case for a linear search.
+
+        const bsls::Types::Int64 t0 = bsls::TimeUtil::getTimer();
+
+        for (bsl::size_t i = k_NUM_ENTRIES; i > 0; --i) {
+            if ((i - 1) % 2 == 1) {
+                ntca::ReceiveToken token;
+                token.setValue(i - 1);
+
+                bsl::shared_ptr<Entry> entry;
+                ntsa::Error error = callbackQueue.remove(&entry, token);
+                NTCCFG_TEST_OK(error);
+                NTCCFG_TEST_EQ(entry, entryVector[i - 1]);
+            }
+        }
+
+        const bsls::Types::Int64 t1 = bsls::TimeUtil::getTimer();
+
+        NTCCFG_TEST_EQ(callbackQueue.size(), k_NUM_ENTRIES / 2);
+
+        // Expire the deadline of every fourth entry.
+
+        for (bsl::size_t i = 0; i < k_NUM_ENTRIES; i += 4) {
+            ntsa::Error error = callbackQueue.remove(entryVector[i]);
+            NTCCFG_TEST_OK(error);
+        }
+
+        const bsls::Types::Int64 t2 = bsls::TimeUtil::getTimer();
+
+        NTCCFG_TEST_EQ(callbackQueue.size(), k_NUM_ENTRIES / 4);
+
+        // Removing an entry that has already been removed has no effect.
+
+        {
+            ntsa::Error error = callbackQueue.remove(entryVector[0]);
+            NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_EOF));
+
+            ntca::ReceiveToken token;
+            token.setValue(1);
+
+            bsl::shared_ptr<Entry> entry;
+            error = callbackQueue.remove(&entry, token);
+            NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_EOF));
+            NTCCFG_TEST_FALSE(entry);
+        }
+
+        // The remaining entries are popped in the order they were pushed.
+
+        for (bsl::size_t i = 2; i < k_NUM_ENTRIES; i += 4) {
+            bsl::shared_ptr<Entry> entry;
+            ntsa::Error            error = callbackQueue.pop(&entry, 1);
+            NTCCFG_TEST_OK(error);
+            NTCCFG_TEST_EQ(entry, entryVector[i]);
+        }
+
+        NTCCFG_TEST_TRUE(callbackQueue.empty());
+        NTCCFG_TEST_EQ(callbackQueue.size(), 0);
+
+        entryVector.clear();
+
+        NTCCFG_TEST_LOG_DEBUG << "Canceled " << k_NUM_ENTRIES / 2
+                              << " entries by token in "
+                              << static_cast<double>(t1 - t0) / 1e6
+                              << " ms and " << k_NUM_ENTRIES / 4
+                              << " entries by deadline in "
+                              << static_cast<double>(t2 - t1) / 1e6 << " ms"
+                              << NTCCFG_TEST_LOG_END;
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(8)
+{
+    // Concern: Callback entries sharing the same token are each removed by
+    // token, in the order they were pushed.
+
+    ntccfg::TestAllocator ta;
+    {
+        typedef ntcq::ReceiveCallbackQueueEntry Entry;
+
+        const bsl::size_t k_NUM_ENTRIES = 6;
+
+        ntcq::ReceiveCallbackQueue callbackQueue(&ta);
+
+        bsl::vector<bsl::shared_ptr<Entry> > entryVector(&ta);
+
+        // Push entries alternately having token 1 and token 2.
+
+        for (bsl::size_t i = 0; i < k_NUM_ENTRIES; ++i) {
+            ntca::ReceiveToken token;
+            token.setValue(1 + i % 2);
+
+            ntca::ReceiveOptions options;
+            options.setToken(token);
+
+            bsl::shared_ptr<Entry> entry = callbackQueue.create();
+            entry->assign(ntci::ReceiveCallback(), options);
+
+            entryVector.push_back(entry);
+
+            ntsa::Error error = callbackQueue.push(entry);
+            NTCCFG_TEST_OK(error);
+        }
+
+        NTCCFG_TEST_EQ(callbackQueue.size(), k_NUM_ENTRIES);
+
+        ntca::ReceiveToken token1;
+        token1.setValue(1);
+
+        ntca::ReceiveToken token2;
+        token2.setValue(2);
+
+        // Pop the first entry having token 1 from the front of the queue.
+
+        {
+            bsl::shared_ptr<Entry> entry;
+            ntsa::Error            error = callbackQueue.pop(&entry, 1);
+            NTCCFG_TEST_OK(error);
+            NTCCFG_TEST_EQ(entry, entryVector[0]);
+        }
+
+        // Cancel each remaining entry having token 1, oldest first.
+
+        for (bsl::size_t i = 2; i < k_NUM_ENTRIES; i += 2) {
+            bsl::shared_ptr<Entry> entry;
+            ntsa::Error            error =
+                callbackQueue.remove(&entry, token1);
+            NTCCFG_TEST_OK(error);
+            NTCCFG_TEST_EQ(entry, entryVector[i]);
+        }
+
+        {
+            bsl::shared_ptr<Entry> entry;
+            ntsa::Error            error =
+                callbackQueue.remove(&entry, token1);
+            NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_EOF));
+            NTCCFG_TEST_FALSE(entry);
+        }
+
+        NTCCFG_TEST_EQ(callbackQueue.size(), k_NUM_ENTRIES / 2);
+
+        // Cancel the oldest entry having token 2.
+
+        {
+            bsl::shared_ptr<Entry> entry;
+            ntsa::Error            error =
+                callbackQueue.remove(&entry, token2);
+            NTCCFG_TEST_OK(error);
+            NTCCFG_TEST_EQ(entry, entryVector[1]);
+        }
+
+        // The remaining entries having token 2 are popped in the order they
+        // were pushed.
+
+        for (bsl::size_t i = 3; i < k_NUM_ENTRIES; i += 2) {
+            bsl::shared_ptr<Entry> entry;
+            ntsa::Error            error = callbackQueue.pop(&entry, 1);
+            NTCCFG_TEST_OK(error);
+            NTCCFG_TEST_EQ(entry, entryVector[i]);
+        }
+
+        NTCCFG_TEST_TRUE(callbackQueue.empty());
+        NTCCFG_TEST_EQ(callbackQueue.size(), 0);
+
+        entryVector.clear();
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
     NTCCFG_TEST_REGISTER(2);
     NTCCFG_TEST_REGISTER(3);
     NTCCFG_TEST_REGISTER(4);
+    NTCCFG_TEST_REGISTER(5);
+    NTCCFG_TEST_REGISTER(6);
+    NTCCFG_TEST_REGISTER(7);
+    NTCCFG_TEST_REGISTER(8);
 }
 NTCCFG_TEST_DRIVER_END;
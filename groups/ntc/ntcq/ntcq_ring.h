@@ -0,0 +1,366 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCQ_RING
+#define INCLUDED_NTCQ_RING
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_platform.h>
+#include <ntcscm_version.h>
+#include <bslalg_swaputil.h>
+#include <bslma_allocator.h>
+#include <bsls_assert.h>
+#include <bsls_keyword.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ntcq {
+
+/// @internal @brief
+/// Provide a growable, contiguous ring of reusable elements.
+///
+/// @details
+/// This class provides a double-ended sequence of elements stored in a
+/// contiguous, circular array whose capacity is always a power of two.
+/// Elements are never constructed or destroyed as they are pushed and
+/// popped: every slot in the array holds a default-constructed 'TYPE' that
+/// is reused, so pushing and popping elements allocates no memory once the
+/// ring has grown to its working capacity. Users are responsible for
+/// assigning the element returned from 'pushBack()' and for resetting an
+/// element before it is popped, so that the slot does not retain resources
+/// after the element is logically removed. 'TYPE' must be
+/// default-constructible using an allocator and swappable.
+///
+/// Each element pushed onto the ring is assigned a sequence number, one
+/// greater than the sequence number of the element pushed before it, that
+/// remains valid while the element is in the ring. Users may record the
+/// sequence number of an element to later locate that element in constant
+/// time, regardless of how many elements have since been pushed or popped.
+/// Note that erasing an element from the middle of the ring changes the
+/// sequence number of each element before it.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntcq
+template <typename TYPE>
+class Ring
+{
+    bsl::vector<TYPE> d_storage;
+    bsl::size_t       d_head;
+    bsl::size_t       d_size;
+    bsl::uint64_t     d_origin;
+
+  private:
+    Ring(const Ring&) BSLS_KEYWORD_DELETED;
+    Ring& operator=(const Ring&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Grow the capacity of the ring to at least the specified
+    /// 'minCapacity', preserving the order of each element.
+    void grow(bsl::size_t minCapacity);
+
+    /// Return the position in the storage of the element at the specified
+    /// 'index' from the front of the ring.
+    bsl::size_t position(bsl::size_t index) const;
+
+  public:
+    enum {
+        /// The capacity of the ring when it first grows.
+        k_MIN_CAPACITY = 8,
+
+        /// The maximum capacity retained by the ring once it becomes empty.
+        k_MAX_IDLE_CAPACITY = 1024
+    };
+
+    /// Create a new, empty ring having no capacity. Optionally specify a
+    /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
+    /// the currently installed default allocator is used.
+    explicit Ring(bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~Ring();
+
+    /// Add an element to the back of the ring, growing the ring if
+    /// necessary, and return a reference to the modifiable element. Note
+    /// that the element has the value it had when it was last reset.
+    TYPE& pushBack();
+
+    /// Remove the element at the front of the ring. The behavior is
+    /// undefined unless the ring is not empty.
+    void popFront();
+
+    /// Remove the element at the back of the ring. The behavior is
+    /// undefined unless the ring is not empty.
+    void popBack();
+
+    /// Remove the element at the specified 'index' from the front of the
+    /// ring, shifting each element before it towards the back of the ring.
+    /// The behavior is undefined unless 'index < size()'.
+    void erase(bsl::size_t index);
+
+    /// Remove all elements from the ring. If the capacity of the ring is
+    /// greater than 'k_MAX_IDLE_CAPACITY', release the storage of the ring.
+    void clear();
+
+    /// Return a reference to the modifiable element at the front of the
+    /// ring. The behavior is undefined unless the ring is not empty.
+    TYPE& front();
+
+    /// Return a reference to the modifiable element at the back of the
+    /// ring. The behavior is undefined unless the ring is not empty.
+    TYPE& back();
+
+    /// Return a reference to the modifiable element at the specified
+    /// 'index' from the front of the ring. The behavior is undefined unless
+    /// 'index < size()'.
+    TYPE& operator[](bsl::size_t index);
+
+    /// Return a reference to the non-modifiable element at the front of the
+    /// ring. The behavior is undefined unless the ring is not empty.
+    const TYPE& front() const;
+
+    /// Return a reference to the non-modifiable element at the back of the
+    /// ring. The behavior is undefined unless the ring is not empty.
+    const TYPE& back() const;
+
+    /// Return a reference to the non-modifiable element at the specified
+    /// 'index' from the front of the ring. The behavior is undefined unless
+    /// 'index < size()'.
+    const TYPE& operator[](bsl::size_t index) const;
+
+    /// Load into the specified 'result' the index from the front of the
+    /// ring of the element having the specified 'sequenceNumber'. Return
+    /// true if such an element is in the ring, otherwise return false.
+    bool locate(bsl::size_t* result, bsl::uint64_t sequenceNumber) const;
+
+    /// Return the sequence number of the element at the specified 'index'
+    /// from the front of the ring. The behavior is undefined unless
+    /// 'index < size()'.
+    bsl::uint64_t sequenceNumber(bsl::size_t index) const;
+
+    /// Return the sequence number that will be assigned to the next element
+    /// pushed onto the ring.
+    bsl::uint64_t nextSequenceNumber() const;
+
+    /// Return the number of elements in the ring.
+    bsl::size_t size() const;
+
+    /// Return the number of elements the ring can hold without growing.
+    bsl::size_t capacity() const;
+
+    /// Return true if the ring has no elements, otherwise return false.
+    bool empty() const;
+};
+
+template <typename TYPE>
+void Ring<TYPE>::grow(bsl::size_t minCapacity)
+{
+    bsl::size_t newCapacity = d_storage.empty()
+                                  ? static_cast<bsl::size_t>(k_MIN_CAPACITY)
+                                  : d_storage.size() * 2;
+    while (newCapacity < minCapacity) {
+        newCapacity *= 2;
+    }
+
+    bsl::vector<TYPE> storage(newCapacity, d_storage.get_allocator());
+
+    for (bsl::size_t i = 0; i < d_size; ++i) {
+        bslalg::SwapUtil::swap(&storage[i], &d_storage[this->position(i)]);
+    }
+
+    d_storage.swap(storage);
+    d_head = 0;
+}
+
+template <typename TYPE>
+NTCCFG_INLINE bsl::size_t Ring<TYPE>::position(bsl::size_t index) const
+{
+    return (d_head + index) & (d_storage.size() - 1);
+}
+
+template <typename TYPE>
+NTCCFG_INLINE Ring<TYPE>::Ring(bslma::Allocator* basicAllocator)
+: d_storage(basicAllocator)
+, d_head(0)
+, d_size(0)
+, d_origin(0)
+{
+}
+
+template <typename TYPE>
+NTCCFG_INLINE Ring<TYPE>::~Ring()
+{
+}
+
+template <typename TYPE>
+NTCCFG_INLINE TYPE& Ring<TYPE>::pushBack()
+{
+    if (NTCCFG_UNLIKELY(d_size == d_storage.size())) {
+        this->grow(d_size + 1);
+    }
+
+    TYPE& result = d_storage[this->position(d_size)];
+    ++d_size;
+
+    return result;
+}
+
+template <typename TYPE>
+NTCCFG_INLINE void Ring<TYPE>::popFront()
+{
+    BSLS_ASSERT(d_size > 0);
+
+    d_head = (d_head + 1) & (d_storage.size() - 1);
+    --d_size;
+    ++d_origin;
+
+    if (d_size == 0) {
+        this->clear();
+    }
+}
+
+template <typename TYPE>
+NTCCFG_INLINE void Ring<TYPE>::popBack()
+{
+    BSLS_ASSERT(d_size > 0);
+
+    --d_size;
+
+    if (d_size == 0) {
+        this->clear();
+    }
+}
+
+template <typename TYPE>
+void Ring<TYPE>::erase(bsl::size_t index)
+{
+    BSLS_ASSERT(index < d_size);
+
+    for (bsl::size_t i = index; i > 0; --i) {
+        bslalg::SwapUtil::swap(&d_storage[this->position(i)],
+                               &d_storage[this->position(i - 1)]);
+    }
+
+    this->popFront();
+}
+
+template <typename TYPE>
+NTCCFG_INLINE void Ring<TYPE>::clear()
+{
+    d_origin += d_size;
+
+    d_head = 0;
+    d_size = 0;
+
+    if (d_storage.size() > static_cast<bsl::size_t>(k_MAX_IDLE_CAPACITY)) {
+        bsl::vector<TYPE> storage(d_storage.get_allocator());
+        d_storage.swap(storage);
+    }
+}
+
+template <typename TYPE>
+NTCCFG_INLINE TYPE& Ring<TYPE>::front()
+{
+    BSLS_ASSERT(d_size > 0);
+    return d_storage[d_head];
+}
+
+template <typename TYPE>
+NTCCFG_INLINE TYPE& Ring<TYPE>::back()
+{
+    BSLS_ASSERT(d_size > 0);
+    return d_storage[this->position(d_size - 1)];
+}
+
+template <typename TYPE>
+NTCCFG_INLINE TYPE& Ring<TYPE>::operator[](bsl::size_t index)
+{
+    BSLS_ASSERT(index < d_size);
+    return d_storage[this->position(index)];
+}
+
+template <typename TYPE>
+NTCCFG_INLINE const TYPE& Ring<TYPE>::front() const
+{
+    BSLS_ASSERT(d_size > 0);
+    return d_storage[d_head];
+}
+
+template <typename TYPE>
+NTCCFG_INLINE const TYPE& Ring<TYPE>::back() const
+{
+    BSLS_ASSERT(d_size > 0);
+    return d_storage[this->position(d_size - 1)];
+}
+
+template <typename TYPE>
+NTCCFG_INLINE const TYPE& Ring<TYPE>::operator[](bsl::size_t index) const
+{
+    BSLS_ASSERT(index < d_size);
+    return d_storage[this->position(index)];
+}
+
+template <typename TYPE>
+NTCCFG_INLINE bool Ring<TYPE>::locate(bsl::size_t*  result,
+                                      bsl::uint64_t sequenceNumber) const
+{
+    if (sequenceNumber < d_origin || sequenceNumber - d_origin >= d_size) {
+        return false;
+    }
+
+    *result = static_cast<bsl::size_t>(sequenceNumber - d_origin);
+    return true;
+}
+
+template <typename TYPE>
+NTCCFG_INLINE bsl::uint64_t Ring<TYPE>::sequenceNumber(
+    bsl::size_t index) const
+{
+    BSLS_ASSERT(index < d_size);
+    return d_origin + index;
+}
+
+template <typename TYPE>
+NTCCFG_INLINE bsl::uint64_t Ring<TYPE>::nextSequenceNumber() const
+{
+    return d_origin + d_size;
+}
+
+template <typename TYPE>
+NTCCFG_INLINE bsl::size_t Ring<TYPE>::size() const
+{
+    return d_size;
+}
+
+template <typename TYPE>
+NTCCFG_INLINE bsl::size_t Ring<TYPE>::capacity() const
+{
+    return d_storage.size();
+}
+
+template <typename TYPE>
+NTCCFG_INLINE bool Ring<TYPE>::empty() const
+{
+    return d_size == 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
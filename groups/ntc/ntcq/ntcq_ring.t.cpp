@@ -0,0 +1,177 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcq_ring.h>
+
+#include <ntccfg_test.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bsls_assert.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// This test driver verifies the ring preserves the order of its elements as
+// they are pushed, popped, and erased, while the ring wraps around and grows.
+//-----------------------------------------------------------------------------
+
+// [ 1] Elements are popped in the order they are pushed across growth.
+// [ 2] Elements are erased from the middle of the ring.
+// [ 3] Storage is reused and released when the ring becomes empty.
+//-----------------------------------------------------------------------------
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Elements are popped in the order they are pushed across
+    // growth.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntcq::Ring<int> ring(&ta);
+
+        NTCCFG_TEST_TRUE(ring.empty());
+        NTCCFG_TEST_EQ(ring.size(), 0);
+        NTCCFG_TEST_EQ(ring.capacity(), 0);
+
+        int next     = 0;
+        int expected = 0;
+
+        // Offset the head of the ring so that the ring wraps around before
+        // it grows.
+
+        for (int i = 0; i < 5; ++i) {
+            ring.pushBack() = next++;
+        }
+
+        for (int i = 0; i < 3; ++i) {
+            NTCCFG_TEST_EQ(ring.front(), expected++);
+            ring.popFront();
+        }
+
+        for (int i = 0; i < 100; ++i) {
+            ring.pushBack() = next++;
+            NTCCFG_TEST_EQ(ring.back(), next - 1);
+        }
+
+        NTCCFG_TEST_EQ(ring.size(), 102);
+        NTCCFG_TEST_EQ(ring.capacity(), 128);
+
+        for (bsl::size_t i = 0; i < ring.size(); ++i) {
+            NTCCFG_TEST_EQ(ring[i], expected + static_cast<int>(i));
+        }
+
+        while (!ring.empty()) {
+            NTCCFG_TEST_EQ(ring.front(), expected++);
+            ring.popFront();
+        }
+
+        NTCCFG_TEST_EQ(expected, next);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: Elements are erased from the middle of the ring.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntcq::Ring<bsl::string> ring(&ta);
+
+        for (int i = 0; i < 6; ++i) {
+            ring.pushBack() = "x";
+            ring.front().clear();
+            ring.popFront();
+        }
+
+        const char* values[] = {"a", "b", "c", "d", "e"};
+
+        for (bsl::size_t i = 0; i < 5; ++i) {
+            ring.pushBack() = values[i];
+        }
+
+        ring[2].clear();
+        ring.erase(2);
+
+        NTCCFG_TEST_EQ(ring.size(), 4);
+        NTCCFG_TEST_EQ(ring[0], "a");
+        NTCCFG_TEST_EQ(ring[1], "b");
+        NTCCFG_TEST_EQ(ring[2], "d");
+        NTCCFG_TEST_EQ(ring[3], "e");
+
+        ring[0].clear();
+        ring.erase(0);
+
+        NTCCFG_TEST_EQ(ring.size(), 3);
+        NTCCFG_TEST_EQ(ring.front(), "b");
+
+        ring.back().clear();
+        ring.popBack();
+
+        NTCCFG_TEST_EQ(ring.size(), 2);
+        NTCCFG_TEST_EQ(ring.back(), "d");
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(3)
+{
+    // Concern: Storage is reused and released when the ring becomes empty.
+
+    ntccfg::TestAllocator ta;
+    {
+        typedef ntcq::Ring<int> Ring;
+
+        Ring ring(&ta);
+
+        for (int i = 0; i < 16; ++i) {
+            ring.pushBack() = i;
+        }
+
+        const bsl::size_t capacity = ring.capacity();
+
+        while (!ring.empty()) {
+            ring.popFront();
+        }
+
+        NTCCFG_TEST_EQ(ring.capacity(), capacity);
+
+        for (int i = 0; i < Ring::k_MAX_IDLE_CAPACITY + 1; ++i) {
+            ring.pushBack() = i;
+        }
+
+        NTCCFG_TEST_GT(ring.capacity(),
+                       static_cast<bsl::size_t>(Ring::k_MAX_IDLE_CAPACITY));
+
+        ring.clear();
+
+        NTCCFG_TEST_TRUE(ring.empty());
+        NTCCFG_TEST_EQ(ring.capacity(), 0);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+    NTCCFG_TEST_REGISTER(3);
+}
+NTCCFG_TEST_DRIVER_END;
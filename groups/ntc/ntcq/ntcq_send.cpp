@@ -32,6 +32,20 @@ BSLS_IDENT_RCSID(ntcq_send_cpp, "$Id$ $CSID$")
 namespace BloombergLP {
 namespace ntcq {
 
+namespace {
+
+// The attributes shared by every send queue entry that does not define any
+// out-of-line attributes.
+const SendQueueEntryAttributes s_noAttributes(
+    bslma::Default::globalAllocator());
+
+}  // close unnamed namespace
+
+const SendQueueEntryAttributes& SendQueueEntryAttributes::none()
+{
+    return s_noAttributes;
+}
+
 bool SendQueueEntry::batchNext(ntsa::ConstBufferArray*  result,
                                const ntsa::SendOptions& options) const
 {
@@ -257,6 +271,9 @@ bool SendQueueEntry::batchNext(ntsa::ConstBufferArray*  result,
 
 SendQueue::SendQueue(bslma::Allocator* basicAllocator)
 : d_entryList(basicAllocator)
+, d_attributesPool(basicAllocator)
+, d_idIndex(basicAllocator)
+, d_tokenIndex(basicAllocator)
 , d_data_sp()
 , d_size(0)
 , d_watermarkLow(NTCCFG_DEFAULT_STREAM_SOCKET_WRITE_QUEUE_LOW_WATERMARK)
@@ -272,6 +289,12 @@ SendQueue::SendQueue(bslma::Allocator* basicAllocator)
 
 SendQueue::~SendQueue()
 {
+    for (AttributesPool::iterator it = d_attributesPool.begin();
+         it != d_attributesPool.end();
+         ++it)
+    {
+        d_allocator_p->deleteObject(*it);
+    }
 }
 
 bool SendQueue::batchNext(ntsa::ConstBufferArray*  result,
@@ -288,20 +311,17 @@ bool SendQueue::batchNext(ntsa::ConstBufferArray*  result,
         effectiveOptions.setMaxBuffers(ntsu::SocketUtil::maxBuffersPerSend());
     }
 
-    EntryList::const_iterator current = d_entryList.begin();
-    EntryList::const_iterator end     = d_entryList.end();
+    const bsl::size_t numEntries = d_entryList.size();
 
-    while (true) {
-        if (current == end) {
-            break;
+    for (bsl::size_t i = 0; i < numEntries; ++i) {
+        const SendQueueEntry& entry = d_entryList[i];
+        if (entry.d_removed) {
+            continue;
         }
 
-        const SendQueueEntry& entry = *current;
         if (!entry.batchNext(result, effectiveOptions)) {
             break;
         }
-
-        ++current;
     }
 
     if (result->numBuffers() == 0) {
@@ -311,5 +331,64 @@ bool SendQueue::batchNext(ntsa::ConstBufferArray*  result,
     return true;
 }
 
+bool SendQueue::batchNext(bsl::vector<ntsa::ConstMessage>* result,
+                          bsl::size_t                      maxMessages,
+                          const ntsa::SendOptions&         options) const
+{
+    result->clear();
+
+    if (d_entryList.size() < 2 || maxMessages < 2) {
+        return false;
+    }
+
+    ntsa::SendOptions effectiveOptions = options;
+    if (effectiveOptions.maxBuffers() == 0) {
+        effectiveOptions.setMaxBuffers(ntsu::SocketUtil::maxBuffersPerSend());
+    }
+
+    ntsa::ConstBufferArray bufferArray(d_allocator_p);
+
+    const bsl::size_t numEntries = d_entryList.size();
+
+    for (bsl::size_t i = 0; i < numEntries; ++i) {
+        if (result->size() == maxMessages) {
+            break;
+        }
+
+        const SendQueueEntry& entry = d_entryList[i];
+        if (entry.d_removed) {
+            continue;
+        }
+
+        bufferArray.clear();
+        if (!entry.batchNext(&bufferArray, effectiveOptions)) {
+            break;
+        }
+
+        if (bufferArray.numBuffers() == 0) {
+            break;
+        }
+
+        result->resize(result->size() + 1);
+
+        ntsa::ConstMessage& message = result->back();
+
+        for (bsl::size_t i = 0; i < bufferArray.numBuffers(); ++i) {
+            message.appendBuffer(bufferArray.buffer(i));
+        }
+
+        if (!entry.endpoint().isNull()) {
+            message.setEndpoint(entry.endpoint().value());
+        }
+    }
+
+    if (result->size() < 2) {
+        result->clear();
+        return false;
+    }
+
+    return true;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
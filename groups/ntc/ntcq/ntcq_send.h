@@ -27,20 +27,29 @@ BSLS_IDENT("$Id: $")
 #include <ntci_sender.h>
 #include <ntci_strand.h>
 #include <ntci_timer.h>
+#include <ntcq_ring.h>
 #include <ntcs_callbackstate.h>
 #include <ntcs_watermarkutil.h>
 #include <ntcscm_version.h>
 #include <ntsa_data.h>
 #include <ntsa_error.h>
+#include <ntsa_message.h>
 #include <ntsa_sendoptions.h>
 #include <bdlb_nullablevalue.h>
 #include <bdlcc_sharedobjectpool.h>
+#include <bslh_hash.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bsls_assert.h>
 #include <bsls_timeinterval.h>
 #include <bsls_timeutil.h>
+#include <bsl_algorithm.h>
 #include <bsl_functional.h>
-#include <bsl_list.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_unordered_multimap.h>
+#include <bsl_utility.h>
 #include <bsl_vector.h>
 
 namespace BloombergLP {
@@ -95,25 +104,88 @@ class SendState
 };
 
 /// @internal @brief
-/// Describe an entry on a send queue.
+/// Describe the attributes of an entry on a send queue that are only defined
+/// when data is sent with a token, endpoint, deadline, or callback.
 ///
 /// @par Thread Safety
 /// This class is not thread safe.
 ///
 /// @ingroup module_ntcq
-class SendQueueEntry
+class SendQueueEntryAttributes
 {
-    bsl::uint64_t                           d_id;
     bdlb::NullableValue<ntca::SendToken>    d_token;
     bdlb::NullableValue<ntsa::Endpoint>     d_endpoint;
-    bsl::shared_ptr<ntsa::Data>             d_data_sp;
-    bsl::size_t                             d_length;
-    bsl::int64_t                            d_timestamp;
     bdlb::NullableValue<bsls::TimeInterval> d_deadline;
     bsl::shared_ptr<ntci::Timer>            d_timer_sp;
     ntci::SendCallback                      d_callback;
-    bool                                    d_inProgress;
-    bool                                    d_zeroCopy;
+
+    friend class SendQueueEntry;
+
+  public:
+    /// Create new send queue entry attributes having the default value.
+    /// Optionally specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
+    explicit SendQueueEntryAttributes(bslma::Allocator* basicAllocator = 0);
+
+    /// Create new send queue entry attributes having the same value as the
+    /// specified 'original' object. Optionally specify a 'basicAllocator'
+    /// used to supply memory. If 'basicAllocator' is 0, the currently
+    /// installed default allocator is used.
+    SendQueueEntryAttributes(
+        const SendQueueEntryAttributes& original,
+        bslma::Allocator*               basicAllocator = 0);
+
+    /// Destroy this object.
+    ~SendQueueEntryAttributes();
+
+    /// Assign the value of the specified 'other' object to this object.
+    /// Return a reference to this modifiable object.
+    SendQueueEntryAttributes& operator=(const SendQueueEntryAttributes& other);
+
+    /// Reset the value of this object to its value upon default
+    /// construction.
+    void reset();
+
+    /// Return a reference to the non-modifiable attributes having the
+    /// default value, shared by every entry that does not define any
+    /// attributes.
+    static const SendQueueEntryAttributes& none();
+
+    /// Defines the traits of this type. These traits can be used to select,
+    /// at compile-time, the most efficient algorithm to manipulate objects
+    /// of this type.
+    NTCCFG_DECLARE_NESTED_USES_ALLOCATOR_TRAITS(SendQueueEntryAttributes);
+};
+
+/// @internal @brief
+/// Describe an entry on a send queue.
+///
+/// @details
+/// The representation of each entry is split into the attributes needed by
+/// every entry, i.e., the data, its length, and when it was enqueued, and
+/// the attributes only needed when data is sent with a token, endpoint,
+/// deadline, or callback. The latter are stored out-of-line and are only
+/// allocated when first defined, so that entries describing plain sends are
+/// compact and cheap to copy.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntcq
+class SendQueueEntry
+{
+    bsl::uint64_t                   d_id;
+    bsl::shared_ptr<ntsa::Data>     d_data_sp;
+    bsl::size_t                     d_length;
+    bsl::int64_t                    d_timestamp;
+    ntcq::SendQueueEntryAttributes* d_attributes_p;
+    bool                            d_inProgress;
+    bool                            d_zeroCopy;
+    bool                            d_removed;
+    bslma::Allocator*               d_allocator_p;
+
+    friend class SendQueue;
 
   private:
     /// If this entry is batchable, append a reference to this data of this
@@ -188,6 +260,14 @@ class SendQueueEntry
                    const bsl::string&       string,
                    const ntsa::SendOptions& options) const;
 
+    /// Return the modifiable out-of-line attributes of this entry, creating
+    /// them if they are not yet defined.
+    ntcq::SendQueueEntryAttributes* attributes();
+
+    /// Return the non-modifiable out-of-line attributes of this entry, or
+    /// the attributes having the default value if they are not defined.
+    const ntcq::SendQueueEntryAttributes& attributes() const;
+
   public:
     /// Create a new send queue entry. Optionally specify a 'basicAllocator'
     /// used to supply memory. If 'basicAllocator' is 0, the currently
@@ -204,6 +284,19 @@ class SendQueueEntry
     /// Destroy this object.
     ~SendQueueEntry();
 
+    /// Assign the value of the specified 'other' object to this object.
+    /// Return a reference to this modifiable object.
+    SendQueueEntry& operator=(const SendQueueEntry& other);
+
+    /// Reset the value of this object to its value upon default
+    /// construction.
+    void reset();
+
+    /// Efficiently exchange the value of this object with the value of the
+    /// specified 'other' object. The behavior is undefined unless this
+    /// object and 'other' use the same allocator.
+    void swap(SendQueueEntry& other);
+
     /// Set the identifier used to internally time-out the queue entry to
     /// the specified 'id'.
     void setId(bsl::uint64_t id);
@@ -314,20 +407,60 @@ class SendQueueEntry
     NTCCFG_DECLARE_NESTED_USES_ALLOCATOR_TRAITS(SendQueueEntry);
 };
 
+/// Exchange the values of the specified 'a' and 'b' objects. The behavior is
+/// undefined unless 'a' and 'b' use the same allocator.
+///
+/// @related ntcq::SendQueueEntry
+void swap(SendQueueEntry& a, SendQueueEntry& b);
+
 /// @internal @brief
 /// Provide a send queue.
 ///
+/// @details
+/// Entries are stored in a contiguous, growable ring, so that enqueuing and
+/// dequeuing an entry allocates no memory once the ring has grown to its
+/// working capacity. The out-of-line attributes of entries that define a
+/// token, endpoint, deadline, or callback are recycled through a pool owned
+/// by the queue.
+///
+/// Entries having a deadline are indexed by their identifier, and entries
+/// having a token are indexed by their token, so that an entry may be removed
+/// when its deadline expires or when it is canceled in constant time,
+/// regardless of the number of entries in the queue. An entry removed from
+/// the middle of the queue is marked as removed and left in place, to be
+/// discarded once it reaches the front of the queue; such entries are never
+/// observed by users of the queue.
+///
 /// @par Thread Safety
 /// This class is not thread safe.
 ///
 /// @ingroup module_ntcq
 class SendQueue
 {
-    /// This typedef defines a linked list of structures that describe
-    /// the write queue.
-    typedef bsl::list<SendQueueEntry> EntryList;
+    /// This typedef defines a ring of structures that describe the write
+    /// queue.
+    typedef ntcq::Ring<SendQueueEntry> EntryList;
+
+    /// This typedef defines a pool of out-of-line entry attributes available
+    /// for reuse.
+    typedef bsl::vector<ntcq::SendQueueEntryAttributes*> AttributesPool;
+
+    /// This typedef defines a map of the identifier of each entry having a
+    /// deadline to the sequence number of that entry in the ring.
+    typedef bsl::unordered_map<bsl::uint64_t, bsl::uint64_t> IdIndex;
+
+    /// This typedef defines a map of the token of each entry having a token
+    /// to the sequence number of that entry in the ring. Tokens are chosen
+    /// by the user and are not required to be unique, so a token may map to
+    /// the sequence numbers of several entries.
+    typedef bsl::
+        unordered_multimap<ntca::SendToken, bsl::uint64_t, bslh::Hash<> >
+            TokenIndex;
 
     EntryList                    d_entryList;
+    AttributesPool               d_attributesPool;
+    IdIndex                      d_idIndex;
+    TokenIndex                   d_tokenIndex;
     bsl::shared_ptr<bdlbb::Blob> d_data_sp;
     bsl::size_t                  d_size;
     bsl::size_t                  d_watermarkLow;
@@ -341,7 +474,44 @@ class SendQueue
     SendQueue(const SendQueue&) BSLS_KEYWORD_DELETED;
     SendQueue& operator=(const SendQueue&) BSLS_KEYWORD_DELETED;
 
+  private:
+    /// Assign the value of the specified 'source' entry to the specified
+    /// 'target' entry in the ring, taking its out-of-line attributes, if
+    /// necessary, from the pool.
+    void assignEntry(SendQueueEntry* target, const SendQueueEntry& source);
+
+    /// Reset the specified 'entry' in the ring, returning its out-of-line
+    /// attributes, if any, to the pool.
+    void releaseEntry(SendQueueEntry* entry);
+
+    /// Index the specified 'entry' having the specified 'sequenceNumber' in
+    /// the ring by its identifier, if it has a deadline, and by its token,
+    /// if it has a token.
+    void indexEntry(const SendQueueEntry& entry, bsl::uint64_t sequenceNumber);
+
+    /// Remove the specified 'entry' having the specified 'sequenceNumber' in
+    /// the ring from the indexes.
+    void unindexEntry(const SendQueueEntry& entry,
+                      bsl::uint64_t         sequenceNumber);
+
+    /// Remove the entry having the specified 'sequenceNumber' in the ring
+    /// and load its callback into the specified 'result', if the entry has
+    /// not already had any portion of its data copied to the socket send
+    /// buffer.
+    void removeEntry(ntci::SendCallback* result, bsl::uint64_t sequenceNumber);
+
+    /// Discard the entries marked as removed from the front and back of the
+    /// ring, so that the entry at the front of the ring, if any, has not
+    /// been removed.
+    void discardRemovedEntries();
+
   public:
+    enum {
+        /// The maximum number of out-of-line entry attributes retained in
+        /// the pool for reuse.
+        k_MAX_POOLED_ATTRIBUTES = 1024
+    };
+
     /// Create a new send to message queue. Optionally specify a
     /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
     /// the currently installed default allocator is used.
@@ -424,6 +594,18 @@ class SendQueue
     bool batchNext(ntsa::ConstBufferArray*  result,
                    const ntsa::SendOptions& options) const;
 
+    /// Batch together the next range of up to the specified 'maxMessages'
+    /// contiguous entries whose data may be attempted to be copied to the
+    /// socket send buffer all at once, each entry as a separate message.
+    /// Limit the number of buffers in each message according to the
+    /// specified 'options'. Load into the specified 'result' a message
+    /// describing the data and endpoint, if any, of each batched entry.
+    /// Return true if at least two entries are batched, and false
+    /// otherwise.
+    bool batchNext(bsl::vector<ntsa::ConstMessage>* result,
+                   bsl::size_t                      maxMessages,
+                   const ntsa::SendOptions&         options) const;
+
     /// Return the data stored in the queue.
     const bsl::shared_ptr<bdlbb::Blob>& data() const;
 
@@ -499,19 +681,91 @@ ntcq::SendCounter SendState::counter() const
     return d_counter;
 }
 
+NTCCFG_INLINE
+SendQueueEntryAttributes::SendQueueEntryAttributes(
+    bslma::Allocator* basicAllocator)
+: d_token()
+, d_endpoint()
+, d_deadline()
+, d_timer_sp()
+, d_callback(basicAllocator)
+{
+}
+
+NTCCFG_INLINE
+SendQueueEntryAttributes::SendQueueEntryAttributes(
+    const SendQueueEntryAttributes& original,
+    bslma::Allocator*               basicAllocator)
+: d_token(original.d_token)
+, d_endpoint(original.d_endpoint)
+, d_deadline(original.d_deadline)
+, d_timer_sp(original.d_timer_sp)
+, d_callback(original.d_callback, basicAllocator)
+{
+}
+
+NTCCFG_INLINE
+SendQueueEntryAttributes::~SendQueueEntryAttributes()
+{
+}
+
+NTCCFG_INLINE
+SendQueueEntryAttributes& SendQueueEntryAttributes::operator=(
+    const SendQueueEntryAttributes& other)
+{
+    if (this != &other) {
+        d_token    = other.d_token;
+        d_endpoint = other.d_endpoint;
+        d_deadline = other.d_deadline;
+        d_timer_sp = other.d_timer_sp;
+        d_callback = other.d_callback;
+    }
+
+    return *this;
+}
+
+NTCCFG_INLINE
+void SendQueueEntryAttributes::reset()
+{
+    d_token.reset();
+    d_endpoint.reset();
+    d_deadline.reset();
+    d_timer_sp.reset();
+    d_callback.reset();
+}
+
+NTCCFG_INLINE
+ntcq::SendQueueEntryAttributes* SendQueueEntry::attributes()
+{
+    if (NTCCFG_UNLIKELY(d_attributes_p == 0)) {
+        d_attributes_p = new (*d_allocator_p)
+            ntcq::SendQueueEntryAttributes(d_allocator_p);
+    }
+
+    return d_attributes_p;
+}
+
+NTCCFG_INLINE
+const ntcq::SendQueueEntryAttributes& SendQueueEntry::attributes() const
+{
+    if (NTCCFG_LIKELY(d_attributes_p == 0)) {
+        return ntcq::SendQueueEntryAttributes::none();
+    }
+
+    return *d_attributes_p;
+}
+
 NTCCFG_INLINE
 SendQueueEntry::SendQueueEntry(bslma::Allocator* basicAllocator)
 : d_id(0)
-, d_token()
-, d_endpoint()
 , d_data_sp()
 , d_length(0)
 , d_timestamp(0)
-, d_deadline()
-, d_timer_sp()
-, d_callback(basicAllocator)
+, d_attributes_p(0)
 , d_inProgress(false)
 , d_zeroCopy(false)
+, d_removed(false)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
 
@@ -519,22 +773,83 @@ NTCCFG_INLINE
 SendQueueEntry::SendQueueEntry(const SendQueueEntry& original,
                                bslma::Allocator*     basicAllocator)
 : d_id(original.d_id)
-, d_token(original.d_token)
-, d_endpoint(original.d_endpoint)
 , d_data_sp(original.d_data_sp)
 , d_length(original.d_length)
 , d_timestamp(original.d_timestamp)
-, d_deadline(original.d_deadline)
-, d_timer_sp(original.d_timer_sp)
-, d_callback(original.d_callback, basicAllocator)
+, d_attributes_p(0)
 , d_inProgress(original.d_inProgress)
 , d_zeroCopy(original.d_zeroCopy)
+, d_removed(original.d_removed)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
+    if (original.d_attributes_p != 0) {
+        d_attributes_p = new (*d_allocator_p)
+            ntcq::SendQueueEntryAttributes(*original.d_attributes_p,
+                                           d_allocator_p);
+    }
 }
 
 NTCCFG_INLINE
 SendQueueEntry::~SendQueueEntry()
 {
+    if (d_attributes_p != 0) {
+        d_allocator_p->deleteObject(d_attributes_p);
+    }
+}
+
+NTCCFG_INLINE
+SendQueueEntry& SendQueueEntry::operator=(const SendQueueEntry& other)
+{
+    if (this != &other) {
+        d_id         = other.d_id;
+        d_data_sp    = other.d_data_sp;
+        d_length     = other.d_length;
+        d_timestamp  = other.d_timestamp;
+        d_inProgress = other.d_inProgress;
+        d_zeroCopy   = other.d_zeroCopy;
+        d_removed    = other.d_removed;
+
+        if (other.d_attributes_p != 0) {
+            *this->attributes() = *other.d_attributes_p;
+        }
+        else if (d_attributes_p != 0) {
+            d_attributes_p->reset();
+        }
+    }
+
+    return *this;
+}
+
+NTCCFG_INLINE
+void SendQueueEntry::reset()
+{
+    d_id = 0;
+    d_data_sp.reset();
+    d_length     = 0;
+    d_timestamp  = 0;
+    d_inProgress = false;
+    d_zeroCopy   = false;
+    d_removed    = false;
+
+    if (d_attributes_p != 0) {
+        d_allocator_p->deleteObject(d_attributes_p);
+        d_attributes_p = 0;
+    }
+}
+
+NTCCFG_INLINE
+void SendQueueEntry::swap(SendQueueEntry& other)
+{
+    BSLS_ASSERT(d_allocator_p == other.d_allocator_p);
+
+    bsl::swap(d_id, other.d_id);
+    d_data_sp.swap(other.d_data_sp);
+    bsl::swap(d_length, other.d_length);
+    bsl::swap(d_timestamp, other.d_timestamp);
+    bsl::swap(d_attributes_p, other.d_attributes_p);
+    bsl::swap(d_inProgress, other.d_inProgress);
+    bsl::swap(d_zeroCopy, other.d_zeroCopy);
+    bsl::swap(d_removed, other.d_removed);
 }
 
 NTCCFG_INLINE
@@ -546,27 +861,37 @@ void SendQueueEntry::setId(bsl::uint64_t id)
 NTCCFG_INLINE
 void SendQueueEntry::setToken(const ntca::SendToken& token)
 {
-    d_token = token;
+    this->attributes()->d_token = token;
 }
 
 NTCCFG_INLINE
 void SendQueueEntry::setToken(
     const bdlb::NullableValue<ntca::SendToken>& token)
 {
-    d_token = token;
+    if (!token.isNull()) {
+        this->attributes()->d_token = token;
+    }
+    else if (d_attributes_p != 0) {
+        d_attributes_p->d_token.reset();
+    }
 }
 
 NTCCFG_INLINE
 void SendQueueEntry::setEndpoint(const ntsa::Endpoint& endpoint)
 {
-    d_endpoint = endpoint;
+    this->attributes()->d_endpoint = endpoint;
 }
 
 NTCCFG_INLINE
 void SendQueueEntry::setEndpoint(
     const bdlb::NullableValue<ntsa::Endpoint>& endpoint)
 {
-    d_endpoint = endpoint;
+    if (!endpoint.isNull()) {
+        this->attributes()->d_endpoint = endpoint;
+    }
+    else if (d_attributes_p != 0) {
+        d_attributes_p->d_endpoint.reset();
+    }
 }
 
 NTCCFG_INLINE
@@ -590,32 +915,49 @@ void SendQueueEntry::setTimestamp(bsl::int64_t timestamp)
 NTCCFG_INLINE
 void SendQueueEntry::setDeadline(const bsls::TimeInterval& value)
 {
-    d_deadline = value;
+    this->attributes()->d_deadline = value;
 }
 
 NTCCFG_INLINE
 void SendQueueEntry::setDeadline(
     const bdlb::NullableValue<bsls::TimeInterval>& value)
 {
-    d_deadline = value;
+    if (!value.isNull()) {
+        this->attributes()->d_deadline = value;
+    }
+    else if (d_attributes_p != 0) {
+        d_attributes_p->d_deadline.reset();
+    }
 }
 
 NTCCFG_INLINE
 void SendQueueEntry::setTimer(const bsl::shared_ptr<ntci::Timer>& timer)
 {
-    d_timer_sp = timer;
+    if (timer) {
+        this->attributes()->d_timer_sp = timer;
+    }
+    else if (d_attributes_p != 0) {
+        d_attributes_p->d_timer_sp.reset();
+    }
 }
 
 NTCCFG_INLINE
 void SendQueueEntry::setCallback(const ntci::SendCallback& callback)
 {
-    d_callback = callback;
+    if (callback) {
+        this->attributes()->d_callback = callback;
+    }
+    else if (d_attributes_p != 0) {
+        d_attributes_p->d_callback.reset();
+    }
 }
 
 NTCCFG_INLINE
 void SendQueueEntry::setCallback(bsl::nullptr_t)
 {
-    d_callback.reset();
+    if (d_attributes_p != 0) {
+        d_attributes_p->d_callback.reset();
+    }
 }
 
 NTCCFG_INLINE
@@ -633,9 +975,9 @@ void SendQueueEntry::setZeroCopy(bool zeroCopy)
 NTCCFG_INLINE
 void SendQueueEntry::closeTimer()
 {
-    if (d_timer_sp) {
-        d_timer_sp->close();
-        d_timer_sp.reset();
+    if (d_attributes_p != 0 && d_attributes_p->d_timer_sp) {
+        d_attributes_p->d_timer_sp->close();
+        d_attributes_p->d_timer_sp.reset();
     }
 }
 
@@ -648,13 +990,13 @@ bsl::uint64_t SendQueueEntry::id() const
 NTCCFG_INLINE
 const bdlb::NullableValue<ntca::SendToken>& SendQueueEntry::token() const
 {
-    return d_token;
+    return this->attributes().d_token;
 }
 
 NTCCFG_INLINE
 const bdlb::NullableValue<ntsa::Endpoint>& SendQueueEntry::endpoint() const
 {
-    return d_endpoint;
+    return this->attributes().d_endpoint;
 }
 
 NTCCFG_INLINE
@@ -678,7 +1020,7 @@ bsl::int64_t SendQueueEntry::timestamp() const
 NTCCFG_INLINE
 const bdlb::NullableValue<bsls::TimeInterval>& SendQueueEntry::deadline() const
 {
-    return d_deadline;
+    return this->attributes().d_deadline;
 }
 
 NTCCFG_INLINE
@@ -699,7 +1041,7 @@ bsls::TimeInterval SendQueueEntry::delay() const
 NTCCFG_INLINE
 const ntci::SendCallback& SendQueueEntry::callback() const
 {
-    return d_callback;
+    return this->attributes().d_callback;
 }
 
 NTCCFG_INLINE
@@ -728,6 +1070,151 @@ bool SendQueueEntry::isBatchable() const
     return true;
 }
 
+NTCCFG_INLINE
+void swap(SendQueueEntry& a, SendQueueEntry& b)
+{
+    a.swap(b);
+}
+
+NTCCFG_INLINE
+void SendQueue::assignEntry(SendQueueEntry*       target,
+                            const SendQueueEntry& source)
+{
+    BSLS_ASSERT(target->d_attributes_p == 0);
+
+    target->d_id         = source.d_id;
+    target->d_data_sp    = source.d_data_sp;
+    target->d_length     = source.d_length;
+    target->d_timestamp  = source.d_timestamp;
+    target->d_inProgress = source.d_inProgress;
+    target->d_zeroCopy   = source.d_zeroCopy;
+    target->d_removed    = false;
+
+    if (NTCCFG_UNLIKELY(source.d_attributes_p != 0)) {
+        if (!d_attributesPool.empty()) {
+            target->d_attributes_p = d_attributesPool.back();
+            d_attributesPool.pop_back();
+        }
+        else {
+            target->d_attributes_p = new (*d_allocator_p)
+                ntcq::SendQueueEntryAttributes(d_allocator_p);
+        }
+
+        *target->d_attributes_p = *source.d_attributes_p;
+    }
+}
+
+NTCCFG_INLINE
+void SendQueue::releaseEntry(SendQueueEntry* entry)
+{
+    if (NTCCFG_UNLIKELY(entry->d_attributes_p != 0)) {
+        ntcq::SendQueueEntryAttributes* attributes = entry->d_attributes_p;
+        entry->d_attributes_p                      = 0;
+
+        attributes->reset();
+
+        if (d_attributesPool.size() <
+            static_cast<bsl::size_t>(k_MAX_POOLED_ATTRIBUTES))
+        {
+            d_attributesPool.push_back(attributes);
+        }
+        else {
+            d_allocator_p->deleteObject(attributes);
+        }
+    }
+
+    entry->reset();
+}
+
+NTCCFG_INLINE
+void SendQueue::indexEntry(const SendQueueEntry& entry,
+                           bsl::uint64_t         sequenceNumber)
+{
+    if (!entry.deadline().isNull()) {
+        d_idIndex.insert(IdIndex::value_type(entry.id(), sequenceNumber));
+    }
+
+    if (!entry.token().isNull()) {
+        d_tokenIndex.insert(
+            TokenIndex::value_type(entry.token().value(), sequenceNumber));
+    }
+}
+
+NTCCFG_INLINE
+void SendQueue::unindexEntry(const SendQueueEntry& entry,
+                             bsl::uint64_t         sequenceNumber)
+{
+    if (!d_idIndex.empty()) {
+        IdIndex::iterator it = d_idIndex.find(entry.id());
+        if (it != d_idIndex.end() && it->second == sequenceNumber) {
+            d_idIndex.erase(it);
+        }
+    }
+
+    if (!d_tokenIndex.empty() && !entry.token().isNull()) {
+        bsl::pair<TokenIndex::iterator, TokenIndex::iterator> range =
+            d_tokenIndex.equal_range(entry.token().value());
+        for (TokenIndex::iterator it = range.first; it != range.second; ++it)
+        {
+            if (it->second == sequenceNumber) {
+                d_tokenIndex.erase(it);
+                break;
+            }
+        }
+    }
+}
+
+NTCCFG_INLINE
+void SendQueue::removeEntry(ntci::SendCallback* result,
+                            bsl::uint64_t       sequenceNumber)
+{
+    bsl::size_t index = 0;
+    if (!d_entryList.locate(&index, sequenceNumber)) {
+        return;
+    }
+
+    ntcq::SendQueueEntry& entry = d_entryList[index];
+    BSLS_ASSERT(!entry.d_removed);
+
+    if (entry.inProgress()) {
+        return;
+    }
+
+    if (entry.data()) {
+        BSLS_ASSERT(entry.length() > 0);
+        BSLS_ASSERT(entry.length() == entry.data()->size());
+        BSLS_ASSERT(d_size >= entry.length());
+        d_size -= entry.length();
+    }
+
+    entry.closeTimer();
+
+    if (entry.callback()) {
+        *result = entry.callback();
+    }
+
+    this->unindexEntry(entry, sequenceNumber);
+    this->releaseEntry(&entry);
+
+    entry.d_removed = true;
+
+    this->discardRemovedEntries();
+}
+
+NTCCFG_INLINE
+void SendQueue::discardRemovedEntries()
+{
+    while (!d_entryList.empty() && d_entryList.front().d_removed) {
+        d_entryList.front().d_removed = false;
+        d_entryList.popFront();
+    }
+
+    while (!d_entryList.empty() && d_entryList.back().d_removed) {
+        d_entryList.back().d_removed = false;
+        d_entryList.popBack();
+    }
+}
+
 NTCCFG_INLINE
 bsl::uint64_t SendQueue::generateEntryId()
 {
@@ -737,7 +1224,13 @@ bsl::uint64_t SendQueue::generateEntryId()
 NTCCFG_INLINE
 bool SendQueue::pushEntry(const SendQueueEntry& entry)
 {
-    d_entryList.push_back(entry);
+    const bsl::uint64_t sequenceNumber = d_entryList.nextSequenceNumber();
+
+    this->assignEntry(&d_entryList.pushBack(), entry);
+
+    if (NTCCFG_UNLIKELY(entry.d_attributes_p != 0)) {
+        this->indexEntry(entry, sequenceNumber);
+    }
 
     if (entry.data()) {
         BSLS_ASSERT(entry.length() > 0);
@@ -752,6 +1245,7 @@ bool SendQueue::pushEntry(const SendQueueEntry& entry)
 NTCCFG_INLINE
 SendQueueEntry& SendQueue::frontEntry()
 {
+    BSLS_ASSERT(!d_entryList.front().d_removed);
     return d_entryList.front();
 }
 
@@ -760,6 +1254,7 @@ bool SendQueue::popEntry()
 {
     {
         SendQueueEntry& entry = d_entryList.front();
+        BSLS_ASSERT(!entry.d_removed);
 
         entry.closeTimer();
 
@@ -769,9 +1264,17 @@ bool SendQueue::popEntry()
             BSLS_ASSERT(d_size >= entry.length());
             d_size -= entry.length();
         }
+
+        if (NTCCFG_UNLIKELY(entry.d_attributes_p != 0)) {
+            this->unindexEntry(entry, d_entryList.sequenceNumber(0));
+        }
+
+        this->releaseEntry(&entry);
     }
 
-    d_entryList.pop_front();
+    d_entryList.popFront();
+    this->discardRemovedEntries();
+
     return d_entryList.empty();
 }
 
@@ -804,32 +1307,9 @@ bool SendQueue::removeEntryId(ntci::SendCallback* result, bsl::uint64_t id)
 {
     result->reset();
 
-    for (EntryList::iterator it = d_entryList.begin(); it != d_entryList.end();
-         ++it)
-    {
-        ntcq::SendQueueEntry& entry = *it;
-
-        if (entry.id() == id) {
-            if (!entry.deadline().isNull()) {
-                if (!entry.inProgress()) {
-                    if (entry.data()) {
-                        BSLS_ASSERT(entry.length() > 0);
-                        BSLS_ASSERT(entry.length() == entry.data()->size());
-                        BSLS_ASSERT(d_size >= entry.length());
-                        d_size -= entry.length();
-                    }
-
-                    entry.closeTimer();
-
-                    if (entry.callback()) {
-                        *result = entry.callback();
-                    }
-
-                    d_entryList.erase(it);
-                }
-            }
-            break;
-        }
+    IdIndex::const_iterator it = d_idIndex.find(id);
+    if (it != d_idIndex.end()) {
+        this->removeEntry(result, it->second);
     }
 
     return d_entryList.empty();
@@ -841,32 +1321,21 @@ bool SendQueue::removeEntryToken(ntci::SendCallback*    result,
 {
     result->reset();
 
-    for (EntryList::iterator it = d_entryList.begin(); it != d_entryList.end();
-         ++it)
-    {
-        ntcq::SendQueueEntry& entry = *it;
-
-        if (!entry.token().isNull()) {
-            if (entry.token().value() == token) {
-                if (!entry.inProgress()) {
-                    if (entry.data()) {
-                        BSLS_ASSERT(entry.length() > 0);
-                        BSLS_ASSERT(entry.length() == entry.data()->size());
-                        BSLS_ASSERT(d_size >= entry.length());
-                        d_size -= entry.length();
-                    }
-
-                    entry.closeTimer();
-
-                    if (entry.callback()) {
-                        *result = entry.callback();
-                    }
-
-                    d_entryList.erase(it);
-                }
-                break;
+    // Remove the oldest entry having the token, if any.
+
+    bsl::pair<TokenIndex::const_iterator, TokenIndex::const_iterator> range =
+        d_tokenIndex.equal_range(token);
+    if (range.first != range.second) {
+        bsl::uint64_t sequenceNumber = range.first->second;
+        for (TokenIndex::const_iterator it = range.first; it != range.second;
+             ++it)
+        {
+            if (it->second < sequenceNumber) {
+                sequenceNumber = it->second;
             }
         }
+
+        this->removeEntry(result, sequenceNumber);
     }
 
     return d_entryList.empty();
@@ -877,19 +1346,25 @@ bool SendQueue::removeAll(bsl::vector<ntci::SendCallback>* result)
 {
     bool nonEmpty = !d_entryList.empty();
 
-    for (EntryList::iterator it = d_entryList.begin(); it != d_entryList.end();
-         ++it)
-    {
-        ntcq::SendQueueEntry& entry = *it;
+    const bsl::size_t numEntries = d_entryList.size();
 
-        entry.closeTimer();
+    for (bsl::size_t i = 0; i < numEntries; ++i) {
+        ntcq::SendQueueEntry& entry = d_entryList[i];
 
-        if (entry.callback()) {
-            result->push_back(entry.callback());
+        if (!entry.d_removed) {
+            entry.closeTimer();
+
+            if (entry.callback()) {
+                result->push_back(entry.callback());
+            }
         }
+
+        this->releaseEntry(&entry);
     }
 
     d_entryList.clear();
+    d_idIndex.clear();
+    d_tokenIndex.clear();
     d_size = 0;
 
     return nonEmpty;
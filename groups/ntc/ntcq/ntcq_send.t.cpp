@@ -19,6 +19,8 @@
 #include <ntccfg_test.h>
 #include <ntci_mutex.h>
 #include <ntsa_data.h>
+#include <ntsa_endpoint.h>
+#include <ntsa_message.h>
 #include <ntsa_temporary.h>
 #include <ntsd_datautil.h>
 #include <bdlbb_blob.h>
@@ -29,7 +31,9 @@
 #include <bdlf_placeholder.h>
 #include <bslma_allocator.h>
 #include <bslma_default.h>
+#include <bslma_testallocator.h>
 #include <bsls_assert.h>
+#include <bsls_timeutil.h>
 
 using namespace BloombergLP;
 
@@ -44,6 +48,10 @@ using namespace BloombergLP;
 // [ 1]
 //-----------------------------------------------------------------------------
 // [ 1]
+// [ 8] Pushing and popping entries does not allocate in the steady state.
+// [ 9] Throughput of pushing and popping entries.
+// [10] Entries removed by token or identifier are skipped when batching.
+// [11] Entries are removed from a large backlog in constant time.
 //-----------------------------------------------------------------------------
 
 namespace test {
@@ -633,6 +641,547 @@ NTCCFG_TEST_CASE(6)
     NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+NTCCFG_TEST_CASE(7)
+{
+    // Concern: Batching next suitable entries as separate messages: limit
+    // the number of messages to the maximum number sendable per system call
+    // and stop at the first entry that is not batchable.
+
+    ntccfg::TestAllocator ta;
+    {
+        const bsl::size_t k_BLOB_BUFFER_SIZE = 32;
+        const bsl::size_t k_MESSAGE_SIZE     = 100;
+        const bsl::size_t k_NUM_MESSAGES     = 3;
+
+        bdlbb::SimpleBlobBufferFactory blobBufferFactory(k_BLOB_BUFFER_SIZE,
+                                                         &ta);
+
+        ntcq::SendQueue sendQueue(&ta);
+
+        bsl::vector<ntsa::Endpoint> endpointVector(&ta);
+        endpointVector.push_back(ntsa::Endpoint("127.0.0.1:10001"));
+        endpointVector.push_back(ntsa::Endpoint("127.0.0.1:10002"));
+        endpointVector.push_back(ntsa::Endpoint("127.0.0.1:10003"));
+
+        for (bsl::size_t i = 0; i < k_NUM_MESSAGES; ++i) {
+            bdlbb::Blob blob(&blobBufferFactory, &ta);
+            ntsd::DataUtil::generateData(&blob, k_MESSAGE_SIZE * (i + 1));
+
+            bsl::shared_ptr<ntsa::Data> data;
+            data.createInplace(&ta, blob, &blobBufferFactory, &ta);
+
+            ntcq::SendQueueEntry sendQueueEntry;
+            sendQueueEntry.setId(sendQueue.generateEntryId());
+            sendQueueEntry.setEndpoint(endpointVector[i]);
+            sendQueueEntry.setData(data);
+            sendQueueEntry.setLength(data->size());
+
+            sendQueue.pushEntry(sendQueueEntry);
+        }
+
+        {
+            ntcq::SendQueueEntry sendQueueEntry;
+            sendQueueEntry.setId(sendQueue.generateEntryId());
+
+            sendQueue.pushEntry(sendQueueEntry);
+        }
+
+        bsl::vector<ntsa::ConstMessage> messageVector(&ta);
+
+        bool result =
+            sendQueue.batchNext(&messageVector, 2, ntsa::SendOptions());
+        NTCCFG_TEST_TRUE(result);
+        NTCCFG_TEST_EQ(messageVector.size(), 2);
+
+        result = sendQueue.batchNext(&messageVector,
+                                     k_NUM_MESSAGES + 1,
+                                     ntsa::SendOptions());
+        NTCCFG_TEST_TRUE(result);
+        NTCCFG_TEST_EQ(messageVector.size(), k_NUM_MESSAGES);
+
+        for (bsl::size_t i = 0; i < k_NUM_MESSAGES; ++i) {
+            NTCCFG_TEST_EQ(messageVector[i].endpoint(), endpointVector[i]);
+            NTCCFG_TEST_EQ(messageVector[i].size(), k_MESSAGE_SIZE * (i + 1));
+        }
+
+        result = sendQueue.batchNext(&messageVector, 1, ntsa::SendOptions());
+        NTCCFG_TEST_FALSE(result);
+        NTCCFG_TEST_TRUE(messageVector.empty());
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(8)
+{
+    // Concern: Pushing and popping entries, with and without out-of-line
+    // attributes, does not allocate memory once the queue has grown to its
+    // working capacity.
+
+    ntccfg::TestAllocator ta;
+    {
+        const bsl::size_t k_BLOB_BUFFER_SIZE = 32;
+        const bsl::size_t k_MESSAGE_SIZE     = 100;
+        const bsl::size_t k_DEPTH            = 256;
+        const bsl::size_t k_NUM_ROUNDS       = 16;
+
+        bdlbb::SimpleBlobBufferFactory blobBufferFactory(k_BLOB_BUFFER_SIZE,
+                                                         &ta);
+
+        bdlbb::Blob blob(&blobBufferFactory, &ta);
+        ntsd::DataUtil::generateData(&blob, k_MESSAGE_SIZE);
+
+        bsl::shared_ptr<ntsa::Data> data;
+        data.createInplace(&ta, blob, &blobBufferFactory, &ta);
+
+        bslma::TestAllocator queueAllocator("queue");
+
+        {
+            ntcq::SendQueue sendQueue(&queueAllocator);
+
+            bsls::Types::Int64 numAllocations = 0;
+
+            for (bsl::size_t round = 0; round < k_NUM_ROUNDS; ++round) {
+                for (bsl::size_t i = 0; i < k_DEPTH; ++i) {
+                    ntcq::SendQueueEntry entry(&ta);
+                    entry.setId(sendQueue.generateEntryId());
+                    entry.setData(data);
+                    entry.setLength(data->size());
+
+                    sendQueue.pushEntry(entry);
+                }
+
+                for (bsl::size_t i = 0; i < k_DEPTH; ++i) {
+                    sendQueue.popEntry();
+                }
+
+                if (round == 0) {
+                    numAllocations = queueAllocator.numAllocations();
+                }
+                else {
+                    NTCCFG_TEST_EQ(queueAllocator.numAllocations(),
+                                   numAllocations);
+                }
+            }
+
+            // Entries having tokens and deadlines take their attributes from
+            // the pool once it has been populated.
+
+            for (bsl::size_t round = 0; round < k_NUM_ROUNDS; ++round) {
+                bsl::size_t numPushed = 0;
+                for (bsl::size_t i = 0; i < k_DEPTH; ++i) {
+                    ntcq::SendQueueEntry entry(&ta);
+                    entry.setId(sendQueue.generateEntryId());
+                    entry.setData(data);
+                    entry.setLength(data->size());
+
+                    if (i % 4 == 0) {
+                        ntca::SendToken token;
+                        token.setValue(i);
+
+                        entry.setToken(token);
+                        entry.setDeadline(bsls::TimeInterval(1000, 0));
+                    }
+
+                    sendQueue.pushEntry(entry);
+                    ++numPushed;
+                }
+
+                for (bsl::size_t i = 0; i < numPushed; ++i) {
+                    ntcq::SendQueueEntry& entry = sendQueue.frontEntry();
+                    if (i % 4 == 0) {
+                        NTCCFG_TEST_FALSE(entry.token().isNull());
+                        NTCCFG_TEST_EQ(entry.token().value().value(), i);
+                        NTCCFG_TEST_FALSE(entry.deadline().isNull());
+                    }
+                    else {
+                        NTCCFG_TEST_TRUE(entry.token().isNull());
+                        NTCCFG_TEST_TRUE(entry.deadline().isNull());
+                    }
+
+                    sendQueue.popEntry();
+                }
+
+                if (round == 0) {
+                    numAllocations = queueAllocator.numAllocations();
+                }
+                else {
+                    NTCCFG_TEST_EQ(queueAllocator.numAllocations(),
+                                   numAllocations);
+                }
+            }
+
+            NTCCFG_TEST_FALSE(sendQueue.hasEntry());
+        }
+
+        NTCCFG_TEST_EQ(queueAllocator.numBlocksInUse(), 0);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(9)
+{
+    // Concern: Throughput of pushing and popping entries.
+
+    ntccfg::TestAllocator ta;
+    {
+        const bsl::size_t k_BLOB_BUFFER_SIZE = 32;
+        const bsl::size_t k_MESSAGE_SIZE     = 100;
+        const bsl::size_t k_DEPTH            = 64;
+        const bsl::size_t k_NUM_ROUNDS       = 10000;
+
+        bdlbb::SimpleBlobBufferFactory blobBufferFactory(k_BLOB_BUFFER_SIZE,
+                                                         &ta);
+
+        bdlbb::Blob blob(&blobBufferFactory, &ta);
+        ntsd::DataUtil::generateData(&blob, k_MESSAGE_SIZE);
+
+        bsl::shared_ptr<ntsa::Data> data;
+        data.createInplace(&ta, blob, &blobBufferFactory, &ta);
+
+        ntcq::SendQueue sendQueue(&ta);
+
+        ntcq::SendQueueEntry entry(&ta);
+        entry.setData(data);
+        entry.setLength(data->size());
+
+        const bsls::Types::Int64 t0 = bsls::TimeUtil::getTimer();
+
+        for (bsl::size_t round = 0; round < k_NUM_ROUNDS; ++round) {
+            for (bsl::size_t i = 0; i < k_DEPTH; ++i) {
+                entry.setId(sendQueue.generateEntryId());
+                sendQueue.pushEntry(entry);
+            }
+
+            for (bsl::size_t i = 0; i < k_DEPTH; ++i) {
+                sendQueue.popEntry();
+            }
+        }
+
+        const bsls::Types::Int64 t1 = bsls::TimeUtil::getTimer();
+
+        NTCCFG_TEST_FALSE(sendQueue.hasEntry());
+        NTCCFG_TEST_EQ(sendQueue.size(), 0);
+
+        const double numEntries =
+            static_cast<double>(k_DEPTH) * static_cast<double>(k_NUM_ROUNDS);
+        const double elapsed = static_cast<double>(t1 - t0);
+
+        NTCCFG_TEST_LOG_DEBUG << "Pushed and popped " << numEntries
+                              << " entries in " << elapsed / 1e6
+                              << " ms: " << elapsed / numEntries
+                              << " ns/entry" << NTCCFG_TEST_LOG_END;
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(10)
+{
+    // Concern: Entries removed by token or identifier from the middle of the
+    // queue are skipped when batching and popping entries.
+
+    ntccfg::TestAllocator ta;
+    {
+        const bsl::size_t k_BLOB_BUFFER_SIZE = 32;
+        const bsl::size_t k_MESSAGE_SIZE     = 100;
+        const bsl::size_t k_MAX_BUFFERS      = 1024;
+        const bsl::size_t k_NUM_MESSAGES     = 5;
+
+        bdlbb::SimpleBlobBufferFactory blobBufferFactory(k_BLOB_BUFFER_SIZE,
+                                                         &ta);
+
+        ntcq::SendQueue sendQueue(&ta);
+
+        bsl::vector<bsl::uint64_t> idVector(&ta);
+        bsl::vector<bdlbb::Blob>   blobVector(&ta);
+
+        for (bsl::size_t i = 0; i < k_NUM_MESSAGES; ++i) {
+            bdlbb::Blob blob(&blobBufferFactory, &ta);
+            ntsd::DataUtil::generateData(&blob, k_MESSAGE_SIZE, 0, i);
+            blobVector.push_back(blob);
+
+            bsl::shared_ptr<ntsa::Data> data;
+            data.createInplace(&ta, blob, &blobBufferFactory, &ta);
+
+            ntca::SendToken token;
+            token.setValue(i);
+
+            ntcq::SendQueueEntry sendQueueEntry(&ta);
+            sendQueueEntry.setId(sendQueue.generateEntryId());
+            sendQueueEntry.setToken(token);
+            sendQueueEntry.setDeadline(bsls::TimeInterval(1000, 0));
+            sendQueueEntry.setData(data);
+            sendQueueEntry.setLength(data->size());
+
+            idVector.push_back(sendQueueEntry.id());
+
+            sendQueue.pushEntry(sendQueueEntry);
+        }
+
+        ntci::SendCallback callback;
+        bool               empty;
+
+        // Remove the second entry by token and the fourth entry by
+        // identifier.
+
+        ntca::SendToken token;
+        token.setValue(1);
+
+        empty = sendQueue.removeEntryToken(&callback, token);
+        NTCCFG_TEST_FALSE(empty);
+
+        empty = sendQueue.removeEntryId(&callback, idVector[3]);
+        NTCCFG_TEST_FALSE(empty);
+
+        // Removing an entry that has already been removed has no effect.
+
+        empty = sendQueue.removeEntryToken(&callback, token);
+        NTCCFG_TEST_FALSE(empty);
+
+        empty = sendQueue.removeEntryId(&callback, idVector[3]);
+        NTCCFG_TEST_FALSE(empty);
+
+        NTCCFG_TEST_EQ(sendQueue.size(), k_MESSAGE_SIZE * 3);
+
+        ntsa::Data batch(&ta);
+        batch.makeConstBufferArray();
+
+        ntsa::SendOptions sendOptions;
+        sendOptions.setMaxBuffers(k_MAX_BUFFERS);
+
+        bool result =
+            sendQueue.batchNext(&batch.constBufferArray(), sendOptions);
+        NTCCFG_TEST_TRUE(result);
+
+        ntsa::Data batchExpected(&blobBufferFactory, &ta);
+        batchExpected.makeBlob();
+
+        bdlbb::BlobUtil::append(&batchExpected.blob(), blobVector[0]);
+        bdlbb::BlobUtil::append(&batchExpected.blob(), blobVector[2]);
+        bdlbb::BlobUtil::append(&batchExpected.blob(), blobVector[4]);
+
+        NTCCFG_TEST_TRUE(ntsa::DataUtil::equals(batch, batchExpected));
+
+        // Remove the entry at the front of the queue by token, then pop the
+        // remaining entries.
+
+        token.setValue(0);
+
+        empty = sendQueue.removeEntryToken(&callback, token);
+        NTCCFG_TEST_FALSE(empty);
+
+        NTCCFG_TEST_EQ(sendQueue.frontEntry().id(), idVector[2]);
+
+        empty = sendQueue.popEntry();
+        NTCCFG_TEST_FALSE(empty);
+
+        NTCCFG_TEST_EQ(sendQueue.frontEntry().id(), idVector[4]);
+
+        empty = sendQueue.popEntry();
+        NTCCFG_TEST_TRUE(empty);
+
+        NTCCFG_TEST_FALSE(sendQueue.hasEntry());
+        NTCCFG_TEST_EQ(sendQueue.size(), 0);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(11)
+{
+    // Concern: Entries are removed from a large backlog in constant time.
+
+    ntccfg::TestAllocator ta;
+    {
+        const bsl::size_t k_BLOB_BUFFER_SIZE = 32;
+        const bsl::size_t k_MESSAGE_SIZE     = 100;
+        const bsl::size_t k_NUM_ENTRIES      = 100000;
+
+        bdlbb::SimpleBlobBufferFactory blobBufferFactory(k_BLOB_BUFFER_SIZE,
+                                                         &ta);
+
+        bdlbb::Blob blob(&blobBufferFactory, &ta);
+        ntsd::DataUtil::generateData(&blob, k_MESSAGE_SIZE);
+
+        bsl::shared_ptr<ntsa::Data> data;
+        data.createInplace(&ta, blob, &blobBufferFactory, &ta);
+
+        ntcq::SendQueue sendQueue(&ta);
+
+        bsl::vector<bsl::uint64_t> idVector(&ta);
+        idVector.reserve(k_NUM_ENTRIES);
+
+        for (bsl::size_t i = 0; i < k_NUM_ENTRIES; ++i) {
+            ntca::SendToken token;
+            token.setValue(i);
+
+            ntcq::SendQueueEntry entry(&ta);
+            entry.setId(sendQueue.generateEntryId());
+            entry.setToken(token);
+            entry.setDeadline(bsls::TimeInterval(1000, 0));
+            entry.setData(data);
+            entry.setLength(data->size());
+
+            idVector.push_back(entry.id());
+
+            sendQueue.pushEntry(entry);
+        }
+
+        NTCCFG_TEST_EQ(sendQueue.size(), k_NUM_ENTRIES * k_MESSAGE_SIZE);
+
+        ntci::SendCallback callback;
+
+        // Cancel every odd entry by token, starting from the back of the
+        // queue, which is the worst case for a linear search.
+
+        const bsls::Types::Int64 t0 = bsls::TimeUtil::getTimer();
+
+        for (bsl::size_t i = k_NUM_ENTRIES; i > 0; --i) {
+            if ((i - 1) % 2 == 1) {
+                ntca::SendToken token;
+                token.setValue(i - 1);
+
+                bool empty = sendQueue.removeEntryToken(&callback, token);
+                NTCCFG_TEST_FALSE(empty);
+            }
+        }
+
+        const bsls::Types::Int64 t1 = bsls::TimeUtil::getTimer();
+
+        NTCCFG_TEST_EQ(sendQueue.size(), k_NUM_ENTRIES * k_MESSAGE_SIZE / 2);
+
+        // Expire the deadline of every fourth entry by identifier.
+
+        for (bsl::size_t i = 0; i < k_NUM_ENTRIES; i += 4) {
+            bool empty = sendQueue.removeEntryId(&callback, idVector[i]);
+            NTCCFG_TEST_FALSE(empty);
+        }
+
+        const bsls::Types::Int64 t2 = bsls::TimeUtil::getTimer();
+
+        NTCCFG_TEST_EQ(sendQueue.size(), k_NUM_ENTRIES * k_MESSAGE_SIZE / 4);
+
+        // The remaining entries are popped in the order they were pushed.
+
+        for (bsl::size_t i = 2; i < k_NUM_ENTRIES; i += 4) {
+            NTCCFG_TEST_TRUE(sendQueue.hasEntry());
+            NTCCFG_TEST_EQ(sendQueue.frontEntry().id(), idVector[i]);
+            NTCCFG_TEST_EQ(sendQueue.frontEntry().token().value().value(), i);
+
+            sendQueue.popEntry();
+        }
+
+        NTCCFG_TEST_FALSE(sendQueue.hasEntry());
+        NTCCFG_TEST_EQ(sendQueue.size(), 0);
+
+        NTCCFG_TEST_LOG_DEBUG << "Canceled " << k_NUM_ENTRIES / 2
+                              << " entries by token in "
+                              << static_cast<double>(t1 - t0) / 1e6
+                              << " ms and " << k_NUM_ENTRIES / 4
+                              << " entries by identifier in "
+                              << static_cast<double>(t2 - t1) / 1e6 << " ms"
+                              << NTCCFG_TEST_LOG_END;
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(12)
+{
+    // Concern: Entries sharing the same token are each removed by token, in
+    // the order they were pushed.
+
+    ntccfg::TestAllocator ta;
+    {
+        const bsl::size_t k_BLOB_BUFFER_SIZE = 32;
+        const bsl::size_t k_MESSAGE_SIZE     = 100;
+        const bsl::size_t k_NUM_ENTRIES      = 6;
+
+        bdlbb::SimpleBlobBufferFactory blobBufferFactory(k_BLOB_BUFFER_SIZE,
+                                                         &ta);
+
+        bdlbb::Blob blob(&blobBufferFactory, &ta);
+        ntsd::DataUtil::generateData(&blob, k_MESSAGE_SIZE);
+
+        bsl::shared_ptr<ntsa::Data> data;
+        data.createInplace(&ta, blob, &blobBufferFactory, &ta);
+
+        ntcq::SendQueue sendQueue(&ta);
+
+        bsl::vector<bsl::uint64_t> idVector(&ta);
+
+        // Push entries alternately having token 1 and token 2.
+
+        for (bsl::size_t i = 0; i < k_NUM_ENTRIES; ++i) {
+            ntca::SendToken token;
+            token.setValue(1 + i % 2);
+
+            ntcq::SendQueueEntry entry(&ta);
+            entry.setId(sendQueue.generateEntryId());
+            entry.setToken(token);
+            entry.setData(data);
+            entry.setLength(data->size());
+
+            idVector.push_back(entry.id());
+
+            sendQueue.pushEntry(entry);
+        }
+
+        NTCCFG_TEST_EQ(sendQueue.size(), k_NUM_ENTRIES * k_MESSAGE_SIZE);
+
+        ntci::SendCallback callback;
+        bool               empty;
+
+        ntca::SendToken token1;
+        token1.setValue(1);
+
+        ntca::SendToken token2;
+        token2.setValue(2);
+
+        // Pop the first entry having token 1 from the front of the queue.
+
+        NTCCFG_TEST_EQ(sendQueue.frontEntry().id(), idVector[0]);
+        empty = sendQueue.popEntry();
+        NTCCFG_TEST_FALSE(empty);
+
+        // Cancel each remaining entry having token 1, oldest first.
+
+        empty = sendQueue.removeEntryToken(&callback, token1);
+        NTCCFG_TEST_FALSE(empty);
+        NTCCFG_TEST_EQ(sendQueue.size(), 4 * k_MESSAGE_SIZE);
+
+        empty = sendQueue.removeEntryToken(&callback, token1);
+        NTCCFG_TEST_FALSE(empty);
+        NTCCFG_TEST_EQ(sendQueue.size(), 3 * k_MESSAGE_SIZE);
+
+        empty = sendQueue.removeEntryToken(&callback, token1);
+        NTCCFG_TEST_FALSE(empty);
+        NTCCFG_TEST_EQ(sendQueue.size(), 3 * k_MESSAGE_SIZE);
+
+        // Cancel the oldest entry having token 2.
+
+        NTCCFG_TEST_EQ(sendQueue.frontEntry().id(), idVector[1]);
+
+        empty = sendQueue.removeEntryToken(&callback, token2);
+        NTCCFG_TEST_FALSE(empty);
+        NTCCFG_TEST_EQ(sendQueue.size(), 2 * k_MESSAGE_SIZE);
+
+        // The remaining entries having token 2 are popped in the order they
+        // were pushed.
+
+        NTCCFG_TEST_TRUE(sendQueue.hasEntry());
+        NTCCFG_TEST_EQ(sendQueue.frontEntry().id(), idVector[3]);
+        empty = sendQueue.popEntry();
+        NTCCFG_TEST_FALSE(empty);
+
+        NTCCFG_TEST_TRUE(sendQueue.hasEntry());
+        NTCCFG_TEST_EQ(sendQueue.frontEntry().id(), idVector[5]);
+        empty = sendQueue.popEntry();
+        NTCCFG_TEST_TRUE(empty);
+
+        NTCCFG_TEST_FALSE(sendQueue.hasEntry());
+        NTCCFG_TEST_EQ(sendQueue.size(), 0);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
@@ -641,5 +1190,11 @@ NTCCFG_TEST_DRIVER
     NTCCFG_TEST_REGISTER(4);
     NTCCFG_TEST_REGISTER(5);
     NTCCFG_TEST_REGISTER(6);
+    NTCCFG_TEST_REGISTER(7);
+    NTCCFG_TEST_REGISTER(8);
+    NTCCFG_TEST_REGISTER(9);
+    NTCCFG_TEST_REGISTER(10);
+    NTCCFG_TEST_REGISTER(11);
+    NTCCFG_TEST_REGISTER(12);
 }
 NTCCFG_TEST_DRIVER_END;
@@ -45,6 +45,7 @@ BSLS_IDENT_RCSID(ntcr_datagramsocket_cpp, "$Id$ $CSID$")
 #include <bsls_assert.h>
 #include <bsls_log.h>
 #include <bsls_timeutil.h>
+#include <bsl_algorithm.h>
 
 // Define to 1 to observe object using weak pointers, otherwise objects are
 // observed using raw pointers.
@@ -227,6 +228,12 @@ const bsl::size_t k_ZERO_COPY_NEVER = (bsl::size_t)(-1);
 // The default zero-copy threshold value if none is explicitly specified.
 const bsl::size_t k_ZERO_COPY_DEFAULT = k_ZERO_COPY_NEVER;
 
+// The minimum size of the buffer into which datagrams are received while UDP
+// receive offload is enabled. The operating system coalesces datagrams into
+// a single receive of up to this size, and truncates the receive, discarding
+// the excess datagrams, if the buffer is smaller.
+const bsl::size_t k_UDP_RECEIVE_OFFLOAD_BUFFER_SIZE = 65535;
+
 }  // close unnamed namespace
 
 void DatagramSocket::processSocketReadable(const ntca::ReactorEvent& event)
@@ -574,6 +581,100 @@ ntsa::Error DatagramSocket::privateTimestampIncomingData(
     return ntsa::Error();
 }
 
+ntsa::Error DatagramSocket::privateUdpReceiveOffload(
+    const bsl::shared_ptr<DatagramSocket>& self,
+    bool                                   enable)
+{
+    NTCCFG_WARNING_UNUSED(self);
+
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_CONTEXT_GUARD_DESCRIPTOR(d_publicHandle);
+    NTCI_LOG_CONTEXT_GUARD_SOURCE_ENDPOINT(d_sourceEndpoint);
+    NTCI_LOG_CONTEXT_GUARD_REMOTE_ENDPOINT(d_remoteEndpoint);
+
+    ntsa::Error error;
+
+    if (!d_socket_sp) {
+        d_options.setUdpReceiveOffload(enable);
+        return ntsa::Error();
+    }
+
+    d_options.setUdpReceiveOffload(enable);
+
+    bool enabled = false;
+
+    {
+        ntsa::SocketOption option(d_allocator_p);
+        option.makeUdpReceiveOffload(enable);
+        error = d_socket_sp->setOption(option);
+        if (error) {
+            if (error != ntsa::Error::e_NOT_IMPLEMENTED) {
+                NTCI_LOG_DEBUG("Failed to set socket option: "
+                               "UDP receive offload: %s",
+                               error.text().c_str());
+            }
+            return error;
+        }
+    }
+
+    {
+        ntsa::SocketOption option(d_allocator_p);
+        error = d_socket_sp->getOption(&option,
+                                       ntsa::SocketOptionType::e_UDP_GRO);
+        if (error) {
+            if (error != ntsa::Error::e_NOT_IMPLEMENTED) {
+                NTCI_LOG_TRACE("Failed to get socket option: "
+                               "UDP receive offload: %s",
+                               error.text().c_str());
+            }
+            return error;
+        }
+
+        if (option.isUdpReceiveOffload() &&
+            option.udpReceiveOffload() == enable)
+        {
+            enabled = enable;
+        }
+    }
+
+    // Datagrams coalesced by the operating system must be split back into
+    // individual datagrams according to the segment size reported in the
+    // control data accompanying each receive operation. Note that requesting
+    // any control data implicitly disables batched receive operations.
+
+    if (enabled != d_udpReceiveOffload) {
+        if (enabled) {
+            NTCI_LOG_TRACE("UDP receive offload is enabled");
+
+            d_udpReceiveOffload = true;
+            d_receiveOptions.showSegmentSize();
+
+            d_receiveBufferSize =
+                bsl::max(d_maxDatagramSize, k_UDP_RECEIVE_OFFLOAD_BUFFER_SIZE);
+        }
+        else {
+            NTCI_LOG_TRACE("UDP receive offload is disabled");
+
+            d_udpReceiveOffload = false;
+            d_receiveOptions.hideSegmentSize();
+
+            d_receiveBufferSize = d_maxDatagramSize;
+        }
+
+        // Discard any receive buffers allocated at the previous size.
+
+        d_receiveBlob_sp.reset();
+        d_receiveBlobVector.clear();
+    }
+
+    if (enabled != enable) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    return ntsa::Error();
+}
+
 void DatagramSocket::privateTimestampUpdate(
     const bsl::shared_ptr<DatagramSocket>& self,
     const ntsa::Timestamp&                 timestamp)
@@ -889,24 +990,46 @@ ntsa::Error DatagramSocket::privateSocketReadableIteration(
         return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
     }
 
-    this->privateAllocateReceiveBlob();
+    bool batched = false;
 
-    bdlb::NullableValue<ntsa::Endpoint> endpoint;
-    error = this->privateDequeueReceiveBuffer(self,
-                                              &endpoint,
-                                              d_receiveBlob_sp.get());
-    if (NTCCFG_UNLIKELY(error)) {
-        return error;
+    if (d_maxMessagesPerReceive > 1) {
+        error = this->privateDequeueReceiveBufferBatch(self);
+        if (NTCCFG_LIKELY(!error)) {
+            batched = true;
+        }
+        else if (error != ntsa::Error::e_NOT_IMPLEMENTED) {
+            return error;
+        }
     }
 
-    {
-        ntcq::ReceiveQueueEntry entry;
-        entry.setEndpoint(endpoint);
-        entry.setData(d_receiveBlob_sp);
-        entry.setLength(d_receiveBlob_sp->length());
-        entry.setTimestamp(bsls::TimeUtil::getTimer());
+    if (!batched) {
+        this->privateAllocateReceiveBlob();
 
-        d_receiveQueue.pushEntry(entry);
+        bdlb::NullableValue<ntsa::Endpoint> endpoint;
+        bsl::size_t                         segmentSize = 0;
+        error = this->privateDequeueReceiveBuffer(self,
+                                                  &endpoint,
+                                                  &segmentSize,
+                                                  d_receiveBlob_sp.get());
+        if (NTCCFG_UNLIKELY(error)) {
+            return error;
+        }
+
+        if (NTCCFG_UNLIKELY(segmentSize != 0)) {
+            this->privateEnqueueReceiveSegments(endpoint,
+                                                *d_receiveBlob_sp,
+                                                0,
+                                                segmentSize);
+        }
+        else {
+            ntcq::ReceiveQueueEntry entry;
+            entry.setEndpoint(endpoint);
+            entry.setData(d_receiveBlob_sp);
+            entry.setLength(d_receiveBlob_sp->length());
+            entry.setTimestamp(bsls::TimeUtil::getTimer());
+
+            d_receiveQueue.pushEntry(entry);
+        }
 
         d_receiveBlob_sp.reset();
     }
@@ -1010,6 +1133,191 @@ ntsa::Error DatagramSocket::privateSocketReadableIteration(
 
 ntsa::Error DatagramSocket::privateSocketWritableIteration(
     const bsl::shared_ptr<DatagramSocket>& self)
+{
+    if (!d_sendQueue.hasEntry()) {
+        return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+    }
+
+    if (d_maxMessagesPerSend > 1 && !d_timestampOutgoingData &&
+        d_sendQueue.batchNext(&d_sendMessageVector,
+                              d_maxMessagesPerSend,
+                              ntsa::SendOptions()))
+    {
+        return this->privateSocketWritableIterationBatch(self);
+    }
+    else {
+        return this->privateSocketWritableIterationFront(self);
+    }
+}
+
+ntsa::Error DatagramSocket::privateSocketWritableIterationBatch(
+    const bsl::shared_ptr<DatagramSocket>& self)
+{
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    if (!d_socket_sp) {
+        d_sendMessageVector.clear();
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    // Limit the batch to the messages preceding the first message that
+    // must be sent individually: a message without an endpoint sent by an
+    // unconnected socket, a message to some other endpoint sent by a
+    // connected socket, or a message that may be sent with zero-copy
+    // semantics.
+
+    bsl::size_t numMessages   = 0;
+    bsl::size_t numBytesTotal = 0;
+
+    while (numMessages < d_sendMessageVector.size()) {
+        const ntsa::ConstMessage& message = d_sendMessageVector[numMessages];
+
+        if (d_remoteEndpoint.isUndefined()) {
+            if (message.endpoint().isUndefined()) {
+                break;
+            }
+        }
+        else if (!message.endpoint().isUndefined() &&
+                 message.endpoint() != d_remoteEndpoint)
+        {
+            break;
+        }
+
+        if (message.size() >= d_zeroCopyThreshold) {
+            break;
+        }
+
+        numBytesTotal += message.size();
+        ++numMessages;
+    }
+
+    if (numMessages < 2) {
+        d_sendMessageVector.clear();
+        return this->privateSocketWritableIterationFront(self);
+    }
+
+    error = this->privateThrottleSendBuffer(self);
+    if (error) {
+        d_sendMessageVector.clear();
+        return error;
+    }
+
+    bsl::size_t numBytesSent    = 0;
+    bsl::size_t numMessagesSent = 0;
+
+    error = d_socket_sp->sendToMultiple(&numBytesSent,
+                                        &numMessagesSent,
+                                        &d_sendMessageVector[0],
+                                        numMessages);
+
+    d_sendMessageVector.clear();
+
+    if (NTCCFG_UNLIKELY(error)) {
+        if (error == ntsa::Error::e_NOT_IMPLEMENTED) {
+            d_maxMessagesPerSend = 1;
+            return this->privateSocketWritableIterationFront(self);
+        }
+        else if (NTCCFG_LIKELY(error == ntsa::Error::e_WOULD_BLOCK)) {
+            NTCR_DATAGRAMSOCKET_LOG_SEND_BUFFER_OVERFLOW();
+            return error;
+        }
+        else {
+            NTCR_DATAGRAMSOCKET_LOG_SEND_FAILURE(error);
+            return error;
+        }
+    }
+
+    if (d_sourceEndpoint.isUndefined()) {
+        error = d_socket_sp->sourceEndpoint(&d_sourceEndpoint);
+        if (error) {
+            return error;
+        }
+    }
+
+    if (NTCCFG_UNLIKELY(d_sendRateLimiter_sp)) {
+        d_sendRateLimiter_sp->submit(numBytesSent);
+    }
+
+    ntsa::SendContext context;
+    context.setBytesSendable(numBytesTotal);
+    context.setBytesSent(numBytesSent);
+    context.setMessagesSendable(numMessages);
+    context.setMessagesSent(numMessagesSent);
+
+    NTCR_DATAGRAMSOCKET_LOG_SEND_RESULT(context);
+    NTCS_METRICS_UPDATE_SEND_COMPLETE(context);
+
+    d_totalBytesSent += numBytesSent;
+
+    for (bsl::size_t i = 0; i < numMessagesSent; ++i) {
+        ntcq::SendQueueEntry& entry = d_sendQueue.frontEntry();
+
+        NTCS_METRICS_UPDATE_WRITE_QUEUE_DELAY(entry.delay());
+
+        const bool hasDeadline = !entry.deadline().isNull();
+
+        if (hasDeadline) {
+            entry.setDeadline(bdlb::NullableValue<bsls::TimeInterval>());
+            entry.closeTimer();
+        }
+
+        ntci::SendCallback callback = entry.callback();
+
+        d_sendQueue.popEntry();
+
+        if (callback) {
+            ntca::SendEvent sendEvent;
+            sendEvent.setType(ntca::SendEventType::e_COMPLETE);
+
+            callback.dispatch(self,
+                              sendEvent,
+                              d_reactorStrand_sp,
+                              self,
+                              false,
+                              &d_mutex);
+        }
+    }
+
+    NTCR_DATAGRAMSOCKET_LOG_WRITE_QUEUE_DRAINED(d_sendQueue.size());
+
+    NTCS_METRICS_UPDATE_WRITE_QUEUE_SIZE(d_sendQueue.size());
+
+    if (d_sendQueue.authorizeLowWatermarkEvent()) {
+        NTCR_DATAGRAMSOCKET_LOG_WRITE_QUEUE_LOW_WATERMARK(
+            d_sendQueue.lowWatermark(),
+            d_sendQueue.size());
+
+        if (d_session_sp) {
+            ntca::WriteQueueEvent event;
+            event.setType(ntca::WriteQueueEventType::e_LOW_WATERMARK);
+            event.setContext(d_sendQueue.context());
+
+            ntcs::Dispatch::announceWriteQueueLowWatermark(d_session_sp,
+                                                           self,
+                                                           event,
+                                                           d_sessionStrand_sp,
+                                                           d_reactorStrand_sp,
+                                                           self,
+                                                           false,
+                                                           &d_mutex);
+        }
+    }
+
+    if (!d_sendQueue.hasEntry()) {
+        this->privateApplyFlowControl(self,
+                                      ntca::FlowControlType::e_SEND,
+                                      ntca::FlowControlMode::e_IMMEDIATE,
+                                      false,
+                                      false);
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error DatagramSocket::privateSocketWritableIterationFront(
+    const bsl::shared_ptr<DatagramSocket>& self)
 {
     NTCI_LOG_CONTEXT();
 
@@ -2127,14 +2435,17 @@ ntsa::Error DatagramSocket::privateEnqueueSendBuffer(
 ntsa::Error DatagramSocket::privateDequeueReceiveBuffer(
     const bsl::shared_ptr<DatagramSocket>& self,
     bdlb::NullableValue<ntsa::Endpoint>*   endpoint,
+    bsl::size_t*                           segmentSize,
     bdlbb::Blob*                           data)
 {
     NTCI_LOG_CONTEXT();
 
     ntsa::Error error;
 
+    *segmentSize = 0;
+
     BSLS_ASSERT(NTCCFG_WARNING_PROMOTE(bsl::size_t, data->totalSize()) ==
-                d_maxDatagramSize);
+                d_receiveBufferSize);
 
     if (!d_socket_sp) {
         return ntsa::Error(ntsa::Error::e_INVALID);
@@ -2195,6 +2506,10 @@ ntsa::Error DatagramSocket::privateDequeueReceiveBuffer(
 
         *endpoint = context.endpoint();
 
+        if (NTCCFG_UNLIKELY(context.segmentSize().has_value())) {
+            *segmentSize = context.segmentSize().value();
+        }
+
         if (NTCCFG_UNLIKELY(d_receiveRateLimiter_sp)) {
             d_receiveRateLimiter_sp->submit(context.bytesReceived());
         }
@@ -2268,33 +2583,225 @@ ntsa::Error DatagramSocket::privateDequeueReceiveBuffer(
                     context.bytesReceived());
         *endpoint = d_remoteEndpoint;
 
+        if (NTCCFG_UNLIKELY(context.segmentSize().has_value())) {
+            *segmentSize = context.segmentSize().value();
+        }
+
         d_totalBytesReceived += context.bytesReceived();
 
         return ntsa::Error();
     }
 }
 
+void DatagramSocket::privateEnqueueReceiveSegments(
+    const bdlb::NullableValue<ntsa::Endpoint>& endpoint,
+    const bdlbb::Blob&                         data,
+    bsl::size_t                                offset,
+    bsl::size_t                                segmentSize)
+{
+    BSLS_ASSERT(segmentSize > 0);
+
+    const bsl::size_t length =
+        NTCCFG_WARNING_PROMOTE(bsl::size_t, data.length());
+
+    const bsl::int64_t timestamp = bsls::TimeUtil::getTimer();
+
+    // Each datagram references, rather than copies, the blob buffers into
+    // which the coalesced datagrams were received.
+
+    while (offset < length) {
+        const bsl::size_t size = bsl::min(segmentSize, length - offset);
+
+        bsl::shared_ptr<bdlbb::Blob> segment =
+            d_dataPool_sp->createIncomingBlob();
+
+        bdlbb::BlobUtil::append(segment.get(),
+                                data,
+                                NTCCFG_WARNING_NARROW(int, offset),
+                                NTCCFG_WARNING_NARROW(int, size));
+
+        ntcq::ReceiveQueueEntry entry;
+        entry.setEndpoint(endpoint);
+        entry.setData(segment);
+        entry.setLength(size);
+        entry.setTimestamp(timestamp);
+
+        d_receiveQueue.pushEntry(entry);
+
+        offset += size;
+    }
+}
+
+void DatagramSocket::privateSplitReceiveBuffer(
+    const bdlb::NullableValue<ntsa::Endpoint>& endpoint,
+    bdlbb::Blob*                               data,
+    bsl::size_t                                segmentSize)
+{
+    if (NTCCFG_LIKELY(segmentSize == 0)) {
+        return;
+    }
+
+    if (NTCCFG_WARNING_PROMOTE(bsl::size_t, data->length()) <= segmentSize) {
+        return;
+    }
+
+    bsl::shared_ptr<bdlbb::Blob> first = d_dataPool_sp->createIncomingBlob();
+
+    bdlbb::BlobUtil::append(first.get(),
+                            *data,
+                            0,
+                            NTCCFG_WARNING_NARROW(int, segmentSize));
+
+    this->privateEnqueueReceiveSegments(endpoint,
+                                        *data,
+                                        segmentSize,
+                                        segmentSize);
+
+    data->moveBuffers(first.get());
+}
+
+ntsa::Error DatagramSocket::privateDequeueReceiveBufferBatch(
+    const bsl::shared_ptr<DatagramSocket>& self)
+{
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    if (!d_socket_sp) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    // Messages received in batches are not accompanied by any control
+    // data, so receive messages individually when timestamps, foreign
+    // handles, or other meta-data are wanted.
+
+    if (d_receiveOptions.wantTimestamp() ||
+        d_receiveOptions.wantForeignHandles() ||
+        d_receiveOptions.wantMetaData())
+    {
+        return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+    }
+
+    error = this->privateThrottleReceiveBuffer(self);
+    if (error) {
+        return error;
+    }
+
+    const bsl::size_t numMessages = d_maxMessagesPerReceive;
+
+    if (d_receiveBlobVector.size() != numMessages) {
+        d_receiveBlobVector.resize(numMessages);
+        d_receiveMessageVector.resize(numMessages);
+    }
+
+    for (bsl::size_t i = 0; i < numMessages; ++i) {
+        bsl::shared_ptr<bdlbb::Blob>& blob = d_receiveBlobVector[i];
+        this->privateAllocateReceiveBlob(&blob);
+
+        ntsa::MutableMessage& message = d_receiveMessageVector[i];
+        message.reset();
+
+        const int numBuffers = blob->numBuffers();
+        for (int j = 0; j < numBuffers; ++j) {
+            const bdlbb::BlobBuffer& blobBuffer = blob->buffer(j);
+            message.appendBuffer(blobBuffer.data(),
+                                 static_cast<bsl::size_t>(blobBuffer.size()));
+        }
+    }
+
+    bsl::size_t numBytesReceived    = 0;
+    bsl::size_t numMessagesReceived = 0;
+
+    error = d_socket_sp->receiveFromMultiple(&numBytesReceived,
+                                             &numMessagesReceived,
+                                             &d_receiveMessageVector[0],
+                                             numMessages);
+    if (NTCCFG_UNLIKELY(error)) {
+        if (error == ntsa::Error::e_NOT_IMPLEMENTED) {
+            d_maxMessagesPerReceive = 1;
+            d_receiveMessageVector.clear();
+            d_receiveBlobVector.clear();
+            return error;
+        }
+        else if (NTCCFG_LIKELY(error == ntsa::Error::e_WOULD_BLOCK)) {
+            NTCR_DATAGRAMSOCKET_LOG_RECEIVE_BUFFER_UNDERFLOW();
+            return error;
+        }
+        else {
+            NTCR_DATAGRAMSOCKET_LOG_RECEIVE_FAILURE(error);
+            return error;
+        }
+    }
+
+    if (NTCCFG_UNLIKELY(d_receiveRateLimiter_sp)) {
+        d_receiveRateLimiter_sp->submit(numBytesReceived);
+    }
+
+    ntsa::ReceiveContext context;
+    context.setBytesReceivable(numMessages * d_receiveBufferSize);
+    context.setBytesReceived(numBytesReceived);
+    context.setMessagesReceivable(numMessages);
+    context.setMessagesReceived(numMessagesReceived);
+
+    NTCR_DATAGRAMSOCKET_LOG_RECEIVE_RESULT(context);
+    NTCS_METRICS_UPDATE_RECEIVE_COMPLETE(context);
+
+    d_totalBytesReceived += numBytesReceived;
+
+    const bsl::int64_t timestamp = bsls::TimeUtil::getTimer();
+
+    for (bsl::size_t i = 0; i < numMessagesReceived; ++i) {
+        const ntsa::MutableMessage&   message = d_receiveMessageVector[i];
+        bsl::shared_ptr<bdlbb::Blob>& blob    = d_receiveBlobVector[i];
+
+        ntcs::BlobUtil::resize(blob, message.size());
+
+        ntcq::ReceiveQueueEntry entry;
+        if (NTCCFG_LIKELY(d_remoteEndpoint.isUndefined())) {
+            entry.setEndpoint(message.endpoint());
+        }
+        else {
+            entry.setEndpoint(d_remoteEndpoint);
+        }
+
+        entry.setData(blob);
+        entry.setLength(message.size());
+        entry.setTimestamp(timestamp);
+
+        d_receiveQueue.pushEntry(entry);
+
+        blob.reset();
+    }
+
+    return ntsa::Error();
+}
+
 void DatagramSocket::privateAllocateReceiveBlob()
 {
-    if (!d_receiveBlob_sp) {
-        d_receiveBlob_sp = d_dataPool_sp->createIncomingBlob();
+    this->privateAllocateReceiveBlob(&d_receiveBlob_sp);
+}
+
+void DatagramSocket::privateAllocateReceiveBlob(
+    bsl::shared_ptr<bdlbb::Blob>* blob)
+{
+    if (!*blob) {
+        *blob = d_dataPool_sp->createIncomingBlob();
     }
 
-    BSLS_ASSERT(ntcs::BlobUtil::size(d_receiveBlob_sp) == 0);
+    BSLS_ASSERT(ntcs::BlobUtil::size(*blob) == 0);
 
-    if (ntcs::BlobUtil::capacity(d_receiveBlob_sp) < d_maxDatagramSize) {
-        BSLS_ASSERT(ntcs::BlobUtil::capacity(d_receiveBlob_sp) == 0);
-        ntcs::BlobUtil::resize(d_receiveBlob_sp, d_maxDatagramSize);
-        ntcs::BlobUtil::trim(d_receiveBlob_sp);
-        ntcs::BlobUtil::resize(d_receiveBlob_sp, 0);
+    if (ntcs::BlobUtil::capacity(*blob) < d_receiveBufferSize) {
+        BSLS_ASSERT(ntcs::BlobUtil::capacity(*blob) == 0);
+        ntcs::BlobUtil::resize(*blob, d_receiveBufferSize);
+        ntcs::BlobUtil::trim(*blob);
+        ntcs::BlobUtil::resize(*blob, 0);
 
         NTCS_METRICS_UPDATE_BLOB_BUFFER_ALLOCATIONS(
-            ntcs::BlobUtil::capacity(d_receiveBlob_sp));
+            ntcs::BlobUtil::capacity(*blob));
     }
 
-    BSLS_ASSERT(ntcs::BlobUtil::size(d_receiveBlob_sp) == 0);
-    BSLS_ASSERT(ntcs::BlobUtil::capacity(d_receiveBlob_sp) ==
-                d_maxDatagramSize);
+    BSLS_ASSERT(ntcs::BlobUtil::size(*blob) == 0);
+    BSLS_ASSERT(ntcs::BlobUtil::capacity(*blob) == d_receiveBufferSize);
 }
 
 void DatagramSocket::privateRearmAfterSend(
@@ -2501,6 +3008,14 @@ ntsa::Error DatagramSocket::privateOpen(
     d_remoteEndpoint = remoteEndpoint;
     d_socket_sp      = datagramSocket;
 
+    if (d_maxMessagesPerSend > datagramSocket->maxMessagesPerSend()) {
+        d_maxMessagesPerSend = datagramSocket->maxMessagesPerSend();
+    }
+
+    if (d_maxMessagesPerReceive > datagramSocket->maxMessagesPerReceive()) {
+        d_maxMessagesPerReceive = datagramSocket->maxMessagesPerReceive();
+    }
+
     NTCI_LOG_CONTEXT_GUARD_DESCRIPTOR(d_publicHandle);
     NTCI_LOG_CONTEXT_GUARD_SOURCE_ENDPOINT(d_sourceEndpoint);
     NTCI_LOG_CONTEXT_GUARD_REMOTE_ENDPOINT(d_remoteEndpoint);
@@ -2532,6 +3047,11 @@ ntsa::Error DatagramSocket::privateOpen(
                                     d_options.zeroCopyThreshold().value());
     }
 
+    if (d_options.udpReceiveOffload().has_value()) {
+        this->privateUdpReceiveOffload(self,
+                                       d_options.udpReceiveOffload().value());
+    }
+
     ntcs::Dispatch::announceEstablished(d_manager_sp,
                                         self,
                                         d_managerStrand_sp,
@@ -2759,10 +3279,18 @@ DatagramSocket::DatagramSocket(
 , d_receiveBlob_sp()
 , d_timestampOutgoingData(false)
 , d_timestampIncomingData(false)
+, d_udpReceiveOffload(false)
 , d_timestampCorrelator(ntsa::TransportMode::e_DATAGRAM,
                         bslma::Default::allocator(basicAllocator))
 , d_timestampCounter(0)
 , d_maxDatagramSize(NTCCFG_DEFAULT_DATAGRAM_SOCKET_MAX_MESSAGE_SIZE)
+, d_receiveBufferSize(NTCCFG_DEFAULT_DATAGRAM_SOCKET_MAX_MESSAGE_SIZE)
+, d_maxMessagesPerSend(NTCCFG_DEFAULT_DATAGRAM_SOCKET_MAX_MESSAGES_PER_SEND)
+, d_maxMessagesPerReceive(
+      NTCCFG_DEFAULT_DATAGRAM_SOCKET_MAX_MESSAGES_PER_RECEIVE)
+, d_sendMessageVector(basicAllocator)
+, d_receiveMessageVector(basicAllocator)
+, d_receiveBlobVector(basicAllocator)
 , d_oneShot(reactor->oneShot())
 , d_detachState(ntcs::DetachState::e_DETACH_IDLE)
 , d_closeCallback(bslma::Default::allocator(basicAllocator))
@@ -2779,7 +3307,16 @@ DatagramSocket::DatagramSocket(
     }
 
     if (!d_options.maxDatagramSize().isNull()) {
-        d_maxDatagramSize = d_options.maxDatagramSize().value();
+        d_maxDatagramSize   = d_options.maxDatagramSize().value();
+        d_receiveBufferSize = d_maxDatagramSize;
+    }
+
+    if (!d_options.maxMessagesPerSend().isNull()) {
+        d_maxMessagesPerSend = d_options.maxMessagesPerSend().value();
+    }
+
+    if (!d_options.maxMessagesPerReceive().isNull()) {
+        d_maxMessagesPerReceive = d_options.maxMessagesPerReceive().value();
     }
 
     if (!d_options.writeQueueLowWatermark().isNull()) {
@@ -3537,8 +4074,10 @@ ntsa::Error DatagramSocket::receive(ntca::ReceiveContext*       context,
         this->privateAllocateReceiveBlob();
 
         bdlb::NullableValue<ntsa::Endpoint> endpoint;
+        bsl::size_t                         segmentSize = 0;
         error = this->privateDequeueReceiveBuffer(self,
                                                   &endpoint,
+                                                  &segmentSize,
                                                   d_receiveBlob_sp.get());
         if (NTCCFG_UNLIKELY(error)) {
             if (NTCCFG_UNLIKELY(error != ntsa::Error::e_WOULD_BLOCK)) {
@@ -3546,6 +4085,10 @@ ntsa::Error DatagramSocket::receive(ntca::ReceiveContext*       context,
             }
         }
         else {
+            this->privateSplitReceiveBuffer(endpoint,
+                                            d_receiveBlob_sp.get(),
+                                            segmentSize);
+
             context->setTransport(d_transport);
             if (!endpoint.isNull()) {
                 context->setEndpoint(endpoint.value());
@@ -3660,8 +4203,10 @@ ntsa::Error DatagramSocket::receive(const ntca::ReceiveOptions&  options,
         this->privateAllocateReceiveBlob();
 
         bdlb::NullableValue<ntsa::Endpoint> endpoint;
+        bsl::size_t                         segmentSize = 0;
         error = this->privateDequeueReceiveBuffer(self,
                                                   &endpoint,
+                                                  &segmentSize,
                                                   d_receiveBlob_sp.get());
         if (NTCCFG_UNLIKELY(error)) {
             if (NTCCFG_LIKELY(error == ntsa::Error::e_WOULD_BLOCK)) {
@@ -3699,6 +4244,10 @@ ntsa::Error DatagramSocket::receive(const ntca::ReceiveOptions&  options,
             }
         }
         else {
+            this->privateSplitReceiveBuffer(endpoint,
+                                            d_receiveBlob_sp.get(),
+                                            segmentSize);
+
             bsl::shared_ptr<bdlbb::Blob> data = d_receiveBlob_sp;
             d_receiveBlob_sp.reset();
 
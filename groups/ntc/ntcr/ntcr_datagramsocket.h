@@ -45,6 +45,7 @@ BSLS_IDENT("$Id: $")
 #include <ntcu_timestampcorrelator.h>
 #include <ntsa_endpoint.h>
 #include <ntsa_error.h>
+#include <ntsa_message.h>
 #include <ntsa_receivecontext.h>
 #include <ntsa_receiveoptions.h>
 #include <ntsa_sendcontext.h>
@@ -54,6 +55,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_atomic.h>
 #include <bsl_list.h>
 #include <bsl_memory.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace ntcr {
@@ -73,6 +75,18 @@ class DatagramSocket : public ntci::DatagramSocket,
     /// buffer factory.
     typedef bsl::shared_ptr<bdlbb::BlobBufferFactory> BlobBufferFactoryPtr;
 
+    /// Define a type alias for a vector of messages to send in a single
+    /// operation.
+    typedef bsl::vector<ntsa::ConstMessage> SendMessageVector;
+
+    /// Define a type alias for a vector of messages to receive in a single
+    /// operation.
+    typedef bsl::vector<ntsa::MutableMessage> ReceiveMessageVector;
+
+    /// Define a type alias for a vector of blobs into which the messages
+    /// received in a single operation are stored.
+    typedef bsl::vector<bsl::shared_ptr<bdlbb::Blob> > ReceiveBlobVector;
+
     ntccfg::Object                               d_object;
     mutable bslmt::Mutex                         d_mutex;
     ntsa::Handle                                 d_systemHandle;
@@ -111,9 +125,16 @@ class DatagramSocket : public ntci::DatagramSocket,
     bsl::shared_ptr<bdlbb::Blob>                 d_receiveBlob_sp;
     bool                                         d_timestampOutgoingData;
     bool                                         d_timestampIncomingData;
+    bool                                         d_udpReceiveOffload;
     ntcu::TimestampCorrelator                    d_timestampCorrelator;
     bsl::uint32_t                                d_timestampCounter;
     bsl::size_t                                  d_maxDatagramSize;
+    bsl::size_t                                  d_receiveBufferSize;
+    bsl::size_t                                  d_maxMessagesPerSend;
+    bsl::size_t                                  d_maxMessagesPerReceive;
+    SendMessageVector                            d_sendMessageVector;
+    ReceiveMessageVector                         d_receiveMessageVector;
+    ReceiveBlobVector                            d_receiveBlobVector;
     const bool                                   d_oneShot;
     ntcs::DetachState                            d_detachState;
     ntci::CloseCallback                          d_closeCallback;
@@ -178,6 +199,21 @@ class DatagramSocket : public ntci::DatagramSocket,
     ntsa::Error privateSocketWritableIteration(
         const bsl::shared_ptr<DatagramSocket>& self);
 
+    /// Process the writability of the socket by performing one write
+    /// iteration that copies each of the messages in
+    /// 'd_sendMessageVector', batched from the entries at the front of the
+    /// write queue, to the socket send buffer in a single operation. The
+    /// behavior is undefined unless 'd_mutex' is locked.
+    ntsa::Error privateSocketWritableIterationBatch(
+        const bsl::shared_ptr<DatagramSocket>& self);
+
+    /// Process the writability of the socket by performing one write
+    /// iteration that copies the entry at the front of the write queue to
+    /// the socket send buffer. The behavior is undefined unless 'd_mutex'
+    /// is locked.
+    ntsa::Error privateSocketWritableIterationFront(
+        const bsl::shared_ptr<DatagramSocket>& self);
+
     /// Indicate a failure has occurred and detach the socket from its
     /// monitor. The behavior is undefined unless 'd_mutex' is locked.
     void privateFail(const bsl::shared_ptr<DatagramSocket>& self,
@@ -299,19 +335,58 @@ class DatagramSocket : public ntci::DatagramSocket,
         const ntsa::Data&                          data);
 
     /// Dequeue a message from the socket receive buffer. Append to the
-    /// specified 'data' the data dequeued and load into the specified
-    /// 'endpoint' the endpoint of the sender of the data. Return the error.
-    /// The behavior is undefined unless 'd_mutex' is locked.
+    /// specified 'data' the data dequeued, load into the specified
+    /// 'endpoint' the endpoint of the sender of the data, and load into the
+    /// specified 'segmentSize' the size of each datagram coalesced into the
+    /// data dequeued, or zero if the data dequeued is a single datagram.
+    /// Return the error. The behavior is undefined unless 'd_mutex' is
+    /// locked.
     ntsa::Error privateDequeueReceiveBuffer(
         const bsl::shared_ptr<DatagramSocket>& self,
         bdlb::NullableValue<ntsa::Endpoint>*   endpoint,
+        bsl::size_t*                           segmentSize,
         bdlbb::Blob*                           data);
 
+    /// Push onto the read queue each datagram of the specified
+    /// 'segmentSize', except possibly the last, which may be smaller,
+    /// coalesced into the specified 'data' received from the specified
+    /// 'endpoint', beginning at the specified 'offset'. The behavior is
+    /// undefined unless 'd_mutex' is locked.
+    void privateEnqueueReceiveSegments(
+        const bdlb::NullableValue<ntsa::Endpoint>& endpoint,
+        const bdlbb::Blob&                         data,
+        bsl::size_t                                offset,
+        bsl::size_t                                segmentSize);
+
+    /// Truncate the specified 'data' received from the specified 'endpoint'
+    /// to the first datagram of the specified 'segmentSize' coalesced into
+    /// it and push each subsequent datagram onto the read queue. If
+    /// 'segmentSize' is zero or 'data' holds only a single datagram, this
+    /// function has no effect. The behavior is undefined unless 'd_mutex'
+    /// is locked.
+    void privateSplitReceiveBuffer(
+        const bdlb::NullableValue<ntsa::Endpoint>& endpoint,
+        bdlbb::Blob*                               data,
+        bsl::size_t                                segmentSize);
+
+    /// Dequeue up to 'd_maxMessagesPerReceive' messages from the socket
+    /// receive buffer in a single operation and push each message onto the
+    /// read queue. Return the error, notably
+    /// 'ntsa::Error::e_NOT_IMPLEMENTED' if messages cannot be dequeued in
+    /// batches. The behavior is undefined unless 'd_mutex' is locked.
+    ntsa::Error privateDequeueReceiveBufferBatch(
+        const bsl::shared_ptr<DatagramSocket>& self);
+
     /// Allocate a new blob assigned to 'd_receiveBlob_sp', if necessary
     /// and allocate sufficient capacity buffers to store the maximum
     /// datagram size. The behavior is undefined unless 'd_mutex' is locked.
     void privateAllocateReceiveBlob();
 
+    /// Allocate a new blob assigned to the specified 'blob', if necessary
+    /// and allocate sufficient capacity buffers to store the maximum
+    /// datagram size. The behavior is undefined unless 'd_mutex' is locked.
+    void privateAllocateReceiveBlob(bsl::shared_ptr<bdlbb::Blob>* blob);
+
     /// Rearm the interest in the writability of the socket in the reactor,
     /// if necessary. The behavior is undefined unless 'd_mutex' is locked.
     void privateRearmAfterSend(const bsl::shared_ptr<DatagramSocket>& self);
@@ -385,6 +460,13 @@ class DatagramSocket : public ntci::DatagramSocket,
         const bsl::shared_ptr<DatagramSocket>& self,
         bool                                   enable);
 
+    /// Enable or disable the coalescing of multiple datagrams received into
+    /// a single receive operation according to the specified 'enable' flag.
+    /// Return the error.
+    ntsa::Error privateUdpReceiveOffload(
+        const bsl::shared_ptr<DatagramSocket>& self,
+        bool                                   enable);
+
     /// Process the detection of the specified outgoing data 'timestamp'.
     void privateTimestampUpdate(const bsl::shared_ptr<DatagramSocket>& self,
                                 const ntsa::Timestamp& timestamp);
@@ -42,6 +42,7 @@
 #include <bslmt_semaphore.h>
 #include <bslmt_threadgroup.h>
 #include <bslmt_threadutil.h>
+#include <bsls_atomic.h>
 #include <bsl_unordered_map.h>
 
 using namespace BloombergLP;
@@ -1749,6 +1750,219 @@ NTCCFG_TEST_CASE(8)
 #endif
 }
 
+namespace test {
+namespace concern9 {
+
+/// Provide a simulated datagram socket that accepts the UDP receive offload
+/// socket option and records the capacity of the largest buffer supplied
+/// to a receive operation.
+class ReceiveOffloadSocket : public ntcd::DatagramSocket
+{
+    bsls::AtomicBool   d_udpReceiveOffload;
+    bsls::AtomicUint64 d_maxReceiveCapacity;
+
+  private:
+    ReceiveOffloadSocket(const ReceiveOffloadSocket&) BSLS_KEYWORD_DELETED;
+    ReceiveOffloadSocket& operator=(const ReceiveOffloadSocket&)
+        BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new datagram socket. Optionally specify a 'basicAllocator'
+    /// used to supply memory. If 'basicAllocator' is 0, the currently
+    /// installed default allocator is used.
+    explicit ReceiveOffloadSocket(bslma::Allocator* basicAllocator = 0)
+    : ntcd::DatagramSocket(basicAllocator)
+    , d_udpReceiveOffload(false)
+    , d_maxReceiveCapacity(0)
+    {
+    }
+
+    using ntcd::DatagramSocket::receive;
+
+    /// Dequeue from the socket receive buffer into the specified 'data'
+    /// according to the specified 'options', recording the capacity of
+    /// 'data'. Load into the specified 'context' the result of the
+    /// operation. Return the error.
+    ntsa::Error receive(ntsa::ReceiveContext*       context,
+                        bdlbb::Blob*                data,
+                        const ntsa::ReceiveOptions& options)
+        BSLS_KEYWORD_OVERRIDE
+    {
+        const bsls::Types::Uint64 capacity =
+            static_cast<bsls::Types::Uint64>(data->totalSize());
+
+        if (capacity > d_maxReceiveCapacity.load()) {
+            d_maxReceiveCapacity.store(capacity);
+        }
+
+        return ntcd::DatagramSocket::receive(context, data, options);
+    }
+
+    /// Set the specified 'option' for this socket. Return the error.
+    ntsa::Error setOption(const ntsa::SocketOption& option)
+        BSLS_KEYWORD_OVERRIDE
+    {
+        if (option.isUdpReceiveOffload()) {
+            d_udpReceiveOffload.store(option.udpReceiveOffload());
+            return ntsa::Error();
+        }
+
+        return ntcd::DatagramSocket::setOption(option);
+    }
+
+    /// Load into the specified 'option' the socket option of the specified
+    /// 'type' set for this socket. Return the error.
+    ntsa::Error getOption(ntsa::SocketOption*           option,
+                          ntsa::SocketOptionType::Value type)
+        BSLS_KEYWORD_OVERRIDE
+    {
+        if (type == ntsa::SocketOptionType::e_UDP_GRO) {
+            option->makeUdpReceiveOffload(d_udpReceiveOffload.load());
+            return ntsa::Error();
+        }
+
+        return ntcd::DatagramSocket::getOption(option, type);
+    }
+
+    /// Return the capacity of the largest buffer supplied to a receive
+    /// operation.
+    bsl::size_t maxReceiveCapacity() const
+    {
+        return static_cast<bsl::size_t>(d_maxReceiveCapacity.load());
+    }
+};
+
+void processReceive(const bsl::shared_ptr<ntci::Receiver>& receiver,
+                    const bsl::shared_ptr<bdlbb::Blob>&    data,
+                    const ntca::ReceiveEvent&              event,
+                    bsl::size_t                            expectedSize,
+                    bslmt::Semaphore*                      semaphore)
+{
+    NTCI_LOG_CONTEXT();
+    NTCI_LOG_DEBUG("Processing receive from event type %s: %s",
+                   ntca::ReceiveEventType::toString(event.type()),
+                   event.context().error().text().c_str());
+
+    NTCCFG_TEST_EQ(event.type(), ntca::ReceiveEventType::e_COMPLETE);
+    NTCCFG_TEST_FALSE(event.context().error());
+    NTCCFG_TEST_EQ(static_cast<bsl::size_t>(data->length()), expectedSize);
+
+    semaphore->post();
+}
+
+void execute(ntsa::Transport::Value                transport,
+             const bsl::shared_ptr<ntci::Reactor>& reactor,
+             const test::Parameters&               parameters,
+             bslma::Allocator*                     allocator)
+{
+    // Concern: Receive buffers are sized for coalesced datagrams while UDP
+    // receive offload is enabled.
+
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_DEBUG("Datagram socket receive offload test starting");
+
+    const bsl::size_t k_MAX_DATAGRAM_SIZE = 1500;
+    const bsl::size_t k_MESSAGE_SIZE      = 1000;
+    const bsl::size_t k_MIN_CAPACITY      = 65535;
+
+    ntsa::Error                     error;
+    bslmt::Semaphore                semaphore;
+    bsl::shared_ptr<ntcs::Metrics>  metrics;
+    bsl::shared_ptr<ntci::Resolver> resolver;
+
+    ntca::DatagramSocketOptions receiverOptions;
+    receiverOptions.setTransport(transport);
+    receiverOptions.setSourceEndpoint(test::EndpointUtil::any(transport));
+    receiverOptions.setMaxDatagramSize(k_MAX_DATAGRAM_SIZE);
+    receiverOptions.setUdpReceiveOffload(true);
+
+    bsl::shared_ptr<ntcr::DatagramSocket> receiver;
+    receiver.createInplace(allocator,
+                           receiverOptions,
+                           resolver,
+                           reactor,
+                           reactor,
+                           metrics,
+                           allocator);
+
+    bsl::shared_ptr<test::concern9::ReceiveOffloadSocket> receiverBase;
+    receiverBase.createInplace(allocator, allocator);
+
+    error = receiver->open(transport, receiverBase);
+    NTCCFG_TEST_FALSE(error);
+
+    ntca::DatagramSocketOptions senderOptions;
+    senderOptions.setTransport(transport);
+    senderOptions.setSourceEndpoint(test::EndpointUtil::any(transport));
+
+    bsl::shared_ptr<ntcr::DatagramSocket> sender;
+    sender.createInplace(allocator,
+                         senderOptions,
+                         resolver,
+                         reactor,
+                         reactor,
+                         metrics,
+                         allocator);
+
+    bsl::shared_ptr<ntcd::DatagramSocket> senderBase;
+    senderBase.createInplace(allocator, allocator);
+
+    error = sender->open(transport, senderBase);
+    NTCCFG_TEST_FALSE(error);
+
+    ntci::ReceiveCallback receiveCallback = receiver->createReceiveCallback(
+        NTCCFG_BIND(&processReceive,
+                    NTCCFG_BIND_PLACEHOLDER_1,
+                    NTCCFG_BIND_PLACEHOLDER_2,
+                    NTCCFG_BIND_PLACEHOLDER_3,
+                    k_MESSAGE_SIZE,
+                    &semaphore),
+        allocator);
+
+    error = receiver->receive(ntca::ReceiveOptions(), receiveCallback);
+    NTCCFG_TEST_OK(error);
+
+    bdlbb::Blob data(sender->outgoingBlobBufferFactory().get(), allocator);
+    ntcd::DataUtil::generateData(&data, k_MESSAGE_SIZE);
+
+    ntca::SendOptions sendOptions;
+    sendOptions.setEndpoint(receiver->sourceEndpoint());
+
+    error = sender->send(data, sendOptions);
+    NTCCFG_TEST_OK(error);
+
+    semaphore.wait();
+
+    NTCCFG_TEST_GE(receiverBase->maxReceiveCapacity(), k_MIN_CAPACITY);
+
+    {
+        ntci::DatagramSocketCloseGuard senderCloseGuard(sender);
+        ntci::DatagramSocketCloseGuard receiverCloseGuard(receiver);
+    }
+
+    NTCI_LOG_DEBUG("Datagram socket receive offload test complete");
+
+    reactor->stop();
+}
+
+}  // close namespace concern9
+}  // close namespace test
+
+NTCCFG_TEST_CASE(9)
+{
+    // Concern: Receive buffers are sized for coalesced datagrams while UDP
+    // receive offload is enabled.
+
+    test::Parameters parameters;
+
+    test::Framework::execute(NTCCFG_BIND(&test::concern9::execute,
+                                         NTCCFG_BIND_PLACEHOLDER_1,
+                                         NTCCFG_BIND_PLACEHOLDER_2,
+                                         parameters,
+                                         NTCCFG_BIND_PLACEHOLDER_3));
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
@@ -1760,5 +1974,6 @@ NTCCFG_TEST_DRIVER
     NTCCFG_TEST_REGISTER(6);
     NTCCFG_TEST_REGISTER(7);
     NTCCFG_TEST_REGISTER(8);
+    NTCCFG_TEST_REGISTER(9);
 }
 NTCCFG_TEST_DRIVER_END;
@@ -25,6 +25,7 @@ BSLS_IDENT_RCSID(ntcr_interface_cpp, "$Id$ $CSID$")
 #include <ntcm_monitorableutil.h>
 #include <ntcr_datagramsocket.h>
 #include <ntcr_listenersocket.h>
+#include <ntcr_shardedlistenersocket.h>
 #include <ntcr_streamsocket.h>
 #include <ntcs_compat.h>
 #include <ntcs_plugin.h>
@@ -39,6 +40,15 @@ BSLS_IDENT_RCSID(ntcr_interface_cpp, "$Id$ $CSID$")
 #include <bslmt_threadutil.h>
 #include <bsls_assert.h>
 
+// Listener sockets may be sharded across threads only on platforms whose
+// implementation of the "reuse port" option distributes incoming connections
+// among the sockets bound to the same endpoint.
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#define NTCR_INTERFACE_LISTENER_SHARDING 1
+#else
+#define NTCR_INTERFACE_LISTENER_SHARDING 0
+#endif
+
 #define NTCR_INTERFACE_LOG_STARTING(config, numThreads)                       \
     NTCI_LOG_DEBUG(                                                           \
         "Interface '%s' is starting %d/%d thread(s) "                         \
@@ -94,6 +104,10 @@ void* Interface::run(void* context)
     NTCI_LOG_CONTEXT_GUARD_OWNER(interface->d_config.metricName().c_str());
     NTCI_LOG_CONTEXT_GUARD_THREAD(runner->d_threadIndex);
 
+    if (interface->d_socketMetrics_sp) {
+        interface->d_socketMetrics_sp->attachThread(runner->d_threadIndex);
+    }
+
     bsl::string metricName;
     {
         bsl::stringstream ss;
@@ -216,6 +230,15 @@ bsl::shared_ptr<ntci::Reactor> Interface::addReactor()
         reactorConfig.setOneShot(false);
     }
 
+    if (!d_config.chronologySharding().isNull()) {
+        reactorConfig.setChronologySharding(
+            d_config.chronologySharding().value());
+    }
+
+    if (!d_config.interestJournal().isNull()) {
+        reactorConfig.setInterestJournal(d_config.interestJournal().value());
+    }
+
     bsl::shared_ptr<ntci::Reactor> reactor =
         d_reactorFactory_sp->createReactor(reactorConfig,
                                            d_user_sp,
@@ -338,6 +361,10 @@ ntsa::Error Interface::addThread()
         d_threadWatermark = d_threadVector.size();
     }
 
+    if (d_strandScheduler_sp) {
+        d_strandScheduler_sp->attach(threadIndex, reactor);
+    }
+
     return ntsa::Error();
 }
 
@@ -407,6 +434,48 @@ bsl::shared_ptr<ntci::Reactor> Interface::acquireReactorUsedByThreadIndex(
     return result;
 }
 
+bsl::size_t Interface::numListenerShards(
+    const ntca::ListenerSocketOptions& options)
+{
+#if NTCR_INTERFACE_LISTENER_SHARDING
+
+    bool listenerSharding = NTCCFG_DEFAULT_LISTENER_SHARDING;
+    if (!d_config.listenerSharding().isNull()) {
+        listenerSharding = d_config.listenerSharding().value();
+    }
+
+    if (!listenerSharding) {
+        return 1;
+    }
+
+    BSLS_ASSERT_OPT(!d_config.dynamicLoadBalancing().isNull());
+    if (d_config.dynamicLoadBalancing().value()) {
+        return 1;
+    }
+
+    bool isTcp = false;
+    if (options.transport() != ntsa::Transport::e_UNDEFINED) {
+        isTcp = options.transport() == ntsa::Transport::e_TCP_IPV4_STREAM ||
+                options.transport() == ntsa::Transport::e_TCP_IPV6_STREAM;
+    }
+    else if (!options.sourceEndpoint().isNull()) {
+        isTcp = options.sourceEndpoint().value().isIp();
+    }
+
+    if (!isTcp) {
+        return 1;
+    }
+
+    return this->numThreads();
+
+#else
+
+    NTCCFG_WARNING_UNUSED(options);
+    return 1;
+
+#endif
+}
+
 bsl::shared_ptr<ntci::Reactor> Interface::acquireReactorWithLeastLoad(
     const ntca::LoadBalancingOptions& options)
 {
@@ -475,6 +544,8 @@ Interface::Interface(
 , d_socketMetrics_sp()
 , d_reactorFactory_sp(reactorFactory)
 , d_reactorMetrics_sp()
+, d_handshakePool_sp()
+, d_strandScheduler_sp()
 , d_reactorVector(basicAllocator)
 , d_threadVector(basicAllocator)
 , d_threadMap(basicAllocator)
@@ -489,10 +560,18 @@ Interface::Interface(
     d_user_sp->setDataPool(d_dataPool_sp);
 
     if (d_config.socketMetrics().valueOr(NTCCFG_DEFAULT_SOCKET_METRICS)) {
+        bsl::size_t numThreads = 0;
+        if (d_config.socketMetricsPerThread().valueOr(
+                NTCCFG_DEFAULT_SOCKET_METRICS_PER_THREAD))
+        {
+            numThreads = d_config.maxThreads();
+        }
+
         bsl::shared_ptr<ntcs::Metrics> metrics;
         metrics.createInplace(d_allocator_p,
                               "transport",
                               d_config.metricName(),
+                              numThreads,
                               d_allocator_p);
 
         d_socketMetrics_sp = metrics;
@@ -525,6 +604,35 @@ Interface::Interface(
         d_connectionLimiter_sp = connectionLimiter;
         d_user_sp->setConnectionLimiter(d_connectionLimiter_sp);
     }
+
+    const bsl::size_t handshakeThreads = d_config.handshakeThreads().valueOr(
+        NTCCFG_DEFAULT_HANDSHAKE_THREADS);
+
+    if (handshakeThreads > 0) {
+        bsl::size_t handshakeQueueSize = d_config.handshakeQueueSize().valueOr(
+            NTCCFG_DEFAULT_HANDSHAKE_QUEUE_SIZE);
+        if (handshakeQueueSize == 0) {
+            handshakeQueueSize = 1;
+        }
+
+        d_handshakePool_sp.createInplace(d_allocator_p,
+                                         handshakeThreads,
+                                         handshakeQueueSize,
+                                         d_config.metricName(),
+                                         d_allocator_p);
+
+        ntcm::MonitorableUtil::registerMonitorable(d_handshakePool_sp);
+    }
+
+    BSLS_ASSERT_OPT(!d_config.dynamicLoadBalancing().isNull());
+    if (!d_config.dynamicLoadBalancing().value() &&
+        d_config.maxThreads() > 1 &&
+        d_config.strandStealing().valueOr(NTCCFG_DEFAULT_STRAND_STEALING))
+    {
+        d_strandScheduler_sp.createInplace(d_allocator_p,
+                                           d_config.maxThreads(),
+                                           d_allocator_p);
+    }
 }
 
 Interface::~Interface()
@@ -538,6 +646,10 @@ Interface::~Interface()
     d_threadMap.clear();
     d_threadVector.clear();
 
+    if (d_strandScheduler_sp) {
+        d_strandScheduler_sp->clear();
+    }
+
     for (ReactorVector::iterator it = d_reactorVector.begin();
          it != d_reactorVector.end();
          ++it)
@@ -550,6 +662,12 @@ Interface::~Interface()
 
     d_reactorVector.clear();
 
+    d_strandScheduler_sp.reset();
+
+    if (d_handshakePool_sp) {
+        ntcm::MonitorableUtil::deregisterMonitorable(d_handshakePool_sp);
+    }
+
     if (d_reactorMetrics_sp) {
         ntcm::MonitorableUtil::deregisterMonitorable(d_reactorMetrics_sp);
     }
@@ -611,6 +729,13 @@ ntsa::Error Interface::start()
         }
     }
 
+    if (d_handshakePool_sp) {
+        error = d_handshakePool_sp->start();
+        if (error) {
+            return error;
+        }
+    }
+
     NTCR_INTERFACE_LOG_STARTED(d_config);
 
     return ntsa::Error();
@@ -665,6 +790,10 @@ void Interface::linger()
         resolver->linger();
     }
 
+    if (d_handshakePool_sp) {
+        d_handshakePool_sp->stop();
+    }
+
     for (bsl::size_t i = 0; i < threadVector.size(); ++i) {
         bslmt::ThreadUtil::Handle threadHandle = threadVector[i];
 
@@ -766,13 +895,51 @@ bsl::shared_ptr<ntci::ListenerSocket> Interface::createListenerSocket(
     ntca::ListenerSocketOptions effectiveOptions;
     ntcs::Compat::convert(&effectiveOptions, options, d_config);
 
+    bsl::shared_ptr<ntci::ReactorPool> reactorPool = this->getSelf(this);
+    BSLS_ASSERT_OPT(reactorPool);
+
+    const bsl::size_t numShards = this->numListenerShards(effectiveOptions);
+
+    if (numShards > 1) {
+        ntcr::ShardedListenerSocket::ShardVector shards(allocator);
+        shards.reserve(numShards);
+
+        for (bsl::size_t shardIndex = 0; shardIndex < numShards; ++shardIndex)
+        {
+            ntca::ListenerSocketOptions shardOptions = effectiveOptions;
+            shardOptions.setReusePort(true);
+
+            ntca::LoadBalancingOptions loadBalancingOptions =
+                shardOptions.loadBalancingOptions();
+            loadBalancingOptions.setThreadIndex(shardIndex);
+            shardOptions.setLoadBalancingOptions(loadBalancingOptions);
+
+            bsl::shared_ptr<ntci::Reactor> reactor =
+                this->acquireReactor(shardOptions.loadBalancingOptions());
+            BSLS_ASSERT_OPT(reactor);
+
+            bsl::shared_ptr<ntcr::ListenerSocket> shard;
+            shard.createInplace(allocator,
+                                shardOptions,
+                                d_resolver_sp,
+                                reactor,
+                                reactorPool,
+                                d_socketMetrics_sp,
+                                allocator);
+
+            shards.push_back(shard);
+        }
+
+        bsl::shared_ptr<ntcr::ShardedListenerSocket> listenerSocket;
+        listenerSocket.createInplace(allocator, shards, allocator);
+
+        return listenerSocket;
+    }
+
     bsl::shared_ptr<ntci::Reactor> reactor =
         this->acquireReactor(effectiveOptions.loadBalancingOptions());
     BSLS_ASSERT_OPT(reactor);
 
-    bsl::shared_ptr<ntci::ReactorPool> reactorPool = this->getSelf(this);
-    BSLS_ASSERT_OPT(reactorPool);
-
     bsl::shared_ptr<ntcr::ListenerSocket> listenerSocket;
     listenerSocket.createInplace(allocator,
                                  effectiveOptions,
@@ -1540,6 +1707,26 @@ bsl::size_t Interface::maxThreads() const
     return d_config.maxThreads();
 }
 
+ntsa::Error Interface::executeHandshake(const HandshakeFunctor& functor)
+{
+    if (!d_handshakePool_sp) {
+        return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+    }
+
+    return d_handshakePool_sp->execute(functor);
+}
+
+bsl::shared_ptr<ntci::Strand> Interface::createCallbackStrand(
+    const bsl::shared_ptr<ntci::Reactor>& reactor,
+    bslma::Allocator*                     basicAllocator)
+{
+    if (!d_strandScheduler_sp) {
+        return bsl::shared_ptr<ntci::Strand>();
+    }
+
+    return d_strandScheduler_sp->createStrand(reactor, basicAllocator);
+}
+
 bsls::TimeInterval Interface::currentTime() const
 {
     return bdlt::CurrentTime::now();
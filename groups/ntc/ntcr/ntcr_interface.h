@@ -23,9 +23,11 @@ BSLS_IDENT("$Id: $")
 #include <ntccfg_platform.h>
 #include <ntci_interface.h>
 #include <ntci_reactorfactory.h>
+#include <ntcs_handshakepool.h>
 #include <ntcs_metrics.h>
 #include <ntcs_reactormetrics.h>
 #include <ntcs_reservation.h>
+#include <ntcs_strandscheduler.h>
 #include <ntcs_user.h>
 #include <ntcscm_version.h>
 #include <ntsa_endpoint.h>
@@ -83,22 +85,24 @@ class Interface : public ntci::Interface,
     /// Define a type alias for a mutex lock guard.
     typedef ntccfg::LockGuard LockGuard;
 
-    ntccfg::Object                        d_object;
-    mutable Mutex                         d_mutex;
-    bsl::shared_ptr<ntcs::User>           d_user_sp;
-    bsl::shared_ptr<ntci::DataPool>       d_dataPool_sp;
-    bsl::shared_ptr<ntci::Resolver>       d_resolver_sp;
-    bsl::shared_ptr<ntci::Reservation>    d_connectionLimiter_sp;
-    bsl::shared_ptr<ntcs::Metrics>        d_socketMetrics_sp;
-    bsl::shared_ptr<ntci::ReactorFactory> d_reactorFactory_sp;
-    bsl::shared_ptr<ntci::ReactorMetrics> d_reactorMetrics_sp;
-    ReactorVector                         d_reactorVector;
-    ThreadVector                          d_threadVector;
-    ThreadMap                             d_threadMap;
-    bslmt::Semaphore                      d_threadSemaphore;
-    bsl::size_t                           d_threadWatermark;
-    ntca::InterfaceConfig                 d_config;
-    bslma::Allocator*                     d_allocator_p;
+    ntccfg::Object                         d_object;
+    mutable Mutex                          d_mutex;
+    bsl::shared_ptr<ntcs::User>            d_user_sp;
+    bsl::shared_ptr<ntci::DataPool>        d_dataPool_sp;
+    bsl::shared_ptr<ntci::Resolver>        d_resolver_sp;
+    bsl::shared_ptr<ntci::Reservation>     d_connectionLimiter_sp;
+    bsl::shared_ptr<ntcs::Metrics>         d_socketMetrics_sp;
+    bsl::shared_ptr<ntci::ReactorFactory>  d_reactorFactory_sp;
+    bsl::shared_ptr<ntci::ReactorMetrics>  d_reactorMetrics_sp;
+    bsl::shared_ptr<ntcs::HandshakePool>   d_handshakePool_sp;
+    bsl::shared_ptr<ntcs::StrandScheduler> d_strandScheduler_sp;
+    ReactorVector                          d_reactorVector;
+    ThreadVector                           d_threadVector;
+    ThreadMap                              d_threadMap;
+    bslmt::Semaphore                       d_threadSemaphore;
+    bsl::size_t                            d_threadWatermark;
+    ntca::InterfaceConfig                  d_config;
+    bslma::Allocator*                      d_allocator_p;
 
   private:
     Interface(const Interface&) BSLS_KEYWORD_DELETED;
@@ -144,6 +148,11 @@ class Interface : public ntci::Interface,
     bsl::shared_ptr<ntci::Reactor> acquireReactorWithLeastLoad(
         const ntca::LoadBalancingOptions& options);
 
+    /// Return the number of listener sockets, each driven by a different
+    /// thread, that implement a listener socket having the specified
+    /// 'options', or 1 if such a listener socket should not be sharded.
+    bsl::size_t numListenerShards(const ntca::ListenerSocketOptions& options);
+
   public:
     /// Create a new interface having the specified 'configuration'.
     /// Allocate data containers using the specified 'dataPool'. Create
@@ -523,6 +532,27 @@ class Interface : public ntci::Interface,
     /// Return the maximum number of threads in the thread pool.
     bsl::size_t maxThreads() const BSLS_KEYWORD_OVERRIDE;
 
+    /// Defer the execution of the specified 'functor', which processes a
+    /// step of the handshake of a socket upgrading to encrypted
+    /// communication, to a thread dedicated to processing handshakes.
+    /// Return the error, notably 'ntsa::Error::e_NOT_IMPLEMENTED' if this
+    /// interface is not configured to dedicate threads to processing
+    /// handshakes, or 'ntsa::Error::e_LIMIT' if the maximum number of
+    /// handshake steps are already pending processing.
+    ntsa::Error executeHandshake(const HandshakeFunctor& functor)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return a new strand on which the callbacks of a socket driven by the
+    /// specified 'reactor' should be invoked, so that their invocation may
+    /// be stolen by idle threads while the thread driving the 'reactor' is
+    /// busy. Optionally specify a 'basicAllocator' used to supply memory.
+    /// If 'basicAllocator' is 0, the currently installed default allocator
+    /// is used. Return null unless this interface is configured to steal
+    /// strands.
+    bsl::shared_ptr<ntci::Strand> createCallbackStrand(
+        const bsl::shared_ptr<ntci::Reactor>& reactor,
+        bslma::Allocator* basicAllocator = 0) BSLS_KEYWORD_OVERRIDE;
+
     /// Return the current elapsed time since the Unix epoch.
     bsls::TimeInterval currentTime() const BSLS_KEYWORD_OVERRIDE;
 
@@ -15,11 +15,15 @@
 
 #include <ntcr_interface.h>
 
+#include <ntccfg_bind.h>
 #include <ntcd_simulation.h>
+#include <ntcr_shardedlistenersocket.h>
+#include <ntcr_streamsocket.h>
 #include <ntcs_datapool.h>
 
 #include <ntccfg_test.h>
 
+#include <bslmt_semaphore.h>
 #include <bslmt_threadutil.h>
 #include <bsls_timeinterval.h>
 
@@ -385,6 +389,232 @@ void execute(bslma::Allocator* allocator)
 
 }  // close namespace case2
 
+namespace case3 {
+
+void processClose(bslmt::Semaphore* semaphore)
+{
+    semaphore->post();
+}
+
+void execute(bslma::Allocator* allocator)
+{
+    const bsl::size_t NUM_THREADS = 2;
+
+    ntsa::Error      error;
+    bslmt::Semaphore semaphore;
+
+    // Create the simulation.
+
+    bsl::shared_ptr<ntcd::Simulation> simulation;
+    simulation.createInplace(allocator, allocator);
+
+    error = simulation->run();
+    NTCCFG_TEST_OK(error);
+
+    // Create the data pool.
+
+    bsl::shared_ptr<ntcs::DataPool> dataPool;
+    dataPool.createInplace(allocator, allocator);
+
+    // Create the reactor factory.
+
+    bsl::shared_ptr<ntcd::ReactorFactory> reactorFactory;
+    reactorFactory.createInplace(allocator, allocator);
+
+    // Create the interface with listener sharding enabled.
+
+    ntca::InterfaceConfig interfaceConfig;
+    interfaceConfig.setMetricName("test");
+    interfaceConfig.setMinThreads(NUM_THREADS);
+    interfaceConfig.setMaxThreads(NUM_THREADS);
+    interfaceConfig.setDynamicLoadBalancing(false);
+    interfaceConfig.setListenerSharding(true);
+
+    bsl::shared_ptr<ntcr::Interface> interface;
+    interface.createInplace(allocator,
+                            interfaceConfig,
+                            dataPool,
+                            reactorFactory,
+                            allocator);
+
+    error = interface->start();
+    NTCCFG_TEST_OK(error);
+
+    NTCCFG_TEST_EQ(interface->numThreads(), NUM_THREADS);
+
+    // Create a TCP listener socket and ensure, on platforms that support
+    // sharding, that it is implemented by one listener socket per thread.
+
+    ntca::ListenerSocketOptions listenerSocketOptions;
+    listenerSocketOptions.setTransport(ntsa::Transport::e_TCP_IPV4_STREAM);
+
+    bsl::shared_ptr<ntci::ListenerSocket> listenerSocket =
+        interface->createListenerSocket(listenerSocketOptions, allocator);
+
+    bsl::shared_ptr<ntcr::ShardedListenerSocket> shardedListenerSocket =
+        bsl::dynamic_pointer_cast<ntcr::ShardedListenerSocket>(
+            listenerSocket);
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    NTCCFG_TEST_TRUE(shardedListenerSocket);
+    NTCCFG_TEST_EQ(shardedListenerSocket->numShards(), NUM_THREADS);
+#endif
+
+    // Create a listener socket without a transport or source endpoint and
+    // ensure it is not sharded.
+
+    {
+        ntca::ListenerSocketOptions options;
+
+        bsl::shared_ptr<ntci::ListenerSocket> socket =
+            interface->createListenerSocket(options, allocator);
+
+        NTCCFG_TEST_FALSE(
+            bsl::dynamic_pointer_cast<ntcr::ShardedListenerSocket>(socket));
+
+        ntci::CloseCallback closeCallback = socket->createCloseCallback(
+            NTCCFG_BIND(&test::case3::processClose, &semaphore));
+
+        socket->close(closeCallback);
+        semaphore.wait();
+    }
+
+    // Close the listener socket.
+
+    {
+        ntci::CloseCallback closeCallback =
+            listenerSocket->createCloseCallback(
+                NTCCFG_BIND(&test::case3::processClose, &semaphore));
+
+        listenerSocket->close(closeCallback);
+        semaphore.wait();
+    }
+
+    // Stop the interface.
+
+    interface->shutdown();
+    interface->linger();
+
+    // Stop the simulation.
+
+    simulation->stop();
+}
+
+}  // close namespace case3
+
+namespace case4 {
+
+void processClose(bslmt::Semaphore* semaphore)
+{
+    semaphore->post();
+}
+
+void processExecute(ntci::Strand** strand, bslmt::Semaphore* semaphore)
+{
+    *strand = ntci::Strand::getThreadLocal();
+    semaphore->post();
+}
+
+void execute(bslma::Allocator* allocator)
+{
+    const bsl::size_t NUM_THREADS = 2;
+
+    ntsa::Error      error;
+    bslmt::Semaphore semaphore;
+
+    // Create the simulation.
+
+    bsl::shared_ptr<ntcd::Simulation> simulation;
+    simulation.createInplace(allocator, allocator);
+
+    error = simulation->run();
+    NTCCFG_TEST_OK(error);
+
+    // Create the data pool.
+
+    bsl::shared_ptr<ntcs::DataPool> dataPool;
+    dataPool.createInplace(allocator, allocator);
+
+    // Create the reactor factory.
+
+    bsl::shared_ptr<ntcd::ReactorFactory> reactorFactory;
+    reactorFactory.createInplace(allocator, allocator);
+
+    // Create the interface with strand stealing enabled.
+
+    ntca::InterfaceConfig interfaceConfig;
+    interfaceConfig.setMetricName("test");
+    interfaceConfig.setMinThreads(NUM_THREADS);
+    interfaceConfig.setMaxThreads(NUM_THREADS);
+    interfaceConfig.setDynamicLoadBalancing(false);
+    interfaceConfig.setStrandStealing(true);
+
+    bsl::shared_ptr<ntcr::Interface> interface;
+    interface.createInplace(allocator,
+                            interfaceConfig,
+                            dataPool,
+                            reactorFactory,
+                            allocator);
+
+    error = interface->start();
+    NTCCFG_TEST_OK(error);
+
+    NTCCFG_TEST_EQ(interface->numThreads(), NUM_THREADS);
+
+    // Create a stream socket on each thread and ensure its callbacks are
+    // invoked on a strand that is not the strand, if any, on which its
+    // readiness is processed.
+
+    for (bsl::size_t threadIndex = 0; threadIndex < NUM_THREADS;
+         ++threadIndex)
+    {
+        ntca::LoadBalancingOptions loadBalancingOptions;
+        loadBalancingOptions.setThreadIndex(threadIndex);
+
+        ntca::StreamSocketOptions options;
+        options.setTransport(ntsa::Transport::e_TCP_IPV4_STREAM);
+        options.setLoadBalancingOptions(loadBalancingOptions);
+
+        bsl::shared_ptr<ntci::StreamSocket> socket =
+            interface->createStreamSocket(options, allocator);
+
+        bsl::shared_ptr<ntcr::StreamSocket> concreteSocket =
+            bsl::dynamic_pointer_cast<ntcr::StreamSocket>(socket);
+        NTCCFG_TEST_TRUE(concreteSocket);
+
+        NTCCFG_TEST_TRUE(socket->strand());
+        NTCCFG_TEST_NE(socket->strand(), concreteSocket->reactorStrand());
+
+        // Ensure functors executed by the socket run on the same strand as
+        // its callbacks.
+
+        ntci::Strand* executeStrand = 0;
+        socket->execute(NTCCFG_BIND(&test::case4::processExecute,
+                                    &executeStrand,
+                                    &semaphore));
+        semaphore.wait();
+
+        NTCCFG_TEST_EQ(executeStrand, socket->strand().get());
+
+        ntci::CloseCallback closeCallback = socket->createCloseCallback(
+            NTCCFG_BIND(&test::case4::processClose, &semaphore));
+
+        socket->close(closeCallback);
+        semaphore.wait();
+    }
+
+    // Stop the interface.
+
+    interface->shutdown();
+    interface->linger();
+
+    // Stop the simulation.
+
+    simulation->stop();
+}
+
+}  // close namespace case4
+
 }  // close namespace test
 
 NTCCFG_TEST_CASE(1)
@@ -411,9 +641,37 @@ NTCCFG_TEST_CASE(2)
     NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+NTCCFG_TEST_CASE(3)
+{
+    // Concern: Listener sockets are sharded across threads when configured.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        test::case3::execute(&ta);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(4)
+{
+    // Concern: The callbacks of stream sockets, and the functors they
+    // execute, are invoked on strands that may be stolen across threads when
+    // configured.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        test::case4::execute(&ta);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
     NTCCFG_TEST_REGISTER(2);
+    NTCCFG_TEST_REGISTER(3);
+    NTCCFG_TEST_REGISTER(4);
 }
 NTCCFG_TEST_DRIVER_END;
@@ -0,0 +1,1044 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcr_shardedlistenersocket.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntcr_shardedlistenersocket_cpp, "$Id$ $CSID$")
+
+#include <ntci_streamsocket.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace ntcr {
+
+void ShardedListenerSocket::processShardBound(
+    const bsl::shared_ptr<ntci::Bindable>& bindable,
+    const ntca::BindEvent&                 event,
+    const ntca::BindOptions&               options,
+    const ntci::BindCallback&              callback)
+{
+    NTCCFG_WARNING_UNUSED(bindable);
+    NTCCFG_WARNING_UNUSED(options);
+
+    bsl::shared_ptr<ShardedListenerSocket> self = this->getSelf(this);
+
+    ntca::BindEvent bindEvent = event;
+
+    if (event.type() == ntca::BindEventType::e_COMPLETE) {
+        ntsa::Error error =
+            this->privateBindRemaining(event.context().endpoint());
+        if (error) {
+            ntca::BindContext bindContext = event.context();
+            bindContext.setError(error);
+
+            bindEvent.setType(ntca::BindEventType::e_ERROR);
+            bindEvent.setContext(bindContext);
+        }
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    if (callback) {
+        callback.dispatch(self,
+                          bindEvent,
+                          ntci::Strand::unknown(),
+                          self,
+                          false,
+                          &d_mutex);
+    }
+}
+
+void ShardedListenerSocket::processShardAccepted(
+    bsl::size_t                                index,
+    const bsl::shared_ptr<ntci::Acceptor>&     acceptor,
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    const ntca::AcceptEvent&                   event)
+{
+    NTCCFG_WARNING_UNUSED(acceptor);
+
+    bsl::shared_ptr<ShardedListenerSocket> self = this->getSelf(this);
+
+    bsl::vector<bsl::size_t> indexes;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        BSLS_ASSERT(index < d_shards.size());
+
+        d_armed[index] = false;
+
+        if (event.type() == ntca::AcceptEventType::e_COMPLETE &&
+            streamSocket)
+        {
+            if (!d_requestQueue.empty()) {
+                ntci::AcceptCallback callback;
+                this->privatePopRequest(&callback);
+
+                this->privateComplete(self,
+                                      callback,
+                                      streamSocket,
+                                      ntsa::Error(),
+                                      false);
+            }
+            else {
+                d_streamSocketQueue.push_back(streamSocket);
+            }
+        }
+        else {
+            this->privateShardClosed(self, index);
+        }
+
+        this->privateArm(&indexes);
+    }
+
+    this->privateArmShards(indexes);
+}
+
+void ShardedListenerSocket::processAcceptDeadlineTimer(
+    const bsl::shared_ptr<ntci::Timer>& timer,
+    const ntca::TimerEvent&             event,
+    bsl::uint64_t                       requestId)
+{
+    NTCCFG_WARNING_UNUSED(timer);
+
+    if (event.type() != ntca::TimerEventType::e_DEADLINE) {
+        return;
+    }
+
+    bsl::shared_ptr<ShardedListenerSocket> self = this->getSelf(this);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    for (RequestQueue::iterator it = d_requestQueue.begin();
+         it != d_requestQueue.end();
+         ++it)
+    {
+        if (it->d_id == requestId) {
+            ntci::AcceptCallback callback = it->d_callback;
+            d_requestQueue.erase(it);
+
+            this->privateComplete(self,
+                                  callback,
+                                  bsl::shared_ptr<ntci::StreamSocket>(),
+                                  ntsa::Error(ntsa::Error::e_WOULD_BLOCK),
+                                  false);
+            return;
+        }
+    }
+}
+
+void ShardedListenerSocket::processShardClosed(
+    const bsl::shared_ptr<bsls::AtomicUint>& numRemaining,
+    const ntci::CloseCallback&               callback)
+{
+    if (--(*numRemaining) != 0) {
+        return;
+    }
+
+    bsl::shared_ptr<ShardedListenerSocket> self = this->getSelf(this);
+
+    StreamSocketQueue streamSocketQueue(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        streamSocketQueue.swap(d_streamSocketQueue);
+    }
+
+    for (StreamSocketQueue::iterator it = streamSocketQueue.begin();
+         it != streamSocketQueue.end();
+         ++it)
+    {
+        (*it)->close();
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    if (callback) {
+        callback.dispatch(ntci::Strand::unknown(), self, false, &d_mutex);
+    }
+}
+
+ntsa::Error ShardedListenerSocket::privateBindRemaining(
+    const ntsa::Endpoint& endpoint)
+{
+    ntsa::Error error;
+
+    for (bsl::size_t i = 1; i < d_shards.size(); ++i) {
+        error = d_shards[i]->bind(endpoint,
+                                  ntca::BindOptions(),
+                                  ntci::BindCallback(d_allocator_p));
+        if (error) {
+            return error;
+        }
+    }
+
+    return ntsa::Error();
+}
+
+void ShardedListenerSocket::privateArm(bsl::vector<bsl::size_t>* result)
+{
+    result->clear();
+
+    if (d_requestQueue.empty()) {
+        return;
+    }
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        if (!d_armed[i] && !d_closed[i]) {
+            d_armed[i] = true;
+            result->push_back(i);
+        }
+    }
+}
+
+void ShardedListenerSocket::privateArmShards(
+    const bsl::vector<bsl::size_t>& indexes)
+{
+    if (indexes.empty()) {
+        return;
+    }
+
+    bsl::shared_ptr<ShardedListenerSocket> self = this->getSelf(this);
+
+    for (bsl::size_t i = 0; i < indexes.size(); ++i) {
+        const bsl::size_t index = indexes[i];
+
+        ntsa::Error error = d_shards[index]->accept(
+            ntca::AcceptOptions(),
+            NTCCFG_BIND(&ShardedListenerSocket::processShardAccepted,
+                        self,
+                        index,
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2,
+                        NTCCFG_BIND_PLACEHOLDER_3));
+        if (error) {
+            bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+            d_armed[index] = false;
+            this->privateShardClosed(self, index);
+        }
+    }
+}
+
+void ShardedListenerSocket::privateShardClosed(
+    const bsl::shared_ptr<ShardedListenerSocket>& self,
+    bsl::size_t                                   index)
+{
+    d_closed[index] = true;
+
+    for (bsl::size_t i = 0; i < d_closed.size(); ++i) {
+        if (!d_closed[i]) {
+            return;
+        }
+    }
+
+    RequestQueue requestQueue(d_allocator_p);
+    requestQueue.swap(d_requestQueue);
+
+    for (RequestQueue::iterator it = requestQueue.begin();
+         it != requestQueue.end();
+         ++it)
+    {
+        if (it->d_timer) {
+            it->d_timer->close();
+        }
+
+        this->privateComplete(self,
+                              it->d_callback,
+                              bsl::shared_ptr<ntci::StreamSocket>(),
+                              ntsa::Error(ntsa::Error::e_EOF),
+                              true);
+    }
+}
+
+ntsa::Error ShardedListenerSocket::privateAccept(
+    ntca::AcceptContext*                 context,
+    bsl::shared_ptr<ntci::StreamSocket>* result,
+    const ntca::AcceptOptions&           options)
+{
+    if (!d_streamSocketQueue.empty()) {
+        *result = d_streamSocketQueue.front();
+        d_streamSocketQueue.pop_front();
+        return ntsa::Error();
+    }
+
+    const bsl::size_t numShards = d_shards.size();
+    const bsl::size_t first     = d_cursor++ % numShards;
+
+    bool wouldBlock = false;
+
+    for (bsl::size_t i = 0; i < numShards; ++i) {
+        const bsl::size_t index = (first + i) % numShards;
+
+        ntsa::Error error =
+            d_shards[index]->accept(context, result, options);
+        if (!error) {
+            return ntsa::Error();
+        }
+
+        if (error == ntsa::Error(ntsa::Error::e_WOULD_BLOCK)) {
+            wouldBlock = true;
+        }
+    }
+
+    if (wouldBlock) {
+        return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+    }
+
+    return ntsa::Error(ntsa::Error::e_EOF);
+}
+
+void ShardedListenerSocket::privatePopRequest(ntci::AcceptCallback* result)
+{
+    BSLS_ASSERT(!d_requestQueue.empty());
+
+    Request& request = d_requestQueue.front();
+
+    if (request.d_timer) {
+        request.d_timer->close();
+    }
+
+    *result = request.d_callback;
+    d_requestQueue.pop_front();
+}
+
+void ShardedListenerSocket::privateComplete(
+    const bsl::shared_ptr<ShardedListenerSocket>& self,
+    const ntci::AcceptCallback&                   callback,
+    const bsl::shared_ptr<ntci::StreamSocket>&    streamSocket,
+    const ntsa::Error&                            error,
+    bool                                          defer)
+{
+    ntca::AcceptContext acceptContext;
+    ntca::AcceptEvent   acceptEvent;
+
+    if (error) {
+        acceptContext.setError(error);
+        acceptEvent.setType(ntca::AcceptEventType::e_ERROR);
+    }
+    else {
+        acceptEvent.setType(ntca::AcceptEventType::e_COMPLETE);
+    }
+
+    acceptEvent.setContext(acceptContext);
+
+    callback.dispatch(self,
+                      streamSocket,
+                      acceptEvent,
+                      ntci::Strand::unknown(),
+                      self,
+                      defer,
+                      &d_mutex);
+}
+
+ShardedListenerSocket::ShardedListenerSocket(
+    const bsl::vector<bsl::shared_ptr<ntci::ListenerSocket> >& shards,
+    bslma::Allocator*                                          basicAllocator)
+: d_object("ntcr::ShardedListenerSocket")
+, d_mutex()
+, d_shards(shards, basicAllocator)
+, d_armed(shards.size(), false, basicAllocator)
+, d_closed(shards.size(), false, basicAllocator)
+, d_requestQueue(basicAllocator)
+, d_streamSocketQueue(basicAllocator)
+, d_cursor(0)
+, d_requestId(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_OPT(!d_shards.empty());
+}
+
+ShardedListenerSocket::~ShardedListenerSocket()
+{
+}
+
+ntsa::Error ShardedListenerSocket::open()
+{
+    ntsa::Error error;
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        error = d_shards[i]->open();
+        if (error) {
+            return error;
+        }
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error ShardedListenerSocket::open(ntsa::Transport::Value transport)
+{
+    ntsa::Error error;
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        error = d_shards[i]->open(transport);
+        if (error) {
+            return error;
+        }
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error ShardedListenerSocket::open(ntsa::Transport::Value transport,
+                                        ntsa::Handle           handle)
+{
+    NTCCFG_WARNING_UNUSED(transport);
+    NTCCFG_WARNING_UNUSED(handle);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ShardedListenerSocket::open(
+    ntsa::Transport::Value                       transport,
+    const bsl::shared_ptr<ntsi::ListenerSocket>& listenerSocket)
+{
+    NTCCFG_WARNING_UNUSED(transport);
+    NTCCFG_WARNING_UNUSED(listenerSocket);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ShardedListenerSocket::bind(const ntsa::Endpoint&     endpoint,
+                                        const ntca::BindOptions&  options,
+                                        const ntci::BindFunction& callback)
+{
+    return this->bind(endpoint,
+                      options,
+                      this->createBindCallback(callback, d_allocator_p));
+}
+
+ntsa::Error ShardedListenerSocket::bind(const ntsa::Endpoint&     endpoint,
+                                        const ntca::BindOptions&  options,
+                                        const ntci::BindCallback& callback)
+{
+    bsl::shared_ptr<ShardedListenerSocket> self = this->getSelf(this);
+
+    ntsa::Error error;
+
+    error = d_shards.front()->bind(endpoint,
+                                   options,
+                                   ntci::BindCallback(d_allocator_p));
+    if (error) {
+        return error;
+    }
+
+    const ntsa::Endpoint sourceEndpoint = d_shards.front()->sourceEndpoint();
+
+    error = this->privateBindRemaining(sourceEndpoint);
+    if (error) {
+        return error;
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    if (callback) {
+        ntca::BindContext bindContext;
+        bindContext.setEndpoint(sourceEndpoint);
+
+        ntca::BindEvent bindEvent;
+        bindEvent.setType(ntca::BindEventType::e_COMPLETE);
+        bindEvent.setContext(bindContext);
+
+        const bool defer = !options.recurse();
+
+        callback.dispatch(self,
+                          bindEvent,
+                          ntci::Strand::unknown(),
+                          self,
+                          defer,
+                          &d_mutex);
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error ShardedListenerSocket::bind(const bsl::string&        name,
+                                        const ntca::BindOptions&  options,
+                                        const ntci::BindFunction& callback)
+{
+    return this->bind(name,
+                      options,
+                      this->createBindCallback(callback, d_allocator_p));
+}
+
+ntsa::Error ShardedListenerSocket::bind(const bsl::string&        name,
+                                        const ntca::BindOptions&  options,
+                                        const ntci::BindCallback& callback)
+{
+    bsl::shared_ptr<ShardedListenerSocket> self = this->getSelf(this);
+
+    return d_shards.front()->bind(
+        name,
+        options,
+        NTCCFG_BIND(&ShardedListenerSocket::processShardBound,
+                    self,
+                    NTCCFG_BIND_PLACEHOLDER_1,
+                    NTCCFG_BIND_PLACEHOLDER_2,
+                    options,
+                    callback));
+}
+
+ntsa::Error ShardedListenerSocket::listen()
+{
+    ntsa::Error error;
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        error = d_shards[i]->listen();
+        if (error) {
+            return error;
+        }
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error ShardedListenerSocket::listen(bsl::size_t backlog)
+{
+    ntsa::Error error;
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        error = d_shards[i]->listen(backlog);
+        if (error) {
+            return error;
+        }
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error ShardedListenerSocket::accept(
+    ntca::AcceptContext*                 context,
+    bsl::shared_ptr<ntci::StreamSocket>* streamSocket,
+    const ntca::AcceptOptions&           options)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    return this->privateAccept(context, streamSocket, options);
+}
+
+ntsa::Error ShardedListenerSocket::accept(const ntca::AcceptOptions&  options,
+                                          const ntci::AcceptFunction& callback)
+{
+    return this->accept(options,
+                        this->createAcceptCallback(callback, d_allocator_p));
+}
+
+ntsa::Error ShardedListenerSocket::accept(const ntca::AcceptOptions&  options,
+                                          const ntci::AcceptCallback& callback)
+{
+    bsl::shared_ptr<ShardedListenerSocket> self = this->getSelf(this);
+
+    bsl::vector<bsl::size_t> indexes;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        ntca::AcceptContext                 acceptContext;
+        bsl::shared_ptr<ntci::StreamSocket> streamSocket;
+
+        ntsa::Error error =
+            this->privateAccept(&acceptContext, &streamSocket, options);
+        if (!error) {
+            const bool defer = !options.recurse();
+
+            this->privateComplete(self,
+                                  callback,
+                                  streamSocket,
+                                  ntsa::Error(),
+                                  defer);
+            return ntsa::Error();
+        }
+
+        if (error != ntsa::Error(ntsa::Error::e_WOULD_BLOCK)) {
+            return error;
+        }
+
+        Request request;
+        request.d_id       = ++d_requestId;
+        request.d_callback = callback;
+        request.d_token    = options.token();
+
+        if (!options.deadline().isNull()) {
+            ntca::TimerOptions timerOptions;
+            timerOptions.setOneShot(true);
+            timerOptions.showEvent(ntca::TimerEventType::e_DEADLINE);
+            timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
+            timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
+
+            ntci::TimerCallback timerCallback = this->createTimerCallback(
+                NTCCFG_BIND(&ShardedListenerSocket::processAcceptDeadlineTimer,
+                            self,
+                            NTCCFG_BIND_PLACEHOLDER_1,
+                            NTCCFG_BIND_PLACEHOLDER_2,
+                            request.d_id),
+                d_allocator_p);
+
+            request.d_timer =
+                this->createTimer(timerOptions, timerCallback, d_allocator_p);
+
+            request.d_timer->schedule(options.deadline().value());
+        }
+
+        d_requestQueue.push_back(request);
+
+        this->privateArm(&indexes);
+    }
+
+    this->privateArmShards(indexes);
+
+    return ntsa::Error();
+}
+
+ntsa::Error ShardedListenerSocket::registerResolver(
+    const bsl::shared_ptr<ntci::Resolver>& resolver)
+{
+    ntsa::Error error;
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        error = d_shards[i]->registerResolver(resolver);
+        if (error) {
+            return error;
+        }
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error ShardedListenerSocket::deregisterResolver()
+{
+    ntsa::Error error;
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        error = d_shards[i]->deregisterResolver();
+        if (error) {
+            return error;
+        }
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error ShardedListenerSocket::registerManager(
+    const bsl::shared_ptr<ntci::ListenerSocketManager>& manager)
+{
+    ntsa::Error error;
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        error = d_shards[i]->registerManager(manager);
+        if (error) {
+            return error;
+        }
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error ShardedListenerSocket::deregisterManager()
+{
+    ntsa::Error error;
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        error = d_shards[i]->deregisterManager();
+        if (error) {
+            return error;
+        }
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error ShardedListenerSocket::registerSession(
+    const bsl::shared_ptr<ntci::ListenerSocketSession>& session)
+{
+    ntsa::Error error;
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        error = d_shards[i]->registerSession(session);
+        if (error) {
+            return error;
+        }
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error ShardedListenerSocket::registerSessionCallback(
+    const ntci::ListenerSocket::SessionCallback& callback)
+{
+    ntsa::Error error;
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        error = d_shards[i]->registerSessionCallback(callback);
+        if (error) {
+            return error;
+        }
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error ShardedListenerSocket::registerSessionCallback(
+    const ntci::ListenerSocket::SessionCallback& callback,
+    const bsl::shared_ptr<ntci::Strand>&         strand)
+{
+    ntsa::Error error;
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        error = d_shards[i]->registerSessionCallback(callback, strand);
+        if (error) {
+            return error;
+        }
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error ShardedListenerSocket::deregisterSession()
+{
+    ntsa::Error error;
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        error = d_shards[i]->deregisterSession();
+        if (error) {
+            return error;
+        }
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error ShardedListenerSocket::setAcceptRateLimiter(
+    const bsl::shared_ptr<ntci::RateLimiter>& rateLimiter)
+{
+    ntsa::Error error;
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        error = d_shards[i]->setAcceptRateLimiter(rateLimiter);
+        if (error) {
+            return error;
+        }
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error ShardedListenerSocket::setAcceptQueueLowWatermark(
+    bsl::size_t lowWatermark)
+{
+    ntsa::Error error;
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        error = d_shards[i]->setAcceptQueueLowWatermark(lowWatermark);
+        if (error) {
+            return error;
+        }
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error ShardedListenerSocket::setAcceptQueueHighWatermark(
+    bsl::size_t highWatermark)
+{
+    ntsa::Error error;
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        error = d_shards[i]->setAcceptQueueHighWatermark(highWatermark);
+        if (error) {
+            return error;
+        }
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error ShardedListenerSocket::setAcceptQueueWatermarks(
+    bsl::size_t lowWatermark,
+    bsl::size_t highWatermark)
+{
+    ntsa::Error error;
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        error =
+            d_shards[i]->setAcceptQueueWatermarks(lowWatermark, highWatermark);
+        if (error) {
+            return error;
+        }
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error ShardedListenerSocket::relaxFlowControl(
+    ntca::FlowControlType::Value direction)
+{
+    ntsa::Error error;
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        error = d_shards[i]->relaxFlowControl(direction);
+        if (error) {
+            return error;
+        }
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error ShardedListenerSocket::applyFlowControl(
+    ntca::FlowControlType::Value direction,
+    ntca::FlowControlMode::Value mode)
+{
+    ntsa::Error error;
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        error = d_shards[i]->applyFlowControl(direction, mode);
+        if (error) {
+            return error;
+        }
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error ShardedListenerSocket::cancel(const ntca::BindToken& token)
+{
+    NTCCFG_WARNING_UNUSED(token);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ShardedListenerSocket::cancel(const ntca::AcceptToken& token)
+{
+    bsl::shared_ptr<ShardedListenerSocket> self = this->getSelf(this);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    for (RequestQueue::iterator it = d_requestQueue.begin();
+         it != d_requestQueue.end();
+         ++it)
+    {
+        if (!it->d_token.isNull() && it->d_token.value() == token) {
+            if (it->d_timer) {
+                it->d_timer->close();
+            }
+
+            ntci::AcceptCallback callback = it->d_callback;
+            d_requestQueue.erase(it);
+
+            this->privateComplete(self,
+                                  callback,
+                                  bsl::shared_ptr<ntci::StreamSocket>(),
+                                  ntsa::Error(ntsa::Error::e_CANCELLED),
+                                  true);
+
+            return ntsa::Error();
+        }
+    }
+
+    return ntsa::Error(ntsa::Error::e_INVALID);
+}
+
+ntsa::Error ShardedListenerSocket::shutdown()
+{
+    ntsa::Error result;
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        ntsa::Error error = d_shards[i]->shutdown();
+        if (error && !result) {
+            result = error;
+        }
+    }
+
+    return result;
+}
+
+void ShardedListenerSocket::close()
+{
+    this->close(ntci::CloseCallback());
+}
+
+void ShardedListenerSocket::close(const ntci::CloseFunction& callback)
+{
+    this->close(this->createCloseCallback(callback, d_allocator_p));
+}
+
+void ShardedListenerSocket::close(const ntci::CloseCallback& callback)
+{
+    bsl::shared_ptr<ShardedListenerSocket> self = this->getSelf(this);
+
+    bsl::shared_ptr<bsls::AtomicUint> numRemaining;
+    numRemaining.createInplace(
+        d_allocator_p,
+        static_cast<unsigned int>(d_shards.size()));
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        d_shards[i]->close(
+            NTCCFG_BIND(&ShardedListenerSocket::processShardClosed,
+                        self,
+                        numRemaining,
+                        callback));
+    }
+}
+
+void ShardedListenerSocket::execute(const Functor& functor)
+{
+    d_shards.front()->execute(functor);
+}
+
+void ShardedListenerSocket::moveAndExecute(FunctorSequence* functorSequence,
+                                           const Functor&   functor)
+{
+    d_shards.front()->moveAndExecute(functorSequence, functor);
+}
+
+bsl::shared_ptr<ntci::Strand> ShardedListenerSocket::createStrand(
+    bslma::Allocator* basicAllocator)
+{
+    return d_shards.front()->createStrand(basicAllocator);
+}
+
+bsl::shared_ptr<ntci::Timer> ShardedListenerSocket::createTimer(
+    const ntca::TimerOptions&                  options,
+    const bsl::shared_ptr<ntci::TimerSession>& session,
+    bslma::Allocator*                          basicAllocator)
+{
+    return d_shards.front()->createTimer(options, session, basicAllocator);
+}
+
+bsl::shared_ptr<ntci::Timer> ShardedListenerSocket::createTimer(
+    const ntca::TimerOptions&  options,
+    const ntci::TimerCallback& callback,
+    bslma::Allocator*          basicAllocator)
+{
+    return d_shards.front()->createTimer(options, callback, basicAllocator);
+}
+
+bsl::shared_ptr<ntsa::Data> ShardedListenerSocket::createIncomingData()
+{
+    return d_shards.front()->createIncomingData();
+}
+
+bsl::shared_ptr<ntsa::Data> ShardedListenerSocket::createOutgoingData()
+{
+    return d_shards.front()->createOutgoingData();
+}
+
+bsl::shared_ptr<bdlbb::Blob> ShardedListenerSocket::createIncomingBlob()
+{
+    return d_shards.front()->createIncomingBlob();
+}
+
+bsl::shared_ptr<bdlbb::Blob> ShardedListenerSocket::createOutgoingBlob()
+{
+    return d_shards.front()->createOutgoingBlob();
+}
+
+void ShardedListenerSocket::createIncomingBlobBuffer(
+    bdlbb::BlobBuffer* blobBuffer)
+{
+    d_shards.front()->createIncomingBlobBuffer(blobBuffer);
+}
+
+void ShardedListenerSocket::createOutgoingBlobBuffer(
+    bdlbb::BlobBuffer* blobBuffer)
+{
+    d_shards.front()->createOutgoingBlobBuffer(blobBuffer);
+}
+
+ntsa::Handle ShardedListenerSocket::handle() const
+{
+    return d_shards.front()->handle();
+}
+
+ntsa::Transport::Value ShardedListenerSocket::transport() const
+{
+    return d_shards.front()->transport();
+}
+
+ntsa::Endpoint ShardedListenerSocket::sourceEndpoint() const
+{
+    return d_shards.front()->sourceEndpoint();
+}
+
+const bsl::shared_ptr<ntci::Strand>& ShardedListenerSocket::strand() const
+{
+    return d_shards.front()->strand();
+}
+
+bslmt::ThreadUtil::Handle ShardedListenerSocket::threadHandle() const
+{
+    return d_shards.front()->threadHandle();
+}
+
+bsl::size_t ShardedListenerSocket::threadIndex() const
+{
+    return d_shards.front()->threadIndex();
+}
+
+bsl::size_t ShardedListenerSocket::acceptQueueSize() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    bsl::size_t result = d_streamSocketQueue.size();
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        result += d_shards[i]->acceptQueueSize();
+    }
+
+    return result;
+}
+
+bsl::size_t ShardedListenerSocket::acceptQueueLowWatermark() const
+{
+    return d_shards.front()->acceptQueueLowWatermark();
+}
+
+bsl::size_t ShardedListenerSocket::acceptQueueHighWatermark() const
+{
+    return d_shards.front()->acceptQueueHighWatermark();
+}
+
+bsls::TimeInterval ShardedListenerSocket::currentTime() const
+{
+    return d_shards.front()->currentTime();
+}
+
+const bsl::shared_ptr<bdlbb::BlobBufferFactory>& ShardedListenerSocket::
+    incomingBlobBufferFactory() const
+{
+    return d_shards.front()->incomingBlobBufferFactory();
+}
+
+const bsl::shared_ptr<bdlbb::BlobBufferFactory>& ShardedListenerSocket::
+    outgoingBlobBufferFactory() const
+{
+    return d_shards.front()->outgoingBlobBufferFactory();
+}
+
+bsl::size_t ShardedListenerSocket::numShards() const
+{
+    return d_shards.size();
+}
+
+const bsl::shared_ptr<ntci::ListenerSocket>& ShardedListenerSocket::shard(
+    bsl::size_t index) const
+{
+    BSLS_ASSERT(index < d_shards.size());
+    return d_shards[index];
+}
+
+}  // close package namespace
+}  // close enterprise namespace
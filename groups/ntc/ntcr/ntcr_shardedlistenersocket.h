@@ -0,0 +1,501 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCR_SHARDEDLISTENERSOCKET
+#define INCLUDED_NTCR_SHARDEDLISTENERSOCKET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntca_accepttoken.h>
+#include <ntccfg_platform.h>
+#include <ntci_listenersocket.h>
+#include <ntci_listenersocketmanager.h>
+#include <ntci_listenersocketsession.h>
+#include <ntci_resolver.h>
+#include <ntci_strand.h>
+#include <ntci_timer.h>
+#include <ntcscm_version.h>
+#include <ntsa_endpoint.h>
+#include <ntsa_error.h>
+#include <bdlb_nullablevalue.h>
+#include <bslmt_mutex.h>
+#include <bsls_atomic.h>
+#include <bsl_cstdint.h>
+#include <bsl_list.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ntcr {
+
+/// @internal @brief
+/// Provide a listener socket sharded across the threads of a reactor pool.
+///
+/// @details
+/// This class presents a single 'ntci::ListenerSocket' implemented by a set
+/// of listener socket shards, each driven by a different reactor and each
+/// bound to the same source endpoint with the "reuse port" option enabled,
+/// so that the operating system distributes incoming connections among the
+/// shards. Each shard accepts connections on the thread driving its reactor
+/// and attaches each accepted stream socket to that same reactor, so that a
+/// connection is accepted and subsequently processed by the same thread
+/// without any cross-thread handoff.
+///
+/// The first shard is bound first; the remaining shards are bound to the
+/// actual source endpoint of the first shard, so that binding to an
+/// ephemeral port results in all shards sharing the port chosen by the
+/// operating system. Listener socket sessions and managers are registered
+/// with every shard and are notified of events on each shard with that
+/// shard as the listener socket, so users accepting connections in response
+/// to accept queue events accept directly from the shard on which the
+/// connections are queued. Asynchronous accept operations initiated on this
+/// object are satisfied by whichever shard first accepts a connection; any
+/// connection subsequently accepted by another shard on behalf of the same
+/// operation is retained to satisfy the next accept operation. The deadline
+/// and token of an asynchronous accept operation are tracked by this object
+/// rather than by the shards, so an operation times out or is cancelled
+/// regardless of which shards are armed on its behalf.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntcr
+class ShardedListenerSocket : public ntci::ListenerSocket,
+                              public ntccfg::Shared<ShardedListenerSocket>
+{
+  public:
+    /// Define a type alias for a vector of listener socket shards.
+    typedef bsl::vector<bsl::shared_ptr<ntci::ListenerSocket> > ShardVector;
+
+  private:
+    /// Describe an asynchronous accept operation initiated on this object
+    /// that has not yet been satisfied.
+    struct Request {
+        bsl::uint64_t                          d_id;
+        ntci::AcceptCallback                   d_callback;
+        bdlb::NullableValue<ntca::AcceptToken> d_token;
+        bsl::shared_ptr<ntci::Timer>           d_timer;
+    };
+
+    /// Define a type alias for a queue of pending accept operations.
+    typedef bsl::list<Request> RequestQueue;
+
+    /// Define a type alias for a queue of stream sockets accepted by the
+    /// shards that have not yet been delivered to any accept operation.
+    typedef bsl::list<bsl::shared_ptr<ntci::StreamSocket> > StreamSocketQueue;
+
+    ntccfg::Object       d_object;
+    mutable bslmt::Mutex d_mutex;
+    ShardVector          d_shards;
+    bsl::vector<char>    d_armed;
+    bsl::vector<char>    d_closed;
+    RequestQueue         d_requestQueue;
+    StreamSocketQueue    d_streamSocketQueue;
+    bsls::AtomicUint     d_cursor;
+    bsl::uint64_t        d_requestId;
+    bslma::Allocator*    d_allocator_p;
+
+  private:
+    ShardedListenerSocket(const ShardedListenerSocket&) BSLS_KEYWORD_DELETED;
+    ShardedListenerSocket& operator=(const ShardedListenerSocket&)
+        BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Process the completion of the bind of the first shard to the
+    /// resolution of a name, then bind the remaining shards to the
+    /// resulting source endpoint and invoke the specified 'callback' with
+    /// the specified 'event'.
+    void processShardBound(const bsl::shared_ptr<ntci::Bindable>& bindable,
+                           const ntca::BindEvent&                 event,
+                           const ntca::BindOptions&               options,
+                           const ntci::BindCallback&              callback);
+
+    /// Process the completion of an accept operation initiated on the shard
+    /// at the specified 'index', according to the specified 'event', that
+    /// resulted in the specified 'streamSocket', if any.
+    void processShardAccepted(
+        bsl::size_t                                index,
+        const bsl::shared_ptr<ntci::Acceptor>&     acceptor,
+        const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+        const ntca::AcceptEvent&                   event);
+
+    /// Process the specified 'event' of the specified 'timer' scheduled at
+    /// the deadline of the pending accept operation identified by the
+    /// specified 'requestId', failing that operation with
+    /// 'ntsa::Error::e_WOULD_BLOCK' if it is still pending.
+    void processAcceptDeadlineTimer(const bsl::shared_ptr<ntci::Timer>& timer,
+                                    const ntca::TimerEvent&             event,
+                                    bsl::uint64_t requestId);
+
+    /// Process the closure of a shard, invoking the specified 'callback'
+    /// once the specified 'numRemaining' shards have all been closed.
+    void processShardClosed(
+        const bsl::shared_ptr<bsls::AtomicUint>& numRemaining,
+        const ntci::CloseCallback&               callback);
+
+    /// Bind each shard except the first to the specified 'endpoint'.
+    /// Return the error.
+    ntsa::Error privateBindRemaining(const ntsa::Endpoint& endpoint);
+
+    /// Load into the specified 'result' the index of each shard that is
+    /// not closed and that does not already have an accept operation
+    /// pending, and mark each such shard as having an accept operation
+    /// pending, provided any accept operation initiated on this object is
+    /// pending. The behavior is undefined unless 'd_mutex' is locked.
+    void privateArm(bsl::vector<bsl::size_t>* result);
+
+    /// Initiate an asynchronous accept operation on each shard identified
+    /// by its index in the specified 'indexes'. The behavior is undefined
+    /// unless 'd_mutex' is not locked.
+    void privateArmShards(const bsl::vector<bsl::size_t>& indexes);
+
+    /// Mark the shard at the specified 'index' as closed and, if every
+    /// shard is closed, fail each pending accept operation. The behavior
+    /// is undefined unless 'd_mutex' is locked.
+    void privateShardClosed(
+        const bsl::shared_ptr<ShardedListenerSocket>& self,
+        bsl::size_t                                   index);
+
+    /// Pop the front of the queue of connections accepted by the shards
+    /// but not yet delivered into the specified 'result', if any, or
+    /// otherwise attempt to synchronously accept a connection from any
+    /// shard, in round-robin order, according to the specified 'options'
+    /// and load the accept context into the specified 'context'. Return
+    /// the error. The behavior is undefined unless 'd_mutex' is locked.
+    ntsa::Error privateAccept(ntca::AcceptContext*                 context,
+                              bsl::shared_ptr<ntci::StreamSocket>* result,
+                              const ntca::AcceptOptions&           options);
+
+    /// Remove the front of the queue of pending accept operations, closing
+    /// its deadline timer, if any, and load its callback into the specified
+    /// 'result'. The behavior is undefined unless 'd_mutex' is locked and
+    /// the queue of pending accept operations is not empty.
+    void privatePopRequest(ntci::AcceptCallback* result);
+
+    /// Invoke the specified 'callback' with the specified 'streamSocket',
+    /// if any, and the specified 'error', deferring the invocation if the
+    /// specified 'defer' flag is true. The behavior is undefined unless
+    /// 'd_mutex' is locked.
+    void privateComplete(
+        const bsl::shared_ptr<ShardedListenerSocket>& self,
+        const ntci::AcceptCallback&                   callback,
+        const bsl::shared_ptr<ntci::StreamSocket>&    streamSocket,
+        const ntsa::Error&                            error,
+        bool                                          defer);
+
+  public:
+    /// Create a new listener socket implemented by the specified 'shards'.
+    /// Optionally specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used. The behavior is undefined unless 'shards' is not empty and
+    /// each shard is configured to reuse its port.
+    explicit ShardedListenerSocket(
+        const bsl::vector<bsl::shared_ptr<ntci::ListenerSocket> >& shards,
+        bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~ShardedListenerSocket() BSLS_KEYWORD_OVERRIDE;
+
+    /// Open each shard. Return the error.
+    ntsa::Error open() BSLS_KEYWORD_OVERRIDE;
+
+    /// Open each shard using the specified 'transport'. Return the error.
+    ntsa::Error open(ntsa::Transport::Value transport) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return 'ntsa::Error::e_NOT_IMPLEMENTED': a single imported 'handle'
+    /// cannot be shared by multiple shards.
+    ntsa::Error open(ntsa::Transport::Value transport,
+                     ntsa::Handle           handle) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return 'ntsa::Error::e_NOT_IMPLEMENTED': a single imported
+    /// 'listenerSocket' cannot be shared by multiple shards.
+    ntsa::Error open(ntsa::Transport::Value transport,
+                     const bsl::shared_ptr<ntsi::ListenerSocket>&
+                         listenerSocket) BSLS_KEYWORD_OVERRIDE;
+
+    /// Bind the first shard to the specified source 'endpoint' and each
+    /// remaining shard to the resulting source endpoint of the first shard
+    /// according to the specified 'options'. Invoke the specified
+    /// 'callback' on the callback's strand, if any, when the shards have
+    /// been bound or any error occurs. Return the error.
+    ntsa::Error bind(const ntsa::Endpoint&     endpoint,
+                     const ntca::BindOptions&  options,
+                     const ntci::BindFunction& callback) BSLS_KEYWORD_OVERRIDE;
+
+    /// Bind the first shard to the specified source 'endpoint' and each
+    /// remaining shard to the resulting source endpoint of the first shard
+    /// according to the specified 'options'. Invoke the specified
+    /// 'callback' on the callback's strand, if any, when the shards have
+    /// been bound or any error occurs. Return the error.
+    ntsa::Error bind(const ntsa::Endpoint&     endpoint,
+                     const ntca::BindOptions&  options,
+                     const ntci::BindCallback& callback) BSLS_KEYWORD_OVERRIDE;
+
+    /// Bind the first shard to the resolution of the specified 'name' and
+    /// each remaining shard to the resulting source endpoint of the first
+    /// shard according to the specified 'options'. Invoke the specified
+    /// 'callback' on the callback's strand, if any, when the shards have
+    /// been bound or any error occurs. Return the error.
+    ntsa::Error bind(const bsl::string&        name,
+                     const ntca::BindOptions&  options,
+                     const ntci::BindFunction& callback) BSLS_KEYWORD_OVERRIDE;
+
+    /// Bind the first shard to the resolution of the specified 'name' and
+    /// each remaining shard to the resulting source endpoint of the first
+    /// shard according to the specified 'options'. Invoke the specified
+    /// 'callback' on the callback's strand, if any, when the shards have
+    /// been bound or any error occurs. Return the error.
+    ntsa::Error bind(const bsl::string&        name,
+                     const ntca::BindOptions&  options,
+                     const ntci::BindCallback& callback) BSLS_KEYWORD_OVERRIDE;
+
+    /// Listen for connections on each shard. Return the error.
+    ntsa::Error listen() BSLS_KEYWORD_OVERRIDE;
+
+    /// Listen for connections on each shard using the specified 'backlog'
+    /// per shard. Return the error.
+    ntsa::Error listen(bsl::size_t backlog) BSLS_KEYWORD_OVERRIDE;
+
+    /// Synchronously pop the front of the accept queue of the next shard,
+    /// in round-robin order, whose accept queue is not empty into the
+    /// specified 'streamSocket'. Return the error, notably
+    /// 'ntsa::Error::e_WOULD_BLOCK' if no shard has any accepted
+    /// connections.
+    ntsa::Error accept(ntca::AcceptContext*                 context,
+                       bsl::shared_ptr<ntci::StreamSocket>* streamSocket,
+                       const ntca::AcceptOptions&           options)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Dequeue a connection from any shard according to the specified
+    /// 'options' and invoke the specified 'callback' on the callback's
+    /// strand, if any, with the resulting stream socket. Return the error.
+    ntsa::Error accept(const ntca::AcceptOptions&  options,
+                       const ntci::AcceptFunction& callback)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Dequeue a connection from any shard according to the specified
+    /// 'options' and invoke the specified 'callback' on the callback's
+    /// strand, if any, with the resulting stream socket. Return the error.
+    ntsa::Error accept(const ntca::AcceptOptions&  options,
+                       const ntci::AcceptCallback& callback)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Register the specified 'resolver' for each shard. Return the error.
+    ntsa::Error registerResolver(
+        const bsl::shared_ptr<ntci::Resolver>& resolver) BSLS_KEYWORD_OVERRIDE;
+
+    /// Deregister the current resolver for each shard. Return the error.
+    ntsa::Error deregisterResolver() BSLS_KEYWORD_OVERRIDE;
+
+    /// Register the specified 'manager' for each shard. Return the error.
+    ntsa::Error registerManager(
+        const bsl::shared_ptr<ntci::ListenerSocketManager>& manager)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Deregister the current manager for each shard. Return the error.
+    ntsa::Error deregisterManager() BSLS_KEYWORD_OVERRIDE;
+
+    /// Register the specified 'session' for each shard. Return the error.
+    ntsa::Error registerSession(
+        const bsl::shared_ptr<ntci::ListenerSocketSession>& session)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Register the specified session 'callback' for each shard to be
+    /// invoked on that shard's strand. Return the error.
+    ntsa::Error registerSessionCallback(
+        const ntci::ListenerSocket::SessionCallback& callback)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Register the specified session 'callback' for each shard to be
+    /// invoked on the specified 'strand'. Return the error.
+    ntsa::Error registerSessionCallback(
+        const ntci::ListenerSocket::SessionCallback& callback,
+        const bsl::shared_ptr<ntci::Strand>& strand) BSLS_KEYWORD_OVERRIDE;
+
+    /// Deregister the current session or session callback for each shard.
+    /// Return the error.
+    ntsa::Error deregisterSession() BSLS_KEYWORD_OVERRIDE;
+
+    /// Set the accept rate limiter of each shard to the specified
+    /// 'rateLimiter'. Return the error.
+    ntsa::Error setAcceptRateLimiter(const bsl::shared_ptr<ntci::RateLimiter>&
+                                         rateLimiter) BSLS_KEYWORD_OVERRIDE;
+
+    /// Set the accept queue low watermark of each shard to the specified
+    /// 'lowWatermark'. Return the error.
+    ntsa::Error setAcceptQueueLowWatermark(bsl::size_t lowWatermark)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Set the accept queue high watermark of each shard to the specified
+    /// 'highWatermark'. Return the error.
+    ntsa::Error setAcceptQueueHighWatermark(bsl::size_t highWatermark)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Set the accept queue limits of each shard to the specified
+    /// 'lowWatermark' and 'highWatermark'. Return the error.
+    ntsa::Error setAcceptQueueWatermarks(bsl::size_t lowWatermark,
+                                         bsl::size_t highWatermark)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Enable copying from the socket buffers of each shard in the
+    /// specified 'direction'.
+    ntsa::Error relaxFlowControl(ntca::FlowControlType::Value direction)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Disable copying from socket buffers of each shard in the specified
+    /// 'direction' according to the specified 'mode'.
+    ntsa::Error applyFlowControl(ntca::FlowControlType::Value direction,
+                                 ntca::FlowControlMode::Value mode)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Cancel the bind operation identified by the specified 'token'.
+    /// Return the error.
+    ntsa::Error cancel(const ntca::BindToken& token) BSLS_KEYWORD_OVERRIDE;
+
+    /// Cancel the accept operation identified by the specified 'token'.
+    /// Return the error.
+    ntsa::Error cancel(const ntca::AcceptToken& token) BSLS_KEYWORD_OVERRIDE;
+
+    /// Shutdown each shard. Return the error.
+    ntsa::Error shutdown() BSLS_KEYWORD_OVERRIDE;
+
+    /// Close each shard.
+    void close() BSLS_KEYWORD_OVERRIDE;
+
+    /// Close each shard and invoke the specified 'callback' on the
+    /// callback's strand, if any, when every shard is closed.
+    void close(const ntci::CloseFunction& callback) BSLS_KEYWORD_OVERRIDE;
+
+    /// Close each shard and invoke the specified 'callback' on the
+    /// callback's strand, if any, when every shard is closed.
+    void close(const ntci::CloseCallback& callback) BSLS_KEYWORD_OVERRIDE;
+
+    /// Defer the execution of the specified 'functor' on the first shard.
+    void execute(const Functor& functor) BSLS_KEYWORD_OVERRIDE;
+
+    /// Atomically defer the execution of the specified 'functorSequence'
+    /// immediately followed by the specified 'functor' on the first shard,
+    /// then clear the 'functorSequence'.
+    void moveAndExecute(FunctorSequence* functorSequence,
+                        const Functor&   functor) BSLS_KEYWORD_OVERRIDE;
+
+    /// Create a new strand to serialize execution of functors on the
+    /// threads driving the first shard. Optionally specify a
+    /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
+    /// the currently installed default allocator is used.
+    bsl::shared_ptr<ntci::Strand> createStrand(
+        bslma::Allocator* basicAllocator = 0) BSLS_KEYWORD_OVERRIDE;
+
+    /// Create a new timer driven by the first shard according to the
+    /// specified 'options' that invokes the specified 'session' for each
+    /// timer event. Optionally specify a 'basicAllocator' used to supply
+    /// memory. If 'basicAllocator' is 0, the currently installed default
+    /// allocator is used.
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&                  options,
+        const bsl::shared_ptr<ntci::TimerSession>& session,
+        bslma::Allocator* basicAllocator = 0) BSLS_KEYWORD_OVERRIDE;
+
+    /// Create a new timer driven by the first shard according to the
+    /// specified 'options' that invokes the specified 'callback' for each
+    /// timer event. Optionally specify a 'basicAllocator' used to supply
+    /// memory. If 'basicAllocator' is 0, the currently installed default
+    /// allocator is used.
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&  options,
+        const ntci::TimerCallback& callback,
+        bslma::Allocator*          basicAllocator = 0) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return a shared pointer to a data container suitable for storing
+    /// incoming data.
+    bsl::shared_ptr<ntsa::Data> createIncomingData() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return a shared pointer to a data container suitable for storing
+    /// outgoing data.
+    bsl::shared_ptr<ntsa::Data> createOutgoingData() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return a shared pointer to a blob suitable for storing incoming
+    /// data.
+    bsl::shared_ptr<bdlbb::Blob> createIncomingBlob() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return a shared pointer to a blob suitable for storing outgoing
+    /// data.
+    bsl::shared_ptr<bdlbb::Blob> createOutgoingBlob() BSLS_KEYWORD_OVERRIDE;
+
+    /// Load into the specified 'blobBuffer' the data and size of a new
+    /// buffer allocated from the incoming blob buffer factory.
+    void createIncomingBlobBuffer(bdlbb::BlobBuffer* blobBuffer)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Load into the specified 'blobBuffer' the data and size of a new
+    /// buffer allocated from the outgoing blob buffer factory.
+    void createOutgoingBlobBuffer(bdlbb::BlobBuffer* blobBuffer)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the descriptor handle of the first shard.
+    ntsa::Handle handle() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the transport of the listener socket.
+    ntsa::Transport::Value transport() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the source endpoint shared by each shard.
+    ntsa::Endpoint sourceEndpoint() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the strand of the first shard.
+    const bsl::shared_ptr<ntci::Strand>& strand() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the handle of the thread that manages the first shard, or
+    /// the default value if no such thread has been set.
+    bslmt::ThreadUtil::Handle threadHandle() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the index in the thread pool of the thread that manages the
+    /// first shard, or 0 if no such thread has been set.
+    bsl::size_t threadIndex() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the total number of connections queued after being accepted
+    /// from the backlog of any shard, including connections accepted by a
+    /// shard but not yet delivered to any accept operation.
+    bsl::size_t acceptQueueSize() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the accept queue low watermark of each shard.
+    bsl::size_t acceptQueueLowWatermark() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the accept queue high watermark of each shard.
+    bsl::size_t acceptQueueHighWatermark() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the current elapsed time since the Unix epoch.
+    bsls::TimeInterval currentTime() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the incoming blob buffer factory.
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>& incomingBlobBufferFactory()
+        const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the outgoing blob buffer factory.
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>& outgoingBlobBufferFactory()
+        const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the number of shards.
+    bsl::size_t numShards() const;
+
+    /// Return the shard at the specified 'index'. The behavior is undefined
+    /// unless 'index < numShards()'.
+    const bsl::shared_ptr<ntci::ListenerSocket>& shard(
+        bsl::size_t index) const;
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
@@ -0,0 +1,1219 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcr_shardedlistenersocket.h>
+
+#include <ntccfg_bind.h>
+#include <ntccfg_test.h>
+#include <ntcd_reactor.h>
+#include <ntcd_simulation.h>
+#include <ntci_log.h>
+#include <ntcr_streamsocket.h>
+#include <ntcs_datapool.h>
+#include <ntcs_user.h>
+#include <ntsa_error.h>
+#include <ntsa_transport.h>
+#include <bdlt_currenttime.h>
+#include <bsl_list.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The sharded listener socket is tested against shards implemented by a
+// test double, so that the order in which each shard binds, accepts, and
+// fails is controlled by the test. The simulation is only used to create
+// the stream sockets the shards report as accepted.
+//-----------------------------------------------------------------------------
+
+// [ 1] Binding to port 0 binds every shard to the resolved port.
+// [ 2] Synchronous accepts are satisfied by the shards in round-robin order.
+// [ 3] Connections accepted by a shard with no pending accept are queued.
+// [ 4] An accept pending when every shard has closed fails with EOF.
+//-----------------------------------------------------------------------------
+
+namespace test {
+
+/// Provide a listener socket shard whose accepted connections and failures
+/// are injected by the test.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+class Shard : public ntci::ListenerSocket, public ntccfg::Shared<Shard>
+{
+    typedef bsl::list<bsl::shared_ptr<ntci::StreamSocket> > StreamSocketQueue;
+
+    ntsa::Port                                d_ephemeralPort;
+    ntsa::Endpoint                            d_sourceEndpoint;
+    StreamSocketQueue                         d_backlog;
+    ntci::AcceptCallback                      d_acceptCallback;
+    bsl::size_t                               d_numArmed;
+    bool                                      d_closed;
+    FunctorSequence                           d_functorQueue;
+    bsl::shared_ptr<ntci::Strand>             d_strand_sp;
+    bsl::shared_ptr<bdlbb::BlobBufferFactory> d_blobBufferFactory_sp;
+    bslma::Allocator*                         d_allocator_p;
+
+  private:
+    Shard(const Shard&) BSLS_KEYWORD_DELETED;
+    Shard& operator=(const Shard&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new shard that, when bound to port 0, binds to the
+    /// specified 'ephemeralPort'. Optionally specify a 'basicAllocator'
+    /// used to supply memory. If 'basicAllocator' is 0, the currently
+    /// installed default allocator is used.
+    explicit Shard(ntsa::Port ephemeralPort, bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~Shard() BSLS_KEYWORD_OVERRIDE;
+
+    /// Queue the specified 'streamSocket' in the backlog to be popped by
+    /// the next synchronous accept.
+    void enqueue(const bsl::shared_ptr<ntci::StreamSocket>& streamSocket);
+
+    /// Complete the pending asynchronous accept with the specified
+    /// 'streamSocket'. The behavior is undefined unless an asynchronous
+    /// accept is pending.
+    void complete(const bsl::shared_ptr<ntci::StreamSocket>& streamSocket);
+
+    /// Fail the pending asynchronous accept, if any, with the specified
+    /// 'error', and fail each subsequent accept with the same error.
+    void fail(const ntsa::Error& error);
+
+    /// Invoke each functor deferred onto this shard.
+    void drain();
+
+    /// Return true if an asynchronous accept is pending, otherwise return
+    /// false.
+    bool isArmed() const;
+
+    /// Return the number of asynchronous accepts initiated on this shard.
+    bsl::size_t numArmed() const;
+
+    ntsa::Error open() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(ntsa::Transport::Value transport) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(ntsa::Transport::Value transport,
+                     ntsa::Handle           handle) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(ntsa::Transport::Value transport,
+                     const bsl::shared_ptr<ntsi::ListenerSocket>&
+                         listenerSocket) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const ntsa::Endpoint&     endpoint,
+                     const ntca::BindOptions&  options,
+                     const ntci::BindFunction& callback) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const ntsa::Endpoint&     endpoint,
+                     const ntca::BindOptions&  options,
+                     const ntci::BindCallback& callback) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const bsl::string&        name,
+                     const ntca::BindOptions&  options,
+                     const ntci::BindFunction& callback) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const bsl::string&        name,
+                     const ntca::BindOptions&  options,
+                     const ntci::BindCallback& callback) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error listen() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error listen(bsl::size_t backlog) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error accept(ntca::AcceptContext*                 context,
+                       bsl::shared_ptr<ntci::StreamSocket>* streamSocket,
+                       const ntca::AcceptOptions&           options)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error accept(const ntca::AcceptOptions&  options,
+                       const ntci::AcceptFunction& callback)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error accept(const ntca::AcceptOptions&  options,
+                       const ntci::AcceptCallback& callback)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerResolver(
+        const bsl::shared_ptr<ntci::Resolver>& resolver) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error deregisterResolver() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerManager(
+        const bsl::shared_ptr<ntci::ListenerSocketManager>& manager)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error deregisterManager() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerSession(
+        const bsl::shared_ptr<ntci::ListenerSocketSession>& session)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerSessionCallback(
+        const ntci::ListenerSocket::SessionCallback& callback)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerSessionCallback(
+        const ntci::ListenerSocket::SessionCallback& callback,
+        const bsl::shared_ptr<ntci::Strand>& strand) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error deregisterSession() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setAcceptRateLimiter(const bsl::shared_ptr<ntci::RateLimiter>&
+                                         rateLimiter) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setAcceptQueueLowWatermark(bsl::size_t lowWatermark)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setAcceptQueueHighWatermark(bsl::size_t highWatermark)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setAcceptQueueWatermarks(bsl::size_t lowWatermark,
+                                         bsl::size_t highWatermark)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error relaxFlowControl(ntca::FlowControlType::Value direction)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error applyFlowControl(ntca::FlowControlType::Value direction,
+                                 ntca::FlowControlMode::Value mode)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::BindToken& token) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::AcceptToken& token) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error shutdown() BSLS_KEYWORD_OVERRIDE;
+    void        close() BSLS_KEYWORD_OVERRIDE;
+    void close(const ntci::CloseFunction& callback) BSLS_KEYWORD_OVERRIDE;
+    void close(const ntci::CloseCallback& callback) BSLS_KEYWORD_OVERRIDE;
+    void execute(const Functor& functor) BSLS_KEYWORD_OVERRIDE;
+    void moveAndExecute(FunctorSequence* functorSequence,
+                        const Functor&   functor) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Strand> createStrand(
+        bslma::Allocator* basicAllocator = 0) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&                  options,
+        const bsl::shared_ptr<ntci::TimerSession>& session,
+        bslma::Allocator* basicAllocator = 0) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&  options,
+        const ntci::TimerCallback& callback,
+        bslma::Allocator*          basicAllocator = 0) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntsa::Data>  createIncomingData() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntsa::Data>  createOutgoingData() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<bdlbb::Blob> createIncomingBlob() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<bdlbb::Blob> createOutgoingBlob() BSLS_KEYWORD_OVERRIDE;
+    void createIncomingBlobBuffer(bdlbb::BlobBuffer* blobBuffer)
+        BSLS_KEYWORD_OVERRIDE;
+    void createOutgoingBlobBuffer(bdlbb::BlobBuffer* blobBuffer)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Handle           handle() const BSLS_KEYWORD_OVERRIDE;
+    ntsa::Transport::Value transport() const BSLS_KEYWORD_OVERRIDE;
+    ntsa::Endpoint         sourceEndpoint() const BSLS_KEYWORD_OVERRIDE;
+    const bsl::shared_ptr<ntci::Strand>& strand() const BSLS_KEYWORD_OVERRIDE;
+    bslmt::ThreadUtil::Handle threadHandle() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t               threadIndex() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t acceptQueueSize() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t acceptQueueLowWatermark() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t acceptQueueHighWatermark() const BSLS_KEYWORD_OVERRIDE;
+    bsls::TimeInterval currentTime() const BSLS_KEYWORD_OVERRIDE;
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>& incomingBlobBufferFactory()
+        const BSLS_KEYWORD_OVERRIDE;
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>& outgoingBlobBufferFactory()
+        const BSLS_KEYWORD_OVERRIDE;
+};
+
+Shard::Shard(ntsa::Port ephemeralPort, bslma::Allocator* basicAllocator)
+: d_ephemeralPort(ephemeralPort)
+, d_sourceEndpoint()
+, d_backlog(basicAllocator)
+, d_acceptCallback(basicAllocator)
+, d_numArmed(0)
+, d_closed(false)
+, d_functorQueue(basicAllocator)
+, d_strand_sp()
+, d_blobBufferFactory_sp()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+Shard::~Shard()
+{
+}
+
+void Shard::enqueue(const bsl::shared_ptr<ntci::StreamSocket>& streamSocket)
+{
+    d_backlog.push_back(streamSocket);
+}
+
+void Shard::complete(const bsl::shared_ptr<ntci::StreamSocket>& streamSocket)
+{
+    NTCCFG_TEST_TRUE(d_acceptCallback);
+
+    ntci::AcceptCallback callback = d_acceptCallback;
+    d_acceptCallback.reset();
+
+    ntca::AcceptEvent event;
+    event.setType(ntca::AcceptEventType::e_COMPLETE);
+
+    callback(this->getSelf(this),
+             streamSocket,
+             event,
+             ntci::Strand::unknown());
+}
+
+void Shard::fail(const ntsa::Error& error)
+{
+    d_closed = true;
+
+    if (!d_acceptCallback) {
+        return;
+    }
+
+    ntci::AcceptCallback callback = d_acceptCallback;
+    d_acceptCallback.reset();
+
+    ntca::AcceptContext context;
+    context.setError(error);
+
+    ntca::AcceptEvent event;
+    event.setType(ntca::AcceptEventType::e_ERROR);
+    event.setContext(context);
+
+    callback(this->getSelf(this),
+             bsl::shared_ptr<ntci::StreamSocket>(),
+             event,
+             ntci::Strand::unknown());
+}
+
+void Shard::drain()
+{
+    while (!d_functorQueue.empty()) {
+        Functor functor = d_functorQueue.front();
+        d_functorQueue.pop_front();
+        functor();
+    }
+}
+
+bool Shard::isArmed() const
+{
+    return static_cast<bool>(d_acceptCallback);
+}
+
+bsl::size_t Shard::numArmed() const
+{
+    return d_numArmed;
+}
+
+ntsa::Error Shard::open()
+{
+    return ntsa::Error();
+}
+
+ntsa::Error Shard::open(ntsa::Transport::Value transport)
+{
+    NTCCFG_WARNING_UNUSED(transport);
+    return ntsa::Error();
+}
+
+ntsa::Error Shard::open(ntsa::Transport::Value transport, ntsa::Handle handle)
+{
+    NTCCFG_WARNING_UNUSED(transport);
+    NTCCFG_WARNING_UNUSED(handle);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Shard::open(
+    ntsa::Transport::Value                       transport,
+    const bsl::shared_ptr<ntsi::ListenerSocket>& listenerSocket)
+{
+    NTCCFG_WARNING_UNUSED(transport);
+    NTCCFG_WARNING_UNUSED(listenerSocket);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Shard::bind(const ntsa::Endpoint&     endpoint,
+                        const ntca::BindOptions&  options,
+                        const ntci::BindFunction& callback)
+{
+    return this->bind(endpoint,
+                      options,
+                      this->createBindCallback(callback, d_allocator_p));
+}
+
+ntsa::Error Shard::bind(const ntsa::Endpoint&     endpoint,
+                        const ntca::BindOptions&  options,
+                        const ntci::BindCallback& callback)
+{
+    NTCCFG_WARNING_UNUSED(options);
+    NTCCFG_TEST_FALSE(callback);
+
+    if (!d_sourceEndpoint.isUndefined()) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    if (!endpoint.isIp()) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    ntsa::Port port = endpoint.ip().port();
+    if (port == 0) {
+        port = d_ephemeralPort;
+    }
+
+    d_sourceEndpoint =
+        ntsa::Endpoint(ntsa::IpEndpoint(endpoint.ip().host(), port));
+
+    return ntsa::Error();
+}
+
+ntsa::Error Shard::bind(const bsl::string&        name,
+                        const ntca::BindOptions&  options,
+                        const ntci::BindFunction& callback)
+{
+    NTCCFG_WARNING_UNUSED(name);
+    NTCCFG_WARNING_UNUSED(options);
+    NTCCFG_WARNING_UNUSED(callback);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Shard::bind(const bsl::string&        name,
+                        const ntca::BindOptions&  options,
+                        const ntci::BindCallback& callback)
+{
+    NTCCFG_WARNING_UNUSED(name);
+    NTCCFG_WARNING_UNUSED(options);
+    NTCCFG_WARNING_UNUSED(callback);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Shard::listen()
+{
+    return ntsa::Error();
+}
+
+ntsa::Error Shard::listen(bsl::size_t backlog)
+{
+    NTCCFG_WARNING_UNUSED(backlog);
+    return ntsa::Error();
+}
+
+ntsa::Error Shard::accept(ntca::AcceptContext*                 context,
+                          bsl::shared_ptr<ntci::StreamSocket>* streamSocket,
+                          const ntca::AcceptOptions&           options)
+{
+    NTCCFG_WARNING_UNUSED(context);
+    NTCCFG_WARNING_UNUSED(options);
+
+    if (!d_backlog.empty()) {
+        *streamSocket = d_backlog.front();
+        d_backlog.pop_front();
+        return ntsa::Error();
+    }
+
+    if (d_closed) {
+        return ntsa::Error(ntsa::Error::e_EOF);
+    }
+
+    return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+}
+
+ntsa::Error Shard::accept(const ntca::AcceptOptions&  options,
+                          const ntci::AcceptFunction& callback)
+{
+    return this->accept(options,
+                        this->createAcceptCallback(callback, d_allocator_p));
+}
+
+ntsa::Error Shard::accept(const ntca::AcceptOptions&  options,
+                          const ntci::AcceptCallback& callback)
+{
+    NTCCFG_WARNING_UNUSED(options);
+
+    if (d_closed) {
+        return ntsa::Error(ntsa::Error::e_EOF);
+    }
+
+    NTCCFG_TEST_FALSE(d_acceptCallback);
+
+    d_acceptCallback = callback;
+    ++d_numArmed;
+
+    return ntsa::Error();
+}
+
+ntsa::Error Shard::registerResolver(
+    const bsl::shared_ptr<ntci::Resolver>& resolver)
+{
+    NTCCFG_WARNING_UNUSED(resolver);
+    return ntsa::Error();
+}
+
+ntsa::Error Shard::deregisterResolver()
+{
+    return ntsa::Error();
+}
+
+ntsa::Error Shard::registerManager(
+    const bsl::shared_ptr<ntci::ListenerSocketManager>& manager)
+{
+    NTCCFG_WARNING_UNUSED(manager);
+    return ntsa::Error();
+}
+
+ntsa::Error Shard::deregisterManager()
+{
+    return ntsa::Error();
+}
+
+ntsa::Error Shard::registerSession(
+    const bsl::shared_ptr<ntci::ListenerSocketSession>& session)
+{
+    NTCCFG_WARNING_UNUSED(session);
+    return ntsa::Error();
+}
+
+ntsa::Error Shard::registerSessionCallback(
+    const ntci::ListenerSocket::SessionCallback& callback)
+{
+    NTCCFG_WARNING_UNUSED(callback);
+    return ntsa::Error();
+}
+
+ntsa::Error Shard::registerSessionCallback(
+    const ntci::ListenerSocket::SessionCallback& callback,
+    const bsl::shared_ptr<ntci::Strand>&         strand)
+{
+    NTCCFG_WARNING_UNUSED(callback);
+    NTCCFG_WARNING_UNUSED(strand);
+    return ntsa::Error();
+}
+
+ntsa::Error Shard::deregisterSession()
+{
+    return ntsa::Error();
+}
+
+ntsa::Error Shard::setAcceptRateLimiter(
+    const bsl::shared_ptr<ntci::RateLimiter>& rateLimiter)
+{
+    NTCCFG_WARNING_UNUSED(rateLimiter);
+    return ntsa::Error();
+}
+
+ntsa::Error Shard::setAcceptQueueLowWatermark(bsl::size_t lowWatermark)
+{
+    NTCCFG_WARNING_UNUSED(lowWatermark);
+    return ntsa::Error();
+}
+
+ntsa::Error Shard::setAcceptQueueHighWatermark(bsl::size_t highWatermark)
+{
+    NTCCFG_WARNING_UNUSED(highWatermark);
+    return ntsa::Error();
+}
+
+ntsa::Error Shard::setAcceptQueueWatermarks(bsl::size_t lowWatermark,
+                                            bsl::size_t highWatermark)
+{
+    NTCCFG_WARNING_UNUSED(lowWatermark);
+    NTCCFG_WARNING_UNUSED(highWatermark);
+    return ntsa::Error();
+}
+
+ntsa::Error Shard::relaxFlowControl(ntca::FlowControlType::Value direction)
+{
+    NTCCFG_WARNING_UNUSED(direction);
+    return ntsa::Error();
+}
+
+ntsa::Error Shard::applyFlowControl(ntca::FlowControlType::Value direction,
+                                    ntca::FlowControlMode::Value mode)
+{
+    NTCCFG_WARNING_UNUSED(direction);
+    NTCCFG_WARNING_UNUSED(mode);
+    return ntsa::Error();
+}
+
+ntsa::Error Shard::cancel(const ntca::BindToken& token)
+{
+    NTCCFG_WARNING_UNUSED(token);
+    return ntsa::Error(ntsa::Error::e_INVALID);
+}
+
+ntsa::Error Shard::cancel(const ntca::AcceptToken& token)
+{
+    NTCCFG_WARNING_UNUSED(token);
+    return ntsa::Error(ntsa::Error::e_INVALID);
+}
+
+ntsa::Error Shard::shutdown()
+{
+    return ntsa::Error();
+}
+
+void Shard::close()
+{
+    this->close(ntci::CloseCallback());
+}
+
+void Shard::close(const ntci::CloseFunction& callback)
+{
+    this->close(this->createCloseCallback(callback, d_allocator_p));
+}
+
+void Shard::close(const ntci::CloseCallback& callback)
+{
+    // Fail any pending accept, as a closed listener socket does, so that
+    // the sharded listener socket releases the callback bound to it.
+
+    this->fail(ntsa::Error(ntsa::Error::e_EOF));
+
+    if (callback) {
+        callback(ntci::Strand::unknown());
+    }
+}
+
+void Shard::execute(const Functor& functor)
+{
+    d_functorQueue.push_back(functor);
+}
+
+void Shard::moveAndExecute(FunctorSequence* functorSequence,
+                           const Functor&   functor)
+{
+    d_functorQueue.splice(d_functorQueue.end(), *functorSequence);
+    if (functor) {
+        d_functorQueue.push_back(functor);
+    }
+}
+
+bsl::shared_ptr<ntci::Strand> Shard::createStrand(
+    bslma::Allocator* basicAllocator)
+{
+    NTCCFG_WARNING_UNUSED(basicAllocator);
+    return bsl::shared_ptr<ntci::Strand>();
+}
+
+bsl::shared_ptr<ntci::Timer> Shard::createTimer(
+    const ntca::TimerOptions&                  options,
+    const bsl::shared_ptr<ntci::TimerSession>& session,
+    bslma::Allocator*                          basicAllocator)
+{
+    NTCCFG_WARNING_UNUSED(options);
+    NTCCFG_WARNING_UNUSED(session);
+    NTCCFG_WARNING_UNUSED(basicAllocator);
+    return bsl::shared_ptr<ntci::Timer>();
+}
+
+bsl::shared_ptr<ntci::Timer> Shard::createTimer(
+    const ntca::TimerOptions&  options,
+    const ntci::TimerCallback& callback,
+    bslma::Allocator*          basicAllocator)
+{
+    NTCCFG_WARNING_UNUSED(options);
+    NTCCFG_WARNING_UNUSED(callback);
+    NTCCFG_WARNING_UNUSED(basicAllocator);
+    return bsl::shared_ptr<ntci::Timer>();
+}
+
+bsl::shared_ptr<ntsa::Data> Shard::createIncomingData()
+{
+    return bsl::shared_ptr<ntsa::Data>();
+}
+
+bsl::shared_ptr<ntsa::Data> Shard::createOutgoingData()
+{
+    return bsl::shared_ptr<ntsa::Data>();
+}
+
+bsl::shared_ptr<bdlbb::Blob> Shard::createIncomingBlob()
+{
+    return bsl::shared_ptr<bdlbb::Blob>();
+}
+
+bsl::shared_ptr<bdlbb::Blob> Shard::createOutgoingBlob()
+{
+    return bsl::shared_ptr<bdlbb::Blob>();
+}
+
+void Shard::createIncomingBlobBuffer(bdlbb::BlobBuffer* blobBuffer)
+{
+    NTCCFG_WARNING_UNUSED(blobBuffer);
+}
+
+void Shard::createOutgoingBlobBuffer(bdlbb::BlobBuffer* blobBuffer)
+{
+    NTCCFG_WARNING_UNUSED(blobBuffer);
+}
+
+ntsa::Handle Shard::handle() const
+{
+    return ntsa::k_INVALID_HANDLE;
+}
+
+ntsa::Transport::Value Shard::transport() const
+{
+    return ntsa::Transport::e_TCP_IPV4_STREAM;
+}
+
+ntsa::Endpoint Shard::sourceEndpoint() const
+{
+    return d_sourceEndpoint;
+}
+
+const bsl::shared_ptr<ntci::Strand>& Shard::strand() const
+{
+    return d_strand_sp;
+}
+
+bslmt::ThreadUtil::Handle Shard::threadHandle() const
+{
+    return bslmt::ThreadUtil::Handle();
+}
+
+bsl::size_t Shard::threadIndex() const
+{
+    return 0;
+}
+
+bsl::size_t Shard::acceptQueueSize() const
+{
+    return d_backlog.size();
+}
+
+bsl::size_t Shard::acceptQueueLowWatermark() const
+{
+    return 1;
+}
+
+bsl::size_t Shard::acceptQueueHighWatermark() const
+{
+    return static_cast<bsl::size_t>(-1);
+}
+
+bsls::TimeInterval Shard::currentTime() const
+{
+    return bdlt::CurrentTime::now();
+}
+
+const bsl::shared_ptr<bdlbb::BlobBufferFactory>& Shard::
+    incomingBlobBufferFactory() const
+{
+    return d_blobBufferFactory_sp;
+}
+
+const bsl::shared_ptr<bdlbb::BlobBufferFactory>& Shard::
+    outgoingBlobBufferFactory() const
+{
+    return d_blobBufferFactory_sp;
+}
+
+/// Describe the result of an asynchronous accept.
+struct AcceptResult {
+    AcceptResult()
+    : d_complete(false)
+    , d_streamSocket()
+    , d_error()
+    {
+    }
+
+    bool                                d_complete;
+    bsl::shared_ptr<ntci::StreamSocket> d_streamSocket;
+    ntsa::Error                         d_error;
+};
+
+/// Provide a test case execution framework.
+class Framework
+{
+    bsl::shared_ptr<ntcd::Simulation> d_simulation_sp;
+    bsl::shared_ptr<ntcd::Reactor>    d_reactor_sp;
+    bslma::Allocator*                 d_allocator_p;
+
+  private:
+    Framework(const Framework&) BSLS_KEYWORD_DELETED;
+    Framework& operator=(const Framework&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new framework. Optionally specify a 'basicAllocator' used
+    /// to supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used.
+    explicit Framework(bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~Framework();
+
+    /// Load into the specified 'result' a sharded listener socket
+    /// implemented by the specified 'numShards' new shards, loaded into
+    /// the specified 'shards'. The shard at index 'i' binds to port
+    /// '50000 + i' when bound to port 0.
+    void createListenerSocket(
+        bsl::shared_ptr<ntcr::ShardedListenerSocket>* result,
+        bsl::vector<bsl::shared_ptr<test::Shard> >*   shards,
+        bsl::size_t                                   numShards);
+
+    /// Return a new stream socket, never opened, that a shard may report
+    /// as accepted.
+    bsl::shared_ptr<ntci::StreamSocket> createStreamSocket();
+
+    /// Process the specified 'event' of an asynchronous accept of the
+    /// specified 'streamSocket', if any, by the specified 'acceptor' by
+    /// loading the outcome into the specified 'result'.
+    static void processAccept(
+        test::AcceptResult*                        result,
+        const bsl::shared_ptr<ntci::Acceptor>&     acceptor,
+        const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+        const ntca::AcceptEvent&                   event);
+
+    /// Process the closure of a listener socket by incrementing the
+    /// specified 'numClosed'.
+    static void processClose(bsl::size_t* numClosed);
+};
+
+Framework::Framework(bslma::Allocator* basicAllocator)
+: d_simulation_sp()
+, d_reactor_sp()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    ntsa::Error error;
+
+    d_simulation_sp.createInplace(d_allocator_p, d_allocator_p);
+
+    error = d_simulation_sp->run();
+    NTCCFG_TEST_OK(error);
+
+    bsl::shared_ptr<ntcs::DataPool> dataPool;
+    dataPool.createInplace(d_allocator_p, d_allocator_p);
+
+    bsl::shared_ptr<ntcs::User> user;
+    user.createInplace(d_allocator_p, d_allocator_p);
+
+    user->setDataPool(dataPool);
+
+    ntca::ReactorConfig reactorConfig;
+    reactorConfig.setMetricName("test");
+    reactorConfig.setMinThreads(1);
+    reactorConfig.setMaxThreads(1);
+    reactorConfig.setAutoAttach(false);
+    reactorConfig.setAutoDetach(false);
+
+    d_reactor_sp.createInplace(d_allocator_p,
+                               reactorConfig,
+                               user,
+                               d_allocator_p);
+}
+
+Framework::~Framework()
+{
+    d_reactor_sp.reset();
+    d_simulation_sp->stop();
+}
+
+void Framework::createListenerSocket(
+    bsl::shared_ptr<ntcr::ShardedListenerSocket>* result,
+    bsl::vector<bsl::shared_ptr<test::Shard> >*   shards,
+    bsl::size_t                                   numShards)
+{
+    ntcr::ShardedListenerSocket::ShardVector shardVector(d_allocator_p);
+
+    shards->clear();
+
+    for (bsl::size_t i = 0; i < numShards; ++i) {
+        bsl::shared_ptr<test::Shard> shard;
+        shard.createInplace(d_allocator_p,
+                            static_cast<ntsa::Port>(50000 + i),
+                            d_allocator_p);
+
+        shards->push_back(shard);
+        shardVector.push_back(shard);
+    }
+
+    result->createInplace(d_allocator_p, shardVector, d_allocator_p);
+}
+
+bsl::shared_ptr<ntci::StreamSocket> Framework::createStreamSocket()
+{
+    ntca::StreamSocketOptions options;
+    options.setTransport(ntsa::Transport::e_TCP_IPV4_STREAM);
+
+    bsl::shared_ptr<ntci::Resolver> resolver;
+    bsl::shared_ptr<ntcs::Metrics>  metrics;
+
+    bsl::shared_ptr<ntcr::StreamSocket> streamSocket;
+    streamSocket.createInplace(d_allocator_p,
+                               options,
+                               resolver,
+                               d_reactor_sp,
+                               d_reactor_sp,
+                               metrics,
+                               d_allocator_p);
+
+    return streamSocket;
+}
+
+void Framework::processAccept(
+    test::AcceptResult*                        result,
+    const bsl::shared_ptr<ntci::Acceptor>&     acceptor,
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    const ntca::AcceptEvent&                   event)
+{
+    NTCCFG_WARNING_UNUSED(acceptor);
+
+    NTCCFG_TEST_FALSE(result->d_complete);
+
+    result->d_complete     = true;
+    result->d_streamSocket = streamSocket;
+    result->d_error        = event.context().error();
+}
+
+void Framework::processClose(bsl::size_t* numClosed)
+{
+    ++(*numClosed);
+}
+
+}  // close namespace test
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Binding to port 0 binds the first shard to an ephemeral port
+    // and every other shard to that same port.
+    // Plan: Bind a listener socket of three shards, each of which would
+    // choose a different ephemeral port, to port 0, and ensure every shard
+    // is bound to the port chosen by the first.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+
+        test::Framework framework(&ta);
+
+        bsl::shared_ptr<ntcr::ShardedListenerSocket> listenerSocket;
+        bsl::vector<bsl::shared_ptr<test::Shard> >   shards(&ta);
+
+        framework.createListenerSocket(&listenerSocket, &shards, 3);
+
+        error = listenerSocket->open();
+        NTCCFG_TEST_OK(error);
+
+        error = listenerSocket->bind(
+            ntsa::Endpoint(
+                ntsa::IpEndpoint(ntsa::Ipv4Address::loopback(), 0)),
+            ntca::BindOptions(),
+            ntci::BindCallback(&ta));
+        NTCCFG_TEST_OK(error);
+
+        const ntsa::Endpoint expected(
+            ntsa::IpEndpoint(ntsa::Ipv4Address::loopback(), 50000));
+
+        NTCCFG_TEST_EQ(listenerSocket->sourceEndpoint(), expected);
+
+        for (bsl::size_t i = 0; i < shards.size(); ++i) {
+            NTCCFG_TEST_EQ(shards[i]->sourceEndpoint(), expected);
+        }
+
+        bsl::size_t numClosed = 0;
+        listenerSocket->close(listenerSocket->createCloseCallback(
+            NTCCFG_BIND(&test::Framework::processClose, &numClosed),
+            &ta));
+        NTCCFG_TEST_EQ(numClosed, 1);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: Synchronous accepts start from a different shard each time,
+    // in round-robin order, skipping shards with nothing to accept.
+    // Plan: Queue connections in the backlog of each shard and ensure they
+    // are accepted in round-robin order, then that an accept fails with
+    // 'e_WOULD_BLOCK' once every backlog is empty.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+
+        test::Framework framework(&ta);
+
+        bsl::shared_ptr<ntcr::ShardedListenerSocket> listenerSocket;
+        bsl::vector<bsl::shared_ptr<test::Shard> >   shards(&ta);
+
+        framework.createListenerSocket(&listenerSocket, &shards, 3);
+
+        // Queue two connections on shards 0 and 2, and one on shard 1.
+
+        bsl::vector<bsl::shared_ptr<ntci::StreamSocket> > socket(&ta);
+        for (bsl::size_t i = 0; i < 5; ++i) {
+            socket.push_back(framework.createStreamSocket());
+        }
+
+        shards[0]->enqueue(socket[0]);
+        shards[1]->enqueue(socket[1]);
+        shards[2]->enqueue(socket[2]);
+        shards[0]->enqueue(socket[3]);
+        shards[2]->enqueue(socket[4]);
+
+        NTCCFG_TEST_EQ(listenerSocket->acceptQueueSize(), 5);
+
+        // The fifth accept starts from shard 1, which is empty, and so is
+        // satisfied by shard 2.
+
+        const bsl::size_t k_EXPECTED[5] = {0, 1, 2, 3, 4};
+
+        for (bsl::size_t i = 0; i < 5; ++i) {
+            ntca::AcceptContext                 context;
+            bsl::shared_ptr<ntci::StreamSocket> streamSocket;
+
+            error = listenerSocket->accept(&context,
+                                           &streamSocket,
+                                           ntca::AcceptOptions());
+            NTCCFG_TEST_OK(error);
+            NTCCFG_TEST_EQ(streamSocket, socket[k_EXPECTED[i]]);
+        }
+
+        {
+            ntca::AcceptContext                 context;
+            bsl::shared_ptr<ntci::StreamSocket> streamSocket;
+
+            error = listenerSocket->accept(&context,
+                                           &streamSocket,
+                                           ntca::AcceptOptions());
+            NTCCFG_TEST_ERROR(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+            NTCCFG_TEST_FALSE(streamSocket);
+        }
+
+        bsl::size_t numClosed = 0;
+        listenerSocket->close(listenerSocket->createCloseCallback(
+            NTCCFG_BIND(&test::Framework::processClose, &numClosed),
+            &ta));
+        NTCCFG_TEST_EQ(numClosed, 1);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(3)
+{
+    // Concern: An asynchronous accept arms every shard and is satisfied by
+    // whichever shard accepts first; a connection accepted by another shard
+    // after the accept is satisfied is queued for the next accept.
+    // Plan: Initiate an asynchronous accept, complete it from one shard,
+    // then complete another shard with no accept pending and ensure the
+    // connection is queued and delivered to the next accept, synchronous
+    // or asynchronous.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+
+        test::Framework framework(&ta);
+
+        bsl::shared_ptr<ntcr::ShardedListenerSocket> listenerSocket;
+        bsl::vector<bsl::shared_ptr<test::Shard> >   shards(&ta);
+
+        framework.createListenerSocket(&listenerSocket, &shards, 3);
+
+        bsl::shared_ptr<ntci::StreamSocket> socketA =
+            framework.createStreamSocket();
+        bsl::shared_ptr<ntci::StreamSocket> socketB =
+            framework.createStreamSocket();
+        bsl::shared_ptr<ntci::StreamSocket> socketC =
+            framework.createStreamSocket();
+        bsl::shared_ptr<ntci::StreamSocket> socketD =
+            framework.createStreamSocket();
+
+        // Initiate an asynchronous accept and ensure every shard is armed.
+
+        test::AcceptResult result1;
+
+        error = listenerSocket->accept(
+            ntca::AcceptOptions(),
+            listenerSocket->createAcceptCallback(
+                NTCCFG_BIND(&test::Framework::processAccept,
+                            &result1,
+                            NTCCFG_BIND_PLACEHOLDER_1,
+                            NTCCFG_BIND_PLACEHOLDER_2,
+                            NTCCFG_BIND_PLACEHOLDER_3),
+                &ta));
+        NTCCFG_TEST_OK(error);
+
+        NTCCFG_TEST_FALSE(result1.d_complete);
+
+        for (bsl::size_t i = 0; i < shards.size(); ++i) {
+            NTCCFG_TEST_TRUE(shards[i]->isArmed());
+            NTCCFG_TEST_EQ(shards[i]->numArmed(), 1);
+        }
+
+        // Complete the accept from shard 1.
+
+        shards[1]->complete(socketA);
+
+        NTCCFG_TEST_TRUE(result1.d_complete);
+        NTCCFG_TEST_OK(result1.d_error);
+        NTCCFG_TEST_EQ(result1.d_streamSocket, socketA);
+
+        // Shard 1 is not re-armed since no accept is pending.
+
+        NTCCFG_TEST_FALSE(shards[1]->isArmed());
+
+        // Complete shard 2 while no accept is pending and ensure the
+        // connection is queued.
+
+        shards[2]->complete(socketB);
+
+        NTCCFG_TEST_EQ(listenerSocket->acceptQueueSize(), 1);
+
+        // Ensure a synchronous accept pops the queued connection.
+
+        {
+            ntca::AcceptContext                 context;
+            bsl::shared_ptr<ntci::StreamSocket> streamSocket;
+
+            error = listenerSocket->accept(&context,
+                                           &streamSocket,
+                                           ntca::AcceptOptions());
+            NTCCFG_TEST_OK(error);
+            NTCCFG_TEST_EQ(streamSocket, socketB);
+        }
+
+        // Complete shard 0 while no accept is pending, then ensure the
+        // next asynchronous accept is satisfied immediately by the queued
+        // connection without arming any shard.
+
+        shards[0]->complete(socketC);
+
+        NTCCFG_TEST_EQ(listenerSocket->acceptQueueSize(), 1);
+
+        test::AcceptResult result2;
+
+        ntca::AcceptOptions acceptOptions;
+        acceptOptions.setRecurse(true);
+
+        error = listenerSocket->accept(
+            acceptOptions,
+            listenerSocket->createAcceptCallback(
+                NTCCFG_BIND(&test::Framework::processAccept,
+                            &result2,
+                            NTCCFG_BIND_PLACEHOLDER_1,
+                            NTCCFG_BIND_PLACEHOLDER_2,
+                            NTCCFG_BIND_PLACEHOLDER_3),
+                &ta));
+        NTCCFG_TEST_OK(error);
+
+        NTCCFG_TEST_TRUE(result2.d_complete);
+        NTCCFG_TEST_EQ(result2.d_streamSocket, socketC);
+
+        for (bsl::size_t i = 0; i < shards.size(); ++i) {
+            NTCCFG_TEST_FALSE(shards[i]->isArmed());
+        }
+
+        // Ensure the next asynchronous accept re-arms every shard.
+
+        test::AcceptResult result3;
+
+        error = listenerSocket->accept(
+            ntca::AcceptOptions(),
+            listenerSocket->createAcceptCallback(
+                NTCCFG_BIND(&test::Framework::processAccept,
+                            &result3,
+                            NTCCFG_BIND_PLACEHOLDER_1,
+                            NTCCFG_BIND_PLACEHOLDER_2,
+                            NTCCFG_BIND_PLACEHOLDER_3),
+                &ta));
+        NTCCFG_TEST_OK(error);
+
+        for (bsl::size_t i = 0; i < shards.size(); ++i) {
+            NTCCFG_TEST_TRUE(shards[i]->isArmed());
+            NTCCFG_TEST_EQ(shards[i]->numArmed(), 2);
+        }
+
+        shards[2]->complete(socketD);
+
+        NTCCFG_TEST_TRUE(result3.d_complete);
+        NTCCFG_TEST_EQ(result3.d_streamSocket, socketD);
+
+        bsl::size_t numClosed = 0;
+        listenerSocket->close(listenerSocket->createCloseCallback(
+            NTCCFG_BIND(&test::Framework::processClose, &numClosed),
+            &ta));
+        NTCCFG_TEST_EQ(numClosed, 1);
+
+        shards[0]->drain();
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(4)
+{
+    // Concern: Asynchronous accepts remain pending while any shard is open,
+    // and each fails with 'e_EOF' once every shard has closed.
+    // Plan: Initiate two asynchronous accepts, fail each shard in turn,
+    // and ensure the accepts complete only after the last shard fails.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+
+        test::Framework framework(&ta);
+
+        bsl::shared_ptr<ntcr::ShardedListenerSocket> listenerSocket;
+        bsl::vector<bsl::shared_ptr<test::Shard> >   shards(&ta);
+
+        framework.createListenerSocket(&listenerSocket, &shards, 2);
+
+        test::AcceptResult result[2];
+
+        for (bsl::size_t i = 0; i < 2; ++i) {
+            error = listenerSocket->accept(
+                ntca::AcceptOptions(),
+                listenerSocket->createAcceptCallback(
+                    NTCCFG_BIND(&test::Framework::processAccept,
+                                &result[i],
+                                NTCCFG_BIND_PLACEHOLDER_1,
+                                NTCCFG_BIND_PLACEHOLDER_2,
+                                NTCCFG_BIND_PLACEHOLDER_3),
+                    &ta));
+            NTCCFG_TEST_OK(error);
+        }
+
+        shards[0]->fail(ntsa::Error(ntsa::Error::e_EOF));
+        shards[0]->drain();
+
+        NTCCFG_TEST_FALSE(shards[0]->isArmed());
+        NTCCFG_TEST_TRUE(shards[1]->isArmed());
+
+        NTCCFG_TEST_FALSE(result[0].d_complete);
+        NTCCFG_TEST_FALSE(result[1].d_complete);
+
+        shards[1]->fail(ntsa::Error(ntsa::Error::e_EOF));
+
+        // The failures are deferred onto the first shard.
+
+        NTCCFG_TEST_FALSE(result[0].d_complete);
+        NTCCFG_TEST_FALSE(result[1].d_complete);
+
+        shards[0]->drain();
+
+        for (bsl::size_t i = 0; i < 2; ++i) {
+            NTCCFG_TEST_TRUE(result[i].d_complete);
+            NTCCFG_TEST_FALSE(result[i].d_streamSocket);
+            NTCCFG_TEST_ERROR(result[i].d_error,
+                              ntsa::Error(ntsa::Error::e_EOF));
+        }
+
+        // Ensure subsequent accepts fail immediately.
+
+        {
+            ntca::AcceptContext                 context;
+            bsl::shared_ptr<ntci::StreamSocket> streamSocket;
+
+            error = listenerSocket->accept(&context,
+                                           &streamSocket,
+                                           ntca::AcceptOptions());
+            NTCCFG_TEST_ERROR(error, ntsa::Error(ntsa::Error::e_EOF));
+        }
+
+        bsl::size_t numClosed = 0;
+        listenerSocket->close(listenerSocket->createCloseCallback(
+            NTCCFG_BIND(&test::Framework::processClose, &numClosed),
+            &ta));
+        NTCCFG_TEST_EQ(numClosed, 1);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+    NTCCFG_TEST_REGISTER(3);
+    NTCCFG_TEST_REGISTER(4);
+}
+NTCCFG_TEST_DRIVER_END;
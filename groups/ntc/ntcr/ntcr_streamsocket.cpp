@@ -48,6 +48,7 @@ BSLS_IDENT_RCSID(ntcr_streamsocket_cpp, "$Id$ $CSID$")
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bslmt_lockguard.h>
+#include <bslmt_threadutil.h>
 #include <bsls_assert.h>
 #include <bsls_timeutil.h>
 #include <bsl_algorithm.h>
@@ -90,6 +91,22 @@ BSLS_IDENT_RCSID(ntcr_streamsocket_cpp, "$Id$ $CSID$")
 #define NTCR_STREAMSOCKET_LOG_ENCRYPTION_UPGRADE_FAILED(details)              \
     NTCI_LOG_DEBUG("Encryption upgrade failed: %s", details.c_str())
 
+#define NTCR_STREAMSOCKET_LOG_ENCRYPTION_OFFLOAD_COMPLETE()                   \
+    NTCI_LOG_DEBUG("Encryption offloaded to the operating system")
+
+#define NTCR_STREAMSOCKET_LOG_ENCRYPTION_OFFLOAD_UNSUPPORTED(error)           \
+    NTCI_LOG_DEBUG("Encryption cannot be offloaded to the operating system: " \
+                   "%s",                                                      \
+                   (error).text().c_str())
+
+#define NTCR_STREAMSOCKET_LOG_ENCRYPTION_HANDSHAKE_DEFERRED(numBytes)         \
+    NTCI_LOG_TRACE("Encryption handshake deferred to process %d bytes",      \
+                   (int)(numBytes))
+
+#define NTCR_STREAMSOCKET_LOG_ENCRYPTION_HANDSHAKE_INLINE(error)              \
+    NTCI_LOG_TRACE("Encryption handshake processed inline: %s",              \
+                   (error).text().c_str())
+
 #define NTCR_STREAMSOCKET_LOG_RECEIVE_BUFFER_THROTTLE_APPLIED(timeToSubmit)   \
     NTCI_LOG_TRACE("Stream socket receive buffer throttle applied for %d "    \
                    "milliseconds",                                            \
@@ -398,6 +415,10 @@ void StreamSocket::processSocketWritable(const ntca::ReactorEvent& event)
         NTCS_METRICS_UPDATE_SEND_ITERATIONS(numIterations);
     }
 
+    if (NTCCFG_UNLIKELY(d_upgradeOffload) && !error) {
+        error = this->privateOffloadEncryption(self);
+    }
+
     if (error && error != ntsa::Error::e_WOULD_BLOCK) {
         this->privateFail(self, error);
     }
@@ -667,7 +688,7 @@ void StreamSocket::processSendDeadlineTimer(
 
             callback.dispatch(self,
                               sendEvent,
-                              d_reactorStrand_sp,
+                              this->privateCurrentStrand(),
                               self,
                               false,
                               &d_mutex);
@@ -755,7 +776,7 @@ void StreamSocket::processReceiveDeadlineTimer(
                 self,
                 bsl::shared_ptr<bdlbb::Blob>(),
                 receiveEvent,
-                d_reactorStrand_sp,
+                this->privateCurrentStrand(),
                 self,
                 false,
                 &d_mutex);
@@ -763,14 +784,127 @@ void StreamSocket::processReceiveDeadlineTimer(
     }
 }
 
+void StreamSocket::processHandshake()
+{
+    NTCCFG_OBJECT_GUARD(&d_object);
+
+    bsl::shared_ptr<StreamSocket> self = this->getSelf(this);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_CONTEXT_GUARD_DESCRIPTOR(d_publicHandle);
+    NTCI_LOG_CONTEXT_GUARD_SOURCE_ENDPOINT(d_sourceEndpoint);
+    NTCI_LOG_CONTEXT_GUARD_REMOTE_ENDPOINT(d_remoteEndpoint);
+
+    bsl::shared_ptr<bdlbb::Blob> cipherText =
+        d_dataPool_sp->createIncomingBlob();
+
+    while (true) {
+        if (NTCCFG_UNLIKELY(d_detachState.get() ==
+                            ntcs::DetachState::e_DETACH_INITIATED))
+        {
+            d_handshakePending = false;
+            return;
+        }
+
+        if (!d_encryption_sp) {
+            d_handshakePending = false;
+            return;
+        }
+
+        if (d_receiveBlob_sp->length() == 0 ||
+            d_encryption_sp->isHandshakeFinished())
+        {
+            break;
+        }
+
+        // Take the cipher text accumulated since this step was deferred.
+        // The I/O threads continue to receive into the receive blob while
+        // this step is pending, but never push into the encryption session,
+        // so the order of the cipher text is preserved.
+
+        d_receiveBlob_sp.swap(cipherText);
+
+        bsl::shared_ptr<ntci::Encryption> encryption = d_encryption_sp;
+
+        // Push the cipher text into the encryption session without holding
+        // the lock, since this step performs the cryptographic operations of
+        // the handshake. The encryption session is thread safe, and the
+        // handshake callback acquires the lock itself when invoked from this
+        // thread.
+
+        ntsa::Error error;
+        {
+            bslmt::UnLockGuard<bslmt::Mutex> unlock(&d_mutex);
+
+            d_handshakeThreadId = bslmt::ThreadUtil::selfIdAsUint64();
+            error = encryption->pushIncomingCipherText(*cipherText);
+            d_handshakeThreadId = 0;
+        }
+
+        bdlbb::BlobUtil::erase(cipherText.get(), 0, cipherText->length());
+
+        if (d_encryption_sp != encryption) {
+            d_handshakePending = false;
+            return;
+        }
+
+        if (!error) {
+            error = this->privateSendOutgoingCipherText(self);
+        }
+
+        if (error) {
+            d_handshakePending = false;
+            this->privateFail(self, error);
+            return;
+        }
+    }
+
+    d_handshakePending = false;
+
+    // Any application data, shutdown, or offload that follows the
+    // completion of the handshake is processed as if the socket is
+    // readable, on the strand of the socket.
+
+    if (d_encryption_sp->isHandshakeFinished()) {
+        d_handshakeProcessed = true;
+
+        this->privateExecute(
+            bdlf::BindUtil::bind(&StreamSocket::processSocketReadable,
+                                 self,
+                                 ntca::ReactorEvent()));
+    }
+}
+
 void StreamSocket::privateEncryptionHandshake(
     const ntsa::Error&                                  error,
     const bsl::shared_ptr<ntci::EncryptionCertificate>& certificate,
     const bsl::string&                                  details)
 {
-    // IMPLEMENTATION NOTE: This function is always called under a lock
-    // during the exection of 'd_encryption->popIncomingCipherText()'.
+    // IMPLEMENTATION NOTE: This function is called during the execution of
+    // 'd_encryption->pushIncomingCipherText()'. That function is called
+    // under the lock, except when a step of the handshake is processed on a
+    // thread dedicated to processing handshakes, in which case the lock must
+    // be acquired here.
+
+    if (NTCCFG_UNLIKELY(d_handshakeThreadId.load() ==
+                        bslmt::ThreadUtil::selfIdAsUint64()))
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        this->privateAnnounceEncryptionHandshake(error, certificate, details);
+    }
+    else {
+        this->privateAnnounceEncryptionHandshake(error, certificate, details);
+    }
+}
 
+void StreamSocket::privateAnnounceEncryptionHandshake(
+    const ntsa::Error&                                  error,
+    const bsl::shared_ptr<ntci::EncryptionCertificate>& certificate,
+    const bsl::string&                                  details)
+{
     NTCI_LOG_CONTEXT();
 
     bsl::shared_ptr<StreamSocket> self = this->getSelf(this);
@@ -778,30 +912,15 @@ void StreamSocket::privateEncryptionHandshake(
     if (!error) {
         NTCR_STREAMSOCKET_LOG_ENCRYPTION_UPGRADE_COMPLETE(certificate);
 
-        d_upgradeInProgress = false;
-
-        ntci::UpgradeCallback upgradeCallback = d_upgradeCallback;
-        d_upgradeCallback.reset();
-
-        ntca::UpgradeContext context;
+        // When offloading is requested, the upgrade completes only once the
+        // traffic keys are installed into the socket, so that a failure to
+        // install them fails the upgrade.
 
-        ntca::UpgradeEvent event;
-        event.setType(ntca::UpgradeEventType::e_COMPLETE);
-        event.setContext(context);
-
-        if (d_upgradeTimer_sp) {
-            d_upgradeTimer_sp->close();
-            d_upgradeTimer_sp.reset();
+        if (d_upgradeOffload) {
+            return;
         }
 
-        if (upgradeCallback) {
-            upgradeCallback.dispatch(self,
-                                     event,
-                                     d_reactorStrand_sp,
-                                     self,
-                                     false,
-                                     &d_mutex);
-        }
+        this->privateCompleteUpgrade(self);
     }
     else {
         NTCR_STREAMSOCKET_LOG_ENCRYPTION_UPGRADE_FAILED(details);
@@ -810,6 +929,57 @@ void StreamSocket::privateEncryptionHandshake(
     }
 }
 
+const bsl::shared_ptr<ntci::Strand>& StreamSocket::privateCurrentStrand()
+    const
+{
+    // Callbacks invoked on a callback strand distinct from the reactor strand
+    // may call back into this object. Report the callback strand as current
+    // in that case, so that callbacks announced from within those callbacks
+    // are invoked immediately rather than deferred onto the same strand.
+
+    if (d_callbackStrand_sp != d_reactorStrand_sp &&
+        d_callbackStrand_sp &&
+        ntci::Strand::getThreadLocal() == d_callbackStrand_sp.get())
+    {
+        return d_callbackStrand_sp;
+    }
+
+    return d_reactorStrand_sp;
+}
+
+void StreamSocket::privateExecute(const Functor& functor)
+{
+    if (d_reactorStrand_sp) {
+        d_reactorStrand_sp->execute(functor);
+    }
+    else {
+        ntcs::ObserverRef<ntci::Reactor> reactorRef(&d_reactor);
+        if (reactorRef) {
+            reactorRef->execute(functor);
+        }
+        else {
+            ntcs::Async::execute(functor);
+        }
+    }
+}
+
+void StreamSocket::privateMoveAndExecute(FunctorSequence* functorSequence,
+                                         const Functor&   functor)
+{
+    if (d_reactorStrand_sp) {
+        d_reactorStrand_sp->moveAndExecute(functorSequence, functor);
+    }
+    else {
+        ntcs::ObserverRef<ntci::Reactor> reactorRef(&d_reactor);
+        if (reactorRef) {
+            reactorRef->moveAndExecute(functorSequence, functor);
+        }
+        else {
+            ntcs::Async::moveAndExecute(functorSequence, functor);
+        }
+    }
+}
+
 ntsa::Error StreamSocket::privateSocketReadableIteration(
     const bsl::shared_ptr<StreamSocket>& self)
 {
@@ -918,12 +1088,22 @@ ntsa::Error StreamSocket::privateSocketReadableIteration(
                                                   self,
                                                   data,
                                                   receiveEvent,
-                                                  d_reactorStrand_sp,
+                                                  this->privateCurrentStrand(),
                                                   self,
                                                   false,
                                                   &d_mutex);
     }
 
+    this->privateAnnounceReadQueueWatermarks(self);
+
+    return ntsa::Error();
+}
+
+void StreamSocket::privateAnnounceReadQueueWatermarks(
+    const bsl::shared_ptr<StreamSocket>& self)
+{
+    NTCI_LOG_CONTEXT();
+
     if (d_receiveQueue.authorizeLowWatermarkEvent()) {
         NTCR_STREAMSOCKET_LOG_READ_QUEUE_LOW_WATERMARK(
             d_receiveQueue.lowWatermark(),
@@ -934,14 +1114,15 @@ ntsa::Error StreamSocket::privateSocketReadableIteration(
             event.setType(ntca::ReadQueueEventType::e_LOW_WATERMARK);
             event.setContext(d_receiveQueue.context());
 
-            ntcs::Dispatch::announceReadQueueLowWatermark(d_session_sp,
-                                                          self,
-                                                          event,
-                                                          d_sessionStrand_sp,
-                                                          d_reactorStrand_sp,
-                                                          self,
-                                                          false,
-                                                          &d_mutex);
+            ntcs::Dispatch::announceReadQueueLowWatermark(
+                d_session_sp,
+                self,
+                event,
+                d_sessionStrand_sp,
+                this->privateCurrentStrand(),
+                self,
+                false,
+                &d_mutex);
         }
     }
 
@@ -961,18 +1142,17 @@ ntsa::Error StreamSocket::privateSocketReadableIteration(
             event.setType(ntca::ReadQueueEventType::e_HIGH_WATERMARK);
             event.setContext(d_receiveQueue.context());
 
-            ntcs::Dispatch::announceReadQueueHighWatermark(d_session_sp,
-                                                           self,
-                                                           event,
-                                                           d_sessionStrand_sp,
-                                                           d_reactorStrand_sp,
-                                                           self,
-                                                           false,
-                                                           &d_mutex);
+            ntcs::Dispatch::announceReadQueueHighWatermark(
+                d_session_sp,
+                self,
+                event,
+                d_sessionStrand_sp,
+                this->privateCurrentStrand(),
+                self,
+                false,
+                &d_mutex);
         }
     }
-
-    return ntsa::Error();
 }
 
 ntsa::Error StreamSocket::privateSocketWritableConnection(
@@ -1137,7 +1317,7 @@ ntsa::Error StreamSocket::privateSocketWritableConnection(
     if (connectCallback) {
         connectCallback.dispatch(self,
                                  connectEvent,
-                                 d_reactorStrand_sp,
+                                 this->privateCurrentStrand(),
                                  self,
                                  false,
                                  &d_mutex);
@@ -1150,7 +1330,7 @@ ntsa::Error StreamSocket::privateSocketWritableConnection(
     ntcs::Dispatch::announceEstablished(d_manager_sp,
                                         self,
                                         d_managerStrand_sp,
-                                        d_reactorStrand_sp,
+                                        this->privateCurrentStrand(),
                                         self,
                                         false,
                                         &d_mutex);
@@ -1278,7 +1458,7 @@ ntsa::Error StreamSocket::privateSocketWritableIterationBatch(
 
             callback.dispatch(self,
                               sendEvent,
-                              d_reactorStrand_sp,
+                              this->privateCurrentStrand(),
                               self,
                               false,
                               &d_mutex);
@@ -1295,14 +1475,15 @@ ntsa::Error StreamSocket::privateSocketWritableIterationBatch(
             event.setType(ntca::WriteQueueEventType::e_LOW_WATERMARK);
             event.setContext(d_sendQueue.context());
 
-            ntcs::Dispatch::announceWriteQueueLowWatermark(d_session_sp,
-                                                           self,
-                                                           event,
-                                                           d_sessionStrand_sp,
-                                                           d_reactorStrand_sp,
-                                                           self,
-                                                           true,
-                                                           &d_mutex);
+            ntcs::Dispatch::announceWriteQueueLowWatermark(
+                d_session_sp,
+                self,
+                event,
+                d_sessionStrand_sp,
+                this->privateCurrentStrand(),
+                self,
+                true,
+                &d_mutex);
         }
     }
 
@@ -1394,7 +1575,7 @@ ntsa::Error StreamSocket::privateSocketWritableIterationFront(
 
             callback.dispatch(self,
                               sendEvent,
-                              d_reactorStrand_sp,
+                              this->privateCurrentStrand(),
                               self,
                               false,
                               &d_mutex);
@@ -1415,7 +1596,7 @@ ntsa::Error StreamSocket::privateSocketWritableIterationFront(
                     self,
                     event,
                     d_sessionStrand_sp,
-                    d_reactorStrand_sp,
+                    this->privateCurrentStrand(),
                     self,
                     true,
                     &d_mutex);
@@ -1516,7 +1697,7 @@ void StreamSocket::privateFailConnect(
                                     connectCallback,
                                     connectEvent,
                                     true),
-                        this->strand(),
+                        d_reactorStrand_sp,
                         d_allocator_p);
 
                     const ntsa::Error error =
@@ -1551,7 +1732,7 @@ void StreamSocket::privateFailConnect(
                                     connectCallback,
                                     connectEvent,
                                     true),
-                        this->strand(),
+                        d_reactorStrand_sp,
                         d_allocator_p);
 
                     const ntsa::Error error =
@@ -1624,7 +1805,7 @@ void StreamSocket::privateFailConnectPart2(
     if (connectCallback) {
         connectCallback.dispatch(self,
                                  connectEvent,
-                                 d_reactorStrand_sp,
+                                 this->privateCurrentStrand(),
                                  self,
                                  defer,
                                  &d_mutex);
@@ -1654,7 +1835,8 @@ void StreamSocket::privateFailConnectPart2(
     }
 
     if (!d_deferredCalls.empty()) {
-        this->moveAndExecute(&d_deferredCalls, ntci::Executor::Functor());
+        this->privateMoveAndExecute(&d_deferredCalls,
+                                    ntci::Executor::Functor());
     }
     d_deferredCalls.clear();
 
@@ -1663,6 +1845,35 @@ void StreamSocket::privateFailConnectPart2(
     }
 }
 
+void StreamSocket::privateCompleteUpgrade(
+    const bsl::shared_ptr<StreamSocket>& self)
+{
+    d_upgradeInProgress = false;
+
+    ntci::UpgradeCallback upgradeCallback = d_upgradeCallback;
+    d_upgradeCallback.reset();
+
+    ntca::UpgradeContext context;
+
+    ntca::UpgradeEvent event;
+    event.setType(ntca::UpgradeEventType::e_COMPLETE);
+    event.setContext(context);
+
+    if (d_upgradeTimer_sp) {
+        d_upgradeTimer_sp->close();
+        d_upgradeTimer_sp.reset();
+    }
+
+    if (upgradeCallback) {
+        upgradeCallback.dispatch(self,
+                                 event,
+                                 this->privateCurrentStrand(),
+                                 self,
+                                 false,
+                                 &d_mutex);
+    }
+}
+
 void StreamSocket::privateFailUpgrade(
     const bsl::shared_ptr<StreamSocket>& self,
     const ntsa::Error&                   error,
@@ -1705,7 +1916,7 @@ void StreamSocket::privateFailUpgrade(
     if (upgradeCallback) {
         upgradeCallback.dispatch(self,
                                  upgradeEvent,
-                                 d_reactorStrand_sp,
+                                 this->privateCurrentStrand(),
                                  self,
                                  false,
                                  &d_mutex);
@@ -1773,7 +1984,7 @@ void StreamSocket::privateFail(const bsl::shared_ptr<StreamSocket>& self,
                                           self,
                                           event,
                                           d_sessionStrand_sp,
-                                          d_reactorStrand_sp,
+                                          this->privateCurrentStrand(),
                                           self,
                                           false,
                                           &d_mutex);
@@ -1935,7 +2146,7 @@ void StreamSocket::privateShutdownSequence(
                         context,
                         defer,
                         true),
-            this->strand(),
+            d_reactorStrand_sp,
             d_allocator_p);
         asyncDetachmentStarted =
             this->privateCloseFlowControl(self, defer, detachCallback);
@@ -2008,14 +2219,15 @@ void StreamSocket::privateShutdownSequenceComplete(
             event.setType(ntca::ShutdownEventType::e_INITIATED);
             event.setContext(context.base());
 
-            ntcs::Dispatch::announceShutdownInitiated(d_session_sp,
-                                                      self,
-                                                      event,
-                                                      d_sessionStrand_sp,
-                                                      d_reactorStrand_sp,
-                                                      self,
-                                                      defer,
-                                                      &d_mutex);
+            ntcs::Dispatch::announceShutdownInitiated(
+                d_session_sp,
+                self,
+                event,
+                d_sessionStrand_sp,
+                this->privateCurrentStrand(),
+                self,
+                defer,
+                &d_mutex);
         }
     }
 
@@ -2070,7 +2282,7 @@ void StreamSocket::privateShutdownSequenceComplete(
             if (upgradeCallback) {
                 upgradeCallback.dispatch(self,
                                          upgradeEvent,
-                                         d_reactorStrand_sp,
+                                         this->privateCurrentStrand(),
                                          self,
                                          defer,
                                          &d_mutex);
@@ -2087,7 +2299,7 @@ void StreamSocket::privateShutdownSequenceComplete(
 
             callbackVector[i].dispatch(self,
                                        sendEvent,
-                                       d_reactorStrand_sp,
+                                       this->privateCurrentStrand(),
                                        self,
                                        defer,
                                        &d_mutex);
@@ -2101,14 +2313,15 @@ void StreamSocket::privateShutdownSequenceComplete(
                 event.setType(ntca::WriteQueueEventType::e_DISCARDED);
                 event.setContext(d_sendQueue.context());
 
-                ntcs::Dispatch::announceWriteQueueDiscarded(d_session_sp,
-                                                            self,
-                                                            event,
-                                                            d_sessionStrand_sp,
-                                                            d_reactorStrand_sp,
-                                                            self,
-                                                            defer,
-                                                            &d_mutex);
+                ntcs::Dispatch::announceWriteQueueDiscarded(
+                    d_session_sp,
+                    self,
+                    event,
+                    d_sessionStrand_sp,
+                    this->privateCurrentStrand(),
+                    self,
+                    defer,
+                    &d_mutex);
             }
         }
 
@@ -2121,7 +2334,7 @@ void StreamSocket::privateShutdownSequenceComplete(
                                                  self,
                                                  event,
                                                  d_sessionStrand_sp,
-                                                 d_reactorStrand_sp,
+                                                 this->privateCurrentStrand(),
                                                  self,
                                                  defer,
                                                  &d_mutex);
@@ -2160,7 +2373,7 @@ void StreamSocket::privateShutdownSequenceComplete(
                 self,
                 bsl::shared_ptr<bdlbb::Blob>(),
                 receiveEvent,
-                d_reactorStrand_sp,
+                this->privateCurrentStrand(),
                 self,
                 defer,
                 &d_mutex);
@@ -2176,14 +2389,15 @@ void StreamSocket::privateShutdownSequenceComplete(
             event.setType(ntca::ReadQueueEventType::e_LOW_WATERMARK);
             event.setContext(d_receiveQueue.context());
 
-            ntcs::Dispatch::announceReadQueueLowWatermark(d_session_sp,
-                                                          self,
-                                                          event,
-                                                          d_sessionStrand_sp,
-                                                          d_reactorStrand_sp,
-                                                          self,
-                                                          defer,
-                                                          &d_mutex);
+            ntcs::Dispatch::announceReadQueueLowWatermark(
+                d_session_sp,
+                self,
+                event,
+                d_sessionStrand_sp,
+                this->privateCurrentStrand(),
+                self,
+                defer,
+                &d_mutex);
         }
 
         if (d_session_sp) {
@@ -2191,14 +2405,15 @@ void StreamSocket::privateShutdownSequenceComplete(
             event.setType(ntca::ShutdownEventType::e_RECEIVE);
             event.setContext(context.base());
 
-            ntcs::Dispatch::announceShutdownReceive(d_session_sp,
-                                                    self,
-                                                    event,
-                                                    d_sessionStrand_sp,
-                                                    d_reactorStrand_sp,
-                                                    self,
-                                                    defer,
-                                                    &d_mutex);
+            ntcs::Dispatch::announceShutdownReceive(
+                d_session_sp,
+                self,
+                event,
+                d_sessionStrand_sp,
+                this->privateCurrentStrand(),
+                self,
+                defer,
+                &d_mutex);
         }
     }
 
@@ -2208,14 +2423,15 @@ void StreamSocket::privateShutdownSequenceComplete(
             event.setType(ntca::ShutdownEventType::e_COMPLETE);
             event.setContext(context.base());
 
-            ntcs::Dispatch::announceShutdownComplete(d_session_sp,
-                                                     self,
-                                                     event,
-                                                     d_sessionStrand_sp,
-                                                     d_reactorStrand_sp,
-                                                     self,
-                                                     defer,
-                                                     &d_mutex);
+            ntcs::Dispatch::announceShutdownComplete(
+                d_session_sp,
+                self,
+                event,
+                d_sessionStrand_sp,
+                this->privateCurrentStrand(),
+                self,
+                defer,
+                &d_mutex);
         }
 
         // Note that detachment from the reactor is handled earlier in this
@@ -2249,7 +2465,7 @@ void StreamSocket::privateShutdownSequenceComplete(
         ntcs::Dispatch::announceClosed(d_manager_sp,
                                        self,
                                        d_managerStrand_sp,
-                                       d_reactorStrand_sp,
+                                       this->privateCurrentStrand(),
                                        self,
                                        defer,
                                        &d_mutex);
@@ -2271,7 +2487,7 @@ void StreamSocket::privateShutdownSequenceComplete(
         d_manager_sp.reset();
     }
 
-    this->moveAndExecute(&d_deferredCalls, ntci::Executor::Functor());
+    this->privateMoveAndExecute(&d_deferredCalls, ntci::Executor::Functor());
     d_deferredCalls.clear();
 
     if (lock) {
@@ -2910,7 +3126,32 @@ ntsa::Error StreamSocket::privateDequeueReceiveBuffer(
                                                      context,
                                                      d_receiveBlob_sp.get());
         if (error) {
-            return error;
+            if (!d_handshakeProcessed ||
+                error != ntsa::Error(ntsa::Error::e_WOULD_BLOCK))
+            {
+                return error;
+            }
+        }
+
+        d_handshakeProcessed = false;
+
+        if (NTCCFG_UNLIKELY(d_handshakeThreaded) &&
+            !d_encryption_sp->isHandshakeFinished())
+        {
+            if (d_handshakePending || d_receiveBlob_sp->length() == 0) {
+                return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+            }
+
+            error = this->privateDeferHandshake(self);
+            if (!error) {
+                return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+            }
+
+            NTCR_STREAMSOCKET_LOG_ENCRYPTION_HANDSHAKE_INLINE(error);
+
+            if (error == ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED)) {
+                d_handshakeThreaded = false;
+            }
         }
 
         error = d_encryption_sp->pushIncomingCipherText(*d_receiveBlob_sp);
@@ -2957,7 +3198,7 @@ ntsa::Error StreamSocket::privateDequeueReceiveBuffer(
                         self,
                         event,
                         d_sessionStrand_sp,
-                        d_reactorStrand_sp,
+                        this->privateCurrentStrand(),
                         self,
                         false,
                         &d_mutex);
@@ -2966,27 +3207,24 @@ ntsa::Error StreamSocket::privateDequeueReceiveBuffer(
         }
 
         if (NTCCFG_UNLIKELY(d_encryption_sp->hasOutgoingCipherText())) {
-            bdlbb::Blob cipherData(d_outgoingBufferFactory_sp.get());
-
-            while (NTCCFG_UNLIKELY(d_encryption_sp->hasOutgoingCipherText())) {
-                error = d_encryption_sp->popOutgoingCipherText(&cipherData);
-                if (error) {
-                    return error;
-                }
+            error = this->privateSendOutgoingCipherText(self);
+            if (error) {
+                return error;
             }
+        }
 
-            if (NTCCFG_UNLIKELY(cipherData.length() > 0)) {
-                ntcq::SendState state;
-                state.setCounter(d_sendCounter++);
+        if (NTCCFG_UNLIKELY(d_upgradeOffload)) {
+            error = this->privateOffloadEncryption(self);
+            if (error) {
+                return error;
+            }
 
-                error = this->privateSendRaw(self,
-                                             cipherData,
-                                             state,
-                                             ntca::SendOptions(),
-                                             d_sendComplete);
-                if (error) {
-                    return error;
+            if (!d_encryption_sp) {
+                if (numBytesReceived == 0) {
+                    return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
                 }
+
+                return ntsa::Error();
             }
         }
 
@@ -3000,16 +3238,17 @@ ntsa::Error StreamSocket::privateDequeueReceiveBuffer(
                 event.setType(ntca::DowngradeEventType::e_COMPLETE);
                 event.setContext(context);
 
-                ntcs::Dispatch::announceDowngradeComplete(d_session_sp,
-                                                          self,
-                                                          event,
-                                                          d_sessionStrand_sp,
-                                                          d_reactorStrand_sp,
-                                                          self,
-                                                          false,
-                                                          &d_mutex);
-            }
-        }
+                ntcs::Dispatch::announceDowngradeComplete(
+                    d_session_sp,
+                    self,
+                    event,
+                    d_sessionStrand_sp,
+                    this->privateCurrentStrand(),
+                    self,
+                    false,
+                    &d_mutex);
+            }
+        }
 
         if (numBytesReceived == 0) {
             return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
@@ -3119,6 +3358,62 @@ ntsa::Error StreamSocket::privateDequeueReceiveBufferRaw(
     return ntsa::Error();
 }
 
+ntsa::Error StreamSocket::privateDequeueReceiveBufferDirect(
+    const bsl::shared_ptr<StreamSocket>& self,
+    ntsa::ReceiveContext*                context,
+    const ntsa::MutableBuffer&           buffer)
+{
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    if (!d_socket_sp) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    ntsa::Data data(buffer);
+
+    error = d_socket_sp->receive(context, &data, d_receiveOptions);
+    if (NTCCFG_UNLIKELY(error)) {
+        if (NTCCFG_LIKELY(error == ntsa::Error::e_WOULD_BLOCK)) {
+            NTCR_STREAMSOCKET_LOG_RECEIVE_BUFFER_UNDERFLOW();
+            return error;
+        }
+        else if (error == ntsa::Error::e_EOF) {
+            NTCR_STREAMSOCKET_LOG_END_OF_FILE();
+            this->privateShutdownReceive(self,
+                                         ntsa::ShutdownOrigin::e_REMOTE,
+                                         false);
+            return error;
+        }
+        else {
+            NTCR_STREAMSOCKET_LOG_RECEIVE_FAILURE(error);
+            return error;
+        }
+    }
+
+#if NTCR_STREAMSOCKET_RECEIVE_FEEDBACK
+    d_receiveFeedback.setFeedback(context->bytesReceivable(),
+                                  context->bytesReceived());
+#endif
+
+    if (NTCCFG_LIKELY(context->bytesReceived() > 0)) {
+        NTCR_STREAMSOCKET_LOG_RECEIVE_RESULT(*context);
+        NTCS_METRICS_UPDATE_RECEIVE_COMPLETE(*context);
+
+        d_totalBytesReceived += context->bytesReceived();
+    }
+    else {
+        NTCR_STREAMSOCKET_LOG_END_OF_FILE();
+        this->privateShutdownReceive(self,
+                                     ntsa::ShutdownOrigin::e_REMOTE,
+                                     false);
+        return ntsa::Error(ntsa::Error::e_EOF);
+    }
+
+    return ntsa::Error();
+}
+
 void StreamSocket::privateRearmAfterSend(
     const bsl::shared_ptr<StreamSocket>& self)
 {
@@ -3773,7 +4068,7 @@ ntsa::Error StreamSocket::privateOpen(
         ntcs::Dispatch::announceEstablished(d_manager_sp,
                                             self,
                                             d_managerStrand_sp,
-                                            d_reactorStrand_sp,
+                                            this->privateCurrentStrand(),
                                             self,
                                             true,
                                             &d_mutex);
@@ -3992,6 +4287,11 @@ ntsa::Error StreamSocket::privateUpgrade(
         bdlf::MemFnUtil::memFn(&StreamSocket::privateEncryptionHandshake,
                                this);
 
+    // Identify the peer so that a session previously established with it
+    // may be resumed.
+
+    d_encryption_sp->setRemoteEndpoint(d_remoteEndpoint);
+
     error =
         d_encryption_sp->initiateHandshake(upgradeOptions, handshakeCallback);
     if (error) {
@@ -4081,6 +4381,133 @@ ntsa::Error StreamSocket::privateUpgrade(
         }
     }
 
+    // Offload the encryption session if the handshake is already complete.
+
+    error = this->privateOffloadEncryption(self);
+    if (error) {
+        return error;
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error StreamSocket::privateOffloadEncryption(
+    const bsl::shared_ptr<StreamSocket>& self)
+{
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    if (!d_upgradeOffload || !d_encryption_sp ||
+        !d_encryption_sp->isHandshakeFinished())
+    {
+        return ntsa::Error();
+    }
+
+    // Defer offloading while the encryption session holds cipher text not
+    // yet sent, or plain text not yet popped, and while the send queue holds
+    // cipher text produced by the encryption session: the operating system
+    // would otherwise encrypt that cipher text again.
+
+    if (d_encryption_sp->hasOutgoingCipherText() ||
+        d_encryption_sp->hasIncomingPlainText() || d_sendQueue.hasEntry())
+    {
+        return ntsa::Error();
+    }
+
+    ntsa::TrafficKeys keys;
+    error = d_encryption_sp->exportTrafficKeys(&keys);
+    if (error) {
+        if (error == ntsa::Error(ntsa::Error::e_WOULD_BLOCK)) {
+            return ntsa::Error();
+        }
+
+        NTCR_STREAMSOCKET_LOG_ENCRYPTION_OFFLOAD_UNSUPPORTED(error);
+
+        d_upgradeOffload = false;
+        return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+    }
+
+    error = d_socket_sp->setTrafficKeys(keys);
+    if (error) {
+        NTCR_STREAMSOCKET_LOG_ENCRYPTION_OFFLOAD_UNSUPPORTED(error);
+
+        d_upgradeOffload = false;
+        return error;
+    }
+
+    NTCR_STREAMSOCKET_LOG_ENCRYPTION_OFFLOAD_COMPLETE();
+
+    d_upgradeOffload = false;
+
+    d_offloadedEncryption_sp = d_encryption_sp;
+    d_encryption_sp.reset();
+
+    // Records other than application data, such as session tickets and
+    // alerts, are now decrypted by the operating system and must be
+    // interpreted when received.
+
+    d_receiveOptions.setEncryptionOffloaded(true);
+
+    this->privateCompleteUpgrade(self);
+
+    return ntsa::Error();
+}
+
+ntsa::Error StreamSocket::privateDeferHandshake(
+    const bsl::shared_ptr<StreamSocket>& self)
+{
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    ntcs::ObserverRef<ntci::ReactorPool> reactorPoolRef(&d_reactorPool);
+    if (!reactorPoolRef) {
+        return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+    }
+
+    error = reactorPoolRef->executeHandshake(
+        bdlf::BindUtil::bind(&StreamSocket::processHandshake, self));
+    if (error) {
+        return error;
+    }
+
+    NTCR_STREAMSOCKET_LOG_ENCRYPTION_HANDSHAKE_DEFERRED(
+        d_receiveBlob_sp->length());
+
+    d_handshakePending = true;
+
+    return ntsa::Error();
+}
+
+ntsa::Error StreamSocket::privateSendOutgoingCipherText(
+    const bsl::shared_ptr<StreamSocket>& self)
+{
+    ntsa::Error error;
+
+    bdlbb::Blob cipherData(d_outgoingBufferFactory_sp.get());
+
+    while (NTCCFG_UNLIKELY(d_encryption_sp->hasOutgoingCipherText())) {
+        error = d_encryption_sp->popOutgoingCipherText(&cipherData);
+        if (error) {
+            return error;
+        }
+    }
+
+    if (NTCCFG_UNLIKELY(cipherData.length() > 0)) {
+        ntcq::SendState state;
+        state.setCounter(d_sendCounter++);
+
+        error = this->privateSendRaw(self,
+                                     cipherData,
+                                     state,
+                                     ntca::SendOptions(),
+                                     d_sendComplete);
+        if (error) {
+            return error;
+        }
+    }
+
     return ntsa::Error();
 }
 
@@ -4533,7 +4960,7 @@ void StreamSocket::privateZeroCopyUpdate(
 
                 callback.dispatch(self,
                                   event,
-                                  d_reactorStrand_sp,
+                                  this->privateCurrentStrand(),
                                   self,
                                   false,
                                   &d_mutex);
@@ -4559,6 +4986,7 @@ StreamSocket::StreamSocket(
 , d_socket_sp()
 , d_acceptor_sp()
 , d_encryption_sp()
+, d_offloadedEncryption_sp()
 #if NTCR_STREAMSOCKET_OBSERVE_BY_WEAK_PTR
 , d_resolver(bsl::weak_ptr<ntci::Resolver>(resolver))
 , d_reactor(bsl::weak_ptr<ntci::Reactor>(reactor))
@@ -4569,6 +4997,7 @@ StreamSocket::StreamSocket(
 , d_reactorPool(reactorPool.get())
 #endif
 , d_reactorStrand_sp()
+, d_callbackStrand_sp()
 , d_manager_sp()
 , d_managerStrand_sp()
 , d_session_sp()
@@ -4610,6 +5039,11 @@ StreamSocket::StreamSocket(
 , d_upgradeCallback(basicAllocator)
 , d_upgradeTimer_sp()
 , d_upgradeInProgress(false)
+, d_upgradeOffload(false)
+, d_handshakeThreaded(false)
+, d_handshakePending(false)
+, d_handshakeProcessed(false)
+, d_handshakeThreadId(0)
 , d_timestampOutgoingData(false)
 , d_timestampIncomingData(false)
 , d_timestampCorrelator(ntsa::TransportMode::e_STREAM,
@@ -4641,6 +5075,15 @@ StreamSocket::StreamSocket(
 
     d_receiveOptions.hideEndpoint();
 
+    // Receiving into a blob remaps the pages of a region of memory, reused
+    // by the socket once the last reference to the data previously mapped
+    // into it is released, for each receive, so zero-copy receive is only
+    // enabled when explicitly requested.
+
+    if (d_options.zeroCopyReceive().valueOr(false)) {
+        d_receiveOptions.setZeroCopy(true);
+    }
+
     if (!d_options.writeQueueLowWatermark().isNull()) {
         d_sendQueue.setLowWatermark(
             d_options.writeQueueLowWatermark().value());
@@ -4683,8 +5126,17 @@ StreamSocket::StreamSocket(
         d_reactorStrand_sp = reactor->createStrand(d_allocator_p);
     }
 
+    if (reactorPool) {
+        d_callbackStrand_sp =
+            reactorPool->createCallbackStrand(reactor, d_allocator_p);
+    }
+
+    if (!d_callbackStrand_sp) {
+        d_callbackStrand_sp = d_reactorStrand_sp;
+    }
+
     if (!d_managerStrand_sp) {
-        d_managerStrand_sp = d_reactorStrand_sp;
+        d_managerStrand_sp = d_callbackStrand_sp;
     }
 
     if (!d_options.metrics().isNull() && d_options.metrics().value()) {
@@ -5191,7 +5643,7 @@ ntsa::Error StreamSocket::upgrade(
         return ntsa::Error(ntsa::Error::e_INVALID);
     }
 
-    if (d_encryption_sp) {
+    if (d_encryption_sp || d_offloadedEncryption_sp) {
         return ntsa::Error(ntsa::Error::e_INVALID);
     }
 
@@ -5201,6 +5653,11 @@ ntsa::Error StreamSocket::upgrade(
 
     d_upgradeCallback   = callback;
     d_upgradeInProgress = true;
+    d_upgradeOffload    = options.offload();
+
+    d_handshakeThreaded  = !options.handshakeInline();
+    d_handshakePending   = false;
+    d_handshakeProcessed = false;
 
     // Initiate the upgrade.
 
@@ -5574,6 +6031,195 @@ ntsa::Error StreamSocket::receive(ntca::ReceiveContext*       context,
     return error;
 }
 
+ntsa::Error StreamSocket::receive(ntca::ReceiveContext*       context,
+                                  bsl::size_t*                numBytesReceived,
+                                  const ntsa::MutableBuffer&  buffer,
+                                  const ntca::ReceiveOptions& options)
+{
+    bsl::shared_ptr<StreamSocket> self = this->getSelf(this);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_CONTEXT_GUARD_DESCRIPTOR(d_publicHandle);
+    NTCI_LOG_CONTEXT_GUARD_SOURCE_ENDPOINT(d_sourceEndpoint);
+    NTCI_LOG_CONTEXT_GUARD_REMOTE_ENDPOINT(d_remoteEndpoint);
+
+    ntsa::Error error;
+
+    *numBytesReceived = 0;
+
+    if (NTCCFG_UNLIKELY(!d_openState.canReceive())) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    const bsl::size_t maxSize = bsl::min(options.maxSize(), buffer.size());
+
+    if (NTCCFG_UNLIKELY(options.minSize() > maxSize)) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    if (NTCCFG_UNLIKELY(d_receiveQueue.size() == 0 &&
+                        !d_shutdownState.canReceive()))
+    {
+        return ntsa::Error(ntsa::Error::e_EOF);
+    }
+
+    if (d_receiveQueue.size() == 0 && maxSize > 0 &&
+        !d_receiveQueue.hasCallbackEntry() && !d_encryption_sp &&
+        !d_receiveRateLimiter_sp && !d_receiveOptions.wantTimestamp())
+    {
+        // The read queue is empty and nothing else is waiting for data, so
+        // copy the socket receive buffer directly into the caller's storage
+        // rather than through the blob buffers of the read queue.
+
+        ntsa::ReceiveContext receiveContext;
+        error = this->privateDequeueReceiveBufferDirect(
+            self,
+            &receiveContext,
+            ntsa::MutableBuffer(buffer.data(), maxSize));
+        if (NTCCFG_UNLIKELY(error)) {
+            if (error == ntsa::Error::e_WOULD_BLOCK) {
+                this->privateRelaxFlowControl(self,
+                                              ntca::FlowControlType::e_RECEIVE,
+                                              true,
+                                              false);
+            }
+            else if (error != ntsa::Error::e_EOF) {
+                this->privateFail(self, error);
+            }
+
+            return error;
+        }
+
+        const bsl::size_t numBytesDequeued = receiveContext.bytesReceived();
+
+        if (NTCCFG_LIKELY(numBytesDequeued >= options.minSize())) {
+            context->setTransport(d_transport);
+            context->setEndpoint(d_remoteEndpoint);
+
+            *numBytesReceived = numBytesDequeued;
+
+            return ntsa::Error();
+        }
+
+        // Too few bytes were received to satisfy the read operation: keep
+        // them on the read queue until more data arrives.
+
+        bdlbb::BlobUtil::append(
+            d_receiveQueue.data().get(),
+            static_cast<const char*>(buffer.data()),
+            static_cast<int>(numBytesDequeued));
+
+        {
+            ntcq::ReceiveQueueEntry entry;
+            entry.setLength(numBytesDequeued);
+            entry.setTimestamp(bsls::TimeUtil::getTimer());
+
+            d_receiveQueue.pushEntry(entry);
+        }
+
+        NTCR_STREAMSOCKET_LOG_READ_QUEUE_FILLED(d_receiveQueue.size());
+
+        NTCS_METRICS_UPDATE_READ_QUEUE_SIZE(d_receiveQueue.size());
+
+        this->privateAnnounceReadQueueWatermarks(self);
+
+        if (!d_receiveQueue.isHighWatermarkViolated()) {
+            this->privateRelaxFlowControl(self,
+                                          ntca::FlowControlType::e_RECEIVE,
+                                          true,
+                                          false);
+        }
+
+        return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+    }
+
+    if (NTCCFG_LIKELY(d_receiveQueue.size() >= options.minSize())) {
+        bool receiveQueueHighWatermarkViolatedBefore =
+            d_receiveQueue.isHighWatermarkViolated();
+
+        bsl::size_t numBytesRemaining = maxSize;
+        bsl::size_t numBytesDequeued  = 0;
+
+        while (NTCCFG_LIKELY(d_receiveQueue.hasEntry())) {
+            if (numBytesRemaining == 0) {
+                break;
+            }
+
+            ntcq::ReceiveQueueEntry& entry = d_receiveQueue.frontEntry();
+
+            bsl::size_t numBytesToDequeue =
+                bsl::min(numBytesRemaining, entry.length());
+
+            numBytesDequeued += numBytesToDequeue;
+            BSLS_ASSERT(numBytesDequeued <= maxSize);
+
+            BSLS_ASSERT(numBytesRemaining >= numBytesToDequeue);
+            numBytesRemaining -= numBytesToDequeue;
+
+            if (numBytesToDequeue == entry.length()) {
+                NTCS_METRICS_UPDATE_READ_QUEUE_DELAY(entry.delay());
+
+                if (d_receiveQueue.popEntry()) {
+                    break;
+                }
+            }
+            else {
+                d_receiveQueue.popSize(numBytesToDequeue);
+                break;
+            }
+        }
+
+        BSLS_ASSERT(numBytesDequeued >= options.minSize());
+        BSLS_ASSERT(numBytesDequeued <= maxSize);
+
+        context->setTransport(d_transport);
+        context->setEndpoint(d_remoteEndpoint);
+
+        if (numBytesDequeued > 0) {
+            bdlbb::BlobUtil::copy(static_cast<char*>(buffer.data()),
+                                  *d_receiveQueue.data(),
+                                  0,
+                                  static_cast<int>(numBytesDequeued));
+
+            ntcs::BlobUtil::pop(d_receiveQueue.data(), numBytesDequeued);
+        }
+
+        *numBytesReceived = numBytesDequeued;
+
+        BSLS_ASSERT(d_receiveQueue.size() ==
+                    NTCCFG_WARNING_PROMOTE(bsl::size_t,
+                                           d_receiveQueue.data()->length()));
+
+        NTCR_STREAMSOCKET_LOG_READ_QUEUE_DRAINED(d_receiveQueue.size());
+
+        NTCS_METRICS_UPDATE_READ_QUEUE_SIZE(d_receiveQueue.size());
+
+        bool receiveQueueHighWatermarkViolatedAfter =
+            d_receiveQueue.isHighWatermarkViolated();
+
+        if (receiveQueueHighWatermarkViolatedBefore &&
+            !receiveQueueHighWatermarkViolatedAfter)
+        {
+            this->privateRelaxFlowControl(self,
+                                          ntca::FlowControlType::e_RECEIVE,
+                                          true,
+                                          false);
+        }
+
+        return ntsa::Error();
+    }
+
+    this->privateRelaxFlowControl(self,
+                                  ntca::FlowControlType::e_RECEIVE,
+                                  true,
+                                  false);
+
+    return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+}
+
 ntsa::Error StreamSocket::receive(const ntca::ReceiveOptions&  options,
                                   const ntci::ReceiveFunction& callback)
 {
@@ -5774,7 +6420,7 @@ ntsa::Error StreamSocket::registerManager(
         d_managerStrand_sp = d_manager_sp->strand();
 
         if (!d_managerStrand_sp) {
-            d_managerStrand_sp = d_reactorStrand_sp;
+            d_managerStrand_sp = d_callbackStrand_sp;
         }
     }
     else {
@@ -5807,7 +6453,7 @@ ntsa::Error StreamSocket::registerSession(
         d_sessionStrand_sp = d_session_sp->strand();
 
         if (!d_sessionStrand_sp) {
-            d_sessionStrand_sp = d_reactorStrand_sp;
+            d_sessionStrand_sp = d_callbackStrand_sp;
         }
     }
     else {
@@ -5829,14 +6475,14 @@ ntsa::Error StreamSocket::registerSessionCallback(
         bsl::shared_ptr<ntcu::StreamSocketSession> session;
         session.createInplace(d_allocator_p,
                               callback,
-                              d_reactorStrand_sp,
+                              d_callbackStrand_sp,
                               d_allocator_p);
 
         d_session_sp       = session;
         d_sessionStrand_sp = d_session_sp->strand();
 
         if (!d_sessionStrand_sp) {
-            d_sessionStrand_sp = d_reactorStrand_sp;
+            d_sessionStrand_sp = d_callbackStrand_sp;
         }
     }
     else {
@@ -5863,7 +6509,7 @@ ntsa::Error StreamSocket::registerSessionCallback(
         d_sessionStrand_sp = d_session_sp->strand();
 
         if (!d_sessionStrand_sp) {
-            d_sessionStrand_sp = d_reactorStrand_sp;
+            d_sessionStrand_sp = d_callbackStrand_sp;
         }
     }
     else {
@@ -6379,7 +7025,7 @@ ntsa::Error StreamSocket::cancel(const ntca::SendToken& token)
 
         callback.dispatch(self,
                           sendEvent,
-                          d_reactorStrand_sp,
+                          this->privateCurrentStrand(),
                           self,
                           true,
                           &d_mutex);
@@ -6420,7 +7066,7 @@ ntsa::Error StreamSocket::cancel(const ntca::ReceiveToken& token)
             self,
             bsl::shared_ptr<bdlbb::Blob>(),
             receiveEvent,
-            d_reactorStrand_sp,
+            this->privateCurrentStrand(),
             self,
             true,
             &d_mutex);
@@ -6614,8 +7260,8 @@ void StreamSocket::close(const ntci::CloseCallback& callback)
 
 void StreamSocket::execute(const Functor& functor)
 {
-    if (d_reactorStrand_sp) {
-        d_reactorStrand_sp->execute(functor);
+    if (d_callbackStrand_sp) {
+        d_callbackStrand_sp->execute(functor);
     }
     else {
         ntcs::ObserverRef<ntci::Reactor> reactorRef(&d_reactor);
@@ -6631,8 +7277,8 @@ void StreamSocket::execute(const Functor& functor)
 void StreamSocket::moveAndExecute(FunctorSequence* functorSequence,
                                   const Functor&   functor)
 {
-    if (d_reactorStrand_sp) {
-        d_reactorStrand_sp->moveAndExecute(functorSequence, functor);
+    if (d_callbackStrand_sp) {
+        d_callbackStrand_sp->moveAndExecute(functorSequence, functor);
     }
     else {
         ntcs::ObserverRef<ntci::Reactor> reactorRef(&d_reactor);
@@ -6645,6 +7291,22 @@ void StreamSocket::moveAndExecute(FunctorSequence* functorSequence,
     }
 }
 
+void StreamSocket::executeInplace(InplaceFunctor* functor)
+{
+    if (d_callbackStrand_sp) {
+        d_callbackStrand_sp->executeInplace(functor);
+    }
+    else {
+        ntcs::ObserverRef<ntci::Reactor> reactorRef(&d_reactor);
+        if (reactorRef) {
+            reactorRef->executeInplace(functor);
+        }
+        else {
+            ntci::Executor::executeInplace(functor);
+        }
+    }
+}
+
 // MANIPULATROS (ntci::StrandFactory)
 bsl::shared_ptr<ntci::Strand> StreamSocket::createStrand(
     bslma::Allocator* basicAllocator)
@@ -6747,6 +7409,9 @@ bsl::shared_ptr<ntci::EncryptionCertificate> StreamSocket::sourceCertificate()
     if (d_encryption_sp) {
         result = d_encryption_sp->sourceCertificate();
     }
+    else if (d_offloadedEncryption_sp) {
+        result = d_offloadedEncryption_sp->sourceCertificate();
+    }
 
     return result;
 }
@@ -6760,6 +7425,9 @@ bsl::shared_ptr<ntci::EncryptionCertificate> StreamSocket::remoteCertificate()
     if (d_encryption_sp) {
         result = d_encryption_sp->remoteCertificate();
     }
+    else if (d_offloadedEncryption_sp) {
+        result = d_offloadedEncryption_sp->remoteCertificate();
+    }
 
     return result;
 }
@@ -6772,6 +7440,9 @@ bsl::shared_ptr<ntci::EncryptionKey> StreamSocket::privateKey() const
     if (d_encryption_sp) {
         result = d_encryption_sp->privateKey();
     }
+    else if (d_offloadedEncryption_sp) {
+        result = d_offloadedEncryption_sp->privateKey();
+    }
 
     return result;
 }
@@ -6782,6 +7453,11 @@ bsl::shared_ptr<ntci::ListenerSocket> StreamSocket::acceptor() const
 }
 
 const bsl::shared_ptr<ntci::Strand>& StreamSocket::strand() const
+{
+    return d_callbackStrand_sp;
+}
+
+const bsl::shared_ptr<ntci::Strand>& StreamSocket::reactorStrand() const
 {
     return d_reactorStrand_sp;
 }
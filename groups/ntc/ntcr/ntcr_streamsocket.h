@@ -93,10 +93,12 @@ class StreamSocket : public ntci::StreamSocket,
     bsl::shared_ptr<ntsi::StreamSocket>        d_socket_sp;
     bsl::shared_ptr<ntci::ListenerSocket>      d_acceptor_sp;
     bsl::shared_ptr<ntci::Encryption>          d_encryption_sp;
+    bsl::shared_ptr<ntci::Encryption>          d_offloadedEncryption_sp;
     ntcs::Observer<ntci::Resolver>             d_resolver;
     ntcs::Observer<ntci::Reactor>              d_reactor;
     ntcs::Observer<ntci::ReactorPool>          d_reactorPool;
     bsl::shared_ptr<ntci::Strand>              d_reactorStrand_sp;
+    bsl::shared_ptr<ntci::Strand>              d_callbackStrand_sp;
     bsl::shared_ptr<ntci::StreamSocketManager> d_manager_sp;
     bsl::shared_ptr<ntci::Strand>              d_managerStrand_sp;
     bsl::shared_ptr<ntci::StreamSocketSession> d_session_sp;
@@ -138,6 +140,11 @@ class StreamSocket : public ntci::StreamSocket,
     ntci::UpgradeCallback                      d_upgradeCallback;
     bsl::shared_ptr<ntci::Timer>               d_upgradeTimer_sp;
     bool                                       d_upgradeInProgress;
+    bool                                       d_upgradeOffload;
+    bool                                       d_handshakeThreaded;
+    bool                                       d_handshakePending;
+    bool                                       d_handshakeProcessed;
+    bsls::AtomicUint64                         d_handshakeThreadId;
     bool                                       d_timestampOutgoingData;
     bool                                       d_timestampIncomingData;
     ntcu::TimestampCorrelator                  d_timestampCorrelator;
@@ -209,20 +216,67 @@ class StreamSocket : public ntci::StreamSocket,
         const ntca::TimerEvent&                                 event,
         const bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry>& entry);
 
+    /// Push the cipher text received during the handshake into the
+    /// encryption session and send the resulting cipher text, if any, on a
+    /// thread dedicated to processing handshakes. The cipher text is pushed
+    /// without holding the lock, so that the cryptographic operations of
+    /// the handshake do not block the I/O threads, which are kept from
+    /// pushing into the encryption session while the step is pending.
+    /// Continue processing the readability of the socket on its strand once
+    /// the handshake is complete.
+    void processHandshake();
+
     /// Process the completion or failure according to the specified 'error'
     /// of the TLS handshake to the peer identified by the specified
     /// 'certificate', if any. If an 'error' is indicated, the cause of the
-    /// handshake failure is specified by 'details'.
+    /// handshake failure is specified by 'details'. Acquire the lock if
+    /// called while a step of the handshake is processed without the lock
+    /// held on a thread dedicated to processing handshakes.
     void privateEncryptionHandshake(
         const ntsa::Error&                                  error,
         const bsl::shared_ptr<ntci::EncryptionCertificate>& certificate,
         const bsl::string&                                  details);
 
+    /// Announce the completion or failure according to the specified
+    /// 'error' of the TLS handshake to the peer identified by the specified
+    /// 'certificate', if any. If an 'error' is indicated, the cause of the
+    /// handshake failure is specified by 'details'. Note that if
+    /// offloading was requested the completion of the upgrade is announced
+    /// only once the traffic keys are installed into the socket. The
+    /// behavior is undefined unless the lock is held.
+    void privateAnnounceEncryptionHandshake(
+        const ntsa::Error&                                  error,
+        const bsl::shared_ptr<ntci::EncryptionCertificate>& certificate,
+        const bsl::string&                                  details);
+
+    /// Return the strand on which the calling thread is executing for the
+    /// purpose of deciding whether a callback may be invoked immediately:
+    /// the callback strand if the calling thread is executing a callback on
+    /// a callback strand distinct from the reactor strand, and the reactor
+    /// strand otherwise.
+    const bsl::shared_ptr<ntci::Strand>& privateCurrentStrand() const;
+
+    /// Defer the execution of the specified 'functor' on the reactor strand,
+    /// if any, otherwise on the reactor.
+    void privateExecute(const Functor& functor);
+
+    /// Atomically defer the execution of the specified 'functorSequence'
+    /// immediately followed by the specified 'functor' on the reactor
+    /// strand, if any, otherwise on the reactor, then clear the
+    /// 'functorSequence'.
+    void privateMoveAndExecute(FunctorSequence* functorSequence,
+                               const Functor&   functor);
+
     /// Process the readability of the socket by performing one read
     /// iteration.
     ntsa::Error privateSocketReadableIteration(
         const bsl::shared_ptr<StreamSocket>& self);
 
+    /// Announce the read queue low watermark event and apply flow control
+    /// and announce the read queue high watermark event, if authorized.
+    void privateAnnounceReadQueueWatermarks(
+        const bsl::shared_ptr<StreamSocket>& self);
+
     /// Process the writability of the socket indicating the connection
     /// is established.
     ntsa::Error privateSocketWritableConnection(
@@ -267,6 +321,10 @@ class StreamSocket : public ntci::StreamSocket,
                                  const ntca::ConnectEvent&    connectEvent,
                                  bool                         lock);
 
+    /// Indicate the upgrade has completed and announce its completion to
+    /// the upgrade callback, if any.
+    void privateCompleteUpgrade(const bsl::shared_ptr<StreamSocket>& self);
+
     /// Indicate a upgrade failure has occurred and detach the socket
     /// from its monitor.
     void privateFailUpgrade(const bsl::shared_ptr<StreamSocket>& self,
@@ -393,6 +451,14 @@ class StreamSocket : public ntci::StreamSocket,
         ntsa::ReceiveContext*                context,
         bdlbb::Blob*                         data);
 
+    /// Dequeue raw data from the socket receive buffer directly into the
+    /// caller-owned storage described by the specified 'buffer', bypassing
+    /// the read queue. Return the error.
+    ntsa::Error privateDequeueReceiveBufferDirect(
+        const bsl::shared_ptr<StreamSocket>& self,
+        ntsa::ReceiveContext*                context,
+        const ntsa::MutableBuffer&           buffer);
+
     /// Rearm the interest in the writability of the socket in the reactor,
     /// if necessary.
     void privateRearmAfterSend(const bsl::shared_ptr<StreamSocket>& self);
@@ -518,6 +584,33 @@ class StreamSocket : public ntci::StreamSocket,
         const bsl::shared_ptr<StreamSocket>& self,
         const ntca::UpgradeOptions&          upgradeOptions);
 
+    /// Install the traffic keys negotiated by the encryption session into
+    /// the socket, if requested when the upgrade was initiated, so that
+    /// subsequent records are encrypted and decrypted by the operating
+    /// system instead of by the encryption session, then complete the
+    /// upgrade. Defer the installation until the handshake is finished and
+    /// while cipher text remains to be processed by the encryption session
+    /// or sent through the socket. Return the error, notably
+    /// 'ntsa::Error::e_NOT_IMPLEMENTED' if either the session or the socket
+    /// does not support offloading, in which case the upgrade should fail.
+    ntsa::Error privateOffloadEncryption(
+        const bsl::shared_ptr<StreamSocket>& self);
+
+    /// Defer pushing the cipher text received during the handshake into the
+    /// encryption session to a thread dedicated to processing handshakes,
+    /// if any. Return the error, notably 'ntsa::Error::e_NOT_IMPLEMENTED'
+    /// if no threads are dedicated to processing handshakes, or
+    /// 'ntsa::Error::e_LIMIT' if the maximum number of handshake steps are
+    /// already pending processing, in which case the cipher text should be
+    /// pushed into the encryption session by the caller.
+    ntsa::Error privateDeferHandshake(
+        const bsl::shared_ptr<StreamSocket>& self);
+
+    /// Send any outgoing cipher text generated by the encryption session.
+    /// Return the error.
+    ntsa::Error privateSendOutgoingCipherText(
+        const bsl::shared_ptr<StreamSocket>& self);
+
     /// Retry connecting to the remote peer.
     void privateRetryConnect(const bsl::shared_ptr<StreamSocket>& self);
 
@@ -1024,6 +1117,28 @@ class StreamSocket : public ntci::StreamSocket,
                         const ntca::ReceiveOptions& options)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Dequeue received data according to the specified 'options' into the
+    /// caller-owned storage described by the specified 'buffer', and load
+    /// into the specified 'numBytesReceived' the number of bytes copied to
+    /// the 'buffer'. If the read queue has sufficient size to satisfy the
+    /// read operation, synchronously copy the read queue into the 'buffer'.
+    /// Otherwise, if the read queue is empty, no other read operations are
+    /// queued, and the data is neither encrypted, rate limited, nor
+    /// timestamped, copy the socket receive buffer directly into the
+    /// 'buffer', enqueueing onto the read queue any bytes so copied that do
+    /// not satisfy 'options.minSize()'. Return the error, notably
+    /// 'ntsa::Error::e_WOULD_BLOCK' if neither the read queue nor the
+    /// socket receive buffer has sufficient size to satisfy the read
+    /// operation, or 'ntsa::Error::e_EOF' if the read queue is empty and the
+    /// socket receive buffer has been shut down. All other errors indicate
+    /// no more received data is available at this time or will become
+    /// available in the future.
+    ntsa::Error receive(ntca::ReceiveContext*       context,
+                        bsl::size_t*                numBytesReceived,
+                        const ntsa::MutableBuffer&  buffer,
+                        const ntca::ReceiveOptions& options)
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Dequeue received data according to the specified 'options'. If the
     /// read queue has sufficient size to satisfy the read operation,
     /// synchronously copy the read queue into an internally allocated data
@@ -1240,15 +1355,20 @@ class StreamSocket : public ntci::StreamSocket,
     /// specified at the time the callback is created.
     void close(const ntci::CloseCallback& callback) BSLS_KEYWORD_OVERRIDE;
 
-    /// Defer the execution of the specified 'functor'.
+    /// Defer the execution of the specified 'functor' on the strand of this
+    /// socket.
     void execute(const Functor& functor) BSLS_KEYWORD_OVERRIDE;
 
     /// Atomically defer the execution of the specified 'functorSequence'
-    /// immediately followed by the specified 'functor', then clear the
-    /// 'functorSequence'.
+    /// immediately followed by the specified 'functor' on the strand of
+    /// this socket, then clear the 'functorSequence'.
     void moveAndExecute(FunctorSequence* functorSequence,
                         const Functor&   functor) BSLS_KEYWORD_OVERRIDE;
 
+    /// Defer the execution of the callable object stored by the specified
+    /// 'functor' on the strand of this socket, leaving the 'functor' empty.
+    void executeInplace(InplaceFunctor* functor) BSLS_KEYWORD_OVERRIDE;
+
     /// Create a new strand to serialize execution of functors. Optionally
     /// specify a 'basicAllocator' used to supply memory. If
     /// 'basicAllocator' is 0, the currently installed default allocator is
@@ -1342,9 +1462,23 @@ class StreamSocket : public ntci::StreamSocket,
 
     /// Return the strand that guarantees sequential, non-current execution
     /// of arbitrary functors on the unspecified threads processing events
-    /// for this object.
+    /// for this object. This is the strand on which the callbacks of this
+    /// socket are invoked, unless a callback is registered with a strand of
+    /// its own. Note that when the reactor pool supplies a callback strand,
+    /// e.g. when 'ntca::InterfaceConfig::strandStealing' is enabled, this
+    /// strand differs from 'reactorStrand()': functors executed on it may
+    /// run on any thread of the pool. Functors passed to 'execute' are
+    /// always executed on this strand, so they are sequenced with the
+    /// callbacks of this socket.
     const bsl::shared_ptr<ntci::Strand>& strand() const BSLS_KEYWORD_OVERRIDE;
 
+    /// Return the strand on which the readiness of this socket detected by
+    /// its reactor is processed. Note that this strand differs from the
+    /// strand on which the callbacks of this socket are invoked when those
+    /// callbacks may be stolen by other threads of the reactor pool.
+    const bsl::shared_ptr<ntci::Strand>& reactorStrand() const
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Return the handle of the thread that manages this socket, or
     /// the default value if no such thread has been set.
     bslmt::ThreadUtil::Handle threadHandle() const BSLS_KEYWORD_OVERRIDE;
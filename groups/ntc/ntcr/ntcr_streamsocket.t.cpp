@@ -21,6 +21,7 @@
 #include <ntcd_datapool.h>
 #include <ntcd_datautil.h>
 #include <ntcd_encryption.h>
+#include <ntcd_listenersocket.h>
 #include <ntcd_reactor.h>
 #include <ntcd_resolver.h>
 #include <ntcd_simulation.h>
@@ -45,6 +46,8 @@
 #include <bdlf_placeholder.h>
 #include <bdlma_countingallocator.h>
 #include <bdlt_currenttime.h>
+#include <bdlt_datetimetz.h>
+#include <bslma_testallocator.h>
 #include <bslmt_barrier.h>
 #include <bslmt_latch.h>
 #include <bslmt_lockguard.h>
@@ -52,6 +55,7 @@
 #include <bslmt_semaphore.h>
 #include <bslmt_threadgroup.h>
 #include <bslmt_threadutil.h>
+#include <bsls_atomic.h>
 #include <bsl_unordered_map.h>
 
 #if NTCCFG_TEST_MOCK_ENABLED
@@ -5953,6 +5957,1310 @@ NTCCFG_TEST_CASE(35)
     NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+namespace test {
+namespace concern36 {
+
+/// Receive from the specified 'streamSocket' into the specified 'buffer'
+/// having the specified 'size' at least the specified 'minSize' bytes,
+/// retrying while the operation would block. Load into the specified
+/// 'numBytesReceived' the number of bytes received. Return the error.
+ntsa::Error receive(
+    const bsl::shared_ptr<ntcr::StreamSocket>& streamSocket,
+    bsl::size_t*                               numBytesReceived,
+    char*                                      buffer,
+    bsl::size_t                                size,
+    bsl::size_t                                minSize)
+{
+    ntca::ReceiveOptions options;
+    options.setMinSize(minSize);
+    options.setMaxSize(size);
+
+    while (true) {
+        ntca::ReceiveContext context;
+        ntsa::Error          error =
+            streamSocket->receive(&context,
+                                  numBytesReceived,
+                                  ntsa::MutableBuffer(buffer, size),
+                                  options);
+        if (error != ntsa::Error::e_WOULD_BLOCK) {
+            return error;
+        }
+
+        bslmt::ThreadUtil::microSleep(1000);
+    }
+}
+
+void execute(ntsa::Transport::Value                transport,
+             const bsl::shared_ptr<ntci::Reactor>& reactor,
+             bslma::Allocator*                     allocator)
+{
+    // Concern: Receive into caller-owned storage.
+
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_DEBUG("Stream socket caller-owned buffer test starting");
+
+    ntsa::Error                     error;
+    bsl::shared_ptr<ntcs::Metrics>  metrics;
+    bsl::shared_ptr<ntci::Resolver> resolver;
+
+    bsl::shared_ptr<ntcr::StreamSocket> clientStreamSocket;
+    bsl::shared_ptr<ntcr::StreamSocket> serverStreamSocket;
+    {
+        ntca::StreamSocketOptions options;
+        options.setTransport(transport);
+
+        bsl::shared_ptr<ntcd::StreamSocket> basicClientSocket;
+        bsl::shared_ptr<ntcd::StreamSocket> basicServerSocket;
+
+        error = ntcd::Simulation::createStreamSocketPair(&basicClientSocket,
+                                                         &basicServerSocket,
+                                                         transport);
+        NTCCFG_TEST_FALSE(error);
+
+        clientStreamSocket.createInplace(allocator,
+                                         options,
+                                         resolver,
+                                         reactor,
+                                         reactor,
+                                         metrics,
+                                         allocator);
+
+        error = clientStreamSocket->open(transport, basicClientSocket);
+        NTCCFG_TEST_FALSE(error);
+
+        serverStreamSocket.createInplace(allocator,
+                                         options,
+                                         resolver,
+                                         reactor,
+                                         reactor,
+                                         metrics,
+                                         allocator);
+
+        error = serverStreamSocket->open(transport, basicServerSocket);
+        NTCCFG_TEST_FALSE(error);
+    }
+
+    const char  k_DATA[]         = "abcdefghijklmn";
+    bsl::size_t numBytesReceived = 0;
+
+    // Receive data in pieces no larger than the caller's buffer.
+
+    error = clientStreamSocket->send(
+        ntsa::Data(ntsa::ConstBuffer(k_DATA, 10)),
+        ntca::SendOptions());
+    NTCCFG_TEST_OK(error);
+
+    {
+        bsl::string received(allocator);
+
+        while (received.size() < 10) {
+            char buffer[4];
+
+            error = test::concern36::receive(serverStreamSocket,
+                                             &numBytesReceived,
+                                             buffer,
+                                             sizeof buffer,
+                                             1);
+            NTCCFG_TEST_OK(error);
+            NTCCFG_TEST_GE(numBytesReceived, 1);
+            NTCCFG_TEST_LE(numBytesReceived, sizeof buffer);
+
+            received.append(buffer, numBytesReceived);
+        }
+
+        NTCCFG_TEST_EQ(received, bsl::string(k_DATA, 10, allocator));
+    }
+
+    // A minimum size larger than the caller's buffer is rejected.
+
+    {
+        char buffer[4];
+
+        ntca::ReceiveOptions options;
+        options.setMinSize(sizeof buffer + 1);
+
+        ntca::ReceiveContext context;
+        error = serverStreamSocket->receive(
+            &context,
+            &numBytesReceived,
+            ntsa::MutableBuffer(buffer, sizeof buffer),
+            options);
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_INVALID));
+        NTCCFG_TEST_EQ(numBytesReceived, 0);
+    }
+
+    // Bytes received that do not satisfy the minimum size are retained
+    // until the minimum size is satisfied.
+
+    error = clientStreamSocket->send(
+        ntsa::Data(ntsa::ConstBuffer(k_DATA + 10, 2)),
+        ntca::SendOptions());
+    NTCCFG_TEST_OK(error);
+
+    {
+        char buffer[8];
+
+        ntca::ReceiveOptions options;
+        options.setMinSize(4);
+        options.setMaxSize(sizeof buffer);
+
+        ntca::ReceiveContext context;
+        error = serverStreamSocket->receive(
+            &context,
+            &numBytesReceived,
+            ntsa::MutableBuffer(buffer, sizeof buffer),
+            options);
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+        NTCCFG_TEST_EQ(numBytesReceived, 0);
+
+        error = clientStreamSocket->send(
+            ntsa::Data(ntsa::ConstBuffer(k_DATA + 12, 2)),
+            ntca::SendOptions());
+        NTCCFG_TEST_OK(error);
+
+        error = test::concern36::receive(serverStreamSocket,
+                                         &numBytesReceived,
+                                         buffer,
+                                         sizeof buffer,
+                                         4);
+        NTCCFG_TEST_OK(error);
+        NTCCFG_TEST_EQ(numBytesReceived, 4);
+        NTCCFG_TEST_EQ(bsl::string(buffer, 4, allocator),
+                       bsl::string(k_DATA + 10, 4, allocator));
+    }
+
+    // The end of the stream is detected when receiving directly.
+
+    error = clientStreamSocket->shutdown(ntsa::ShutdownType::e_SEND,
+                                         ntsa::ShutdownMode::e_GRACEFUL);
+    NTCCFG_TEST_OK(error);
+
+    {
+        char buffer[4];
+
+        error = test::concern36::receive(serverStreamSocket,
+                                         &numBytesReceived,
+                                         buffer,
+                                         sizeof buffer,
+                                         1);
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_EOF));
+        NTCCFG_TEST_EQ(numBytesReceived, 0);
+    }
+
+    {
+        ntci::StreamSocketCloseGuard clientStreamSocketCloseGuard(
+            clientStreamSocket);
+
+        ntci::StreamSocketCloseGuard serverStreamSocketCloseGuard(
+            serverStreamSocket);
+    }
+
+    NTCI_LOG_DEBUG("Stream socket caller-owned buffer test complete");
+
+    reactor->stop();
+}
+
+}  // close namespace concern36
+}  // close namespace test
+
+NTCCFG_TEST_CASE(36)
+{
+    // Concern: Receive into caller-owned storage.
+
+    test::Framework::execute(&test::concern36::execute);
+}
+
+namespace test {
+namespace concern37 {
+
+/// Provide a simulated stream socket that records whether any receive
+/// operation requested zero-copy.
+class ZeroCopyReceiveSocket : public ntcd::StreamSocket
+{
+    bsls::AtomicBool d_zeroCopy;
+
+  private:
+    ZeroCopyReceiveSocket(const ZeroCopyReceiveSocket&) BSLS_KEYWORD_DELETED;
+    ZeroCopyReceiveSocket& operator=(const ZeroCopyReceiveSocket&)
+        BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new stream socket. Optionally specify a 'basicAllocator'
+    /// used to supply memory. If 'basicAllocator' is 0, the currently
+    /// installed default allocator is used.
+    explicit ZeroCopyReceiveSocket(bslma::Allocator* basicAllocator = 0)
+    : ntcd::StreamSocket(basicAllocator)
+    , d_zeroCopy(false)
+    {
+    }
+
+    /// Dequeue from the socket receive buffer into the specified 'data'
+    /// according to the specified 'options'. Load into the specified
+    /// 'context' the result of the operation. Return the error.
+    ntsa::Error receive(ntsa::ReceiveContext*       context,
+                        bdlbb::Blob*                data,
+                        const ntsa::ReceiveOptions& options)
+        BSLS_KEYWORD_OVERRIDE
+    {
+        if (options.zeroCopy()) {
+            d_zeroCopy = true;
+        }
+
+        return ntcd::StreamSocket::receive(context, data, options);
+    }
+
+    /// Dequeue from the socket receive buffer into the specified 'data'
+    /// according to the specified 'options'. Load into the specified
+    /// 'context' the result of the operation. Return the error.
+    ntsa::Error receive(ntsa::ReceiveContext*       context,
+                        ntsa::Data*                 data,
+                        const ntsa::ReceiveOptions& options)
+        BSLS_KEYWORD_OVERRIDE
+    {
+        if (options.zeroCopy()) {
+            d_zeroCopy = true;
+        }
+
+        return ntcd::StreamSocket::receive(context, data, options);
+    }
+
+    /// Return true if any receive operation requested zero-copy, otherwise
+    /// return false.
+    bool zeroCopy() const
+    {
+        return d_zeroCopy;
+    }
+};
+
+/// Create a simulated stream socket of the specified 'transport' connected
+/// to the specified 'server' and load it into the specified 'client'. Use
+/// the specified 'allocator' to supply memory. Return the error.
+ntsa::Error connect(
+    const bsl::shared_ptr<test::concern37::ZeroCopyReceiveSocket>& client,
+    bsl::shared_ptr<ntcd::StreamSocket>*                           server,
+    ntsa::Transport::Value                                         transport,
+    bslma::Allocator*                                              allocator)
+{
+    ntsa::Error error;
+
+    bsl::shared_ptr<ntcd::ListenerSocket> listenerSocket;
+    listenerSocket.createInplace(allocator, allocator);
+
+    error = listenerSocket->open(transport);
+    if (error) {
+        return error;
+    }
+
+    error = listenerSocket->bind(
+        ntsa::Endpoint(ntsa::IpEndpoint(ntsa::Ipv4Address::loopback(), 0)),
+        false);
+    if (error) {
+        return error;
+    }
+
+    ntsa::Endpoint listenerSourceEndpoint;
+    error = listenerSocket->sourceEndpoint(&listenerSourceEndpoint);
+    if (error) {
+        return error;
+    }
+
+    error = listenerSocket->listen(1);
+    if (error) {
+        return error;
+    }
+
+    error = client->open(transport);
+    if (error) {
+        return error;
+    }
+
+    error = client->connect(listenerSourceEndpoint);
+    if (error) {
+        return error;
+    }
+
+    bsl::shared_ptr<ntsi::StreamSocket> serverStreamSocket;
+    error = listenerSocket->accept(&serverStreamSocket);
+    if (error) {
+        return error;
+    }
+
+    listenerSocket->close();
+
+    bslstl::SharedPtrUtil::dynamicCast(server, serverStreamSocket);
+    if (!*server) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    return ntsa::Error();
+}
+
+void execute(ntsa::Transport::Value                transport,
+             const bsl::shared_ptr<ntci::Reactor>& reactor,
+             bslma::Allocator*                     allocator)
+{
+    // Concern: Zero-copy receive is requested from the operating system
+    // only when enabled by the stream socket options.
+
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_DEBUG("Stream socket zero-copy receive test starting");
+
+    ntsa::Error                     error;
+    bsl::shared_ptr<ntcs::Metrics>  metrics;
+    bsl::shared_ptr<ntci::Resolver> resolver;
+
+    bsl::shared_ptr<test::concern37::ZeroCopyReceiveSocket> basicClientSocket;
+    basicClientSocket.createInplace(allocator, allocator);
+
+    bsl::shared_ptr<ntcd::StreamSocket> basicServerSocket;
+
+    error = test::concern37::connect(basicClientSocket,
+                                     &basicServerSocket,
+                                     transport,
+                                     allocator);
+    NTCCFG_TEST_FALSE(error);
+
+    bsl::shared_ptr<ntci::StreamSocket> clientStreamSocket;
+    {
+        ntca::StreamSocketOptions options;
+        options.setTransport(transport);
+        options.setZeroCopyReceive(true);
+
+        bsl::shared_ptr<ntcr::StreamSocket> streamSocket;
+        streamSocket.createInplace(allocator,
+                                   options,
+                                   resolver,
+                                   reactor,
+                                   reactor,
+                                   metrics,
+                                   allocator);
+
+        error = streamSocket->open(transport, basicClientSocket);
+        NTCCFG_TEST_FALSE(error);
+
+        clientStreamSocket = streamSocket;
+    }
+
+    bsl::shared_ptr<ntci::StreamSocket> serverStreamSocket;
+    {
+        ntca::StreamSocketOptions options;
+        options.setTransport(transport);
+
+        bsl::shared_ptr<ntcr::StreamSocket> streamSocket;
+        streamSocket.createInplace(allocator,
+                                   options,
+                                   resolver,
+                                   reactor,
+                                   reactor,
+                                   metrics,
+                                   allocator);
+
+        error = streamSocket->open(transport, basicServerSocket);
+        NTCCFG_TEST_FALSE(error);
+
+        serverStreamSocket = streamSocket;
+    }
+
+    const bsl::size_t k_MESSAGE_SIZE = 1024;
+
+    bdlbb::Blob data(serverStreamSocket->outgoingBlobBufferFactory().get(),
+                     allocator);
+    ntcd::DataUtil::generateData(&data, k_MESSAGE_SIZE);
+
+    error = serverStreamSocket->send(data, ntca::SendOptions());
+    NTCCFG_TEST_OK(error);
+
+    bdlbb::Blob received(clientStreamSocket->incomingBlobBufferFactory().get(),
+                         allocator);
+    {
+        ntca::ReceiveOptions options;
+        options.setSize(k_MESSAGE_SIZE);
+
+        while (true) {
+            ntca::ReceiveContext context;
+            error = clientStreamSocket->receive(&context, &received, options);
+            if (error != ntsa::Error::e_WOULD_BLOCK) {
+                break;
+            }
+
+            bslmt::ThreadUtil::microSleep(1000);
+        }
+
+        NTCCFG_TEST_OK(error);
+    }
+
+    NTCCFG_TEST_EQ(bdlbb::BlobUtil::compare(received, data), 0);
+
+    NTCCFG_TEST_TRUE(basicClientSocket->zeroCopy());
+
+    {
+        ntci::StreamSocketCloseGuard clientStreamSocketCloseGuard(
+            clientStreamSocket);
+
+        ntci::StreamSocketCloseGuard serverStreamSocketCloseGuard(
+            serverStreamSocket);
+    }
+
+    NTCI_LOG_DEBUG("Stream socket zero-copy receive test complete");
+
+    reactor->stop();
+}
+
+}  // close namespace concern37
+}  // close namespace test
+
+NTCCFG_TEST_CASE(37)
+{
+    // Concern: Zero-copy receive is requested from the operating system
+    // only when enabled by the stream socket options.
+
+    test::Framework::execute(&test::concern37::execute);
+}
+
+namespace test {
+namespace concern38 {
+
+/// Provide a reactor pool that dedicates a new thread to processing each
+/// step of the handshake of a socket upgrading to encrypted communication,
+/// and otherwise forwards to a single reactor.
+class HandshakePool : public ntci::ReactorPool
+{
+    bsl::shared_ptr<ntci::Reactor> d_reactor_sp;
+    bslmt::ThreadGroup             d_threadGroup;
+    bsls::AtomicUint64             d_numHandshakeSteps;
+
+  private:
+    HandshakePool(const HandshakePool&) BSLS_KEYWORD_DELETED;
+    HandshakePool& operator=(const HandshakePool&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new reactor pool that forwards to the specified 'reactor'.
+    /// Optionally specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
+    explicit HandshakePool(const bsl::shared_ptr<ntci::Reactor>& reactor,
+                           bslma::Allocator* basicAllocator = 0)
+    : d_reactor_sp(reactor)
+    , d_threadGroup(basicAllocator)
+    , d_numHandshakeSteps(0)
+    {
+    }
+
+    /// Destroy this object.
+    ~HandshakePool() BSLS_KEYWORD_OVERRIDE
+    {
+        d_threadGroup.joinAll();
+    }
+
+    /// Return the reactor.
+    bsl::shared_ptr<ntci::Reactor> acquireReactor(
+        const ntca::LoadBalancingOptions& options) BSLS_KEYWORD_OVERRIDE
+    {
+        return d_reactor_sp->acquireReactor(options);
+    }
+
+    /// Release usage of the specified 'reactor' selected according to the
+    /// specified load balancing 'options'.
+    void releaseReactor(const bsl::shared_ptr<ntci::Reactor>& reactor,
+                        const ntca::LoadBalancingOptions&     options)
+        BSLS_KEYWORD_OVERRIDE
+    {
+        d_reactor_sp->releaseReactor(reactor, options);
+    }
+
+    /// Increment the current number of handle reservations, if permitted.
+    /// Return true if the resulting number of handle reservations is
+    /// permitted, and false otherwise.
+    bool acquireHandleReservation() BSLS_KEYWORD_OVERRIDE
+    {
+        return d_reactor_sp->acquireHandleReservation();
+    }
+
+    /// Decrement the current number of handle reservations.
+    void releaseHandleReservation() BSLS_KEYWORD_OVERRIDE
+    {
+        d_reactor_sp->releaseHandleReservation();
+    }
+
+    /// Return the number of reactors in the thread pool.
+    bsl::size_t numReactors() const BSLS_KEYWORD_OVERRIDE
+    {
+        return d_reactor_sp->numReactors();
+    }
+
+    /// Return the current number of threads in the thread pool.
+    bsl::size_t numThreads() const BSLS_KEYWORD_OVERRIDE
+    {
+        return d_reactor_sp->numThreads();
+    }
+
+    /// Return the minimum number of threads in the thread pool.
+    bsl::size_t minThreads() const BSLS_KEYWORD_OVERRIDE
+    {
+        return d_reactor_sp->minThreads();
+    }
+
+    /// Return the maximum number of threads in the thread pool.
+    bsl::size_t maxThreads() const BSLS_KEYWORD_OVERRIDE
+    {
+        return d_reactor_sp->maxThreads();
+    }
+
+    /// Execute the specified 'functor' on a new thread. Return the error.
+    ntsa::Error executeHandshake(const HandshakeFunctor& functor)
+        BSLS_KEYWORD_OVERRIDE
+    {
+        if (d_threadGroup.addThread(functor) != 0) {
+            return ntsa::Error(ntsa::Error::e_LIMIT);
+        }
+
+        ++d_numHandshakeSteps;
+        return ntsa::Error();
+    }
+
+    /// Block until each thread executing a step of a handshake completes.
+    void join()
+    {
+        d_threadGroup.joinAll();
+    }
+
+    /// Return the number of handshake steps deferred to this pool.
+    bsl::uint64_t numHandshakeSteps() const
+    {
+        return d_numHandshakeSteps.load();
+    }
+};
+
+/// Load into the specified 'certificate' and 'key' a new certificate and
+/// key for the specified 'name' having the specified 'serialNumber', issued
+/// by the specified 'authorityCertificate' that uses the specified
+/// 'authorityKey'. Use the specified 'allocator' to supply memory.
+void generateIdentity(
+    bsl::shared_ptr<ntcd::EncryptionCertificate>*       certificate,
+    bsl::shared_ptr<ntcd::EncryptionKey>*               key,
+    const bsl::string&                                  name,
+    int                                                 serialNumber,
+    const bsl::shared_ptr<ntcd::EncryptionCertificate>& authorityCertificate,
+    const bsl::shared_ptr<ntcd::EncryptionKey>&         authorityKey,
+    bslma::Allocator*                                   allocator)
+{
+    ntsa::Error error;
+
+    ntsa::DistinguishedName identity;
+    identity[ntsa::DistinguishedName::e_COMMON_NAME].addAttribute(name);
+
+    key->createInplace(allocator);
+
+    error = (*key)->generate(ntca::EncryptionKeyOptions());
+    NTCCFG_TEST_OK(error);
+
+    ntca::EncryptionCertificateOptions certificateOptions;
+    certificateOptions.setAuthority(!authorityCertificate);
+    certificateOptions.setSerialNumber(serialNumber);
+    certificateOptions.setStartTime(
+        bdlt::DatetimeTz(bdlt::Datetime(2000, 1, 1), 0));
+    certificateOptions.setExpirationTime(
+        bdlt::DatetimeTz(bdlt::Datetime(2100, 1, 1), 0));
+
+    certificate->createInplace(allocator, allocator);
+
+    if (authorityCertificate) {
+        error = (*certificate)
+                    ->generate(identity,
+                               *key,
+                               authorityCertificate,
+                               authorityKey,
+                               certificateOptions);
+    }
+    else {
+        error = (*certificate)->generate(identity, *key, certificateOptions);
+    }
+
+    NTCCFG_TEST_OK(error);
+}
+
+/// Process the specified upgrade 'event' for the specified 'upgradable'.
+/// Increment the specified 'numComplete' if the upgrade completed
+/// successfully and post to the specified 'semaphore'.
+void processUpgrade(const bsl::shared_ptr<ntci::Upgradable>& upgradable,
+                    const ntca::UpgradeEvent&                event,
+                    bsls::AtomicUint*                        numComplete,
+                    bslmt::Semaphore*                        semaphore)
+{
+    NTCCFG_WARNING_UNUSED(upgradable);
+
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_DEBUG("Processing upgrade event type %s",
+                   ntca::UpgradeEventType::toString(event.type()));
+
+    if (event.type() == ntca::UpgradeEventType::e_COMPLETE) {
+        ++(*numComplete);
+    }
+
+    semaphore->post();
+}
+
+/// Send data of the specified 'size' from the specified 'sender' and
+/// ensure it is received, intact, by the specified 'receiver'. Use the
+/// specified 'allocator' to supply memory.
+void exchange(const bsl::shared_ptr<ntcr::StreamSocket>& sender,
+              const bsl::shared_ptr<ntcr::StreamSocket>& receiver,
+              bsl::size_t                                size,
+              bslma::Allocator*                          allocator)
+{
+    ntsa::Error error;
+
+    bdlbb::Blob data(sender->outgoingBlobBufferFactory().get(), allocator);
+    ntcd::DataUtil::generateData(&data, size);
+
+    error = sender->send(data, ntca::SendOptions());
+    NTCCFG_TEST_OK(error);
+
+    bdlbb::Blob received(receiver->incomingBlobBufferFactory().get(),
+                         allocator);
+
+    ntca::ReceiveOptions receiveOptions;
+    receiveOptions.setSize(size);
+
+    while (true) {
+        ntca::ReceiveContext context;
+        error = receiver->receive(&context, &received, receiveOptions);
+        if (error != ntsa::Error::e_WOULD_BLOCK) {
+            break;
+        }
+
+        bslmt::ThreadUtil::microSleep(1000);
+    }
+
+    NTCCFG_TEST_OK(error);
+
+    NTCCFG_TEST_EQ(bdlbb::BlobUtil::compare(received, data), 0);
+}
+
+void execute(ntsa::Transport::Value                transport,
+             const bsl::shared_ptr<ntci::Reactor>& reactor,
+             bslma::Allocator*                     allocator)
+{
+    // Concern: Upgrading many sockets concurrently with a reactor pool that
+    // dedicates threads to processing handshakes completes each handshake on
+    // those threads, while the reactor continues to drive each socket, and
+    // leaves each socket usable for encrypted communication in both
+    // directions.
+
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_DEBUG("Stream socket threaded handshake test starting");
+
+    const bsl::size_t k_NUM_SOCKET_PAIRS = 8;
+    const bsl::size_t k_MESSAGE_SIZE     = 1024;
+
+    ntsa::Error                     error;
+    bsl::shared_ptr<ntcs::Metrics>  metrics;
+    bsl::shared_ptr<ntci::Resolver> resolver;
+
+    bsl::shared_ptr<test::concern38::HandshakePool> handshakePool;
+    handshakePool.createInplace(allocator, reactor, allocator);
+
+    bsl::shared_ptr<ntcs::DataPool> dataPool;
+    dataPool.createInplace(allocator, allocator);
+
+    bsl::shared_ptr<ntcd::EncryptionCertificate> authorityCertificate;
+    bsl::shared_ptr<ntcd::EncryptionKey>         authorityKey;
+
+    test::concern38::generateIdentity(
+        &authorityCertificate,
+        &authorityKey,
+        "authority",
+        1,
+        bsl::shared_ptr<ntcd::EncryptionCertificate>(),
+        bsl::shared_ptr<ntcd::EncryptionKey>(),
+        allocator);
+
+    bsl::shared_ptr<ntcd::EncryptionCertificate> clientCertificate;
+    bsl::shared_ptr<ntcd::EncryptionKey>         clientKey;
+
+    test::concern38::generateIdentity(&clientCertificate,
+                                      &clientKey,
+                                      "client",
+                                      2,
+                                      authorityCertificate,
+                                      authorityKey,
+                                      allocator);
+
+    bsl::shared_ptr<ntcd::EncryptionCertificate> serverCertificate;
+    bsl::shared_ptr<ntcd::EncryptionKey>         serverKey;
+
+    test::concern38::generateIdentity(&serverCertificate,
+                                      &serverKey,
+                                      "server",
+                                      3,
+                                      authorityCertificate,
+                                      authorityKey,
+                                      allocator);
+
+    ntca::StreamSocketOptions options;
+    options.setTransport(transport);
+
+    bsl::vector<bsl::shared_ptr<ntcr::StreamSocket> > clientStreamSockets(
+        allocator);
+    bsl::vector<bsl::shared_ptr<ntcr::StreamSocket> > serverStreamSockets(
+        allocator);
+
+    bsls::AtomicUint numUpgraded(0);
+    bslmt::Semaphore semaphore;
+
+    for (bsl::size_t i = 0; i < k_NUM_SOCKET_PAIRS; ++i) {
+        bsl::shared_ptr<ntcd::Encryption> clientEncryption;
+        clientEncryption.createInplace(allocator,
+                                       ntca::EncryptionRole::e_CLIENT,
+                                       clientCertificate,
+                                       clientKey,
+                                       dataPool,
+                                       allocator);
+        clientEncryption->authorizePeer("server");
+
+        bsl::shared_ptr<ntcd::Encryption> serverEncryption;
+        serverEncryption.createInplace(allocator,
+                                       ntca::EncryptionRole::e_SERVER,
+                                       serverCertificate,
+                                       serverKey,
+                                       dataPool,
+                                       allocator);
+        serverEncryption->authorizePeer("client");
+
+        bsl::shared_ptr<ntcd::StreamSocket> basicClientSocket;
+        bsl::shared_ptr<ntcd::StreamSocket> basicServerSocket;
+
+        error = ntcd::Simulation::createStreamSocketPair(&basicClientSocket,
+                                                         &basicServerSocket,
+                                                         transport);
+        NTCCFG_TEST_FALSE(error);
+
+        bsl::shared_ptr<ntcr::StreamSocket> clientStreamSocket;
+        clientStreamSocket.createInplace(allocator,
+                                         options,
+                                         resolver,
+                                         reactor,
+                                         handshakePool,
+                                         metrics,
+                                         allocator);
+
+        error = clientStreamSocket->open(transport, basicClientSocket);
+        NTCCFG_TEST_FALSE(error);
+
+        bsl::shared_ptr<ntcr::StreamSocket> serverStreamSocket;
+        serverStreamSocket.createInplace(allocator,
+                                         options,
+                                         resolver,
+                                         reactor,
+                                         handshakePool,
+                                         metrics,
+                                         allocator);
+
+        error = serverStreamSocket->open(transport, basicServerSocket);
+        NTCCFG_TEST_FALSE(error);
+
+        ntci::UpgradeFunction serverUpgradeFunction =
+            NTCCFG_BIND(&test::concern38::processUpgrade,
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2,
+                        &numUpgraded,
+                        &semaphore);
+
+        error = serverStreamSocket->upgrade(serverEncryption,
+                                            ntca::UpgradeOptions(),
+                                            serverUpgradeFunction);
+        NTCCFG_TEST_OK(error);
+
+        ntca::UpgradeOptions clientUpgradeOptions;
+        clientUpgradeOptions.setServerName("server");
+
+        ntci::UpgradeFunction clientUpgradeFunction =
+            NTCCFG_BIND(&test::concern38::processUpgrade,
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2,
+                        &numUpgraded,
+                        &semaphore);
+
+        error = clientStreamSocket->upgrade(clientEncryption,
+                                            clientUpgradeOptions,
+                                            clientUpgradeFunction);
+        NTCCFG_TEST_OK(error);
+
+        clientStreamSockets.push_back(clientStreamSocket);
+        serverStreamSockets.push_back(serverStreamSocket);
+    }
+
+    for (bsl::size_t i = 0; i < 2 * k_NUM_SOCKET_PAIRS; ++i) {
+        semaphore.wait();
+    }
+
+    NTCCFG_TEST_EQ(static_cast<bsl::size_t>(numUpgraded.load()),
+                   2 * k_NUM_SOCKET_PAIRS);
+
+    // Each socket receives cipher text from its peer at least once during
+    // the handshake, and each such step is deferred to the pool.
+
+    NTCCFG_TEST_GE(handshakePool->numHandshakeSteps(),
+                   2 * k_NUM_SOCKET_PAIRS);
+
+    for (bsl::size_t i = 0; i < k_NUM_SOCKET_PAIRS; ++i) {
+        test::concern38::exchange(clientStreamSockets[i],
+                                  serverStreamSockets[i],
+                                  k_MESSAGE_SIZE,
+                                  allocator);
+
+        test::concern38::exchange(serverStreamSockets[i],
+                                  clientStreamSockets[i],
+                                  k_MESSAGE_SIZE,
+                                  allocator);
+    }
+
+    for (bsl::size_t i = 0; i < k_NUM_SOCKET_PAIRS; ++i) {
+        ntci::StreamSocketCloseGuard clientStreamSocketCloseGuard(
+            clientStreamSockets[i]);
+
+        ntci::StreamSocketCloseGuard serverStreamSocketCloseGuard(
+            serverStreamSockets[i]);
+    }
+
+    clientStreamSockets.clear();
+    serverStreamSockets.clear();
+
+    handshakePool->join();
+
+    NTCI_LOG_DEBUG("Stream socket threaded handshake test complete");
+
+    reactor->stop();
+}
+
+}  // close namespace concern38
+
+namespace concern39 {
+
+/// Process the specified upgrade 'event' for the specified 'upgradable' by
+/// incrementing the specified 'numFailed' if the upgrade failed, then
+/// posting to the specified 'semaphore'.
+void processUpgrade(const bsl::shared_ptr<ntci::Upgradable>& upgradable,
+                    const ntca::UpgradeEvent&                event,
+                    bsls::AtomicUint*                        numFailed,
+                    bslmt::Semaphore*                        semaphore)
+{
+    NTCCFG_WARNING_UNUSED(upgradable);
+
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_DEBUG("Processing upgrade event type %s",
+                   ntca::UpgradeEventType::toString(event.type()));
+
+    if (event.type() == ntca::UpgradeEventType::e_ERROR) {
+        ++(*numFailed);
+    }
+
+    semaphore->post();
+}
+
+void execute(ntsa::Transport::Value                transport,
+             const bsl::shared_ptr<ntci::Reactor>& reactor,
+             bslma::Allocator*                     allocator)
+{
+    // Concern: Upgrading sockets that request offloading encryption to the
+    // operating system fails the upgrade when the socket does not support
+    // installing traffic keys, rather than completing the upgrade without
+    // offloading.
+
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_DEBUG("Stream socket offload failure test starting");
+
+    ntsa::Error                     error;
+    bsl::shared_ptr<ntcs::Metrics>  metrics;
+    bsl::shared_ptr<ntci::Resolver> resolver;
+
+    bsl::shared_ptr<ntcs::DataPool> dataPool;
+    dataPool.createInplace(allocator, allocator);
+
+    bsl::shared_ptr<ntcd::EncryptionCertificate> authorityCertificate;
+    bsl::shared_ptr<ntcd::EncryptionKey>         authorityKey;
+
+    test::concern38::generateIdentity(
+        &authorityCertificate,
+        &authorityKey,
+        "authority",
+        1,
+        bsl::shared_ptr<ntcd::EncryptionCertificate>(),
+        bsl::shared_ptr<ntcd::EncryptionKey>(),
+        allocator);
+
+    bsl::shared_ptr<ntcd::EncryptionCertificate> clientCertificate;
+    bsl::shared_ptr<ntcd::EncryptionKey>         clientKey;
+
+    test::concern38::generateIdentity(&clientCertificate,
+                                      &clientKey,
+                                      "client",
+                                      2,
+                                      authorityCertificate,
+                                      authorityKey,
+                                      allocator);
+
+    bsl::shared_ptr<ntcd::EncryptionCertificate> serverCertificate;
+    bsl::shared_ptr<ntcd::EncryptionKey>         serverKey;
+
+    test::concern38::generateIdentity(&serverCertificate,
+                                      &serverKey,
+                                      "server",
+                                      3,
+                                      authorityCertificate,
+                                      authorityKey,
+                                      allocator);
+
+    bsl::shared_ptr<ntcd::Encryption> clientEncryption;
+    clientEncryption.createInplace(allocator,
+                                   ntca::EncryptionRole::e_CLIENT,
+                                   clientCertificate,
+                                   clientKey,
+                                   dataPool,
+                                   allocator);
+    clientEncryption->authorizePeer("server");
+
+    bsl::shared_ptr<ntcd::Encryption> serverEncryption;
+    serverEncryption.createInplace(allocator,
+                                   ntca::EncryptionRole::e_SERVER,
+                                   serverCertificate,
+                                   serverKey,
+                                   dataPool,
+                                   allocator);
+    serverEncryption->authorizePeer("client");
+
+    // The simulated sockets do not support installing traffic keys.
+
+    bsl::shared_ptr<ntcd::StreamSocket> basicClientSocket;
+    bsl::shared_ptr<ntcd::StreamSocket> basicServerSocket;
+
+    error = ntcd::Simulation::createStreamSocketPair(&basicClientSocket,
+                                                     &basicServerSocket,
+                                                     transport);
+    NTCCFG_TEST_FALSE(error);
+
+    ntca::StreamSocketOptions options;
+    options.setTransport(transport);
+
+    bsl::shared_ptr<ntcr::StreamSocket> clientStreamSocket;
+    clientStreamSocket.createInplace(allocator,
+                                     options,
+                                     resolver,
+                                     reactor,
+                                     reactor,
+                                     metrics,
+                                     allocator);
+
+    error = clientStreamSocket->open(transport, basicClientSocket);
+    NTCCFG_TEST_FALSE(error);
+
+    bsl::shared_ptr<ntcr::StreamSocket> serverStreamSocket;
+    serverStreamSocket.createInplace(allocator,
+                                     options,
+                                     resolver,
+                                     reactor,
+                                     reactor,
+                                     metrics,
+                                     allocator);
+
+    error = serverStreamSocket->open(transport, basicServerSocket);
+    NTCCFG_TEST_FALSE(error);
+
+    bsls::AtomicUint numFailed(0);
+    bslmt::Semaphore semaphore;
+
+    ntca::UpgradeOptions serverUpgradeOptions;
+    serverUpgradeOptions.setOffload(true);
+
+    ntci::UpgradeFunction serverUpgradeFunction =
+        NTCCFG_BIND(&test::concern39::processUpgrade,
+                    NTCCFG_BIND_PLACEHOLDER_1,
+                    NTCCFG_BIND_PLACEHOLDER_2,
+                    &numFailed,
+                    &semaphore);
+
+    error = serverStreamSocket->upgrade(serverEncryption,
+                                        serverUpgradeOptions,
+                                        serverUpgradeFunction);
+    NTCCFG_TEST_OK(error);
+
+    ntca::UpgradeOptions clientUpgradeOptions;
+    clientUpgradeOptions.setServerName("server");
+    clientUpgradeOptions.setOffload(true);
+
+    ntci::UpgradeFunction clientUpgradeFunction =
+        NTCCFG_BIND(&test::concern39::processUpgrade,
+                    NTCCFG_BIND_PLACEHOLDER_1,
+                    NTCCFG_BIND_PLACEHOLDER_2,
+                    &numFailed,
+                    &semaphore);
+
+    error = clientStreamSocket->upgrade(clientEncryption,
+                                        clientUpgradeOptions,
+                                        clientUpgradeFunction);
+    NTCCFG_TEST_OK(error);
+
+    semaphore.wait();
+    semaphore.wait();
+
+    NTCCFG_TEST_EQ(numFailed.load(), 2U);
+
+    {
+        ntci::StreamSocketCloseGuard clientStreamSocketCloseGuard(
+            clientStreamSocket);
+
+        ntci::StreamSocketCloseGuard serverStreamSocketCloseGuard(
+            serverStreamSocket);
+    }
+
+    NTCI_LOG_DEBUG("Stream socket offload failure test complete");
+
+    reactor->stop();
+}
+
+}  // close namespace concern39
+
+namespace concern40 {
+
+/// Process the specified send 'event' for the specified 'sender' by
+/// posting to the specified 'semaphore'.
+void processSend(const bsl::shared_ptr<ntci::Sender>& sender,
+                 const ntca::SendEvent&               event,
+                 bslmt::Semaphore*                    semaphore)
+{
+    NTCCFG_WARNING_UNUSED(sender);
+
+    NTCCFG_TEST_EQ(event.type(), ntca::SendEventType::e_COMPLETE);
+
+    semaphore->post();
+}
+
+/// Process the specified receive 'event' of the specified 'data' for the
+/// specified 'receiver' by posting to the specified 'semaphore'.
+void processReceive(const bsl::shared_ptr<ntci::Receiver>& receiver,
+                    const bsl::shared_ptr<bdlbb::Blob>&    data,
+                    const ntca::ReceiveEvent&              event,
+                    bslmt::Semaphore*                      semaphore)
+{
+    NTCCFG_WARNING_UNUSED(receiver);
+    NTCCFG_WARNING_UNUSED(data);
+
+    NTCCFG_TEST_EQ(event.type(), ntca::ReceiveEventType::e_COMPLETE);
+
+    semaphore->post();
+}
+
+/// Send a message of the specified 'size' from the specified 'sender' to
+/// the specified 'receiver' and wait until it has been sent and received.
+/// Use the specified 'callbackAllocator' to supply memory for the
+/// callbacks.
+void roundTrip(const bsl::shared_ptr<ntcr::StreamSocket>& sender,
+               const bsl::shared_ptr<ntcr::StreamSocket>& receiver,
+               const bdlbb::Blob&                         data,
+               bslma::Allocator*                          callbackAllocator)
+{
+    ntsa::Error      error;
+    bslmt::Semaphore sendSemaphore;
+    bslmt::Semaphore receiveSemaphore;
+
+    {
+        ntci::SendCallback sendCallback = sender->createSendCallback(
+            NTCCFG_BIND(&processSend,
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2,
+                        &sendSemaphore),
+            callbackAllocator);
+
+        error = sender->send(data, ntca::SendOptions(), sendCallback);
+        NTCCFG_TEST_OK(error);
+    }
+
+    {
+        ntca::ReceiveOptions receiveOptions;
+        receiveOptions.setSize(data.length());
+
+        ntci::ReceiveCallback receiveCallback =
+            receiver->createReceiveCallback(
+                NTCCFG_BIND(&processReceive,
+                            NTCCFG_BIND_PLACEHOLDER_1,
+                            NTCCFG_BIND_PLACEHOLDER_2,
+                            NTCCFG_BIND_PLACEHOLDER_3,
+                            &receiveSemaphore),
+                callbackAllocator);
+
+        error = receiver->receive(receiveOptions, receiveCallback);
+        NTCCFG_TEST_OK(error);
+    }
+
+    sendSemaphore.wait();
+    receiveSemaphore.wait();
+}
+
+void execute(ntsa::Transport::Value                transport,
+             const bsl::shared_ptr<ntci::Reactor>& reactor,
+             bslma::TestAllocator*                 callbackAllocator,
+             bslma::TestAllocator*                 socketAllocator,
+             bslma::Allocator*                     allocator)
+{
+    // Concern: Measure the allocations made per send/receive round trip
+    // through stream sockets whose operations complete asynchronously.
+
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_DEBUG("Stream socket round trip allocation test starting");
+
+    const bsl::size_t k_MESSAGE_SIZE    = 1024;
+    const bsl::size_t k_NUM_ROUND_TRIPS = 100;
+
+    ntsa::Error                     error;
+    bsl::shared_ptr<ntcs::Metrics>  metrics;
+    bsl::shared_ptr<ntci::Resolver> resolver;
+
+    bsl::shared_ptr<ntcd::StreamSocket> basicClientSocket;
+    bsl::shared_ptr<ntcd::StreamSocket> basicServerSocket;
+
+    error = ntcd::Simulation::createStreamSocketPair(&basicClientSocket,
+                                                     &basicServerSocket,
+                                                     transport);
+    NTCCFG_TEST_FALSE(error);
+
+    ntca::StreamSocketOptions options;
+    options.setTransport(transport);
+
+    bsl::shared_ptr<ntcr::StreamSocket> clientStreamSocket;
+    clientStreamSocket.createInplace(allocator,
+                                     options,
+                                     resolver,
+                                     reactor,
+                                     reactor,
+                                     metrics,
+                                     socketAllocator);
+
+    error = clientStreamSocket->open(transport, basicClientSocket);
+    NTCCFG_TEST_FALSE(error);
+
+    bsl::shared_ptr<ntcr::StreamSocket> serverStreamSocket;
+    serverStreamSocket.createInplace(allocator,
+                                     options,
+                                     resolver,
+                                     reactor,
+                                     reactor,
+                                     metrics,
+                                     socketAllocator);
+
+    error = serverStreamSocket->open(transport, basicServerSocket);
+    NTCCFG_TEST_FALSE(error);
+
+    bdlbb::Blob data(clientStreamSocket->outgoingBlobBufferFactory().get(),
+                     allocator);
+    ntcd::DataUtil::generateData(&data, k_MESSAGE_SIZE);
+
+    // Warm up the queues and pools of each socket before counting.
+
+    test::concern40::roundTrip(clientStreamSocket,
+                               serverStreamSocket,
+                               data,
+                               callbackAllocator);
+
+    const bsls::Types::Int64 numCallbackAllocationsBefore =
+        callbackAllocator->numAllocations();
+
+    const bsls::Types::Int64 numSocketAllocationsBefore =
+        socketAllocator->numAllocations();
+
+    for (bsl::size_t i = 0; i < k_NUM_ROUND_TRIPS; ++i) {
+        test::concern40::roundTrip(clientStreamSocket,
+                                   serverStreamSocket,
+                                   data,
+                                   callbackAllocator);
+    }
+
+    const bsls::Types::Int64 numCallbackAllocations =
+        callbackAllocator->numAllocations() - numCallbackAllocationsBefore;
+
+    const bsls::Types::Int64 numSocketAllocations =
+        socketAllocator->numAllocations() - numSocketAllocationsBefore;
+
+    BSLS_LOG_WARN("Stream socket allocations per round trip: "
+                  "callbacks %.2f, sockets %.2f",
+                  static_cast<double>(numCallbackAllocations) /
+                      k_NUM_ROUND_TRIPS,
+                  static_cast<double>(numSocketAllocations) /
+                      k_NUM_ROUND_TRIPS);
+
+    // Creating each callback allocates its invoker and, if the target of
+    // its function exceeds the small object buffer of a 'bsl::function', a
+    // copy of that target. Deferring the invocation of a callback copied
+    // into the queue of a socket allocates from the socket, not from the
+    // allocator of the callback.
+
+    NTCCFG_TEST_LE(numCallbackAllocations,
+                   static_cast<bsls::Types::Int64>(4 * k_NUM_ROUND_TRIPS));
+
+    {
+        ntci::StreamSocketCloseGuard clientStreamSocketCloseGuard(
+            clientStreamSocket);
+
+        ntci::StreamSocketCloseGuard serverStreamSocketCloseGuard(
+            serverStreamSocket);
+    }
+
+    NTCI_LOG_DEBUG("Stream socket round trip allocation test complete");
+
+    reactor->stop();
+}
+
+}  // close namespace concern40
+}  // close namespace test
+
+NTCCFG_TEST_CASE(38)
+{
+    // Concern: Upgrading many sockets concurrently with a reactor pool that
+    // dedicates threads to processing handshakes completes each handshake on
+    // those threads and leaves each socket usable for encrypted
+    // communication in both directions.
+
+    test::Framework::execute(&test::concern38::execute);
+}
+
+NTCCFG_TEST_CASE(39)
+{
+    // Concern: Upgrading sockets that request offloading encryption to the
+    // operating system fails the upgrade when the socket does not support
+    // installing traffic keys.
+
+    test::Framework::execute(&test::concern39::execute);
+}
+
+NTCCFG_TEST_CASE(40)
+{
+    // Concern: Measure the allocations made per send/receive round trip.
+    //
+    // Plan: Supply the callbacks and the sockets with distinct allocators
+    // that outlive the threads driving the reactor, so that memory released
+    // after each test configuration completes is not released to a
+    // destroyed allocator.
+
+    bslma::TestAllocator callbackAllocator("callback");
+    bslma::TestAllocator socketAllocator("socket");
+
+    test::Framework::execute(NTCCFG_BIND(&test::concern40::execute,
+                                         NTCCFG_BIND_PLACEHOLDER_1,
+                                         NTCCFG_BIND_PLACEHOLDER_2,
+                                         &callbackAllocator,
+                                         &socketAllocator,
+                                         NTCCFG_BIND_PLACEHOLDER_3));
+
+    NTCCFG_TEST_EQ(callbackAllocator.numBlocksInUse(), 0);
+    NTCCFG_TEST_EQ(socketAllocator.numBlocksInUse(), 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
@@ -5999,6 +7307,12 @@ NTCCFG_TEST_DRIVER
 
     NTCCFG_TEST_REGISTER(34);
     NTCCFG_TEST_REGISTER(35);
+
+    NTCCFG_TEST_REGISTER(36);
+    NTCCFG_TEST_REGISTER(37);
+    NTCCFG_TEST_REGISTER(38);
+    NTCCFG_TEST_REGISTER(39);
+    NTCCFG_TEST_REGISTER(40);
 }
 NTCCFG_TEST_DRIVER_END;
 
@@ -6008,6 +7322,38 @@ NTCCFG_TEST_CASE(1)
 {
 }
 
+NTCCFG_TEST_CASE(39)
+{
+    // Concern: Upgrading sockets that request offloading encryption to the
+    // operating system fails the upgrade when the socket does not support
+    // installing traffic keys.
+
+    test::Framework::execute(&test::concern39::execute);
+}
+
+NTCCFG_TEST_CASE(40)
+{
+    // Concern: Measure the allocations made per send/receive round trip.
+    //
+    // Plan: Supply the callbacks and the sockets with distinct allocators
+    // that outlive the threads driving the reactor, so that memory released
+    // after each test configuration completes is not released to a
+    // destroyed allocator.
+
+    bslma::TestAllocator callbackAllocator("callback");
+    bslma::TestAllocator socketAllocator("socket");
+
+    test::Framework::execute(NTCCFG_BIND(&test::concern40::execute,
+                                         NTCCFG_BIND_PLACEHOLDER_1,
+                                         NTCCFG_BIND_PLACEHOLDER_2,
+                                         &callbackAllocator,
+                                         &socketAllocator,
+                                         NTCCFG_BIND_PLACEHOLDER_3));
+
+    NTCCFG_TEST_EQ(callbackAllocator.numBlocksInUse(), 0);
+    NTCCFG_TEST_EQ(socketAllocator.numBlocksInUse(), 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
@@ -34,6 +34,10 @@ const int k_MIN_THREADS   = 0;
 const int k_MAX_THREADS   = 1;
 const int k_MAX_IDLE_TIME = 10;
 
+// The maximum number of functors invoked each time an asynchronous strand is
+// activated before the strand yields its thread to other functors.
+const bsl::uint64_t k_MAX_BATCH_SIZE = 64;
+
 bslmt::QLock       s_threadPoolLock        = BSLMT_QLOCK_INITIALIZER;
 bdlmt::ThreadPool* s_threadPool_p          = 0;
 bslma::Allocator*  s_threadPoolAllocator_p = 0;
@@ -196,130 +200,143 @@ void Async::exit()
 
 void AsyncStrand::invoke()
 {
-    while (true) {
-        bdlb::NullableValue<FunctorQueue> functorQueue(d_allocator_p);
-        {
-            LockGuard lock(&d_functorQueueMutex);
-
-            BSLS_ASSERT(d_pending);
+    bsl::uint64_t numInvoked = 0;
 
-            if (!d_functorQueue.empty()) {
-                functorQueue.makeValue().swap(d_functorQueue);
-            }
-            else {
-                d_pending = false;
-                break;
-            }
+    {
+        ntci::StrandGuard strandGuard(this);
+        LockGuard         lock(&d_consumerMutex);
+
+        InplaceFunctor functor(d_allocator_p);
+        while (numInvoked < k_MAX_BATCH_SIZE && this->pop(&functor)) {
+            functor();
+            functor.reset();
+            ++numInvoked;
         }
+    }
 
-        FunctorQueue::iterator it = functorQueue.value().begin();
-        FunctorQueue::iterator et = functorQueue.value().end();
-
-        {
-            ntci::StrandGuard strandGuard(this);
+    numInvoked += d_numRemoved.swapAcqRel(0);
 
-            while (it != et) {
-                (*it)();
-                ++it;
-            }
-        }
+    if (d_numPending.subtractAcqRel(numInvoked) == 0) {
+        return;
     }
+
+    this->activate();
+}
+
+void AsyncStrand::activate()
+{
+    ntcs::Async::execute(
+        NTCCFG_BIND(&AsyncStrand::invoke, this->getSelf(this)));
+}
+
+bool AsyncStrand::pop(InplaceFunctor* result)
+{
+    return d_functorQueue.pop(result);
 }
 
 AsyncStrand::AsyncStrand(bslma::Allocator* basicAllocator)
 : d_object("ntcs::AsyncStrand")
-, d_functorQueueMutex(NTCCFG_LOCK_INIT)
+, d_consumerMutex()
 , d_functorQueue(basicAllocator)
-, d_pending(false)
+, d_numPending(0)
+, d_numRemoved(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
 
 AsyncStrand::~AsyncStrand()
 {
-    BSLS_ASSERT(d_functorQueue.empty());
+    BSLS_ASSERT(d_functorQueue.isEmpty());
 }
 
 void AsyncStrand::execute(const Functor& function)
 {
-    bool activate = false;
-    {
-        LockGuard lock(&d_functorQueueMutex);
+    const bsl::uint64_t numPending = d_numPending.addAcqRel(1);
 
-        d_functorQueue.push_back(function);
+    d_functorQueue.push(function);
 
-        if (!d_pending) {
-            d_pending = true;
-            activate  = true;
-        }
+    if (numPending == 1) {
+        this->activate();
     }
+}
+
+void AsyncStrand::executeInplace(InplaceFunctor* functor)
+{
+    const bsl::uint64_t numPending = d_numPending.addAcqRel(1);
+
+    d_functorQueue.push(functor);
 
-    if (activate) {
-        ntcs::Async::execute(
-            NTCCFG_BIND(&AsyncStrand::invoke, this->getSelf(this)));
+    if (numPending == 1) {
+        this->activate();
     }
 }
 
 void AsyncStrand::moveAndExecute(FunctorSequence* functorSequence,
                                  const Functor&   functor)
 {
-    bool activate = false;
-    {
-        LockGuard lock(&d_functorQueueMutex);
-
-        d_functorQueue.splice(d_functorQueue.end(), *functorSequence);
-        if (functor) {
-            d_functorQueue.push_back(functor);
-        }
+    const bsl::uint64_t numFunctors = static_cast<bsl::uint64_t>(
+        FunctorQueue::count(*functorSequence, functor));
 
-        if (!d_pending) {
-            d_pending = true;
-            activate  = true;
-        }
+    if (numFunctors == 0) {
+        functorSequence->clear();
+        return;
     }
 
-    if (activate) {
-        ntcs::Async::execute(
-            NTCCFG_BIND(&AsyncStrand::invoke, this->getSelf(this)));
+    const bsl::uint64_t numPending = d_numPending.addAcqRel(numFunctors);
+
+    const bsl::size_t numPushed =
+        d_functorQueue.push(functorSequence, functor);
+    BSLS_ASSERT(numPushed == numFunctors);
+    NTCCFG_WARNING_UNUSED(numPushed);
+
+    if (numPending == numFunctors) {
+        this->activate();
     }
 }
 
 void AsyncStrand::drain()
 {
-    while (true) {
-        bdlb::NullableValue<FunctorQueue> functorQueue(d_allocator_p);
-        {
-            LockGuard lock(&d_functorQueueMutex);
-
-            BSLS_ASSERT(!d_pending);
-
-            if (!d_functorQueue.empty()) {
-                functorQueue.makeValue().swap(d_functorQueue);
-            }
-            else {
-                break;
-            }
-        }
+    bsl::uint64_t numInvoked = 0;
 
-        FunctorQueue::iterator it = functorQueue.value().begin();
-        FunctorQueue::iterator et = functorQueue.value().end();
+    {
+        const bool nested = this->isRunningInCurrentThread();
 
-        {
-            ntci::StrandGuard strandGuard(this);
+        ntci::StrandGuard strandGuard(this);
+        LockGuard         lock(nested ? 0 : &d_consumerMutex);
 
-            while (it != et) {
-                (*it)();
-                ++it;
-            }
+        InplaceFunctor functor(d_allocator_p);
+        while (this->pop(&functor)) {
+            functor();
+            functor.reset();
+            ++numInvoked;
         }
     }
+
+    // Leave the accounting of the drained functors to the pending activation
+    // of this strand, if any, so that the strand is never activated twice.
+
+    d_numRemoved.addAcqRel(numInvoked);
 }
 
 void AsyncStrand::clear()
 {
-    LockGuard lock(&d_functorQueueMutex);
+    bsl::uint64_t numRemoved = 0;
+
+    {
+        InplaceFunctor functor(d_allocator_p);
+
+        // A functor invoked by this strand may clear it while the lock is
+        // held by the activation or drain invoking that functor.
+
+        LockGuard lock(this->isRunningInCurrentThread() ? 0
+                                                        : &d_consumerMutex);
+        while (d_functorQueue.pop(&functor)) {
+            functor.reset();
+            ++numRemoved;
+        }
+    }
 
-    d_functorQueue.clear();
+    d_numRemoved.addAcqRel(numRemoved);
 }
 
 bool AsyncStrand::isRunningInCurrentThread() const
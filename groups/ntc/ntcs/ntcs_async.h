@@ -25,8 +25,12 @@ BSLS_IDENT("$Id: $")
 #include <ntci_timer.h>
 #include <ntci_timercallback.h>
 #include <ntci_timersession.h>
+#include <ntcs_inbox.h>
 #include <ntcscm_version.h>
 #include <ntsa_error.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bsls_atomic.h>
 #include <bsl_functional.h>
 #include <bsl_memory.h>
 
@@ -111,6 +115,12 @@ struct Async {
 /// @internal @brief
 /// Provide a strand implemented using the process-wide asynchronous executor.
 ///
+/// @details
+/// Deferred functions are pushed onto a lock-free, multiple-producer,
+/// single-consumer queue, and each activation of the strand invokes a
+/// bounded number of functions before re-activating the strand, in the same
+/// manner as 'ntcs::Strand'.
+///
 /// @par Thread Safety
 /// This class is thread safe.
 ///
@@ -119,28 +129,41 @@ class AsyncStrand : public ntci::Strand, public ntccfg::Shared<AsyncStrand>
 {
     /// Define a type alias for a queue of callbacks to
     /// execute on this thread.
-    typedef ntci::Executor::FunctorSequence FunctorQueue;
+    typedef ntcs::Inbox FunctorQueue;
 
-    /// Define a type alias for a mutex.
-    typedef ntccfg::Mutex Mutex;
+    /// Define a type alias for a mutex. Note that the consumer lock is held
+    /// for each batch of functors invoked, so it blocks rather than spins.
+    typedef bslmt::Mutex Mutex;
 
     /// Define a type alias for a mutex lock guard.
-    typedef ntccfg::LockGuard LockGuard;
+    typedef bslmt::LockGuard<bslmt::Mutex> LockGuard;
 
-    ntccfg::Object    d_object;
-    mutable Mutex     d_functorQueueMutex;
-    FunctorQueue      d_functorQueue;
-    bool              d_pending;
-    bslma::Allocator* d_allocator_p;
+    ntccfg::Object     d_object;
+    mutable Mutex      d_consumerMutex;
+    FunctorQueue       d_functorQueue;
+    bsls::AtomicUint64 d_numPending;
+    bsls::AtomicUint64 d_numRemoved;
+    bslma::Allocator*  d_allocator_p;
 
   private:
     AsyncStrand(const AsyncStrand&) BSLS_KEYWORD_DELETED;
     AsyncStrand& operator=(const AsyncStrand&) BSLS_KEYWORD_DELETED;
 
   private:
-    /// Invoke the next functor in the queue.
+    /// Invoke the next batch of functors in the queue, then re-activate this
+    /// strand if functors remain pending.
     void invoke();
 
+    /// Defer the invocation of this strand to the process-wide asynchronous
+    /// executor.
+    void activate();
+
+    /// Pop the functor at the front of the queue and load it into the
+    /// specified 'result'. Return true if a functor was popped, and false
+    /// otherwise. The behavior is undefined unless the calling thread holds
+    /// the consumer lock.
+    bool pop(InplaceFunctor* result);
+
   public:
     /// Create a new inactive strand. Optionally specify a 'basicAllocator'
     /// used to supply memory. If 'basicAllocator' is 0, the currently
@@ -164,6 +187,13 @@ class AsyncStrand : public ntci::Strand, public ntccfg::Shared<AsyncStrand>
     void moveAndExecute(FunctorSequence* functorSequence,
                         const Functor&   functor) BSLS_KEYWORD_OVERRIDE;
 
+    /// Defer the callable object stored by the specified 'functor' to
+    /// execute sequentially, and non-concurrently, after all previously
+    /// deferred functions, leaving the 'functor' empty. Note that the
+    /// callable object is moved into the queue of this strand without
+    /// being copied.
+    void executeInplace(InplaceFunctor* functor) BSLS_KEYWORD_OVERRIDE;
+
     /// Execute all pending operations on the calling thread. The behavior
     /// is undefined unless no other thread is processing pending
     /// operations.
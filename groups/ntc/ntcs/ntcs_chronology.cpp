@@ -29,6 +29,7 @@ BSLS_IDENT_RCSID(ntcs_chronology_cpp, "$Id$ $CSID$")
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bslmt_lockguard.h>
+#include <bslmt_threadutil.h>
 #include <bsls_assert.h>
 #include <bsls_log.h>
 #include <bsl_limits.h>
@@ -72,6 +73,38 @@ BSLS_IDENT_RCSID(ntcs_chronology_cpp, "$Id$ $CSID$")
 namespace BloombergLP {
 namespace ntcs {
 
+namespace {
+
+bslmt::ThreadUtil::Key s_key;
+
+/// Provide utilities for process-wide initialization of the state necessary
+/// to identify the chronology shard owned by each thread.
+class Initializer
+{
+  public:
+    /// Create the process-wide state necessary to identify the chronology
+    /// shard owned by each thread.
+    Initializer();
+
+    /// Destroy the process-wide state necessary to identify the chronology
+    /// shard owned by each thread.
+    ~Initializer();
+};
+
+Initializer::Initializer()
+{
+    int rc = bslmt::ThreadUtil::createKey(&s_key, 0);
+    BSLS_ASSERT_OPT(rc == 0);
+}
+
+Initializer::~Initializer()
+{
+}
+
+Initializer s_initializer;
+
+}  // close unnamed namespace
+
 NTCCFG_INLINE_NEVER
 void Chronology::Timer::autoClose(
     const bsl::shared_ptr<ntci::Timer>&        timer,
@@ -242,6 +275,7 @@ Chronology::Timer::Timer(ntcs::Chronology*          chronology,
 , d_period()
 , d_state(e_STATE_WAITING)
 , d_deadlineMapHandle(0)
+, d_deadlineWheelHandle(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -262,6 +296,7 @@ Chronology::Timer::Timer(ntcs::Chronology*                          chronology,
 , d_period()
 , d_state(e_STATE_WAITING)
 , d_deadlineMapHandle(0)
+, d_deadlineWheelHandle(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -310,7 +345,28 @@ ntsa::Error Chronology::Timer::schedule(const bsls::TimeInterval& deadline,
     {
         LockGuard lock(&d_chronology_p->d_mutex);
 
-        if (d_deadlineMapHandle != 0)  //updating already scheduled timer
+        DeadlineWheel* deadlineWheel = d_chronology_p->d_deadlineWheel_p;
+
+        if (deadlineWheel != 0) {
+            if (d_deadlineWheelHandle != 0) {
+                deadlineWheel->update(d_deadlineWheelHandle,
+                                      deadlineInMicroseconds,
+                                      &newFrontFlag);
+            }
+            else {
+                d_deadlineWheelHandle =
+                    deadlineWheel->add(deadlineInMicroseconds,
+                                       DeadlineMapEntry(d_node_p),
+                                       &newFrontFlag);
+
+                d_node_p->d_storage.object().acquireRef();
+            }
+
+            BSLS_ASSERT(d_deadlineWheelHandle->data().d_node_p == d_node_p);
+
+            d_chronology_p->privateUpdateEarliest();
+        }
+        else if (d_deadlineMapHandle != 0)  //updating already scheduled timer
         {
             d_chronology_p->d_deadlineMap.updateR(d_deadlineMapHandle,
                                                   deadlineInMicroseconds,
@@ -334,21 +390,23 @@ ntsa::Error Chronology::Timer::schedule(const bsls::TimeInterval& deadline,
             d_node_p->d_storage.object().acquireRef();
         }
 
-        BSLS_ASSERT(d_deadlineMapHandle != 0);
+        if (deadlineWheel == 0) {
+            BSLS_ASSERT(d_deadlineMapHandle != 0);
 
-        BSLS_ASSERT(d_deadlineMapHandle->data().d_node_p == d_node_p);
+            BSLS_ASSERT(d_deadlineMapHandle->data().d_node_p == d_node_p);
 
-        if (newFrontFlag) {
-            d_chronology_p->d_deadlineMapEarliest = deadlineInMicroseconds;
-        }
+            if (newFrontFlag) {
+                d_chronology_p->d_deadlineMapEarliest = deadlineInMicroseconds;
+            }
 
-        if (d_chronology_p->d_deadlineMap.length() == 1) {
-            d_chronology_p->d_deadlineMapEmpty = false;
+            if (d_chronology_p->d_deadlineMap.length() == 1) {
+                d_chronology_p->d_deadlineMapEmpty = false;
+            }
         }
     }
 
     if (newFrontFlag) {
-        d_chronology_p->d_driver_sp->interruptAll();
+        d_chronology_p->privateInterrupt();
     }
 
     return ntsa::Error();
@@ -415,6 +473,14 @@ ntsa::Error Chronology::Timer::cancel()
                 d_chronology_p->d_deadlineMapEarliest = 0;
             }
 
+            d_node_p->d_storage.object().releaseRef();
+        }
+        else if (d_deadlineWheelHandle != 0) {
+            d_chronology_p->d_deadlineWheel_p->remove(d_deadlineWheelHandle);
+            d_deadlineWheelHandle = 0;
+
+            d_chronology_p->privateUpdateEarliest();
+
             d_node_p->d_storage.object().releaseRef();
         }
     }
@@ -427,7 +493,7 @@ ntsa::Error Chronology::Timer::cancel()
                                 self,
                                 callback));
 
-                d_chronology_p->d_driver_sp->interruptAll();
+                d_chronology_p->privateInterrupt();
             }
             else if (session) {
                 d_chronology_p->defer(
@@ -435,7 +501,7 @@ ntsa::Error Chronology::Timer::cancel()
                                 self,
                                 session));
 
-                d_chronology_p->d_driver_sp->interruptAll();
+                d_chronology_p->privateInterrupt();
             }
         }
 
@@ -509,6 +575,14 @@ ntsa::Error Chronology::Timer::close()
                 d_chronology_p->d_deadlineMapEarliest = 0;
             }
 
+            d_node_p->d_storage.object().releaseRef();
+        }
+        else if (d_deadlineWheelHandle != 0) {
+            d_chronology_p->d_deadlineWheel_p->remove(d_deadlineWheelHandle);
+            d_deadlineWheelHandle = 0;
+
+            d_chronology_p->privateUpdateEarliest();
+
             d_node_p->d_storage.object().releaseRef();
         }
     }
@@ -529,7 +603,7 @@ ntsa::Error Chronology::Timer::close()
                     self,
                     callback));
 
-                d_chronology_p->d_driver_sp->interruptAll();
+                d_chronology_p->privateInterrupt();
             }
             else if (session) {
                 d_chronology_p->defer(NTCCFG_BIND(
@@ -537,7 +611,7 @@ ntsa::Error Chronology::Timer::close()
                     self,
                     session));
 
-                d_chronology_p->d_driver_sp->interruptAll();
+                d_chronology_p->privateInterrupt();
             }
         }
         else {
@@ -547,7 +621,7 @@ ntsa::Error Chronology::Timer::close()
                                 self,
                                 callback));
 
-                d_chronology_p->d_driver_sp->interruptAll();
+                d_chronology_p->privateInterrupt();
             }
             else if (session) {
                 d_chronology_p->defer(
@@ -555,7 +629,7 @@ ntsa::Error Chronology::Timer::close()
                                 self,
                                 session));
 
-                d_chronology_p->d_driver_sp->interruptAll();
+                d_chronology_p->privateInterrupt();
             }
         }
     }
@@ -568,7 +642,7 @@ ntsa::Error Chronology::Timer::close()
                             self,
                             callback));
 
-            d_chronology_p->d_driver_sp->interruptAll();
+            d_chronology_p->privateInterrupt();
         }
         else if (session) {
             d_chronology_p->defer(
@@ -576,7 +650,7 @@ ntsa::Error Chronology::Timer::close()
                             self,
                             session));
 
-            d_chronology_p->d_driver_sp->interruptAll();
+            d_chronology_p->privateInterrupt();
         }
     }
 
@@ -808,6 +882,228 @@ Chronology::TimerNode* Chronology::privateNodeAllocate()
     return node;
 }
 
+void Chronology::privateUpdateEarliest()
+{
+    if (d_deadlineWheel_p != 0) {
+        Microseconds earliest = 0;
+        if (d_deadlineWheel_p->earliest(&earliest)) {
+            d_deadlineMapEarliest = earliest;
+            d_deadlineMapEmpty    = false;
+        }
+        else {
+            d_deadlineMapEmpty    = true;
+            d_deadlineMapEarliest = 0;
+        }
+    }
+    else {
+        DeadlineMap::Pair* front = d_deadlineMap.front();
+        if (front) {
+            d_deadlineMapEarliest = front->key();
+            d_deadlineMapEmpty    = false;
+        }
+        else {
+            d_deadlineMapEmpty    = true;
+            d_deadlineMapEarliest = 0;
+        }
+    }
+}
+
+void Chronology::privateInterrupt()
+{
+    if (d_parent_p != 0 && Chronology::getThreadLocal() == this) {
+        return;
+    }
+
+    d_driver_sp->interruptAll();
+}
+
+void Chronology::privateInterruptDeferred()
+{
+    // A function deferred by a thread that owns no shard is pushed onto the
+    // inbox shared by all waiters, so unblock only one of them.
+
+    if (NTCCFG_UNLIKELY(!d_shards.empty())) {
+        if (this->privateShardOwned() == 0) {
+            d_driver_sp->interruptOne();
+        }
+
+        return;
+    }
+
+    d_driver_sp->interruptAll();
+}
+
+void Chronology::privateDrainInbox()
+{
+    // Invoke only those functions deferred before the inbox is drained, so
+    // that a function that defers another function to the same shard does
+    // not starve the caller.
+
+    bsl::size_t numDue = d_inbox_p->size();
+
+    InplaceFunctor functor(d_allocator_p);
+    while (numDue > 0 && d_inbox_p->pop(&functor)) {
+        functor();
+        functor.reset();
+        --numDue;
+    }
+}
+
+Chronology* Chronology::privateShardOwned() const
+{
+    Chronology* shard = Chronology::getThreadLocal();
+    if (shard != 0 && shard->d_parent_p == this) {
+        return shard;
+    }
+
+    return 0;
+}
+
+Chronology* Chronology::privateShardNext()
+{
+    Chronology* shard = this->privateShardOwned();
+    if (shard != 0) {
+        return shard;
+    }
+
+    const bsl::size_t numShards = d_shards.size();
+
+    if (d_numShardsClaimed.loadRelaxed() != 0) {
+        for (bsl::size_t i = 0; i < numShards; ++i) {
+            const bsl::size_t index = d_shardCursor.addRelaxed(1) % numShards;
+
+            shard = d_shards[index];
+            if (shard->d_shardClaimed.loadRelaxed()) {
+                return shard;
+            }
+        }
+    }
+
+    return d_shards.front();
+}
+
+bool Chronology::privateShardHasAny(bool scheduled, bool deferred) const
+{
+    if (deferred && this->privateHasAnyDeferred()) {
+        return true;
+    }
+
+    Chronology* owned = this->privateShardOwned();
+
+    if (owned != 0 && d_numShardsClaimed.loadRelaxed() == d_shards.size()) {
+        return (scheduled && !owned->d_deadlineMapEmpty) ||
+               (deferred && owned->privateHasAnyDeferred());
+    }
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        const Chronology* shard = d_shards[i];
+        if (shard != owned && shard->d_shardClaimed.loadRelaxed()) {
+            continue;
+        }
+
+        if ((scheduled && !shard->d_deadlineMapEmpty) ||
+            (deferred && shard->privateHasAnyDeferred()))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bdlb::NullableValue<bsls::TimeInterval> Chronology::privateShardEarliest()
+    const
+{
+    if (this->privateHasAnyDeferred()) {
+        return bdlb::NullableValue<bsls::TimeInterval>(bsls::TimeInterval());
+    }
+
+    Chronology* owned = this->privateShardOwned();
+
+    if (owned != 0 && d_numShardsClaimed.loadRelaxed() == d_shards.size()) {
+        return owned->earliest();
+    }
+
+    bdlb::NullableValue<bsls::TimeInterval> result;
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        const Chronology* shard = d_shards[i];
+        if (shard != owned && shard->d_shardClaimed.loadRelaxed()) {
+            continue;
+        }
+
+        bdlb::NullableValue<bsls::TimeInterval> deadline = shard->earliest();
+        if (!deadline.isNull()) {
+            if (result.isNull() || deadline.value() < result.value()) {
+                result = deadline;
+            }
+        }
+    }
+
+    return result;
+}
+
+void Chronology::privateShardAnnounce(bool timers)
+{
+    Chronology* owned = this->privateShardOwned();
+
+    if (owned != 0) {
+        if (timers) {
+            owned->announce();
+        }
+        else {
+            owned->drain();
+        }
+    }
+
+    // Invoke the functions deferred by threads that own no shard, claiming
+    // the shared inbox so that at most one thread consumes it at a time.
+
+    if (!d_inbox_p->isEmpty() && !d_inboxClaimed.testAndSwap(false, true)) {
+        this->privateDrainInbox();
+        d_inboxClaimed.storeRelease(false);
+    }
+
+    if (owned != 0 && d_numShardsClaimed.loadRelaxed() == d_shards.size()) {
+        return;
+    }
+
+    // Announce the shards not owned by any thread, temporarily claiming
+    // each shard so that at most one thread consumes its inbox at a time.
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        Chronology* shard = d_shards[i];
+        if (shard == owned) {
+            continue;
+        }
+
+        if (shard->d_shardClaimed.loadRelaxed()) {
+            continue;
+        }
+
+        if (shard->d_deadlineMapEmpty && !shard->privateHasAnyDeferred()) {
+            continue;
+        }
+
+        if (shard->d_shardClaimed.testAndSwap(false, true)) {
+            continue;
+        }
+
+        {
+            ntcs::ChronologyGuard guard(shard);
+
+            if (timers) {
+                shard->announce();
+            }
+            else {
+                shard->drain();
+            }
+        }
+
+        shard->d_shardClaimed.storeRelease(false);
+    }
+}
+
 bsl::string Chronology::convertToDateTime(Microseconds timeInMicroseconds)
 {
     bsls::TimeInterval timeInterval;
@@ -836,12 +1132,20 @@ Chronology::Chronology(ntcs::Driver* driver, bslma::Allocator* basicAllocator)
 , d_deadlineMapPool(16, d_allocator_p)
 , d_deadlineMapAllocator_p(&d_deadlineMapPool)
 , d_deadlineMap(d_deadlineMapAllocator_p)
+, d_deadlineWheel_p(0)
 , d_deadlineMapEmpty(true)
 , d_deadlineMapEarliest(0)
 , d_functorQueuePool(16, d_allocator_p)
 , d_functorQueueAllocator_p(&d_functorQueuePool)
 , d_functorQueue(d_functorQueueAllocator_p)
 , d_functorQueueEmpty(true)
+, d_inbox_p(0)
+, d_parent_p(0)
+, d_shards(d_allocator_p)
+, d_shardCursor(0)
+, d_numShardsClaimed(0)
+, d_shardClaimed(false)
+, d_inboxClaimed(false)
 {
 }
 
@@ -858,12 +1162,49 @@ Chronology::Chronology(const bsl::shared_ptr<ntcs::Driver>& driver,
 , d_deadlineMapPool(16, d_allocator_p)
 , d_deadlineMapAllocator_p(&d_deadlineMapPool)
 , d_deadlineMap(d_deadlineMapAllocator_p)
+, d_deadlineWheel_p(0)
+, d_deadlineMapEmpty(true)
+, d_deadlineMapEarliest(0)
+, d_functorQueuePool(16, d_allocator_p)
+, d_functorQueueAllocator_p(&d_functorQueuePool)
+, d_functorQueue(d_functorQueueAllocator_p)
+, d_functorQueueEmpty(true)
+, d_inbox_p(0)
+, d_parent_p(0)
+, d_shards(d_allocator_p)
+, d_shardCursor(0)
+, d_numShardsClaimed(0)
+, d_shardClaimed(false)
+, d_inboxClaimed(false)
+{
+}
+
+Chronology::Chronology(Chronology* parent, bslma::Allocator* basicAllocator)
+: d_object("ntcs::Chronology")
+, d_mutex(NTCCFG_LOCK_INIT)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_driver_sp(parent->d_driver_sp)
+, d_nodePool(sizeof(TimerNode), d_allocator_p)
+, d_nodeArray(d_allocator_p)
+, d_nodeFree_p(0)
+, d_nodeCount(0)
+, d_deadlineMapPool(16, d_allocator_p)
+, d_deadlineMapAllocator_p(&d_deadlineMapPool)
+, d_deadlineMap(d_deadlineMapAllocator_p)
+, d_deadlineWheel_p(0)
 , d_deadlineMapEmpty(true)
 , d_deadlineMapEarliest(0)
 , d_functorQueuePool(16, d_allocator_p)
 , d_functorQueueAllocator_p(&d_functorQueuePool)
 , d_functorQueue(d_functorQueueAllocator_p)
 , d_functorQueueEmpty(true)
+, d_inbox_p(new (*d_allocator_p) ntcs::Inbox(d_allocator_p))
+, d_parent_p(parent)
+, d_shards(d_allocator_p)
+, d_shardCursor(0)
+, d_numShardsClaimed(0)
+, d_shardClaimed(false)
+, d_inboxClaimed(false)
 {
 }
 
@@ -871,13 +1212,174 @@ Chronology::~Chronology()
 {
     BSLS_ASSERT(d_functorQueue.empty());
     BSLS_ASSERT(d_deadlineMap.isEmpty());
+    BSLS_ASSERT(d_deadlineWheel_p == 0 || d_deadlineWheel_p->isEmpty());
     BSLS_ASSERT(d_nodeCount == 0);
+
+    if (d_deadlineWheel_p != 0) {
+        d_allocator_p->deleteObject(d_deadlineWheel_p);
+        d_deadlineWheel_p = 0;
+    }
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        d_allocator_p->deleteObject(d_shards[i]);
+    }
+
+    d_shards.clear();
+
+    if (d_inbox_p != 0) {
+        BSLS_ASSERT(d_inbox_p->isEmpty());
+        d_allocator_p->deleteObject(d_inbox_p);
+        d_inbox_p = 0;
+    }
+}
+
+ntsa::Error Chronology::configureTimerWheel(
+    const bsls::TimeInterval& resolution)
+{
+    const Microseconds resolutionInMicroseconds =
+        resolution.totalMicroseconds();
+
+    if (resolutionInMicroseconds <= 0) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    LockGuard lock(&d_mutex);
+
+    if (!d_deadlineMap.isEmpty()) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    if (d_deadlineWheel_p != 0) {
+        if (!d_deadlineWheel_p->isEmpty()) {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+
+        d_allocator_p->deleteObject(d_deadlineWheel_p);
+        d_deadlineWheel_p = 0;
+    }
+
+    d_deadlineWheel_p = new (*d_allocator_p)
+        DeadlineWheel(resolutionInMicroseconds,
+                      this->currentTime().totalMicroseconds(),
+                      d_deadlineMapAllocator_p);
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        ntsa::Error error = d_shards[i]->configureTimerWheel(resolution);
+        if (error) {
+            return error;
+        }
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error Chronology::configureShards(bsl::size_t numShards)
+{
+    if (d_parent_p != 0) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    if (numShards < 2) {
+        numShards = 0;
+    }
+
+    LockGuard lock(&d_mutex);
+
+    if (d_nodeCount != 0 || !d_functorQueue.empty() ||
+        (d_inbox_p != 0 && !d_inbox_p->isEmpty()))
+    {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        const Chronology* shard = d_shards[i];
+        if (shard->d_shardClaimed.load() || shard->numRegistered() != 0 ||
+            shard->privateHasAnyDeferred())
+        {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+    }
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        d_allocator_p->deleteObject(d_shards[i]);
+    }
+
+    d_shards.clear();
+    d_shardCursor      = 0;
+    d_numShardsClaimed = 0;
+
+    if (numShards == 0) {
+        if (d_inbox_p != 0) {
+            d_allocator_p->deleteObject(d_inbox_p);
+            d_inbox_p = 0;
+        }
+
+        return ntsa::Error();
+    }
+
+    if (d_inbox_p == 0) {
+        d_inbox_p = new (*d_allocator_p) ntcs::Inbox(d_allocator_p);
+    }
+
+    d_shards.reserve(numShards);
+
+    for (bsl::size_t i = 0; i < numShards; ++i) {
+        Chronology* shard = new (*d_allocator_p) Chronology(this,
+                                                            d_allocator_p);
+        d_shards.push_back(shard);
+
+        if (d_deadlineWheel_p != 0) {
+            bsls::TimeInterval resolution;
+            resolution.setTotalMicroseconds(d_deadlineWheel_p->resolution());
+
+            ntsa::Error error = shard->configureTimerWheel(resolution);
+            if (error) {
+                return error;
+            }
+        }
+    }
+
+    return ntsa::Error();
+}
+
+Chronology* Chronology::acquireShard()
+{
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        Chronology* shard = d_shards[i];
+        if (!shard->d_shardClaimed.testAndSwap(false, true)) {
+            d_numShardsClaimed.addRelaxed(1);
+            return shard;
+        }
+    }
+
+    return 0;
+}
+
+void Chronology::releaseShard(Chronology* shard)
+{
+    if (shard == 0) {
+        return;
+    }
+
+    BSLS_ASSERT(shard->d_parent_p == this);
+    BSLS_ASSERT(shard->d_shardClaimed.load());
+
+    d_numShardsClaimed.subtractRelaxed(1);
+    shard->d_shardClaimed.storeRelease(false);
 }
 
 void Chronology::clear()
 {
     typedef bsl::vector<TimerNode*> NodeVector;
 
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        d_shards[i]->clear();
+    }
+
+    if (d_inbox_p != 0) {
+        d_inbox_p->clear();
+    }
+
     FunctorQueue functorQueue(d_functorQueueAllocator_p);
     NodeVector   nodes;
 
@@ -900,6 +1402,23 @@ void Chronology::clear()
             d_deadlineMapEmpty    = true;
             d_deadlineMapEarliest = 0;
         }
+
+        if (d_deadlineWheel_p != 0 && !d_deadlineWheel_p->isEmpty()) {
+            bsl::vector<DeadlineWheel::Pair*> pairs;
+            d_deadlineWheel_p->load(&pairs);
+
+            for (bsl::size_t i = 0; i < pairs.size(); ++i) {
+                TimerNode* node = pairs[i]->data().d_node_p;
+                node->d_storage.object().getObject()->d_deadlineWheelHandle =
+                    0;
+                nodes.push_back(node);
+            }
+
+            d_deadlineWheel_p->removeAll();
+
+            d_deadlineMapEmpty    = true;
+            d_deadlineMapEarliest = 0;
+        }
     }
 
     functorQueue.clear();
@@ -912,6 +1431,14 @@ void Chronology::clear()
 
 void Chronology::clearFunctions()
 {
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        d_shards[i]->clearFunctions();
+    }
+
+    if (d_inbox_p != 0) {
+        d_inbox_p->clear();
+    }
+
     FunctorQueue functorQueue(d_functorQueueAllocator_p);
 
     {
@@ -928,6 +1455,10 @@ void Chronology::clearTimers()
 {
     typedef bsl::vector<TimerNode*> NodeVector;
 
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        d_shards[i]->clearTimers();
+    }
+
     NodeVector nodes;
 
     {
@@ -946,6 +1477,23 @@ void Chronology::clearTimers()
             d_deadlineMapEmpty    = true;
             d_deadlineMapEarliest = 0;
         }
+
+        if (d_deadlineWheel_p != 0 && !d_deadlineWheel_p->isEmpty()) {
+            bsl::vector<DeadlineWheel::Pair*> pairs;
+            d_deadlineWheel_p->load(&pairs);
+
+            for (bsl::size_t i = 0; i < pairs.size(); ++i) {
+                TimerNode* node = pairs[i]->data().d_node_p;
+                node->d_storage.object().getObject()->d_deadlineWheelHandle =
+                    0;
+                nodes.push_back(node);
+            }
+
+            d_deadlineWheel_p->removeAll();
+
+            d_deadlineMapEmpty    = true;
+            d_deadlineMapEarliest = 0;
+        }
     }
 
     for (NodeVector::iterator it = nodes.begin(); it != nodes.end(); ++it) {
@@ -963,6 +1511,12 @@ bsl::shared_ptr<ntci::Timer> Chronology::createTimer(
     // and allow the lifetime of a timer to extend the lifetime of the
     // chronology.
 
+    if (NTCCFG_UNLIKELY(!d_shards.empty())) {
+        return this->privateShardNext()->createTimer(options,
+                                                     session,
+                                                     basicAllocator);
+    }
+
     TimerNode* node;
 
     {
@@ -993,6 +1547,12 @@ bsl::shared_ptr<ntci::Timer> Chronology::createTimer(
     const ntci::TimerCallback& callback,
     bslma::Allocator*          basicAllocator)
 {
+    if (NTCCFG_UNLIKELY(!d_shards.empty())) {
+        return this->privateShardNext()->createTimer(options,
+                                                     callback,
+                                                     basicAllocator);
+    }
+
     TimerNode* node;
 
     {
@@ -1030,6 +1590,76 @@ bsl::shared_ptr<ntci::Timer> Chronology::createTimer(
 // ('d_deadlineMap') maintains an order of items (timers) with the same key
 // (deadlines) in a way that item which was added/updated earlier than another
 // is always placed earlier in the list.
+//
+// When deadlines are indexed by 'd_deadlineWheel_p' the timing wheel pops
+// each due timer out of the wheel, so recurring timers are held aside and
+// rescheduled only after all due timers have been popped.
+
+void Chronology::privateAnnounceWheel(DueVector*                timersDue,
+                                      const bsls::TimeInterval& now)
+{
+    const Microseconds nowInMicroseconds = now.totalMicroseconds();
+
+    bdlma::LocalSequentialAllocator<256> recurringAllocator(
+        d_deadlineMapAllocator_p);
+    bsl::vector<DeadlineWheel::Pair*> recurring(&recurringAllocator);
+
+    while (true) {
+        DeadlineWheel::Pair* current =
+            d_deadlineWheel_p->popDue(nowInMicroseconds);
+        if (current == 0) {
+            break;
+        }
+
+        Microseconds timerDeadlineInMicroseconds = current->key();
+
+        DeadlineMapEntry& entry = current->data();
+
+        Timer* timer = entry.d_node_p->d_storage.object().getObject();
+
+        bsls::TimeInterval timerDeadline;
+        timerDeadline.setTotalMicroseconds(timerDeadlineInMicroseconds);
+
+        const bool isRecurring = timer->d_period != bsls::TimeInterval();
+
+        NTCS_CHRONOLOGY_LOG_POP(nowInMicroseconds,
+                                timer,
+                                timerDeadlineInMicroseconds);
+
+        timersDue->push_back(DueEntry(entry.d_node_p,
+                                      timerDeadline,
+                                      timer->d_period,
+                                      timer->d_options.oneShot(),
+                                      isRecurring));
+
+        if (NTCCFG_UNLIKELY(isRecurring)) {
+            recurring.push_back(current);
+            timer->d_node_p->d_storage.object().acquireRef();
+        }
+        else {
+            d_deadlineWheel_p->remove(timer->d_deadlineWheelHandle);
+            timer->d_deadlineWheelHandle = 0;
+        }
+    }
+
+    for (bsl::size_t i = 0; i < recurring.size(); ++i) {
+        DeadlineWheel::Pair* current = recurring[i];
+
+        Timer* timer =
+            current->data().d_node_p->d_storage.object().getObject();
+
+        Microseconds nextDeadlineInMicroseconds =
+            current->key() + timer->d_period.totalMicroseconds();
+
+        if (nextDeadlineInMicroseconds < nowInMicroseconds) {
+            nextDeadlineInMicroseconds = nowInMicroseconds;
+        }
+
+        d_deadlineWheel_p->update(current, nextDeadlineInMicroseconds);
+    }
+
+    this->privateUpdateEarliest();
+}
 
 void Chronology::announce()
 {
@@ -1037,7 +1667,10 @@ void Chronology::announce()
     NTCI_LOG_CONTEXT();
 #endif
 
-    typedef bsl::vector<DueEntry> DueVector;
+    if (NTCCFG_UNLIKELY(!d_shards.empty())) {
+        this->privateShardAnnounce(true);
+        return;
+    }
 
     bsls::TimeInterval now;
 
@@ -1055,7 +1688,13 @@ void Chronology::announce()
             d_functorQueueEmpty = true;
         }
 
-        if (!d_deadlineMap.isEmpty()) {
+        if (d_deadlineWheel_p != 0) {
+            if (!d_deadlineWheel_p->isEmpty()) {
+                now = this->currentTime();
+                this->privateAnnounceWheel(&timersDue, now);
+            }
+        }
+        else if (!d_deadlineMap.isEmpty()) {
             now = this->currentTime();
 
             const Microseconds nowInMicroseconds = now.totalMicroseconds();
@@ -1149,15 +1788,19 @@ void Chronology::announce()
         FunctorQueue::iterator et = functorsDue.value().end();
 
         while (it != et) {
-            Functor& functor = *it;
+            InplaceFunctor& functor = *it;
             functor();
-            functor = Functor();
+            functor.reset();
             ++it;
         }
 
         functorsDue.value().clear();
     }
 
+    if (d_inbox_p != 0 && !d_inbox_p->isEmpty()) {
+        this->privateDrainInbox();
+    }
+
     if (!timersDue.empty()) {
         DueVector::iterator it = timersDue.begin();
         DueVector::iterator et = timersDue.end();
@@ -1183,6 +1826,18 @@ void Chronology::announce()
 
 void Chronology::drain()
 {
+    if (NTCCFG_UNLIKELY(!d_shards.empty())) {
+        this->privateShardAnnounce(false);
+        return;
+    }
+
+    if (d_inbox_p != 0) {
+        if (!d_inbox_p->isEmpty()) {
+            this->privateDrainInbox();
+        }
+        return;
+    }
+
     bdlb::NullableValue<FunctorQueue> functorsDue(d_functorQueueAllocator_p);
 
     {
@@ -1199,16 +1854,40 @@ void Chronology::drain()
         FunctorQueue::iterator et = functorsDue.value().end();
 
         while (it != et) {
-            Functor& functor = *it;
+            InplaceFunctor& functor = *it;
             functor();
-            functor = Functor();
+            functor.reset();
             ++it;
         }
     }
 }
 
+void Chronology::execute(const ntci::Executor::Functor& functor)
+{
+    this->defer(functor);
+    this->privateInterruptDeferred();
+}
+
+void Chronology::moveAndExecute(
+    ntci::Executor::FunctorSequence* functorSequence,
+    const ntci::Executor::Functor&   functor)
+{
+    this->defer(functorSequence, functor);
+    this->privateInterruptDeferred();
+}
+
+void Chronology::executeInplace(ntci::Executor::InplaceFunctor* functor)
+{
+    this->defer(functor);
+    this->privateInterruptDeferred();
+}
+
 void Chronology::closeAll()
 {
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        d_shards[i]->closeAll();
+    }
+
     TimerVector timers;
     {
         LockGuard lock(&d_mutex);
@@ -1251,6 +1930,10 @@ void Chronology::closeAll()
 
 void Chronology::load(TimerVector* result) const
 {
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        d_shards[i]->load(result);
+    }
+
     LockGuard lock(&d_mutex);
 
     DeadlineMap::Pair* rawHandle = d_deadlineMap.front();
@@ -1265,18 +1948,37 @@ void Chronology::load(TimerVector* result) const
 
         d_deadlineMap.skipForward(&rawHandle);
     }
+
+    if (d_deadlineWheel_p != 0) {
+        bsl::vector<DeadlineWheel::Pair*> pairs;
+        d_deadlineWheel_p->load(&pairs);
+
+        for (bsl::size_t i = 0; i < pairs.size(); ++i) {
+            const DeadlineMapEntry& entry = pairs[i]->data();
+
+            TimerRep* timerRep = entry.d_node_p->d_storage.address();
+            Timer*    timer    = timerRep->getObject();
+            timerRep->acquireRef();
+
+            result->push_back(
+                bsl::shared_ptr<Chronology::Timer>(timer, timerRep));
+        }
+    }
 }
 
 bdlb::NullableValue<bsls::TimeInterval> Chronology::timeoutInterval() const
 {
-    if (!d_functorQueueEmpty) {
+    if (d_shards.empty() && this->privateHasAnyDeferred()) {
         return bdlb::NullableValue<bsls::TimeInterval>(bsls::TimeInterval());
     }
 
     bdlb::NullableValue<bsls::TimeInterval> timeout;
     {
         bdlb::NullableValue<bsls::TimeInterval> deadline;
-        if (!d_deadlineMapEmpty) {
+        if (NTCCFG_UNLIKELY(!d_shards.empty())) {
+            deadline = this->privateShardEarliest();
+        }
+        else if (!d_deadlineMapEmpty) {
             this->findEarliest(&deadline);
         }
 
@@ -1296,14 +1998,17 @@ bdlb::NullableValue<bsls::TimeInterval> Chronology::timeoutInterval() const
 
 int Chronology::timeoutInMilliseconds() const
 {
-    if (!d_functorQueueEmpty) {
+    if (d_shards.empty() && this->privateHasAnyDeferred()) {
         return 0;
     }
 
     int timeout = -1;
 
     bdlb::NullableValue<bsls::TimeInterval> deadline;
-    if (!d_deadlineMapEmpty) {
+    if (NTCCFG_UNLIKELY(!d_shards.empty())) {
+        deadline = this->privateShardEarliest();
+    }
+    else if (!d_deadlineMapEmpty) {
         this->findEarliest(&deadline);
     }
 
@@ -1344,6 +2049,11 @@ bsl::size_t Chronology::numRegistered() const
         LockGuard lock(&d_mutex);
         result = d_nodeCount;
     }
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        result += d_shards[i]->numRegistered();
+    }
+
     return result;
 }
 
@@ -1354,6 +2064,11 @@ bool Chronology::hasAnyRegistered() const
         LockGuard lock(&d_mutex);
         result = d_nodeCount > 0;
     }
+
+    for (bsl::size_t i = 0; i < d_shards.size() && !result; ++i) {
+        result = d_shards[i]->hasAnyRegistered();
+    }
+
     return result;
 }
 
@@ -1362,7 +2077,16 @@ bsl::size_t Chronology::numScheduled() const
     bsl::size_t result;
     {
         LockGuard lock(&d_mutex);
-        result = d_deadlineMap.length();
+        if (d_deadlineWheel_p != 0) {
+            result = d_deadlineWheel_p->length();
+        }
+        else {
+            result = d_deadlineMap.length();
+        }
+    }
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        result += d_shards[i]->numScheduled();
     }
 
     return result;
@@ -1376,8 +2100,37 @@ bsl::size_t Chronology::numDeferred() const
         result = d_functorQueue.size();
     }
 
+    if (d_inbox_p != 0) {
+        result += d_inbox_p->size();
+    }
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        result += d_shards[i]->numDeferred();
+    }
+
     return result;
 }
 
+ntcs::Chronology* Chronology::setThreadLocal(ntcs::Chronology* shard)
+{
+    ntcs::Chronology* previous = reinterpret_cast<ntcs::Chronology*>(
+        bslmt::ThreadUtil::getSpecific(s_key));
+
+    int rc = bslmt::ThreadUtil::setSpecific(
+        s_key,
+        const_cast<const void*>(static_cast<void*>(shard)));
+    BSLS_ASSERT_OPT(rc == 0);
+
+    return previous;
+}
+
+ntcs::Chronology* Chronology::getThreadLocal()
+{
+    ntcs::Chronology* current = reinterpret_cast<ntcs::Chronology*>(
+        bslmt::ThreadUtil::getSpecific(s_key));
+
+    return current;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -27,17 +27,22 @@ BSLS_IDENT("$Id: $")
 #include <ntci_timercallback.h>
 #include <ntci_timersession.h>
 #include <ntcs_driver.h>
+#include <ntcs_inbox.h>
 #include <ntcs_skiplist.h>
+#include <ntcs_timerwheel.h>
 #include <ntcscm_version.h>
 #include <bdlb_nullablevalue.h>
 #include <bdlma_concurrentmultipoolallocator.h>
 #include <bdlma_pool.h>
+#include <bslmf_movableref.h>
 #include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
 #include <bsls_atomic.h>
 #include <bsls_spinlock.h>
 #include <bsls_timeinterval.h>
+#include <bsl_algorithm.h>
 #include <bsl_functional.h>
+#include <bsl_list.h>
 #include <bsl_map.h>
 #include <bsl_memory.h>
 #include <bsl_unordered_map.h>
@@ -66,6 +71,13 @@ namespace ntcs {
 /// @internal @brief
 /// Provide a priority queue of functions and timers.
 ///
+/// @details
+/// A chronology may optionally be partitioned into shards, one per thread
+/// driving the chronology, so that each thread announces its own timers and
+/// deferred functions without contending with other threads on a single
+/// lock. A sharded chronology acts as a facade that dispatches each
+/// operation to the shard owned by the calling thread, if any.
+///
 /// @par Thread Safety
 /// This class is thread safe.
 ///
@@ -123,6 +135,9 @@ class Chronology
         NTCCFG_DECLARE_NESTED_BITWISE_MOVABLE_TRAITS(DueEntry);
     };
 
+    /// Define a type alias for a vector of timers that are due.
+    typedef bsl::vector<DueEntry> DueVector;
+
     /// Define a type alias for a signed 64-bit integer type
     /// representing a number of microseconds.
     typedef bsl::int64_t Microseconds;
@@ -131,14 +146,22 @@ class Chronology
     /// timers that should fire at those deadlines.
     typedef ntcs::SkipList<Microseconds, DeadlineMapEntry> DeadlineMap;
 
+    /// Define a type alias for a hierarchical timing wheel of deadlines
+    /// to the timers that should fire at those deadlines, used instead of
+    /// the deadline map when so configured.
+    typedef ntcs::TimerWheel<DeadlineMapEntry> DeadlineWheel;
+
     /// This typedef defines a functor.
     typedef ntci::Executor::Functor Functor;
 
+    /// This typedef defines a functor that is moved rather than copied.
+    typedef ntci::Executor::InplaceFunctor InplaceFunctor;
+
 #if NTCS_CHRONOLOGY_USE_FUNCTOR_QUEUE_VECTOR
     /// This typedef defines a sequence of functors.
-    typedef bsl::vector<Functor> FunctorQueue;
+    typedef bsl::vector<InplaceFunctor> FunctorQueue;
 #else
-    typedef ntci::Executor::FunctorSequence FunctorQueue;
+    typedef bsl::list<InplaceFunctor> FunctorQueue;
     // This typedef defines a sequence of functors.
 #endif
 
@@ -158,6 +181,7 @@ class Chronology
         bsls::TimeInterval                  d_period;
         State                               d_state;
         DeadlineMap::Pair*                  d_deadlineMapHandle;
+        DeadlineWheel::Pair*                d_deadlineWheelHandle;
         bslma::Allocator*                   d_allocator_p;
 
         friend class Chronology;
@@ -425,12 +449,24 @@ class Chronology
     bdlma::ConcurrentMultipoolAllocator d_deadlineMapPool;
     bslma::Allocator*                   d_deadlineMapAllocator_p;
     DeadlineMap                         d_deadlineMap;
+    DeadlineWheel*                      d_deadlineWheel_p;
     bsls::AtomicBool                    d_deadlineMapEmpty;
     bsls::AtomicInt64                   d_deadlineMapEarliest;
     bdlma::ConcurrentMultipoolAllocator d_functorQueuePool;
     bslma::Allocator*                   d_functorQueueAllocator_p;
     FunctorQueue                        d_functorQueue;
     bsls::AtomicBool                    d_functorQueueEmpty;
+    ntcs::Inbox*                        d_inbox_p;
+    Chronology*                         d_parent_p;
+    bsl::vector<Chronology*>            d_shards;
+    bsls::AtomicUint                    d_shardCursor;
+    bsls::AtomicUint                    d_numShardsClaimed;
+    bsls::AtomicBool                    d_shardClaimed;
+
+    // The flag claimed by the thread draining the shared inbox of a sharded
+    // chronology, so that at most one thread consumes it at a time. Distinct
+    // from 'd_shardClaimed', which is only meaningful for a shard.
+    bsls::AtomicBool                    d_inboxClaimed;
 
   private:
     Chronology(const Chronology&) BSLS_KEYWORD_DELETED;
@@ -444,10 +480,80 @@ class Chronology
     /// 'd_mutex' is locked.
     TimerNode* privateNodeAllocate();
 
+    /// Recalculate whether any timers are scheduled and the time the
+    /// earliest timer is due from the deadline index. The behavior is
+    /// undefined unless 'd_mutex' is locked.
+    void privateUpdateEarliest();
+
+    /// Pop each timer from the timing wheel that is due at the specified
+    /// 'now' and append it to the specified 'timersDue', rescheduling each
+    /// recurring timer at its next deadline. The behavior is undefined
+    /// unless 'd_mutex' is locked and the deadlines of timers are indexed
+    /// by a timing wheel.
+    void privateAnnounceWheel(DueVector*                timersDue,
+                              const bsls::TimeInterval& now);
+
+    /// Unblock the waiters of the driver so that they may observe a new
+    /// deferred function or a new earliest timer deadline, unless this
+    /// object is a shard owned by the calling thread, which will observe
+    /// the change before it next blocks.
+    void privateInterrupt();
+
+    /// Unblock the waiters of the driver needed to invoke a function just
+    /// deferred by the calling thread.
+    void privateInterruptDeferred();
+
+    /// Return true if there are any deferred functions in this object,
+    /// ignoring any shards, otherwise return false.
+    bool privateHasAnyDeferred() const;
+
+    /// Invoke each function deferred to the inbox of this object before
+    /// this function is called. The behavior is undefined unless the
+    /// calling thread has claimed this object, either as its shard or, for
+    /// the inbox shared by the shards of a sharded chronology, temporarily
+    /// to announce it.
+    void privateDrainInbox();
+
+    /// Return the shard of this object owned by the calling thread, or 0
+    /// if the calling thread does not own a shard of this object.
+    Chronology* privateShardOwned() const;
+
+    /// Return the shard of this object into which a timer should be created
+    /// by the calling thread: the shard owned by the calling thread, if
+    /// any, otherwise the next claimed shard in round-robin order,
+    /// otherwise the first shard.
+    Chronology* privateShardNext();
+
+    /// Return true if any shard observed by the calling thread has any
+    /// scheduled timers, if the specified 'scheduled' flag is true, or if
+    /// any such shard or the shared inbox has any deferred functions, if
+    /// the specified 'deferred' flag is true, otherwise return false.
+    bool privateShardHasAny(bool scheduled, bool deferred) const;
+
+    /// Return the absolute time the earliest timer scheduled in any shard
+    /// observed by the calling thread is due, if any, or the default time
+    /// interval if any such shard or the shared inbox has any deferred
+    /// functions.
+    bdlb::NullableValue<bsls::TimeInterval> privateShardEarliest() const;
+
+    /// Invoke all deferred functions and, if the specified 'timers' flag
+    /// is true, announce the deadline event of any due timer in the shard
+    /// owned by the calling thread, if any, and in any shard not owned by
+    /// any thread. Invoke the functions in the shared inbox unless another
+    /// thread is concurrently invoking them.
+    void privateShardAnnounce(bool timers);
+
     /// Return the description of the specified 'timeInMicroseconds' from
     /// the Unix epoch in a date/time format.
     static bsl::string convertToDateTime(Microseconds timeInMicroseconds);
 
+    /// Create a new shard of the specified 'parent' chronology whose
+    /// deferred functions are pushed onto a lock-free inbox. Optionally
+    /// specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
+    Chronology(Chronology* parent, bslma::Allocator* basicAllocator);
+
   public:
     /// The time interval that is LLONG_MAX microseconds from the Unix
     /// epoch.
@@ -475,6 +581,48 @@ class Chronology
     /// Destroy this object.
     ~Chronology();
 
+    /// Index the deadlines of timers using a hierarchical timing wheel
+    /// whose ticks have the specified 'resolution' rather than a skip list.
+    /// Timers are announced no earlier than their deadline but up to one
+    /// 'resolution' later, in exchange for constant-time scheduling and
+    /// cancellation regardless of the number of timers scheduled. Return
+    /// the error. Note that the deadline index may only be changed while no
+    /// timers are scheduled.
+    ntsa::Error configureTimerWheel(const bsls::TimeInterval& resolution);
+
+    /// Partition the timers and deferred functions of this chronology into
+    /// the specified 'numShards' independent shards, each intended to be
+    /// owned by a single waiter thread. Each shard maintains its own
+    /// deadline index and a lock-free inbox of deferred functions, so that
+    /// threads do not contend on a single lock to defer functions or create
+    /// and schedule timers. Functions deferred and timers created by a
+    /// thread that owns a shard are pushed onto and pinned to that shard.
+    /// Functions deferred by any other thread are pushed onto a lock-free
+    /// inbox shared by all shards and invoked by the next thread to drive
+    /// this chronology, so such a thread need only unblock one waiter.
+    /// Timers created by any other thread are distributed among the shards
+    /// owned by any thread in round-robin order. Return the error. Note
+    /// that the shards may only be configured before any thread drives
+    /// this chronology, while no timers are registered and no functions
+    /// are deferred, and that sharding is disabled if 'numShards' is less
+    /// than 2.
+    ntsa::Error configureShards(bsl::size_t numShards);
+
+    /// Claim ownership of an unclaimed shard on behalf of the calling
+    /// thread and return it, or return 0 if this chronology is not sharded
+    /// or all shards are already claimed. The returned shard must be
+    /// installed for the calling thread, typically with a
+    /// 'ntcs::ChronologyGuard', while the calling thread drives this
+    /// chronology, and released by 'releaseShard' when the calling thread
+    /// no longer drives this chronology.
+    Chronology* acquireShard();
+
+    /// Relinquish ownership of the specified 'shard' previously returned
+    /// from 'acquireShard'. Any timers scheduled and functions deferred in
+    /// 'shard' remain and are announced by any thread driving this
+    /// chronology until the shard is claimed again.
+    void releaseShard(Chronology* shard);
+
     /// Remove all functions and timers from the chronology.
     void clear();
 
@@ -520,10 +668,35 @@ class Chronology
     void defer(const ntci::Executor::Functor& functor);
 
     /// Atomically push the specified 'functorSequence' immediately followed
-    /// by the specified 'functor', then clear the 'functorSequence'.
+    /// by the specified 'functor', then clear the 'functorSequence'. Note
+    /// that each function in the 'functorSequence' is moved onto the queue
+    /// without being copied.
     void defer(ntci::Executor::FunctorSequence* functorSequence,
                const ntci::Executor::Functor&   functor);
 
+    /// Push the callable object stored by the specified 'functor' on the
+    /// queue, leaving the 'functor' empty. Note that the callable object is
+    /// moved onto the queue without being copied.
+    void defer(ntci::Executor::InplaceFunctor* functor);
+
+    /// Push the specified 'functor' on the queue, then unblock the waiters
+    /// of the driver needed to invoke it: none if the calling thread owns
+    /// a shard, one if this chronology is otherwise sharded, and all of
+    /// them otherwise.
+    void execute(const ntci::Executor::Functor& functor);
+
+    /// Atomically push the specified 'functorSequence' immediately followed
+    /// by the specified 'functor', then clear the 'functorSequence' and
+    /// unblock the waiters of the driver needed to invoke them, as if by
+    /// 'execute'.
+    void moveAndExecute(ntci::Executor::FunctorSequence* functorSequence,
+                        const ntci::Executor::Functor&   functor);
+
+    /// Push the callable object stored by the specified 'functor' on the
+    /// queue, leaving the 'functor' empty, then unblock the waiters of the
+    /// driver needed to invoke it, as if by 'execute'.
+    void executeInplace(ntci::Executor::InplaceFunctor* functor);
+
     /// Load into the specified 'result' all the scheduled timers in the
     /// chronology.
     void load(TimerVector* result) const;
@@ -552,6 +725,10 @@ class Chronology
     /// Return the number of scheduled timers in the chronology.
     bsl::size_t numScheduled() const;
 
+    /// Return true if the deadlines of timers are indexed by a hierarchical
+    /// timing wheel, otherwise return false.
+    bool isTimerWheel() const;
+
     /// Return true if there are any scheduled timers in the chronology,
     /// otherwise return false.
     bool hasAnyScheduled() const;
@@ -567,17 +744,115 @@ class Chronology
     /// in the chronology, otherwise return false.
     bool hasAnyScheduledOrDeferred() const;
 
+    /// Return true if this chronology is partitioned into shards, otherwise
+    /// return false.
+    bool isSharded() const;
+
+    /// Return true if the calling thread owns a shard of this chronology,
+    /// otherwise return false. Note that a function deferred by a thread
+    /// that owns a shard is invoked by that thread before it next blocks,
+    /// so the deferring thread need not unblock any waiter.
+    bool isShardOwner() const;
+
+    /// Return the number of shards into which this chronology is
+    /// partitioned, or 0 if this chronology is not sharded.
+    bsl::size_t numShards() const;
+
     /// Return the current elapsed time since the Unix epoch.
     bsls::TimeInterval currentTime() const;
+
+    /// Set the specified 'shard' as the shard owned by this thread. Return
+    /// the previous shard owned by this thread, if any.
+    static ntcs::Chronology* setThreadLocal(ntcs::Chronology* shard);
+
+    /// Return the shard owned by the current thread, if any.
+    static ntcs::Chronology* getThreadLocal();
 };
 
+/// @internal @brief
+/// Provide a guard to automatically install and uninstall a chronology
+/// shard into thread-local storage.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntcs
+class ChronologyGuard
+{
+    ntcs::Chronology* d_current_p;
+    ntcs::Chronology* d_previous_p;
+
+  private:
+    ChronologyGuard(const ChronologyGuard&) BSLS_KEYWORD_DELETED;
+    ChronologyGuard& operator=(const ChronologyGuard&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new chronology guard that installs the specified 'shard'
+    /// into thread local storage and uninstalls it when this object is
+    /// destroyed.
+    explicit ChronologyGuard(ntcs::Chronology* shard);
+
+    /// Uninstall the underlying shard from thread local storage then
+    /// destroy this object.
+    ~ChronologyGuard();
+};
+
+NTCCFG_INLINE
+bool Chronology::privateHasAnyDeferred() const
+{
+    if (d_inbox_p != 0) {
+        return !d_inbox_p->isEmpty();
+    }
+
+    return !d_functorQueueEmpty;
+}
+
 NTCCFG_INLINE
 void Chronology::defer(const ntci::Executor::Functor& functor)
 {
+    if (NTCCFG_UNLIKELY(!d_shards.empty())) {
+        Chronology* shard = this->privateShardOwned();
+        if (shard != 0) {
+            shard->defer(functor);
+            return;
+        }
+    }
+
+    if (d_inbox_p != 0) {
+        d_inbox_p->push(functor);
+        return;
+    }
+
+    LockGuard lock(&d_mutex);
+
+    bool wasEmpty = d_functorQueue.empty();
+    d_functorQueue.emplace_back(functor);
+
+    if (wasEmpty) {
+        d_functorQueueEmpty = false;
+    }
+}
+
+NTCCFG_INLINE
+void Chronology::defer(ntci::Executor::InplaceFunctor* functor)
+{
+    if (NTCCFG_UNLIKELY(!d_shards.empty())) {
+        Chronology* shard = this->privateShardOwned();
+        if (shard != 0) {
+            shard->defer(functor);
+            return;
+        }
+    }
+
+    if (d_inbox_p != 0) {
+        d_inbox_p->push(functor);
+        return;
+    }
+
     LockGuard lock(&d_mutex);
 
     bool wasEmpty = d_functorQueue.empty();
-    d_functorQueue.push_back(functor);
+    d_functorQueue.emplace_back(bslmf::MovableRefUtil::move(*functor));
 
     if (wasEmpty) {
         d_functorQueueEmpty = false;
@@ -588,33 +863,63 @@ NTCCFG_INLINE
 void Chronology::defer(ntci::Executor::FunctorSequence* functorSequence,
                        const ntci::Executor::Functor&   functor)
 {
+    if (NTCCFG_UNLIKELY(!d_shards.empty())) {
+        Chronology* shard = this->privateShardOwned();
+        if (shard != 0) {
+            shard->defer(functorSequence, functor);
+            return;
+        }
+    }
+
+    if (d_inbox_p != 0) {
+        d_inbox_p->push(functorSequence, functor);
+        return;
+    }
+
     LockGuard lock(&d_mutex);
 
 #if NTCS_CHRONOLOGY_USE_FUNCTOR_QUEUE_VECTOR
 
-    d_functorQueue.insert(d_functorQueue.end(),
-                          functorSequence->begin(),
-                          functorSequence->end());
-    if (functor) {
-        d_functorQueue.push_back(functor);
+    // Grow the queue at most once for the entire sequence, preserving the
+    // geometric growth of the queue when many sequences are deferred.
+
+    const bsl::size_t required =
+        d_functorQueue.size() + functorSequence->size() + 1;
+
+    if (d_functorQueue.capacity() < required) {
+        d_functorQueue.reserve(
+            bsl::max(required, 2 * d_functorQueue.capacity()));
     }
-    d_functorQueueEmpty = d_functorQueue.empty();
 
-#else
+#endif
+
+    // Move each function onto the queue: the function is stored in the
+    // functor along with the allocator that supplied its target, so the
+    // target is transferred rather than copied, regardless of its size.
+
+    for (ntci::Executor::FunctorSequence::iterator it =
+             functorSequence->begin();
+         it != functorSequence->end();
+         ++it)
+    {
+        d_functorQueue.emplace_back(bslmf::MovableRefUtil::move(*it));
+    }
+    functorSequence->clear();
 
-    d_functorQueue.splice(d_functorQueue.end(), *functorSequence);
     if (functor) {
-        d_functorQueue.push_back(functor);
+        d_functorQueue.emplace_back(functor);
     }
     d_functorQueueEmpty = d_functorQueue.empty();
-
-#endif
 }
 
 NTCCFG_INLINE
 bdlb::NullableValue<bsls::TimeInterval> Chronology::earliest() const
 {
-    if (!d_functorQueueEmpty) {
+    if (NTCCFG_UNLIKELY(!d_shards.empty())) {
+        return this->privateShardEarliest();
+    }
+
+    if (this->privateHasAnyDeferred()) {
         return bdlb::NullableValue<bsls::TimeInterval>(bsls::TimeInterval());
     }
 
@@ -629,19 +934,59 @@ bdlb::NullableValue<bsls::TimeInterval> Chronology::earliest() const
 NTCCFG_INLINE
 bool Chronology::hasAnyScheduled() const
 {
+    if (NTCCFG_UNLIKELY(!d_shards.empty())) {
+        return this->privateShardHasAny(true, false);
+    }
+
     return !d_deadlineMapEmpty;
 }
 
+NTCCFG_INLINE
+bool Chronology::isTimerWheel() const
+{
+    return d_deadlineWheel_p != 0;
+}
+
 NTCCFG_INLINE
 bool Chronology::hasAnyDeferred() const
 {
-    return !d_functorQueueEmpty;
+    if (NTCCFG_UNLIKELY(!d_shards.empty())) {
+        return this->privateShardHasAny(false, true);
+    }
+
+    return this->privateHasAnyDeferred();
 }
 
 NTCCFG_INLINE
 bool Chronology::hasAnyScheduledOrDeferred() const
 {
-    return !d_deadlineMapEmpty || !d_functorQueueEmpty;
+    if (NTCCFG_UNLIKELY(!d_shards.empty())) {
+        return this->privateShardHasAny(true, true);
+    }
+
+    return !d_deadlineMapEmpty || this->privateHasAnyDeferred();
+}
+
+NTCCFG_INLINE
+bool Chronology::isSharded() const
+{
+    return !d_shards.empty();
+}
+
+NTCCFG_INLINE
+bool Chronology::isShardOwner() const
+{
+    if (NTCCFG_LIKELY(d_shards.empty())) {
+        return false;
+    }
+
+    return this->privateShardOwned() != 0;
+}
+
+NTCCFG_INLINE
+bsl::size_t Chronology::numShards() const
+{
+    return d_shards.size();
 }
 
 NTCCFG_INLINE
@@ -650,6 +995,24 @@ bsls::TimeInterval Chronology::currentTime() const
     return bdlt::CurrentTime::now();
 }
 
+NTCCFG_INLINE
+ChronologyGuard::ChronologyGuard(ntcs::Chronology* shard)
+: d_current_p(shard)
+, d_previous_p(0)
+{
+    if (d_current_p) {
+        d_previous_p = ntcs::Chronology::setThreadLocal(d_current_p);
+    }
+}
+
+NTCCFG_INLINE
+ChronologyGuard::~ChronologyGuard()
+{
+    if (d_current_p) {
+        ntcs::Chronology::setThreadLocal(d_previous_p);
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 #endif
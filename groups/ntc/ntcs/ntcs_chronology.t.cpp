@@ -21,6 +21,7 @@
 #include <ntcs_driver.h>
 #include <ntcs_strand.h>
 #include <bdlf_bind.h>
+#include <bdlb_random.h>
 #include <bdlf_placeholder.h>
 #include <bdlmt_fixedthreadpool.h>
 #include <bdlt_currenttime.h>
@@ -28,6 +29,8 @@
 #include <bslmt_barrier.h>
 #include <bslmt_threadgroup.h>
 #include <bslmt_threadutil.h>
+#include <bsls_stopwatch.h>
+#include <bsl_cstring.h>
 #include <bsl_queue.h>
 
 using namespace BloombergLP;
@@ -153,6 +156,26 @@ struct TimerCallbackCollector {
     bsl::queue<TimerIdAndEvent>              d_events;
 };
 
+/// This struct counts the deadline events announced by timers.
+struct TimerDeadlineCounter {
+    TimerDeadlineCounter()
+    : d_count(0)
+    {
+    }
+
+    void processTimer(const bsl::shared_ptr<ntci::Timer>& timer,
+                      const ntca::TimerEvent&             event)
+    {
+        NTCCFG_WARNING_UNUSED(timer);
+
+        if (event.type() == ntca::TimerEventType::e_DEADLINE) {
+            ++d_count;
+        }
+    }
+
+    bsls::AtomicInt d_count;
+};
+
 class StrandMock : public ntci::Strand
 {
   public:
@@ -908,6 +931,19 @@ class MtTestSuite
     bsl::vector<bsl::shared_ptr<StrandAndFlag> > d_strands;
 };
 
+/// Describe a value bound to a deferred function whose size exceeds the
+/// small object buffer of a 'bsl::function'.
+struct Payload {
+    char d_data[128];
+};
+
+/// Increment the specified 'counter'. Ignore the specified 'payload'.
+void processPayload(int* counter, const Payload& payload)
+{
+    NTCCFG_WARNING_UNUSED(payload);
+    ++(*counter);
+}
+
 }  // close namespace 'test'
 
 NTCCFG_TEST_CASE(1)
@@ -3157,6 +3193,441 @@ NTCCFG_TEST_CASE(36)
     }
 }
 
+NTCCFG_TEST_CASE(37)
+{
+    // Concern: Scheduling, announcing, and cancelling timers remains correct
+    // and scales with the number of timers scheduled whether deadlines are
+    // indexed by a skip list or by a timing wheel.
+    // Plan: For an increasing number of timers, schedule each timer at a
+    // random deadline, advance the clock and announce the timers that are
+    // due, then close the remaining timers, measuring the duration of each
+    // phase when deadlines are indexed by a skip list and by a timing wheel.
+    // Ensure both indexes announce exactly the timers whose deadlines have
+    // been reached.
+
+    NTCI_LOG_CONTEXT();
+
+    const int k_NUM_TIMERS[] = {1000, 10000, 100000};
+
+    const int k_MAX_DEADLINE_IN_MILLISECONDS = 10000;
+    const int k_ELAPSED_IN_MILLISECONDS      = 5000;
+
+    for (bsl::size_t i = 0; i < sizeof k_NUM_TIMERS / sizeof k_NUM_TIMERS[0];
+         ++i)
+    {
+        const int numTimers = k_NUM_TIMERS[i];
+
+        for (int useTimerWheel = 0; useTimerWheel < 2; ++useTimerWheel) {
+            ntccfg::TestAllocator ta;
+            {
+                test::TestClock clock;
+
+                bsl::shared_ptr<test::MtDriver> driver;
+                driver.createInplace(&ta, &ta);
+
+                ntcs::Chronology& chronology = driver->chronology();
+
+                if (useTimerWheel) {
+                    ntsa::Error error = chronology.configureTimerWheel(
+                        bsls::TimeInterval(0, 1000000));
+                    NTCCFG_TEST_OK(error);
+                }
+
+                NTCCFG_TEST_EQ(chronology.isTimerWheel(),
+                               static_cast<bool>(useTimerWheel));
+
+                test::TimerDeadlineCounter counter;
+
+                ntci::TimerCallback callback(
+                    NTCCFG_BIND(&test::TimerDeadlineCounter::processTimer,
+                                &counter,
+                                NTCCFG_BIND_PLACEHOLDER_1,
+                                NTCCFG_BIND_PLACEHOLDER_2),
+                    &ta);
+
+                ntca::TimerOptions timerOptions;
+                timerOptions.setOneShot(true);
+                timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
+                timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
+
+                bsl::vector<bsl::shared_ptr<ntci::Timer> > timers(&ta);
+                timers.reserve(numTimers);
+
+                for (int j = 0; j < numTimers; ++j) {
+                    timers.push_back(
+                        chronology.createTimer(timerOptions, callback, &ta));
+                }
+
+                const bsls::TimeInterval start = chronology.currentTime();
+
+                int seed       = static_cast<int>(i) + 1;
+                int numExpired = 0;
+
+                bsls::Stopwatch scheduleStopwatch;
+                scheduleStopwatch.start(true);
+
+                for (int j = 0; j < numTimers; ++j) {
+                    const int deadlineInMilliseconds =
+                        1 + (bdlb::Random::generate15(&seed) *
+                             k_MAX_DEADLINE_IN_MILLISECONDS) /
+                                32768;
+
+                    if (deadlineInMilliseconds <= k_ELAPSED_IN_MILLISECONDS) {
+                        ++numExpired;
+                    }
+
+                    bsls::TimeInterval deadline = start;
+                    deadline.addMilliseconds(deadlineInMilliseconds);
+
+                    ntsa::Error error = timers[j]->schedule(deadline);
+                    NTCCFG_TEST_OK(error);
+                }
+
+                scheduleStopwatch.stop();
+
+                NTCCFG_TEST_EQ(chronology.numScheduled(),
+                               static_cast<bsl::size_t>(numTimers));
+
+                bsls::TimeInterval elapsed;
+                elapsed.setTotalMilliseconds(k_ELAPSED_IN_MILLISECONDS);
+
+                clock.advance(elapsed);
+
+                bsls::Stopwatch announceStopwatch;
+                announceStopwatch.start(true);
+
+                chronology.announce();
+                while (chronology.hasAnyDeferred()) {
+                    chronology.announce();
+                }
+
+                announceStopwatch.stop();
+
+                NTCCFG_TEST_EQ(counter.d_count, numExpired);
+                NTCCFG_TEST_EQ(chronology.numScheduled(),
+                               static_cast<bsl::size_t>(numTimers -
+                                                        numExpired));
+
+                bsls::Stopwatch cancelStopwatch;
+                cancelStopwatch.start(true);
+
+                for (int j = 0; j < numTimers; ++j) {
+                    timers[j]->close();
+                }
+
+                cancelStopwatch.stop();
+
+                while (chronology.hasAnyDeferred()) {
+                    chronology.announce();
+                }
+
+                NTCCFG_TEST_EQ(counter.d_count, numExpired);
+                NTCCFG_TEST_EQ(chronology.numScheduled(), 0);
+
+                NTCI_LOG_STREAM_INFO
+                    << "Chronology indexed by "
+                    << (useTimerWheel ? "timing wheel" : "skip list")
+                    << " with " << numTimers << " timers: schedule "
+                    << scheduleStopwatch.accumulatedWallTime() << "s"
+                    << ", announce "
+                    << announceStopwatch.accumulatedWallTime() << "s"
+                    << ", cancel " << cancelStopwatch.accumulatedWallTime()
+                    << "s" << NTCI_LOG_STREAM_END;
+
+                timers.clear();
+                driver.reset();
+            }
+            NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+        }
+    }
+}
+
+NTCCFG_TEST_CASE(38)
+{
+    // Concern: Sharded chronology pins functions and timers to the shard
+    // owned by the calling thread, pushes functions deferred by any other
+    // thread onto an inbox shared by all shards, and announces shards owned
+    // by no thread from any thread.
+
+    test::TestSuite s;
+    {
+        NTCI_LOG_CONTEXT();
+
+        ntsa::Error error = s.chronology->configureShards(2);
+        NTCCFG_TEST_OK(error);
+
+        NTCCFG_TEST_TRUE(s.chronology->isSharded());
+        NTCCFG_TEST_EQ(s.chronology->numShards(), 2);
+        NTCCFG_TEST_FALSE(s.chronology->isShardOwner());
+
+        int                           callCounter = 0;
+        const ntci::Executor::Functor f =
+            NTCCFG_BIND(&test::TestSuite::incrementCallback,
+                        bsl::ref(callCounter));
+
+        NTCI_LOG_DEBUG("Part 1, defer to a shard owned by no thread");
+        {
+            s.chronology->defer(f);
+
+            NTCCFG_TEST_TRUE(s.chronology->hasAnyDeferred());
+            NTCCFG_TEST_EQ(s.chronology->numDeferred(), 1);
+
+            s.chronology->announce();
+
+            NTCCFG_TEST_EQ(callCounter, 1);
+            NTCCFG_TEST_FALSE(s.chronology->hasAnyDeferred());
+        }
+
+        ntcs::Chronology* shard1 = s.chronology->acquireShard();
+        ntcs::Chronology* shard2 = s.chronology->acquireShard();
+
+        NTCCFG_TEST_NE(shard1, static_cast<ntcs::Chronology*>(0));
+        NTCCFG_TEST_NE(shard2, static_cast<ntcs::Chronology*>(0));
+        NTCCFG_TEST_NE(shard1, shard2);
+        NTCCFG_TEST_EQ(s.chronology->acquireShard(),
+                       static_cast<ntcs::Chronology*>(0));
+
+        NTCI_LOG_DEBUG("Part 2, defer from a thread that owns no shard");
+        {
+            NTCCFG_TEST_FALSE(s.chronology->isShardOwner());
+
+            s.chronology->defer(f);
+
+            // The function is not pinned to either owned shard, so any
+            // single waiter may invoke it.
+
+            NTCCFG_TEST_EQ(shard1->numDeferred(), 0);
+            NTCCFG_TEST_EQ(shard2->numDeferred(), 0);
+            NTCCFG_TEST_EQ(s.chronology->numDeferred(), 1);
+            NTCCFG_TEST_TRUE(s.chronology->hasAnyDeferred());
+            NTCCFG_TEST_EQ(s.chronology->timeoutInMilliseconds(), 0);
+
+            s.chronology->announce();
+
+            NTCCFG_TEST_EQ(callCounter, 2);
+            NTCCFG_TEST_FALSE(s.chronology->hasAnyDeferred());
+        }
+
+        s.chronology->releaseShard(shard2);
+
+        NTCI_LOG_DEBUG("Part 3, schedule a timer in the owned shard");
+        {
+            ntcs::ChronologyGuard guard(shard1);
+
+            NTCCFG_TEST_TRUE(s.chronology->isShardOwner());
+
+            ntca::TimerOptions timerOptions =
+                s.createOptionsAllDisabled(test::k_TIMER_ID_0);
+
+            bsl::shared_ptr<ntci::Timer> timer =
+                s.chronology->createTimer(timerOptions,
+                                          s.timerCallback,
+                                          &s.ta);
+
+            // Scheduling the earliest timer in the shard owned by the
+            // calling thread does not interrupt the driver.
+
+            error = timer->schedule(s.chronology->currentTime() +
+                                    s.oneSecond);
+            NTCCFG_TEST_OK(error);
+
+            NTCCFG_TEST_EQ(shard1->numScheduled(), 1);
+            NTCCFG_TEST_EQ(shard2->numScheduled(), 0);
+            NTCCFG_TEST_TRUE(s.chronology->hasAnyScheduled());
+
+            s.chronology->defer(f);
+
+            NTCCFG_TEST_EQ(shard1->numDeferred(), 1);
+            NTCCFG_TEST_EQ(s.chronology->timeoutInMilliseconds(), 0);
+
+            s.chronology->announce();
+
+            NTCCFG_TEST_EQ(callCounter, 3);
+            NTCCFG_TEST_EQ(s.chronology->timeoutInMilliseconds(), 1000);
+        }
+
+        NTCI_LOG_DEBUG("Part 4, observe a shard owned by another thread");
+        {
+            NTCCFG_TEST_FALSE(s.chronology->isShardOwner());
+            NTCCFG_TEST_FALSE(s.chronology->hasAnyScheduled());
+            NTCCFG_TEST_EQ(s.chronology->numScheduled(), 1);
+            NTCCFG_TEST_EQ(s.chronology->numRegistered(), 1);
+
+            s.chronology->releaseShard(shard1);
+
+            NTCCFG_TEST_TRUE(s.chronology->hasAnyScheduled());
+        }
+
+        s.chronology->clearTimers();
+
+        error = s.chronology->configureShards(0);
+        NTCCFG_TEST_OK(error);
+
+        NTCCFG_TEST_FALSE(s.chronology->isSharded());
+    }
+}
+
+NTCCFG_TEST_CASE(39)
+{
+    // Concern: Deferring a sequence of functions, each of whose targets
+    // exceeds the small object buffer of a 'bsl::function', moves each
+    // function onto the queue without allocating memory for each function.
+    //
+    // Plan: Count the allocations made to defer the sequence onto a
+    // chronology that uses the same allocator as the functions. Before
+    // functions were moved onto the queue, each was copied, allocating a
+    // copy of its target.
+
+    const bsl::size_t NUM_FUNCTORS = 1000;
+
+    ntccfg::TestAllocator ta;
+    {
+        bslma::TestAllocator counter("chronology", false, &ta);
+
+        bsl::shared_ptr<test::DriverMock> driver;
+        driver.createInplace(&counter);
+
+        bsl::shared_ptr<ntcs::Chronology> chronology;
+        chronology.createInplace(&counter, driver, &counter);
+
+        int numInvoked = 0;
+
+        test::Payload payload;
+        bsl::memset(&payload, 0, sizeof payload);
+
+        ntci::Executor::FunctorSequence sequence(&counter);
+        for (bsl::size_t i = 0; i < NUM_FUNCTORS; ++i) {
+            sequence.push_back(
+                NTCCFG_BIND(&test::processPayload, &numInvoked, payload));
+        }
+
+        const bsls::Types::Int64 numAllocationsBefore =
+            counter.numAllocations();
+
+        chronology->defer(&sequence, ntci::Executor::Functor());
+
+        const bsls::Types::Int64 numAllocations =
+            counter.numAllocations() - numAllocationsBefore;
+
+        BSLS_LOG_WARN("Chronology allocations to defer %d functions: %d",
+                      (int)(NUM_FUNCTORS),
+                      (int)(numAllocations));
+
+        // At most the growth of the queue, from either the pool of the
+        // chronology or directly from its allocator, is allocated.
+
+        NTCCFG_TEST_LE(numAllocations, 2);
+
+        NTCCFG_TEST_TRUE(sequence.empty());
+        NTCCFG_TEST_EQ(chronology->numDeferred(), NUM_FUNCTORS);
+
+        chronology->drain();
+
+        NTCCFG_TEST_EQ(numInvoked, static_cast<int>(NUM_FUNCTORS));
+
+        chronology->closeAll();
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(40)
+{
+    // Concern: Executing a function on an unsharded chronology unblocks all
+    // waiters, executing a function on a sharded chronology from a thread
+    // that owns no shard unblocks one waiter, and executing a function from
+    // a thread that owns a shard unblocks no waiter.
+
+    test::TestSuite s;
+    {
+        NTCI_LOG_CONTEXT();
+
+        int                           callCounter = 0;
+        const ntci::Executor::Functor f =
+            NTCCFG_BIND(&test::TestSuite::incrementCallback,
+                        bsl::ref(callCounter));
+
+        NTCI_LOG_DEBUG("Part 1, execute on an unsharded chronology");
+        {
+            s.chronology->execute(f);
+            s.driver->validateInterruptAllCalled();
+
+            ntci::Executor::FunctorSequence sequence(&s.ta);
+            sequence.push_back(f);
+
+            s.chronology->moveAndExecute(&sequence, f);
+            s.driver->validateInterruptAllCalled();
+
+            NTCCFG_TEST_TRUE(sequence.empty());
+
+            ntci::Executor::InplaceFunctor inplaceFunctor(f, &s.ta);
+
+            s.chronology->executeInplace(&inplaceFunctor);
+            s.driver->validateInterruptAllCalled();
+
+            s.chronology->announce();
+
+            NTCCFG_TEST_EQ(callCounter, 4);
+        }
+
+        ntsa::Error error = s.chronology->configureShards(2);
+        NTCCFG_TEST_OK(error);
+
+        ntcs::Chronology* shard = s.chronology->acquireShard();
+        NTCCFG_TEST_NE(shard, static_cast<ntcs::Chronology*>(0));
+
+        NTCI_LOG_DEBUG("Part 2, execute from a thread that owns no shard");
+        {
+            s.chronology->execute(f);
+            s.driver->validateInterruptOneCalled();
+
+            ntci::Executor::FunctorSequence sequence(&s.ta);
+            sequence.push_back(f);
+
+            s.chronology->moveAndExecute(&sequence, f);
+            s.driver->validateInterruptOneCalled();
+
+            ntci::Executor::InplaceFunctor inplaceFunctor(f, &s.ta);
+
+            s.chronology->executeInplace(&inplaceFunctor);
+            s.driver->validateInterruptOneCalled();
+
+            s.chronology->announce();
+
+            NTCCFG_TEST_EQ(callCounter, 8);
+        }
+
+        NTCI_LOG_DEBUG("Part 3, execute from a thread that owns a shard");
+        {
+            ntcs::ChronologyGuard guard(shard);
+
+            // The driver mock fails the test if any waiter is unblocked
+            // without being validated.
+
+            s.chronology->execute(f);
+
+            ntci::Executor::FunctorSequence sequence(&s.ta);
+            sequence.push_back(f);
+
+            s.chronology->moveAndExecute(&sequence, f);
+
+            ntci::Executor::InplaceFunctor inplaceFunctor(f, &s.ta);
+
+            s.chronology->executeInplace(&inplaceFunctor);
+
+            NTCCFG_TEST_EQ(shard->numDeferred(), 4);
+
+            s.chronology->announce();
+
+            NTCCFG_TEST_EQ(callCounter, 12);
+        }
+
+        s.chronology->releaseShard(shard);
+
+        error = s.chronology->configureShards(0);
+        NTCCFG_TEST_OK(error);
+    }
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
@@ -3197,5 +3668,9 @@ NTCCFG_TEST_DRIVER
     NTCCFG_TEST_REGISTER(34);
     NTCCFG_TEST_REGISTER(35);
     NTCCFG_TEST_REGISTER(36);
+    NTCCFG_TEST_REGISTER(37);
+    NTCCFG_TEST_REGISTER(38);
+    NTCCFG_TEST_REGISTER(39);
+    NTCCFG_TEST_REGISTER(40);
 }
 NTCCFG_TEST_DRIVER_END;
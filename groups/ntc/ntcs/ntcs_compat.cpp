@@ -172,6 +172,21 @@ void Compat::sanitize(ntca::InterfaceConfig* config)
         }
     }
 
+    if (config->socketMetricsPerThread().isNull()) {
+        bool socketMetricsPerThread;
+        if (ntccfg::Tune::configure(&socketMetricsPerThread,
+                                    "NTC_SOCKET_METRICS_PER_THREAD"))
+        {
+            config->setSocketMetricsPerThread(socketMetricsPerThread);
+            NTCI_LOG_WARN("Accumulating socket metrics per thread '%d'",
+                          (int)(socketMetricsPerThread));
+        }
+        else {
+            config->setSocketMetricsPerThread(
+                NTCCFG_DEFAULT_SOCKET_METRICS_PER_THREAD);
+        }
+    }
+
     if (!config->driverMetricsPerWaiter().isNull() &&
         config->driverMetricsPerWaiter().value())
     {
@@ -332,6 +347,10 @@ void Compat::convert(ntca::StreamSocketOptions*         result,
         result->setZeroCopyThreshold(options.zeroCopyThreshold().value());
     }
 
+    if (!options.zeroCopyReceive().isNull()) {
+        result->setZeroCopyReceive(options.zeroCopyReceive().value());
+    }
+
     result->setLoadBalancingOptions(options.loadBalancingOptions());
 }
 
@@ -462,6 +481,10 @@ void Compat::convert(ntca::ListenerSocketOptions*     result,
         result->setZeroCopyThreshold(options.zeroCopyThreshold().value());
     }
 
+    if (!options.zeroCopyReceive().isNull()) {
+        result->setZeroCopyReceive(options.zeroCopyReceive().value());
+    }
+
     result->setLoadBalancingOptions(options.loadBalancingOptions());
 }
 
@@ -776,6 +799,12 @@ void Compat::convert(ntca::ListenerSocketOptions*       result,
         }
     }
 
+    if (result->zeroCopyReceive().isNull()) {
+        if (!config.zeroCopyReceive().isNull()) {
+            result->setZeroCopyReceive(config.zeroCopyReceive().value());
+        }
+    }
+
     if (result->keepAlive().isNull()) {
         if (!config.keepAlive().isNull()) {
             result->setKeepAlive(config.keepAlive().value());
@@ -960,6 +989,12 @@ void Compat::convert(ntca::StreamSocketOptions*       result,
         }
     }
 
+    if (result->zeroCopyReceive().isNull()) {
+        if (!config.zeroCopyReceive().isNull()) {
+            result->setZeroCopyReceive(config.zeroCopyReceive().value());
+        }
+    }
+
     if (result->keepAlive().isNull()) {
         if (!config.keepAlive().isNull()) {
             result->setKeepAlive(config.keepAlive().value());
@@ -1368,10 +1403,30 @@ ntsa::Error Compat::configure(
         }
     }
 
+    if (!options.udpSegmentationOffload().isNull()) {
+        ntsa::SocketOption option;
+        option.makeUdpSegmentationOffload(
+            options.udpSegmentationOffload().value());
+
+        error = socket->setOption(option);
+        if (error) {
+            BSLS_LOG_DEBUG("Failed to set socket option: "
+                           "UDP segmentation offload: %s",
+                           error.text().c_str());
+            if (error != ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED)) {
+                return error;
+            }
+        }
+    }
+
     // Incoming and outgoing timestamping options are set in the individual
     // ntci::StreamSocket and ntci::DatagramSocket implementations, in order
     // for them to detect when timestamping is unavailable.
 
+    // The UDP receive offload option is set in the individual
+    // ntci::DatagramSocket implementations, since those implementations must
+    // split coalesced datagrams back into individual datagrams.
+
 #if defined(BSLS_PLATFORM_OS_LINUX) && NTCS_COMPAT_CONFIGURE_ZERO_COPY
 
     // In order for the kernel to respect the MSG_ZEROCOPY flag in ::sendmsg
@@ -1423,6 +1478,21 @@ ntsa::Error Compat::configure(
         }
     }
 
+    if (!options.reusePort().isNull()) {
+        ntsa::SocketOption option;
+        option.makeReusePort(options.reusePort().value());
+
+        error = socket->setOption(option);
+        if (error) {
+            BSLS_LOG_DEBUG("Failed to set socket option: "
+                           "reuse port: %s",
+                           error.text().c_str());
+            if (error != ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED)) {
+                return error;
+            }
+        }
+    }
+
     if (!options.sendBufferSize().isNull()) {
         ntsa::SocketOption option;
         option.makeSendBufferSize(options.sendBufferSize().value());
@@ -0,0 +1,148 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_encryptionsessioncache.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntcs_encryptionsessioncache_cpp, "$Id$ $CSID$")
+
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace ntcs {
+
+EncryptionSessionCache::EncryptionSessionCache(
+    bsl::size_t       capacity,
+    bslma::Allocator* basicAllocator)
+: d_mutex()
+, d_entryList(basicAllocator)
+, d_entryMap(basicAllocator)
+, d_capacity(capacity)
+, d_numHits(0)
+, d_numMisses(0)
+, d_numEvictions(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(capacity > 0);
+}
+
+EncryptionSessionCache::~EncryptionSessionCache()
+{
+}
+
+ntsa::Error EncryptionSessionCache::store(const bsl::string&       key,
+                                          const bsl::vector<char>& session)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    EntryMap::iterator it = d_entryMap.find(key);
+    if (it != d_entryMap.end()) {
+        it->second->d_session = session;
+        d_entryList.splice(d_entryList.begin(), d_entryList, it->second);
+        return ntsa::Error();
+    }
+
+    while (d_entryList.size() >= d_capacity) {
+        d_entryMap.erase(d_entryList.back().d_key);
+        d_entryList.pop_back();
+        ++d_numEvictions;
+    }
+
+    d_entryList.push_front(Entry());
+
+    Entry& entry    = d_entryList.front();
+    entry.d_key     = key;
+    entry.d_session = session;
+
+    d_entryMap[key] = d_entryList.begin();
+
+    return ntsa::Error();
+}
+
+ntsa::Error EncryptionSessionCache::load(bsl::vector<char>* result,
+                                         const bsl::string& key)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    EntryMap::iterator it = d_entryMap.find(key);
+    if (it == d_entryMap.end()) {
+        ++d_numMisses;
+        return ntsa::Error(ntsa::Error::e_EOF);
+    }
+
+    d_entryList.splice(d_entryList.begin(), d_entryList, it->second);
+
+    *result = it->second->d_session;
+    ++d_numHits;
+
+    return ntsa::Error();
+}
+
+ntsa::Error EncryptionSessionCache::remove(const bsl::string& key)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    EntryMap::iterator it = d_entryMap.find(key);
+    if (it == d_entryMap.end()) {
+        return ntsa::Error(ntsa::Error::e_EOF);
+    }
+
+    d_entryList.erase(it->second);
+    d_entryMap.erase(it);
+
+    return ntsa::Error();
+}
+
+void EncryptionSessionCache::clear()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    d_entryMap.clear();
+    d_entryList.clear();
+}
+
+bsl::size_t EncryptionSessionCache::size() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_entryList.size();
+}
+
+bsl::size_t EncryptionSessionCache::capacity() const
+{
+    return d_capacity;
+}
+
+bsl::uint64_t EncryptionSessionCache::numHits() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_numHits;
+}
+
+bsl::uint64_t EncryptionSessionCache::numMisses() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_numMisses;
+}
+
+bsl::uint64_t EncryptionSessionCache::numEvictions() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_numEvictions;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,157 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCS_ENCRYPTIONSESSIONCACHE
+#define INCLUDED_NTCS_ENCRYPTIONSESSIONCACHE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_platform.h>
+#include <ntci_encryptionsessioncache.h>
+#include <ntcscm_version.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_mutex.h>
+#include <bsl_cstdint.h>
+#include <bsl_list.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ntcs {
+
+/// @internal @brief
+/// Provide a bounded cache of encryption sessions.
+///
+/// @details
+/// Provide an implementation of the 'ntci::EncryptionSessionCache' protocol
+/// that stores at most a fixed number of sessions. When a session is stored
+/// in a full cache, the least recently stored or loaded session is evicted.
+/// This class counts the number of loads that find a session and the number
+/// that do not, so that the rate at which sessions are resumed may be
+/// measured.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntcs
+class EncryptionSessionCache : public ntci::EncryptionSessionCache
+{
+    /// Describe a session stored in the cache.
+    struct Entry {
+        /// Create a new entry having a default value. Optionally specify a
+        /// 'basicAllocator' used to supply memory. If 'basicAllocator' is
+        /// 0, the currently installed default allocator is used.
+        explicit Entry(bslma::Allocator* basicAllocator = 0)
+        : d_key(basicAllocator)
+        , d_session(basicAllocator)
+        {
+        }
+
+        /// Create a new entry having the same value as the specified
+        /// 'original' object. Optionally specify a 'basicAllocator' used to
+        /// supply memory. If 'basicAllocator' is 0, the currently installed
+        /// default allocator is used.
+        Entry(const Entry& original, bslma::Allocator* basicAllocator = 0)
+        : d_key(original.d_key, basicAllocator)
+        , d_session(original.d_session, basicAllocator)
+        {
+        }
+
+        bsl::string       d_key;
+        bsl::vector<char> d_session;
+
+        /// This type accepts an allocator argument to its constructors and
+        /// may dynamically allocate memory during its operation.
+        BSLMF_NESTED_TRAIT_DECLARATION(Entry, bslma::UsesBslmaAllocator);
+    };
+
+    /// Define a type alias for a list of entries ordered from the most
+    /// recently used to the least recently used.
+    typedef bsl::list<Entry> EntryList;
+
+    /// Define a type alias for a map of keys to the position of their entry
+    /// in the entry list.
+    typedef bsl::unordered_map<bsl::string, EntryList::iterator> EntryMap;
+
+    mutable bslmt::Mutex d_mutex;
+    EntryList            d_entryList;
+    EntryMap             d_entryMap;
+    bsl::size_t          d_capacity;
+    bsl::uint64_t        d_numHits;
+    bsl::uint64_t        d_numMisses;
+    bsl::uint64_t        d_numEvictions;
+    bslma::Allocator*    d_allocator_p;
+
+  private:
+    EncryptionSessionCache(const EncryptionSessionCache&) BSLS_KEYWORD_DELETED;
+    EncryptionSessionCache& operator=(const EncryptionSessionCache&)
+        BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new encryption session cache that stores at most the
+    /// specified 'capacity' number of sessions. Optionally specify a
+    /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0, the
+    /// currently installed default allocator is used. The behavior is
+    /// undefined unless '0 < capacity'.
+    explicit EncryptionSessionCache(bsl::size_t       capacity,
+                                    bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~EncryptionSessionCache() BSLS_KEYWORD_OVERRIDE;
+
+    /// Store the specified encoded 'session' identified by the specified
+    /// 'key', replacing any session previously stored under 'key' and
+    /// evicting the least recently used session if the cache is full.
+    /// Return the error.
+    ntsa::Error store(const bsl::string&       key,
+                      const bsl::vector<char>& session) BSLS_KEYWORD_OVERRIDE;
+
+    /// Load into the specified 'result' the encoded session identified by
+    /// the specified 'key'. Return the error, notably 'ntsa::Error::e_EOF'
+    /// if no session is stored under 'key'.
+    ntsa::Error load(bsl::vector<char>* result,
+                     const bsl::string& key) BSLS_KEYWORD_OVERRIDE;
+
+    /// Remove the session identified by the specified 'key'. Return the
+    /// error, notably 'ntsa::Error::e_EOF' if no session is stored under
+    /// 'key'.
+    ntsa::Error remove(const bsl::string& key) BSLS_KEYWORD_OVERRIDE;
+
+    /// Remove every session stored in the cache.
+    void clear() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the number of sessions stored in the cache.
+    bsl::size_t size() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the maximum number of sessions stored in the cache.
+    bsl::size_t capacity() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the number of loads that found a session.
+    bsl::uint64_t numHits() const;
+
+    /// Return the number of loads that did not find a session.
+    bsl::uint64_t numMisses() const;
+
+    /// Return the number of sessions evicted to store other sessions.
+    bsl::uint64_t numEvictions() const;
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
@@ -0,0 +1,155 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_encryptionsessioncache.h>
+
+#include <ntccfg_test.h>
+
+#include <bsl_cstring.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace test {
+
+// Return an encoded session whose contents are the specified 'text'.
+bsl::vector<char> makeSession(const char* text)
+{
+    return bsl::vector<char>(text, text + bsl::strlen(text));
+}
+
+}  // close namespace test
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Sessions are stored, loaded, replaced, and removed, and each
+    // load is counted as either a hit or a miss.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+
+        ntcs::EncryptionSessionCache cache(4, &ta);
+
+        NTCCFG_TEST_EQ(cache.size(), 0);
+        NTCCFG_TEST_EQ(cache.capacity(), 4);
+
+        bsl::vector<char> session(&ta);
+
+        error = cache.load(&session, "server.example.com@10.0.0.1:443");
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_EOF));
+
+        NTCCFG_TEST_EQ(cache.numHits(), 0);
+        NTCCFG_TEST_EQ(cache.numMisses(), 1);
+
+        error = cache.store("server.example.com@10.0.0.1:443",
+                            test::makeSession("first"));
+        NTCCFG_TEST_OK(error);
+
+        NTCCFG_TEST_EQ(cache.size(), 1);
+
+        error = cache.load(&session, "server.example.com@10.0.0.1:443");
+        NTCCFG_TEST_OK(error);
+        NTCCFG_TEST_TRUE(session == test::makeSession("first"));
+
+        NTCCFG_TEST_EQ(cache.numHits(), 1);
+        NTCCFG_TEST_EQ(cache.numMisses(), 1);
+
+        error = cache.store("server.example.com@10.0.0.1:443",
+                            test::makeSession("second"));
+        NTCCFG_TEST_OK(error);
+
+        NTCCFG_TEST_EQ(cache.size(), 1);
+
+        error = cache.load(&session, "server.example.com@10.0.0.1:443");
+        NTCCFG_TEST_OK(error);
+        NTCCFG_TEST_TRUE(session == test::makeSession("second"));
+
+        error = cache.remove("server.example.com@10.0.0.1:443");
+        NTCCFG_TEST_OK(error);
+
+        error = cache.remove("server.example.com@10.0.0.1:443");
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_EOF));
+
+        NTCCFG_TEST_EQ(cache.size(), 0);
+
+        error = cache.store("a", test::makeSession("a"));
+        NTCCFG_TEST_OK(error);
+
+        error = cache.store("b", test::makeSession("b"));
+        NTCCFG_TEST_OK(error);
+
+        cache.clear();
+
+        NTCCFG_TEST_EQ(cache.size(), 0);
+        NTCCFG_TEST_EQ(cache.numEvictions(), 0);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: Storing a session into a full cache evicts the least recently
+    // used session.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+
+        ntcs::EncryptionSessionCache cache(2, &ta);
+
+        bsl::vector<char> session(&ta);
+
+        error = cache.store("a", test::makeSession("a"));
+        NTCCFG_TEST_OK(error);
+
+        error = cache.store("b", test::makeSession("b"));
+        NTCCFG_TEST_OK(error);
+
+        // Use "a" so that "b" becomes the least recently used session.
+
+        error = cache.load(&session, "a");
+        NTCCFG_TEST_OK(error);
+
+        error = cache.store("c", test::makeSession("c"));
+        NTCCFG_TEST_OK(error);
+
+        NTCCFG_TEST_EQ(cache.size(), 2);
+        NTCCFG_TEST_EQ(cache.numEvictions(), 1);
+
+        error = cache.load(&session, "b");
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_EOF));
+
+        error = cache.load(&session, "a");
+        NTCCFG_TEST_OK(error);
+        NTCCFG_TEST_TRUE(session == test::makeSession("a"));
+
+        error = cache.load(&session, "c");
+        NTCCFG_TEST_OK(error);
+        NTCCFG_TEST_TRUE(session == test::makeSession("c"));
+
+        NTCCFG_TEST_EQ(cache.numHits(), 3);
+        NTCCFG_TEST_EQ(cache.numMisses(), 1);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+}
+NTCCFG_TEST_DRIVER_END;
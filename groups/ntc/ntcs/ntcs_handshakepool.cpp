@@ -0,0 +1,254 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_handshakepool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntcs_handshakepool_cpp, "$Id$ $CSID$")
+
+#include <bdlf_bind.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_threadattributes.h>
+#include <bsls_assert.h>
+#include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace ntcs {
+
+namespace {
+
+// Return the attributes of the threads of a handshake pool having the
+// specified 'objectName'.
+bslmt::ThreadAttributes makeThreadAttributes(
+    const bslstl::StringRef& objectName)
+{
+    bsl::string threadName(objectName);
+    threadName.append("-handshake");
+
+    bslmt::ThreadAttributes result;
+    result.setThreadName(threadName);
+
+    return result;
+}
+
+// Return the number of seconds elapsed from the specified 'startTime' to the
+// specified 'stopTime', both measured by 'bsls::TimeUtil::getTimer()'.
+double elapsed(bsl::int64_t startTime, bsl::int64_t stopTime)
+{
+    bsl::int64_t difference = stopTime - startTime;
+    if (difference < 0) {
+        difference = 0;
+    }
+
+    bsls::TimeInterval duration;
+    duration.setTotalNanoseconds(difference);
+
+    return duration.totalSecondsAsDouble();
+}
+
+}  // close unnamed namespace
+
+const ntci::MetricMetadata HandshakePool::STATISTICS[] = {
+    NTCI_METRIC_METADATA_SUMMARY(queueSize),
+    NTCI_METRIC_METADATA_DISTRIBUTION(queueDelay),
+    NTCI_METRIC_METADATA_DISTRIBUTION(timeProcessing),
+    NTCI_METRIC_METADATA_SUMMARY(rejected)};
+
+void HandshakePool::invoke(const Functor& functor, bsl::int64_t enqueueTime)
+{
+    const bsl::int64_t startTime = bsls::TimeUtil::getTimer();
+
+    functor();
+
+    const bsl::int64_t stopTime = bsls::TimeUtil::getTimer();
+
+    d_queueDelay.update(elapsed(enqueueTime, startTime));
+    d_processingTime.update(elapsed(startTime, stopTime));
+}
+
+HandshakePool::HandshakePool(bsl::size_t              numThreads,
+                             bsl::size_t              maxPending,
+                             const bslstl::StringRef& objectName,
+                             bslma::Allocator*        basicAllocator)
+: d_mutex()
+, d_threadPool(makeThreadAttributes(objectName),
+               static_cast<int>(numThreads),
+               static_cast<int>(maxPending),
+               basicAllocator)
+, d_queueSize()
+, d_queueDelay()
+, d_processingTime()
+, d_numRejected()
+, d_prefix("handshake", basicAllocator)
+, d_objectName(objectName, basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(numThreads > 0);
+    BSLS_ASSERT(maxPending > 0);
+}
+
+HandshakePool::~HandshakePool()
+{
+    this->stop();
+}
+
+ntsa::Error HandshakePool::start()
+{
+    if (d_threadPool.isStarted()) {
+        return ntsa::Error();
+    }
+
+    int rc = d_threadPool.start();
+    if (rc != 0) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    return ntsa::Error();
+}
+
+void HandshakePool::stop()
+{
+    if (d_threadPool.isStarted()) {
+        d_threadPool.stop();
+    }
+}
+
+ntsa::Error HandshakePool::execute(const Functor& functor)
+{
+    const bsl::int64_t enqueueTime = bsls::TimeUtil::getTimer();
+
+    d_queueSize.update(static_cast<double>(d_threadPool.numPendingJobs()));
+
+    int rc = d_threadPool.tryEnqueueJob(
+        bdlf::BindUtil::bind(&HandshakePool::invoke,
+                             this,
+                             functor,
+                             enqueueTime));
+    if (rc != 0) {
+        d_numRejected.update(1);
+        return ntsa::Error(ntsa::Error::e_LIMIT);
+    }
+
+    return ntsa::Error();
+}
+
+void HandshakePool::getStats(bdld::ManagedDatum* result)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    bdld::DatumMutableArrayRef array;
+    bdld::Datum::createUninitializedArray(&array,
+                                          numOrdinals(),
+                                          result->allocator());
+
+    bsl::size_t index = 0;
+
+    d_queueSize.collectSummary(&array, &index);
+
+    d_queueDelay.collectDistribution(&array, &index);
+
+    d_processingTime.collectDistribution(&array, &index);
+
+    d_numRejected.collectSummary(&array, &index);
+
+    *array.length() = numOrdinals();
+
+    result->adopt(bdld::Datum::adoptArray(array));
+}
+
+const char* HandshakePool::getFieldPrefix(int ordinal) const
+{
+    NTCCFG_WARNING_UNUSED(ordinal);
+
+    return d_prefix.c_str();
+}
+
+const char* HandshakePool::getFieldName(int ordinal) const
+{
+    if (ordinal < numOrdinals()) {
+        return HandshakePool::STATISTICS[ordinal].d_name;
+    }
+    else {
+        return 0;
+    }
+}
+
+const char* HandshakePool::getFieldDescription(int ordinal) const
+{
+    NTCCFG_WARNING_UNUSED(ordinal);
+
+    return "";
+}
+
+ntci::Monitorable::StatisticType HandshakePool::getFieldType(
+    int ordinal) const
+{
+    if (ordinal < numOrdinals()) {
+        return HandshakePool::STATISTICS[ordinal].d_type;
+    }
+    else {
+        return ntci::Monitorable::e_AVERAGE;
+    }
+}
+
+int HandshakePool::getFieldTags(int ordinal) const
+{
+    NTCCFG_WARNING_UNUSED(ordinal);
+
+    return ntci::Monitorable::e_ANONYMOUS;
+}
+
+int HandshakePool::getFieldOrdinal(const char* fieldName) const
+{
+    int result = 0;
+
+    for (int ordinal = 0; ordinal < numOrdinals(); ++ordinal) {
+        if (bsl::strcmp(HandshakePool::STATISTICS[ordinal].d_name,
+                        fieldName) == 0)
+        {
+            result = ordinal;
+        }
+    }
+
+    return result;
+}
+
+int HandshakePool::numOrdinals() const
+{
+    return sizeof HandshakePool::STATISTICS /
+           sizeof HandshakePool::STATISTICS[0];
+}
+
+const char* HandshakePool::objectName() const
+{
+    return d_objectName.c_str();
+}
+
+bsl::size_t HandshakePool::numThreads() const
+{
+    return static_cast<bsl::size_t>(d_threadPool.numThreads());
+}
+
+bsl::size_t HandshakePool::numPending() const
+{
+    return static_cast<bsl::size_t>(d_threadPool.numPendingJobs());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
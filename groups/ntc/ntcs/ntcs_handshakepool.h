@@ -0,0 +1,165 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCS_HANDSHAKEPOOL
+#define INCLUDED_NTCS_HANDSHAKEPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_platform.h>
+#include <ntci_metric.h>
+#include <ntci_monitorable.h>
+#include <ntcscm_version.h>
+#include <ntsa_error.h>
+#include <bdlmt_fixedthreadpool.h>
+#include <bslmt_mutex.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace ntcs {
+
+/// @internal @brief
+/// Provide a bounded pool of threads dedicated to processing handshakes.
+///
+/// @details
+/// Provide a fixed number of threads that process the steps of the
+/// handshakes of sockets upgrading to encrypted communication, so that the
+/// computation required by each step, e.g. generating or verifying a
+/// signature, does not delay the processing of other sockets driven by the
+/// same I/O thread. The number of steps pending processing is bounded: a
+/// step that cannot be queued is rejected, and the caller is expected to
+/// process the step itself. This class measures the number of steps pending
+/// when each step is queued, the time each step waits to be processed, and
+/// the time each step takes to process.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntcs
+class HandshakePool : public ntci::Monitorable,
+                      public ntccfg::Shared<HandshakePool>
+{
+  public:
+    /// Define a type alias for a function that processes a step of a
+    /// handshake.
+    typedef NTCCFG_FUNCTION() Functor;
+
+  private:
+    mutable bslmt::Mutex   d_mutex;
+    bdlmt::FixedThreadPool d_threadPool;
+    ntci::Metric           d_queueSize;
+    ntci::MetricHistogram  d_queueDelay;
+    ntci::MetricHistogram  d_processingTime;
+    ntci::Metric           d_numRejected;
+    bsl::string            d_prefix;
+    bsl::string            d_objectName;
+    bslma::Allocator*      d_allocator_p;
+
+    static const struct ntci::MetricMetadata STATISTICS[];
+
+  private:
+    HandshakePool(const HandshakePool&) BSLS_KEYWORD_DELETED;
+    HandshakePool& operator=(const HandshakePool&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Process the specified 'functor' queued at the specified
+    /// 'enqueueTime', measured by 'bsls::TimeUtil::getTimer()'.
+    void invoke(const Functor& functor, bsl::int64_t enqueueTime);
+
+  public:
+    /// Create a new handshake pool of the specified 'numThreads' that
+    /// admits at most the specified 'maxPending' steps pending processing.
+    /// Name the threads and the metrics of this object using the specified
+    /// 'objectName'. Optionally specify a 'basicAllocator' used to supply
+    /// memory. If 'basicAllocator' is 0, the currently installed default
+    /// allocator is used. The behavior is undefined unless
+    /// '0 < numThreads' and '0 < maxPending'.
+    HandshakePool(bsl::size_t              numThreads,
+                  bsl::size_t              maxPending,
+                  const bslstl::StringRef& objectName,
+                  bslma::Allocator*        basicAllocator = 0);
+
+    /// Stop the threads of this pool, after processing each step pending
+    /// processing, then destroy this object.
+    ~HandshakePool() BSLS_KEYWORD_OVERRIDE;
+
+    /// Start the threads of this pool. Return the error.
+    ntsa::Error start();
+
+    /// Stop admitting new steps, process each step pending processing, then
+    /// join the threads of this pool.
+    void stop();
+
+    /// Queue the specified 'functor' for processing by a thread of this
+    /// pool. Return the error, notably 'ntsa::Error::e_LIMIT' if the
+    /// maximum number of steps are already pending processing or this pool
+    /// has been stopped.
+    ntsa::Error execute(const Functor& functor);
+
+    /// Load into the specified 'result' the array of statistics for this
+    /// object.  Note that 'result->theArray().length()' is expected to have
+    /// the same value each time this function returns.
+    void getStats(bdld::ManagedDatum* result) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the prefix corresponding to the field at the specified
+    /// 'ordinal' position, or 0 if no field at the 'ordinal' position
+    /// exists.
+    const char* getFieldPrefix(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the field name corresponding to the field at the specified
+    /// 'ordinal' position, or 0 if no field at the 'ordinal' position
+    /// exists.
+    const char* getFieldName(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the field description corresponding to the field at the
+    /// specified 'ordinal' position, or 0 if no field at the 'ordinal'
+    /// position exists.
+    const char* getFieldDescription(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the type of the statistic at the specified 'ordinal'
+    /// position, or e_AVERAGE if no field at the 'ordinal' position exists
+    /// or the type is unknown.
+    ntci::Monitorable::StatisticType getFieldType(int ordinal) const
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the flags that indicate which indexes to apply to the
+    /// statistics measured by this monitorable object.
+    int getFieldTags(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the ordinal of the specified 'fieldName', or a negative value
+    /// if no field identified by 'fieldName' exists.
+    int getFieldOrdinal(const char* fieldName) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the maximum number of elements in a datum resulting from
+    /// a call to 'getStats()'.
+    int numOrdinals() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the human-readable name of the monitorable object, or 0 or
+    /// the empty string if no such human-readable name has been assigned to
+    /// the monitorable object.
+    const char* objectName() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the number of threads in this pool.
+    bsl::size_t numThreads() const;
+
+    /// Return the number of steps pending processing.
+    bsl::size_t numPending() const;
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
@@ -0,0 +1,155 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_handshakepool.h>
+
+#include <ntccfg_test.h>
+
+#include <bdld_manageddatum.h>
+#include <bdlf_bind.h>
+#include <bslmt_semaphore.h>
+#include <bsls_atomic.h>
+
+using namespace BloombergLP;
+
+namespace test {
+
+// Increment the specified 'counter' then post to the specified 'semaphore'.
+void process(bsls::AtomicUint* counter, bslmt::Semaphore* semaphore)
+{
+    ++(*counter);
+    semaphore->post();
+}
+
+// Post to the specified 'started' semaphore then wait on the specified
+// 'release' semaphore.
+void block(bslmt::Semaphore* started, bslmt::Semaphore* release)
+{
+    started->post();
+    release->wait();
+}
+
+}  // close namespace test
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Each step queued to the pool is processed by a thread of the
+    // pool, and the processing is measured.
+
+    ntccfg::TestAllocator ta;
+    {
+        const bsl::size_t k_NUM_STEPS = 100;
+
+        bsl::shared_ptr<ntcs::HandshakePool> pool;
+        pool.createInplace(&ta, 2, k_NUM_STEPS, "test", &ta);
+
+        NTCCFG_TEST_EQ(pool->numThreads(), 2);
+
+        ntsa::Error error = pool->start();
+        NTCCFG_TEST_OK(error);
+
+        bsls::AtomicUint counter(0);
+        bslmt::Semaphore semaphore;
+
+        for (bsl::size_t i = 0; i < k_NUM_STEPS; ++i) {
+            error = pool->execute(
+                bdlf::BindUtil::bind(&test::process, &counter, &semaphore));
+            NTCCFG_TEST_OK(error);
+        }
+
+        for (bsl::size_t i = 0; i < k_NUM_STEPS; ++i) {
+            semaphore.wait();
+        }
+
+        NTCCFG_TEST_EQ(counter, k_NUM_STEPS);
+
+        pool->stop();
+
+        NTCCFG_TEST_EQ(pool->numPending(), 0);
+
+        bdld::ManagedDatum stats(&ta);
+        pool->getStats(&stats);
+
+        NTCCFG_TEST_TRUE(stats->isArray());
+        NTCCFG_TEST_EQ(stats->theArray().length(), pool->numOrdinals());
+
+        NTCCFG_TEST_NE(pool->getFieldName(0), 0);
+        NTCCFG_TEST_EQ(bsl::string(pool->objectName()), "test");
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: Steps are rejected once the maximum number of steps are
+    // pending processing, and after the pool is stopped.
+
+    ntccfg::TestAllocator ta;
+    {
+        const bsl::size_t k_MAX_PENDING = 4;
+
+        bsl::shared_ptr<ntcs::HandshakePool> pool;
+        pool.createInplace(&ta, 1, k_MAX_PENDING, "test", &ta);
+
+        ntsa::Error error = pool->start();
+        NTCCFG_TEST_OK(error);
+
+        bslmt::Semaphore started;
+        bslmt::Semaphore release;
+
+        error = pool->execute(
+            bdlf::BindUtil::bind(&test::block, &started, &release));
+        NTCCFG_TEST_OK(error);
+
+        started.wait();
+
+        bsls::AtomicUint counter(0);
+        bslmt::Semaphore semaphore;
+
+        for (bsl::size_t i = 0; i < k_MAX_PENDING; ++i) {
+            error = pool->execute(
+                bdlf::BindUtil::bind(&test::process, &counter, &semaphore));
+            NTCCFG_TEST_OK(error);
+        }
+
+        NTCCFG_TEST_EQ(pool->numPending(), k_MAX_PENDING);
+
+        error = pool->execute(
+            bdlf::BindUtil::bind(&test::process, &counter, &semaphore));
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_LIMIT));
+
+        release.post();
+
+        for (bsl::size_t i = 0; i < k_MAX_PENDING; ++i) {
+            semaphore.wait();
+        }
+
+        NTCCFG_TEST_EQ(counter, k_MAX_PENDING);
+
+        pool->stop();
+
+        error = pool->execute(
+            bdlf::BindUtil::bind(&test::process, &counter, &semaphore));
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_LIMIT));
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+}
+NTCCFG_TEST_DRIVER_END;
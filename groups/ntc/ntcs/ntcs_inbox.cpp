@@ -0,0 +1,259 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_inbox.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntcs_inbox_cpp, "$Id$ $CSID$")
+
+#include <bslma_default.h>
+#include <bslmf_movableref.h>
+#include <bslmt_threadutil.h>
+#include <bsls_assert.h>
+
+// The maximum number of times 'clear' retries popping a functor that has been
+// counted but not yet linked into the queue by its producer before yielding
+// its thread. A producer is only unlinked for the few instructions between its
+// exchange of the head of the queue and its store to the link of its
+// predecessor, unless it is pre-empted, in which case yielding lets it run.
+#ifndef NTCS_INBOX_MAX_SPIN_COUNT
+#define NTCS_INBOX_MAX_SPIN_COUNT 128
+#endif
+
+namespace BloombergLP {
+namespace ntcs {
+
+void Inbox::link(Node* node)
+{
+    this->link(node, node);
+}
+
+void Inbox::link(Node* first, Node* last)
+{
+    last->d_next.storeRelaxed(0);
+
+    // Publish the last node as the new head, then link the previous head to
+    // the first node. Between these two steps the chain is unreachable by
+    // the consumer. The release of the link to the first node publishes the
+    // links between the nodes of the chain.
+
+    Node* previous = d_head.swapAcqRel(last);
+    previous->d_next.storeRelease(first);
+}
+
+Inbox::Node* Inbox::create(const Functor& functor)
+{
+    Node* node = new (d_pool.allocate()) Node();
+    new (node->d_functor.buffer()) InplaceFunctor(functor, d_allocator_p);
+
+    return node;
+}
+
+Inbox::Node* Inbox::unlink()
+{
+    Node* tail = d_tail_p;
+    Node* next = tail->d_next.loadAcquire();
+
+    if (tail == &d_stub) {
+        if (next == 0) {
+            return 0;
+        }
+
+        d_tail_p = next;
+        tail     = next;
+        next     = next->d_next.loadAcquire();
+    }
+
+    if (next != 0) {
+        d_tail_p = next;
+        return tail;
+    }
+
+    Node* head = d_head.loadAcquire();
+    if (tail != head) {
+        // A producer has exchanged the head but not yet linked its node.
+
+        return 0;
+    }
+
+    // The tail is the last node: re-insert the stub behind it so the tail
+    // can be unlinked without leaving the queue without a node.
+
+    this->link(&d_stub);
+
+    next = tail->d_next.loadAcquire();
+    if (next != 0) {
+        d_tail_p = next;
+        return tail;
+    }
+
+    return 0;
+}
+
+Inbox::Inbox(bslma::Allocator* basicAllocator)
+: d_head(&d_stub)
+, d_tail_p(&d_stub)
+, d_stub()
+, d_size(0)
+, d_pool(sizeof(Node), basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_stub.d_next.storeRelaxed(0);
+}
+
+Inbox::~Inbox()
+{
+    this->clear();
+}
+
+void Inbox::push(const Functor& functor)
+{
+    Node* node = this->create(functor);
+
+    // Count the functor before it is linked so that the inbox is never
+    // observed as empty while a functor is being pushed.
+
+    d_size.addAcqRel(1);
+
+    this->link(node);
+}
+
+void Inbox::push(InplaceFunctor* functor)
+{
+    BSLS_ASSERT(*functor);
+
+    Node* node = new (d_pool.allocate()) Node();
+    new (node->d_functor.buffer())
+        InplaceFunctor(bslmf::MovableRefUtil::move(*functor), d_allocator_p);
+
+    d_size.addAcqRel(1);
+
+    this->link(node);
+}
+
+bsl::size_t Inbox::push(FunctorSequence* functorSequence,
+                        const Functor&   functor)
+{
+    Node*       first       = 0;
+    Node*       last        = 0;
+    bsl::size_t numFunctors = 0;
+
+    // Build a chain of nodes privately, then publish the entire chain with a
+    // single exchange so that the sequence remains contiguous in the queue.
+
+    for (FunctorSequence::iterator it = functorSequence->begin();
+         it != functorSequence->end();
+         ++it)
+    {
+        if (*it) {
+            Node* node = new (d_pool.allocate()) Node();
+            new (node->d_functor.buffer()) InplaceFunctor(
+                bslmf::MovableRefUtil::move(*it), d_allocator_p);
+
+            if (last != 0) {
+                last->d_next.storeRelaxed(node);
+            }
+            else {
+                first = node;
+            }
+
+            last = node;
+            ++numFunctors;
+        }
+    }
+
+    functorSequence->clear();
+
+    if (functor) {
+        Node* node = this->create(functor);
+
+        if (last != 0) {
+            last->d_next.storeRelaxed(node);
+        }
+        else {
+            first = node;
+        }
+
+        last = node;
+        ++numFunctors;
+    }
+
+    if (numFunctors == 0) {
+        return 0;
+    }
+
+    d_size.addAcqRel(numFunctors);
+
+    this->link(first, last);
+
+    return numFunctors;
+}
+
+bool Inbox::pop(InplaceFunctor* result)
+{
+    Node* node = this->unlink();
+    if (node == 0) {
+        return false;
+    }
+
+    BSLS_ASSERT(node != &d_stub);
+
+    *result = bslmf::MovableRefUtil::move(node->d_functor.object());
+
+    node->d_functor.object().~InplaceFunctor();
+    node->~Node();
+    d_pool.deallocate(node);
+
+    d_size.subtractAcqRel(1);
+
+    return true;
+}
+
+bsl::size_t Inbox::count(const FunctorSequence& functorSequence,
+                         const Functor&         functor)
+{
+    bsl::size_t numFunctors = functor ? 1 : 0;
+
+    for (FunctorSequence::const_iterator it = functorSequence.begin();
+         it != functorSequence.end();
+         ++it)
+    {
+        if (*it) {
+            ++numFunctors;
+        }
+    }
+
+    return numFunctors;
+}
+
+void Inbox::clear()
+{
+    InplaceFunctor functor(d_allocator_p);
+
+    bsl::size_t attempt = 0;
+    while (!this->isEmpty()) {
+        if (this->pop(&functor)) {
+            functor.reset();
+            attempt = 0;
+        }
+        else if (++attempt >= NTCS_INBOX_MAX_SPIN_COUNT) {
+            bslmt::ThreadUtil::yield();
+            attempt = 0;
+        }
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
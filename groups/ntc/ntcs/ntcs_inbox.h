@@ -0,0 +1,177 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCS_INBOX
+#define INCLUDED_NTCS_INBOX
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_platform.h>
+#include <ntci_executor.h>
+#include <ntcscm_version.h>
+#include <bdlma_concurrentpool.h>
+#include <bslma_allocator.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_objectbuffer.h>
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace ntcs {
+
+/// @internal @brief
+/// Provide a lock-free, multiple-producer, single-consumer queue of functors.
+///
+/// @details
+/// This class implements an intrusive, unbounded queue of functors that
+/// any number of threads may push onto concurrently without acquiring a
+/// lock, while a single thread pops functors off of the queue. Pushing a
+/// functor performs a single atomic exchange regardless of the number of
+/// producers, so that producers do not serialize on a mutex or repeatedly
+/// contend to update the same cache line with a compare-and-swap. The
+/// design follows the well-known non-blocking queue attributed to Dmitry
+/// Vyukov: a producer that has exchanged the head but not yet linked its
+/// node to its predecessor causes the consumer to observe the queue as
+/// momentarily non-empty but unable to pop, which the consumer must
+/// tolerate by trying again later. A sequence of functors is linked into its
+/// own chain of nodes before that chain is published by the same single
+/// exchange, so the functors of a sequence are never interleaved with
+/// functors pushed concurrently by other threads.
+///
+/// @par Thread Safety
+/// This class is thread safe for any number of threads calling 'push'
+/// concurrently with at most one thread calling 'pop' or 'clear'.
+///
+/// @ingroup module_ntcs
+class Inbox
+{
+  public:
+    /// Define a type alias for a deferred function.
+    typedef ntci::Executor::Functor Functor;
+
+    /// Define a type alias for a sequence of deferred functions.
+    typedef ntci::Executor::FunctorSequence FunctorSequence;
+
+    /// Define a type alias for a deferred function that is moved rather
+    /// than copied.
+    typedef ntci::Executor::InplaceFunctor InplaceFunctor;
+
+  private:
+    /// This struct describes a node in the queue.
+    struct Node {
+        bsls::AtomicPointer<Node>          d_next;
+        bsls::ObjectBuffer<InplaceFunctor> d_functor;
+    };
+
+    bsls::AtomicPointer<Node> d_head;
+    Node*                     d_tail_p;
+    Node                      d_stub;
+    bsls::AtomicUint64        d_size;
+    bdlma::ConcurrentPool     d_pool;
+    bslma::Allocator*         d_allocator_p;
+
+  private:
+    Inbox(const Inbox&) BSLS_KEYWORD_DELETED;
+    Inbox& operator=(const Inbox&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Link the specified 'node' to the head of the queue.
+    void link(Node* node);
+
+    /// Link the chain of nodes from the specified 'first' node to the
+    /// specified 'last' node, already linked to each other, to the head of
+    /// the queue.
+    void link(Node* first, Node* last);
+
+    /// Return a new node storing the specified 'functor'.
+    Node* create(const Functor& functor);
+
+    /// Unlink the node at the tail of the queue and return it, or return 0
+    /// if the queue is empty or the node at the tail is not yet linked.
+    Node* unlink();
+
+  public:
+    /// Create a new inbox. Optionally specify a 'basicAllocator' used to
+    /// supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used.
+    explicit Inbox(bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~Inbox();
+
+    /// Push the specified 'functor' onto the queue. This function may be
+    /// called by any thread.
+    void push(const Functor& functor);
+
+    /// Push the callable object stored by the specified 'functor' onto the
+    /// queue, leaving the 'functor' empty. This function may be called by
+    /// any thread. Note that the callable object is moved into the queue
+    /// without being copied, and memory is allocated only if it does not
+    /// fit in the storage embedded in each node of the queue.
+    void push(InplaceFunctor* functor);
+
+    /// Atomically push each defined functor in the specified
+    /// 'functorSequence' immediately followed by the specified 'functor', if
+    /// defined, onto the queue, then clear the 'functorSequence'. Return the
+    /// number of functors pushed. This function may be called by any
+    /// thread. Note that functors pushed concurrently by other threads are
+    /// never interleaved with those pushed by this function.
+    bsl::size_t push(FunctorSequence* functorSequence,
+                     const Functor&   functor);
+
+    /// Pop the functor at the tail of the queue and load it into the
+    /// specified 'result'. Return true if a functor was popped, and false
+    /// if the queue is empty or the functor most recently pushed by another
+    /// thread is not yet visible. The behavior is undefined if this
+    /// function is called concurrently by more than one thread.
+    bool pop(InplaceFunctor* result);
+
+    /// Pop and destroy each functor in the queue. The behavior is
+    /// undefined if this function is called concurrently with 'pop'.
+    void clear();
+
+    /// Return the number of functors that 'push' would push onto the queue
+    /// for the specified 'functorSequence' and 'functor': the number of
+    /// defined functors among them.
+    static bsl::size_t count(const FunctorSequence& functorSequence,
+                             const Functor&         functor);
+
+    /// Return the number of functors pushed but not yet popped. Note that
+    /// the result is only a snapshot of a value that may be concurrently
+    /// modified.
+    bsl::size_t size() const;
+
+    /// Return true if there are no functors pushed but not yet popped,
+    /// otherwise return false. Note that the result is only a snapshot of
+    /// a value that may be concurrently modified.
+    bool isEmpty() const;
+};
+
+NTCCFG_INLINE
+bsl::size_t Inbox::size() const
+{
+    return static_cast<bsl::size_t>(d_size.loadAcquire());
+}
+
+NTCCFG_INLINE
+bool Inbox::isEmpty() const
+{
+    return d_size.loadAcquire() == 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
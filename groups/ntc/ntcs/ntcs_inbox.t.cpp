@@ -0,0 +1,227 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_inbox.h>
+
+#include <ntccfg_test.h>
+
+#include <bdlf_bind.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+#include <bsls_assert.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The inbox is tested by pushing functors from one or more producer threads
+// and popping them from a single consumer thread, verifying every functor
+// is popped exactly once and the functors pushed by each producer are
+// popped in the order they were pushed.
+//-----------------------------------------------------------------------------
+
+// [ 1] Functors are popped in the order they were pushed
+// [ 2] Functors pushed by concurrent producers are each popped once
+// [ 3] Functors are moved into the queue without allocating memory
+//-----------------------------------------------------------------------------
+
+namespace test {
+
+/// Record the specified 'value' as the most recent value observed for the
+/// specified 'producer' in the specified 'result', and verify the value
+/// immediately follows the previous value observed for that producer.
+void observe(bsl::vector<int>* result, bsl::size_t producer, int value)
+{
+    NTCCFG_TEST_EQ((*result)[producer] + 1, value);
+    (*result)[producer] = value;
+}
+
+/// Wait on the specified 'barrier' then push the specified 'numFunctors'
+/// onto the specified 'inbox' on behalf of the specified 'producer', each
+/// recording its sequence number into the specified 'result'.
+void produce(ntcs::Inbox*      inbox,
+             bslmt::Barrier*   barrier,
+             bsl::vector<int>* result,
+             bsl::size_t       producer,
+             int               numFunctors)
+{
+    barrier->wait();
+
+    for (int i = 0; i < numFunctors; ++i) {
+        inbox->push(bdlf::BindUtil::bind(&test::observe, result, producer, i));
+    }
+}
+
+}  // close namespace test
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Functors are popped in the order they were pushed.
+    // Plan: Push individual functors and a sequence of functors, then pop
+    // them, verifying the order and that the inbox is empty afterwards.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntcs::Inbox inbox(&ta);
+
+        NTCCFG_TEST_TRUE(inbox.isEmpty());
+        NTCCFG_TEST_EQ(inbox.size(), 0);
+
+        bsl::vector<int> result(1, -1, &ta);
+
+        ntcs::Inbox::InplaceFunctor functor(&ta);
+        NTCCFG_TEST_FALSE(inbox.pop(&functor));
+
+        inbox.push(bdlf::BindUtil::bind(&test::observe, &result, 0, 0));
+        inbox.push(bdlf::BindUtil::bind(&test::observe, &result, 0, 1));
+
+        ntcs::Inbox::FunctorSequence functorSequence(&ta);
+        functorSequence.push_back(
+            bdlf::BindUtil::bind(&test::observe, &result, 0, 2));
+        functorSequence.push_back(
+            bdlf::BindUtil::bind(&test::observe, &result, 0, 3));
+
+        inbox.push(&functorSequence,
+                   bdlf::BindUtil::bind(&test::observe, &result, 0, 4));
+
+        NTCCFG_TEST_TRUE(functorSequence.empty());
+        NTCCFG_TEST_EQ(inbox.size(), 5);
+
+        while (inbox.pop(&functor)) {
+            functor();
+        }
+
+        NTCCFG_TEST_EQ(result[0], 4);
+        NTCCFG_TEST_TRUE(inbox.isEmpty());
+
+        inbox.push(bdlf::BindUtil::bind(&test::observe, &result, 0, 5));
+        inbox.clear();
+
+        NTCCFG_TEST_TRUE(inbox.isEmpty());
+        NTCCFG_TEST_EQ(result[0], 4);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: Functors pushed by concurrent producers are each popped once.
+    // Plan: Push functors from several producer threads while a single
+    // consumer pops them, verifying each producer's functors are executed
+    // exactly once and in the order they were pushed by that producer.
+
+    ntccfg::TestAllocator ta;
+    {
+        const bsl::size_t k_NUM_PRODUCERS = 4;
+        const int         k_NUM_FUNCTORS  = 10000;
+
+        ntcs::Inbox inbox(&ta);
+
+        bsl::vector<int> result(k_NUM_PRODUCERS, -1, &ta);
+
+        bslmt::Barrier barrier(k_NUM_PRODUCERS);
+
+        bslmt::ThreadGroup threadGroup(&ta);
+        for (bsl::size_t i = 0; i < k_NUM_PRODUCERS; ++i) {
+            threadGroup.addThread(bdlf::BindUtil::bind(&test::produce,
+                                                       &inbox,
+                                                       &barrier,
+                                                       &result,
+                                                       i,
+                                                       k_NUM_FUNCTORS));
+        }
+
+        const bsl::size_t k_TOTAL = k_NUM_PRODUCERS * k_NUM_FUNCTORS;
+
+        ntcs::Inbox::InplaceFunctor functor(&ta);
+
+        bsl::size_t numPopped = 0;
+        while (numPopped < k_TOTAL) {
+            if (inbox.pop(&functor)) {
+                functor();
+                ++numPopped;
+            }
+        }
+
+        threadGroup.joinAll();
+
+        for (bsl::size_t i = 0; i < k_NUM_PRODUCERS; ++i) {
+            NTCCFG_TEST_EQ(result[i], k_NUM_FUNCTORS - 1);
+        }
+
+        NTCCFG_TEST_TRUE(inbox.isEmpty());
+        NTCCFG_TEST_FALSE(inbox.pop(&functor));
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(3)
+{
+    // Concern: Functors are moved into the queue without allocating memory.
+    // Plan: Push a functor whose bound arguments are stored inline, verify
+    // the pushed functor is left empty and that no memory other than the
+    // node is allocated, then pop and execute it.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntcs::Inbox inbox(&ta);
+
+        bsl::vector<int> result(1, -1, &ta);
+
+        ntcs::Inbox::InplaceFunctor functor(
+            bdlf::BindUtil::bind(&test::observe, &result, 0, 0),
+            &ta);
+        NTCCFG_TEST_TRUE(functor.isInplace());
+
+        // Push and pop once so the node pool has allocated its first block.
+
+        inbox.push(&functor);
+        NTCCFG_TEST_FALSE(functor);
+        NTCCFG_TEST_TRUE(inbox.pop(&functor));
+        functor();
+        NTCCFG_TEST_EQ(result[0], 0);
+
+        ntcs::Inbox::InplaceFunctor other(
+            bdlf::BindUtil::bind(&test::observe, &result, 0, 1),
+            &ta);
+
+        const bsl::int64_t numBlocksInUse = ta.numBlocksInUse();
+
+        inbox.push(&other);
+        NTCCFG_TEST_FALSE(other);
+        NTCCFG_TEST_EQ(inbox.size(), 1);
+        NTCCFG_TEST_EQ(ta.numBlocksInUse(), numBlocksInUse);
+
+        NTCCFG_TEST_TRUE(inbox.pop(&functor));
+        functor();
+        NTCCFG_TEST_EQ(result[0], 1);
+        NTCCFG_TEST_TRUE(inbox.isEmpty());
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+    NTCCFG_TEST_REGISTER(3);
+}
+NTCCFG_TEST_DRIVER_END;
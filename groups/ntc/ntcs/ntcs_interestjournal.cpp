@@ -0,0 +1,92 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_interestjournal.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntcs_interestjournal_cpp, "$Id$ $CSID$")
+
+#include <bslma_default.h>
+#include <bslmt_threadutil.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace ntcs {
+
+namespace {
+
+bslmt::ThreadUtil::Key s_key;
+
+struct Initializer {
+    Initializer()
+    {
+        int rc = bslmt::ThreadUtil::createKey(&s_key, 0);
+        BSLS_ASSERT_OPT(rc == 0);
+    }
+
+    ~Initializer()
+    {
+        // MRM: int rc = bslmt::ThreadUtil::deleteKey(s_key);
+        // MRM: BSLS_ASSERT_OPT(rc == 0);
+    }
+} s_initializer;
+
+}  // close unnamed namespace
+
+InterestJournal::InterestJournal(const ntcs::Driver* driver,
+                                 bslma::Allocator*   basicAllocator)
+: d_driver_p(driver)
+, d_entryVector(basicAllocator)
+, d_entrySet(basicAllocator)
+, d_numUpdates(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+InterestJournal::~InterestJournal()
+{
+}
+
+void InterestJournal::clear()
+{
+    d_entryVector.clear();
+    d_entrySet.clear();
+    d_numUpdates = 0;
+}
+
+ntcs::InterestJournal* InterestJournal::setThreadLocal(
+    ntcs::InterestJournal* journal)
+{
+    ntcs::InterestJournal* previous = reinterpret_cast<ntcs::InterestJournal*>(
+        bslmt::ThreadUtil::getSpecific(s_key));
+
+    int rc = bslmt::ThreadUtil::setSpecific(
+        s_key,
+        const_cast<const void*>(static_cast<void*>(journal)));
+    BSLS_ASSERT_OPT(rc == 0);
+
+    return previous;
+}
+
+ntcs::InterestJournal* InterestJournal::getThreadLocal()
+{
+    ntcs::InterestJournal* current = reinterpret_cast<ntcs::InterestJournal*>(
+        bslmt::ThreadUtil::getSpecific(s_key));
+
+    return current;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,224 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCS_INTERESTJOURNAL
+#define INCLUDED_NTCS_INTERESTJOURNAL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_platform.h>
+#include <ntcs_driver.h>
+#include <ntcs_registry.h>
+#include <ntcscm_version.h>
+#include <bslma_allocator.h>
+#include <bsls_keyword.h>
+#include <bsl_memory.h>
+#include <bsl_unordered_set.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ntcs {
+
+/// @internal @brief
+/// Provide a journal of registry entries whose interest has changed.
+///
+/// @details
+/// This class records the registry entries whose interest in socket events
+/// has changed while a waiter thread processes the events polled from a
+/// reactor's polling device, so that the reactor may apply each change to
+/// the polling device once, before the thread next blocks, rather than
+/// once per change. Each entry is recorded at most once until the journal
+/// is cleared; the journal stores the entry and not the interest, so the
+/// interest applied to the polling device is the interest of the entry at
+/// the time the journal is applied, which coalesces any number of
+/// redundant or self-cancelling transitions into a single update. A
+/// journal is associated with the driver that owns it, so that a thread
+/// waiting on one reactor does not journal changes in interest made to
+/// sockets registered with some other reactor.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntcs
+class InterestJournal
+{
+  public:
+    /// Define a type alias for a vector of registry entries.
+    typedef bsl::vector<bsl::shared_ptr<ntcs::RegistryEntry> > EntryVector;
+
+  private:
+    /// Define a type alias for a set of registry entries.
+    typedef bsl::unordered_set<const ntcs::RegistryEntry*> EntrySet;
+
+    const ntcs::Driver* d_driver_p;
+    EntryVector         d_entryVector;
+    EntrySet            d_entrySet;
+    bsl::size_t         d_numUpdates;
+    bslma::Allocator*   d_allocator_p;
+
+  private:
+    InterestJournal(const InterestJournal&) BSLS_KEYWORD_DELETED;
+    InterestJournal& operator=(const InterestJournal&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new, empty interest journal for the specified 'driver'.
+    /// Optionally specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
+    explicit InterestJournal(const ntcs::Driver* driver,
+                             bslma::Allocator*   basicAllocator = 0);
+
+    /// Destroy this object.
+    ~InterestJournal();
+
+    /// Record the change in interest of the specified 'entry'. Return
+    /// true if 'entry' was not already recorded since the journal was last
+    /// cleared, otherwise return false.
+    bool record(const bsl::shared_ptr<ntcs::RegistryEntry>& entry);
+
+    /// Remove all entries from the journal and reset the number of changes
+    /// recorded to zero.
+    void clear();
+
+    /// Return the driver that owns this journal.
+    const ntcs::Driver* driver() const;
+
+    /// Return the distinct entries recorded since the journal was last
+    /// cleared, in the order each was first recorded.
+    const EntryVector& entries() const;
+
+    /// Return the number of changes recorded since the journal was last
+    /// cleared, including redundant changes to the same entry.
+    bsl::size_t numUpdates() const;
+
+    /// Return true if no changes have been recorded since the journal was
+    /// last cleared, otherwise return false.
+    bool isEmpty() const;
+
+    /// Set the specified 'journal' as the journal into which the current
+    /// thread records changes in interest. Return the previous journal of
+    /// the current thread, if any.
+    static ntcs::InterestJournal* setThreadLocal(
+        ntcs::InterestJournal* journal);
+
+    /// Return the journal into which the current thread records changes in
+    /// interest, if any.
+    static ntcs::InterestJournal* getThreadLocal();
+
+    /// Return the journal into which the current thread records changes in
+    /// interest in the sockets registered with the specified 'driver', or
+    /// 0 if the current thread is not journaling such changes.
+    static ntcs::InterestJournal* lookup(const ntcs::Driver* driver);
+};
+
+/// @internal @brief
+/// Provide a guard to install and uninstall an interest journal into
+/// thread-local storage.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntcs
+class InterestJournalGuard
+{
+    ntcs::InterestJournal* d_current_p;
+    ntcs::InterestJournal* d_previous_p;
+
+  private:
+    InterestJournalGuard(const InterestJournalGuard&) BSLS_KEYWORD_DELETED;
+    InterestJournalGuard& operator=(const InterestJournalGuard&)
+        BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new journal guard that installs the specified 'journal'
+    /// into thread local storage and uninstalls it when this object is
+    /// destroyed.
+    explicit InterestJournalGuard(ntcs::InterestJournal* journal);
+
+    /// Uninstall the underlying journal from thread local storage then
+    /// destroy this object.
+    ~InterestJournalGuard();
+};
+
+NTCCFG_INLINE
+bool InterestJournal::record(const bsl::shared_ptr<ntcs::RegistryEntry>& entry)
+{
+    ++d_numUpdates;
+
+    if (!d_entrySet.insert(entry.get()).second) {
+        return false;
+    }
+
+    d_entryVector.push_back(entry);
+    return true;
+}
+
+NTCCFG_INLINE
+const ntcs::Driver* InterestJournal::driver() const
+{
+    return d_driver_p;
+}
+
+NTCCFG_INLINE
+const InterestJournal::EntryVector& InterestJournal::entries() const
+{
+    return d_entryVector;
+}
+
+NTCCFG_INLINE
+bsl::size_t InterestJournal::numUpdates() const
+{
+    return d_numUpdates;
+}
+
+NTCCFG_INLINE
+bool InterestJournal::isEmpty() const
+{
+    return d_numUpdates == 0;
+}
+
+NTCCFG_INLINE
+ntcs::InterestJournal* InterestJournal::lookup(const ntcs::Driver* driver)
+{
+    ntcs::InterestJournal* journal = InterestJournal::getThreadLocal();
+    if (journal != 0 && journal->d_driver_p == driver) {
+        return journal;
+    }
+
+    return 0;
+}
+
+NTCCFG_INLINE
+InterestJournalGuard::InterestJournalGuard(ntcs::InterestJournal* journal)
+: d_current_p(journal)
+, d_previous_p(0)
+{
+    if (d_current_p) {
+        d_previous_p = ntcs::InterestJournal::setThreadLocal(d_current_p);
+    }
+}
+
+NTCCFG_INLINE
+InterestJournalGuard::~InterestJournalGuard()
+{
+    if (d_current_p) {
+        ntcs::InterestJournal::setThreadLocal(d_previous_p);
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
@@ -0,0 +1,144 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_interestjournal.h>
+
+#include <ntccfg_test.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bsls_assert.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The interest journal is tested by recording changes to the interest of
+// registry entries, verifying each entry is recorded once regardless of the
+// number of changes, and that the journal is found through thread-local
+// storage only for the driver that owns it.
+//-----------------------------------------------------------------------------
+
+// [ 1] Changes to the same entry are coalesced
+// [ 2] The journal is installed into thread-local storage
+//-----------------------------------------------------------------------------
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Changes to the same entry are coalesced.
+    // Plan: Record several changes to the interest of two entries, verifying
+    // each entry is recorded once, in the order first recorded, while every
+    // change is counted.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntcs::InterestJournal journal(0, &ta);
+
+        NTCCFG_TEST_TRUE(journal.isEmpty());
+        NTCCFG_TEST_EQ(journal.numUpdates(), 0);
+        NTCCFG_TEST_TRUE(journal.entries().empty());
+
+        bsl::shared_ptr<ntcs::RegistryEntry> entry1;
+        entry1.createInplace(&ta,
+                             1,
+                             ntca::ReactorEventTrigger::e_LEVEL,
+                             false,
+                             &ta);
+
+        bsl::shared_ptr<ntcs::RegistryEntry> entry2;
+        entry2.createInplace(&ta,
+                             2,
+                             ntca::ReactorEventTrigger::e_LEVEL,
+                             false,
+                             &ta);
+
+        ntca::ReactorEventOptions options;
+
+        entry1->showReadable(options);
+        NTCCFG_TEST_TRUE(journal.record(entry1));
+
+        entry2->showWritable(options);
+        NTCCFG_TEST_TRUE(journal.record(entry2));
+
+        entry1->showWritable(options);
+        NTCCFG_TEST_FALSE(journal.record(entry1));
+
+        entry1->hideWritable(options);
+        NTCCFG_TEST_FALSE(journal.record(entry1));
+
+        NTCCFG_TEST_FALSE(journal.isEmpty());
+        NTCCFG_TEST_EQ(journal.numUpdates(), 4);
+        NTCCFG_TEST_EQ(journal.entries().size(), 2);
+        NTCCFG_TEST_EQ(journal.entries()[0], entry1);
+        NTCCFG_TEST_EQ(journal.entries()[1], entry2);
+
+        NTCCFG_TEST_TRUE(journal.entries()[0]->interest().wantReadable());
+        NTCCFG_TEST_FALSE(journal.entries()[0]->interest().wantWritable());
+
+        journal.clear();
+
+        NTCCFG_TEST_TRUE(journal.isEmpty());
+        NTCCFG_TEST_EQ(journal.numUpdates(), 0);
+        NTCCFG_TEST_TRUE(journal.entries().empty());
+
+        NTCCFG_TEST_TRUE(journal.record(entry1));
+        NTCCFG_TEST_EQ(journal.entries().size(), 1);
+
+        journal.clear();
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: The journal is installed into thread-local storage.
+    // Plan: Install a journal with a guard, verifying the journal is found
+    // while the guard is in scope and not after.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntcs::InterestJournal journal(0, &ta);
+
+        NTCCFG_TEST_EQ(ntcs::InterestJournal::getThreadLocal(), 0);
+        NTCCFG_TEST_EQ(ntcs::InterestJournal::lookup(0), 0);
+
+        {
+            ntcs::InterestJournalGuard guard(&journal);
+
+            NTCCFG_TEST_EQ(ntcs::InterestJournal::getThreadLocal(), &journal);
+            NTCCFG_TEST_EQ(ntcs::InterestJournal::lookup(0), &journal);
+
+            {
+                ntcs::InterestJournalGuard nullGuard(0);
+                NTCCFG_TEST_EQ(ntcs::InterestJournal::getThreadLocal(),
+                               &journal);
+            }
+        }
+
+        NTCCFG_TEST_EQ(ntcs::InterestJournal::getThreadLocal(), 0);
+        NTCCFG_TEST_EQ(ntcs::InterestJournal::lookup(0), 0);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+}
+NTCCFG_TEST_DRIVER_END;
@@ -23,10 +23,15 @@ BSLS_IDENT_RCSID(ntcs_memorymap_cpp, "$Id$ $CSID$")
 
 #include <bsls_assert.h>
 #include <bsls_platform.h>
+#include <bsls_types.h>
 #include <bsl_cstdlib.h>
 
 #if defined(BSLS_PLATFORM_OS_UNIX)
+#include <errno.h>
+#include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
 #include <unistd.h>
 #elif defined(BSLS_PLATFORM_OS_WINDOWS)
 #include <windows.h>
@@ -80,6 +85,85 @@ bsl::size_t MemoryMap::pageSize()
     return static_cast<bsl::size_t>(::sysconf(_SC_PAGESIZE));
 }
 
+ntsa::Error MemoryMap::create(void**      result,
+                              const char* path,
+                              bsl::size_t size)
+{
+    *result = 0;
+
+    int fd = ::open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return ntsa::Error(errno);
+    }
+
+    int rc = ::ftruncate(fd, static_cast<off_t>(size));
+    if (rc != 0) {
+        ntsa::Error error(errno);
+        ::close(fd);
+        return error;
+    }
+
+    void* address =
+        ::mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (address == MAP_FAILED) {
+        ntsa::Error error(errno);
+        ::close(fd);
+        return error;
+    }
+
+    ::close(fd);
+
+    *result = address;
+    return ntsa::Error();
+}
+
+ntsa::Error MemoryMap::open(void** result, bsl::size_t* size, const char* path)
+{
+    *result = 0;
+    *size   = 0;
+
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+        return ntsa::Error(errno);
+    }
+
+    struct stat info;
+    int         rc = ::fstat(fd, &info);
+    if (rc != 0) {
+        ntsa::Error error(errno);
+        ::close(fd);
+        return error;
+    }
+
+    if (info.st_size <= 0) {
+        ::close(fd);
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    const bsl::size_t length = static_cast<bsl::size_t>(info.st_size);
+
+    void* address = ::mmap(0, length, PROT_READ, MAP_SHARED, fd, 0);
+    if (address == MAP_FAILED) {
+        ntsa::Error error(errno);
+        ::close(fd);
+        return error;
+    }
+
+    ::close(fd);
+
+    *result = address;
+    *size   = length;
+    return ntsa::Error();
+}
+
+void MemoryMap::unmap(void* address, bsl::size_t size)
+{
+    int rc = ::munmap(address, size);
+    if (rc != 0) {
+        bsl::abort();
+    }
+}
+
 #elif defined(BSLS_PLATFORM_OS_WINDOWS)
 
 void* MemoryMap::acquire(bsl::size_t numPages)
@@ -109,6 +193,103 @@ bsl::size_t MemoryMap::pageSize()
     return static_cast<bsl::size_t>(si.dwAllocationGranularity);
 }
 
+ntsa::Error MemoryMap::create(void**      result,
+                              const char* path,
+                              bsl::size_t size)
+{
+    *result = 0;
+
+    HANDLE file = CreateFileA(path,
+                              GENERIC_READ | GENERIC_WRITE,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE,
+                              0,
+                              CREATE_ALWAYS,
+                              FILE_ATTRIBUTE_NORMAL,
+                              0);
+    if (file == INVALID_HANDLE_VALUE) {
+        return ntsa::Error::last();
+    }
+
+    const bsls::Types::Uint64 length = static_cast<bsls::Types::Uint64>(size);
+
+    HANDLE mapping = CreateFileMappingA(file,
+                                        0,
+                                        PAGE_READWRITE,
+                                        static_cast<DWORD>(length >> 32),
+                                        static_cast<DWORD>(length),
+                                        0);
+    if (mapping == 0) {
+        ntsa::Error error = ntsa::Error::last();
+        CloseHandle(file);
+        return error;
+    }
+
+    void* address = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, size);
+    if (address == 0) {
+        ntsa::Error error = ntsa::Error::last();
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return error;
+    }
+
+    CloseHandle(mapping);
+    CloseHandle(file);
+
+    *result = address;
+    return ntsa::Error();
+}
+
+ntsa::Error MemoryMap::open(void** result, bsl::size_t* size, const char* path)
+{
+    *result = 0;
+    *size   = 0;
+
+    HANDLE file = CreateFileA(path,
+                              GENERIC_READ,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE,
+                              0,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL,
+                              0);
+    if (file == INVALID_HANDLE_VALUE) {
+        return ntsa::Error::last();
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0) {
+        CloseHandle(file);
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, 0, PAGE_READONLY, 0, 0, 0);
+    if (mapping == 0) {
+        ntsa::Error error = ntsa::Error::last();
+        CloseHandle(file);
+        return error;
+    }
+
+    void* address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (address == 0) {
+        ntsa::Error error = ntsa::Error::last();
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return error;
+    }
+
+    CloseHandle(mapping);
+    CloseHandle(file);
+
+    *result = address;
+    *size   = static_cast<bsl::size_t>(fileSize.QuadPart);
+    return ntsa::Error();
+}
+
+void MemoryMap::unmap(void* address, bsl::size_t size)
+{
+    NTCCFG_WARNING_UNUSED(size);
+    UnmapViewOfFile(address);
+}
+
 #else
 #error Not implemented
 #endif
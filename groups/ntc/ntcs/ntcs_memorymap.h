@@ -21,6 +21,7 @@ BSLS_IDENT("$Id: $")
 
 #include <ntccfg_platform.h>
 #include <ntcscm_version.h>
+#include <ntsa_error.h>
 #include <bsl_cstddef.h>
 
 namespace BloombergLP {
@@ -48,6 +49,31 @@ struct MemoryMap {
 
     /// Return the granularity of allocation, in bytes.
     static bsl::size_t pageSize();
+
+    /// Map the file at the specified 'path' into virtual address space
+    /// shared with every other process that maps the same file, creating
+    /// the file if it does not exist and truncating and then extending it
+    /// to exactly the specified 'size' bytes, each zero. Load into the
+    /// specified 'result' the beginning of the address of the readable and
+    /// writable mapped memory. Return the error.
+    static ntsa::Error create(void**      result,
+                              const char* path,
+                              bsl::size_t size);
+
+    /// Map the entirety of the existing file at the specified 'path' into
+    /// read-only virtual address space shared with every other process that
+    /// maps the same file. Load into the specified 'result' the beginning of
+    /// the address of the mapped memory and load into the specified 'size'
+    /// the number of bytes mapped. Return the error.
+    static ntsa::Error open(void**       result,
+                            bsl::size_t* size,
+                            const char*  path);
+
+    /// Unmap the specified 'size' bytes of the file mapping beginning at the
+    /// specified 'address'. The behavior is undefined unless 'address' and
+    /// 'size' have previously been returned from 'create()' or 'open()' and
+    /// not yet unmapped.
+    static void unmap(void* address, bsl::size_t size);
 };
 
 }  // end namespace ntcs
@@ -23,6 +23,8 @@ BSLS_IDENT_RCSID(ntcs_metrics_cpp, "$Id$ $CSID$")
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsl_cstdint.h>
 
 namespace BloombergLP {
 namespace ntcs {
@@ -30,12 +32,20 @@ namespace ntcs {
 namespace {
 
 bslmt::ThreadUtil::Key s_key;
+bslmt::ThreadUtil::Key s_ownerKey;
+bslmt::ThreadUtil::Key s_threadIndexKey;
 
 struct Initializer {
     Initializer()
     {
         int rc = bslmt::ThreadUtil::createKey(&s_key, 0);
         BSLS_ASSERT_OPT(rc == 0);
+
+        rc = bslmt::ThreadUtil::createKey(&s_ownerKey, 0);
+        BSLS_ASSERT_OPT(rc == 0);
+
+        rc = bslmt::ThreadUtil::createKey(&s_threadIndexKey, 0);
+        BSLS_ASSERT_OPT(rc == 0);
     }
 
     ~Initializer()
@@ -62,10 +72,10 @@ const ntci::MetricMetadata Metrics::STATISTICS[] = {
     NTCI_METRIC_METADATA_SUMMARY(delayInAcceptQueue),
 
     NTCI_METRIC_METADATA_SUMMARY(bytesInWriteQueue),
-    NTCI_METRIC_METADATA_SUMMARY(delayInWriteQueue),
+    NTCI_METRIC_METADATA_DISTRIBUTION(delayInWriteQueue),
 
     NTCI_METRIC_METADATA_SUMMARY(bytesInReadQueue),
-    NTCI_METRIC_METADATA_SUMMARY(delayInReadQueue),
+    NTCI_METRIC_METADATA_DISTRIBUTION(delayInReadQueue),
 
     NTCI_METRIC_METADATA_SUMMARY(connectionsAccepted),
     NTCI_METRIC_METADATA_SUMMARY(connectionsUnacceptable),
@@ -77,45 +87,43 @@ const ntci::MetricMetadata Metrics::STATISTICS[] = {
 
     NTCI_METRIC_METADATA_SUMMARY(txDelayBeforeScheduling),
     NTCI_METRIC_METADATA_SUMMARY(txDelayInSoftware),
-    NTCI_METRIC_METADATA_SUMMARY(txDelay),
+    NTCI_METRIC_METADATA_DISTRIBUTION(txDelay),
     NTCI_METRIC_METADATA_SUMMARY(txDelayBeforeAcknowledgement),
 
     NTCI_METRIC_METADATA_SUMMARY(rxDelayInHardware),
-    NTCI_METRIC_METADATA_SUMMARY(rxDelay)};
+    NTCI_METRIC_METADATA_DISTRIBUTION(rxDelay)};
 
 Metrics::Metrics(const bslstl::StringRef& prefix,
                  const bslstl::StringRef& objectName,
                  bslma::Allocator*        basicAllocator)
 : d_mutex()
-, d_numBytesSendable()
-, d_numBytesSent()
-, d_numBytesReceivable()
-, d_numBytesReceived()
-, d_numAcceptIterations()
-, d_numSendIterations()
-, d_numReceiveIterations()
-, d_acceptQueueSize()
-, d_acceptQueueDelay()
-, d_writeQueueSize()
-, d_writeQueueDelay()
-, d_readQueueSize()
-, d_readQueueDelay()
-, d_numConnectionsAccepted()
-, d_numConnectionsUnacceptable()
-, d_numConnectionsSynchronized()
-, d_numConnectionsUnsynchronizable()
-, d_numBytesAllocated()
-, d_txDelayBeforeScheduling()
-, d_txDelayInSoftware()
-, d_txDelay()
-, d_txDelayBeforeAcknowledgement()
-, d_rxDelayInHardware()
-, d_rxDelay()
+, d_sharedLock(bsls::SpinLock::s_unlocked)
+, d_accumulators(basicAllocator)
+, d_shared_p(0)
+, d_sharedLockRequired(true)
 , d_prefix(prefix, basicAllocator)
 , d_objectName(objectName, basicAllocator)
 , d_parent_sp()
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
+    this->initialize(0);
+}
+
+Metrics::Metrics(const bslstl::StringRef& prefix,
+                 const bslstl::StringRef& objectName,
+                 bsl::size_t              numThreads,
+                 bslma::Allocator*        basicAllocator)
+: d_mutex()
+, d_sharedLock(bsls::SpinLock::s_unlocked)
+, d_accumulators(basicAllocator)
+, d_shared_p(0)
+, d_sharedLockRequired(true)
+, d_prefix(prefix, basicAllocator)
+, d_objectName(objectName, basicAllocator)
+, d_parent_sp()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    this->initialize(numThreads);
 }
 
 Metrics::Metrics(const bslstl::StringRef&              prefix,
@@ -123,7 +131,41 @@ Metrics::Metrics(const bslstl::StringRef&              prefix,
                  const bsl::shared_ptr<ntcs::Metrics>& parent,
                  bslma::Allocator*                     basicAllocator)
 : d_mutex()
-, d_numBytesSendable()
+, d_sharedLock(bsls::SpinLock::s_unlocked)
+, d_accumulators(basicAllocator)
+, d_shared_p(0)
+, d_sharedLockRequired(false)
+, d_prefix(basicAllocator)
+, d_objectName(basicAllocator)
+, d_parent_sp(parent)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    this->initialize(0);
+
+    if (d_parent_sp) {
+        d_prefix.append(d_parent_sp->getFieldPrefix(0));
+        d_prefix.append(1, '.');
+
+        d_objectName.append(d_parent_sp->objectName());
+        d_objectName.append(1, '-');
+    }
+
+    d_prefix.append(prefix);
+    d_objectName.append(objectName);
+}
+
+Metrics::~Metrics()
+{
+    for (AccumulatorVector::iterator it = d_accumulators.begin();
+         it != d_accumulators.end();
+         ++it)
+    {
+        d_allocator_p->deleteObject(*it);
+    }
+}
+
+Metrics::Accumulator::Accumulator(bslma::Allocator* basicAllocator)
+: d_numBytesSendable()
 , d_numBytesSent()
 , d_numBytesReceivable()
 , d_numBytesReceived()
@@ -133,9 +175,9 @@ Metrics::Metrics(const bslstl::StringRef&              prefix,
 , d_acceptQueueSize()
 , d_acceptQueueDelay()
 , d_writeQueueSize()
-, d_writeQueueDelay()
+, d_writeQueueDelay(basicAllocator)
 , d_readQueueSize()
-, d_readQueueDelay()
+, d_readQueueDelay(basicAllocator)
 , d_numConnectionsAccepted()
 , d_numConnectionsUnacceptable()
 , d_numConnectionsSynchronized()
@@ -143,34 +185,99 @@ Metrics::Metrics(const bslstl::StringRef&              prefix,
 , d_numBytesAllocated()
 , d_txDelayBeforeScheduling()
 , d_txDelayInSoftware()
-, d_txDelay()
+, d_txDelay(basicAllocator)
 , d_txDelayBeforeAcknowledgement()
 , d_rxDelayInHardware()
-, d_rxDelay()
-, d_prefix(basicAllocator)
-, d_objectName(basicAllocator)
-, d_parent_sp(parent)
-, d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_rxDelay(basicAllocator)
 {
-    if (d_parent_sp) {
-        d_prefix.append(d_parent_sp->getFieldPrefix(0));
-        d_prefix.append(1, '.');
+}
 
-        d_objectName.append(d_parent_sp->objectName());
-        d_objectName.append(1, '-');
+void Metrics::initialize(bsl::size_t numThreads)
+{
+    d_accumulators.reserve(numThreads + 1);
+    for (bsl::size_t i = 0; i < numThreads + 1; ++i) {
+        d_accumulators.push_back(new (*d_allocator_p)
+                                     Accumulator(d_allocator_p));
     }
 
-    d_prefix.append(prefix);
-    d_objectName.append(objectName);
+    d_shared_p = d_accumulators.back();
 }
 
-Metrics::~Metrics()
+template <typename METRIC>
+void Metrics::update(METRIC Accumulator::*metric, double value)
+{
+    // Each I/O thread attached to these metrics is the only writer of the
+    // accumulator for its thread index, so it updates that accumulator
+    // without a lock.
+
+    const bsl::size_t numThreads = d_accumulators.size() - 1;
+
+    if (numThreads > 0 &&
+        bslmt::ThreadUtil::getSpecific(s_ownerKey) == this)
+    {
+        const bsl::uintptr_t biasedThreadIndex =
+            reinterpret_cast<bsl::uintptr_t>(
+                bslmt::ThreadUtil::getSpecific(s_threadIndexKey));
+        BSLS_ASSERT(biasedThreadIndex != 0);
+
+        const bsl::size_t threadIndex =
+            static_cast<bsl::size_t>(biasedThreadIndex - 1);
+
+        if (threadIndex < numThreads) {
+            (d_accumulators[threadIndex]->*metric).update(value);
+            return;
+        }
+    }
+
+    if (d_sharedLockRequired) {
+        bsls::SpinLockGuard guard(&d_sharedLock);
+        (d_shared_p->*metric).update(value);
+    }
+    else {
+        (d_shared_p->*metric).update(value);
+    }
+}
+
+void Metrics::collectSummary(bdld::DatumMutableArrayRef*         array,
+                             bsl::size_t*                        index,
+                             ntci::SingleWriterMetric Accumulator::*metric)
+{
+    ntci::MetricValue result;
+
+    for (AccumulatorVector::const_iterator it = d_accumulators.begin();
+         it != d_accumulators.end();
+         ++it)
+    {
+        ntci::MetricValue value;
+        ((*it)->*metric).load(&value);
+        result.merge(value);
+    }
+
+    result.collectSummary(array, index);
+}
+
+void Metrics::collectDistribution(
+    bdld::DatumMutableArrayRef*                  array,
+    bsl::size_t*                                 index,
+    ntci::SingleWriterMetricHistogram Accumulator::*metric)
 {
+    ntci::MetricHistogramValue result;
+
+    for (AccumulatorVector::const_iterator it = d_accumulators.begin();
+         it != d_accumulators.end();
+         ++it)
+    {
+        ntci::MetricHistogramValue value;
+        ((*it)->*metric).load(&value);
+        result.merge(value);
+    }
+
+    result.collectDistribution(array, index);
 }
 
 void Metrics::logConnectCompletion()
 {
-    d_numConnectionsSynchronized.update(1);
+    this->update(&Accumulator::d_numConnectionsSynchronized, 1);
 
     if (d_parent_sp) {
         d_parent_sp->logConnectCompletion();
@@ -179,7 +286,7 @@ void Metrics::logConnectCompletion()
 
 void Metrics::logConnectFailure()
 {
-    d_numConnectionsUnsynchronizable.update(1);
+    this->update(&Accumulator::d_numConnectionsUnsynchronizable, 1);
 
     if (d_parent_sp) {
         d_parent_sp->logConnectFailure();
@@ -188,7 +295,7 @@ void Metrics::logConnectFailure()
 
 void Metrics::logAcceptCompletion()
 {
-    d_numConnectionsAccepted.update(1);
+    this->update(&Accumulator::d_numConnectionsAccepted, 1);
 
     if (d_parent_sp) {
         d_parent_sp->logAcceptCompletion();
@@ -197,7 +304,7 @@ void Metrics::logAcceptCompletion()
 
 void Metrics::logAcceptFailure()
 {
-    d_numConnectionsUnacceptable.update(1);
+    this->update(&Accumulator::d_numConnectionsUnacceptable, 1);
 
     if (d_parent_sp) {
         d_parent_sp->logAcceptFailure();
@@ -207,7 +314,8 @@ void Metrics::logAcceptFailure()
 void Metrics::logAcceptIterations(bsl::size_t numIterations)
 {
     if (numIterations > 0) {
-        d_numReceiveIterations.update(static_cast<double>(numIterations));
+        this->update(&Accumulator::d_numReceiveIterations,
+                     static_cast<double>(numIterations));
     }
 
     if (d_parent_sp) {
@@ -218,8 +326,10 @@ void Metrics::logAcceptIterations(bsl::size_t numIterations)
 void Metrics::logSendCompletion(bsl::size_t numBytesSendable,
                                 bsl::size_t numBytesSent)
 {
-    d_numBytesSendable.update(static_cast<double>(numBytesSendable));
-    d_numBytesSent.update(static_cast<double>(numBytesSent));
+    this->update(&Accumulator::d_numBytesSendable,
+                 static_cast<double>(numBytesSendable));
+    this->update(&Accumulator::d_numBytesSent,
+                 static_cast<double>(numBytesSent));
 
     if (d_parent_sp) {
         d_parent_sp->logSendCompletion(numBytesSendable, numBytesSent);
@@ -229,7 +339,8 @@ void Metrics::logSendCompletion(bsl::size_t numBytesSendable,
 void Metrics::logSendIterations(bsl::size_t numIterations)
 {
     if (numIterations > 0) {
-        d_numSendIterations.update(static_cast<double>(numIterations));
+        this->update(&Accumulator::d_numSendIterations,
+                     static_cast<double>(numIterations));
     }
 
     if (d_parent_sp) {
@@ -240,8 +351,10 @@ void Metrics::logSendIterations(bsl::size_t numIterations)
 void Metrics::logReceiveCompletion(bsl::size_t numBytesReceivable,
                                    bsl::size_t numBytesReceived)
 {
-    d_numBytesReceivable.update(static_cast<double>(numBytesReceivable));
-    d_numBytesReceived.update(static_cast<double>(numBytesReceived));
+    this->update(&Accumulator::d_numBytesReceivable,
+                 static_cast<double>(numBytesReceivable));
+    this->update(&Accumulator::d_numBytesReceived,
+                 static_cast<double>(numBytesReceived));
 
     if (d_parent_sp) {
         d_parent_sp->logReceiveCompletion(numBytesReceivable,
@@ -252,7 +365,8 @@ void Metrics::logReceiveCompletion(bsl::size_t numBytesReceivable,
 void Metrics::logReceiveIterations(bsl::size_t numIterations)
 {
     if (numIterations > 0) {
-        d_numReceiveIterations.update(static_cast<double>(numIterations));
+        this->update(&Accumulator::d_numReceiveIterations,
+                     static_cast<double>(numIterations));
     }
 
     if (d_parent_sp) {
@@ -262,7 +376,8 @@ void Metrics::logReceiveIterations(bsl::size_t numIterations)
 
 void Metrics::logAcceptQueueSize(bsl::size_t acceptQueueSize)
 {
-    d_acceptQueueSize.update(static_cast<double>(acceptQueueSize));
+    this->update(&Accumulator::d_acceptQueueSize,
+                 static_cast<double>(acceptQueueSize));
 
     if (d_parent_sp) {
         d_parent_sp->logAcceptQueueSize(acceptQueueSize);
@@ -271,7 +386,8 @@ void Metrics::logAcceptQueueSize(bsl::size_t acceptQueueSize)
 
 void Metrics::logAcceptQueueDelay(const bsls::TimeInterval& acceptQueueDelay)
 {
-    d_acceptQueueDelay.update(acceptQueueDelay.totalSecondsAsDouble());
+    this->update(&Accumulator::d_acceptQueueDelay,
+                 acceptQueueDelay.totalSecondsAsDouble());
 
     if (d_parent_sp) {
         d_parent_sp->logAcceptQueueDelay(acceptQueueDelay);
@@ -280,7 +396,8 @@ void Metrics::logAcceptQueueDelay(const bsls::TimeInterval& acceptQueueDelay)
 
 void Metrics::logWriteQueueSize(bsl::size_t writeQueueSize)
 {
-    d_writeQueueSize.update(static_cast<double>(writeQueueSize));
+    this->update(&Accumulator::d_writeQueueSize,
+                 static_cast<double>(writeQueueSize));
 
     if (d_parent_sp) {
         d_parent_sp->logWriteQueueSize(writeQueueSize);
@@ -289,7 +406,8 @@ void Metrics::logWriteQueueSize(bsl::size_t writeQueueSize)
 
 void Metrics::logWriteQueueDelay(const bsls::TimeInterval& writeQueueDelay)
 {
-    d_writeQueueDelay.update(writeQueueDelay.totalSecondsAsDouble());
+    this->update(&Accumulator::d_writeQueueDelay,
+                 writeQueueDelay.totalSecondsAsDouble());
 
     if (d_parent_sp) {
         d_parent_sp->logWriteQueueDelay(writeQueueDelay);
@@ -298,7 +416,8 @@ void Metrics::logWriteQueueDelay(const bsls::TimeInterval& writeQueueDelay)
 
 void Metrics::logReadQueueSize(bsl::size_t readQueueSize)
 {
-    d_readQueueSize.update(static_cast<double>(readQueueSize));
+    this->update(&Accumulator::d_readQueueSize,
+                 static_cast<double>(readQueueSize));
 
     if (d_parent_sp) {
         d_parent_sp->logReadQueueSize(readQueueSize);
@@ -307,7 +426,8 @@ void Metrics::logReadQueueSize(bsl::size_t readQueueSize)
 
 void Metrics::logReadQueueDelay(const bsls::TimeInterval& readQueueDelay)
 {
-    d_readQueueDelay.update(readQueueDelay.totalSecondsAsDouble());
+    this->update(&Accumulator::d_readQueueDelay,
+                 readQueueDelay.totalSecondsAsDouble());
 
     if (d_parent_sp) {
         d_parent_sp->logReadQueueDelay(readQueueDelay);
@@ -316,7 +436,8 @@ void Metrics::logReadQueueDelay(const bsls::TimeInterval& readQueueDelay)
 
 void Metrics::logBlobBufferAllocation(bsl::size_t blobBufferCapacity)
 {
-    d_numBytesAllocated.update(static_cast<double>(blobBufferCapacity));
+    this->update(&Accumulator::d_numBytesAllocated,
+                 static_cast<double>(blobBufferCapacity));
 
     if (d_parent_sp) {
         d_parent_sp->logBlobBufferAllocation(blobBufferCapacity);
@@ -326,7 +447,8 @@ void Metrics::logBlobBufferAllocation(bsl::size_t blobBufferCapacity)
 void Metrics::logTxDelayBeforeScheduling(
     const bsls::TimeInterval& txDelayBeforeScheduling)
 {
-    d_txDelayBeforeScheduling.update(
+    this->update(
+        &Accumulator::d_txDelayBeforeScheduling,
         static_cast<double>(txDelayBeforeScheduling.totalMicroseconds()));
 
     if (d_parent_sp) {
@@ -336,8 +458,8 @@ void Metrics::logTxDelayBeforeScheduling(
 
 void Metrics::logTxDelayInSoftware(const bsls::TimeInterval& txDelayInSoftware)
 {
-    d_txDelayInSoftware.update(
-        static_cast<double>(txDelayInSoftware.totalMicroseconds()));
+    this->update(&Accumulator::d_txDelayInSoftware,
+                 static_cast<double>(txDelayInSoftware.totalMicroseconds()));
 
     if (d_parent_sp) {
         d_parent_sp->logTxDelayInSoftware(txDelayInSoftware);
@@ -346,7 +468,8 @@ void Metrics::logTxDelayInSoftware(const bsls::TimeInterval& txDelayInSoftware)
 
 void Metrics::logTxDelay(const bsls::TimeInterval& txDelay)
 {
-    d_txDelay.update(static_cast<double>(txDelay.totalMicroseconds()));
+    this->update(&Accumulator::d_txDelay,
+                 static_cast<double>(txDelay.totalMicroseconds()));
 
     if (d_parent_sp) {
         d_parent_sp->logTxDelay(txDelay);
@@ -356,7 +479,8 @@ void Metrics::logTxDelay(const bsls::TimeInterval& txDelay)
 void Metrics::logTxDelayBeforeAcknowledgement(
     const bsls::TimeInterval& txDelayBeforeAcknowledgement)
 {
-    d_txDelayBeforeAcknowledgement.update(
+    this->update(
+        &Accumulator::d_txDelayBeforeAcknowledgement,
         static_cast<double>(txDelayBeforeAcknowledgement.totalMicroseconds()));
 
     if (d_parent_sp) {
@@ -367,8 +491,8 @@ void Metrics::logTxDelayBeforeAcknowledgement(
 
 void Metrics::logRxDelayInHardware(const bsls::TimeInterval& rxDelayInHardware)
 {
-    d_rxDelayInHardware.update(
-        static_cast<double>(rxDelayInHardware.totalMicroseconds()));
+    this->update(&Accumulator::d_rxDelayInHardware,
+                 static_cast<double>(rxDelayInHardware.totalMicroseconds()));
 
     if (d_parent_sp) {
         d_parent_sp->logRxDelay(rxDelayInHardware);
@@ -377,7 +501,8 @@ void Metrics::logRxDelayInHardware(const bsls::TimeInterval& rxDelayInHardware)
 
 void Metrics::logRxDelay(const bsls::TimeInterval& rxDelay)
 {
-    d_rxDelay.update(static_cast<double>(rxDelay.totalMicroseconds()));
+    this->update(&Accumulator::d_rxDelay,
+                 static_cast<double>(rxDelay.totalMicroseconds()));
 
     if (d_parent_sp) {
         d_parent_sp->logRxDelay(rxDelay);
@@ -395,41 +520,53 @@ void Metrics::getStats(bdld::ManagedDatum* result)
 
     bsl::size_t index = 0;
 
-    d_numBytesSendable.collectSummary(&array, &index);
-    d_numBytesSent.collectSummary(&array, &index);
+    this->collectSummary(&array, &index, &Accumulator::d_numBytesSendable);
+    this->collectSummary(&array, &index, &Accumulator::d_numBytesSent);
 
-    d_numBytesReceivable.collectSummary(&array, &index);
-    d_numBytesReceived.collectSummary(&array, &index);
+    this->collectSummary(&array, &index, &Accumulator::d_numBytesReceivable);
+    this->collectSummary(&array, &index, &Accumulator::d_numBytesReceived);
 
-    d_numAcceptIterations.collectSummary(&array, &index);
-    d_numSendIterations.collectSummary(&array, &index);
-    d_numReceiveIterations.collectSummary(&array, &index);
+    this->collectSummary(&array, &index, &Accumulator::d_numAcceptIterations);
+    this->collectSummary(&array, &index, &Accumulator::d_numSendIterations);
+    this->collectSummary(&array, &index, &Accumulator::d_numReceiveIterations);
 
-    d_acceptQueueSize.collectSummary(&array, &index);
-    d_acceptQueueDelay.collectSummary(&array, &index);
+    this->collectSummary(&array, &index, &Accumulator::d_acceptQueueSize);
+    this->collectSummary(&array, &index, &Accumulator::d_acceptQueueDelay);
 
-    d_writeQueueSize.collectSummary(&array, &index);
-    d_writeQueueDelay.collectSummary(&array, &index);
+    this->collectSummary(&array, &index, &Accumulator::d_writeQueueSize);
+    this->collectDistribution(&array, &index, &Accumulator::d_writeQueueDelay);
 
-    d_readQueueSize.collectSummary(&array, &index);
-    d_readQueueDelay.collectSummary(&array, &index);
+    this->collectSummary(&array, &index, &Accumulator::d_readQueueSize);
+    this->collectDistribution(&array, &index, &Accumulator::d_readQueueDelay);
 
-    d_numConnectionsAccepted.collectSummary(&array, &index);
+    this->collectSummary(&array,
+                         &index,
+                         &Accumulator::d_numConnectionsAccepted);
 
-    d_numConnectionsUnacceptable.collectSummary(&array, &index);
+    this->collectSummary(&array,
+                         &index,
+                         &Accumulator::d_numConnectionsUnacceptable);
 
-    d_numConnectionsSynchronized.collectSummary(&array, &index);
+    this->collectSummary(&array,
+                         &index,
+                         &Accumulator::d_numConnectionsSynchronized);
 
-    d_numConnectionsUnsynchronizable.collectSummary(&array, &index);
+    this->collectSummary(&array,
+                         &index,
+                         &Accumulator::d_numConnectionsUnsynchronizable);
 
-    d_numBytesAllocated.collectSummary(&array, &index);
+    this->collectSummary(&array, &index, &Accumulator::d_numBytesAllocated);
 
-    d_txDelayBeforeScheduling.collectSummary(&array, &index);
-    d_txDelayInSoftware.collectSummary(&array, &index);
-    d_txDelay.collectSummary(&array, &index);
-    d_txDelayBeforeAcknowledgement.collectSummary(&array, &index);
-    d_rxDelayInHardware.collectSummary(&array, &index);
-    d_rxDelay.collectSummary(&array, &index);
+    this->collectSummary(&array,
+                         &index,
+                         &Accumulator::d_txDelayBeforeScheduling);
+    this->collectSummary(&array, &index, &Accumulator::d_txDelayInSoftware);
+    this->collectDistribution(&array, &index, &Accumulator::d_txDelay);
+    this->collectSummary(&array,
+                         &index,
+                         &Accumulator::d_txDelayBeforeAcknowledgement);
+    this->collectSummary(&array, &index, &Accumulator::d_rxDelayInHardware);
+    this->collectDistribution(&array, &index, &Accumulator::d_rxDelay);
 
     // TODO: Calculate and publish derivative metrics.
     // double avgBytesSentPerEvent = 0;
@@ -509,6 +646,22 @@ const bsl::shared_ptr<ntcs::Metrics>& Metrics::parent() const
     return d_parent_sp;
 }
 
+void Metrics::attachThread(bsl::size_t threadIndex)
+{
+    // Store the thread index biased by one so that a null value indicates no
+    // thread index has been assigned.
+
+    int rc = bslmt::ThreadUtil::setSpecific(
+        s_threadIndexKey,
+        reinterpret_cast<const void*>(
+            static_cast<bsl::uintptr_t>(threadIndex) + 1));
+    BSLS_ASSERT_OPT(rc == 0);
+
+    rc = bslmt::ThreadUtil::setSpecific(s_ownerKey,
+                                        static_cast<const void*>(this));
+    BSLS_ASSERT_OPT(rc == 0);
+}
+
 ntcs::Metrics* Metrics::setThreadLocal(ntcs::Metrics* metrics)
 {
     ntcs::Metrics* previous = reinterpret_cast<ntcs::Metrics*>(
@@ -56,7 +56,10 @@ const ntci::MetricMetadata ProactorMetrics::STATISTICS[] = {
     NTCI_METRIC_METADATA_SUMMARY(wakeupsSpurious),
     NTCI_METRIC_METADATA_SUMMARY(timeProcessingRead),
     NTCI_METRIC_METADATA_SUMMARY(timeProcessingWrite),
-    NTCI_METRIC_METADATA_SUMMARY(timeProcessingError)};
+    NTCI_METRIC_METADATA_SUMMARY(timeProcessingError),
+    NTCI_METRIC_METADATA_SUMMARY(submissionRetries),
+    NTCI_METRIC_METADATA_SUMMARY(submissionQueueFull),
+    NTCI_METRIC_METADATA_SUMMARY(submissionWakeups)};
 
 ProactorMetrics::ProactorMetrics(const bslstl::StringRef& prefix,
                                  const bslstl::StringRef& objectName,
@@ -71,6 +74,9 @@ ProactorMetrics::ProactorMetrics(const bslstl::StringRef& prefix,
 , d_readProcessingTime()
 , d_writeProcessingTime()
 , d_errorProcessingTime()
+, d_numSubmissionRetries()
+, d_numSubmissionQueueFull()
+, d_numSubmissionWakeups()
 , d_prefix(prefix, basicAllocator)
 , d_objectName(objectName, basicAllocator)
 , d_parent_sp()
@@ -93,6 +99,9 @@ ProactorMetrics::ProactorMetrics(
 , d_readProcessingTime()
 , d_writeProcessingTime()
 , d_errorProcessingTime()
+, d_numSubmissionRetries()
+, d_numSubmissionQueueFull()
+, d_numSubmissionWakeups()
 , d_prefix(basicAllocator)
 , d_objectName(basicAllocator)
 , d_parent_sp(parent)
@@ -182,6 +191,19 @@ void ProactorMetrics::logErrorCallback(const bsls::TimeInterval& duration)
     }
 }
 
+void ProactorMetrics::logSubmissionContention(bsl::size_t numRetries,
+                                              bsl::size_t numFull,
+                                              bsl::size_t numWakeups)
+{
+    d_numSubmissionRetries.update(static_cast<double>(numRetries));
+    d_numSubmissionQueueFull.update(static_cast<double>(numFull));
+    d_numSubmissionWakeups.update(static_cast<double>(numWakeups));
+
+    if (d_parent_sp) {
+        d_parent_sp->logSubmissionContention(numRetries, numFull, numWakeups);
+    }
+}
+
 void ProactorMetrics::getStats(bdld::ManagedDatum* result)
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
@@ -211,6 +233,12 @@ void ProactorMetrics::getStats(bdld::ManagedDatum* result)
 
     d_errorProcessingTime.collectSummary(&array, &index);
 
+    d_numSubmissionRetries.collectSummary(&array, &index);
+
+    d_numSubmissionQueueFull.collectSummary(&array, &index);
+
+    d_numSubmissionWakeups.collectSummary(&array, &index);
+
     *array.length() = numOrdinals();
 
     result->adopt(bdld::Datum::adoptArray(array));
@@ -55,6 +55,9 @@ class ProactorMetrics : public ntci::ProactorMetrics,
     ntci::Metric                           d_readProcessingTime;
     ntci::Metric                           d_writeProcessingTime;
     ntci::Metric                           d_errorProcessingTime;
+    ntci::Metric                           d_numSubmissionRetries;
+    ntci::Metric                           d_numSubmissionQueueFull;
+    ntci::Metric                           d_numSubmissionWakeups;
     bsl::string                            d_prefix;
     bsl::string                            d_objectName;
     bsl::shared_ptr<ntci::ProactorMetrics> d_parent_sp;
@@ -124,6 +127,15 @@ class ProactorMetrics : public ntci::ProactorMetrics,
     void logErrorCallback(const bsls::TimeInterval& duration)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Log the specified 'numRetries' attempts to reserve an entry in the
+    /// submission queue that had to be retried because another thread
+    /// reserved or published an entry concurrently, the specified 'numFull'
+    /// encounters of a full submission queue, and the specified
+    /// 'numWakeups' wakeups of a kernel thread polling the submission queue.
+    void logSubmissionContention(bsl::size_t numRetries,
+                                 bsl::size_t numFull,
+                                 bsl::size_t numWakeups) BSLS_KEYWORD_OVERRIDE;
+
     /// Load into the specified 'result' the array of statistics from the
     /// specified 'snapshot' for this object based on the specified
     /// 'operation': if 'operation' is e_CUMULATIVE then the statistics are
@@ -262,6 +274,12 @@ ProactorMetricsGuard::~ProactorMetricsGuard()
         metrics->logSpuriousWakeup();                                         \
     }
 
+#define NTCS_PROACTORMETRICS_UPDATE_SUBMISSION_CONTENTION(                    \
+    numRetries, numFull, numWakeups)                                          \
+    if (metrics) {                                                            \
+        metrics->logSubmissionContention(numRetries, numFull, numWakeups);    \
+    }
+
 #define NTCS_PROACTORMETRICS_UPDATE_ERROR_CALLBACK_TIME_BEGIN()               \
     bsl::int64_t errorProcessingStartTime;                                    \
     if (metrics) {                                                            \
@@ -326,6 +344,8 @@ ProactorMetricsGuard::~ProactorMetricsGuard()
 #define NTCS_PROACTORMETRICS_UPDATE_POLL(numReadable, numWritable, numErrors)
 #define NTCS_PROACTORMETRICS_UPDATE_DEFERRED_SOCKET()
 #define NTCS_PROACTORMETRICS_UPDATE_SPURIOUS_WAKEUP()
+#define NTCS_PROACTORMETRICS_UPDATE_SUBMISSION_CONTENTION(                    \
+    numRetries, numFull, numWakeups)
 #define NTCS_PROACTORMETRICS_UPDATE_ERROR_CALLBACK_TIME_BEGIN()
 #define NTCS_PROACTORMETRICS_UPDATE_ERROR_CALLBACK_TIME_END()
 #define NTCS_PROACTORMETRICS_UPDATE_WRITE_CALLBACK_TIME_BEGIN()
@@ -54,9 +54,11 @@ const ntci::MetricMetadata ReactorMetrics::STATISTICS[] = {
     NTCI_METRIC_METADATA_SUMMARY(socketsFailed),
     NTCI_METRIC_METADATA_SUMMARY(socketsDeferred),
     NTCI_METRIC_METADATA_SUMMARY(wakeupsSpurious),
-    NTCI_METRIC_METADATA_SUMMARY(timeProcessingReadability),
-    NTCI_METRIC_METADATA_SUMMARY(timeProcessingWritability),
-    NTCI_METRIC_METADATA_SUMMARY(timeProcessingError)};
+    NTCI_METRIC_METADATA_DISTRIBUTION(timeProcessingReadability),
+    NTCI_METRIC_METADATA_DISTRIBUTION(timeProcessingWritability),
+    NTCI_METRIC_METADATA_DISTRIBUTION(timeProcessingError),
+    NTCI_METRIC_METADATA_SUMMARY(interestUpdates),
+    NTCI_METRIC_METADATA_SUMMARY(interestUpdatesCoalesced)};
 
 ReactorMetrics::ReactorMetrics(const bslstl::StringRef& prefix,
                                const bslstl::StringRef& objectName,
@@ -71,6 +73,8 @@ ReactorMetrics::ReactorMetrics(const bslstl::StringRef& prefix,
 , d_readProcessingTime()
 , d_writeProcessingTime()
 , d_errorProcessingTime()
+, d_numInterestUpdates()
+, d_numInterestUpdatesCoalesced()
 , d_prefix(prefix, basicAllocator)
 , d_objectName(objectName, basicAllocator)
 , d_parent_sp()
@@ -93,6 +97,8 @@ ReactorMetrics::ReactorMetrics(
 , d_readProcessingTime()
 , d_writeProcessingTime()
 , d_errorProcessingTime()
+, d_numInterestUpdates()
+, d_numInterestUpdatesCoalesced()
 , d_prefix(basicAllocator)
 , d_objectName(basicAllocator)
 , d_parent_sp(parent)
@@ -182,6 +188,20 @@ void ReactorMetrics::logErrorCallback(const bsls::TimeInterval& duration)
     }
 }
 
+void ReactorMetrics::logInterestUpdates(bsl::size_t numUpdates,
+                                        bsl::size_t numApplied)
+{
+    BSLS_ASSERT(numApplied <= numUpdates);
+
+    d_numInterestUpdates.update(static_cast<double>(numUpdates));
+    d_numInterestUpdatesCoalesced.update(
+        static_cast<double>(numUpdates - numApplied));
+
+    if (d_parent_sp) {
+        d_parent_sp->logInterestUpdates(numUpdates, numApplied);
+    }
+}
+
 void ReactorMetrics::getStats(bdld::ManagedDatum* result)
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
@@ -205,11 +225,15 @@ void ReactorMetrics::getStats(bdld::ManagedDatum* result)
 
     d_numWakeupsSpurious.collectSummary(&array, &index);
 
-    d_readProcessingTime.collectSummary(&array, &index);
+    d_readProcessingTime.collectDistribution(&array, &index);
+
+    d_writeProcessingTime.collectDistribution(&array, &index);
+
+    d_errorProcessingTime.collectDistribution(&array, &index);
 
-    d_writeProcessingTime.collectSummary(&array, &index);
+    d_numInterestUpdates.collectSummary(&array, &index);
 
-    d_errorProcessingTime.collectSummary(&array, &index);
+    d_numInterestUpdatesCoalesced.collectSummary(&array, &index);
 
     *array.length() = numOrdinals();
 
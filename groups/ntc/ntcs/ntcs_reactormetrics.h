@@ -52,9 +52,11 @@ class ReactorMetrics : public ntci::ReactorMetrics,
     ntci::Metric                          d_numErrorsPerPoll;
     ntci::Metric                          d_numSocketsDeferred;
     ntci::Metric                          d_numWakeupsSpurious;
-    ntci::Metric                          d_readProcessingTime;
-    ntci::Metric                          d_writeProcessingTime;
-    ntci::Metric                          d_errorProcessingTime;
+    ntci::MetricHistogram                 d_readProcessingTime;
+    ntci::MetricHistogram                 d_writeProcessingTime;
+    ntci::MetricHistogram                 d_errorProcessingTime;
+    ntci::Metric                          d_numInterestUpdates;
+    ntci::Metric                          d_numInterestUpdatesCoalesced;
     bsl::string                           d_prefix;
     bsl::string                           d_objectName;
     bsl::shared_ptr<ntci::ReactorMetrics> d_parent_sp;
@@ -124,6 +126,13 @@ class ReactorMetrics : public ntci::ReactorMetrics,
     void logErrorCallback(const bsls::TimeInterval& duration)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Log the application of the specified 'numUpdates' changes in the
+    /// interest of sockets to the polling device using the specified
+    /// 'numApplied' system calls, i.e., saving 'numUpdates - numApplied'
+    /// system calls by coalescing redundant changes.
+    void logInterestUpdates(bsl::size_t numUpdates,
+                            bsl::size_t numApplied) BSLS_KEYWORD_OVERRIDE;
+
     /// Load into the specified 'result' the array of statistics from the
     /// specified 'snapshot' for this object based on the specified
     /// 'operation': if 'operation' is e_CUMULATIVE then the statistics are
@@ -261,6 +270,11 @@ ReactorMetricsGuard::~ReactorMetricsGuard()
         metrics->logSpuriousWakeup();                                         \
     }
 
+#define NTCS_METRICS_UPDATE_INTEREST(numUpdates, numApplied)                 \
+    if (metrics) {                                                            \
+        metrics->logInterestUpdates(numUpdates, numApplied);                  \
+    }
+
 #define NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_BEGIN()                       \
     bsl::int64_t errorProcessingStartTime;                                    \
     if (metrics) {                                                            \
@@ -325,6 +339,7 @@ ReactorMetricsGuard::~ReactorMetricsGuard()
 #define NTCS_METRICS_UPDATE_POLL(numReadable, numWritable, numErrors)
 #define NTCS_METRICS_UPDATE_DEFERRED_SOCKET()
 #define NTCS_METRICS_UPDATE_SPURIOUS_WAKEUP()
+#define NTCS_METRICS_UPDATE_INTEREST(numUpdates, numApplied)
 #define NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_BEGIN()
 #define NTCS_METRICS_UPDATE_ERROR_CALLBACK_TIME_END()
 #define NTCS_METRICS_UPDATE_WRITE_CALLBACK_TIME_BEGIN()
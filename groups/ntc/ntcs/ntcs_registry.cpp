@@ -42,7 +42,7 @@ RegistryEntry::RegistryEntry(
 , d_handle(reactorSocket->handle())
 , d_interest(trigger, oneShot)
 , d_reactorSocket_sp(reactorSocket)
-, d_reactorSocketStrand_sp(reactorSocket->strand())
+, d_reactorSocketStrand_sp(reactorSocket->reactorStrand())
 , d_readableCallback(basicAllocator)
 , d_writableCallback(basicAllocator)
 , d_errorCallback(basicAllocator)
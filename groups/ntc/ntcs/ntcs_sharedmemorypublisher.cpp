@@ -0,0 +1,768 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_sharedmemorypublisher.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntcs_sharedmemorypublisher_cpp, "$Id$ $CSID$")
+
+#include <ntcs_memorymap.h>
+
+#include <bdld_datum.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_threadutil.h>
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_platform.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+#include <bsl_limits.h>
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#include <intrin.h>
+#endif
+
+namespace BloombergLP {
+namespace ntcs {
+
+namespace {
+
+/// Describe the header at the beginning of a shared memory metrics file.
+struct Header {
+    bsl::uint32_t                               magic;
+    bsl::uint32_t                               version;
+    bsls::AtomicOperations::AtomicTypes::Uint64 sequence;
+    bsl::int64_t                                time;
+    bsl::uint32_t                               numObjects;
+    bsl::uint32_t                               maxObjects;
+    bsl::uint32_t                               numValues;
+    bsl::uint32_t                               maxValues;
+    bsl::uint32_t                               schemaSize;
+    bsl::uint32_t                               schemaCapacity;
+    bsl::uint32_t                               numDropped;
+    bsl::uint32_t                               reserved;
+    bsl::uint64_t                               objectsOffset;
+    bsl::uint64_t                               valuesOffset;
+    bsl::uint64_t                               schemaOffset;
+};
+
+/// Describe a monitorable object in a shared memory metrics file.
+struct Object {
+    bsl::uint32_t schemaOffset;
+    bsl::uint32_t numValues;
+    bsl::uint32_t valueIndex;
+    bsl::int32_t  objectId;
+    char          objectName[SharedMemoryPublisher::k_MAX_OBJECT_NAME_SIZE];
+};
+
+/// Prevent loads that precede this call from being reordered after any
+/// load or store that follows it.
+inline void acquireFence()
+{
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+#elif defined(BSLS_PLATFORM_CMP_MSVC)
+#if defined(_M_ARM64)
+    __dmb(_ARM64_BARRIER_ISHLD);
+#else
+    _ReadWriteBarrier();
+#endif
+#else
+    bsls::AtomicOperations::AtomicTypes::Int fence;
+    bsls::AtomicOperations::initInt(&fence, 0);
+    bsls::AtomicOperations::addIntAcqRel(&fence, 0);
+#endif
+}
+
+/// Return the specified 'size' rounded up to the nearest multiple of eight.
+bsl::size_t align(bsl::size_t size)
+{
+    return (size + 7) & ~static_cast<bsl::size_t>(7);
+}
+
+/// Return the number of bytes required to store the specified 'string'
+/// and its NUL terminator.
+bsl::uint32_t sizeOf(const char* string)
+{
+    return static_cast<bsl::uint32_t>((string ? bsl::strlen(string) : 0) + 1);
+}
+
+/// Return the number of bytes required to store a field in a schema whose
+/// prefix and name require the specified 'prefixSize' and 'nameSize' bytes,
+/// respectively.
+bsl::size_t fieldSize(bsl::uint32_t prefixSize, bsl::uint32_t nameSize)
+{
+    return 3 * sizeof(bsl::uint32_t) + ((prefixSize + nameSize + 3) & ~3U);
+}
+
+/// Return the raw value of the specified 'datum', or NaN if the 'datum' is
+/// null or not numeric.
+double valueOf(const bdld::Datum& datum)
+{
+    if (datum.isDouble()) {
+        return datum.theDouble();
+    }
+    else if (datum.isInteger64()) {
+        return static_cast<double>(datum.theInteger64());
+    }
+    else if (datum.isInteger()) {
+        return static_cast<double>(datum.theInteger());
+    }
+    else {
+        return bsl::numeric_limits<double>::quiet_NaN();
+    }
+}
+
+/// Load into the specified 'result' the 32-bit integer at the specified
+/// 'offset' within the specified 'schema' having the specified 'size'.
+/// Return true if the integer lies within the schema, otherwise return
+/// false.
+bool readUint32(bsl::uint32_t* result,
+                const char*    schema,
+                bsl::size_t    size,
+                bsl::size_t    offset)
+{
+    if (offset + sizeof(bsl::uint32_t) > size) {
+        return false;
+    }
+
+    bsl::memcpy(result, schema + offset, sizeof(bsl::uint32_t));
+    return true;
+}
+
+}  // close unnamed namespace
+
+/// Describe the fields of a schema cached by a shared memory publisher.
+struct SharedMemoryPublisher::Schema {
+    bsl::uint32_t            offset;
+    bsl::vector<bsl::string> prefixes;
+    bsl::vector<bsl::string> names;
+    bsl::vector<int>         types;
+
+    explicit Schema(bslma::Allocator* basicAllocator)
+    : offset(0)
+    , prefixes(basicAllocator)
+    , names(basicAllocator)
+    , types(basicAllocator)
+    {
+    }
+};
+
+SharedMemoryRecord::SharedMemoryRecord(bslma::Allocator* basicAllocator)
+: d_objectId(0)
+, d_objectName(basicAllocator)
+, d_prefix(basicAllocator)
+, d_name(basicAllocator)
+, d_value(0)
+, d_type(ntci::Monitorable::e_AVERAGE)
+{
+}
+
+SharedMemoryRecord::SharedMemoryRecord(const SharedMemoryRecord& original,
+                                       bslma::Allocator* basicAllocator)
+: d_objectId(original.d_objectId)
+, d_objectName(original.d_objectName, basicAllocator)
+, d_prefix(original.d_prefix, basicAllocator)
+, d_name(original.d_name, basicAllocator)
+, d_value(original.d_value)
+, d_type(original.d_type)
+{
+}
+
+SharedMemoryRecord::~SharedMemoryRecord()
+{
+}
+
+SharedMemoryRecord& SharedMemoryRecord::operator=(
+    const SharedMemoryRecord& other)
+{
+    if (this != &other) {
+        d_objectId   = other.d_objectId;
+        d_objectName = other.d_objectName;
+        d_prefix     = other.d_prefix;
+        d_name       = other.d_name;
+        d_value      = other.d_value;
+        d_type       = other.d_type;
+    }
+
+    return *this;
+}
+
+void SharedMemoryRecord::setObjectId(int objectId)
+{
+    d_objectId = objectId;
+}
+
+void SharedMemoryRecord::setObjectName(const bsl::string& objectName)
+{
+    d_objectName = objectName;
+}
+
+void SharedMemoryRecord::setPrefix(const bsl::string& prefix)
+{
+    d_prefix = prefix;
+}
+
+void SharedMemoryRecord::setName(const bsl::string& name)
+{
+    d_name = name;
+}
+
+void SharedMemoryRecord::setValue(double value)
+{
+    d_value = value;
+}
+
+void SharedMemoryRecord::setType(ntci::Monitorable::StatisticType type)
+{
+    d_type = type;
+}
+
+int SharedMemoryRecord::objectId() const
+{
+    return d_objectId;
+}
+
+const bsl::string& SharedMemoryRecord::objectName() const
+{
+    return d_objectName;
+}
+
+const bsl::string& SharedMemoryRecord::prefix() const
+{
+    return d_prefix;
+}
+
+const bsl::string& SharedMemoryRecord::name() const
+{
+    return d_name;
+}
+
+double SharedMemoryRecord::value() const
+{
+    return d_value;
+}
+
+ntci::Monitorable::StatisticType SharedMemoryRecord::type() const
+{
+    return d_type;
+}
+
+bsls::Types::Int64 SharedMemoryPublisher::resolveSchema(
+    const bsl::shared_ptr<ntci::Monitorable>& monitorable,
+    bsl::size_t                               numFields)
+{
+    // Find a previously-written schema whose fields match the fields of the
+    // monitorable object. Note that comparing field names is the only cost
+    // incurred for each object in each sample: the schema itself is written
+    // once.
+
+    for (SchemaVector::const_iterator it = d_schemas.begin();
+         it != d_schemas.end();
+         ++it)
+    {
+        const Schema& schema = **it;
+
+        if (schema.names.size() != numFields) {
+            continue;
+        }
+
+        bool match = true;
+        for (bsl::size_t i = 0; i < numFields; ++i) {
+            const int ordinal = static_cast<int>(i);
+
+            const char* name = monitorable->getFieldName(ordinal);
+            if (schema.names[i] != (name ? name : "")) {
+                match = false;
+                break;
+            }
+
+            const char* prefix = monitorable->getFieldPrefix(ordinal);
+            if (schema.prefixes[i] != (prefix ? prefix : "")) {
+                match = false;
+                break;
+            }
+
+            if (schema.types[i] !=
+                static_cast<int>(monitorable->getFieldType(ordinal)))
+            {
+                match = false;
+                break;
+            }
+        }
+
+        if (match) {
+            return static_cast<bsls::Types::Int64>(schema.offset);
+        }
+    }
+
+    // Append a new schema to the schema section, if it fits.
+
+    Header* header = reinterpret_cast<Header*>(d_address_p);
+
+    bsl::size_t size = sizeof(bsl::uint32_t);
+    for (bsl::size_t i = 0; i < numFields; ++i) {
+        const int ordinal = static_cast<int>(i);
+        size += fieldSize(sizeOf(monitorable->getFieldPrefix(ordinal)),
+                          sizeOf(monitorable->getFieldName(ordinal)));
+    }
+
+    if (header->schemaSize + size > header->schemaCapacity) {
+        return -1;
+    }
+
+    bsl::shared_ptr<Schema> schema;
+    schema.createInplace(d_allocator_p, d_allocator_p);
+
+    schema->offset = header->schemaSize;
+
+    char* target = d_address_p + header->schemaOffset + header->schemaSize;
+    bsl::memset(target, 0, size);
+
+    const bsl::uint32_t count = static_cast<bsl::uint32_t>(numFields);
+    bsl::memcpy(target, &count, sizeof count);
+    target += sizeof count;
+
+    for (bsl::size_t i = 0; i < numFields; ++i) {
+        const int ordinal = static_cast<int>(i);
+
+        const char* prefix = monitorable->getFieldPrefix(ordinal);
+        const char* name   = monitorable->getFieldName(ordinal);
+
+        if (prefix == 0) {
+            prefix = "";
+        }
+
+        if (name == 0) {
+            name = "";
+        }
+
+        const bsl::uint32_t type =
+            static_cast<bsl::uint32_t>(monitorable->getFieldType(ordinal));
+        const bsl::uint32_t prefixSize = sizeOf(prefix);
+        const bsl::uint32_t nameSize   = sizeOf(name);
+
+        bsl::memcpy(target, &type, sizeof type);
+        target += sizeof type;
+        bsl::memcpy(target, &prefixSize, sizeof prefixSize);
+        target += sizeof prefixSize;
+        bsl::memcpy(target, &nameSize, sizeof nameSize);
+        target += sizeof nameSize;
+
+        bsl::memcpy(target, prefix, prefixSize);
+        bsl::memcpy(target + prefixSize, name, nameSize);
+        target += (prefixSize + nameSize + 3) & ~3U;
+
+        schema->prefixes.push_back(prefix);
+        schema->names.push_back(name);
+        schema->types.push_back(static_cast<int>(type));
+    }
+
+    header->schemaSize += static_cast<bsl::uint32_t>(size);
+
+    d_schemas.push_back(schema);
+
+    return static_cast<bsls::Types::Int64>(schema->offset);
+}
+
+SharedMemoryPublisher::SharedMemoryPublisher(bslma::Allocator* basicAllocator)
+: d_mutex()
+, d_address_p(0)
+, d_size(0)
+, d_schemas(basicAllocator)
+, d_writing(false)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+SharedMemoryPublisher::~SharedMemoryPublisher()
+{
+    this->close();
+}
+
+ntsa::Error SharedMemoryPublisher::open(const bsl::string& path)
+{
+    return this->open(path,
+                      k_DEFAULT_MAX_OBJECTS,
+                      k_DEFAULT_MAX_VALUES,
+                      k_DEFAULT_SCHEMA_CAPACITY);
+}
+
+ntsa::Error SharedMemoryPublisher::open(const bsl::string& path,
+                                        bsl::size_t        maxObjects,
+                                        bsl::size_t        maxValues,
+                                        bsl::size_t        schemaCapacity)
+{
+    const bsl::size_t k_MAX_COUNT = bsl::numeric_limits<bsl::uint32_t>::max();
+
+    if (maxObjects > k_MAX_COUNT || maxValues > k_MAX_COUNT ||
+        schemaCapacity > k_MAX_COUNT)
+    {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (d_address_p != 0) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    const bsl::size_t objectsOffset = align(sizeof(Header));
+    const bsl::size_t valuesOffset =
+        align(objectsOffset + maxObjects * sizeof(Object));
+    const bsl::size_t schemaOffset =
+        align(valuesOffset + maxValues * sizeof(double));
+    const bsl::size_t size = align(schemaOffset + schemaCapacity);
+
+    void*       address = 0;
+    ntsa::Error error =
+        ntcs::MemoryMap::create(&address, path.c_str(), size);
+    if (error) {
+        return error;
+    }
+
+    d_address_p = static_cast<char*>(address);
+    d_size      = size;
+    d_writing   = false;
+    d_schemas.clear();
+
+    // The file is zero-filled when created, so the sequence number is
+    // initially zero and readers observe an empty sample.
+
+    Header* header = reinterpret_cast<Header*>(d_address_p);
+
+    header->magic          = k_MAGIC;
+    header->version        = k_VERSION;
+    header->time           = 0;
+    header->numObjects     = 0;
+    header->maxObjects     = static_cast<bsl::uint32_t>(maxObjects);
+    header->numValues      = 0;
+    header->maxValues      = static_cast<bsl::uint32_t>(maxValues);
+    header->schemaSize     = 0;
+    header->schemaCapacity = static_cast<bsl::uint32_t>(schemaCapacity);
+    header->numDropped     = 0;
+    header->reserved       = 0;
+    header->objectsOffset  = objectsOffset;
+    header->valuesOffset   = valuesOffset;
+    header->schemaOffset   = schemaOffset;
+
+    bsls::AtomicOperations::setUint64Release(&header->sequence, 0);
+
+    return ntsa::Error();
+}
+
+void SharedMemoryPublisher::close()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (d_address_p == 0) {
+        return;
+    }
+
+    if (d_writing) {
+        Header* header = reinterpret_cast<Header*>(d_address_p);
+        bsls::AtomicOperations::addUint64AcqRel(&header->sequence, 1);
+        d_writing = false;
+    }
+
+    ntcs::MemoryMap::unmap(d_address_p, d_size);
+
+    d_address_p = 0;
+    d_size      = 0;
+    d_schemas.clear();
+}
+
+void SharedMemoryPublisher::publish(
+    const bsl::shared_ptr<ntci::Monitorable>& monitorable,
+    const bdld::Datum&                        statistics,
+    const bsls::TimeInterval&                 time,
+    bool                                      final)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (d_address_p == 0) {
+        return;
+    }
+
+    Header* header = reinterpret_cast<Header*>(d_address_p);
+
+    // Begin writing the sample when its first statistics are published: the
+    // sequence number remains odd until the final statistics of the sample
+    // are published.
+
+    if (!d_writing) {
+        bsls::AtomicOperations::addUint64AcqRel(&header->sequence, 1);
+
+        header->numObjects = 0;
+        header->numValues  = 0;
+        header->numDropped = 0;
+
+        d_writing = true;
+    }
+
+    if (statistics.isArray()) {
+        const bsl::size_t numFields = statistics.theArray().length();
+
+        bsls::Types::Int64 schemaOffset = -1;
+        if (header->numObjects < header->maxObjects &&
+            header->numValues + numFields <= header->maxValues)
+        {
+            schemaOffset = this->resolveSchema(monitorable, numFields);
+        }
+
+        if (schemaOffset >= 0) {
+            Object* object = reinterpret_cast<Object*>(
+                                 d_address_p + header->objectsOffset) +
+                             header->numObjects;
+
+            object->schemaOffset = static_cast<bsl::uint32_t>(schemaOffset);
+            object->numValues    = static_cast<bsl::uint32_t>(numFields);
+            object->valueIndex   = header->numValues;
+            object->objectId     = monitorable->objectId().value();
+
+            bsl::memset(object->objectName, 0, sizeof object->objectName);
+
+            const char* objectName = monitorable->objectName();
+            if (objectName != 0) {
+                bsl::strncpy(object->objectName,
+                             objectName,
+                             sizeof object->objectName - 1);
+            }
+
+            double* values =
+                reinterpret_cast<double*>(d_address_p + header->valuesOffset) +
+                header->numValues;
+
+            for (bsl::size_t i = 0; i < numFields; ++i) {
+                values[i] = valueOf(statistics.theArray().data()[i]);
+            }
+
+            header->numObjects += 1;
+            header->numValues  += static_cast<bsl::uint32_t>(numFields);
+        }
+        else {
+            header->numDropped += 1;
+        }
+    }
+
+    if (final) {
+        header->time = time.totalMicroseconds();
+        bsls::AtomicOperations::addUint64AcqRel(&header->sequence, 1);
+        d_writing = false;
+    }
+}
+
+SharedMemoryReader::SharedMemoryReader(bslma::Allocator* basicAllocator)
+: d_address_p(0)
+, d_size(0)
+, d_buffer(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+SharedMemoryReader::~SharedMemoryReader()
+{
+    this->close();
+}
+
+ntsa::Error SharedMemoryReader::open(const bsl::string& path)
+{
+    if (d_address_p != 0) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    void*       address = 0;
+    bsl::size_t size    = 0;
+    ntsa::Error error   = ntcs::MemoryMap::open(&address, &size, path.c_str());
+    if (error) {
+        return error;
+    }
+
+    if (size < sizeof(Header)) {
+        ntcs::MemoryMap::unmap(address, size);
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    d_address_p = static_cast<const char*>(address);
+    d_size      = size;
+
+    return ntsa::Error();
+}
+
+void SharedMemoryReader::close()
+{
+    if (d_address_p == 0) {
+        return;
+    }
+
+    ntcs::MemoryMap::unmap(const_cast<char*>(d_address_p), d_size);
+
+    d_address_p = 0;
+    d_size      = 0;
+}
+
+ntsa::Error SharedMemoryReader::read(bsl::vector<SharedMemoryRecord>* result,
+                                     bsls::TimeInterval*              time)
+{
+    result->clear();
+
+    if (d_address_p == 0) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    const Header* shared = reinterpret_cast<const Header*>(d_address_p);
+
+    Header header;
+
+    for (bsl::size_t attempt = 0; attempt < k_MAX_ATTEMPTS; ++attempt) {
+        const bsls::Types::Uint64 before =
+            bsls::AtomicOperations::getUint64Acquire(&shared->sequence);
+
+        if ((before & 1) != 0) {
+            bslmt::ThreadUtil::yield();
+            continue;
+        }
+
+        bsl::memcpy(&header, shared, sizeof header);
+
+        if (header.magic !=
+                static_cast<bsl::uint32_t>(SharedMemoryPublisher::k_MAGIC) ||
+            header.version !=
+                static_cast<bsl::uint32_t>(SharedMemoryPublisher::k_VERSION))
+        {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+
+        const bsl::size_t objectsSize =
+            static_cast<bsl::size_t>(header.numObjects) * sizeof(Object);
+        const bsl::size_t valuesSize =
+            static_cast<bsl::size_t>(header.numValues) * sizeof(double);
+        const bsl::size_t schemaSize = header.schemaSize;
+
+        bool valid = header.numObjects <= header.maxObjects &&
+                     header.numValues <= header.maxValues &&
+                     header.schemaSize <= header.schemaCapacity &&
+                     header.objectsOffset + objectsSize <= d_size &&
+                     header.valuesOffset + valuesSize <= d_size &&
+                     header.schemaOffset + schemaSize <= d_size;
+
+        if (valid) {
+            d_buffer.resize(objectsSize + valuesSize + schemaSize);
+
+            char* buffer = d_buffer.data();
+
+            bsl::memcpy(buffer,
+                        d_address_p + header.objectsOffset,
+                        objectsSize);
+            bsl::memcpy(buffer + objectsSize,
+                        d_address_p + header.valuesOffset,
+                        valuesSize);
+            bsl::memcpy(buffer + objectsSize + valuesSize,
+                        d_address_p + header.schemaOffset,
+                        schemaSize);
+        }
+
+        // The copies above are plain loads, which an acquire load of the
+        // sequence number does not order: without this fence the processor
+        // may satisfy them after the sequence number is re-read, so a torn
+        // copy of a concurrent update could be accepted as consistent.
+
+        acquireFence();
+
+        const bsls::Types::Uint64 after =
+            bsls::AtomicOperations::getUint64Acquire(&shared->sequence);
+
+        if (before != after) {
+            bslmt::ThreadUtil::yield();
+            continue;
+        }
+
+        if (!valid) {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+
+        // The copy is consistent: decode it.
+
+        const char* objects = d_buffer.data();
+        const char* values  = objects + objectsSize;
+        const char* schema  = values + valuesSize;
+
+        for (bsl::uint32_t i = 0; i < header.numObjects; ++i) {
+            Object object;
+            bsl::memcpy(&object, objects + i * sizeof(Object), sizeof object);
+            object.objectName[sizeof object.objectName - 1] = 0;
+
+            bsl::size_t   position  = object.schemaOffset;
+            bsl::uint32_t numFields = 0;
+            if (!readUint32(&numFields, schema, schemaSize, position) ||
+                numFields != object.numValues ||
+                static_cast<bsl::size_t>(object.valueIndex) + numFields >
+                    header.numValues)
+            {
+                return ntsa::Error(ntsa::Error::e_INVALID);
+            }
+
+            position += sizeof(bsl::uint32_t);
+
+            for (bsl::uint32_t j = 0; j < numFields; ++j) {
+                bsl::uint32_t type       = 0;
+                bsl::uint32_t prefixSize = 0;
+                bsl::uint32_t nameSize   = 0;
+
+                if (!readUint32(&type, schema, schemaSize, position) ||
+                    !readUint32(
+                        &prefixSize, schema, schemaSize, position + 4) ||
+                    !readUint32(
+                        &nameSize, schema, schemaSize, position + 8) ||
+                    prefixSize == 0 || nameSize == 0 ||
+                    position + fieldSize(prefixSize, nameSize) > schemaSize)
+                {
+                    return ntsa::Error(ntsa::Error::e_INVALID);
+                }
+
+                const char* prefix = schema + position + 12;
+                const char* name   = prefix + prefixSize;
+
+                double value = 0;
+                bsl::memcpy(&value,
+                            values + (object.valueIndex + j) * sizeof(double),
+                            sizeof value);
+
+                SharedMemoryRecord record(d_allocator_p);
+                record.setObjectId(object.objectId);
+                record.setObjectName(object.objectName);
+                record.setPrefix(bsl::string(prefix, prefixSize - 1));
+                record.setName(bsl::string(name, nameSize - 1));
+                record.setValue(value);
+                record.setType(
+                    static_cast<ntci::Monitorable::StatisticType>(type));
+
+                result->push_back(record);
+
+                position += fieldSize(prefixSize, nameSize);
+            }
+        }
+
+        time->setTotalMicroseconds(header.time);
+        return ntsa::Error();
+    }
+
+    return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,321 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCS_SHAREDMEMORYPUBLISHER
+#define INCLUDED_NTCS_SHAREDMEMORYPUBLISHER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_platform.h>
+#include <ntccfg_traits.h>
+#include <ntci_monitorable.h>
+#include <ntcscm_version.h>
+#include <ntsa_error.h>
+#include <bslmt_mutex.h>
+#include <bsls_keyword.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+#include <bsl_cstddef.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ntcs {
+
+/// @internal @brief
+/// Describe a statistic read from a shared memory metrics file.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntcs
+class SharedMemoryRecord
+{
+    int                              d_objectId;
+    bsl::string                      d_objectName;
+    bsl::string                      d_prefix;
+    bsl::string                      d_name;
+    double                           d_value;
+    ntci::Monitorable::StatisticType d_type;
+
+  public:
+    /// Create a new shared memory record. Optionally specify a
+    /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
+    /// the currently installed default allocator is used.
+    explicit SharedMemoryRecord(bslma::Allocator* basicAllocator = 0);
+
+    /// Create a new shared memory record having the same value as the
+    /// specified 'original' object. Optionally specify a 'basicAllocator'
+    /// used to supply memory. If 'basicAllocator' is 0, the currently
+    /// installed default allocator is used.
+    SharedMemoryRecord(const SharedMemoryRecord& original,
+                       bslma::Allocator*         basicAllocator = 0);
+
+    /// Destroy this object.
+    ~SharedMemoryRecord();
+
+    /// Assign the value of the specified 'other' object to this object.
+    /// Return a reference to this modifiable object.
+    SharedMemoryRecord& operator=(const SharedMemoryRecord& other);
+
+    /// Set the object ID of the monitorable object that published the
+    /// statistic to the specified 'objectId'.
+    void setObjectId(int objectId);
+
+    /// Set the object name of the monitorable object that published the
+    /// statistic to the specified 'objectName'.
+    void setObjectName(const bsl::string& objectName);
+
+    /// Set the prefix of the statistic to the specified 'prefix'.
+    void setPrefix(const bsl::string& prefix);
+
+    /// Set the name of the statistic to the specified 'name'.
+    void setName(const bsl::string& name);
+
+    /// Set the value of the statistic to the specified 'value'.
+    void setValue(double value);
+
+    /// Set the type of the statistic to the specified 'type'.
+    void setType(ntci::Monitorable::StatisticType type);
+
+    /// Return the object ID of the monitorable object that published the
+    /// statistic.
+    int objectId() const;
+
+    /// Return the object name of the monitorable object that published the
+    /// statistic.
+    const bsl::string& objectName() const;
+
+    /// Return the prefix of the statistic.
+    const bsl::string& prefix() const;
+
+    /// Return the name of the statistic.
+    const bsl::string& name() const;
+
+    /// Return the value of the statistic. Note that a statistic with no
+    /// measured value during the interval has a value of NaN.
+    double value() const;
+
+    /// Return the type of the statistic.
+    ntci::Monitorable::StatisticType type() const;
+
+    /// This type accepts an allocator argument to its constructors and may
+    /// dynamically allocate memory during its operation.
+    NTCCFG_DECLARE_NESTED_USES_ALLOCATOR_TRAITS(SharedMemoryRecord);
+};
+
+/// @internal @brief
+/// Provide a metrics publisher to a memory-mapped file.
+///
+/// @details
+/// This class implements the 'ntci::MonitorablePublisher' protocol by
+/// copying the raw value of each statistic into a file mapped into the
+/// virtual address space of the process, so that agents in other processes
+/// may sample the metrics of this process without this process formatting,
+/// logging, or transmitting anything. Each sample replaces the previous
+/// sample in the file. The file is protected by a sequence lock: the
+/// sequence number is odd while a sample is being written and even
+/// otherwise, so a reader that observes the same, even sequence number before
+/// and after copying the file has copied a consistent sample. Use
+/// 'ntcs::SharedMemoryReader' to read the file.
+///
+/// @par File Format
+/// All integers are stored in the native byte order of the publishing
+/// process. The file begins with a header, at offset zero, describing the
+/// location and size of three sections:
+///
+/// @li @b Header:
+/// The 32-bit magic number 0x4D43544E, the 32-bit format version, the
+/// 64-bit sequence number, the 64-bit time of the sample in microseconds
+/// since the Unix epoch, the 32-bit number and maximum number of objects,
+/// the 32-bit number and maximum number of values, the 32-bit size and
+/// capacity of the schema section, the 32-bit number of objects dropped from
+/// the sample because the file was full, 32 reserved bits, and finally the
+/// 64-bit offsets of the object, value, and schema sections.
+///
+/// @li @b Objects:
+/// An array of fixed-size entries, one for each monitorable object in the
+/// sample, each containing the 32-bit offset of its schema within the schema
+/// section, the 32-bit number of values, the 32-bit index of its first
+/// value, the 32-bit object ID, and the NUL-terminated object name.
+///
+/// @li @b Values:
+/// An array of 64-bit IEEE-754 doubles, NaN denoting a statistic with no
+/// measured value during the interval.
+///
+/// @li @b Schema:
+/// An append-only sequence of schemas, each containing the 32-bit number
+/// of fields followed, for each field, by the 32-bit statistic type, the
+/// 32-bit length of the prefix and name, including their NUL terminators,
+/// and the NUL-terminated prefix and name, padded to a multiple of four
+/// bytes. Monitorable objects whose fields have the same prefixes, names
+/// and types share the same schema, so the schema section is written once
+/// per type of monitorable object rather than once per sample.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntcs
+class SharedMemoryPublisher : public ntci::MonitorablePublisher
+{
+    /// Describe the fields of a schema cached by this publisher.
+    struct Schema;
+
+    /// Define a type alias for a vector of schemas.
+    typedef bsl::vector<bsl::shared_ptr<Schema> > SchemaVector;
+
+    bslmt::Mutex      d_mutex;
+    char*             d_address_p;
+    bsl::size_t       d_size;
+    SchemaVector      d_schemas;
+    bool              d_writing;
+    bslma::Allocator* d_allocator_p;
+
+  private:
+    SharedMemoryPublisher(const SharedMemoryPublisher&) BSLS_KEYWORD_DELETED;
+    SharedMemoryPublisher& operator=(const SharedMemoryPublisher&)
+        BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Return the offset of the schema of the fields of the specified
+    /// 'monitorable' object having the specified 'numFields' within the
+    /// schema section, writing the schema if it has not been previously
+    /// written, or a negative value if the schema section is full.
+    bsls::Types::Int64 resolveSchema(
+        const bsl::shared_ptr<ntci::Monitorable>& monitorable,
+        bsl::size_t                               numFields);
+
+  public:
+    enum {
+        /// The magic number at the beginning of the file.
+        k_MAGIC = 0x4D43544E,
+
+        /// The version of the file format.
+        k_VERSION = 1,
+
+        /// The maximum number of bytes of an object name, including its
+        /// NUL terminator.
+        k_MAX_OBJECT_NAME_SIZE = 112,
+
+        /// The default maximum number of objects in a sample.
+        k_DEFAULT_MAX_OBJECTS = 4096,
+
+        /// The default maximum number of values in a sample.
+        k_DEFAULT_MAX_VALUES = 524288,
+
+        /// The default capacity of the schema section, in bytes.
+        k_DEFAULT_SCHEMA_CAPACITY = 1048576
+    };
+
+    /// Create a new shared memory publisher. Optionally specify a
+    /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
+    /// the currently installed default allocator is used. Note that
+    /// statistics are not published until the publisher is opened.
+    explicit SharedMemoryPublisher(bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    virtual ~SharedMemoryPublisher();
+
+    /// Create the file at the specified 'path', replacing any existing
+    /// file, sized to hold the default maximum number of objects and values,
+    /// and map it into memory. Return the error.
+    ntsa::Error open(const bsl::string& path);
+
+    /// Create the file at the specified 'path', replacing any existing
+    /// file, sized to hold at most the specified 'maxObjects' having, in
+    /// total, at most the specified 'maxValues', and whose schema section
+    /// holds at most the specified 'schemaCapacity' bytes, and map it into
+    /// memory. Return the error.
+    ntsa::Error open(const bsl::string& path,
+                     bsl::size_t        maxObjects,
+                     bsl::size_t        maxValues,
+                     bsl::size_t        schemaCapacity);
+
+    /// Unmap the file from memory. Note that the file is not removed.
+    void close();
+
+    /// Publish the specified 'statistics' collected from the specified
+    /// 'monitorable' object at the specified 'time'. If the specified
+    /// 'final' flag is true, these 'statistics' are the final statistics
+    /// collected during the same sample at the 'time'.
+    virtual void publish(const bsl::shared_ptr<ntci::Monitorable>& monitorable,
+                         const bdld::Datum&                        statistics,
+                         const bsls::TimeInterval&                 time,
+                         bool                                      final)
+        BSLS_KEYWORD_OVERRIDE;
+};
+
+/// @internal @brief
+/// Provide a reader of a shared memory metrics file.
+///
+/// @details
+/// This class reads the statistics written to a file by an
+/// 'ntcs::SharedMemoryPublisher', potentially in another process, retrying
+/// until it copies a sample that was not concurrently modified.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntcs
+class SharedMemoryReader
+{
+    const char*       d_address_p;
+    bsl::size_t       d_size;
+    bsl::vector<char> d_buffer;
+    bslma::Allocator* d_allocator_p;
+
+  private:
+    SharedMemoryReader(const SharedMemoryReader&) BSLS_KEYWORD_DELETED;
+    SharedMemoryReader& operator=(const SharedMemoryReader&)
+        BSLS_KEYWORD_DELETED;
+
+  public:
+    enum {
+        /// The maximum number of times a sample is copied before giving up
+        /// because it is continuously being modified.
+        k_MAX_ATTEMPTS = 1000
+    };
+
+    /// Create a new shared memory reader. Optionally specify a
+    /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
+    /// the currently installed default allocator is used.
+    explicit SharedMemoryReader(bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~SharedMemoryReader();
+
+    /// Map the existing file at the specified 'path' into memory. Return
+    /// the error.
+    ntsa::Error open(const bsl::string& path);
+
+    /// Unmap the file from memory.
+    void close();
+
+    /// Load into the specified 'result' each statistic in the most recent
+    /// consistent sample and load into the specified 'time' the time at
+    /// which the sample was collected. Return the error. Note that
+    /// 'e_WOULD_BLOCK' is returned if no consistent sample could be copied
+    /// after 'k_MAX_ATTEMPTS', and 'e_INVALID' is returned if the file is
+    /// not a shared memory metrics file or was written with an unsupported
+    /// version.
+    ntsa::Error read(bsl::vector<SharedMemoryRecord>* result,
+                     bsls::TimeInterval*              time);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
@@ -0,0 +1,358 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_sharedmemorypublisher.h>
+
+#include <ntccfg_test.h>
+#include <ntsa_temporary.h>
+
+#include <bdld_datum.h>
+#include <bdld_manageddatum.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bsls_assert.h>
+#include <bsl_cmath.h>
+#include <bsl_cstring.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// This test driver publishes statistics from monitorable objects to a
+// memory-mapped file and verifies the statistics read back from the file
+// match the statistics published.
+//-----------------------------------------------------------------------------
+
+// [ 1] Statistics are published and read back with their schema.
+// [ 2] Objects are dropped when the file is full.
+//-----------------------------------------------------------------------------
+
+namespace test {
+
+/// This class implements the 'ntci::Monitorable' interface for use by this
+/// test driver. Each object reports a fixed number of statistics, the first
+/// of which is always null.
+class Object : public ntci::Monitorable
+{
+    bsl::string d_name;
+    const char* d_prefix;
+    int         d_numStatistics;
+    double      d_base;
+
+  private:
+    Object(const Object&) BSLS_KEYWORD_DELETED;
+    Object& operator=(const Object&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new object having the specified 'name' that reports the
+    /// specified 'numStatistics' having the specified 'prefix', each
+    /// statistic offset from the specified 'base'.
+    Object(const bsl::string& name,
+           const char*        prefix,
+           int                numStatistics,
+           double             base);
+
+    /// Destroy this object.
+    ~Object() BSLS_KEYWORD_OVERRIDE;
+
+    /// Load into the specified 'result' the statistics of this object.
+    void getStats(bdld::ManagedDatum* result) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the prefix of the field at the specified 'ordinal'.
+    const char* getFieldPrefix(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the name of the field at the specified 'ordinal'.
+    const char* getFieldName(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the description of the field at the specified 'ordinal'.
+    const char* getFieldDescription(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the type of the field at the specified 'ordinal'.
+    StatisticType getFieldType(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the tags of the field at the specified 'ordinal'.
+    int getFieldTags(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the ordinal of the specified 'fieldName'.
+    int getFieldOrdinal(const char* fieldName) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the number of statistics reported by this object.
+    int numOrdinals() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the name of this object.
+    const char* objectName() const BSLS_KEYWORD_OVERRIDE;
+};
+
+const char* const k_FIELD_NAMES[] = {"a", "b", "c", "d", "e", "f"};
+
+Object::Object(const bsl::string& name,
+               const char*        prefix,
+               int                numStatistics,
+               double             base)
+: d_name(name)
+, d_prefix(prefix)
+, d_numStatistics(numStatistics)
+, d_base(base)
+{
+    BSLS_ASSERT(numStatistics <= 6);
+}
+
+Object::~Object()
+{
+}
+
+void Object::getStats(bdld::ManagedDatum* result)
+{
+    bdld::DatumMutableArrayRef array;
+    bdld::Datum::createUninitializedArray(&array,
+                                          d_numStatistics,
+                                          result->allocator());
+
+    array.data()[0] = bdld::Datum::createNull();
+
+    for (int i = 1; i < d_numStatistics; ++i) {
+        array.data()[i] = bdld::Datum::createDouble(d_base + i);
+    }
+
+    *array.length() = d_numStatistics;
+
+    result->adopt(bdld::Datum::adoptArray(array));
+}
+
+const char* Object::getFieldPrefix(int ordinal) const
+{
+    NTCCFG_WARNING_UNUSED(ordinal);
+    return d_prefix;
+}
+
+const char* Object::getFieldName(int ordinal) const
+{
+    if (ordinal < 0 || ordinal >= d_numStatistics) {
+        return 0;
+    }
+
+    return k_FIELD_NAMES[ordinal];
+}
+
+const char* Object::getFieldDescription(int ordinal) const
+{
+    return this->getFieldName(ordinal);
+}
+
+ntci::Monitorable::StatisticType Object::getFieldType(int ordinal) const
+{
+    return (ordinal % 2 == 0) ? ntci::Monitorable::e_SUM
+                              : ntci::Monitorable::e_MAXIMUM;
+}
+
+int Object::getFieldTags(int ordinal) const
+{
+    NTCCFG_WARNING_UNUSED(ordinal);
+    return 0;
+}
+
+int Object::getFieldOrdinal(const char* fieldName) const
+{
+    for (int i = 0; i < d_numStatistics; ++i) {
+        if (bsl::strcmp(fieldName, k_FIELD_NAMES[i]) == 0) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+int Object::numOrdinals() const
+{
+    return d_numStatistics;
+}
+
+const char* Object::objectName() const
+{
+    return d_name.c_str();
+}
+
+/// Publish the statistics of the specified 'monitorable' object to the
+/// specified 'publisher' at the specified 'time', as the final statistics in
+/// the sample if the specified 'final' flag is true.
+void publish(ntcs::SharedMemoryPublisher*              publisher,
+             const bsl::shared_ptr<ntci::Monitorable>& monitorable,
+             const bsls::TimeInterval&                 time,
+             bool                                      final)
+{
+    bdld::ManagedDatum statistics;
+    monitorable->getStats(&statistics);
+
+    publisher->publish(monitorable, statistics.datum(), time, final);
+}
+
+}  // close namespace test
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Statistics are published and read back with their schema.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+
+        ntsa::TemporaryFile tempFile(&ta);
+
+        ntcs::SharedMemoryPublisher publisher(&ta);
+        error = publisher.open(tempFile.path());
+        NTCCFG_TEST_OK(error);
+
+        ntcs::SharedMemoryReader reader(&ta);
+        error = reader.open(tempFile.path());
+        NTCCFG_TEST_OK(error);
+
+        bsl::vector<ntcs::SharedMemoryRecord> records(&ta);
+        bsls::TimeInterval                    time;
+
+        // Nothing has been published yet.
+
+        error = reader.read(&records, &time);
+        NTCCFG_TEST_OK(error);
+        NTCCFG_TEST_EQ(records.size(), 0);
+
+        bsl::shared_ptr<test::Object> first;
+        first.createInplace(&ta, "first", "test.one", 3, 10.0);
+
+        bsl::shared_ptr<test::Object> second;
+        second.createInplace(&ta, "second", "test.one", 3, 20.0);
+
+        bsl::shared_ptr<test::Object> third;
+        third.createInplace(&ta, "third", "test.two", 4, 30.0);
+
+        // Publish two samples and verify the second replaces the first.
+
+        for (int sample = 0; sample < 2; ++sample) {
+            const bsls::TimeInterval sampleTime(1000 + sample, 0);
+
+            test::publish(&publisher, first, sampleTime, false);
+            test::publish(&publisher, second, sampleTime, false);
+            test::publish(&publisher, third, sampleTime, true);
+
+            error = reader.read(&records, &time);
+            NTCCFG_TEST_OK(error);
+
+            NTCCFG_TEST_EQ(time, sampleTime);
+            NTCCFG_TEST_EQ(records.size(), 10);
+
+            for (bsl::size_t i = 0; i < records.size(); ++i) {
+                const ntcs::SharedMemoryRecord& record = records[i];
+
+                bsl::size_t ordinal = 0;
+                double      base    = 0;
+
+                if (i < 3) {
+                    ordinal = i;
+                    base    = 10.0;
+                    NTCCFG_TEST_EQ(record.objectName(), "first");
+                    NTCCFG_TEST_EQ(record.objectId(),
+                                   first->objectId().value());
+                    NTCCFG_TEST_EQ(record.prefix(), "test.one");
+                }
+                else if (i < 6) {
+                    ordinal = i - 3;
+                    base    = 20.0;
+                    NTCCFG_TEST_EQ(record.objectName(), "second");
+                    NTCCFG_TEST_EQ(record.prefix(), "test.one");
+                }
+                else {
+                    ordinal = i - 6;
+                    base    = 30.0;
+                    NTCCFG_TEST_EQ(record.objectName(), "third");
+                    NTCCFG_TEST_EQ(record.prefix(), "test.two");
+                }
+
+                NTCCFG_TEST_EQ(record.name(), test::k_FIELD_NAMES[ordinal]);
+                NTCCFG_TEST_EQ(
+                    record.type(),
+                    first->getFieldType(static_cast<int>(ordinal)));
+
+                if (ordinal == 0) {
+                    NTCCFG_TEST_TRUE(bsl::isnan(record.value()));
+                }
+                else {
+                    NTCCFG_TEST_EQ(record.value(), base + ordinal);
+                }
+            }
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: Objects are dropped when the file is full.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+
+        ntsa::TemporaryFile tempFile(&ta);
+
+        ntcs::SharedMemoryPublisher publisher(&ta);
+        error = publisher.open(tempFile.path(), 2, 5, 1024);
+        NTCCFG_TEST_OK(error);
+
+        ntcs::SharedMemoryReader reader(&ta);
+        error = reader.open(tempFile.path());
+        NTCCFG_TEST_OK(error);
+
+        bsl::shared_ptr<test::Object> first;
+        first.createInplace(&ta, "first", "test.one", 3, 10.0);
+
+        bsl::shared_ptr<test::Object> second;
+        second.createInplace(&ta, "second", "test.one", 3, 20.0);
+
+        bsl::shared_ptr<test::Object> third;
+        third.createInplace(&ta, "third", "test.one", 2, 30.0);
+
+        const bsls::TimeInterval sampleTime(1000, 0);
+
+        // The second object does not fit within the maximum number of
+        // values, but the third does.
+
+        test::publish(&publisher, first, sampleTime, false);
+        test::publish(&publisher, second, sampleTime, false);
+        test::publish(&publisher, third, sampleTime, true);
+
+        bsl::vector<ntcs::SharedMemoryRecord> records(&ta);
+        bsls::TimeInterval                    time;
+
+        error = reader.read(&records, &time);
+        NTCCFG_TEST_OK(error);
+
+        NTCCFG_TEST_EQ(records.size(), 5);
+        NTCCFG_TEST_EQ(records[0].objectName(), "first");
+        NTCCFG_TEST_EQ(records[3].objectName(), "third");
+        NTCCFG_TEST_EQ(records[4].value(), 31.0);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+}
+NTCCFG_TEST_DRIVER_END;
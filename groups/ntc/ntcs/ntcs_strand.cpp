@@ -20,13 +20,13 @@ BSLS_IDENT_RCSID(ntcs_strand_cpp, "$Id$ $CSID$")
 
 #include <ntccfg_bind.h>
 #include <ntcs_async.h>
-#include <bdlb_nullablevalue.h>
 #include <bdlf_bind.h>
 #include <bdlf_memfn.h>
 #include <bdlf_placeholder.h>
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bsls_assert.h>
+#include <bslmt_threadutil.h>
 #include <bsls_log.h>
 
 // Uncomment to enable logging from this component.
@@ -74,18 +74,25 @@ BSLS_IDENT_RCSID(ntcs_strand_cpp, "$Id$ $CSID$")
 
 #endif
 
-// The compile-time constant to implement the strand using a greedy algorithm,
-// that maximizes throughput at the expense of fairness.
-#define NTCS_STRAND_IMP_GREEDY 1
-
-// The compile-time constant to implement the strand using a fair algorithm,
-// that will more fairly allow functors on the strand to be executed by
-// different threads (and allows functors from other threads to more fairly
-// utilize those threads) at the expense of throughput.
-#define NTCS_STRAND_IMP_FAIR 2
+// The maximum number of functors invoked each time a strand is activated
+// before the strand yields its thread to other functors deferred to its
+// executor. A smaller value more fairly allows functors on the strand to be
+// executed by different threads (and allows functors from other threads to
+// more fairly utilize those threads) at the expense of throughput.
+#ifndef NTCS_STRAND_MAX_BATCH_SIZE
+#define NTCS_STRAND_MAX_BATCH_SIZE 64
+#endif
 
-// Define the strand implementation algorithm.
-#define NTCS_STRAND_IMP NTCS_STRAND_IMP_GREEDY
+// The maximum number of times an activation retries popping a functor that
+// has been counted as pending but not yet linked into the queue by its
+// producer, before yielding its thread once and trying a final time. A
+// producer is only unlinked for the few instructions between its exchange of
+// the head of the queue and its store to the link of its predecessor, unless
+// it is pre-empted, so a short spin usually observes the functor without
+// deferring the strand back through its executor.
+#ifndef NTCS_STRAND_MAX_SPIN_COUNT
+#define NTCS_STRAND_MAX_SPIN_COUNT 128
+#endif
 
 // Some versions of GCC erroneously warn ntcs::ObserverRef::d_shared may be
 // uninitialized.
@@ -94,216 +101,227 @@ BSLS_IDENT_RCSID(ntcs_strand_cpp, "$Id$ $CSID$")
 #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
 #endif
 
-// IMPLEMENTATION NOTES: Testing indicates that, with 10 threads driving the
-// reactor utilized by a strand, fair algorithm achieves 250,000 functors per
-// second, evenly distributed across all threads, while the greedy algorithm
-// achieves 2,000,000 functors per second, but typically only runs on three or
-// four threads.
+// IMPLEMENTATION NOTES: The number of pending functors is incremented before
+// a functor is pushed onto the queue, and decremented only after the functor
+// is popped and invoked, or removed by 'drain' or 'clear'. The thread whose
+// increment transitions the number of pending functors from zero activates
+// the strand, and the activation that decrements it back to zero
+// deactivates the strand, so that at most one activation is ever pending or
+// running. An activation may observe functors pending that are not yet
+// visible in the queue, because their producers have been pre-empted while
+// linking them: such an activation spins, then yields, for a bounded number
+// of attempts to pop the functor before giving up and re-activating the
+// strand, so that a momentarily unlinked functor does not cause the strand
+// to bounce through its executor with nothing to do. An activation holds the
+// consumer lock once for its entire batch, so that 'clear' called from
+// another thread does not pop concurrently; a functor invoked by the strand
+// that clears it pops under the lock already held by its activation.
+// Previous testing indicated that, with 10 threads driving the reactor
+// utilized by a strand, invoking one functor per activation achieves 250,000
+// functors per second, evenly distributed across all threads, while invoking
+// every pending functor per activation achieves 2,000,000 functors per
+// second, but typically only runs on three or four threads.
 
 namespace BloombergLP {
 namespace ntcs {
 
 void Strand::invoke()
 {
-#if (NTCS_STRAND_IMP == NTCS_STRAND_IMP_GREEDY)
+    bsl::uint64_t numInvoked = 0;
 
-    while (true) {
-        bdlb::NullableValue<FunctorQueue> functorQueue(d_allocator_p);
-        {
-            LockGuard lock(&d_functorQueueMutex);
+    {
+        ntci::StrandGuard strandGuard(this);
+        LockGuard         lock(&d_consumerMutex);
 
-            BSLS_ASSERT(d_pending);
+        NTCS_STRAND_LOG_EXECUTION_STARTING(this, d_functorQueue);
 
-            if (!d_functorQueue.empty()) {
-                functorQueue.makeValue().swap(d_functorQueue);
-                NTCS_STRAND_LOG_QUEUE_POPPED(this, functorQueue.value());
-            }
-            else {
-                NTCS_STRAND_LOG_QUEUE_EMPTY(this);
-                d_pending = false;
+        InplaceFunctor functor(d_allocator_p);
+        while (numInvoked < NTCS_STRAND_MAX_BATCH_SIZE) {
+            if (!this->pop(&functor) &&
+                !this->popUnlinked(&functor, numInvoked))
+            {
                 break;
             }
-        }
-
-        NTCS_STRAND_LOG_EXECUTION_STARTING(this, functorQueue.value());
 
-        FunctorQueue::iterator it = functorQueue.value().begin();
-        FunctorQueue::iterator et = functorQueue.value().end();
-
-        {
-            ntci::StrandGuard strandGuard(this);
-
-            while (it != et) {
-                (*it)();
-                ++it;
-            }
+            functor();
+            functor.reset();
+            ++numInvoked;
         }
 
-        NTCS_STRAND_LOG_EXECUTION_COMPLETE(this, functorQueue.value());
+        NTCS_STRAND_LOG_EXECUTION_COMPLETE(this, d_functorQueue);
     }
 
-#elif (NTCS_STRAND_IMP == NTCS_STRAND_IMP_FAIR)
+    numInvoked += d_numRemoved.swapAcqRel(0);
 
-    Functor functor(NTCCFG_FUNCTION_INIT(d_allocator_p));
-    bool    activate = false;
-
-    {
-        LockGuard lock(&d_functorQueueMutex);
-
-        BSLS_ASSERT(d_pending);
-        BSLS_ASSERT(!d_functorQueue.empty());
+    if (d_numPending.subtractAcqRel(numInvoked) == 0) {
+        NTCS_STRAND_LOG_QUEUE_EMPTY(this);
+        return;
+    }
 
-        functor.swap(d_functorQueue.front());
+    this->activate();
+}
 
-        d_functorQueue.pop_front();
+void Strand::activate()
+{
+    NTCS_STRAND_LOG_ACTIVATION(this);
 
-        activate  = !d_functorQueue.empty();
-        d_pending = activate;
+    ntcs::ObserverRef<ntci::Executor> executorRef(&d_executor);
+    if (executorRef) {
+        executorRef->execute(
+            NTCCFG_BIND(&Strand::invoke, this->getSelf(this)));
+    }
+    else {
+        ntcs::Async::execute(
+            NTCCFG_BIND(&Strand::invoke, this->getSelf(this)));
     }
+}
 
-    {
-        ntci::StrandGuard strandGuard(this);
+bool Strand::pop(InplaceFunctor* result)
+{
+    return d_functorQueue.pop(result);
+}
 
-        functor();
-    }
+bool Strand::popUnlinked(InplaceFunctor* result, bsl::uint64_t numInvoked)
+{
+    for (bsl::size_t attempt = 0; attempt <= NTCS_STRAND_MAX_SPIN_COUNT;
+         ++attempt)
+    {
+        if (d_numPending.loadAcquire() <=
+            numInvoked + d_numRemoved.loadAcquire())
+        {
+            return false;
+        }
 
-    if (activate) {
-        ntcs::ObserverRef<ntci::Executor> executorRef(&d_executor);
-        if (executorRef) {
-            executorRef->execute(
-                NTCCFG_BIND(&Strand::invoke, this->getSelf(this)));
+        if (attempt == NTCS_STRAND_MAX_SPIN_COUNT) {
+            bslmt::ThreadUtil::yield();
         }
-        else {
-            ntcs::Async::execute(
-                NTCCFG_BIND(&Strand::invoke, this->getSelf(this)));
+
+        if (this->pop(result)) {
+            return true;
         }
     }
 
-#else
-#error Not implemented
-#endif
+    return false;
 }
 
 Strand::Strand(const bsl::shared_ptr<ntci::Executor>& executor,
                bslma::Allocator*                      basicAllocator)
 : d_object("ntcs::Strand")
-, d_functorQueueMutex(NTCCFG_LOCK_INIT)
+, d_consumerMutex()
 , d_functorQueue(basicAllocator)
+, d_numPending(0)
+, d_numRemoved(0)
 , d_executor(bsl::weak_ptr<ntci::Executor>(executor))
-, d_pending(false)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
 
 Strand::~Strand()
 {
-    BSLS_ASSERT(d_functorQueue.empty());
+    BSLS_ASSERT(d_functorQueue.isEmpty());
 }
 
 void Strand::execute(const Functor& function)
 {
-    bool activate = false;
-    {
-        LockGuard lock(&d_functorQueueMutex);
+    const bsl::uint64_t numPending = d_numPending.addAcqRel(1);
 
-        d_functorQueue.push_back(function);
+    d_functorQueue.push(function);
 
-        NTCS_STRAND_LOG_QUEUE_PUSHED(this, d_functorQueue, d_pending);
+    NTCS_STRAND_LOG_QUEUE_PUSHED(this, d_functorQueue, numPending);
 
-        if (!d_pending) {
-            d_pending = true;
-            activate  = true;
-        }
+    if (numPending == 1) {
+        this->activate();
     }
+}
 
-    if (activate) {
-        NTCS_STRAND_LOG_ACTIVATION(this);
+void Strand::executeInplace(InplaceFunctor* functor)
+{
+    const bsl::uint64_t numPending = d_numPending.addAcqRel(1);
 
-        ntcs::ObserverRef<ntci::Executor> executorRef(&d_executor);
-        if (executorRef) {
-            executorRef->execute(
-                NTCCFG_BIND(&Strand::invoke, this->getSelf(this)));
-        }
-        else {
-            ntcs::Async::execute(
-                NTCCFG_BIND(&Strand::invoke, this->getSelf(this)));
-        }
+    d_functorQueue.push(functor);
+
+    NTCS_STRAND_LOG_QUEUE_PUSHED(this, d_functorQueue, numPending);
+
+    if (numPending == 1) {
+        this->activate();
     }
 }
 
 void Strand::moveAndExecute(FunctorSequence* functorSequence,
                             const Functor&   functor)
 {
-    bool activate = false;
-    {
-        LockGuard lock(&d_functorQueueMutex);
+    // Count only the functors actually pushed: an undefined functor in the
+    // sequence is skipped, and would otherwise remain pending forever.
 
-        d_functorQueue.splice(d_functorQueue.end(), *functorSequence);
-        if (functor) {
-            d_functorQueue.push_back(functor);
-        }
+    const bsl::uint64_t numFunctors = static_cast<bsl::uint64_t>(
+        FunctorQueue::count(*functorSequence, functor));
 
-        if (!d_pending) {
-            d_pending = true;
-            activate  = true;
-        }
+    if (numFunctors == 0) {
+        functorSequence->clear();
+        return;
     }
 
-    if (activate) {
-        ntcs::ObserverRef<ntci::Executor> executorRef(&d_executor);
-        if (executorRef) {
-            executorRef->execute(
-                NTCCFG_BIND(&Strand::invoke, this->getSelf(this)));
-        }
-        else {
-            ntcs::Async::execute(
-                NTCCFG_BIND(&Strand::invoke, this->getSelf(this)));
-        }
+    const bsl::uint64_t numPending = d_numPending.addAcqRel(numFunctors);
+
+    const bsl::size_t numPushed =
+        d_functorQueue.push(functorSequence, functor);
+    BSLS_ASSERT(numPushed == numFunctors);
+    NTCCFG_WARNING_UNUSED(numPushed);
+
+    NTCS_STRAND_LOG_QUEUE_PUSHED(this, d_functorQueue, numPending);
+
+    if (numPending == numFunctors) {
+        this->activate();
     }
 }
 
 void Strand::drain()
 {
-    while (true) {
-        bdlb::NullableValue<FunctorQueue> functorQueue(d_allocator_p);
-        {
-            LockGuard lock(&d_functorQueueMutex);
-
-            BSLS_ASSERT(!d_pending);
+    bsl::uint64_t numInvoked = 0;
 
-            if (!d_functorQueue.empty()) {
-                functorQueue.makeValue().swap(d_functorQueue);
-                NTCS_STRAND_LOG_QUEUE_POPPED(this, functorQueue.value());
-            }
-            else {
-                NTCS_STRAND_LOG_QUEUE_EMPTY(this);
-                break;
-            }
-        }
-
-        NTCS_STRAND_LOG_EXECUTION_STARTING(this, functorQueue.value());
+    {
+        const bool nested = this->isRunningInCurrentThread();
 
-        FunctorQueue::iterator it = functorQueue.value().begin();
-        FunctorQueue::iterator et = functorQueue.value().end();
+        ntci::StrandGuard strandGuard(this);
+        LockGuard         lock(nested ? 0 : &d_consumerMutex);
 
-        {
-            ntci::StrandGuard strandGuard(this);
+        NTCS_STRAND_LOG_EXECUTION_STARTING(this, d_functorQueue);
 
-            while (it != et) {
-                (*it)();
-                ++it;
-            }
+        InplaceFunctor functor(d_allocator_p);
+        while (this->pop(&functor)) {
+            functor();
+            functor.reset();
+            ++numInvoked;
         }
 
-        NTCS_STRAND_LOG_EXECUTION_COMPLETE(this, functorQueue.value());
+        NTCS_STRAND_LOG_EXECUTION_COMPLETE(this, d_functorQueue);
     }
+
+    // Leave the accounting of the drained functors to the pending activation
+    // of this strand, if any, so that the strand is never activated twice.
+
+    d_numRemoved.addAcqRel(numInvoked);
 }
 
 void Strand::clear()
 {
-    LockGuard lock(&d_functorQueueMutex);
+    bsl::uint64_t numRemoved = 0;
+
+    {
+        InplaceFunctor functor(d_allocator_p);
+
+        // A functor invoked by this strand may clear it while the lock is
+        // held by the activation or drain invoking that functor.
+
+        LockGuard lock(this->isRunningInCurrentThread() ? 0
+                                                        : &d_consumerMutex);
+        while (d_functorQueue.pop(&functor)) {
+            functor.reset();
+            ++numRemoved;
+        }
+    }
 
-    d_functorQueue.clear();
+    d_numRemoved.addAcqRel(numRemoved);
 }
 
 bool Strand::isRunningInCurrentThread() const
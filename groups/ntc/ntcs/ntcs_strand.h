@@ -22,11 +22,13 @@ BSLS_IDENT("$Id: $")
 #include <ntccfg_platform.h>
 #include <ntci_executor.h>
 #include <ntci_strand.h>
+#include <ntcs_inbox.h>
 #include <ntcs_observer.h>
 #include <ntcscm_version.h>
-#include <bsls_spinlock.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bsls_atomic.h>
 #include <bsl_functional.h>
-#include <bsl_list.h>
 #include <bsl_memory.h>
 
 namespace BloombergLP {
@@ -36,6 +38,17 @@ namespace ntcs {
 /// Provide a mechanism to execute functions asynchronously but sequentially
 /// and not concurrent with one another.
 ///
+/// @details
+/// Deferred functions are pushed onto a lock-free, multiple-producer,
+/// single-consumer queue whose nodes are pooled, so that deferring a function
+/// neither acquires a mutex nor allocates a node from the general-purpose
+/// allocator once the pool is warm. The strand is activated on its executor
+/// only by the thread whose deferral transitions the number of pending
+/// functions from zero. Each activation invokes a bounded number of functions
+/// then, if functions remain pending, re-activates the strand on its
+/// executor, so that a busy strand yields its thread to other work deferred
+/// to the same executor.
+///
 /// @par Thread Safety
 /// This class is thread safe.
 ///
@@ -44,19 +57,21 @@ class Strand : public ntci::Strand, public ntccfg::Shared<Strand>
 {
     /// Define a type alias for a queue of callbacks to
     /// execute on this thread.
-    typedef ntci::Executor::FunctorSequence FunctorQueue;
+    typedef ntcs::Inbox FunctorQueue;
 
-    /// Define a type alias for a mutex.
-    typedef ntccfg::Mutex Mutex;
+    /// Define a type alias for a mutex. Note that the consumer lock is held
+    /// for each batch of functors invoked, so it blocks rather than spins.
+    typedef bslmt::Mutex Mutex;
 
     /// Define a type alias for a mutex lock guard.
-    typedef ntccfg::LockGuard LockGuard;
+    typedef bslmt::LockGuard<bslmt::Mutex> LockGuard;
 
     ntccfg::Object                 d_object;
-    mutable Mutex                  d_functorQueueMutex;
+    mutable Mutex                  d_consumerMutex;
     FunctorQueue                   d_functorQueue;
+    bsls::AtomicUint64             d_numPending;
+    bsls::AtomicUint64             d_numRemoved;
     ntcs::Observer<ntci::Executor> d_executor;
-    bool                           d_pending;
     bslma::Allocator*              d_allocator_p;
 
   private:
@@ -64,9 +79,27 @@ class Strand : public ntci::Strand, public ntccfg::Shared<Strand>
     Strand& operator=(const Strand&) BSLS_KEYWORD_DELETED;
 
   private:
-    /// Invoke the next functor in the queue.
+    /// Invoke the next batch of functors in the queue, then re-activate this
+    /// strand if functors remain pending.
     void invoke();
 
+    /// Defer the invocation of this strand to its executor.
+    void activate();
+
+    /// Pop the functor at the front of the queue and load it into the
+    /// specified 'result'. Return true if a functor was popped, and false
+    /// otherwise. The behavior is undefined unless the calling thread holds
+    /// the consumer lock.
+    bool pop(InplaceFunctor* result);
+
+    /// Wait a bounded amount of time for a functor counted as pending but
+    /// not yet linked into the queue by its producer, given the specified
+    /// 'numInvoked' functors invoked but not yet subtracted from the number
+    /// of pending functors, and load it into the specified 'result'. Return
+    /// true if a functor was popped, and false if no such functor is
+    /// pending or it did not become visible in time.
+    bool popUnlinked(InplaceFunctor* result, bsl::uint64_t numInvoked);
+
   public:
     /// Create a new strand on the specified 'executor'. Optionally specify
     /// a 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
@@ -91,6 +124,13 @@ class Strand : public ntci::Strand, public ntccfg::Shared<Strand>
     void moveAndExecute(FunctorSequence* functorSequence,
                         const Functor&   functor) BSLS_KEYWORD_OVERRIDE;
 
+    /// Defer the callable object stored by the specified 'functor' to
+    /// execute sequentially, and non-concurrently, after all previously
+    /// deferred functions, leaving the 'functor' empty. Note that the
+    /// callable object is moved into the queue of this strand without
+    /// being copied.
+    void executeInplace(InplaceFunctor* functor) BSLS_KEYWORD_OVERRIDE;
+
     /// Execute all pending operations on the calling thread. The behavior
     /// is undefined unless no other thread is processing pending
     /// operations.
@@ -22,6 +22,8 @@
 #include <bdlf_memfn.h>
 #include <bdlf_placeholder.h>
 #include <bdlma_concurrentmultipoolallocator.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
 #include <bslmt_barrier.h>
 #include <bslmt_latch.h>
 #include <bslmt_semaphore.h>
@@ -29,9 +31,11 @@
 #include <bslmt_threadutil.h>
 #include <bsls_stopwatch.h>
 #include <bsls_timeinterval.h>
+#include <bsl_cstring.h>
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
 #include <bsl_unordered_map.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 
@@ -40,11 +44,12 @@ namespace test {
 /// Provide an interface to execute a function.
 class Executor : public ntci::Executor
 {
-    bslmt::Mutex      d_functorQueueMutex;
-    bslmt::Condition  d_functorQueueCondition;
-    FunctorSequence   d_functorQueue;
-    bool              d_stop;
-    bslma::Allocator* d_allocator_p;
+    bslmt::Mutex       d_functorQueueMutex;
+    bslmt::Condition   d_functorQueueCondition;
+    FunctorSequence    d_functorQueue;
+    bool               d_stop;
+    bsls::AtomicUint64 d_numExecuted;
+    bslma::Allocator*  d_allocator_p;
 
   private:
     Executor(const Executor&) BSLS_KEYWORD_DELETED;
@@ -73,6 +78,9 @@ class Executor : public ntci::Executor
     /// 'functorSequence'.
     void moveAndExecute(FunctorSequence* functorSequence,
                         const Functor&   functor) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the number of functors deferred to this executor.
+    bsl::uint64_t numExecuted() const;
 };
 
 Executor::Executor(bslma::Allocator* basicAllocator)
@@ -80,6 +88,7 @@ Executor::Executor(bslma::Allocator* basicAllocator)
 , d_functorQueueCondition()
 , d_functorQueue(basicAllocator)
 , d_stop(false)
+, d_numExecuted(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -124,6 +133,8 @@ void Executor::stop()
 
 void Executor::execute(const Functor& functor)
 {
+    ++d_numExecuted;
+
     bslmt::LockGuard<bslmt::Mutex> guard(&d_functorQueueMutex);
     d_functorQueue.push_back(functor);
 
@@ -143,6 +154,11 @@ void Executor::moveAndExecute(FunctorSequence* functorSequence,
     d_functorQueueCondition.signal();
 }
 
+bsl::uint64_t Executor::numExecuted() const
+{
+    return d_numExecuted.load();
+}
+
 /// This class keeps track of the count of an action performed by a thread.
 /// This class is thread safe.
 class Count
@@ -954,9 +970,565 @@ NTCCFG_TEST_CASE(2)
     NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+namespace test {
+
+/// Provide utilities for measuring the throughput of a strand onto which
+/// many threads concurrently defer functions.
+struct ContentionUtil {
+    /// Verify the function deferred by the specified 'producerIndex' having
+    /// the specified 'sequenceNumber' is invoked on the specified 'strand'
+    /// in the order deferred by that producer, as tracked by the specified
+    /// 'expected' sequence numbers of each producer. Decrement the specified
+    /// 'numRemaining' and post to the specified 'semaphore' when it reaches
+    /// zero.
+    static void process(const ntci::Strand*       strand,
+                        bsl::size_t               producerIndex,
+                        bsl::size_t               sequenceNumber,
+                        bsl::vector<bsl::size_t>* expected,
+                        bsls::AtomicUint64*       numRemaining,
+                        bslmt::Semaphore*         semaphore);
+
+    /// Wait on the specified 'barrier' then defer the specified
+    /// 'numFunctors' onto the specified 'strand' as the producer identified
+    /// by the specified 'producerIndex'. Use the specified 'allocator' to
+    /// supply memory.
+    static void produce(const bsl::shared_ptr<ntci::Strand>& strand,
+                        bsl::size_t                          producerIndex,
+                        bsl::size_t                          numFunctors,
+                        bslmt::Barrier*                      barrier,
+                        bsl::vector<bsl::size_t>*            expected,
+                        bsls::AtomicUint64*                  numRemaining,
+                        bslmt::Semaphore*                    semaphore,
+                        bslma::Allocator*                    allocator);
+
+    /// Measure the throughput of the specified 'numProducers' threads
+    /// each deferring the specified 'numFunctors' onto a strand driven by
+    /// the specified 'numConsumers' threads. Use the specified 'allocator'
+    /// to supply memory.
+    static void execute(bsl::size_t       numProducers,
+                        bsl::size_t       numConsumers,
+                        bsl::size_t       numFunctors,
+                        bslma::Allocator* allocator);
+};
+
+void ContentionUtil::process(const ntci::Strand*       strand,
+                             bsl::size_t               producerIndex,
+                             bsl::size_t               sequenceNumber,
+                             bsl::vector<bsl::size_t>* expected,
+                             bsls::AtomicUint64*       numRemaining,
+                             bslmt::Semaphore*         semaphore)
+{
+    NTCCFG_TEST_TRUE(strand->isRunningInCurrentThread());
+
+    // The expected sequence numbers are modified without synchronization:
+    // the strand guarantees they are never modified concurrently.
+
+    NTCCFG_TEST_EQ(sequenceNumber, (*expected)[producerIndex]);
+    ++(*expected)[producerIndex];
+
+    if (numRemaining->subtract(1) == 0) {
+        semaphore->post();
+    }
+}
+
+void ContentionUtil::produce(
+    const bsl::shared_ptr<ntci::Strand>& strand,
+    bsl::size_t                          producerIndex,
+    bsl::size_t                          numFunctors,
+    bslmt::Barrier*                      barrier,
+    bsl::vector<bsl::size_t>*            expected,
+    bsls::AtomicUint64*                  numRemaining,
+    bslmt::Semaphore*                    semaphore,
+    bslma::Allocator*                    allocator)
+{
+    barrier->wait();
+
+    for (bsl::size_t i = 0; i < numFunctors; ++i) {
+        strand->execute(bdlf::BindUtil::bindS(allocator,
+                                              &ContentionUtil::process,
+                                              strand.get(),
+                                              producerIndex,
+                                              i,
+                                              expected,
+                                              numRemaining,
+                                              semaphore));
+    }
+}
+
+void ContentionUtil::execute(bsl::size_t       numProducers,
+                             bsl::size_t       numConsumers,
+                             bsl::size_t       numFunctors,
+                             bslma::Allocator* allocator)
+{
+    int rc;
+
+    bsl::shared_ptr<test::Executor> executor;
+    executor.createInplace(allocator, allocator);
+
+    bsl::shared_ptr<ntcs::Strand> strand;
+    strand.createInplace(allocator, executor, allocator);
+
+    bsl::vector<bsl::size_t> expected(numProducers, 0, allocator);
+    bsls::AtomicUint64       numRemaining(numProducers * numFunctors);
+    bslmt::Semaphore         semaphore;
+    bslmt::Barrier           barrier(numProducers + 1);
+
+    bslmt::ThreadGroup consumerThreadGroup(allocator);
+    bslmt::ThreadGroup producerThreadGroup(allocator);
+
+    for (bsl::size_t threadIndex = 0; threadIndex < numConsumers;
+         ++threadIndex)
+    {
+        rc = consumerThreadGroup.addThread(
+            bdlf::BindUtil::bindS(allocator,
+                                  &test::CurrentUtil::executeThread,
+                                  executor,
+                                  threadIndex));
+        NTCCFG_TEST_EQ(rc, 0);
+    }
+
+    for (bsl::size_t threadIndex = 0; threadIndex < numProducers;
+         ++threadIndex)
+    {
+        rc = producerThreadGroup.addThread(
+            bdlf::BindUtil::bindS(allocator,
+                                  &ContentionUtil::produce,
+                                  strand,
+                                  threadIndex,
+                                  numFunctors,
+                                  &barrier,
+                                  &expected,
+                                  &numRemaining,
+                                  &semaphore,
+                                  allocator));
+        NTCCFG_TEST_EQ(rc, 0);
+    }
+
+    bsls::Stopwatch stopwatch;
+    stopwatch.start();
+
+    barrier.wait();
+
+    semaphore.wait();
+
+    stopwatch.stop();
+
+    producerThreadGroup.joinAll();
+
+    executor->stop();
+    consumerThreadGroup.joinAll();
+
+    for (bsl::size_t i = 0; i < numProducers; ++i) {
+        NTCCFG_TEST_EQ(expected[i], numFunctors);
+    }
+
+    const double wallTime = stopwatch.elapsedTime();
+    const double throughput =
+        static_cast<double>(numProducers * numFunctors) / wallTime;
+
+    BSLS_LOG_WARN("Strand contention: %d producers, %d consumers: "
+                  "%.8f seconds, %.2f functors/sec",
+                  (int)(numProducers),
+                  (int)(numConsumers),
+                  wallTime,
+                  throughput);
+}
+
+}  // close namespace test
+
+NTCCFG_TEST_CASE(3)
+{
+    // Concern: Benchmark the throughput of a strand onto which many threads
+    // concurrently defer functions, and verify the functions deferred by
+    // each thread are invoked non-concurrently, in the order deferred.
+
+#if NTC_BUILD_FROM_CONTINUOUS_INTEGRATION == 0
+
+    const bsl::size_t NUM_FUNCTORS = 100000;
+
+#else
+
+    const bsl::size_t NUM_FUNCTORS = 1000;
+
+#endif
+
+    const bsl::size_t NUM_CONSUMERS = 4;
+
+    const bsl::size_t NUM_PRODUCERS[] = {1, 4, 16};
+
+    enum { NUM_DATA = sizeof(NUM_PRODUCERS) / sizeof(NUM_PRODUCERS[0]) };
+
+    for (bsl::size_t iteration = 0; iteration < NUM_DATA; ++iteration) {
+        ntccfg::TestAllocator ta;
+        {
+            bdlma::ConcurrentMultipoolAllocator memoryPools(8, &ta);
+
+            test::ContentionUtil::execute(NUM_PRODUCERS[iteration],
+                                          NUM_CONSUMERS,
+                                          NUM_FUNCTORS,
+                                          &memoryPools);
+        }
+        NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+    }
+}
+
+namespace test {
+
+/// Describe an event announced to a callback, of a size comparable to the
+/// events describing the completion of a send or receive operation.
+struct Event {
+    char d_data[192];
+};
+
+/// Provide utilities for measuring the memory allocated to defer callbacks
+/// onto a strand.
+struct AllocationUtil {
+    /// Process the specified 'event' for the specified 'session' and
+    /// increment the specified 'counter'.
+    static void process(bsls::AtomicUint64*         counter,
+                        const bsl::shared_ptr<int>& session,
+                        const test::Event&          event);
+
+    /// Post to the specified 'semaphore'.
+    static void signal(bslmt::Semaphore* semaphore);
+
+    /// Defer the specified 'numFunctors' callbacks onto the specified
+    /// 'strand', each binding the specified 'session' and an event, by
+    /// copying a 'bsl::function' if the specified 'inplace' flag is false,
+    /// otherwise by moving an 'ntci::Executor::InplaceFunctor'. Increment
+    /// the specified 'counter' for each callback invoked when the strand is
+    /// drained. Return the number of allocations made by the specified
+    /// 'allocator' to defer the callbacks.
+    static bsls::Types::Int64 measure(
+        const bsl::shared_ptr<ntcs::Strand>& strand,
+        const bsl::shared_ptr<int>&          session,
+        bsls::AtomicUint64*                  counter,
+        bsl::size_t                          numFunctors,
+        bool                                 inplace,
+        bslma::TestAllocator*                allocator);
+};
+
+void AllocationUtil::process(bsls::AtomicUint64*         counter,
+                             const bsl::shared_ptr<int>& session,
+                             const test::Event&          event)
+{
+    NTCCFG_WARNING_UNUSED(event);
+
+    *counter += static_cast<bsl::uint64_t>(*session);
+}
+
+void AllocationUtil::signal(bslmt::Semaphore* semaphore)
+{
+    semaphore->post();
+}
+
+bsls::Types::Int64 AllocationUtil::measure(
+    const bsl::shared_ptr<ntcs::Strand>& strand,
+    const bsl::shared_ptr<int>&          session,
+    bsls::AtomicUint64*                  counter,
+    bsl::size_t                          numFunctors,
+    bool                                 inplace,
+    bslma::TestAllocator*                allocator)
+{
+    test::Event event;
+    bsl::memset(&event, 0, sizeof event);
+
+    const bsls::Types::Int64 numAllocationsBefore =
+        allocator->numAllocations();
+
+    for (bsl::size_t i = 0; i < numFunctors; ++i) {
+        if (inplace) {
+            ntci::Executor::InplaceFunctor functor(
+                bdlf::BindUtil::bind(&AllocationUtil::process,
+                                     counter,
+                                     session,
+                                     event),
+                allocator);
+
+            strand->executeInplace(&functor);
+        }
+        else {
+            bsl::function<void()> functor = bdlf::BindUtil::bind(
+                &AllocationUtil::process,
+                counter,
+                session,
+                event);
+
+            strand->execute(functor);
+        }
+    }
+
+    const bsls::Types::Int64 numAllocationsAfter =
+        allocator->numAllocations();
+
+    strand->drain();
+
+    return numAllocationsAfter - numAllocationsBefore;
+}
+
+}  // close namespace test
+
+NTCCFG_TEST_CASE(4)
+{
+    // Concern: Deferring a callback onto a strand by moving an in-place
+    // functor allocates no more memory than deferring a copy of a
+    // 'bsl::function', and does not allocate memory for each callback.
+
+    const bsl::size_t NUM_FUNCTORS = 1000;
+
+    ntccfg::TestAllocator ta;
+    {
+        bslma::TestAllocator counter("strand", false, &ta);
+        bslma::DefaultAllocatorGuard guard(&counter);
+
+        bsl::shared_ptr<test::Executor> executor;
+        executor.createInplace(&counter, &counter);
+
+        bsl::shared_ptr<ntcs::Strand> strand;
+        strand.createInplace(&counter, executor, &counter);
+
+        bsl::shared_ptr<int> session;
+        session.createInplace(&counter, 1);
+
+        bsls::AtomicUint64 numInvoked(0);
+
+        // Defer each callback once through each path before measuring, so
+        // the pool of queue nodes is already allocated.
+
+        test::AllocationUtil::measure(
+            strand, session, &numInvoked, NUM_FUNCTORS, true, &counter);
+
+        const bsls::Types::Int64 numAllocationsCopied =
+            test::AllocationUtil::measure(
+                strand, session, &numInvoked, NUM_FUNCTORS, false, &counter);
+
+        const bsls::Types::Int64 numAllocationsMoved =
+            test::AllocationUtil::measure(
+                strand, session, &numInvoked, NUM_FUNCTORS, true, &counter);
+
+        NTCCFG_TEST_EQ(numInvoked, 3 * NUM_FUNCTORS);
+
+        BSLS_LOG_WARN("Strand allocations for %d callbacks: "
+                      "%d copied, %d moved",
+                      (int)(NUM_FUNCTORS),
+                      (int)(numAllocationsCopied),
+                      (int)(numAllocationsMoved));
+
+        NTCCFG_TEST_LE(numAllocationsMoved, numAllocationsCopied);
+        NTCCFG_TEST_LT(numAllocationsMoved,
+                       static_cast<bsls::Types::Int64>(NUM_FUNCTORS));
+
+        // Invoke the activation of the strand pending on the executor, which
+        // accounts for the drained callbacks, so that the executor and the
+        // strand are not kept alive by each other.
+
+        bslmt::Semaphore semaphore;
+        executor->execute(
+            bdlf::BindUtil::bind(&test::AllocationUtil::signal, &semaphore));
+
+        bslmt::ThreadGroup threadGroup(&counter);
+        threadGroup.addThread(bdlf::BindUtil::bind(
+            &test::CurrentUtil::executeThread, executor, 0));
+
+        semaphore.wait();
+
+        executor->stop();
+        threadGroup.joinAll();
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+namespace test {
+
+/// Provide utilities for stressing a strand onto which many threads
+/// concurrently defer short bursts of functions, so that the strand
+/// repeatedly drains its queue while producers are still linking functors
+/// into it.
+struct StressUtil {
+    /// Wait on the specified 'barrier' then defer the specified
+    /// 'numFunctors' onto the specified 'strand' as the producer identified
+    /// by the specified 'producerIndex', in bursts of at most the specified
+    /// 'maxBurstSize' functors separated by yielding the calling thread.
+    /// Use the specified 'allocator' to supply memory.
+    static void produce(const bsl::shared_ptr<ntci::Strand>& strand,
+                        bsl::size_t                          producerIndex,
+                        bsl::size_t                          numFunctors,
+                        bsl::size_t                          maxBurstSize,
+                        bslmt::Barrier*                      barrier,
+                        bsl::vector<bsl::size_t>*            expected,
+                        bsls::AtomicUint64*                  numRemaining,
+                        bslmt::Semaphore*                    semaphore,
+                        bslma::Allocator*                    allocator);
+
+    /// Verify the specified 'numFunctors' deferred by each of the specified
+    /// 'numProducers' threads, in bursts of at most the specified
+    /// 'maxBurstSize' functors, onto a strand driven by the specified
+    /// 'numConsumers' threads are each invoked exactly once, non-
+    /// concurrently, in the order deferred by each producer. Use the
+    /// specified 'allocator' to supply memory.
+    static void execute(bsl::size_t       numProducers,
+                        bsl::size_t       numConsumers,
+                        bsl::size_t       numFunctors,
+                        bsl::size_t       maxBurstSize,
+                        bslma::Allocator* allocator);
+};
+
+void StressUtil::produce(const bsl::shared_ptr<ntci::Strand>& strand,
+                         bsl::size_t                          producerIndex,
+                         bsl::size_t                          numFunctors,
+                         bsl::size_t                          maxBurstSize,
+                         bslmt::Barrier*                      barrier,
+                         bsl::vector<bsl::size_t>*            expected,
+                         bsls::AtomicUint64*                  numRemaining,
+                         bslmt::Semaphore*                    semaphore,
+                         bslma::Allocator*                    allocator)
+{
+    barrier->wait();
+
+    bsl::size_t burstSize = 1 + producerIndex % maxBurstSize;
+
+    for (bsl::size_t i = 0; i < numFunctors; ++i) {
+        strand->execute(bdlf::BindUtil::bindS(allocator,
+                                              &ContentionUtil::process,
+                                              strand.get(),
+                                              producerIndex,
+                                              i,
+                                              expected,
+                                              numRemaining,
+                                              semaphore));
+
+        if (--burstSize == 0) {
+            bslmt::ThreadUtil::yield();
+            burstSize = 1 + (producerIndex + i) % maxBurstSize;
+        }
+    }
+}
+
+void StressUtil::execute(bsl::size_t       numProducers,
+                         bsl::size_t       numConsumers,
+                         bsl::size_t       numFunctors,
+                         bsl::size_t       maxBurstSize,
+                         bslma::Allocator* allocator)
+{
+    int rc;
+
+    bsl::shared_ptr<test::Executor> executor;
+    executor.createInplace(allocator, allocator);
+
+    bsl::shared_ptr<ntcs::Strand> strand;
+    strand.createInplace(allocator, executor, allocator);
+
+    bsl::vector<bsl::size_t> expected(numProducers, 0, allocator);
+    bsls::AtomicUint64       numRemaining(numProducers * numFunctors);
+    bslmt::Semaphore         semaphore;
+    bslmt::Barrier           barrier(numProducers + 1);
+
+    bslmt::ThreadGroup consumerThreadGroup(allocator);
+    bslmt::ThreadGroup producerThreadGroup(allocator);
+
+    for (bsl::size_t threadIndex = 0; threadIndex < numConsumers;
+         ++threadIndex)
+    {
+        rc = consumerThreadGroup.addThread(
+            bdlf::BindUtil::bindS(allocator,
+                                  &test::CurrentUtil::executeThread,
+                                  executor,
+                                  threadIndex));
+        NTCCFG_TEST_EQ(rc, 0);
+    }
+
+    for (bsl::size_t threadIndex = 0; threadIndex < numProducers;
+         ++threadIndex)
+    {
+        rc = producerThreadGroup.addThread(
+            bdlf::BindUtil::bindS(allocator,
+                                  &StressUtil::produce,
+                                  strand,
+                                  threadIndex,
+                                  numFunctors,
+                                  maxBurstSize,
+                                  &barrier,
+                                  &expected,
+                                  &numRemaining,
+                                  &semaphore,
+                                  allocator));
+        NTCCFG_TEST_EQ(rc, 0);
+    }
+
+    barrier.wait();
+
+    semaphore.wait();
+
+    producerThreadGroup.joinAll();
+
+    // Every functor has been invoked, so the strand has no functor pending
+    // and must not be activated again: once any activation still running
+    // completes, the number of activations no longer changes.
+
+    bslmt::ThreadUtil::microSleep(10000);
+    const bsl::uint64_t numActivations = executor->numExecuted();
+    bslmt::ThreadUtil::microSleep(10000);
+    NTCCFG_TEST_EQ(executor->numExecuted(), numActivations);
+
+    executor->stop();
+    consumerThreadGroup.joinAll();
+
+    for (bsl::size_t i = 0; i < numProducers; ++i) {
+        NTCCFG_TEST_EQ(expected[i], numFunctors);
+    }
+
+    BSLS_LOG_INFO("Strand stress: %d producers, %d consumers: "
+                  "%d functors invoked in %d activations",
+                  (int)(numProducers),
+                  (int)(numConsumers),
+                  (int)(numProducers * numFunctors),
+                  (int)(numActivations));
+}
+
+}  // close namespace test
+
+NTCCFG_TEST_CASE(5)
+{
+    // Concern: Functors deferred onto a strand by many producers
+    // concurrently, in bursts that allow the strand to repeatedly drain its
+    // queue while other producers are still linking functors into it, are
+    // each invoked exactly once, non-concurrently, in the order deferred by
+    // each producer, and the strand comes to rest once they have all been
+    // invoked.
+
+#if NTC_BUILD_FROM_CONTINUOUS_INTEGRATION == 0
+
+    const bsl::size_t NUM_FUNCTORS = 20000;
+
+#else
+
+    const bsl::size_t NUM_FUNCTORS = 1000;
+
+#endif
+
+    const bsl::size_t NUM_PRODUCERS  = 64;
+    const bsl::size_t NUM_CONSUMERS  = 8;
+    const bsl::size_t MAX_BURST_SIZE = 4;
+
+    ntccfg::TestAllocator ta;
+    {
+        bdlma::ConcurrentMultipoolAllocator memoryPools(8, &ta);
+
+        test::StressUtil::execute(NUM_PRODUCERS,
+                                  NUM_CONSUMERS,
+                                  NUM_FUNCTORS,
+                                  MAX_BURST_SIZE,
+                                  &memoryPools);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
     NTCCFG_TEST_REGISTER(2);
+    NTCCFG_TEST_REGISTER(3);
+    NTCCFG_TEST_REGISTER(4);
+    NTCCFG_TEST_REGISTER(5);
 }
 NTCCFG_TEST_DRIVER_END;
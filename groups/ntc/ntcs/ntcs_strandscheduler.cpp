@@ -0,0 +1,435 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_strandscheduler.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntcs_strandscheduler_cpp, "$Id$ $CSID$")
+
+#include <ntccfg_bind.h>
+#include <ntcs_async.h>
+#include <ntcs_strand.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bsls_assert.h>
+
+// The maximum number of strand activations run each time a thread processes
+// its queue, or steals from the queues of other threads, before the thread
+// yields to the detection and processing of the readiness of the sockets
+// driven by its reactor.
+#ifndef NTCS_STRANDSCHEDULER_MAX_BATCH_SIZE
+#define NTCS_STRANDSCHEDULER_MAX_BATCH_SIZE 16
+#endif
+
+// IMPLEMENTATION NOTES: Each strand created by this scheduler is activated
+// on the queue of its owning thread, and at most one activation of a strand
+// is ever queued or running, so whichever thread pops that activation runs
+// the strand exclusively. The owning thread pops activations from the front
+// of its queue, in the order they were queued; thieves pop from the back, so
+// that the strands most recently made ready, and least likely to run soon
+// on their owning thread, migrate first. A queue is stealable once the
+// thread that owns it is busy running a strand while another is queued, or
+// once it holds two or more activations. A thread is idle once it has found
+// nothing to run or steal; it is woken by the first thread to observe a
+// stealable queue, which claims it by clearing its idle flag, so an idle
+// thread is woken at most once until it becomes idle again. Stealing is an
+// optimization only: every activation is still run by its owning thread if
+// no other thread steals it first.
+
+namespace BloombergLP {
+namespace ntcs {
+
+StrandSchedulerQueue::StrandSchedulerQueue(ntcs::StrandScheduler* scheduler,
+                                           bsl::size_t            index,
+                                           bslma::Allocator* basicAllocator)
+: d_mutex(NTCCFG_LOCK_INIT)
+, d_functorQueue(basicAllocator)
+, d_executor_sp()
+, d_scheduled(false)
+, d_size(0)
+, d_busy(false)
+, d_idle(false)
+, d_scheduler_p(scheduler)
+, d_index(index)
+{
+}
+
+StrandSchedulerQueue::~StrandSchedulerQueue()
+{
+}
+
+void StrandSchedulerQueue::execute(const Functor& functor)
+{
+    d_scheduler_p->push(this, functor);
+}
+
+void StrandSchedulerQueue::moveAndExecute(FunctorSequence* functorSequence,
+                                          const Functor&   functor)
+{
+    for (FunctorSequence::iterator it = functorSequence->begin();
+         it != functorSequence->end();
+         ++it)
+    {
+        d_scheduler_p->push(this, *it);
+    }
+
+    functorSequence->clear();
+
+    if (functor) {
+        d_scheduler_p->push(this, functor);
+    }
+}
+
+void StrandScheduler::push(ntcs::StrandSchedulerQueue* queue,
+                           const Functor&              functor)
+{
+    bsl::shared_ptr<ntci::Executor> executor;
+    bool                            schedule = false;
+
+    {
+        StrandSchedulerQueue::LockGuard lock(&queue->d_mutex);
+
+        executor = queue->d_executor_sp;
+        if (executor) {
+            queue->d_functorQueue.push_back(functor);
+            queue->d_size.storeRelease(queue->d_functorQueue.size());
+
+            if (!queue->d_scheduled) {
+                queue->d_scheduled = true;
+                schedule           = true;
+            }
+        }
+    }
+
+    if (!executor) {
+        ntcs::Async::execute(functor);
+        return;
+    }
+
+    if (schedule) {
+        executor->execute(NTCCFG_BIND(&StrandScheduler::process,
+                                      this->getSelf(this),
+                                      queue->d_index));
+    }
+
+    if (StrandScheduler::isStealable(queue)) {
+        this->wake(queue->d_index);
+    }
+}
+
+void StrandScheduler::process(bsl::size_t index)
+{
+    StrandSchedulerQueue* queue = d_queueVector[index];
+
+    queue->d_idle.storeRelease(false);
+
+    Functor     functor;
+    bsl::size_t numInvoked = 0;
+
+    while (numInvoked < NTCS_STRANDSCHEDULER_MAX_BATCH_SIZE) {
+        if (!StrandScheduler::popFront(queue, &functor)) {
+            this->steal(index);
+            return;
+        }
+
+        StrandScheduler::invoke(queue, &functor);
+        ++numInvoked;
+    }
+
+    // The queue remains scheduled: yield to the reactor, then resume.
+
+    bsl::shared_ptr<ntci::Executor> executor;
+    {
+        StrandSchedulerQueue::LockGuard lock(&queue->d_mutex);
+        executor = queue->d_executor_sp;
+    }
+
+    if (executor) {
+        executor->execute(NTCCFG_BIND(&StrandScheduler::process,
+                                      this->getSelf(this),
+                                      index));
+    }
+}
+
+void StrandScheduler::steal(bsl::size_t index)
+{
+    StrandSchedulerQueue* queue = d_queueVector[index];
+
+    bsl::size_t numInvoked = 0;
+
+    while (true) {
+        if (queue->d_size.loadAcquire() != 0) {
+            // The thread has strands of its own to run, and is already
+            // scheduled to run them.
+            return;
+        }
+
+        if (numInvoked == NTCS_STRANDSCHEDULER_MAX_BATCH_SIZE) {
+            bsl::shared_ptr<ntci::Executor> executor;
+            {
+                StrandSchedulerQueue::LockGuard lock(&queue->d_mutex);
+                executor = queue->d_executor_sp;
+            }
+
+            if (executor) {
+                executor->execute(NTCCFG_BIND(&StrandScheduler::steal,
+                                              this->getSelf(this),
+                                              index));
+            }
+
+            return;
+        }
+
+        StrandSchedulerQueue* victim = this->victim(index);
+        if (victim == 0) {
+            // Become idle, unless a queue became stealable since it was
+            // last checked and this thread reclaims itself first.
+
+            queue->d_idle.storeRelease(true);
+
+            if (this->victim(index) == 0 ||
+                !queue->d_idle.testAndSwapAcqRel(true, false))
+            {
+                return;
+            }
+
+            continue;
+        }
+
+        Functor functor;
+        if (!StrandScheduler::popBack(victim, &functor)) {
+            continue;
+        }
+
+        d_numStolen.addRelaxed(1);
+
+        StrandScheduler::invoke(queue, &functor);
+        ++numInvoked;
+    }
+}
+
+void StrandScheduler::wake(bsl::size_t index)
+{
+    const bsl::size_t numQueues = d_queueVector.size();
+
+    for (bsl::size_t i = 1; i < numQueues; ++i) {
+        StrandSchedulerQueue* queue = d_queueVector[(index + i) % numQueues];
+
+        if (!queue->d_idle.loadRelaxed()) {
+            continue;
+        }
+
+        if (!queue->d_idle.testAndSwapAcqRel(true, false)) {
+            continue;
+        }
+
+        bsl::shared_ptr<ntci::Executor> executor;
+        {
+            StrandSchedulerQueue::LockGuard lock(&queue->d_mutex);
+            executor = queue->d_executor_sp;
+        }
+
+        if (executor) {
+            executor->execute(NTCCFG_BIND(&StrandScheduler::steal,
+                                          this->getSelf(this),
+                                          queue->d_index));
+            return;
+        }
+    }
+}
+
+ntcs::StrandSchedulerQueue* StrandScheduler::victim(bsl::size_t index) const
+{
+    StrandSchedulerQueue* result     = 0;
+    bsl::uint64_t         resultSize = 0;
+
+    for (bsl::size_t i = 0; i < d_queueVector.size(); ++i) {
+        if (i == index) {
+            continue;
+        }
+
+        StrandSchedulerQueue* queue = d_queueVector[i];
+
+        if (!StrandScheduler::isStealable(queue)) {
+            continue;
+        }
+
+        const bsl::uint64_t size = queue->d_size.loadAcquire();
+        if (size > resultSize) {
+            result     = queue;
+            resultSize = size;
+        }
+    }
+
+    return result;
+}
+
+void StrandScheduler::invoke(ntcs::StrandSchedulerQueue* queue,
+                             Functor*                    functor)
+{
+    queue->d_busy.storeRelease(true);
+
+    (*functor)();
+    *functor = Functor();
+
+    queue->d_busy.storeRelease(false);
+}
+
+bool StrandScheduler::popFront(ntcs::StrandSchedulerQueue* queue,
+                               Functor*                    result)
+{
+    StrandSchedulerQueue::LockGuard lock(&queue->d_mutex);
+
+    if (queue->d_functorQueue.empty()) {
+        queue->d_scheduled = false;
+        return false;
+    }
+
+    *result = queue->d_functorQueue.front();
+    queue->d_functorQueue.pop_front();
+    queue->d_size.storeRelease(queue->d_functorQueue.size());
+
+    return true;
+}
+
+bool StrandScheduler::popBack(ntcs::StrandSchedulerQueue* queue,
+                              Functor*                    result)
+{
+    StrandSchedulerQueue::LockGuard lock(&queue->d_mutex);
+
+    if (queue->d_functorQueue.empty()) {
+        return false;
+    }
+
+    *result = queue->d_functorQueue.back();
+    queue->d_functorQueue.pop_back();
+    queue->d_size.storeRelease(queue->d_functorQueue.size());
+
+    return true;
+}
+
+bool StrandScheduler::isStealable(const ntcs::StrandSchedulerQueue* queue)
+{
+    const bsl::uint64_t size = queue->d_size.loadAcquire();
+
+    return size > 1 || (size == 1 && queue->d_busy.loadAcquire());
+}
+
+StrandScheduler::StrandScheduler(bsl::size_t       maxThreads,
+                                 bslma::Allocator* basicAllocator)
+: d_object("ntcs::StrandScheduler")
+, d_queueVector(basicAllocator)
+, d_numStolen(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_OPT(maxThreads > 0);
+
+    d_queueVector.reserve(maxThreads);
+
+    for (bsl::size_t i = 0; i < maxThreads; ++i) {
+        StrandSchedulerQueue* queue = new (*d_allocator_p)
+            StrandSchedulerQueue(this, i, d_allocator_p);
+
+        d_queueVector.push_back(queue);
+    }
+}
+
+StrandScheduler::~StrandScheduler()
+{
+    this->clear();
+
+    for (bsl::size_t i = 0; i < d_queueVector.size(); ++i) {
+        d_allocator_p->deleteObject(d_queueVector[i]);
+    }
+
+    d_queueVector.clear();
+}
+
+void StrandScheduler::attach(bsl::size_t                            threadIndex,
+                             const bsl::shared_ptr<ntci::Executor>& executor)
+{
+    BSLS_ASSERT_OPT(threadIndex < d_queueVector.size());
+
+    StrandSchedulerQueue* queue = d_queueVector[threadIndex];
+
+    {
+        StrandSchedulerQueue::LockGuard lock(&queue->d_mutex);
+        queue->d_executor_sp = executor;
+    }
+
+    queue->d_idle.storeRelease(true);
+}
+
+bsl::shared_ptr<ntci::Strand> StrandScheduler::createStrand(
+    const bsl::shared_ptr<ntci::Executor>& executor,
+    bslma::Allocator*                      basicAllocator)
+{
+    bslma::Allocator* allocator = bslma::Default::allocator(basicAllocator);
+
+    StrandSchedulerQueue* result = 0;
+
+    for (bsl::size_t i = 0; i < d_queueVector.size(); ++i) {
+        StrandSchedulerQueue* queue = d_queueVector[i];
+
+        StrandSchedulerQueue::LockGuard lock(&queue->d_mutex);
+        if (queue->d_executor_sp && queue->d_executor_sp == executor) {
+            result = queue;
+            break;
+        }
+    }
+
+    if (result == 0) {
+        return bsl::shared_ptr<ntci::Strand>();
+    }
+
+    // The strand observes its queue through a pointer that shares ownership
+    // of this scheduler, so the queue outlives any activation in progress.
+
+    bsl::shared_ptr<ntci::Executor> queue(this->getSelf(this), result);
+
+    bsl::shared_ptr<ntcs::Strand> strand;
+    strand.createInplace(allocator, queue, allocator);
+
+    return strand;
+}
+
+void StrandScheduler::clear()
+{
+    for (bsl::size_t i = 0; i < d_queueVector.size(); ++i) {
+        StrandSchedulerQueue* queue = d_queueVector[i];
+
+        StrandSchedulerQueue::FunctorQueue functorQueue(d_allocator_p);
+        bsl::shared_ptr<ntci::Executor>    executor;
+        {
+            StrandSchedulerQueue::LockGuard lock(&queue->d_mutex);
+
+            functorQueue.swap(queue->d_functorQueue);
+            executor.swap(queue->d_executor_sp);
+
+            queue->d_scheduled = false;
+            queue->d_size.storeRelease(0);
+        }
+
+        queue->d_idle.storeRelease(false);
+    }
+}
+
+bsl::uint64_t StrandScheduler::numStolen() const
+{
+    return d_numStolen.loadRelaxed();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,226 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCS_STRANDSCHEDULER
+#define INCLUDED_NTCS_STRANDSCHEDULER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_platform.h>
+#include <ntci_executor.h>
+#include <ntci_strand.h>
+#include <ntcscm_version.h>
+#include <bsls_atomic.h>
+#include <bsl_deque.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ntcs {
+
+class StrandScheduler;
+
+/// @internal @brief
+/// Provide a queue of strands ready to run on behalf of one thread.
+///
+/// @details
+/// Provide an executor, used by each strand created by an
+/// 'ntcs::StrandScheduler' for a particular thread, that queues the
+/// activation of each strand that has functions ready to run. The activations
+/// are run in the order they are queued by the thread that owns the queue,
+/// unless they are stolen by another thread first.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntcs
+class StrandSchedulerQueue : public ntci::Executor
+{
+    /// Define a type alias for a queue of strand activations.
+    typedef bsl::deque<Functor> FunctorQueue;
+
+    /// Define a type alias for a mutex.
+    typedef ntccfg::Mutex Mutex;
+
+    /// Define a type alias for a mutex lock guard.
+    typedef ntccfg::LockGuard LockGuard;
+
+    mutable Mutex                   d_mutex;
+    FunctorQueue                    d_functorQueue;
+    bsl::shared_ptr<ntci::Executor> d_executor_sp;
+    bool                            d_scheduled;
+    bsls::AtomicUint64              d_size;
+    bsls::AtomicBool                d_busy;
+    bsls::AtomicBool                d_idle;
+    ntcs::StrandScheduler*          d_scheduler_p;
+    bsl::size_t                     d_index;
+
+    friend class StrandScheduler;
+
+  private:
+    StrandSchedulerQueue(const StrandSchedulerQueue&) BSLS_KEYWORD_DELETED;
+    StrandSchedulerQueue& operator=(const StrandSchedulerQueue&)
+        BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new queue having the specified 'index' in the specified
+    /// 'scheduler'. Optionally specify a 'basicAllocator' used to supply
+    /// memory. If 'basicAllocator' is 0, the currently installed default
+    /// allocator is used.
+    StrandSchedulerQueue(ntcs::StrandScheduler* scheduler,
+                         bsl::size_t            index,
+                         bslma::Allocator*      basicAllocator = 0);
+
+    /// Destroy this object.
+    ~StrandSchedulerQueue() BSLS_KEYWORD_OVERRIDE;
+
+    /// Defer the execution of the specified 'functor'.
+    void execute(const Functor& functor) BSLS_KEYWORD_OVERRIDE;
+
+    /// Atomically defer the execution of the specified 'functorSequence'
+    /// immediately followed by the specified 'functor', then clear the
+    /// 'functorSequence'.
+    void moveAndExecute(FunctorSequence* functorSequence,
+                        const Functor&   functor) BSLS_KEYWORD_OVERRIDE;
+};
+
+/// @internal @brief
+/// Provide a scheduler of strands that balances work across threads by
+/// stealing.
+///
+/// @details
+/// Provide a mechanism to create strands whose functions are run by the
+/// thread that owns the strand, i.e., the thread that drives the reactor
+/// that detects the readiness of the socket whose callbacks are invoked on
+/// the strand, or by any other thread that would otherwise be idle. Each
+/// thread owns a double-ended queue of the strands it owns that have
+/// functions ready to run. The owning thread runs the strands from the front
+/// of its queue. When a strand is queued to a thread that is already busy
+/// running a strand, or whose queue already holds another strand, one idle
+/// thread is woken through its own executor to steal strands from the back
+/// of the busiest queue. A strand is only ever queued once at a time, and a
+/// stolen strand runs its next batch of functions to completion on the
+/// thief then re-queues itself to its owning thread, so the functions of
+/// each strand are never run concurrently or out of order, regardless of
+/// the thread that runs them.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntcs
+class StrandScheduler : public ntccfg::Shared<StrandScheduler>
+{
+    /// Define a type alias for a vector of queues.
+    typedef bsl::vector<ntcs::StrandSchedulerQueue*> QueueVector;
+
+    /// Define a type alias for a functor.
+    typedef ntci::Executor::Functor Functor;
+
+    ntccfg::Object     d_object;
+    QueueVector        d_queueVector;
+    bsls::AtomicUint64 d_numStolen;
+    bslma::Allocator*  d_allocator_p;
+
+    friend class StrandSchedulerQueue;
+
+  private:
+    StrandScheduler(const StrandScheduler&) BSLS_KEYWORD_DELETED;
+    StrandScheduler& operator=(const StrandScheduler&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Queue the specified 'functor', which activates a strand, to the
+    /// specified 'queue', scheduling the thread that owns the 'queue' to
+    /// run it and waking an idle thread to steal it if the owning thread is
+    /// busy.
+    void push(ntcs::StrandSchedulerQueue* queue, const Functor& functor);
+
+    /// Run the strands queued to the queue at the specified 'index' on the
+    /// calling thread, which owns that queue, then steal strands from other
+    /// queues if the queue is empty.
+    void process(bsl::size_t index);
+
+    /// Steal and run strands queued to queues other than the queue at the
+    /// specified 'index' on the calling thread, which owns that queue,
+    /// until no queue has strands to steal or the queue at 'index' has
+    /// strands of its own to run.
+    void steal(bsl::size_t index);
+
+    /// Wake an idle thread, other than the thread owning the queue at the
+    /// specified 'index', to steal strands.
+    void wake(bsl::size_t index);
+
+    /// Return the queue, other than the queue at the specified 'index',
+    /// from which strands should be stolen, or 0 if no queue has strands
+    /// to steal.
+    ntcs::StrandSchedulerQueue* victim(bsl::size_t index) const;
+
+    /// Invoke the specified 'functor' on behalf of the specified 'queue'
+    /// and reset the 'functor'.
+    static void invoke(ntcs::StrandSchedulerQueue* queue, Functor* functor);
+
+    /// Pop the functor at the front of the specified 'queue' and load it
+    /// into the specified 'result'. Return true if a functor was popped,
+    /// and false otherwise. If the queue is empty, mark the queue as no
+    /// longer scheduled to be processed by its owning thread.
+    static bool popFront(ntcs::StrandSchedulerQueue* queue, Functor* result);
+
+    /// Pop the functor at the back of the specified 'queue' and load it
+    /// into the specified 'result'. Return true if a functor was popped,
+    /// and false otherwise.
+    static bool popBack(ntcs::StrandSchedulerQueue* queue, Functor* result);
+
+    /// Return true if strands queued to the specified 'queue' should be
+    /// stolen by other threads, otherwise return false.
+    static bool isStealable(const ntcs::StrandSchedulerQueue* queue);
+
+  public:
+    /// Create a new strand scheduler for at most the specified 'maxThreads'.
+    /// Optionally specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
+    explicit StrandScheduler(bsl::size_t       maxThreads,
+                             bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~StrandScheduler();
+
+    /// Attach the specified 'executor', driven only by the thread having
+    /// the specified 'threadIndex', to this scheduler. The behavior is
+    /// undefined unless 'threadIndex' is less than the maximum number of
+    /// threads.
+    void attach(bsl::size_t                            threadIndex,
+                const bsl::shared_ptr<ntci::Executor>& executor);
+
+    /// Return a new strand owned by the thread that drives the specified
+    /// 'executor'. Optionally specify a 'basicAllocator' used to supply
+    /// memory. If 'basicAllocator' is 0, the currently installed default
+    /// allocator is used. Return null if the 'executor' is not attached to
+    /// this scheduler.
+    bsl::shared_ptr<ntci::Strand> createStrand(
+        const bsl::shared_ptr<ntci::Executor>& executor,
+        bslma::Allocator*                      basicAllocator = 0);
+
+    /// Discard each queued strand activation and detach each executor.
+    void clear();
+
+    /// Return the number of strand activations stolen by a thread other
+    /// than the thread that owns the strand.
+    bsl::uint64_t numStolen() const;
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
@@ -0,0 +1,342 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_strandscheduler.h>
+
+#include <ntccfg_test.h>
+#include <ntci_executor.h>
+#include <ntci_strand.h>
+#include <bdlf_bind.h>
+#include <bslmt_condition.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace test {
+
+/// Provide an interface to execute a function.
+class Executor : public ntci::Executor
+{
+    bslmt::Mutex      d_functorQueueMutex;
+    bslmt::Condition  d_functorQueueCondition;
+    FunctorSequence   d_functorQueue;
+    bool              d_stop;
+    bslma::Allocator* d_allocator_p;
+
+  private:
+    Executor(const Executor&) BSLS_KEYWORD_DELETED;
+    Executor& operator=(const Executor&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new executor. Optionally specify a 'basicAllocator' used
+    /// to supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used.
+    explicit Executor(bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~Executor() BSLS_KEYWORD_OVERRIDE;
+
+    /// Block until a job is available then execute it.
+    void run();
+
+    /// Unblock all threads running this object.
+    void stop();
+
+    /// Defer the execution of the specified 'functor'.
+    void execute(const Functor& functor) BSLS_KEYWORD_OVERRIDE;
+
+    /// Atomically defer the execution of the specified 'functorSequence'
+    /// immediately followed by the specified 'functor', then clear the
+    /// 'functorSequence'.
+    void moveAndExecute(FunctorSequence* functorSequence,
+                        const Functor&   functor) BSLS_KEYWORD_OVERRIDE;
+};
+
+Executor::Executor(bslma::Allocator* basicAllocator)
+: d_functorQueueMutex()
+, d_functorQueueCondition()
+, d_functorQueue(basicAllocator)
+, d_stop(false)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+Executor::~Executor()
+{
+}
+
+void Executor::run()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_functorQueueMutex);
+
+    while (!d_stop) {
+        if (d_functorQueue.empty()) {
+            d_functorQueueCondition.wait(&d_functorQueueMutex);
+        }
+        else {
+            FunctorSequence functorQueue(d_allocator_p);
+            functorQueue.swap(d_functorQueue);
+
+            {
+                bslmt::UnLockGuard<bslmt::Mutex> unlockGuard(
+                    &d_functorQueueMutex);
+
+                for (FunctorSequence::iterator it = functorQueue.begin();
+                     it != functorQueue.end();
+                     ++it)
+                {
+                    (*it)();
+                }
+            }
+        }
+    }
+
+    d_functorQueue.clear();
+}
+
+void Executor::stop()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_functorQueueMutex);
+    d_stop = true;
+    d_functorQueueCondition.broadcast();
+}
+
+void Executor::execute(const Functor& functor)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_functorQueueMutex);
+    d_functorQueue.push_back(functor);
+
+    d_functorQueueCondition.signal();
+}
+
+void Executor::moveAndExecute(FunctorSequence* functorSequence,
+                              const Functor&   functor)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_functorQueueMutex);
+
+    d_functorQueue.splice(d_functorQueue.end(), *functorSequence);
+    if (functor) {
+        d_functorQueue.push_back(functor);
+    }
+
+    d_functorQueueCondition.signal();
+}
+
+// Run the specified 'executor' on the calling thread until it is stopped.
+void run(test::Executor* executor)
+{
+    executor->run();
+}
+
+// Load the identifier of the calling thread into the specified 'owner',
+// post to the specified 'started' semaphore, then wait on the specified
+// 'release' semaphore.
+void block(bsl::uint64_t*    owner,
+           bslmt::Semaphore* started,
+           bslmt::Semaphore* release)
+{
+    *owner = bslmt::ThreadUtil::selfIdAsUint64();
+    started->post();
+    release->wait();
+}
+
+// Append the specified 'index' to the specified 'sequence' and the
+// identifier of the calling thread to the specified 'threads', then post to
+// the specified 'semaphore'.
+void record(bsl::vector<bsl::size_t>*   sequence,
+            bsl::vector<bsl::uint64_t>* threads,
+            bsl::size_t                 index,
+            bslmt::Semaphore*           semaphore)
+{
+    sequence->push_back(index);
+    threads->push_back(bslmt::ThreadUtil::selfIdAsUint64());
+    semaphore->post();
+}
+
+}  // close namespace test
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Strands owned by a single thread run their functions in the
+    // order they were executed, and nothing is stolen.
+
+    ntccfg::TestAllocator ta;
+    {
+        const bsl::size_t k_NUM_STRANDS   = 2;
+        const bsl::size_t k_NUM_FUNCTIONS = 100;
+
+        bsl::shared_ptr<test::Executor> executor;
+        executor.createInplace(&ta, &ta);
+
+        bsl::shared_ptr<test::Executor> other;
+        other.createInplace(&ta, &ta);
+
+        bsl::shared_ptr<ntcs::StrandScheduler> scheduler;
+        scheduler.createInplace(&ta, 1, &ta);
+
+        NTCCFG_TEST_FALSE(scheduler->createStrand(executor, &ta));
+
+        scheduler->attach(0, executor);
+
+        NTCCFG_TEST_FALSE(scheduler->createStrand(other, &ta));
+
+        bslmt::ThreadGroup threadGroup(&ta);
+        threadGroup.addThread(
+            bdlf::BindUtil::bind(&test::run, executor.get()));
+
+        bslmt::Semaphore semaphore;
+
+        bsl::vector<bsl::shared_ptr<ntci::Strand> > strands(&ta);
+        bsl::vector<bsl::vector<bsl::size_t> >      sequences(&ta);
+        bsl::vector<bsl::vector<bsl::uint64_t> >    threads(&ta);
+
+        sequences.resize(k_NUM_STRANDS);
+        threads.resize(k_NUM_STRANDS);
+
+        for (bsl::size_t i = 0; i < k_NUM_STRANDS; ++i) {
+            bsl::shared_ptr<ntci::Strand> strand =
+                scheduler->createStrand(executor, &ta);
+            NTCCFG_TEST_TRUE(strand);
+
+            strands.push_back(strand);
+        }
+
+        for (bsl::size_t j = 0; j < k_NUM_FUNCTIONS; ++j) {
+            for (bsl::size_t i = 0; i < k_NUM_STRANDS; ++i) {
+                strands[i]->execute(bdlf::BindUtil::bind(&test::record,
+                                                         &sequences[i],
+                                                         &threads[i],
+                                                         j,
+                                                         &semaphore));
+            }
+        }
+
+        for (bsl::size_t i = 0; i < k_NUM_STRANDS * k_NUM_FUNCTIONS; ++i) {
+            semaphore.wait();
+        }
+
+        for (bsl::size_t i = 0; i < k_NUM_STRANDS; ++i) {
+            NTCCFG_TEST_EQ(sequences[i].size(), k_NUM_FUNCTIONS);
+            for (bsl::size_t j = 0; j < sequences[i].size(); ++j) {
+                NTCCFG_TEST_EQ(sequences[i][j], j);
+            }
+        }
+
+        NTCCFG_TEST_EQ(scheduler->numStolen(), 0);
+
+        executor->stop();
+        threadGroup.joinAll();
+
+        scheduler->clear();
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: A strand queued to a thread that is busy running another
+    // strand is stolen by an idle thread, and the functions of the stolen
+    // strand run in the order they were executed.
+
+    ntccfg::TestAllocator ta;
+    {
+        const bsl::size_t k_NUM_FUNCTIONS = 100;
+
+        bsl::shared_ptr<test::Executor> busyExecutor;
+        busyExecutor.createInplace(&ta, &ta);
+
+        bsl::shared_ptr<test::Executor> idleExecutor;
+        idleExecutor.createInplace(&ta, &ta);
+
+        bsl::shared_ptr<ntcs::StrandScheduler> scheduler;
+        scheduler.createInplace(&ta, 2, &ta);
+
+        scheduler->attach(0, busyExecutor);
+        scheduler->attach(1, idleExecutor);
+
+        bslmt::ThreadGroup threadGroup(&ta);
+        threadGroup.addThread(
+            bdlf::BindUtil::bind(&test::run, busyExecutor.get()));
+        threadGroup.addThread(
+            bdlf::BindUtil::bind(&test::run, idleExecutor.get()));
+
+        bsl::shared_ptr<ntci::Strand> blockedStrand =
+            scheduler->createStrand(busyExecutor, &ta);
+        NTCCFG_TEST_TRUE(blockedStrand);
+
+        bsl::shared_ptr<ntci::Strand> stolenStrand =
+            scheduler->createStrand(busyExecutor, &ta);
+        NTCCFG_TEST_TRUE(stolenStrand);
+
+        // Block the thread that owns both strands.
+
+        bsl::uint64_t    owner = 0;
+        bslmt::Semaphore started;
+        bslmt::Semaphore release;
+
+        blockedStrand->execute(
+            bdlf::BindUtil::bind(&test::block, &owner, &started, &release));
+
+        started.wait();
+
+        // Execute functions on the other strand, which can only complete
+        // while the owning thread is blocked if that strand is stolen.
+
+        bslmt::Semaphore           semaphore;
+        bsl::vector<bsl::size_t>   sequence(&ta);
+        bsl::vector<bsl::uint64_t> threads(&ta);
+
+        for (bsl::size_t i = 0; i < k_NUM_FUNCTIONS; ++i) {
+            stolenStrand->execute(bdlf::BindUtil::bind(&test::record,
+                                                       &sequence,
+                                                       &threads,
+                                                       i,
+                                                       &semaphore));
+        }
+
+        for (bsl::size_t i = 0; i < k_NUM_FUNCTIONS; ++i) {
+            semaphore.wait();
+        }
+
+        release.post();
+
+        NTCCFG_TEST_EQ(sequence.size(), k_NUM_FUNCTIONS);
+        for (bsl::size_t i = 0; i < sequence.size(); ++i) {
+            NTCCFG_TEST_EQ(sequence[i], i);
+            NTCCFG_TEST_NE(threads[i], owner);
+        }
+
+        NTCCFG_TEST_GT(scheduler->numStolen(), 0);
+
+        busyExecutor->stop();
+        idleExecutor->stop();
+        threadGroup.joinAll();
+
+        scheduler->clear();
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+}
+NTCCFG_TEST_DRIVER_END;
@@ -0,0 +1,71 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_timerwheel.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntcs_timerwheel_cpp, "$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace ntcs {
+
+int TimerWheelUtil::level(bsls::Types::Int64 tick, bsls::Types::Int64 current)
+{
+    BSLS_ASSERT(tick > current);
+
+    // The level is the most significant group of 'k_BITS_PER_LEVEL' bits in
+    // which the tick differs from the current tick: all more significant
+    // groups are shared, so the slot at that level is reached before any
+    // higher level wraps.
+
+    const bsls::Types::Uint64 difference =
+        static_cast<bsls::Types::Uint64>(tick) ^
+        static_cast<bsls::Types::Uint64>(current);
+
+    const int highestBit =
+        63 - bdlb::BitUtil::numLeadingUnsetBits(difference);
+
+    return highestBit / k_BITS_PER_LEVEL;
+}
+
+int TimerWheelUtil::lowestSlot(bsls::Types::Uint64 mask)
+{
+    BSLS_ASSERT(mask != 0);
+
+    return bdlb::BitUtil::numTrailingUnsetBits(mask);
+}
+
+bsls::Types::Uint64 TimerWheelUtil::slotRange(int first, int last)
+{
+    BSLS_ASSERT(0 <= first);
+    BSLS_ASSERT(first <= last);
+    BSLS_ASSERT(last < k_NUM_SLOTS);
+
+    const bsls::Types::Uint64 upper =
+        last == k_NUM_SLOTS - 1
+            ? ~bsls::Types::Uint64(0)
+            : (bsls::Types::Uint64(1) << (last + 1)) - 1;
+
+    const bsls::Types::Uint64 lower = (bsls::Types::Uint64(1) << first) - 1;
+
+    return upper & ~lower;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
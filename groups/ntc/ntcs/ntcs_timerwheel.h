@@ -0,0 +1,679 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCS_TIMERWHEEL
+#define INCLUDED_NTCS_TIMERWHEEL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntcscm_version.h>
+
+#include <bdlma_pool.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+#include <bsl_climits.h>
+#include <bsl_new.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ntcs {
+
+template <class DATA>
+class TimerWheel;
+
+/// @internal @brief
+/// Provide utilities for the implementation of timer wheels.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntcs
+struct TimerWheelUtil {
+    enum {
+        /// The number of bits of a tick consumed by each level.
+        k_BITS_PER_LEVEL = 6,
+
+        /// The number of slots at each level.
+        k_NUM_SLOTS = 1 << k_BITS_PER_LEVEL,
+
+        /// The number of levels required to represent any non-negative
+        /// 64-bit tick.
+        k_NUM_LEVELS = (63 + k_BITS_PER_LEVEL - 1) / k_BITS_PER_LEVEL,
+
+        /// The level of an entry stored on the due list.
+        k_LEVEL_DUE = -1,
+
+        /// The level of an entry not stored in any slot or list.
+        k_LEVEL_DETACHED = -2
+    };
+
+    /// Return the tick at or after the specified 'key' for the specified
+    /// 'resolution', so that an entry is never considered due before its
+    /// key. Negative keys map to tick zero. The behavior is undefined
+    /// unless 'resolution > 0'.
+    static bsls::Types::Int64 ceilTick(bsls::Types::Int64 key,
+                                       bsls::Types::Int64 resolution);
+
+    /// Return the tick at or before the specified 'key' for the specified
+    /// 'resolution'. Negative keys map to tick zero. The behavior is
+    /// undefined unless 'resolution > 0'.
+    static bsls::Types::Int64 floorTick(bsls::Types::Int64 key,
+                                        bsls::Types::Int64 resolution);
+
+    /// Return the key at the start of the specified 'tick' for the
+    /// specified 'resolution', saturating at the maximum 64-bit integer.
+    static bsls::Types::Int64 key(bsls::Types::Int64 tick,
+                                  bsls::Types::Int64 resolution);
+
+    /// Return the level at which an entry due at the specified 'tick' is
+    /// stored when the wheel is at the specified 'current' tick. The
+    /// behavior is undefined unless 'tick > current'.
+    static int level(bsls::Types::Int64 tick, bsls::Types::Int64 current);
+
+    /// Return the index of the lowest set bit in the specified 'mask'. The
+    /// behavior is undefined unless 'mask != 0'.
+    static int lowestSlot(bsls::Types::Uint64 mask);
+
+    /// Return the mask of slots in the inclusive range '[first, last]'.
+    /// The behavior is undefined unless '0 <= first <= last < 64'.
+    static bsls::Types::Uint64 slotRange(int first, int last);
+};
+
+/// @internal @brief
+/// Describe a key-value pair stored in a timer wheel.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntcs
+template <class DATA>
+class TimerWheelPair
+{
+    bsls::Types::Int64 d_key;
+    bsls::Types::Int64 d_tick;
+    TimerWheelPair*    d_prev_p;
+    TimerWheelPair*    d_next_p;
+    int                d_level;
+    int                d_slot;
+    DATA               d_data;
+
+    friend class TimerWheel<DATA>;
+
+  private:
+    TimerWheelPair(const TimerWheelPair&) BSLS_KEYWORD_DELETED;
+    TimerWheelPair& operator=(const TimerWheelPair&) BSLS_KEYWORD_DELETED;
+
+    /// Create a new pair having the specified 'key' and 'data'.
+    TimerWheelPair(bsls::Types::Int64 key, const DATA& data);
+
+  public:
+    /// Return a reference to the modifiable data of this pair.
+    DATA& data();
+
+    /// Return a reference to the non-modifiable data of this pair.
+    const DATA& data() const;
+
+    /// Return the key of this pair.
+    bsls::Types::Int64 key() const;
+};
+
+/// @internal @brief
+/// Provide a hierarchical timing wheel of key-value pairs ordered by an
+/// integral key.
+///
+/// @details
+/// This class provides an alternative to 'ntcs::SkipList' for indexing
+/// deadlines when very many are outstanding. Keys are quantized into ticks
+/// of a fixed resolution; each tick is rounded up so that a pair is never
+/// considered due before its key. The wheel is organized as
+/// 'TimerWheelUtil::k_NUM_LEVELS' levels of 'TimerWheelUtil::k_NUM_SLOTS'
+/// slots, where each level covers a range of ticks 64 times wider than the
+/// level below it, so that pairs may be added, updated, and removed in
+/// constant time regardless of the number of pairs in the wheel. Pairs
+/// stored at higher levels are redistributed to lower levels as the wheel
+/// advances past them.
+///
+/// The price of constant-time maintenance is precision: pairs that fall due
+/// within the same tick are popped in the order in which they were placed
+/// into the slot from which they became due, which is not necessarily the
+/// order of their keys, and the earliest time reported by the wheel is
+/// only the time at which the wheel must next be advanced.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntcs
+template <class DATA>
+class TimerWheel
+{
+  public:
+    /// Define a type alias for a key-value pair stored in this wheel.
+    typedef TimerWheelPair<DATA> Pair;
+
+  private:
+    enum {
+        k_BITS_PER_LEVEL = TimerWheelUtil::k_BITS_PER_LEVEL,
+        k_NUM_SLOTS      = TimerWheelUtil::k_NUM_SLOTS,
+        k_NUM_LEVELS     = TimerWheelUtil::k_NUM_LEVELS,
+        k_LEVEL_DUE      = TimerWheelUtil::k_LEVEL_DUE,
+        k_LEVEL_DETACHED = TimerWheelUtil::k_LEVEL_DETACHED
+    };
+
+    Pair*               d_slots[k_NUM_LEVELS][k_NUM_SLOTS];
+    bsls::Types::Uint64 d_occupied[k_NUM_LEVELS];
+    Pair*               d_due_p;
+    bsls::Types::Int64  d_resolution;
+    bsls::Types::Int64  d_current;
+    int                 d_length;
+    bdlma::Pool         d_pool;
+
+  private:
+    TimerWheel(const TimerWheel&) BSLS_KEYWORD_DELETED;
+    TimerWheel& operator=(const TimerWheel&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Append the specified 'pair' to the specified circular 'list'.
+    static void pushList(Pair** list, Pair* pair);
+
+    /// Remove the specified 'pair' from the specified circular 'list'.
+    static void popList(Pair** list, Pair* pair);
+
+    /// Place the specified 'pair' into the slot determined by its tick
+    /// relative to the current tick, or onto the due list if its tick has
+    /// been reached.
+    void attach(Pair* pair);
+
+    /// Remove the specified 'pair' from the slot or due list in which it
+    /// is stored, if any.
+    void detach(Pair* pair);
+
+    /// Advance the current tick to the specified 'tick', redistributing
+    /// each pair stored in a slot that is passed over.
+    void advance(bsls::Types::Int64 tick);
+
+  public:
+    /// Create a new timer wheel whose ticks have the specified
+    /// 'resolution' and whose current tick contains the specified 'now'.
+    /// Optionally specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used. The behavior is undefined unless 'resolution > 0'.
+    TimerWheel(bsls::Types::Int64 resolution,
+               bsls::Types::Int64 now,
+               bslma::Allocator*  basicAllocator = 0);
+
+    /// Destroy this object.
+    ~TimerWheel();
+
+    /// Add a pair having the specified 'key' and 'data' to this wheel and
+    /// return the pair. Optionally specify a 'newFrontFlag' that is set to
+    /// true if the earliest time at which the wheel must be advanced
+    /// decreased as a result of this operation, and false otherwise.
+    Pair* add(bsls::Types::Int64 key,
+              const DATA&        data,
+              bool*              newFrontFlag = 0);
+
+    /// Change the key of the specified 'pair' to the specified 'key'. The
+    /// 'pair' may be either stored in this wheel or previously returned
+    /// from 'popDue'. Optionally specify a 'newFrontFlag' that is set to
+    /// true if the earliest time at which the wheel must be advanced
+    /// decreased as a result of this operation, and false otherwise.
+    void update(Pair* pair, bsls::Types::Int64 key, bool* newFrontFlag = 0);
+
+    /// Remove the specified 'pair' from this wheel, if stored in the wheel,
+    /// and destroy it. The 'pair' may also be a pair previously returned
+    /// from 'popDue'.
+    void remove(Pair* pair);
+
+    /// Remove and destroy all pairs in this wheel and release the memory
+    /// of those returned from 'popDue' but not yet updated or removed.
+    /// Note that the data of such pairs is not destroyed.
+    void removeAll();
+
+    /// Advance the wheel to the tick containing the specified 'now' and
+    /// return a pair whose key has been reached, leaving the pair owned by
+    /// this wheel but no longer stored in any slot, or 0 if no such pair
+    /// exists. The returned pair must later be passed to either 'update'
+    /// or 'remove'.
+    Pair* popDue(bsls::Types::Int64 now);
+
+    /// Load into the specified 'result' each pair stored in this wheel,
+    /// in no particular order. Pairs returned from 'popDue' are not
+    /// loaded.
+    void load(bsl::vector<Pair*>* result) const;
+
+    /// Load into the specified 'result' the earliest time at which the
+    /// wheel must next be advanced: either the start of the tick in which
+    /// the earliest pair stored in the lowest level becomes due, or the
+    /// start of the tick at which pairs stored in a higher level must be
+    /// redistributed. Return true if the wheel stores at least one pair,
+    /// and false otherwise. Note that the result is never more than one
+    /// tick later than the earliest key stored in the wheel.
+    bool earliest(bsls::Types::Int64* result) const;
+
+    /// Return the resolution of each tick.
+    bsls::Types::Int64 resolution() const;
+
+    /// Return the number of pairs owned by this wheel.
+    int length() const;
+
+    /// Return true if this wheel owns no pairs, and false otherwise.
+    bool isEmpty() const;
+};
+
+inline bsls::Types::Int64 TimerWheelUtil::ceilTick(
+    bsls::Types::Int64 key,
+    bsls::Types::Int64 resolution)
+{
+    BSLS_ASSERT(resolution > 0);
+
+    if (key <= 0) {
+        return 0;
+    }
+
+    return key / resolution + (key % resolution != 0 ? 1 : 0);
+}
+
+inline bsls::Types::Int64 TimerWheelUtil::floorTick(
+    bsls::Types::Int64 key,
+    bsls::Types::Int64 resolution)
+{
+    BSLS_ASSERT(resolution > 0);
+
+    if (key <= 0) {
+        return 0;
+    }
+
+    return key / resolution;
+}
+
+inline bsls::Types::Int64 TimerWheelUtil::key(bsls::Types::Int64 tick,
+                                              bsls::Types::Int64 resolution)
+{
+    if (tick > LLONG_MAX / resolution) {
+        return LLONG_MAX;
+    }
+
+    return tick * resolution;
+}
+
+template <class DATA>
+inline TimerWheelPair<DATA>::TimerWheelPair(bsls::Types::Int64 key,
+                                            const DATA&        data)
+: d_key(key)
+, d_tick(0)
+, d_prev_p(0)
+, d_next_p(0)
+, d_level(TimerWheelUtil::k_LEVEL_DETACHED)
+, d_slot(0)
+, d_data(data)
+{
+}
+
+template <class DATA>
+inline DATA& TimerWheelPair<DATA>::data()
+{
+    return d_data;
+}
+
+template <class DATA>
+inline const DATA& TimerWheelPair<DATA>::data() const
+{
+    return d_data;
+}
+
+template <class DATA>
+inline bsls::Types::Int64 TimerWheelPair<DATA>::key() const
+{
+    return d_key;
+}
+
+template <class DATA>
+inline void TimerWheel<DATA>::pushList(Pair** list, Pair* pair)
+{
+    Pair* head = *list;
+
+    if (head == 0) {
+        pair->d_prev_p = pair;
+        pair->d_next_p = pair;
+        *list          = pair;
+    }
+    else {
+        Pair* tail = head->d_prev_p;
+
+        pair->d_prev_p = tail;
+        pair->d_next_p = head;
+        tail->d_next_p = pair;
+        head->d_prev_p = pair;
+    }
+}
+
+template <class DATA>
+inline void TimerWheel<DATA>::popList(Pair** list, Pair* pair)
+{
+    if (pair->d_next_p == pair) {
+        *list = 0;
+    }
+    else {
+        pair->d_prev_p->d_next_p = pair->d_next_p;
+        pair->d_next_p->d_prev_p = pair->d_prev_p;
+
+        if (*list == pair) {
+            *list = pair->d_next_p;
+        }
+    }
+
+    pair->d_prev_p = 0;
+    pair->d_next_p = 0;
+}
+
+template <class DATA>
+void TimerWheel<DATA>::attach(Pair* pair)
+{
+    if (pair->d_tick <= d_current) {
+        pushList(&d_due_p, pair);
+        pair->d_level = k_LEVEL_DUE;
+        pair->d_slot  = 0;
+        return;
+    }
+
+    const int level = TimerWheelUtil::level(pair->d_tick, d_current);
+    const int slot  = static_cast<int>(
+        (pair->d_tick >> (level * k_BITS_PER_LEVEL)) & (k_NUM_SLOTS - 1));
+
+    pushList(&d_slots[level][slot], pair);
+    d_occupied[level] |= bsls::Types::Uint64(1) << slot;
+
+    pair->d_level = level;
+    pair->d_slot  = slot;
+}
+
+template <class DATA>
+void TimerWheel<DATA>::detach(Pair* pair)
+{
+    if (pair->d_level == k_LEVEL_DETACHED) {
+        return;
+    }
+
+    if (pair->d_level == k_LEVEL_DUE) {
+        popList(&d_due_p, pair);
+    }
+    else {
+        Pair** list = &d_slots[pair->d_level][pair->d_slot];
+        popList(list, pair);
+        if (*list == 0) {
+            d_occupied[pair->d_level] &=
+                ~(bsls::Types::Uint64(1) << pair->d_slot);
+        }
+    }
+
+    pair->d_level = k_LEVEL_DETACHED;
+}
+
+template <class DATA>
+void TimerWheel<DATA>::advance(bsls::Types::Int64 tick)
+{
+    if (tick <= d_current) {
+        return;
+    }
+
+    const bsls::Types::Int64 previous = d_current;
+    d_current                         = tick;
+
+    for (int level = 0; level < k_NUM_LEVELS; ++level) {
+        const int shift = level * k_BITS_PER_LEVEL;
+
+        const bsls::Types::Int64 from = previous >> shift;
+        const bsls::Types::Int64 to   = tick >> shift;
+
+        if (from == to) {
+            break;
+        }
+
+        bsls::Types::Uint64 mask;
+        if ((from >> k_BITS_PER_LEVEL) != (to >> k_BITS_PER_LEVEL)) {
+            mask = ~bsls::Types::Uint64(0);
+        }
+        else {
+            mask = TimerWheelUtil::slotRange(
+                static_cast<int>(from & (k_NUM_SLOTS - 1)) + 1,
+                static_cast<int>(to & (k_NUM_SLOTS - 1)));
+        }
+
+        bsls::Types::Uint64 pending = d_occupied[level] & mask;
+        while (pending != 0) {
+            const int slot = TimerWheelUtil::lowestSlot(pending);
+            pending &= pending - 1;
+
+            Pair* list           = d_slots[level][slot];
+            d_slots[level][slot] = 0;
+            d_occupied[level] &= ~(bsls::Types::Uint64(1) << slot);
+
+            while (list != 0) {
+                Pair* pair = list;
+                popList(&list, pair);
+                attach(pair);
+            }
+        }
+    }
+}
+
+template <class DATA>
+TimerWheel<DATA>::TimerWheel(bsls::Types::Int64 resolution,
+                             bsls::Types::Int64 now,
+                             bslma::Allocator*  basicAllocator)
+: d_due_p(0)
+, d_resolution(resolution)
+, d_current(TimerWheelUtil::floorTick(now, resolution))
+, d_length(0)
+, d_pool(sizeof(Pair), basicAllocator)
+{
+    BSLS_ASSERT(resolution > 0);
+
+    for (int level = 0; level < k_NUM_LEVELS; ++level) {
+        for (int slot = 0; slot < k_NUM_SLOTS; ++slot) {
+            d_slots[level][slot] = 0;
+        }
+        d_occupied[level] = 0;
+    }
+}
+
+template <class DATA>
+TimerWheel<DATA>::~TimerWheel()
+{
+    this->removeAll();
+}
+
+template <class DATA>
+typename TimerWheel<DATA>::Pair* TimerWheel<DATA>::add(
+    bsls::Types::Int64 key,
+    const DATA&        data,
+    bool*              newFrontFlag)
+{
+    bsls::Types::Int64 before      = 0;
+    const bool         beforeValid = this->earliest(&before);
+
+    Pair* pair   = new (d_pool.allocate()) Pair(key, data);
+    pair->d_tick = TimerWheelUtil::ceilTick(key, d_resolution);
+
+    this->attach(pair);
+    ++d_length;
+
+    if (newFrontFlag) {
+        bsls::Types::Int64 after = 0;
+        this->earliest(&after);
+        *newFrontFlag = !beforeValid || after < before;
+    }
+
+    return pair;
+}
+
+template <class DATA>
+void TimerWheel<DATA>::update(Pair*              pair,
+                              bsls::Types::Int64 key,
+                              bool*              newFrontFlag)
+{
+    bsls::Types::Int64 before      = 0;
+    const bool         beforeValid = this->earliest(&before);
+
+    this->detach(pair);
+
+    pair->d_key  = key;
+    pair->d_tick = TimerWheelUtil::ceilTick(key, d_resolution);
+
+    this->attach(pair);
+
+    if (newFrontFlag) {
+        bsls::Types::Int64 after = 0;
+        this->earliest(&after);
+        *newFrontFlag = !beforeValid || after < before;
+    }
+}
+
+template <class DATA>
+void TimerWheel<DATA>::remove(Pair* pair)
+{
+    BSLS_ASSERT(d_length > 0);
+
+    this->detach(pair);
+
+    pair->~Pair();
+    d_pool.deallocate(pair);
+
+    --d_length;
+}
+
+template <class DATA>
+void TimerWheel<DATA>::removeAll()
+{
+    bsl::vector<Pair*> pairs;
+    this->load(&pairs);
+
+    for (typename bsl::vector<Pair*>::iterator it = pairs.begin();
+         it != pairs.end();
+         ++it)
+    {
+        (*it)->~Pair();
+    }
+
+    for (int level = 0; level < k_NUM_LEVELS; ++level) {
+        for (int slot = 0; slot < k_NUM_SLOTS; ++slot) {
+            d_slots[level][slot] = 0;
+        }
+        d_occupied[level] = 0;
+    }
+
+    d_due_p  = 0;
+    d_length = 0;
+
+    d_pool.release();
+}
+
+template <class DATA>
+typename TimerWheel<DATA>::Pair* TimerWheel<DATA>::popDue(
+    bsls::Types::Int64 now)
+{
+    this->advance(TimerWheelUtil::floorTick(now, d_resolution));
+
+    Pair* pair = d_due_p;
+    if (pair != 0) {
+        this->detach(pair);
+    }
+
+    return pair;
+}
+
+template <class DATA>
+void TimerWheel<DATA>::load(bsl::vector<Pair*>* result) const
+{
+    if (d_due_p != 0) {
+        Pair* pair = d_due_p;
+        do {
+            result->push_back(pair);
+            pair = pair->d_next_p;
+        } while (pair != d_due_p);
+    }
+
+    for (int level = 0; level < k_NUM_LEVELS; ++level) {
+        bsls::Types::Uint64 pending = d_occupied[level];
+        while (pending != 0) {
+            const int slot = TimerWheelUtil::lowestSlot(pending);
+            pending &= pending - 1;
+
+            Pair* head = d_slots[level][slot];
+            Pair* pair = head;
+            do {
+                result->push_back(pair);
+                pair = pair->d_next_p;
+            } while (pair != head);
+        }
+    }
+}
+
+template <class DATA>
+bool TimerWheel<DATA>::earliest(bsls::Types::Int64* result) const
+{
+    if (d_due_p != 0) {
+        *result = TimerWheelUtil::key(d_current, d_resolution);
+        return true;
+    }
+
+    for (int level = 0; level < k_NUM_LEVELS; ++level) {
+        if (d_occupied[level] == 0) {
+            continue;
+        }
+
+        const int shift = level * k_BITS_PER_LEVEL;
+        const int slot  = TimerWheelUtil::lowestSlot(d_occupied[level]);
+
+        const bsls::Types::Int64 upper =
+            (d_current >> (shift + k_BITS_PER_LEVEL)) << k_BITS_PER_LEVEL;
+
+        const bsls::Types::Int64 tick = (upper | slot) << shift;
+
+        *result = TimerWheelUtil::key(tick, d_resolution);
+        return true;
+    }
+
+    return false;
+}
+
+template <class DATA>
+inline bsls::Types::Int64 TimerWheel<DATA>::resolution() const
+{
+    return d_resolution;
+}
+
+template <class DATA>
+inline int TimerWheel<DATA>::length() const
+{
+    return d_length;
+}
+
+template <class DATA>
+inline bool TimerWheel<DATA>::isEmpty() const
+{
+    return d_length == 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
@@ -0,0 +1,235 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_timerwheel.h>
+
+#include <ntccfg_test.h>
+
+#include <bdlb_random.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bsls_assert.h>
+#include <bsl_algorithm.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The timer wheel is tested by adding pairs, advancing through time, and
+// verifying each pair is popped no earlier than its key and no later than
+// the end of the tick containing its key.
+//-----------------------------------------------------------------------------
+
+// [ 1] Pairs are popped in the tick in which their key falls
+// [ 2] Pairs may be updated and removed
+// [ 3] Pairs spanning many levels are popped on time
+//-----------------------------------------------------------------------------
+
+namespace {
+
+typedef ntcs::TimerWheel<int> Wheel;
+
+}  // close unnamed namespace
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Pairs are popped in the tick in which their key falls.
+    // Plan: Add pairs at keys both within and beyond the first 64 ticks,
+    // then advance one tick at a time, verifying each pair is popped in the
+    // tick containing its key and never before.
+
+    ntccfg::TestAllocator ta;
+    {
+        const bsls::Types::Int64 k_RESOLUTION = 1000;
+
+        Wheel wheel(k_RESOLUTION, 0, &ta);
+
+        NTCCFG_TEST_TRUE(wheel.isEmpty());
+
+        bsls::Types::Int64 earliest = 0;
+        NTCCFG_TEST_FALSE(wheel.earliest(&earliest));
+
+        const bsls::Types::Int64 keys[] = {1, 999, 1000, 1001, 63999,
+                                           64000, 64001, 4096001, 250000};
+
+        const int numKeys = sizeof keys / sizeof keys[0];
+
+        for (int i = 0; i < numKeys; ++i) {
+            bool newFront = false;
+            wheel.add(keys[i], i, &newFront);
+            if (i == 0) {
+                NTCCFG_TEST_TRUE(newFront);
+            }
+        }
+
+        NTCCFG_TEST_EQ(wheel.length(), numKeys);
+
+        NTCCFG_TEST_TRUE(wheel.earliest(&earliest));
+        NTCCFG_TEST_EQ(earliest, k_RESOLUTION);
+
+        int numPopped = 0;
+        for (bsls::Types::Int64 now = 0; now <= 4097000; now += k_RESOLUTION)
+        {
+            while (Wheel::Pair* pair = wheel.popDue(now)) {
+                NTCCFG_TEST_LE(pair->key(), now);
+                NTCCFG_TEST_GT(pair->key(), now - k_RESOLUTION);
+                NTCCFG_TEST_EQ(pair->data(), static_cast<int>(
+                    bsl::find(keys, keys + numKeys, pair->key()) - keys));
+                wheel.remove(pair);
+                ++numPopped;
+            }
+        }
+
+        NTCCFG_TEST_EQ(numPopped, numKeys);
+        NTCCFG_TEST_TRUE(wheel.isEmpty());
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: Pairs may be updated and removed.
+    // Plan: Add pairs, remove some, move others earlier and later, and
+    // re-add a popped pair, verifying the remaining pairs are popped at
+    // their new keys.
+
+    ntccfg::TestAllocator ta;
+    {
+        Wheel wheel(1, 0, &ta);
+
+        Wheel::Pair* a = wheel.add(100, 1);
+        Wheel::Pair* b = wheel.add(200, 2);
+        Wheel::Pair* c = wheel.add(300000, 3);
+
+        bool newFront = false;
+        wheel.update(c, 50, &newFront);
+        NTCCFG_TEST_TRUE(newFront);
+
+        wheel.update(a, 400, &newFront);
+        NTCCFG_TEST_FALSE(newFront);
+
+        wheel.remove(b);
+        NTCCFG_TEST_EQ(wheel.length(), 2);
+
+        NTCCFG_TEST_EQ(wheel.popDue(49), static_cast<Wheel::Pair*>(0));
+
+        Wheel::Pair* pair = wheel.popDue(50);
+        NTCCFG_TEST_EQ(pair, c);
+
+        wheel.update(pair, 1000);
+
+        pair = wheel.popDue(999);
+        NTCCFG_TEST_EQ(pair, a);
+        wheel.remove(pair);
+
+        pair = wheel.popDue(1000);
+        NTCCFG_TEST_EQ(pair, c);
+        NTCCFG_TEST_EQ(pair->data(), 3);
+
+        bsl::vector<Wheel::Pair*> pairs;
+        wheel.add(2000, 4);
+        wheel.load(&pairs);
+        NTCCFG_TEST_EQ(pairs.size(), 1);
+
+        // Both the stored pair and the popped pair are released.
+
+        wheel.removeAll();
+        NTCCFG_TEST_TRUE(wheel.isEmpty());
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(3)
+{
+    // Concern: Pairs spanning many levels are popped on time.
+    // Plan: Add pairs at random keys spanning several levels and advance
+    // through time in random steps, verifying that each popped pair is due
+    // and that no due pair remains after each step.
+
+    ntccfg::TestAllocator ta;
+    {
+        const bsls::Types::Int64 k_RESOLUTION = 10;
+        const int                k_NUM_PAIRS  = 10000;
+
+        Wheel wheel(k_RESOLUTION, 5, &ta);
+
+        int seed = 1;
+
+        bsl::vector<bsls::Types::Int64> keys(&ta);
+        for (int i = 0; i < k_NUM_PAIRS; ++i) {
+            bsls::Types::Int64 key =
+                static_cast<bsls::Types::Int64>(
+                    bdlb::Random::generate15(&seed)) *
+                bdlb::Random::generate15(&seed);
+            keys.push_back(key);
+            wheel.add(key, i);
+        }
+
+        bsl::sort(keys.begin(), keys.end());
+
+        bsl::size_t        next = 0;
+        bsls::Types::Int64 now  = 5;
+
+        while (next < keys.size()) {
+            now += bdlb::Random::generate15(&seed) * 97;
+
+            bsl::vector<bsls::Types::Int64> popped(&ta);
+            while (Wheel::Pair* pair = wheel.popDue(now)) {
+                NTCCFG_TEST_LE(pair->key(), now);
+                popped.push_back(pair->key());
+                wheel.remove(pair);
+            }
+
+            bsl::sort(popped.begin(), popped.end());
+
+            bsl::size_t end = next;
+            while (end < keys.size() &&
+                   keys[end] <= (now / k_RESOLUTION) * k_RESOLUTION)
+            {
+                ++end;
+            }
+
+            NTCCFG_TEST_EQ(popped.size(), end - next);
+            for (bsl::size_t i = 0; i < popped.size(); ++i) {
+                NTCCFG_TEST_EQ(popped[i], keys[next + i]);
+            }
+
+            next = end;
+
+            bsls::Types::Int64 earliest = 0;
+            if (wheel.earliest(&earliest)) {
+                NTCCFG_TEST_LE(earliest,
+                               ntcs::TimerWheelUtil::ceilTick(keys[next],
+                                                              k_RESOLUTION) *
+                                   k_RESOLUTION);
+            }
+        }
+
+        NTCCFG_TEST_TRUE(wheel.isEmpty());
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+    NTCCFG_TEST_REGISTER(3);
+}
+NTCCFG_TEST_DRIVER_END;
@@ -34,7 +34,8 @@ bool ReceiveContext::equals(const ReceiveContext& other) const
            d_messagesReceived == other.d_messagesReceived &&
            d_softwareTimestamp == other.d_softwareTimestamp &&
            d_hardwareTimestamp == other.d_hardwareTimestamp &&
-           d_foreignHandle == other.d_foreignHandle;
+           d_foreignHandle == other.d_foreignHandle &&
+           d_segmentSize == other.d_segmentSize;
 }
 
 bool ReceiveContext::less(const ReceiveContext& other) const
@@ -111,7 +112,15 @@ bool ReceiveContext::less(const ReceiveContext& other) const
         return false;
     }
 
-    return d_foreignHandle < other.d_foreignHandle;
+    if (d_foreignHandle < other.d_foreignHandle) {
+        return true;
+    }
+
+    if (other.d_foreignHandle < d_foreignHandle) {
+        return false;
+    }
+
+    return d_segmentSize < other.d_segmentSize;
 }
 
 bsl::ostream& ReceiveContext::print(bsl::ostream& stream,
@@ -130,6 +139,7 @@ bsl::ostream& ReceiveContext::print(bsl::ostream& stream,
     printer.printAttribute("softwareTimestamp", d_softwareTimestamp);
     printer.printAttribute("hardwareTimestamp", d_hardwareTimestamp);
     printer.printAttribute("foreignHandle", d_foreignHandle);
+    printer.printAttribute("segmentSize", d_segmentSize);
     printer.end();
     return stream;
 }
@@ -76,6 +76,12 @@ namespace ntsa {
 /// The foreign handle sent by the peer, if any. If a foreign handle is
 /// defined, it is the receivers responsibility to close it.
 ///
+/// @li @b segmentSize:
+/// The size of each datagram coalesced by the operating system or network
+/// interface into the data received, if any. If a segment size is defined,
+/// the data received is the concatenation of multiple datagrams from the same
+/// peer, each of this size except possibly the last, which may be smaller.
+///
 /// @par Thread Safety
 /// This class is not thread safe.
 ///
@@ -92,6 +98,7 @@ class ReceiveContext
     bdlb::NullableValue<bsls::TimeInterval> d_softwareTimestamp;
     bdlb::NullableValue<bsls::TimeInterval> d_hardwareTimestamp;
     bdlb::NullableValue<ntsa::Handle>       d_foreignHandle;
+    bdlb::NullableValue<bsl::size_t>        d_segmentSize;
 
   public:
     /// Create new receive options having the default value.
@@ -147,6 +154,10 @@ class ReceiveContext
     /// Set the foreign handle sent by the peer to the specified 'value'.
     void setForeignHandle(ntsa::Handle value);
 
+    /// Set the size of each datagram coalesced into the data received to the
+    /// specified 'value'.
+    void setSegmentSize(bsl::size_t value);
+
     /// Return the remote endpoint from which the data was received.
     const bdlb::NullableValue<ntsa::Endpoint>& endpoint() const;
 
@@ -177,6 +188,10 @@ class ReceiveContext
     /// Return the foreign handle sent by the peer, if any.
     const bdlb::NullableValue<ntsa::Handle>& foreignHandle() const;
 
+    /// Return the size of each datagram coalesced into the data received, if
+    /// any.
+    const bdlb::NullableValue<bsl::size_t>& segmentSize() const;
+
     /// Return true if this object has the same value as the specified
     /// 'other' object, otherwise return false.
     bool equals(const ReceiveContext& other) const;
@@ -249,6 +264,7 @@ ReceiveContext::ReceiveContext()
 , d_softwareTimestamp()
 , d_hardwareTimestamp()
 , d_foreignHandle()
+, d_segmentSize()
 {
 }
 
@@ -264,6 +280,7 @@ ReceiveContext::ReceiveContext(const ReceiveContext& original)
 , d_softwareTimestamp(original.d_softwareTimestamp)
 , d_hardwareTimestamp(original.d_hardwareTimestamp)
 , d_foreignHandle(original.d_foreignHandle)
+, d_segmentSize(original.d_segmentSize)
 {
 }
 
@@ -285,6 +302,7 @@ ReceiveContext& ReceiveContext::operator=(const ReceiveContext& other)
     d_softwareTimestamp  = other.d_softwareTimestamp;
     d_hardwareTimestamp  = other.d_hardwareTimestamp;
     d_foreignHandle      = other.d_foreignHandle;
+    d_segmentSize        = other.d_segmentSize;
 
     return *this;
 }
@@ -302,6 +320,7 @@ void ReceiveContext::reset()
     d_softwareTimestamp.reset();
     d_hardwareTimestamp.reset();
     d_foreignHandle.reset();
+    d_segmentSize.reset();
 }
 
 NTSCFG_INLINE
@@ -364,6 +383,12 @@ void ReceiveContext::setForeignHandle(ntsa::Handle value)
     d_foreignHandle = value;
 }
 
+NTSCFG_INLINE
+void ReceiveContext::setSegmentSize(bsl::size_t value)
+{
+    d_segmentSize = value;
+}
+
 NTSCFG_INLINE
 const bdlb::NullableValue<ntsa::Endpoint>& ReceiveContext::endpoint() const
 {
@@ -426,6 +451,12 @@ const bdlb::NullableValue<ntsa::Handle>& ReceiveContext::foreignHandle() const
     return d_foreignHandle;
 }
 
+NTSCFG_INLINE
+const bdlb::NullableValue<bsl::size_t>& ReceiveContext::segmentSize() const
+{
+    return d_segmentSize;
+}
+
 NTSCFG_INLINE
 bsl::ostream& operator<<(bsl::ostream& stream, const ReceiveContext& object)
 {
@@ -465,6 +496,7 @@ void hashAppend(HASH_ALGORITHM& algorithm, const ReceiveContext& value)
     hashAppend(algorithm, value.softwareTimestamp());
     hashAppend(algorithm, value.hardwareTimestamp());
     hashAppend(algorithm, value.foreignHandle());
+    hashAppend(algorithm, value.segmentSize());
 }
 
 }  // close package namespace
@@ -60,6 +60,9 @@ bsl::ostream& ReceiveOptions::print(bsl::ostream& stream,
     printer.printAttribute("wantEndpoint", wantEndpoint());
     printer.printAttribute("wantTimestamp", wantTimestamp());
     printer.printAttribute("wantForeignHandles", wantForeignHandles());
+    printer.printAttribute("wantSegmentSize", wantSegmentSize());
+    printer.printAttribute("zeroCopy", zeroCopy());
+    printer.printAttribute("encryptionOffloaded", encryptionOffloaded());
     printer.printAttribute("maxBytes", d_maxBytes);
     printer.printAttribute("maxBuffers", d_maxBuffers);
     printer.end();
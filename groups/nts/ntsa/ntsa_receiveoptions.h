@@ -58,6 +58,34 @@ namespace ntsa {
 /// be received and included in the resulting receive context. The default
 /// value is false.
 ///
+/// @li @b wantSegmentSize:
+/// The flag to indicate that the size of each segment of data coalesced from
+/// multiple datagrams by the operating system or network interface should
+/// also be received and included in the resulting receive context. Note that
+/// the operating system only coalesces datagrams received by sockets for
+/// which receive offload has been enabled. The default value is false.
+///
+/// @li @b zeroCopy:
+/// The flag to indicate that whole pages of data received by a TCP socket
+/// should be mapped into the address space of the process, rather than
+/// copied, when receiving blobs. Each mapped page is released when the last
+/// reference to the blob buffer that describes it is released. Data that
+/// cannot be mapped, such as data not aligned to a page boundary, is copied.
+/// Note that zero-copy receive is only supported on Linux; on other
+/// platforms, and for other types of sockets, data is always copied. Also
+/// note that zero-copy receive is typically only more efficient than copying
+/// for large transfers of data whose size is a multiple of the page size.
+/// The default value is false.
+///
+/// @li @b encryptionOffloaded:
+/// The flag to indicate that TLS records received by a TCP socket are
+/// decrypted by the operating system, so that records other than application
+/// data, such as session tickets and alerts, must be received separately and
+/// interpreted rather than received as data. Session tickets and warning
+/// alerts are discarded, a "close_notify" alert is received as the end of
+/// the data, and any other record fails the receive. Note that this flag is
+/// only honored when receiving blobs on Linux. The default value is false.
+///
 /// @li @b maxBytes:
 /// The hint for the maximum number of bytes to copy from the socket receive
 /// buffer. This value does not stricly imply the maximum number of bytes to
@@ -105,7 +133,18 @@ class ReceiveOptions
         k_INCLUDE_TIMESTAMP = 1,
 
         /// Receive socket handles sent by the peer, if any.
-        k_INCLUDE_FOREIGN_HANDLES = 2
+        k_INCLUDE_FOREIGN_HANDLES = 2,
+
+        /// Receive the size of each segment of coalesced datagrams, if any.
+        k_INCLUDE_SEGMENT_SIZE = 3,
+
+        /// Map whole pages of received data rather than copying them, if
+        /// supported.
+        k_ZERO_COPY = 4,
+
+        /// Interpret TLS records other than application data decrypted by
+        /// the operating system.
+        k_ENCRYPTION_OFFLOADED = 5
     };
 
     bsl::size_t   d_maxBytes;
@@ -158,6 +197,25 @@ class ReceiveOptions
     /// receive context.
     void hideForeignHandles();
 
+    /// Set the flag which indicates that the size of each segment of data
+    /// coalesced from multiple datagrams should also be received and
+    /// included in the resulting receive context.
+    void showSegmentSize();
+
+    /// Clear the flag which indicates that the size of each segment of data
+    /// coalesced from multiple datagrams should also be received and
+    /// included in the resulting receive context.
+    void hideSegmentSize();
+
+    /// Set the flag that indicates whole pages of received data should be
+    /// mapped rather than copied, if supported, to the specified 'value'.
+    void setZeroCopy(bool value);
+
+    /// Set the flag that indicates TLS records are decrypted by the
+    /// operating system, so that records other than application data must
+    /// be interpreted, to the specified 'value'.
+    void setEncryptionOffloaded(bool value);
+
     /// Set the maximum number of bytes to copy to the specified 'value'.
     void setMaxBytes(bsl::size_t value);
 
@@ -176,10 +234,25 @@ class ReceiveOptions
     /// in the resulting receive context, otherwise return false.
     bool wantForeignHandles() const;
 
-    // Return true if either timestamps or foreign handles should be included
-    // in the resulting receive context, otherwise return false.
+    /// Return true if the size of each segment of data coalesced from
+    /// multiple datagrams should be included in the resulting receive
+    /// context, otherwise return false.
+    bool wantSegmentSize() const;
+
+    // Return true if either timestamps, foreign handles, or segment sizes
+    // should be included in the resulting receive context, or TLS record
+    // types must be received, otherwise return false.
     bool wantMetaData() const;
 
+    /// Return the flag that indicates whole pages of received data should
+    /// be mapped rather than copied, if supported.
+    bool zeroCopy() const;
+
+    /// Return the flag that indicates TLS records are decrypted by the
+    /// operating system, so that records other than application data must
+    /// be interpreted.
+    bool encryptionOffloaded() const;
+
     /// Return the maximum number of bytes to copy.
     bsl::size_t maxBytes() const;
 
@@ -322,6 +395,43 @@ void ReceiveOptions::hideForeignHandles()
         bdlb::BitUtil::withBitCleared(d_options, k_INCLUDE_FOREIGN_HANDLES);
 }
 
+NTSCFG_INLINE
+void ReceiveOptions::showSegmentSize()
+{
+    d_options = bdlb::BitUtil::withBitSet(d_options, k_INCLUDE_SEGMENT_SIZE);
+}
+
+NTSCFG_INLINE
+void ReceiveOptions::hideSegmentSize()
+{
+    d_options =
+        bdlb::BitUtil::withBitCleared(d_options, k_INCLUDE_SEGMENT_SIZE);
+}
+
+NTSCFG_INLINE
+void ReceiveOptions::setZeroCopy(bool value)
+{
+    if (value) {
+        d_options = bdlb::BitUtil::withBitSet(d_options, k_ZERO_COPY);
+    }
+    else {
+        d_options = bdlb::BitUtil::withBitCleared(d_options, k_ZERO_COPY);
+    }
+}
+
+NTSCFG_INLINE
+void ReceiveOptions::setEncryptionOffloaded(bool value)
+{
+    if (value) {
+        d_options =
+            bdlb::BitUtil::withBitSet(d_options, k_ENCRYPTION_OFFLOADED);
+    }
+    else {
+        d_options =
+            bdlb::BitUtil::withBitCleared(d_options, k_ENCRYPTION_OFFLOADED);
+    }
+}
+
 NTSCFG_INLINE
 void ReceiveOptions::setMaxBytes(bsl::size_t value)
 {
@@ -352,11 +462,31 @@ bool ReceiveOptions::wantForeignHandles() const
     return bdlb::BitUtil::isBitSet(d_options, k_INCLUDE_FOREIGN_HANDLES);
 }
 
+NTSCFG_INLINE
+bool ReceiveOptions::wantSegmentSize() const
+{
+    return bdlb::BitUtil::isBitSet(d_options, k_INCLUDE_SEGMENT_SIZE);
+}
+
 NTSCFG_INLINE
 bool ReceiveOptions::wantMetaData() const
 {
     return (d_options & ((1 << k_INCLUDE_TIMESTAMP) |
-                         (1 << k_INCLUDE_FOREIGN_HANDLES))) != 0;
+                         (1 << k_INCLUDE_FOREIGN_HANDLES) |
+                         (1 << k_INCLUDE_SEGMENT_SIZE) |
+                         (1 << k_ENCRYPTION_OFFLOADED))) != 0;
+}
+
+NTSCFG_INLINE
+bool ReceiveOptions::zeroCopy() const
+{
+    return bdlb::BitUtil::isBitSet(d_options, k_ZERO_COPY);
+}
+
+NTSCFG_INLINE
+bool ReceiveOptions::encryptionOffloaded() const
+{
+    return bdlb::BitUtil::isBitSet(d_options, k_ENCRYPTION_OFFLOADED);
 }
 
 NTSCFG_INLINE
@@ -403,6 +533,9 @@ void hashAppend(HASH_ALGORITHM& algorithm, const ReceiveOptions& value)
     hashAppend(algorithm, value.wantEndpoint());
     hashAppend(algorithm, value.wantTimestamp());
     hashAppend(algorithm, value.wantForeignHandles());
+    hashAppend(algorithm, value.wantSegmentSize());
+    hashAppend(algorithm, value.zeroCopy());
+    hashAppend(algorithm, value.encryptionOffloaded());
     hashAppend(algorithm, value.maxBytes());
     hashAppend(algorithm, value.maxBuffers());
 }
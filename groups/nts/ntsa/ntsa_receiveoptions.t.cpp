@@ -150,6 +150,75 @@ NTSCFG_TEST_CASE(4)
         NTSCFG_TEST_TRUE(options.wantTimestamp());
         NTSCFG_TEST_TRUE(options.wantForeignHandles());
         NTSCFG_TEST_TRUE(options.wantMetaData());
+
+        options.reset();
+
+        NTSCFG_TEST_FALSE(options.wantSegmentSize());
+        NTSCFG_TEST_FALSE(options.wantMetaData());
+
+        options.showSegmentSize();
+
+        NTSCFG_TEST_FALSE(options.wantTimestamp());
+        NTSCFG_TEST_FALSE(options.wantForeignHandles());
+        NTSCFG_TEST_TRUE(options.wantSegmentSize());
+        NTSCFG_TEST_TRUE(options.wantMetaData());
+
+        options.hideSegmentSize();
+
+        NTSCFG_TEST_FALSE(options.wantSegmentSize());
+        NTSCFG_TEST_FALSE(options.wantMetaData());
+    }
+    NTSCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTSCFG_TEST_CASE(5)
+{
+    // Concern: zeroCopy is not meta-data and contributes to the value.
+
+    ntscfg::TestAllocator ta;
+    {
+        ntsa::ReceiveOptions options;
+
+        NTSCFG_TEST_FALSE(options.zeroCopy());
+
+        options.setZeroCopy(true);
+
+        NTSCFG_TEST_TRUE(options.zeroCopy());
+        NTSCFG_TEST_FALSE(options.wantMetaData());
+        NTSCFG_TEST_TRUE(options.wantEndpoint());
+        NTSCFG_TEST_NE(options, ntsa::ReceiveOptions());
+
+        options.setZeroCopy(false);
+
+        NTSCFG_TEST_FALSE(options.zeroCopy());
+        NTSCFG_TEST_EQ(options, ntsa::ReceiveOptions());
+    }
+    NTSCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTSCFG_TEST_CASE(6)
+{
+    // Concern: encryptionOffloaded requires the control buffer to be received
+    // and contributes to the value.
+
+    ntscfg::TestAllocator ta;
+    {
+        ntsa::ReceiveOptions options;
+
+        NTSCFG_TEST_FALSE(options.encryptionOffloaded());
+
+        options.setEncryptionOffloaded(true);
+
+        NTSCFG_TEST_TRUE(options.encryptionOffloaded());
+        NTSCFG_TEST_TRUE(options.wantMetaData());
+        NTSCFG_TEST_FALSE(options.wantTimestamp());
+        NTSCFG_TEST_NE(options, ntsa::ReceiveOptions());
+
+        options.setEncryptionOffloaded(false);
+
+        NTSCFG_TEST_FALSE(options.encryptionOffloaded());
+        NTSCFG_TEST_FALSE(options.wantMetaData());
+        NTSCFG_TEST_EQ(options, ntsa::ReceiveOptions());
     }
     NTSCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
@@ -160,5 +229,7 @@ NTSCFG_TEST_DRIVER
     NTSCFG_TEST_REGISTER(2);
     NTSCFG_TEST_REGISTER(3);
     NTSCFG_TEST_REGISTER(4);
+    NTSCFG_TEST_REGISTER(5);
+    NTSCFG_TEST_REGISTER(6);
 }
 NTSCFG_TEST_DRIVER_END;
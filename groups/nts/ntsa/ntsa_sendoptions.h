@@ -89,6 +89,14 @@ namespace ntsa {
 /// notification (which also indicates whether the data was referenced in-place
 /// or copied.)
 ///
+/// @li @b segmentSize:
+/// The size of each datagram into which the data should be segmented by the
+/// operating system or network interface, so that a single send operation
+/// transmits multiple datagrams to the same endpoint, each of this size except
+/// possibly the last, which may be smaller. If this value is zero, the data is
+/// sent as a single datagram. Note that this value is only honored by datagram
+/// sockets on platforms that support segmentation offload.
+///
 /// @par Thread Safety
 /// This class is not thread safe.
 ///
@@ -100,6 +108,7 @@ class SendOptions
     bsl::size_t                         d_maxBytes;
     bsl::size_t                         d_maxBuffers;
     bool                                d_zeroCopy;
+    bsl::size_t                         d_segmentSize;
 
   public:
     /// Create new send options having the default value.
@@ -137,6 +146,10 @@ class SendOptions
     /// Set the flag to request zero-copy semantics to the specified 'value'.
     void setZeroCopy(bool value);
 
+    /// Set the size of each datagram into which the data should be
+    /// segmented to the specified 'value'.
+    void setSegmentSize(bsl::size_t value);
+
     /// Return the remote endpoint to which the data should be sent.
     const bdlb::NullableValue<ntsa::Endpoint>& endpoint() const;
 
@@ -152,6 +165,10 @@ class SendOptions
     /// Return the flag that indicates zero-copy semantics are requested.
     bool zeroCopy() const;
 
+    /// Return the size of each datagram into which the data should be
+    /// segmented, or zero if the data should not be segmented.
+    bsl::size_t segmentSize() const;
+
     /// Return true if this object has the same value as the specified
     /// 'other' object, otherwise return false.
     bool equals(const SendOptions& other) const;
@@ -219,6 +236,7 @@ SendOptions::SendOptions()
 , d_maxBytes(0)
 , d_maxBuffers(0)
 , d_zeroCopy(false)
+, d_segmentSize(0)
 {
 }
 
@@ -229,6 +247,7 @@ SendOptions::SendOptions(const SendOptions& original)
 , d_maxBytes(original.d_maxBytes)
 , d_maxBuffers(original.d_maxBuffers)
 , d_zeroCopy(original.d_zeroCopy)
+, d_segmentSize(original.d_segmentSize)
 {
 }
 
@@ -245,6 +264,7 @@ SendOptions& SendOptions::operator=(const SendOptions& other)
     d_maxBytes      = other.d_maxBytes;
     d_maxBuffers    = other.d_maxBuffers;
     d_zeroCopy      = other.d_zeroCopy;
+    d_segmentSize   = other.d_segmentSize;
     return *this;
 }
 
@@ -253,9 +273,10 @@ void SendOptions::reset()
 {
     d_endpoint.reset();
     d_foreignHandle.reset();
-    d_maxBytes   = 0;
-    d_maxBuffers = 0;
-    d_zeroCopy   = false;
+    d_maxBytes    = 0;
+    d_maxBuffers  = 0;
+    d_zeroCopy    = false;
+    d_segmentSize = 0;
 }
 
 NTSCFG_INLINE
@@ -288,6 +309,12 @@ void SendOptions::setZeroCopy(bool value)
     d_zeroCopy = value;
 }
 
+NTSCFG_INLINE
+void SendOptions::setSegmentSize(bsl::size_t value)
+{
+    d_segmentSize = value;
+}
+
 NTSCFG_INLINE
 const bdlb::NullableValue<ntsa::Endpoint>& SendOptions::endpoint() const
 {
@@ -318,6 +345,12 @@ bool SendOptions::zeroCopy() const
     return d_zeroCopy;
 }
 
+NTSCFG_INLINE
+bsl::size_t SendOptions::segmentSize() const
+{
+    return d_segmentSize;
+}
+
 NTSCFG_INLINE
 bsl::ostream& operator<<(bsl::ostream& stream, const SendOptions& object)
 {
@@ -352,6 +385,7 @@ void hashAppend(HASH_ALGORITHM& algorithm, const SendOptions& value)
     hashAppend(algorithm, value.maxBytes());
     hashAppend(algorithm, value.maxBuffers());
     hashAppend(algorithm, value.zeroCopy());
+    hashAppend(algorithm, value.segmentSize());
 }
 
 }  // close package namespace
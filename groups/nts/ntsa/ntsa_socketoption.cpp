@@ -90,6 +90,17 @@ SocketOption::SocketOption(const SocketOption& other,
     case ntsa::SocketOptionType::e_ZERO_COPY:
         new (d_zeroCopy.buffer()) bool(other.d_zeroCopy.object());
         break;
+    case ntsa::SocketOptionType::e_REUSE_PORT:
+        new (d_reusePort.buffer()) bool(other.d_reusePort.object());
+        break;
+    case ntsa::SocketOptionType::e_UDP_SEGMENT:
+        new (d_udpSegmentationOffload.buffer())
+            bsl::size_t(other.d_udpSegmentationOffload.object());
+        break;
+    case ntsa::SocketOptionType::e_UDP_GRO:
+        new (d_udpReceiveOffload.buffer())
+            bool(other.d_udpReceiveOffload.object());
+        break;
     case ntsa::SocketOptionType::e_TCP_CONGESTION_CONTROL:
         new (d_tcpCongestionControl.buffer())
             TcpCongestionControl(other.d_tcpCongestionControl.object(),
@@ -169,6 +180,17 @@ SocketOption& SocketOption::operator=(const SocketOption& other)
     case ntsa::SocketOptionType::e_ZERO_COPY:
         new (d_zeroCopy.buffer()) bool(other.d_zeroCopy.object());
         break;
+    case ntsa::SocketOptionType::e_REUSE_PORT:
+        new (d_reusePort.buffer()) bool(other.d_reusePort.object());
+        break;
+    case ntsa::SocketOptionType::e_UDP_SEGMENT:
+        new (d_udpSegmentationOffload.buffer())
+            bsl::size_t(other.d_udpSegmentationOffload.object());
+        break;
+    case ntsa::SocketOptionType::e_UDP_GRO:
+        new (d_udpReceiveOffload.buffer())
+            bool(other.d_udpReceiveOffload.object());
+        break;
     case ntsa::SocketOptionType::e_TCP_CONGESTION_CONTROL:
         new (d_tcpCongestionControl.buffer())
             TcpCongestionControl(other.d_tcpCongestionControl.object(),
@@ -659,6 +681,90 @@ bool& SocketOption::makeZeroCopy(bool value)
     return d_zeroCopy.object();
 }
 
+bool& SocketOption::makeReusePort()
+{
+    if (d_type == ntsa::SocketOptionType::e_REUSE_PORT) {
+        d_reusePort.object() = false;
+    }
+    else {
+        this->reset();
+        new (d_reusePort.buffer()) bool();
+        d_type = ntsa::SocketOptionType::e_REUSE_PORT;
+    }
+
+    return d_reusePort.object();
+}
+
+bool& SocketOption::makeReusePort(bool value)
+{
+    if (d_type == ntsa::SocketOptionType::e_REUSE_PORT) {
+        d_reusePort.object() = value;
+    }
+    else {
+        this->reset();
+        new (d_reusePort.buffer()) bool(value);
+        d_type = ntsa::SocketOptionType::e_REUSE_PORT;
+    }
+
+    return d_reusePort.object();
+}
+
+bsl::size_t& SocketOption::makeUdpSegmentationOffload()
+{
+    if (d_type == ntsa::SocketOptionType::e_UDP_SEGMENT) {
+        d_udpSegmentationOffload.object() = 0;
+    }
+    else {
+        this->reset();
+        new (d_udpSegmentationOffload.buffer()) bsl::size_t();
+        d_type = ntsa::SocketOptionType::e_UDP_SEGMENT;
+    }
+
+    return d_udpSegmentationOffload.object();
+}
+
+bsl::size_t& SocketOption::makeUdpSegmentationOffload(bsl::size_t value)
+{
+    if (d_type == ntsa::SocketOptionType::e_UDP_SEGMENT) {
+        d_udpSegmentationOffload.object() = value;
+    }
+    else {
+        this->reset();
+        new (d_udpSegmentationOffload.buffer()) bsl::size_t(value);
+        d_type = ntsa::SocketOptionType::e_UDP_SEGMENT;
+    }
+
+    return d_udpSegmentationOffload.object();
+}
+
+bool& SocketOption::makeUdpReceiveOffload()
+{
+    if (d_type == ntsa::SocketOptionType::e_UDP_GRO) {
+        d_udpReceiveOffload.object() = false;
+    }
+    else {
+        this->reset();
+        new (d_udpReceiveOffload.buffer()) bool();
+        d_type = ntsa::SocketOptionType::e_UDP_GRO;
+    }
+
+    return d_udpReceiveOffload.object();
+}
+
+bool& SocketOption::makeUdpReceiveOffload(bool value)
+{
+    if (d_type == ntsa::SocketOptionType::e_UDP_GRO) {
+        d_udpReceiveOffload.object() = value;
+    }
+    else {
+        this->reset();
+        new (d_udpReceiveOffload.buffer()) bool(value);
+        d_type = ntsa::SocketOptionType::e_UDP_GRO;
+    }
+
+    return d_udpReceiveOffload.object();
+}
+
 ntsa::TcpCongestionControl& SocketOption::makeTcpCongestionControl()
 {
     if (d_type == ntsa::SocketOptionType::e_TCP_CONGESTION_CONTROL) {
@@ -739,6 +845,14 @@ bool SocketOption::equals(const SocketOption& other) const
                other.d_timestampOutgoingData.object();
     case ntsa::SocketOptionType::e_ZERO_COPY:
         return d_zeroCopy.object() == other.d_zeroCopy.object();
+    case ntsa::SocketOptionType::e_REUSE_PORT:
+        return d_reusePort.object() == other.d_reusePort.object();
+    case ntsa::SocketOptionType::e_UDP_SEGMENT:
+        return d_udpSegmentationOffload.object() ==
+               other.d_udpSegmentationOffload.object();
+    case ntsa::SocketOptionType::e_UDP_GRO:
+        return d_udpReceiveOffload.object() ==
+               other.d_udpReceiveOffload.object();
     case ntsa::SocketOptionType::e_TCP_CONGESTION_CONTROL:
         return d_tcpCongestionControl.object() ==
                other.d_tcpCongestionControl.object();
@@ -796,6 +910,14 @@ bool SocketOption::less(const SocketOption& other) const
                other.d_timestampOutgoingData.object();
     case ntsa::SocketOptionType::e_ZERO_COPY:
         return d_zeroCopy.object() < other.d_zeroCopy.object();
+    case ntsa::SocketOptionType::e_REUSE_PORT:
+        return d_reusePort.object() < other.d_reusePort.object();
+    case ntsa::SocketOptionType::e_UDP_SEGMENT:
+        return d_udpSegmentationOffload.object() <
+               other.d_udpSegmentationOffload.object();
+    case ntsa::SocketOptionType::e_UDP_GRO:
+        return d_udpReceiveOffload.object() <
+               other.d_udpReceiveOffload.object();
     case ntsa::SocketOptionType::e_TCP_CONGESTION_CONTROL:
         return d_tcpCongestionControl.object() <
                other.d_tcpCongestionControl.object();
@@ -860,6 +982,15 @@ bsl::ostream& SocketOption::print(bsl::ostream& stream,
     case ntsa::SocketOptionType::e_ZERO_COPY:
         stream << d_zeroCopy.object();
         break;
+    case ntsa::SocketOptionType::e_REUSE_PORT:
+        stream << d_reusePort.object();
+        break;
+    case ntsa::SocketOptionType::e_UDP_SEGMENT:
+        stream << d_udpSegmentationOffload.object();
+        break;
+    case ntsa::SocketOptionType::e_UDP_GRO:
+        stream << d_udpReceiveOffload.object();
+        break;
     case ntsa::SocketOptionType::e_TCP_CONGESTION_CONTROL:
         stream << d_tcpCongestionControl.object();
         break;
@@ -121,6 +121,21 @@ namespace ntsa {
 /// @li @b tcpCongestionControl:
 /// The option controls which TCP congestion control algorithm is used.
 ///
+/// @li @b reusePort:
+/// The flag that indicates multiple sockets may bind to the same address and
+/// port, with incoming connections or datagrams distributed among them.
+///
+/// @li @b udpSegmentationOffload:
+/// The size of each datagram into which the operating system or network
+/// interface segments the data of each datagram sent, or zero if datagrams are
+/// not segmented.
+///
+/// @li @b udpReceiveOffload:
+/// The flag that indicates the operating system or network interface may
+/// coalesce multiple datagrams received from the same peer into a single
+/// datagram of segments of the same size, with the segment size indicated as
+/// meta-data accompanying the data received.
+///
 /// @par Thread Safety
 /// This class is not thread safe.
 ///
@@ -145,6 +160,9 @@ class SocketOption
         bsls::ObjectBuffer<bool>         d_timestampIncomingData;
         bsls::ObjectBuffer<bool>         d_timestampOutgoingData;
         bsls::ObjectBuffer<bool>         d_zeroCopy;
+        bsls::ObjectBuffer<bool>         d_reusePort;
+        bsls::ObjectBuffer<bsl::size_t>  d_udpSegmentationOffload;
+        bsls::ObjectBuffer<bool>         d_udpReceiveOffload;
         bsls::ObjectBuffer<ntsa::TcpCongestionControl> d_tcpCongestionControl;
     };
 
@@ -311,6 +329,30 @@ class SocketOption
     /// 'value'. Return a reference to the modifiable representation.
     bool& makeZeroCopy(bool value);
 
+    /// Select the "reusePort" representation. Return a reference to the
+    /// modifiable representation.
+    bool& makeReusePort();
+
+    /// Select the "reusePort" representation initially having the specified
+    /// 'value'. Return a reference to the modifiable representation.
+    bool& makeReusePort(bool value);
+
+    /// Select the "udpSegmentationOffload" representation. Return a reference
+    /// to the modifiable representation.
+    bsl::size_t& makeUdpSegmentationOffload();
+
+    /// Select the "udpSegmentationOffload" representation initially having the
+    /// specified 'value'. Return a reference to the modifiable representation.
+    bsl::size_t& makeUdpSegmentationOffload(bsl::size_t value);
+
+    /// Select the "udpReceiveOffload" representation. Return a reference to
+    /// the modifiable representation.
+    bool& makeUdpReceiveOffload();
+
+    /// Select the "udpReceiveOffload" representation initially having the
+    /// specified 'value'. Return a reference to the modifiable representation.
+    bool& makeUdpReceiveOffload(bool value);
+
     /// Select the "tcpCongestionControl" representation. Return a reference to
     /// the modifiable representation.
     TcpCongestionControl& makeTcpCongestionControl();
@@ -396,6 +438,20 @@ class SocketOption
     /// behavior is undefined unless 'isZeroCopy()' is true.
     bool& zeroCopy();
 
+    /// Return a reference to the modifiable "reusePort" representation. The
+    /// behavior is undefined unless 'isReusePort()' is true.
+    bool& reusePort();
+
+    /// Return a reference to the modifiable "udpSegmentationOffload"
+    /// representation. The behavior is undefined unless
+    /// 'isUdpSegmentationOffload()' is true.
+    bsl::size_t& udpSegmentationOffload();
+
+    /// Return a reference to the modifiable "udpReceiveOffload"
+    /// representation. The behavior is undefined unless
+    /// 'isUdpReceiveOffload()' is true.
+    bool& udpReceiveOffload();
+
     /// Return a reference to the modifiable "tcpCongestionControl"
     /// representation. The behavior is undefined unless
     /// 'isTcpCongestionControl()' is true.
@@ -470,6 +526,18 @@ class SocketOption
     /// undefined unless 'isZeroCopy()' is true.
     bool zeroCopy() const;
 
+    /// Return the non-modifiable "reusePort" representation. The behavior is
+    /// undefined unless 'isReusePort()' is true.
+    bool reusePort() const;
+
+    /// Return the non-modifiable "udpSegmentationOffload" representation. The
+    /// behavior is undefined unless 'isUdpSegmentationOffload()' is true.
+    bsl::size_t udpSegmentationOffload() const;
+
+    /// Return the non-modifiable "udpReceiveOffload" representation. The
+    /// behavior is undefined unless 'isUdpReceiveOffload()' is true.
+    bool udpReceiveOffload() const;
+
     /// Return a reference to the non-modifiable "tcpCongestionControl"
     /// representation. The behavior is undefined unless
     /// 'isTcpCongestionControl()' is true.
@@ -550,6 +618,18 @@ class SocketOption
     /// otherwise return false.
     bool isZeroCopy() const;
 
+    /// Return true if the "reusePort" representation is currently selected,
+    /// otherwise return false.
+    bool isReusePort() const;
+
+    /// Return true if the "udpSegmentationOffload" representation is currently
+    /// selected, otherwise return false.
+    bool isUdpSegmentationOffload() const;
+
+    /// Return true if the "udpReceiveOffload" representation is currently
+    /// selected, otherwise return false.
+    bool isUdpReceiveOffload() const;
+
     /// Return true if the "tcpCongestionControl" representation is currently
     /// selected, otherwise return false.
     bool isTcpCongestionControl() const;
@@ -748,6 +828,27 @@ bool& SocketOption::zeroCopy()
     return d_zeroCopy.object();
 }
 
+NTSCFG_INLINE
+bool& SocketOption::reusePort()
+{
+    BSLS_ASSERT(d_type == ntsa::SocketOptionType::e_REUSE_PORT);
+    return d_reusePort.object();
+}
+
+NTSCFG_INLINE
+bsl::size_t& SocketOption::udpSegmentationOffload()
+{
+    BSLS_ASSERT(d_type == ntsa::SocketOptionType::e_UDP_SEGMENT);
+    return d_udpSegmentationOffload.object();
+}
+
+NTSCFG_INLINE
+bool& SocketOption::udpReceiveOffload()
+{
+    BSLS_ASSERT(d_type == ntsa::SocketOptionType::e_UDP_GRO);
+    return d_udpReceiveOffload.object();
+}
+
 NTSCFG_INLINE
 TcpCongestionControl& SocketOption::tcpCongestionControl()
 {
@@ -875,6 +976,27 @@ bool SocketOption::zeroCopy() const
     return d_zeroCopy.object();
 }
 
+NTSCFG_INLINE
+bool SocketOption::reusePort() const
+{
+    BSLS_ASSERT(d_type == ntsa::SocketOptionType::e_REUSE_PORT);
+    return d_reusePort.object();
+}
+
+NTSCFG_INLINE
+bsl::size_t SocketOption::udpSegmentationOffload() const
+{
+    BSLS_ASSERT(d_type == ntsa::SocketOptionType::e_UDP_SEGMENT);
+    return d_udpSegmentationOffload.object();
+}
+
+NTSCFG_INLINE
+bool SocketOption::udpReceiveOffload() const
+{
+    BSLS_ASSERT(d_type == ntsa::SocketOptionType::e_UDP_GRO);
+    return d_udpReceiveOffload.object();
+}
+
 NTSCFG_INLINE
 const TcpCongestionControl& SocketOption::tcpCongestionControl() const
 {
@@ -996,6 +1118,24 @@ bool SocketOption::isZeroCopy() const
     return (d_type == ntsa::SocketOptionType::e_ZERO_COPY);
 }
 
+NTSCFG_INLINE
+bool SocketOption::isReusePort() const
+{
+    return (d_type == ntsa::SocketOptionType::e_REUSE_PORT);
+}
+
+NTSCFG_INLINE
+bool SocketOption::isUdpSegmentationOffload() const
+{
+    return (d_type == ntsa::SocketOptionType::e_UDP_SEGMENT);
+}
+
+NTSCFG_INLINE
+bool SocketOption::isUdpReceiveOffload() const
+{
+    return (d_type == ntsa::SocketOptionType::e_UDP_GRO);
+}
+
 NTSCFG_INLINE
 bool SocketOption::isTcpCongestionControl() const
 {
@@ -1082,6 +1222,15 @@ void hashAppend(HASH_ALGORITHM& algorithm, const SocketOption& value)
     else if (value.isZeroCopy()) {
         hashAppend(algorithm, value.zeroCopy());
     }
+    else if (value.isReusePort()) {
+        hashAppend(algorithm, value.reusePort());
+    }
+    else if (value.isUdpSegmentationOffload()) {
+        hashAppend(algorithm, value.udpSegmentationOffload());
+    }
+    else if (value.isUdpReceiveOffload()) {
+        hashAppend(algorithm, value.udpReceiveOffload());
+    }
     else if (value.isTcpCongestionControl()) {
         hashAppend(algorithm, value.tcpCongestionControl());
     }
@@ -108,10 +108,72 @@ NTSCFG_TEST_CASE(3)
     NTSCFG_TEST_FALSE(so.isZeroCopy());
 }
 
+NTSCFG_TEST_CASE(4)
+{
+    // Concern: test reusePort option
+
+    ntsa::SocketOption so;
+    NTSCFG_TEST_FALSE(so.isReusePort());
+
+    so.makeReusePort(true);
+    NTSCFG_TEST_TRUE(so.isReusePort());
+
+    bool& val = so.reusePort();
+    NTSCFG_TEST_TRUE(val);
+    val = false;
+    NTSCFG_TEST_FALSE(so.reusePort());
+
+    val = true;
+    NTSCFG_TEST_TRUE(so.reusePort());
+
+    so.makeReusePort();
+    NTSCFG_TEST_FALSE(so.reusePort());
+
+    so.reset();
+    NTSCFG_TEST_FALSE(so.isReusePort());
+}
+
+NTSCFG_TEST_CASE(5)
+{
+    // Concern: test udpSegmentationOffload and udpReceiveOffload options
+
+    ntsa::SocketOption so;
+    NTSCFG_TEST_FALSE(so.isUdpSegmentationOffload());
+    NTSCFG_TEST_FALSE(so.isUdpReceiveOffload());
+
+    so.makeUdpSegmentationOffload(1400);
+    NTSCFG_TEST_TRUE(so.isUdpSegmentationOffload());
+    NTSCFG_TEST_EQ(so.udpSegmentationOffload(), 1400);
+
+    bsl::size_t& size = so.udpSegmentationOffload();
+    size              = 1200;
+    NTSCFG_TEST_EQ(so.udpSegmentationOffload(), 1200);
+
+    so.makeUdpSegmentationOffload();
+    NTSCFG_TEST_EQ(so.udpSegmentationOffload(), 0);
+
+    so.makeUdpReceiveOffload(true);
+    NTSCFG_TEST_FALSE(so.isUdpSegmentationOffload());
+    NTSCFG_TEST_TRUE(so.isUdpReceiveOffload());
+    NTSCFG_TEST_TRUE(so.udpReceiveOffload());
+
+    ntsa::SocketOption other(so);
+    NTSCFG_TEST_EQ(other, so);
+
+    so.makeUdpReceiveOffload();
+    NTSCFG_TEST_FALSE(so.udpReceiveOffload());
+    NTSCFG_TEST_NE(other, so);
+
+    so.reset();
+    NTSCFG_TEST_FALSE(so.isUdpReceiveOffload());
+}
+
 NTSCFG_TEST_DRIVER
 {
     NTSCFG_TEST_REGISTER(1);
     NTSCFG_TEST_REGISTER(2);
     NTSCFG_TEST_REGISTER(3);
+    NTSCFG_TEST_REGISTER(4);
+    NTSCFG_TEST_REGISTER(5);
 }
 NTSCFG_TEST_DRIVER_END;
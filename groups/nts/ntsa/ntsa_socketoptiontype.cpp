@@ -44,6 +44,9 @@ int SocketOptionType::fromInt(SocketOptionType::Value* result, int number)
     case SocketOptionType::e_RX_TIMESTAMPING:
     case SocketOptionType::e_TX_TIMESTAMPING:
     case SocketOptionType::e_ZERO_COPY:
+    case SocketOptionType::e_REUSE_PORT:
+    case SocketOptionType::e_UDP_SEGMENT:
+    case SocketOptionType::e_UDP_GRO:
     case SocketOptionType::e_TCP_CONGESTION_CONTROL:
         *result = static_cast<SocketOptionType::Value>(number);
         return 0;
@@ -128,6 +131,18 @@ int SocketOptionType::fromString(SocketOptionType::Value* result,
         *result = e_ZERO_COPY;
         return 0;
     }
+    if (bdlb::String::areEqualCaseless(string, "REUSE_PORT")) {
+        *result = e_REUSE_PORT;
+        return 0;
+    }
+    if (bdlb::String::areEqualCaseless(string, "UDP_SEGMENT")) {
+        *result = e_UDP_SEGMENT;
+        return 0;
+    }
+    if (bdlb::String::areEqualCaseless(string, "UDP_GRO")) {
+        *result = e_UDP_GRO;
+        return 0;
+    }
     if (bdlb::String::areEqualCaseless(string, "TCP_CONGESTION_CONTROL")) {
         *result = e_TCP_CONGESTION_CONTROL;
         return 0;
@@ -193,6 +208,15 @@ const char* SocketOptionType::toString(SocketOptionType::Value value)
     case e_ZERO_COPY: {
         return "ZERO_COPY";
     } break;
+    case e_REUSE_PORT: {
+        return "REUSE_PORT";
+    } break;
+    case e_UDP_SEGMENT: {
+        return "UDP_SEGMENT";
+    } break;
+    case e_UDP_GRO: {
+        return "UDP_GRO";
+    } break;
     case e_TCP_CONGESTION_CONTROL: {
         return "TCP_CONGESTION_CONTROL";
     } break;
@@ -97,7 +97,19 @@ struct SocketOptionType {
         e_ZERO_COPY = 17,
 
         /// Set the TCP congestion control algorithm.
-        e_TCP_CONGESTION_CONTROL = 18
+        e_TCP_CONGESTION_CONTROL = 18,
+
+        /// Allow multiple sockets to bind to the same address and port, with
+        /// incoming connections or datagrams distributed among them.
+        e_REUSE_PORT = 19,
+
+        /// Segment each datagram sent into multiple datagrams of a fixed
+        /// size in the operating system or network interface.
+        e_UDP_SEGMENT = 20,
+
+        /// Coalesce multiple datagrams received into a single datagram in
+        /// the operating system or network interface.
+        e_UDP_GRO = 21
     };
 
     /// Return the string representation exactly matching the enumerator
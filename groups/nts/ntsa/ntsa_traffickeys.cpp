@@ -0,0 +1,303 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntsa_traffickeys.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntsa_traffickeys_cpp, "$Id$ $CSID$")
+
+#include <bdlb_string.h>
+#include <bslim_printer.h>
+
+namespace BloombergLP {
+namespace ntsa {
+
+namespace {
+
+// Overwrite the contents of the specified 'vector' with zeroes, in a manner
+// the compiler may not elide, then clear it.
+void wipe(bsl::vector<bsl::uint8_t>* vector)
+{
+    volatile bsl::uint8_t* current = vector->data();
+    for (bsl::size_t i = 0; i < vector->size(); ++i) {
+        current[i] = 0;
+    }
+
+    vector->clear();
+}
+
+// Assign the specified 'size' bytes at the specified 'data' to the specified
+// 'vector', overwriting its previous contents first.
+void assign(bsl::vector<bsl::uint8_t>* vector,
+            const void*                data,
+            bsl::size_t                size)
+{
+    wipe(vector);
+
+    const bsl::uint8_t* begin = static_cast<const bsl::uint8_t*>(data);
+    vector->assign(begin, begin + size);
+}
+
+}  // close unnamed namespace
+
+int TrafficCipher::fromInt(TrafficCipher::Value* result, int number)
+{
+    switch (number) {
+    case TrafficCipher::e_UNDEFINED:
+    case TrafficCipher::e_AES_128_GCM:
+    case TrafficCipher::e_AES_256_GCM:
+    case TrafficCipher::e_CHACHA20_POLY1305:
+        *result = static_cast<TrafficCipher::Value>(number);
+        return 0;
+    default:
+        return -1;
+    }
+}
+
+int TrafficCipher::fromString(TrafficCipher::Value*    result,
+                              const bslstl::StringRef& string)
+{
+    if (bdlb::String::areEqualCaseless(string, "UNDEFINED")) {
+        *result = e_UNDEFINED;
+        return 0;
+    }
+    if (bdlb::String::areEqualCaseless(string, "AES_128_GCM")) {
+        *result = e_AES_128_GCM;
+        return 0;
+    }
+    if (bdlb::String::areEqualCaseless(string, "AES_256_GCM")) {
+        *result = e_AES_256_GCM;
+        return 0;
+    }
+    if (bdlb::String::areEqualCaseless(string, "CHACHA20_POLY1305")) {
+        *result = e_CHACHA20_POLY1305;
+        return 0;
+    }
+
+    return -1;
+}
+
+const char* TrafficCipher::toString(TrafficCipher::Value value)
+{
+    switch (value) {
+    case e_UNDEFINED: {
+        return "UNDEFINED";
+    } break;
+    case e_AES_128_GCM: {
+        return "AES_128_GCM";
+    } break;
+    case e_AES_256_GCM: {
+        return "AES_256_GCM";
+    } break;
+    case e_CHACHA20_POLY1305: {
+        return "CHACHA20_POLY1305";
+    } break;
+    }
+
+    BSLS_ASSERT(!"invalid enumerator");
+    return 0;
+}
+
+bsl::ostream& TrafficCipher::print(bsl::ostream&        stream,
+                                   TrafficCipher::Value value)
+{
+    return stream << toString(value);
+}
+
+bsl::ostream& operator<<(bsl::ostream& stream, TrafficCipher::Value rhs)
+{
+    return TrafficCipher::print(stream, rhs);
+}
+
+TrafficKeys::TrafficKeys(bslma::Allocator* basicAllocator)
+: d_version(0)
+, d_cipher(ntsa::TrafficCipher::e_UNDEFINED)
+, d_sendKey(basicAllocator)
+, d_sendIv(basicAllocator)
+, d_sendSequenceNumber(0)
+, d_receiveKey(basicAllocator)
+, d_receiveIv(basicAllocator)
+, d_receiveSequenceNumber(0)
+{
+}
+
+TrafficKeys::TrafficKeys(const TrafficKeys& original,
+                         bslma::Allocator*  basicAllocator)
+: d_version(original.d_version)
+, d_cipher(original.d_cipher)
+, d_sendKey(original.d_sendKey, basicAllocator)
+, d_sendIv(original.d_sendIv, basicAllocator)
+, d_sendSequenceNumber(original.d_sendSequenceNumber)
+, d_receiveKey(original.d_receiveKey, basicAllocator)
+, d_receiveIv(original.d_receiveIv, basicAllocator)
+, d_receiveSequenceNumber(original.d_receiveSequenceNumber)
+{
+}
+
+TrafficKeys::~TrafficKeys()
+{
+    wipe(&d_sendKey);
+    wipe(&d_sendIv);
+    wipe(&d_receiveKey);
+    wipe(&d_receiveIv);
+}
+
+TrafficKeys& TrafficKeys::operator=(const TrafficKeys& other)
+{
+    if (this != &other) {
+        d_version = other.d_version;
+        d_cipher  = other.d_cipher;
+
+        assign(&d_sendKey, other.d_sendKey.data(), other.d_sendKey.size());
+        assign(&d_sendIv, other.d_sendIv.data(), other.d_sendIv.size());
+
+        d_sendSequenceNumber = other.d_sendSequenceNumber;
+
+        assign(&d_receiveKey,
+               other.d_receiveKey.data(),
+               other.d_receiveKey.size());
+        assign(&d_receiveIv,
+               other.d_receiveIv.data(),
+               other.d_receiveIv.size());
+
+        d_receiveSequenceNumber = other.d_receiveSequenceNumber;
+    }
+
+    return *this;
+}
+
+void TrafficKeys::reset()
+{
+    d_version = 0;
+    d_cipher  = ntsa::TrafficCipher::e_UNDEFINED;
+
+    wipe(&d_sendKey);
+    wipe(&d_sendIv);
+    d_sendSequenceNumber = 0;
+
+    wipe(&d_receiveKey);
+    wipe(&d_receiveIv);
+    d_receiveSequenceNumber = 0;
+}
+
+void TrafficKeys::setSendKey(const void* data, bsl::size_t size)
+{
+    assign(&d_sendKey, data, size);
+}
+
+void TrafficKeys::setSendIv(const void* data, bsl::size_t size)
+{
+    assign(&d_sendIv, data, size);
+}
+
+void TrafficKeys::setReceiveKey(const void* data, bsl::size_t size)
+{
+    assign(&d_receiveKey, data, size);
+}
+
+void TrafficKeys::setReceiveIv(const void* data, bsl::size_t size)
+{
+    assign(&d_receiveIv, data, size);
+}
+
+bool TrafficKeys::equals(const TrafficKeys& other) const
+{
+    return d_version == other.d_version && d_cipher == other.d_cipher &&
+           d_sendKey == other.d_sendKey && d_sendIv == other.d_sendIv &&
+           d_sendSequenceNumber == other.d_sendSequenceNumber &&
+           d_receiveKey == other.d_receiveKey &&
+           d_receiveIv == other.d_receiveIv &&
+           d_receiveSequenceNumber == other.d_receiveSequenceNumber;
+}
+
+bool TrafficKeys::less(const TrafficKeys& other) const
+{
+    if (d_version < other.d_version) {
+        return true;
+    }
+
+    if (other.d_version < d_version) {
+        return false;
+    }
+
+    if (d_cipher < other.d_cipher) {
+        return true;
+    }
+
+    if (other.d_cipher < d_cipher) {
+        return false;
+    }
+
+    if (d_sendKey < other.d_sendKey) {
+        return true;
+    }
+
+    if (other.d_sendKey < d_sendKey) {
+        return false;
+    }
+
+    if (d_sendIv < other.d_sendIv) {
+        return true;
+    }
+
+    if (other.d_sendIv < d_sendIv) {
+        return false;
+    }
+
+    if (d_sendSequenceNumber < other.d_sendSequenceNumber) {
+        return true;
+    }
+
+    if (other.d_sendSequenceNumber < d_sendSequenceNumber) {
+        return false;
+    }
+
+    if (d_receiveKey < other.d_receiveKey) {
+        return true;
+    }
+
+    if (other.d_receiveKey < d_receiveKey) {
+        return false;
+    }
+
+    if (d_receiveIv < other.d_receiveIv) {
+        return true;
+    }
+
+    if (other.d_receiveIv < d_receiveIv) {
+        return false;
+    }
+
+    return d_receiveSequenceNumber < other.d_receiveSequenceNumber;
+}
+
+bsl::ostream& TrafficKeys::print(bsl::ostream& stream,
+                                 int           level,
+                                 int           spacesPerLevel) const
+{
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("version", d_version);
+    printer.printAttribute("cipher", d_cipher);
+    printer.printAttribute("sendKeySize", d_sendKey.size());
+    printer.printAttribute("sendSequenceNumber", d_sendSequenceNumber);
+    printer.printAttribute("receiveKeySize", d_receiveKey.size());
+    printer.printAttribute("receiveSequenceNumber", d_receiveSequenceNumber);
+    printer.end();
+    return stream;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
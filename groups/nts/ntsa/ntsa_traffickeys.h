@@ -0,0 +1,400 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTSA_TRAFFICKEYS
+#define INCLUDED_NTSA_TRAFFICKEYS
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntscfg_platform.h>
+#include <ntsscm_version.h>
+#include <bslh_hash.h>
+#include <bslma_allocator.h>
+#include <bsl_cstdint.h>
+#include <bsl_ostream.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ntsa {
+
+/// Provide an enumeration of the ciphers that protect TLS records.
+///
+/// @par Thread Safety
+/// This struct is thread safe.
+///
+/// @ingroup module_ntsa_system
+struct TrafficCipher {
+  public:
+    /// Provide an enumeration of the ciphers that protect TLS records.
+    enum Value {
+        /// The cipher is undefined.
+        e_UNDEFINED = 0,
+
+        /// AES in Galois/Counter Mode using a 128-bit key.
+        e_AES_128_GCM = 1,
+
+        /// AES in Galois/Counter Mode using a 256-bit key.
+        e_AES_256_GCM = 2,
+
+        /// The ChaCha20 stream cipher authenticated by Poly1305.
+        e_CHACHA20_POLY1305 = 3
+    };
+
+    /// Return the string representation exactly matching the enumerator name
+    /// corresponding to the specified enumeration 'value'.
+    static const char* toString(Value value);
+
+    /// Load into the specified 'result' the enumerator matching the specified
+    /// 'string'.  Return 0 on success, and a non-zero value with no effect on
+    /// 'result' otherwise (i.e., 'string' does not match any enumerator).
+    static int fromString(Value* result, const bslstl::StringRef& string);
+
+    /// Load into the specified 'result' the enumerator matching the specified
+    /// 'number'.  Return 0 on success, and a non-zero value with no effect on
+    /// 'result' otherwise (i.e., 'number' does not match any enumerator).
+    static int fromInt(Value* result, int number);
+
+    /// Write to the specified 'stream' the string representation of the
+    /// specified enumeration 'value'.  Return a reference to the modifiable
+    /// 'stream'.
+    static bsl::ostream& print(bsl::ostream& stream, Value value);
+};
+
+/// Format the specified 'rhs' to the specified output 'stream' and return a
+/// reference to the modifiable 'stream'.
+///
+/// @related ntsa::TrafficCipher
+bsl::ostream& operator<<(bsl::ostream& stream, TrafficCipher::Value rhs);
+
+/// Describe the keys negotiated by a TLS handshake that protect the records
+/// subsequently sent and received on a connection.
+///
+/// @details
+/// Provide a value-semantic type that describes the symmetric keys,
+/// initialization vectors, and record sequence numbers of each direction of
+/// an established TLS session, in the form required to install the session
+/// into the operating system so that the kernel encrypts outgoing records
+/// and decrypts incoming records. Note that the keys are secrets: they are
+/// not formatted when this object is printed.
+///
+/// @par Attributes
+/// This class is composed of the following attributes.
+///
+/// @li @b version:
+/// The TLS protocol version as encoded in the record layer, e.g. 0x0303 for
+/// TLS 1.2 and 0x0304 for TLS 1.3.
+///
+/// @li @b cipher:
+/// The cipher that protects each record.
+///
+/// @li @b sendKey:
+/// The key that encrypts records sent to the peer.
+///
+/// @li @b sendIv:
+/// The implicit initialization vector of records sent to the peer, i.e. the
+/// 4-byte salt followed by the 8-byte explicit nonce for AES-GCM in TLS 1.2,
+/// or the 12-byte static IV otherwise.
+///
+/// @li @b sendSequenceNumber:
+/// The sequence number of the next record sent to the peer.
+///
+/// @li @b receiveKey:
+/// The key that decrypts records received from the peer.
+///
+/// @li @b receiveIv:
+/// The implicit initialization vector of records received from the peer.
+///
+/// @li @b receiveSequenceNumber:
+/// The sequence number of the next record received from the peer.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntsa_system
+class TrafficKeys
+{
+    bsl::uint16_t              d_version;
+    ntsa::TrafficCipher::Value d_cipher;
+    bsl::vector<bsl::uint8_t>  d_sendKey;
+    bsl::vector<bsl::uint8_t>  d_sendIv;
+    bsl::uint64_t              d_sendSequenceNumber;
+    bsl::vector<bsl::uint8_t>  d_receiveKey;
+    bsl::vector<bsl::uint8_t>  d_receiveIv;
+    bsl::uint64_t              d_receiveSequenceNumber;
+
+  public:
+    enum {
+        /// The record layer encoding of TLS 1.2.
+        k_TLS_V1_2 = 0x0303,
+
+        /// The record layer encoding of TLS 1.3.
+        k_TLS_V1_3 = 0x0304
+    };
+
+    /// Create new traffic keys having the default value. Optionally specify
+    /// a 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
+    /// the currently installed default allocator is used.
+    explicit TrafficKeys(bslma::Allocator* basicAllocator = 0);
+
+    /// Create new traffic keys having the same value as the specified
+    /// 'original' object. Optionally specify a 'basicAllocator' used to
+    /// supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used.
+    TrafficKeys(const TrafficKeys& original,
+                bslma::Allocator*  basicAllocator = 0);
+
+    /// Destroy this object. Note that the keys are overwritten before their
+    /// memory is released.
+    ~TrafficKeys();
+
+    /// Assign the value of the specified 'other' object to this object.
+    /// Return a reference to this modifiable object.
+    TrafficKeys& operator=(const TrafficKeys& other);
+
+    /// Reset the value of this object to its value upon default
+    /// construction.
+    void reset();
+
+    /// Set the TLS protocol version as encoded in the record layer to the
+    /// specified 'value'.
+    void setVersion(bsl::uint16_t value);
+
+    /// Set the cipher that protects each record to the specified 'value'.
+    void setCipher(ntsa::TrafficCipher::Value value);
+
+    /// Set the key that encrypts records sent to the peer to the specified
+    /// 'size' bytes at the specified 'data'.
+    void setSendKey(const void* data, bsl::size_t size);
+
+    /// Set the implicit initialization vector of records sent to the peer to
+    /// the specified 'size' bytes at the specified 'data'.
+    void setSendIv(const void* data, bsl::size_t size);
+
+    /// Set the sequence number of the next record sent to the peer to the
+    /// specified 'value'.
+    void setSendSequenceNumber(bsl::uint64_t value);
+
+    /// Set the key that decrypts records received from the peer to the
+    /// specified 'size' bytes at the specified 'data'.
+    void setReceiveKey(const void* data, bsl::size_t size);
+
+    /// Set the implicit initialization vector of records received from the
+    /// peer to the specified 'size' bytes at the specified 'data'.
+    void setReceiveIv(const void* data, bsl::size_t size);
+
+    /// Set the sequence number of the next record received from the peer to
+    /// the specified 'value'.
+    void setReceiveSequenceNumber(bsl::uint64_t value);
+
+    /// Return the TLS protocol version as encoded in the record layer.
+    bsl::uint16_t version() const;
+
+    /// Return the cipher that protects each record.
+    ntsa::TrafficCipher::Value cipher() const;
+
+    /// Return the key that encrypts records sent to the peer.
+    const bsl::vector<bsl::uint8_t>& sendKey() const;
+
+    /// Return the implicit initialization vector of records sent to the
+    /// peer.
+    const bsl::vector<bsl::uint8_t>& sendIv() const;
+
+    /// Return the sequence number of the next record sent to the peer.
+    bsl::uint64_t sendSequenceNumber() const;
+
+    /// Return the key that decrypts records received from the peer.
+    const bsl::vector<bsl::uint8_t>& receiveKey() const;
+
+    /// Return the implicit initialization vector of records received from
+    /// the peer.
+    const bsl::vector<bsl::uint8_t>& receiveIv() const;
+
+    /// Return the sequence number of the next record received from the peer.
+    bsl::uint64_t receiveSequenceNumber() const;
+
+    /// Return true if this object has the same value as the specified
+    /// 'other' object, otherwise return false.
+    bool equals(const TrafficKeys& other) const;
+
+    /// Return true if the value of this object is less than the value of
+    /// the specified 'other' object, otherwise return false.
+    bool less(const TrafficKeys& other) const;
+
+    /// Format this object to the specified output 'stream' at the
+    /// optionally specified indentation 'level' and return a reference to
+    /// the modifiable 'stream'.  If 'level' is specified, optionally
+    /// specify 'spacesPerLevel', the number of spaces per indentation level
+    /// for this and all of its nested objects.  Each line is indented by
+    /// the absolute value of 'level * spacesPerLevel'.  If 'level' is
+    /// negative, suppress indentation of the first line.  If
+    /// 'spacesPerLevel' is negative, suppress line breaks and format the
+    /// entire output on one line.  If 'stream' is initially invalid, this
+    /// operation has no effect.  Note that a trailing newline is provided
+    /// in multiline mode only.
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level          = 0,
+                        int           spacesPerLevel = 4) const;
+
+    /// This type accepts an allocator argument to its constructors and may
+    /// dynamically allocate memory during its operation.
+    NTSCFG_DECLARE_NESTED_USES_ALLOCATOR_TRAITS(TrafficKeys);
+};
+
+/// Write the specified 'object' to the specified 'stream'. Return
+/// a modifiable reference to the 'stream'.
+///
+/// @related ntsa::TrafficKeys
+bsl::ostream& operator<<(bsl::ostream& stream, const TrafficKeys& object);
+
+/// Return true if the specified 'lhs' has the same value as the specified
+/// 'rhs', otherwise return false.
+///
+/// @related ntsa::TrafficKeys
+bool operator==(const TrafficKeys& lhs, const TrafficKeys& rhs);
+
+/// Return true if the specified 'lhs' does not have the same value as the
+/// specified 'rhs', otherwise return false.
+///
+/// @related ntsa::TrafficKeys
+bool operator!=(const TrafficKeys& lhs, const TrafficKeys& rhs);
+
+/// Return true if the value of the specified 'lhs' is less than the value
+/// of the specified 'rhs', otherwise return false.
+///
+/// @related ntsa::TrafficKeys
+bool operator<(const TrafficKeys& lhs, const TrafficKeys& rhs);
+
+/// Contribute the values of the salient attributes of the specified 'value'
+/// to the specified hash 'algorithm'.
+///
+/// @related ntsa::TrafficKeys
+template <typename HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& algorithm, const TrafficKeys& value);
+
+NTSCFG_INLINE
+void TrafficKeys::setVersion(bsl::uint16_t value)
+{
+    d_version = value;
+}
+
+NTSCFG_INLINE
+void TrafficKeys::setCipher(ntsa::TrafficCipher::Value value)
+{
+    d_cipher = value;
+}
+
+NTSCFG_INLINE
+void TrafficKeys::setSendSequenceNumber(bsl::uint64_t value)
+{
+    d_sendSequenceNumber = value;
+}
+
+NTSCFG_INLINE
+void TrafficKeys::setReceiveSequenceNumber(bsl::uint64_t value)
+{
+    d_receiveSequenceNumber = value;
+}
+
+NTSCFG_INLINE
+bsl::uint16_t TrafficKeys::version() const
+{
+    return d_version;
+}
+
+NTSCFG_INLINE
+ntsa::TrafficCipher::Value TrafficKeys::cipher() const
+{
+    return d_cipher;
+}
+
+NTSCFG_INLINE
+const bsl::vector<bsl::uint8_t>& TrafficKeys::sendKey() const
+{
+    return d_sendKey;
+}
+
+NTSCFG_INLINE
+const bsl::vector<bsl::uint8_t>& TrafficKeys::sendIv() const
+{
+    return d_sendIv;
+}
+
+NTSCFG_INLINE
+bsl::uint64_t TrafficKeys::sendSequenceNumber() const
+{
+    return d_sendSequenceNumber;
+}
+
+NTSCFG_INLINE
+const bsl::vector<bsl::uint8_t>& TrafficKeys::receiveKey() const
+{
+    return d_receiveKey;
+}
+
+NTSCFG_INLINE
+const bsl::vector<bsl::uint8_t>& TrafficKeys::receiveIv() const
+{
+    return d_receiveIv;
+}
+
+NTSCFG_INLINE
+bsl::uint64_t TrafficKeys::receiveSequenceNumber() const
+{
+    return d_receiveSequenceNumber;
+}
+
+NTSCFG_INLINE
+bsl::ostream& operator<<(bsl::ostream& stream, const TrafficKeys& object)
+{
+    return object.print(stream, 0, -1);
+}
+
+NTSCFG_INLINE
+bool operator==(const TrafficKeys& lhs, const TrafficKeys& rhs)
+{
+    return lhs.equals(rhs);
+}
+
+NTSCFG_INLINE
+bool operator!=(const TrafficKeys& lhs, const TrafficKeys& rhs)
+{
+    return !operator==(lhs, rhs);
+}
+
+NTSCFG_INLINE
+bool operator<(const TrafficKeys& lhs, const TrafficKeys& rhs)
+{
+    return lhs.less(rhs);
+}
+
+template <typename HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& algorithm, const TrafficKeys& value)
+{
+    using bslh::hashAppend;
+
+    hashAppend(algorithm, value.version());
+    hashAppend(algorithm, value.cipher());
+    hashAppend(algorithm, value.sendKey());
+    hashAppend(algorithm, value.sendIv());
+    hashAppend(algorithm, value.sendSequenceNumber());
+    hashAppend(algorithm, value.receiveKey());
+    hashAppend(algorithm, value.receiveIv());
+    hashAppend(algorithm, value.receiveSequenceNumber());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
@@ -0,0 +1,131 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntsa_traffickeys.h>
+
+#include <ntscfg_test.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// This test driver verifies the value semantics of the description of TLS
+// traffic keys.
+//-----------------------------------------------------------------------------
+
+// [ 1] Traffic keys have value semantics.
+// [ 2] Traffic keys do not print their secrets.
+//-----------------------------------------------------------------------------
+
+NTSCFG_TEST_CASE(1)
+{
+    // Concern: Traffic keys have value semantics.
+    // Plan:
+
+    ntscfg::TestAllocator ta;
+    {
+        const bsl::uint8_t k_SEND_KEY[16] = {
+            1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+        const bsl::uint8_t k_SEND_IV[12] = {
+            21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32};
+        const bsl::uint8_t k_RECEIVE_KEY[16] = {
+            41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56};
+        const bsl::uint8_t k_RECEIVE_IV[12] = {
+            61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72};
+
+        ntsa::TrafficKeys keys(&ta);
+
+        NTSCFG_TEST_EQ(keys.version(), 0);
+        NTSCFG_TEST_EQ(keys.cipher(), ntsa::TrafficCipher::e_UNDEFINED);
+        NTSCFG_TEST_TRUE(keys.sendKey().empty());
+        NTSCFG_TEST_TRUE(keys.receiveKey().empty());
+
+        keys.setVersion(ntsa::TrafficKeys::k_TLS_V1_3);
+        keys.setCipher(ntsa::TrafficCipher::e_AES_128_GCM);
+        keys.setSendKey(k_SEND_KEY, sizeof k_SEND_KEY);
+        keys.setSendIv(k_SEND_IV, sizeof k_SEND_IV);
+        keys.setSendSequenceNumber(3);
+        keys.setReceiveKey(k_RECEIVE_KEY, sizeof k_RECEIVE_KEY);
+        keys.setReceiveIv(k_RECEIVE_IV, sizeof k_RECEIVE_IV);
+        keys.setReceiveSequenceNumber(5);
+
+        NTSCFG_TEST_EQ(keys.version(), 0x0304);
+        NTSCFG_TEST_EQ(keys.cipher(), ntsa::TrafficCipher::e_AES_128_GCM);
+        NTSCFG_TEST_EQ(keys.sendKey().size(), sizeof k_SEND_KEY);
+        NTSCFG_TEST_EQ(keys.sendKey()[15], 16);
+        NTSCFG_TEST_EQ(keys.sendIv().size(), sizeof k_SEND_IV);
+        NTSCFG_TEST_EQ(keys.sendSequenceNumber(), 3);
+        NTSCFG_TEST_EQ(keys.receiveKey().size(), sizeof k_RECEIVE_KEY);
+        NTSCFG_TEST_EQ(keys.receiveKey()[0], 41);
+        NTSCFG_TEST_EQ(keys.receiveIv().size(), sizeof k_RECEIVE_IV);
+        NTSCFG_TEST_EQ(keys.receiveSequenceNumber(), 5);
+
+        ntsa::TrafficKeys copy(keys, &ta);
+        NTSCFG_TEST_EQ(copy, keys);
+        NTSCFG_TEST_FALSE(copy < keys);
+
+        copy.setReceiveSequenceNumber(6);
+        NTSCFG_TEST_NE(copy, keys);
+        NTSCFG_TEST_TRUE(keys < copy);
+
+        copy = keys;
+        NTSCFG_TEST_EQ(copy, keys);
+
+        copy.reset();
+        NTSCFG_TEST_EQ(copy, ntsa::TrafficKeys(&ta));
+    }
+    NTSCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTSCFG_TEST_CASE(2)
+{
+    // Concern: Traffic keys do not print their secrets.
+    // Plan:
+
+    ntscfg::TestAllocator ta;
+    {
+        const char k_KEY[] = "ABCDEFGHIJKLMNOP";
+
+        ntsa::TrafficKeys keys(&ta);
+        keys.setVersion(ntsa::TrafficKeys::k_TLS_V1_2);
+        keys.setCipher(ntsa::TrafficCipher::e_AES_128_GCM);
+        keys.setSendKey(k_KEY, sizeof k_KEY - 1);
+        keys.setReceiveKey(k_KEY, sizeof k_KEY - 1);
+
+        bsl::stringstream ss;
+        ss << keys;
+
+        const bsl::string output = ss.str();
+
+        NTSCFG_TEST_NE(output.find("AES_128_GCM"), bsl::string::npos);
+        NTSCFG_TEST_EQ(output.find("ABCD"), bsl::string::npos);
+    }
+    NTSCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTSCFG_TEST_DRIVER
+{
+    NTSCFG_TEST_REGISTER(1);
+    NTSCFG_TEST_REGISTER(2);
+}
+NTSCFG_TEST_DRIVER_END;
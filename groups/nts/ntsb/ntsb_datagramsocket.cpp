@@ -130,6 +130,35 @@ ntsa::Error DatagramSocket::receive(ntsa::ReceiveContext*       context,
     return ntsu::SocketUtil::receive(context, data, options, d_handle);
 }
 
+ntsa::Error DatagramSocket::sendToMultiple(bsl::size_t* numBytesSent,
+                                           bsl::size_t* numMessagesSent,
+                                           const ntsa::ConstMessage* messages,
+                                           bsl::size_t numMessages)
+{
+    return ntsu::SocketUtil::sendToMultiple(0,
+                                            numBytesSent,
+                                            0,
+                                            numMessagesSent,
+                                            messages,
+                                            numMessages,
+                                            d_handle);
+}
+
+ntsa::Error DatagramSocket::receiveFromMultiple(
+    bsl::size_t*          numBytesReceived,
+    bsl::size_t*          numMessagesReceived,
+    ntsa::MutableMessage* messages,
+    bsl::size_t           numMessages)
+{
+    return ntsu::SocketUtil::receiveFromMultiple(0,
+                                                 numBytesReceived,
+                                                 0,
+                                                 numMessagesReceived,
+                                                 messages,
+                                                 numMessages,
+                                                 d_handle);
+}
+
 ntsa::Error DatagramSocket::receiveNotifications(
     ntsa::NotificationQueue* notifications)
 {
@@ -238,6 +267,33 @@ bsl::size_t DatagramSocket::maxBuffersPerReceive() const
     return ntsu::SocketUtil::maxBuffersPerReceive();
 }
 
+bsl::size_t DatagramSocket::maxMessagesPerSend() const
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    return ntsu::SocketUtil::maxMessagesPerSend();
+#else
+    return 1;
+#endif
+}
+
+bsl::size_t DatagramSocket::maxMessagesPerReceive() const
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    return ntsu::SocketUtil::maxMessagesPerReceive();
+#else
+    return 1;
+#endif
+}
+
+bsl::size_t DatagramSocket::maxSegmentsPerSend() const
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    return ntsu::SocketUtil::maxSegmentsPerSend();
+#else
+    return 1;
+#endif
+}
+
 ntsa::Error DatagramSocket::pair(ntsb::DatagramSocket*  client,
                                  ntsb::DatagramSocket*  server,
                                  ntsa::Transport::Value type)
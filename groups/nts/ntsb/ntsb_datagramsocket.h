@@ -132,6 +132,30 @@ class DatagramSocket : public ntsi::DatagramSocket
                         const ntsa::ReceiveOptions& options)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Enqueue the specified 'numMessages' of 'messages' to the socket send
+    /// buffer, each message describing the buffers to send and the endpoint
+    /// to which they should be sent, in a single operation. Load into the
+    /// specified 'numBytesSent' the number of bytes sent and load into the
+    /// specified 'numMessagesSent' the number of messages sent. Return the
+    /// error.
+    ntsa::Error sendToMultiple(bsl::size_t*              numBytesSent,
+                               bsl::size_t*              numMessagesSent,
+                               const ntsa::ConstMessage* messages,
+                               bsl::size_t               numMessages)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Dequeue from the socket receive buffer into the specified
+    /// 'numMessages' of 'messages' in a single operation, loading into each
+    /// message received its size and the endpoint from which it was sent.
+    /// Load into the specified 'numBytesReceived' the number of bytes
+    /// received and load into the specified 'numMessagesReceived' the
+    /// number of messages received. Return the error.
+    ntsa::Error receiveFromMultiple(bsl::size_t*          numBytesReceived,
+                                    bsl::size_t*          numMessagesReceived,
+                                    ntsa::MutableMessage* messages,
+                                    bsl::size_t           numMessages)
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Read data from the socket error queue. Then if the specified
     /// 'notifications' is not null parse fetched data to extract control
     /// messages into the specified 'notifications'. Return the error.
@@ -225,6 +249,19 @@ class DatagramSocket : public ntsi::DatagramSocket
     /// silently ignored.
     bsl::size_t maxBuffersPerReceive() const BSLS_KEYWORD_OVERRIDE;
 
+    /// Return the maximum number of messages that can be sent in a single
+    /// operation. Additional messages beyond this limit are not sent.
+    bsl::size_t maxMessagesPerSend() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the maximum number of messages that can be received in a
+    /// single operation.
+    bsl::size_t maxMessagesPerReceive() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the maximum number of datagrams into which the data of a
+    /// single send operation may be segmented by the operating system or
+    /// network interface, or 1 if segmentation is not supported.
+    bsl::size_t maxSegmentsPerSend() const BSLS_KEYWORD_OVERRIDE;
+
     /// Load into the specified 'client' and 'server' a connected pair of
     /// datagram sockets of the specified 'type'.
     static ntsa::Error pair(ntsb::DatagramSocket*  client,
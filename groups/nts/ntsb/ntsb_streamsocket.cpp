@@ -20,17 +20,26 @@ BSLS_IDENT_RCSID(ntsb_streamsocket_cpp, "$Id$ $CSID$")
 
 #include <ntsu_socketoptionutil.h>
 #include <ntsu_socketutil.h>
+#include <bslma_default.h>
 
 namespace BloombergLP {
 namespace ntsb {
 
 StreamSocket::StreamSocket()
 : d_handle(ntsa::k_INVALID_HANDLE)
+, d_trafficKeysInstalled(false)
+, d_closeNotifyPending(false)
+, d_zeroCopyRegionPoolLock(bsls::SpinLock::s_unlocked)
+, d_zeroCopyRegionPool_sp()
 {
 }
 
 StreamSocket::StreamSocket(ntsa::Handle handle)
 : d_handle(handle)
+, d_trafficKeysInstalled(false)
+, d_closeNotifyPending(false)
+, d_zeroCopyRegionPoolLock(bsls::SpinLock::s_unlocked)
+, d_zeroCopyRegionPool_sp()
 {
 }
 
@@ -41,6 +50,29 @@ StreamSocket::~StreamSocket()
     }
 }
 
+bsl::shared_ptr<ntsu::ZeroCopyRegionPool> StreamSocket::zeroCopyRegionPool()
+{
+    bsls::SpinLockGuard guard(&d_zeroCopyRegionPoolLock);
+
+    // Regions are mapped from a particular socket, so the pool is discarded
+    // when the handle that implements this socket is closed or released, and
+    // replaced if the handle otherwise changes. Regions still referenced by
+    // received data keep the pool from which they were acquired alive.
+
+    if (!d_zeroCopyRegionPool_sp ||
+        d_zeroCopyRegionPool_sp->handle() != d_handle)
+    {
+        bslma::Allocator* allocator = bslma::Default::defaultAllocator();
+
+        d_zeroCopyRegionPool_sp.createInplace(allocator,
+                                              d_handle,
+                                              k_MAX_ZERO_COPY_REGIONS,
+                                              allocator);
+    }
+
+    return d_zeroCopyRegionPool_sp;
+}
+
 ntsa::Error StreamSocket::open(ntsa::Transport::Value transport)
 {
     if (d_handle != ntsa::k_INVALID_HANDLE) {
@@ -72,6 +104,11 @@ ntsa::Error StreamSocket::acquire(ntsa::Handle handle)
 
 ntsa::Handle StreamSocket::release()
 {
+    {
+        bsls::SpinLockGuard guard(&d_zeroCopyRegionPoolLock);
+        d_zeroCopyRegionPool_sp.reset();
+    }
+
     ntsa::Handle result = d_handle;
     d_handle            = ntsa::k_INVALID_HANDLE;
     return result;
@@ -120,6 +157,21 @@ ntsa::Error StreamSocket::receive(ntsa::ReceiveContext*       context,
                                   bdlbb::Blob*                data,
                                   const ntsa::ReceiveOptions& options)
 {
+    if (d_trafficKeysInstalled && !options.encryptionOffloaded()) {
+        ntsa::ReceiveOptions effectiveOptions(options);
+        effectiveOptions.setEncryptionOffloaded(true);
+
+        return this->receive(context, data, effectiveOptions);
+    }
+
+    if (options.zeroCopy()) {
+        return ntsu::SocketUtil::receive(context,
+                                         data,
+                                         options,
+                                         this->zeroCopyRegionPool(),
+                                         d_handle);
+    }
+
     return ntsu::SocketUtil::receive(context, data, options, d_handle);
 }
 
@@ -138,6 +190,16 @@ ntsa::Error StreamSocket::receiveNotifications(
 
 ntsa::Error StreamSocket::shutdown(ntsa::ShutdownType::Value direction)
 {
+    // The peer may only distinguish a truncation attack from the end of the
+    // data if the end of the data is announced by a TLS alert: send the
+    // alert, at most once, on a best-effort basis.
+
+    if (direction != ntsa::ShutdownType::e_RECEIVE &&
+        d_closeNotifyPending.testAndSwap(true, false))
+    {
+        ntsu::SocketUtil::sendCloseNotify(d_handle);
+    }
+
     return ntsu::SocketUtil::shutdown(direction, d_handle);
 }
 
@@ -148,6 +210,11 @@ ntsa::Error StreamSocket::unlink()
 
 ntsa::Error StreamSocket::close()
 {
+    {
+        bsls::SpinLockGuard guard(&d_zeroCopyRegionPoolLock);
+        d_zeroCopyRegionPool_sp.reset();
+    }
+
     ntsa::Handle handle = d_handle;
     d_handle            = ntsa::k_INVALID_HANDLE;
 
@@ -181,6 +248,19 @@ ntsa::Error StreamSocket::setOption(const ntsa::SocketOption& option)
     return ntsu::SocketOptionUtil::setOption(d_handle, option);
 }
 
+ntsa::Error StreamSocket::setTrafficKeys(const ntsa::TrafficKeys& keys)
+{
+    ntsa::Error error = ntsu::SocketOptionUtil::setTrafficKeys(d_handle, keys);
+    if (error) {
+        return error;
+    }
+
+    d_trafficKeysInstalled = true;
+    d_closeNotifyPending   = true;
+
+    return ntsa::Error();
+}
+
 ntsa::Error StreamSocket::getBlocking(bool* blocking) const
 {
     return ntsu::SocketOptionUtil::getBlocking(d_handle, blocking);
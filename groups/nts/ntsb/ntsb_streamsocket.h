@@ -27,8 +27,11 @@ BSLS_IDENT("$Id: $")
 #include <ntscfg_platform.h>
 #include <ntsi_streamsocket.h>
 #include <ntsscm_version.h>
+#include <ntsu_zerocopyregionpool.h>
 #include <bdls_filesystemutil.h>
 #include <bslma_managedptr.h>
+#include <bsls_atomic.h>
+#include <bsls_spinlock.h>
 #include <bsl_memory.h>
 
 namespace BloombergLP {
@@ -43,12 +46,27 @@ namespace ntsb {
 /// @ingroup module_ntsb
 class StreamSocket : public ntsi::StreamSocket
 {
-    ntsa::Handle d_handle;
+    enum {
+        // The maximum number of regions mapped for zero-copy receive that are
+        // retained for reuse after the data mapped into them is released.
+        k_MAX_ZERO_COPY_REGIONS = 4
+    };
+
+    ntsa::Handle                              d_handle;
+    bsls::AtomicBool                          d_trafficKeysInstalled;
+    bsls::AtomicBool                          d_closeNotifyPending;
+    bsls::SpinLock                            d_zeroCopyRegionPoolLock;
+    bsl::shared_ptr<ntsu::ZeroCopyRegionPool> d_zeroCopyRegionPool_sp;
 
   private:
     StreamSocket(const StreamSocket&) BSLS_KEYWORD_DELETED;
     StreamSocket& operator=(const StreamSocket&) BSLS_KEYWORD_DELETED;
 
+  private:
+    /// Return the pool of regions mapped from the socket for zero-copy
+    /// receive, creating it if necessary.
+    bsl::shared_ptr<ntsu::ZeroCopyRegionPool> zeroCopyRegionPool();
+
   public:
     /// Create a new, uninitialized stream socket.
     StreamSocket();
@@ -112,7 +130,12 @@ class StreamSocket : public ntsi::StreamSocket
 
     /// Dequeue from the socket receive buffer into the specified 'data'
     /// according to the specified 'options'. Load into the specified
-    /// 'context' the result of the operation. Return the error.
+    /// 'context' the result of the operation. Return the error. Note that
+    /// if 'options.zeroCopy()' is true, the regions of memory into which
+    /// received pages are mapped are reused by subsequent receives once the
+    /// data mapped into them is released. Also note that once traffic keys
+    /// have been installed, TLS records other than application data are
+    /// interpreted as if 'options.encryptionOffloaded()' were true.
     ntsa::Error receive(ntsa::ReceiveContext*       context,
                         bdlbb::Blob*                data,
                         const ntsa::ReceiveOptions& options)
@@ -133,7 +156,9 @@ class StreamSocket : public ntsi::StreamSocket
         BSLS_KEYWORD_OVERRIDE;
 
     /// Shutdown the stream socket in the specified 'direction'. Return the
-    /// error.
+    /// error. Note that if traffic keys have been installed and the
+    /// 'direction' includes sending, a TLS "close_notify" alert is sent
+    /// before the socket is shut down.
     ntsa::Error shutdown(ntsa::ShutdownType::Value direction)
         BSLS_KEYWORD_OVERRIDE;
 
@@ -169,6 +194,14 @@ class StreamSocket : public ntsi::StreamSocket
     ntsa::Error setOption(const ntsa::SocketOption& option)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Install the specified TLS traffic 'keys' so that records
+    /// subsequently sent and received through this socket are encrypted
+    /// and decrypted by the operating system. Return the error. Note that
+    /// 'e_NOT_IMPLEMENTED' is returned if TLS offload is not supported by
+    /// the operating system.
+    ntsa::Error setTrafficKeys(const ntsa::TrafficKeys& keys)
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Load into the specified 'blocking' flag the blocking mode of the
     /// specified 'socket'. Return the error.
     ntsa::Error getBlocking(bool* blocking) const BSLS_KEYWORD_OVERRIDE;
@@ -216,6 +216,35 @@ ntsa::Error DatagramSocket::getOption(ntsa::SocketOption*           option,
     return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
 }
 
+ntsa::Error DatagramSocket::sendToMultiple(bsl::size_t* numBytesSent,
+                                           bsl::size_t* numMessagesSent,
+                                           const ntsa::ConstMessage* messages,
+                                           bsl::size_t numMessages)
+{
+    NTSCFG_WARNING_UNUSED(messages);
+    NTSCFG_WARNING_UNUSED(numMessages);
+
+    *numBytesSent    = 0;
+    *numMessagesSent = 0;
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::receiveFromMultiple(
+    bsl::size_t*          numBytesReceived,
+    bsl::size_t*          numMessagesReceived,
+    ntsa::MutableMessage* messages,
+    bsl::size_t           numMessages)
+{
+    NTSCFG_WARNING_UNUSED(messages);
+    NTSCFG_WARNING_UNUSED(numMessages);
+
+    *numBytesReceived    = 0;
+    *numMessagesReceived = 0;
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
 bsl::size_t DatagramSocket::maxBuffersPerSend() const
 {
     return 1;
@@ -226,5 +255,20 @@ bsl::size_t DatagramSocket::maxBuffersPerReceive() const
     return 1;
 }
 
+bsl::size_t DatagramSocket::maxMessagesPerSend() const
+{
+    return 1;
+}
+
+bsl::size_t DatagramSocket::maxMessagesPerReceive() const
+{
+    return 1;
+}
+
+bsl::size_t DatagramSocket::maxSegmentsPerSend() const
+{
+    return 1;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
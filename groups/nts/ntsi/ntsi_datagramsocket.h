@@ -512,6 +512,36 @@ class DatagramSocket : public ntsi::Channel
                         bsl::size_t                 capacity,
                         const ntsa::ReceiveOptions& options);
 
+    /// Enqueue the specified 'numMessages' of 'messages' to the socket send
+    /// buffer, each message describing the buffers to send and the endpoint
+    /// to which they should be sent, in a single operation. Load into the
+    /// specified 'numBytesSent' the number of bytes sent and load into the
+    /// specified 'numMessagesSent' the number of messages sent. Return the
+    /// error. Note that at most 'maxMessagesPerSend()' messages are
+    /// attempted to be sent. Note that implementations that do not support
+    /// sending multiple messages in a single operation return
+    /// 'ntsa::Error::e_NOT_IMPLEMENTED'.
+    virtual ntsa::Error sendToMultiple(bsl::size_t* numBytesSent,
+                                       bsl::size_t* numMessagesSent,
+                                       const ntsa::ConstMessage* messages,
+                                       bsl::size_t               numMessages);
+
+    /// Dequeue from the socket receive buffer into the specified
+    /// 'numMessages' of 'messages' in a single operation, loading into each
+    /// message received its size and the endpoint from which it was sent.
+    /// Load into the specified 'numBytesReceived' the number of bytes
+    /// received and load into the specified 'numMessagesReceived' the
+    /// number of messages received. Return the error. Note that at most
+    /// 'maxMessagesPerReceive()' messages are attempted to be received.
+    /// Note that implementations that do not support receiving multiple
+    /// messages in a single operation return
+    /// 'ntsa::Error::e_NOT_IMPLEMENTED'.
+    virtual ntsa::Error receiveFromMultiple(
+        bsl::size_t*          numBytesReceived,
+        bsl::size_t*          numMessagesReceived,
+        ntsa::MutableMessage* messages,
+        bsl::size_t           numMessages);
+
     /// Read data from the socket error queue. Then if the specified
     /// 'notifications' is not null parse fetched data to extract control
     /// messages into the specified 'notifications'. Return the error.
@@ -592,6 +622,19 @@ class DatagramSocket : public ntsi::Channel
     /// of a scattered read. Additional buffers beyond this limit are
     /// silently ignored.
     virtual bsl::size_t maxBuffersPerReceive() const;
+
+    /// Return the maximum number of messages that can be sent in a single
+    /// operation. Additional messages beyond this limit are not sent.
+    virtual bsl::size_t maxMessagesPerSend() const;
+
+    /// Return the maximum number of messages that can be received in a
+    /// single operation.
+    virtual bsl::size_t maxMessagesPerReceive() const;
+
+    /// Return the maximum number of datagrams into which the data of a
+    /// single send operation may be segmented by the operating system or
+    /// network interface, or 1 if segmentation is not supported.
+    virtual bsl::size_t maxSegmentsPerSend() const;
 };
 
 NTSCFG_INLINE
@@ -158,6 +158,13 @@ ntsa::Error StreamSocket::setOption(const ntsa::SocketOption& option)
     return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
 }
 
+ntsa::Error StreamSocket::setTrafficKeys(const ntsa::TrafficKeys& keys)
+{
+    NTSCFG_WARNING_UNUSED(keys);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
 ntsa::Error StreamSocket::getBlocking(bool* blocking) const
 {
     *blocking = false;
@@ -25,6 +25,7 @@ BSLS_IDENT("$Id: $")
 #include <ntsa_notificationqueue.h>
 #include <ntsa_shutdowntype.h>
 #include <ntsa_socketoption.h>
+#include <ntsa_traffickeys.h>
 #include <ntsa_transport.h>
 #include <ntscfg_platform.h>
 #include <ntsi_channel.h>
@@ -344,6 +345,13 @@ class StreamSocket : public ntsi::Channel
     /// Set the specified 'option' for this socket. Return the error.
     virtual ntsa::Error setOption(const ntsa::SocketOption& option);
 
+    /// Install the specified TLS traffic 'keys' so that records
+    /// subsequently sent and received through this socket are encrypted
+    /// and decrypted by the operating system. Return the error. Note that
+    /// 'e_NOT_IMPLEMENTED' is returned if TLS offload is not supported by
+    /// this socket or the operating system.
+    virtual ntsa::Error setTrafficKeys(const ntsa::TrafficKeys& keys);
+
     /// Load into the specified 'blocking' flag the blocking mode of the
     /// specified 'socket'. Return the error.
     virtual ntsa::Error getBlocking(bool* blocking) const;
@@ -48,6 +48,7 @@ BSLS_IDENT_RCSID(ntsu_socketoptionutil_cpp, "$Id$ $CSID$")
 #include <sys/uio.h>
 #include <unistd.h>
 #if defined(BSLS_PLATFORM_OS_LINUX)
+#include <linux/filter.h>
 #include <linux/version.h>
 #endif
 #if defined(BSLS_PLATFORM_OS_SOLARIS)
@@ -55,6 +56,39 @@ BSLS_IDENT_RCSID(ntsu_socketoptionutil_cpp, "$Id$ $CSID$")
 #endif
 #endif
 
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#if !defined(SOL_UDP)
+#define SOL_UDP 17
+#endif
+#if !defined(UDP_SEGMENT)
+#define UDP_SEGMENT 103
+#endif
+#if !defined(UDP_GRO)
+#define UDP_GRO 104
+#endif
+#if !defined(TCP_ULP)
+#define TCP_ULP 31
+#endif
+#if !defined(SOL_TLS)
+#define SOL_TLS 282
+#endif
+#if !defined(TLS_TX)
+#define TLS_TX 1
+#endif
+#if !defined(TLS_RX)
+#define TLS_RX 2
+#endif
+#if !defined(TLS_CIPHER_AES_GCM_128)
+#define TLS_CIPHER_AES_GCM_128 51
+#endif
+#if !defined(TLS_CIPHER_AES_GCM_256)
+#define TLS_CIPHER_AES_GCM_256 52
+#endif
+#if !defined(TLS_CIPHER_CHACHA20_POLY1305)
+#define TLS_CIPHER_CHACHA20_POLY1305 54
+#endif
+#endif
+
 #if defined(BSLS_PLATFORM_OS_WINDOWS)
 #ifdef NTDDI_VERSION
 #undef NTDDI_VERSION
@@ -162,6 +196,19 @@ ntsa::Error SocketOptionUtil::setOption(ntsa::Handle              socket,
     else if (option.isZeroCopy()) {
         return SocketOptionUtil::setZeroCopy(socket, option.zeroCopy());
     }
+    else if (option.isReusePort()) {
+        return SocketOptionUtil::setReusePort(socket, option.reusePort());
+    }
+    else if (option.isUdpSegmentationOffload()) {
+        return SocketOptionUtil::setUdpSegmentationOffload(
+            socket,
+            option.udpSegmentationOffload());
+    }
+    else if (option.isUdpReceiveOffload()) {
+        return SocketOptionUtil::setUdpReceiveOffload(
+            socket,
+            option.udpReceiveOffload());
+    }
     else if (option.isTcpCongestionControl()) {
         return SocketOptionUtil::setTcpCongestionControl(
             socket,
@@ -325,6 +372,33 @@ ntsa::Error SocketOptionUtil::getOption(ntsa::SocketOption*           option,
         option->makeZeroCopy(value);
         return ntsa::Error();
     }
+    else if (type == ntsa::SocketOptionType::e_REUSE_PORT) {
+        bool value = false;
+        error      = SocketOptionUtil::getReusePort(&value, socket);
+        if (error) {
+            return error;
+        }
+        option->makeReusePort(value);
+        return ntsa::Error();
+    }
+    else if (type == ntsa::SocketOptionType::e_UDP_SEGMENT) {
+        bsl::size_t value = 0;
+        error = SocketOptionUtil::getUdpSegmentationOffload(&value, socket);
+        if (error) {
+            return error;
+        }
+        option->makeUdpSegmentationOffload(value);
+        return ntsa::Error();
+    }
+    else if (type == ntsa::SocketOptionType::e_UDP_GRO) {
+        bool value = false;
+        error      = SocketOptionUtil::getUdpReceiveOffload(&value, socket);
+        if (error) {
+            return error;
+        }
+        option->makeUdpReceiveOffload(value);
+        return ntsa::Error();
+    }
     else if (type == ntsa::SocketOptionType::e_TCP_CONGESTION_CONTROL) {
         ntsa::TcpCongestionControl value;
         error = SocketOptionUtil::getTcpCongestionControl(&value, socket);
@@ -341,6 +415,134 @@ ntsa::Error SocketOptionUtil::getOption(ntsa::SocketOption*           option,
 
 #if defined(BSLS_PLATFORM_OS_UNIX)
 
+namespace {
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+// Provide utilities to encode the description of the TLS traffic keys of one
+// direction of a connection in the form expected by the 'TLS_TX' and
+// 'TLS_RX' socket options. The description is encoded byte-by-byte, rather
+// than through the structures declared in <linux/tls.h>, which may not be
+// available at compile time: each structure begins with the 16-bit version
+// and 16-bit cipher type in host byte order followed by byte arrays holding
+// the explicit IV, the key, the salt, and the big-endian record sequence
+// number, in that order, so none of the structures contain padding.
+struct TrafficKeysEncoder {
+    enum {
+        // The maximum size of an encoded description.
+        k_MAX_SIZE = 64,
+
+        // The size of the record sequence number.
+        k_SEQUENCE_NUMBER_SIZE = 8,
+
+        // The size of the implicit IV, i.e., the salt and explicit IV.
+        k_IMPLICIT_IV_SIZE = 12
+    };
+
+    // Encode into the specified 'buffer' the description of the specified
+    // 'key', 'iv', and 'sequenceNumber' protected by the specified 'cipher'
+    // in the specified 'version' of TLS, and load into the specified 'size'
+    // the number of bytes encoded. Return the error.
+    static ntsa::Error encode(char*                            buffer,
+                              bsl::size_t*                     size,
+                              bsl::uint16_t                    version,
+                              ntsa::TrafficCipher::Value       cipher,
+                              const bsl::vector<bsl::uint8_t>& key,
+                              const bsl::vector<bsl::uint8_t>& iv,
+                              bsl::uint64_t                    sequenceNumber);
+
+    // Overwrite the specified 'size' bytes at the specified 'buffer' with
+    // zeroes in a manner the compiler may not elide.
+    static void wipe(char* buffer, bsl::size_t size);
+};
+
+ntsa::Error TrafficKeysEncoder::encode(
+    char*                            buffer,
+    bsl::size_t*                     size,
+    bsl::uint16_t                    version,
+    ntsa::TrafficCipher::Value       cipher,
+    const bsl::vector<bsl::uint8_t>& key,
+    const bsl::vector<bsl::uint8_t>& iv,
+    bsl::uint64_t                    sequenceNumber)
+{
+    *size = 0;
+
+    if (version != ntsa::TrafficKeys::k_TLS_V1_2 &&
+        version != ntsa::TrafficKeys::k_TLS_V1_3)
+    {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    bsl::uint16_t cipherType = 0;
+    bsl::size_t   keySize    = 0;
+    bsl::size_t   saltSize   = 0;
+
+    switch (cipher) {
+    case ntsa::TrafficCipher::e_AES_128_GCM:
+        cipherType = TLS_CIPHER_AES_GCM_128;
+        keySize    = 16;
+        saltSize   = 4;
+        break;
+    case ntsa::TrafficCipher::e_AES_256_GCM:
+        cipherType = TLS_CIPHER_AES_GCM_256;
+        keySize    = 32;
+        saltSize   = 4;
+        break;
+    case ntsa::TrafficCipher::e_CHACHA20_POLY1305:
+        cipherType = TLS_CIPHER_CHACHA20_POLY1305;
+        keySize    = 32;
+        saltSize   = 0;
+        break;
+    default:
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    if (key.size() != keySize || iv.size() != k_IMPLICIT_IV_SIZE) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    const bsl::size_t explicitIvSize = k_IMPLICIT_IV_SIZE - saltSize;
+
+    char* position = buffer;
+
+    bsl::memcpy(position, &version, sizeof version);
+    position += sizeof version;
+
+    bsl::memcpy(position, &cipherType, sizeof cipherType);
+    position += sizeof cipherType;
+
+    bsl::memcpy(position, iv.data() + saltSize, explicitIvSize);
+    position += explicitIvSize;
+
+    bsl::memcpy(position, key.data(), keySize);
+    position += keySize;
+
+    bsl::memcpy(position, iv.data(), saltSize);
+    position += saltSize;
+
+    for (bsl::size_t i = 0; i < k_SEQUENCE_NUMBER_SIZE; ++i) {
+        const bsl::size_t shift = 8 * (k_SEQUENCE_NUMBER_SIZE - 1 - i);
+        *position++ = static_cast<char>((sequenceNumber >> shift) & 0xFF);
+    }
+
+    *size = static_cast<bsl::size_t>(position - buffer);
+    BSLS_ASSERT(*size <= k_MAX_SIZE);
+
+    return ntsa::Error();
+}
+
+void TrafficKeysEncoder::wipe(char* buffer, bsl::size_t size)
+{
+    volatile char* current = buffer;
+    for (bsl::size_t i = 0; i < size; ++i) {
+        current[i] = 0;
+    }
+}
+
+#endif
+
+}  // close unnamed namespace
+
 ntsa::Error SocketOptionUtil::setBlocking(ntsa::Handle socket, bool blocking)
 {
     int flags = fcntl(socket, F_GETFL, 0);
@@ -802,6 +1004,223 @@ ntsa::Error SocketOptionUtil::setTcpCongestionControl(
 #endif
 }
 
+ntsa::Error SocketOptionUtil::setReusePort(ntsa::Handle socket, bool reusePort)
+{
+#if defined(SO_REUSEPORT)
+
+    int optionValue = static_cast<int>(reusePort);
+
+    int rc = setsockopt(socket,
+                        SOL_SOCKET,
+                        SO_REUSEPORT,
+                        reinterpret_cast<char*>(&optionValue),
+                        sizeof(optionValue));
+
+    if (rc != 0) {
+        return ntsa::Error(errno);
+    }
+
+    return ntsa::Error();
+
+#else
+
+    NTSCFG_WARNING_UNUSED(socket);
+    NTSCFG_WARNING_UNUSED(reusePort);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+
+#endif
+}
+
+ntsa::Error SocketOptionUtil::setReusePortCpuSteering(ntsa::Handle socket)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+#if !defined(SO_ATTACH_REUSEPORT_CBPF)
+#define SO_ATTACH_REUSEPORT_CBPF 51
+#endif
+
+    // Return the index of the CPU processing the packet as the index of the
+    // socket in the reuse group that should receive it.
+
+    struct sock_filter code[] = {
+        {BPF_LD | BPF_W | BPF_ABS, 0, 0, SKF_AD_OFF + SKF_AD_CPU},
+        {BPF_RET | BPF_A, 0, 0, 0}
+    };
+
+    struct sock_fprog program;
+    program.len    = static_cast<unsigned short>(sizeof code / sizeof code[0]);
+    program.filter = code;
+
+    int rc = setsockopt(socket,
+                        SOL_SOCKET,
+                        SO_ATTACH_REUSEPORT_CBPF,
+                        &program,
+                        sizeof program);
+
+    if (rc != 0) {
+        return ntsa::Error(errno);
+    }
+
+    return ntsa::Error();
+
+#else
+
+    NTSCFG_WARNING_UNUSED(socket);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+
+#endif
+}
+
+ntsa::Error SocketOptionUtil::setUdpSegmentationOffload(
+    ntsa::Handle socket,
+    bsl::size_t  segmentSize)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+    if (segmentSize > 0xFFFF) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    int optionValue = static_cast<int>(segmentSize);
+
+    int rc = setsockopt(socket,
+                        SOL_UDP,
+                        UDP_SEGMENT,
+                        reinterpret_cast<char*>(&optionValue),
+                        sizeof(optionValue));
+
+    if (rc != 0) {
+        return ntsa::Error(errno);
+    }
+
+    return ntsa::Error();
+
+#else
+
+    NTSCFG_WARNING_UNUSED(socket);
+    NTSCFG_WARNING_UNUSED(segmentSize);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+
+#endif
+}
+
+ntsa::Error SocketOptionUtil::setUdpReceiveOffload(ntsa::Handle socket,
+                                                   bool udpReceiveOffload)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+    int optionValue = static_cast<int>(udpReceiveOffload);
+
+    int rc = setsockopt(socket,
+                        SOL_UDP,
+                        UDP_GRO,
+                        reinterpret_cast<char*>(&optionValue),
+                        sizeof(optionValue));
+
+    if (rc != 0) {
+        return ntsa::Error(errno);
+    }
+
+    return ntsa::Error();
+
+#else
+
+    NTSCFG_WARNING_UNUSED(socket);
+    NTSCFG_WARNING_UNUSED(udpReceiveOffload);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+
+#endif
+}
+
+ntsa::Error SocketOptionUtil::setTrafficKeys(ntsa::Handle             socket,
+                                             const ntsa::TrafficKeys& keys)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+    ntsa::Error error;
+
+    char        sendInfo[TrafficKeysEncoder::k_MAX_SIZE];
+    bsl::size_t sendInfoSize = 0;
+
+    char        receiveInfo[TrafficKeysEncoder::k_MAX_SIZE];
+    bsl::size_t receiveInfoSize = 0;
+
+    error = TrafficKeysEncoder::encode(sendInfo,
+                                       &sendInfoSize,
+                                       keys.version(),
+                                       keys.cipher(),
+                                       keys.sendKey(),
+                                       keys.sendIv(),
+                                       keys.sendSequenceNumber());
+    if (!error) {
+        error = TrafficKeysEncoder::encode(receiveInfo,
+                                           &receiveInfoSize,
+                                           keys.version(),
+                                           keys.cipher(),
+                                           keys.receiveKey(),
+                                           keys.receiveIv(),
+                                           keys.receiveSequenceNumber());
+    }
+
+    if (!error) {
+        const char k_UPPER_LAYER_PROTOCOL[] = "tls";
+
+        int rc = setsockopt(socket,
+                            IPPROTO_TCP,
+                            TCP_ULP,
+                            k_UPPER_LAYER_PROTOCOL,
+                            sizeof k_UPPER_LAYER_PROTOCOL);
+        if (rc != 0) {
+            if (errno == ENOENT || errno == ENOPROTOOPT) {
+                error = ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+            }
+            else {
+                error = ntsa::Error(errno);
+            }
+        }
+    }
+
+    if (!error) {
+        int rc = setsockopt(socket,
+                            SOL_TLS,
+                            TLS_TX,
+                            sendInfo,
+                            static_cast<socklen_t>(sendInfoSize));
+        if (rc != 0) {
+            error = ntsa::Error(errno);
+        }
+    }
+
+    if (!error) {
+        int rc = setsockopt(socket,
+                            SOL_TLS,
+                            TLS_RX,
+                            receiveInfo,
+                            static_cast<socklen_t>(receiveInfoSize));
+        if (rc != 0) {
+            error = ntsa::Error(errno);
+        }
+    }
+
+    TrafficKeysEncoder::wipe(sendInfo, sizeof sendInfo);
+    TrafficKeysEncoder::wipe(receiveInfo, sizeof receiveInfo);
+
+    return error;
+
+#else
+
+    NTSCFG_WARNING_UNUSED(socket);
+    NTSCFG_WARNING_UNUSED(keys);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+
+#endif
+}
+
 ntsa::Error SocketOptionUtil::getBlocking(ntsa::Handle socket, bool* blocking)
 {
     *blocking = false;
@@ -1318,6 +1737,106 @@ ntsa::Error SocketOptionUtil::getTcpCongestionControl(
 #endif
 }
 
+ntsa::Error SocketOptionUtil::getReusePort(bool*        reusePort,
+                                           ntsa::Handle socket)
+{
+    *reusePort = false;
+
+#if defined(SO_REUSEPORT)
+
+    int       optionValue = 0;
+    socklen_t optionSize  = static_cast<socklen_t>(sizeof(optionValue));
+
+    int rc = getsockopt(socket,
+                        SOL_SOCKET,
+                        SO_REUSEPORT,
+                        reinterpret_cast<char*>(&optionValue),
+                        &optionSize);
+
+    if (rc != 0) {
+        return ntsa::Error(errno);
+    }
+
+    *reusePort = static_cast<bool>(optionValue);
+
+    return ntsa::Error();
+
+#else
+
+    NTSCFG_WARNING_UNUSED(socket);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+
+#endif
+}
+
+ntsa::Error SocketOptionUtil::getUdpSegmentationOffload(
+    bsl::size_t* segmentSize,
+    ntsa::Handle socket)
+{
+    *segmentSize = 0;
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+    int       optionValue = 0;
+    socklen_t optionSize  = static_cast<socklen_t>(sizeof(optionValue));
+
+    int rc = getsockopt(socket,
+                        SOL_UDP,
+                        UDP_SEGMENT,
+                        reinterpret_cast<char*>(&optionValue),
+                        &optionSize);
+
+    if (rc != 0) {
+        return ntsa::Error(errno);
+    }
+
+    *segmentSize = static_cast<bsl::size_t>(optionValue);
+
+    return ntsa::Error();
+
+#else
+
+    NTSCFG_WARNING_UNUSED(socket);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+
+#endif
+}
+
+ntsa::Error SocketOptionUtil::getUdpReceiveOffload(bool* udpReceiveOffload,
+                                                   ntsa::Handle socket)
+{
+    *udpReceiveOffload = false;
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+    int       optionValue = 0;
+    socklen_t optionSize  = static_cast<socklen_t>(sizeof(optionValue));
+
+    int rc = getsockopt(socket,
+                        SOL_UDP,
+                        UDP_GRO,
+                        reinterpret_cast<char*>(&optionValue),
+                        &optionSize);
+
+    if (rc != 0) {
+        return ntsa::Error(errno);
+    }
+
+    *udpReceiveOffload = static_cast<bool>(optionValue);
+
+    return ntsa::Error();
+
+#else
+
+    NTSCFG_WARNING_UNUSED(socket);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+
+#endif
+}
+
 ntsa::Error SocketOptionUtil::getSendBufferRemaining(bsl::size_t* size,
                                                      ntsa::Handle socket)
 {
@@ -2173,6 +2692,49 @@ ntsa::Error SocketOptionUtil::setTcpCongestionControl(
     return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
 }
 
+ntsa::Error SocketOptionUtil::setReusePort(ntsa::Handle socket, bool reusePort)
+{
+    NTSCFG_WARNING_UNUSED(socket);
+    NTSCFG_WARNING_UNUSED(reusePort);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error SocketOptionUtil::setReusePortCpuSteering(ntsa::Handle socket)
+{
+    NTSCFG_WARNING_UNUSED(socket);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error SocketOptionUtil::setUdpSegmentationOffload(
+    ntsa::Handle socket,
+    bsl::size_t  segmentSize)
+{
+    NTSCFG_WARNING_UNUSED(socket);
+    NTSCFG_WARNING_UNUSED(segmentSize);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error SocketOptionUtil::setUdpReceiveOffload(ntsa::Handle socket,
+                                                   bool udpReceiveOffload)
+{
+    NTSCFG_WARNING_UNUSED(socket);
+    NTSCFG_WARNING_UNUSED(udpReceiveOffload);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error SocketOptionUtil::setTrafficKeys(ntsa::Handle             socket,
+                                             const ntsa::TrafficKeys& keys)
+{
+    NTSCFG_WARNING_UNUSED(socket);
+    NTSCFG_WARNING_UNUSED(keys);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
 ntsa::Error SocketOptionUtil::setLinger(ntsa::Handle              socket,
                                         bool                      linger,
                                         const bsls::TimeInterval& duration)
@@ -2683,6 +3245,37 @@ ntsa::Error SocketOptionUtil::getTcpCongestionControl(
     return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
 }
 
+ntsa::Error SocketOptionUtil::getReusePort(bool*        reusePort,
+                                           ntsa::Handle socket)
+{
+    NTSCFG_WARNING_UNUSED(socket);
+
+    *reusePort = false;
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error SocketOptionUtil::getUdpSegmentationOffload(
+    bsl::size_t* segmentSize,
+    ntsa::Handle socket)
+{
+    NTSCFG_WARNING_UNUSED(socket);
+
+    *segmentSize = 0;
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error SocketOptionUtil::getUdpReceiveOffload(bool* udpReceiveOffload,
+                                                   ntsa::Handle socket)
+{
+    NTSCFG_WARNING_UNUSED(socket);
+
+    *udpReceiveOffload = false;
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
 ntsa::Error SocketOptionUtil::getSendBufferRemaining(bsl::size_t* size,
                                                      ntsa::Handle socket)
 {
@@ -23,6 +23,7 @@ BSLS_IDENT("$Id: $")
 #include <ntsa_error.h>
 #include <ntsa_handle.h>
 #include <ntsa_socketoption.h>
+#include <ntsa_traffickeys.h>
 #include <ntscfg_platform.h>
 #include <ntsscm_version.h>
 #include <bsls_timeinterval.h>
@@ -149,6 +150,56 @@ struct SocketOptionUtil {
         ntsa::Handle                      socket,
         const ntsa::TcpCongestionControl& algorithm);
 
+    /// Set the option for the specified 'socket' that allows multiple
+    /// sockets to bind to the same address and port, with incoming
+    /// connections or datagrams distributed among them by the operating
+    /// system, according to the specified 'reusePort' flag. Return the
+    /// error.
+    static ntsa::Error setReusePort(ntsa::Handle socket, bool reusePort);
+
+    /// Attach to the specified 'socket', bound with the "reuse port" option
+    /// enabled, a program that steers each incoming connection or datagram
+    /// to the socket in its reuse group whose index in that group matches
+    /// the CPU on which the connection or datagram is processed by the
+    /// operating system. Return the error. Note that the program only
+    /// affects the group of sockets sharing the address and port of
+    /// 'socket', and is only effective when the group contains one socket
+    /// per CPU, opened in CPU order, and each socket is serviced by a thread
+    /// pinned to the corresponding CPU. Note that this function is only
+    /// supported on Linux.
+    static ntsa::Error setReusePortCpuSteering(ntsa::Handle socket);
+
+    /// Set the option for the specified 'socket' that segments the data of
+    /// each datagram sent into multiple datagrams of the specified
+    /// 'segmentSize' in the operating system or network interface, or
+    /// disables segmentation if 'segmentSize' is zero. Return the error.
+    /// Note that this function is only supported for UDP sockets on Linux.
+    static ntsa::Error setUdpSegmentationOffload(ntsa::Handle socket,
+                                                 bsl::size_t  segmentSize);
+
+    /// Set the option for the specified 'socket' that allows the operating
+    /// system or network interface to coalesce multiple datagrams received
+    /// from the same peer into a single datagram according to the specified
+    /// 'udpReceiveOffload' flag. Return the error. Note that when this
+    /// option is enabled, the size of each datagram coalesced is reported
+    /// as meta-data accompanying the data received, and the receive buffer
+    /// should be large enough to hold the largest possible datagram. Note
+    /// that this function is only supported for UDP sockets on Linux.
+    static ntsa::Error setUdpReceiveOffload(ntsa::Handle socket,
+                                            bool         udpReceiveOffload);
+
+    /// Install the specified TLS traffic 'keys' into the specified 'socket'
+    /// so that the operating system encrypts each record subsequently sent
+    /// and decrypts each record subsequently received. Return the error.
+    /// Note that 'e_NOT_IMPLEMENTED' is returned if the operating system
+    /// does not support TLS offload, in which case the socket is unchanged.
+    /// Note that if the operating system supports TLS offload but rejects
+    /// 'keys', the socket may be left partially offloaded and should be
+    /// closed. Note that this function is only supported for TCP sockets on
+    /// Linux.
+    static ntsa::Error setTrafficKeys(ntsa::Handle             socket,
+                                      const ntsa::TrafficKeys& keys);
+
     /// Load into the specified 'option' the socket option of the specified
     /// 'type' for the specified 'socket'. Return the error.
     static ntsa::Error getOption(ntsa::SocketOption*           option,
@@ -255,6 +306,24 @@ struct SocketOptionUtil {
         ntsa::TcpCongestionControl* algorithm,
         ntsa::Handle                socket);
 
+    /// Load into the specified 'reusePort' flag the option for the specified
+    /// 'socket' that indicates if multiple sockets may bind to the same
+    /// address and port. Return the error.
+    static ntsa::Error getReusePort(bool* reusePort, ntsa::Handle socket);
+
+    /// Load into the specified 'segmentSize' the option for the specified
+    /// 'socket' that indicates the size of each datagram into which the
+    /// data of each datagram sent is segmented, or zero if datagrams are not
+    /// segmented. Return the error.
+    static ntsa::Error getUdpSegmentationOffload(bsl::size_t* segmentSize,
+                                                 ntsa::Handle socket);
+
+    /// Load into the specified 'udpReceiveOffload' flag the option for the
+    /// specified 'socket' that indicates if multiple datagrams received may
+    /// be coalesced into a single datagram. Return the error.
+    static ntsa::Error getUdpReceiveOffload(bool*        udpReceiveOffload,
+                                            ntsa::Handle socket);
+
     /// Load into the specified 'size' the option for the specified 'socket'
     /// that indicates the amount of space left in the send buffer. Return
     /// the error.
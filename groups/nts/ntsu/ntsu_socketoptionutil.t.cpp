@@ -19,8 +19,11 @@
 #include <ntsu_socketoptionutil.h>
 #include <ntsu_socketutil.h>
 #include <ntsu_timestamputil.h>
+#include <bdlbb_blob.h>
+#include <bdlbb_simpleblobbufferfactory.h>
 #include <bslma_testallocator.h>
 #include <bsl_array.h>
+#include <bsl_cstring.h>
 #include <bsl_fstream.h>
 #include <bsl_iostream.h>
 #include <bsl_vector.h>
@@ -2091,6 +2094,313 @@ NTSCFG_TEST_CASE(9)
     NTSCFG_TEST_EQ(ta.numBlocksInUse(), 0);
 }
 
+NTSCFG_TEST_CASE(10)
+{
+    // Concern: Multiple sockets with the "reuse port" option enabled may
+    // bind to and listen on the same endpoint.
+
+    ntsa::Error error;
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    if (!ntsu::AdapterUtil::supportsIpv4()) {
+        return;
+    }
+
+    ntsa::Handle first = ntsa::k_INVALID_HANDLE;
+    error =
+        ntsu::SocketUtil::create(&first, ntsa::Transport::e_TCP_IPV4_STREAM);
+    NTSCFG_TEST_OK(error);
+
+    ntsa::Handle second = ntsa::k_INVALID_HANDLE;
+    error =
+        ntsu::SocketUtil::create(&second, ntsa::Transport::e_TCP_IPV4_STREAM);
+    NTSCFG_TEST_OK(error);
+
+    bool reusePort = true;
+    error = ntsu::SocketOptionUtil::getReusePort(&reusePort, first);
+    NTSCFG_TEST_OK(error);
+    NTSCFG_TEST_FALSE(reusePort);
+
+    ntsa::SocketOption option;
+    option.makeReusePort(true);
+
+    error = ntsu::SocketOptionUtil::setOption(first, option);
+    NTSCFG_TEST_OK(error);
+
+    error = ntsu::SocketOptionUtil::setOption(second, option);
+    NTSCFG_TEST_OK(error);
+
+    option.reset();
+    error = ntsu::SocketOptionUtil::getOption(
+        &option,
+        ntsa::SocketOptionType::e_REUSE_PORT,
+        second);
+    NTSCFG_TEST_OK(error);
+    NTSCFG_TEST_TRUE(option.isReusePort());
+    NTSCFG_TEST_TRUE(option.reusePort());
+
+    error = ntsu::SocketUtil::bind(
+        ntsa::Endpoint(ntsa::IpEndpoint(ntsa::Ipv4Address::loopback(), 0)),
+        false,
+        first);
+    NTSCFG_TEST_OK(error);
+
+    ntsa::Endpoint endpoint;
+    error = ntsu::SocketUtil::sourceEndpoint(&endpoint, first);
+    NTSCFG_TEST_OK(error);
+
+    error = ntsu::SocketUtil::bind(endpoint, false, second);
+    NTSCFG_TEST_OK(error);
+
+    error = ntsu::SocketUtil::listen(1, first);
+    NTSCFG_TEST_OK(error);
+
+    error = ntsu::SocketUtil::listen(1, second);
+    NTSCFG_TEST_OK(error);
+
+    error = ntsu::SocketOptionUtil::setReusePortCpuSteering(first);
+    if (error) {
+        NTSCFG_TEST_LOG_WARN << "Failed to attach reuse port steering: "
+                             << error << NTSCFG_TEST_LOG_END;
+    }
+
+    error = ntsu::SocketUtil::close(second);
+    NTSCFG_TEST_OK(error);
+
+    error = ntsu::SocketUtil::close(first);
+    NTSCFG_TEST_OK(error);
+#endif
+}
+
+NTSCFG_TEST_CASE(11)
+{
+    // Concern: The UDP segmentation offload and UDP receive offload options
+    // may be set and retrieved on UDP sockets, where supported.
+
+    ntsa::Error error;
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    if (!ntsu::AdapterUtil::supportsIpv4()) {
+        return;
+    }
+
+    ntsa::Handle socket = ntsa::k_INVALID_HANDLE;
+    error = ntsu::SocketUtil::create(&socket,
+                                     ntsa::Transport::e_UDP_IPV4_DATAGRAM);
+    NTSCFG_TEST_OK(error);
+
+    ntsa::SocketOption option;
+    option.makeUdpSegmentationOffload(1024);
+
+    error = ntsu::SocketOptionUtil::setOption(socket, option);
+    if (error) {
+        NTSCFG_TEST_LOG_WARN << "UDP segmentation offload is not supported: "
+                             << error << NTSCFG_TEST_LOG_END;
+    }
+    else {
+        option.reset();
+        error = ntsu::SocketOptionUtil::getOption(
+            &option,
+            ntsa::SocketOptionType::e_UDP_SEGMENT,
+            socket);
+        NTSCFG_TEST_OK(error);
+        NTSCFG_TEST_TRUE(option.isUdpSegmentationOffload());
+        NTSCFG_TEST_EQ(option.udpSegmentationOffload(), 1024);
+    }
+
+    error = ntsu::SocketOptionUtil::setUdpSegmentationOffload(socket, 65536);
+    NTSCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_INVALID));
+
+    option.makeUdpReceiveOffload(true);
+
+    error = ntsu::SocketOptionUtil::setOption(socket, option);
+    if (error) {
+        NTSCFG_TEST_LOG_WARN << "UDP receive offload is not supported: "
+                             << error << NTSCFG_TEST_LOG_END;
+    }
+    else {
+        option.reset();
+        error = ntsu::SocketOptionUtil::getOption(
+            &option,
+            ntsa::SocketOptionType::e_UDP_GRO,
+            socket);
+        NTSCFG_TEST_OK(error);
+        NTSCFG_TEST_TRUE(option.isUdpReceiveOffload());
+        NTSCFG_TEST_TRUE(option.udpReceiveOffload());
+    }
+
+    error = ntsu::SocketUtil::close(socket);
+    NTSCFG_TEST_OK(error);
+#endif
+}
+
+namespace test {
+
+/// Load into the specified 'result' the TLS 1.3 AES-128-GCM traffic keys of
+/// one peer of a connection whose records sent are protected by the key
+/// derived from the specified 'sendSeed' and whose records received are
+/// protected by the key derived from the specified 'receiveSeed'.
+void makeTrafficKeys(ntsa::TrafficKeys* result,
+                     bsl::uint8_t       sendSeed,
+                     bsl::uint8_t       receiveSeed)
+{
+    bsl::uint8_t sendKey[16];
+    bsl::uint8_t sendIv[12];
+    bsl::uint8_t receiveKey[16];
+    bsl::uint8_t receiveIv[12];
+
+    for (bsl::size_t i = 0; i < sizeof sendKey; ++i) {
+        sendKey[i]    = static_cast<bsl::uint8_t>(sendSeed + i);
+        receiveKey[i] = static_cast<bsl::uint8_t>(receiveSeed + i);
+    }
+
+    for (bsl::size_t i = 0; i < sizeof sendIv; ++i) {
+        sendIv[i]    = static_cast<bsl::uint8_t>(sendSeed * 3 + i);
+        receiveIv[i] = static_cast<bsl::uint8_t>(receiveSeed * 3 + i);
+    }
+
+    result->reset();
+    result->setVersion(ntsa::TrafficKeys::k_TLS_V1_3);
+    result->setCipher(ntsa::TrafficCipher::e_AES_128_GCM);
+    result->setSendKey(sendKey, sizeof sendKey);
+    result->setSendIv(sendIv, sizeof sendIv);
+    result->setReceiveKey(receiveKey, sizeof receiveKey);
+    result->setReceiveIv(receiveIv, sizeof receiveIv);
+}
+
+}  // close namespace test
+
+NTSCFG_TEST_CASE(12)
+{
+    // Concern: TLS traffic keys installed into a TCP socket cause records to
+    // be encrypted and decrypted by the operating system, where supported.
+    // Plan: Install mirrored keys into both sockets of a TCP connection,
+    // send plaintext through one, and verify the plaintext is received by
+    // the other, then send a "close_notify" alert and verify it is received
+    // as the end of the data. Then install mismatched keys and verify
+    // decryption fails. Skip the test if the operating system does not
+    // support TLS offload.
+
+    ntsa::Error error;
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    if (!ntsu::AdapterUtil::supportsIpv4()) {
+        return;
+    }
+
+    ntscfg::TestAllocator ta;
+    {
+        ntsa::TrafficKeys invalidKeys(&ta);
+        invalidKeys.setVersion(ntsa::TrafficKeys::k_TLS_V1_3);
+        invalidKeys.setCipher(ntsa::TrafficCipher::e_AES_128_GCM);
+
+        for (int variation = 0; variation < 2; ++variation) {
+            const bool matching = (variation == 0);
+
+            ntsa::Handle client = ntsa::k_INVALID_HANDLE;
+            ntsa::Handle server = ntsa::k_INVALID_HANDLE;
+
+            error = ntsu::SocketUtil::pair(
+                &client,
+                &server,
+                ntsa::Transport::e_TCP_IPV4_STREAM);
+            NTSCFG_TEST_OK(error);
+
+            ntsa::TrafficKeys clientKeys(&ta);
+            test::makeTrafficKeys(&clientKeys, 10, 50);
+
+            ntsa::TrafficKeys serverKeys(&ta);
+            test::makeTrafficKeys(&serverKeys, 50, matching ? 10 : 90);
+
+            error = ntsu::SocketOptionUtil::setTrafficKeys(client,
+                                                           invalidKeys);
+            NTSCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_INVALID));
+
+            error = ntsu::SocketOptionUtil::setTrafficKeys(client, clientKeys);
+            if (error) {
+                NTSCFG_TEST_LOG_WARN << "TLS offload is not supported: "
+                                     << error << NTSCFG_TEST_LOG_END;
+
+                ntsu::SocketUtil::close(client);
+                ntsu::SocketUtil::close(server);
+                return;
+            }
+
+            error = ntsu::SocketOptionUtil::setTrafficKeys(server, serverKeys);
+            NTSCFG_TEST_OK(error);
+
+            const char k_DATA[] = "Hello, world!";
+
+            {
+                ntsa::SendContext context;
+                ntsa::SendOptions options;
+
+                ntsa::Data data(ntsa::ConstBuffer(k_DATA, sizeof k_DATA - 1));
+
+                error =
+                    ntsu::SocketUtil::send(&context, data, options, client);
+                NTSCFG_TEST_OK(error);
+                NTSCFG_TEST_EQ(context.bytesSent(), sizeof k_DATA - 1);
+            }
+
+            {
+                char buffer[sizeof k_DATA - 1];
+
+                ntsa::ReceiveContext context;
+                ntsa::ReceiveOptions options;
+
+                ntsa::Data data(ntsa::MutableBuffer(buffer, sizeof buffer));
+
+                error = ntsu::SocketUtil::receive(&context,
+                                                  &data,
+                                                  options,
+                                                  server);
+
+                if (matching) {
+                    NTSCFG_TEST_OK(error);
+                    NTSCFG_TEST_EQ(context.bytesReceived(), sizeof buffer);
+                    NTSCFG_TEST_EQ(
+                        bsl::memcmp(buffer, k_DATA, sizeof buffer), 0);
+                }
+                else {
+                    NTSCFG_TEST_TRUE(error);
+                }
+            }
+
+            if (matching) {
+                error = ntsu::SocketUtil::sendCloseNotify(client);
+                NTSCFG_TEST_OK(error);
+
+                bdlbb::SimpleBlobBufferFactory blobBufferFactory(64, &ta);
+
+                bdlbb::Blob blob(&blobBufferFactory, &ta);
+                blob.setLength(64);
+                blob.setLength(0);
+
+                ntsa::ReceiveContext context;
+                ntsa::ReceiveOptions options;
+                options.setEncryptionOffloaded(true);
+
+                error = ntsu::SocketUtil::receive(&context,
+                                                  &blob,
+                                                  options,
+                                                  server);
+                NTSCFG_TEST_OK(error);
+                NTSCFG_TEST_EQ(context.bytesReceived(), 0);
+                NTSCFG_TEST_EQ(blob.length(), 0);
+            }
+
+            error = ntsu::SocketUtil::close(client);
+            NTSCFG_TEST_OK(error);
+
+            error = ntsu::SocketUtil::close(server);
+            NTSCFG_TEST_OK(error);
+        }
+    }
+    NTSCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+#endif
+}
+
 NTSCFG_TEST_DRIVER
 {
     NTSCFG_TEST_REGISTER(1);
@@ -2102,5 +2412,8 @@ NTSCFG_TEST_DRIVER
     NTSCFG_TEST_REGISTER(7);
     NTSCFG_TEST_REGISTER(8);
     NTSCFG_TEST_REGISTER(9);
+    NTSCFG_TEST_REGISTER(10);
+    NTSCFG_TEST_REGISTER(11);
+    NTSCFG_TEST_REGISTER(12);
 }
 NTSCFG_TEST_DRIVER_END;
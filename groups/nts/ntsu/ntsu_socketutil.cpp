@@ -50,6 +50,7 @@ BSLS_IDENT_RCSID(ntsu_socketutil_cpp, "$Id$ $CSID$")
 #include <ntsu_adapterutil.h>
 #include <ntsu_socketoptionutil.h>
 #include <ntsu_timestamputil.h>
+#include <ntsu_zerocopyregionpool.h>
 #include <ntsu_zerocopyutil.h>
 
 #include <bdlb_chartype.h>
@@ -58,19 +59,24 @@ BSLS_IDENT_RCSID(ntsu_socketutil_cpp, "$Id$ $CSID$")
 #include <bdlb_string.h>
 #include <bdlt_currenttime.h>
 #include <bslim_printer.h>
+#include <bslma_default.h>
 #include <bslmf_assert.h>
+#include <bsls_alignedbuffer.h>
 #include <bsls_assert.h>
 #include <bsls_log.h>
 #include <bsls_platform.h>
 #include <bsls_spinlock.h>
 #include <bsls_timeinterval.h>
+#include <bsls_types.h>
 #include <bsl_algorithm.h>
 #include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
+#include <bsl_limits.h>
 #include <bsl_map.h>
+#include <bsl_memory.h>
 #include <bsl_set.h>
 #include <bsl_unordered_map.h>
 #include <bsl_unordered_set.h>
@@ -103,9 +109,35 @@ BSLS_IDENT_RCSID(ntsu_socketutil_cpp, "$Id$ $CSID$")
 #endif
 #if defined(BSLS_PLATFORM_OS_LINUX)
 #include <linux/errqueue.h>
+#include <sys/mman.h>
 #endif
 #endif
 
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#if !defined(SOL_UDP)
+#define SOL_UDP 17
+#endif
+#if !defined(UDP_SEGMENT)
+#define UDP_SEGMENT 103
+#endif
+#if !defined(UDP_GRO)
+#define UDP_GRO 104
+#endif
+#if !defined(SOL_TLS)
+#define SOL_TLS 282
+#endif
+#if !defined(TLS_SET_RECORD_TYPE)
+#define TLS_SET_RECORD_TYPE 1
+#endif
+#if !defined(TLS_GET_RECORD_TYPE)
+#define TLS_GET_RECORD_TYPE 2
+#endif
+
+// The maximum number of datagrams into which the data of a single send
+// operation may be segmented by the kernel (viz. UDP_MAX_SEGMENTS).
+#define NTSU_SOCKETUTIL_MAX_SEGMENTS_PER_SEND 64
+#endif
+
 #if defined(BSLS_PLATFORM_OS_WINDOWS)
 #ifdef NTDDI_VERSION
 #undef NTDDI_VERSION
@@ -573,8 +605,12 @@ class SendControl
             sizeof(ntsa::Handle),
 
         // The control buffer capacity required to send any meta-data (viz.
-        // open file descriptors) to the peer of a socket.
+        // open file descriptors and the segment size of datagrams to be
+        // segmented) to the peer of a socket.
         k_SEND_CONTROL_BUFFER_SIZE = CMSG_SPACE(k_SEND_CONTROL_PAYLOAD_SIZE)
+#if defined(BSLS_PLATFORM_OS_LINUX)
+                                     + CMSG_SPACE(sizeof(bsl::uint16_t))
+#endif
     };
 
     // Define a type alias for a maximimally-aligned buffer of suitable size to
@@ -616,11 +652,14 @@ class ReceiveControl
 #endif
 
         // The control buffer capacity required to receive any meta-data (e.g.
-        // open file descriptors, timestamps, etc.) buffered by the operating
-        // system for a socket.
+        // open file descriptors, timestamps, the segment size of coalesced
+        // datagrams, etc.) buffered by the operating system for a socket.
         ,
         k_RECEIVE_CONTROL_BUFFER_SIZE =
             CMSG_SPACE(k_RECEIVE_CONTROL_PAYLOAD_SIZE)
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            + CMSG_SPACE(sizeof(int)) + CMSG_SPACE(sizeof(unsigned char))
+#endif
     };
 
     // Define a type alias for a maximimally-aligned buffer of suitable size to
@@ -649,6 +688,12 @@ class ReceiveControl
     ntsa::Error decode(ntsa::ReceiveContext*       context,
                        const msghdr&               msg,
                        const ntsa::ReceiveOptions& options);
+
+    // Load into the specified 'result' the type of the TLS record decrypted
+    // by the operating system described by the control buffer of the
+    // specified 'msg'. Return true if the control buffer describes the type
+    // of a TLS record, otherwise return false.
+    static bool decodeRecordType(unsigned char* result, const msghdr& msg);
 };
 
 NTSCFG_INLINE
@@ -663,24 +708,58 @@ SendControl::~SendControl()
 
 ntsa::Error SendControl::encode(msghdr* msg, const ntsa::SendOptions& options)
 {
-    if (options.foreignHandle().isNull()) {
+    if (options.foreignHandle().isNull() && options.segmentSize() == 0) {
         return ntsa::Error();
     }
 
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    if (options.segmentSize() > 0xFFFF) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+#else
+    if (options.segmentSize() != 0) {
+        return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+    }
+#endif
+
     bsl::memset(d_arena.buffer(), 0, k_SEND_CONTROL_BUFFER_SIZE);
 
     msg->msg_control    = d_arena.buffer();
     msg->msg_controllen = static_cast<socklen_t>(k_SEND_CONTROL_BUFFER_SIZE);
 
-    ntsa::Handle foreignHandle = options.foreignHandle().value();
-
     struct cmsghdr* ctl = CMSG_FIRSTHDR(msg);
 
-    ctl->cmsg_level = SOL_SOCKET;
-    ctl->cmsg_type  = SCM_RIGHTS;
-    ctl->cmsg_len   = CMSG_LEN(sizeof foreignHandle);
+    bsl::size_t length = 0;
+
+    if (!options.foreignHandle().isNull()) {
+        ntsa::Handle foreignHandle = options.foreignHandle().value();
+
+        ctl->cmsg_level = SOL_SOCKET;
+        ctl->cmsg_type  = SCM_RIGHTS;
+        ctl->cmsg_len   = CMSG_LEN(sizeof foreignHandle);
+
+        bsl::memcpy(CMSG_DATA(ctl), &foreignHandle, sizeof foreignHandle);
+
+        length += CMSG_SPACE(sizeof foreignHandle);
+        ctl     = CMSG_NXTHDR(msg, ctl);
+    }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    if (options.segmentSize() != 0) {
+        bsl::uint16_t segmentSize =
+            static_cast<bsl::uint16_t>(options.segmentSize());
+
+        ctl->cmsg_level = SOL_UDP;
+        ctl->cmsg_type  = UDP_SEGMENT;
+        ctl->cmsg_len   = CMSG_LEN(sizeof segmentSize);
+
+        bsl::memcpy(CMSG_DATA(ctl), &segmentSize, sizeof segmentSize);
 
-    bsl::memcpy(CMSG_DATA(ctl), &foreignHandle, sizeof foreignHandle);
+        length += CMSG_SPACE(sizeof segmentSize);
+    }
+#endif
+
+    msg->msg_controllen = static_cast<socklen_t>(length);
 
     return ntsa::Error();
 }
@@ -782,11 +861,319 @@ ntsa::Error ReceiveControl::decode(ntsa::ReceiveContext*       context,
             }
 #endif
         }
+#if defined(BSLS_PLATFORM_OS_LINUX)
+        else if (hdr->cmsg_level == SOL_UDP) {
+            if (hdr->cmsg_type == UDP_GRO) {
+                int segmentSize = 0;
+
+                if (NTSCFG_UNLIKELY(hdr->cmsg_len !=
+                                    CMSG_LEN(sizeof segmentSize)))
+                {
+                    BSLS_LOG_WARN("Ignoring received control block meta-data: "
+                                  "Unexpected control message payload size: "
+                                  "expected %d bytes, found %d bytes",
+                                  (int)(CMSG_LEN(sizeof segmentSize)),
+                                  (int)(hdr->cmsg_len));
+                    continue;
+                }
+
+                bsl::memcpy(&segmentSize, CMSG_DATA(hdr), sizeof segmentSize);
+
+                if (options.wantSegmentSize() && segmentSize > 0) {
+                    context->setSegmentSize(
+                        static_cast<bsl::size_t>(segmentSize));
+                }
+            }
+        }
+#endif
     }
 
     return ntsa::Error();
 }
 
+bool ReceiveControl::decodeRecordType(unsigned char* result, const msghdr& msg)
+{
+    *result = 0;
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    for (cmsghdr* hdr = CMSG_FIRSTHDR(&msg); hdr != 0;
+         hdr          = CMSG_NXTHDR(const_cast<msghdr*>(&msg), hdr))
+    {
+        if (hdr->cmsg_level == SOL_TLS &&
+            hdr->cmsg_type == TLS_GET_RECORD_TYPE &&
+            hdr->cmsg_len == CMSG_LEN(sizeof *result))
+        {
+            bsl::memcpy(result, CMSG_DATA(hdr), sizeof *result);
+            return true;
+        }
+    }
+#else
+    NTSCFG_WARNING_UNUSED(msg);
+#endif
+
+    return false;
+}
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+// Provide a deleter of a region of memory mapped from a socket, into which
+// pages of data received by that socket have been mapped, that returns the
+// region to the pool from which it was acquired when the last reference to
+// the region is released.
+class ZeroCopyRegionDeleter
+{
+    bsl::shared_ptr<ZeroCopyRegionPool> d_pool_sp;
+    bsl::size_t                         d_size;
+
+  public:
+    // Create a new deleter of a region having the specified 'size' acquired
+    // from the specified 'pool'.
+    ZeroCopyRegionDeleter(const bsl::shared_ptr<ZeroCopyRegionPool>& pool,
+                          bsl::size_t                                size);
+
+    // Release the region at the specified 'address' to the pool.
+    void operator()(char* address) const;
+};
+
+ZeroCopyRegionDeleter::ZeroCopyRegionDeleter(
+    const bsl::shared_ptr<ZeroCopyRegionPool>& pool,
+    bsl::size_t                                size)
+: d_pool_sp(pool)
+, d_size(size)
+{
+}
+
+void ZeroCopyRegionDeleter::operator()(char* address) const
+{
+    d_pool_sp->release(address, d_size);
+}
+
+// Dequeue from the receive buffer of the specified stream 'socket' into the
+// specified 'blob' according to the specified 'options', mapping whole pages
+// of received data into a region acquired from the specified 'pool' and
+// appended to the 'blob' rather than copying them, then copying into the
+// remaining capacity of the 'blob' any data that cannot be mapped. Load into
+// the specified 'context' the result of the operation. Return the error.
+// Note that the region is returned to the 'pool' when the last reference to
+// the mapped data is released, so a pool that retains released regions
+// avoids modifying the page tables of the process, and the TLB shootdowns
+// that may require, for each receive.
+ntsa::Error receiveZeroCopy(ntsa::ReceiveContext*                      context,
+                            bdlbb::Blob*                               blob,
+                            const ntsa::ReceiveOptions&                options,
+                            const bsl::shared_ptr<ZeroCopyRegionPool>& pool,
+                            ntsa::Handle                               socket)
+{
+    ntsa::Error error;
+
+    ntsa::ReceiveOptions copyOptions(options);
+    copyOptions.setZeroCopy(false);
+
+    const bsl::size_t pageSize =
+        static_cast<bsl::size_t>(::sysconf(_SC_PAGESIZE));
+
+    bsl::size_t regionSize = options.maxBytes();
+    if (regionSize == 0) {
+        regionSize = blob->totalSize() - blob->length();
+    }
+
+    regionSize = bsl::min(regionSize,
+                          static_cast<bsl::size_t>(
+                              bsl::numeric_limits<bsl::uint32_t>::max()));
+
+    regionSize -= regionSize % pageSize;
+
+    bsl::size_t numBytesMapped = 0;
+    bsl::size_t numBytesToCopy = 0;
+
+    if (regionSize > 0) {
+        void* region = pool->acquire(regionSize);
+
+        if (region != 0) {
+            ZeroCopyUtil::TcpZeroCopyReceive zeroCopyReceive;
+            bsl::memset(&zeroCopyReceive, 0, sizeof zeroCopyReceive);
+
+            zeroCopyReceive.address = static_cast<bsl::uint64_t>(
+                reinterpret_cast<bsls::Types::UintPtr>(region));
+            zeroCopyReceive.length = static_cast<bsl::uint32_t>(regionSize);
+
+            socklen_t zeroCopyReceiveSize = sizeof zeroCopyReceive;
+
+            int rc = ::getsockopt(socket,
+                                  IPPROTO_TCP,
+                                  ZeroCopyUtil::e_TCP_ZEROCOPY_RECEIVE,
+                                  &zeroCopyReceive,
+                                  &zeroCopyReceiveSize);
+            if (rc == 0) {
+                numBytesMapped = zeroCopyReceive.length;
+                numBytesToCopy = zeroCopyReceive.recvSkipHint;
+            }
+
+            if (numBytesMapped > 0) {
+                // The whole region is returned to the pool when the data is
+                // released. Any pages beyond the data mapped by this receive
+                // are replaced when the region is reused.
+
+                bsl::shared_ptr<char> buffer(
+                    static_cast<char*>(region),
+                    ZeroCopyRegionDeleter(pool, regionSize),
+                    bslma::Default::defaultAllocator());
+
+                blob->appendDataBuffer(bdlbb::BlobBuffer(
+                    buffer,
+                    static_cast<int>(numBytesMapped)));
+            }
+            else {
+                pool->release(region, regionSize);
+            }
+        }
+    }
+
+    if (numBytesMapped > 0) {
+        // Data that is not aligned to a page boundary must be copied before
+        // any subsequent pages may be mapped. Otherwise, the pages mapped
+        // satisfy this operation.
+
+        if (numBytesToCopy == 0 || blob->totalSize() == blob->length()) {
+            context->reset();
+            context->setBytesReceivable(regionSize);
+            context->setBytesReceived(numBytesMapped);
+            return ntsa::Error();
+        }
+
+        error = SocketUtil::receive(context, blob, copyOptions, socket);
+        if (error) {
+            context->reset();
+        }
+
+        context->setBytesReceivable(context->bytesReceivable() + regionSize);
+        context->setBytesReceived(context->bytesReceived() + numBytesMapped);
+
+        return ntsa::Error();
+    }
+
+    // No pages could be mapped, either because zero-copy receive is not
+    // supported, less than a page of data is available, or no data is
+    // available at all: copy the data, if any.
+
+    return SocketUtil::receive(context, blob, copyOptions, socket);
+}
+
+// Provide constants defined by the TLS protocol describing the records that
+// may be received after the handshake is complete.
+struct TlsRecord {
+    enum Type {
+        e_ALERT            = 21,
+        e_HANDSHAKE        = 22,
+        e_APPLICATION_DATA = 23
+    };
+
+    enum AlertLevel { e_WARNING = 1, e_FATAL = 2 };
+
+    enum AlertDescription { e_CLOSE_NOTIFY = 0 };
+
+    enum HandshakeType { e_NEW_SESSION_TICKET = 4 };
+};
+
+// Return the byte at the specified 'offset' into the data described by the
+// specified 'iovecArray' having the specified 'iovecCount' elements. The
+// behavior is undefined unless 'offset' is less than the total size of the
+// data.
+unsigned char peekRecordByte(const struct iovec* iovecArray,
+                             bsl::size_t         iovecCount,
+                             bsl::size_t         offset)
+{
+    for (bsl::size_t i = 0; i < iovecCount; ++i) {
+        if (offset < iovecArray[i].iov_len) {
+            return static_cast<const unsigned char*>(
+                iovecArray[i].iov_base)[offset];
+        }
+
+        offset -= iovecArray[i].iov_len;
+    }
+
+    BSLS_ASSERT(!"Offset out of range");
+    return 0;
+}
+
+// Interpret the TLS record of the specified 'recordType', other than
+// application data, decrypted by the operating system into the specified
+// 'size' bytes described by the specified 'iovecArray' having the specified
+// 'iovecCount' elements. Load into the specified 'discard' flag true if the
+// record does not affect the application and should be skipped, or false if
+// the record closes the data received from the peer. Return the error, if
+// the record cannot be processed once its keys have been installed into the
+// operating system.
+ntsa::Error interpretTlsRecord(bool*               discard,
+                               unsigned char       recordType,
+                               const struct iovec* iovecArray,
+                               bsl::size_t         iovecCount,
+                               bsl::size_t         size)
+{
+    *discard = false;
+
+    if (recordType == TlsRecord::e_ALERT) {
+        if (size < 2) {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+
+        const unsigned char level = peekRecordByte(iovecArray, iovecCount, 0);
+        const unsigned char description =
+            peekRecordByte(iovecArray, iovecCount, 1);
+
+        if (description == TlsRecord::e_CLOSE_NOTIFY) {
+            return ntsa::Error();
+        }
+
+        if (level == TlsRecord::e_WARNING) {
+            *discard = true;
+            return ntsa::Error();
+        }
+
+        return ntsa::Error(ntsa::Error::e_CONNECTION_RESET);
+    }
+
+    if (recordType == TlsRecord::e_HANDSHAKE) {
+        // Session tickets are only useful to resume the session, which is not
+        // supported once its keys have been installed into the operating
+        // system. Any other post-handshake message, such as a key update,
+        // cannot be processed without the session.
+
+        bsl::size_t offset = 0;
+        while (offset + 4 <= size) {
+            const unsigned char type =
+                peekRecordByte(iovecArray, iovecCount, offset);
+
+            if (type != TlsRecord::e_NEW_SESSION_TICKET) {
+                return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+            }
+
+            const bsl::size_t length =
+                (static_cast<bsl::size_t>(
+                     peekRecordByte(iovecArray, iovecCount, offset + 1))
+                 << 16) |
+                (static_cast<bsl::size_t>(
+                     peekRecordByte(iovecArray, iovecCount, offset + 2))
+                 << 8) |
+                static_cast<bsl::size_t>(
+                    peekRecordByte(iovecArray, iovecCount, offset + 3));
+
+            offset += 4 + length;
+        }
+
+        if (offset != size) {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+
+        *discard = true;
+        return ntsa::Error();
+    }
+
+    return ntsa::Error(ntsa::Error::e_INVALID);
+}
+
+#endif
+
 #endif
 
 /// Provide utilities for converting between 'ntsa::Endpoint'
@@ -1364,7 +1751,8 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*       context,
     context->reset();
 
     const bool specifyEndpoint = !options.endpoint().isNull();
-    const bool specifyMetaData = !options.foreignHandle().isNull();
+    const bool specifyMetaData =
+        !options.foreignHandle().isNull() || options.segmentSize() != 0;
 
     msghdr msg;
     bsl::memset(&msg, 0, sizeof msg);
@@ -1450,7 +1838,8 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*       context,
     context->reset();
 
     const bool specifyEndpoint = !options.endpoint().isNull();
-    const bool specifyMetaData = !options.foreignHandle().isNull();
+    const bool specifyMetaData =
+        !options.foreignHandle().isNull() || options.segmentSize() != 0;
 
     msghdr msg;
     bsl::memset(&msg, 0, sizeof msg);
@@ -1540,7 +1929,8 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*       context,
     context->reset();
 
     const bool specifyEndpoint = !options.endpoint().isNull();
-    const bool specifyMetaData = !options.foreignHandle().isNull();
+    const bool specifyMetaData =
+        !options.foreignHandle().isNull() || options.segmentSize() != 0;
 
     msghdr msg;
     bsl::memset(&msg, 0, sizeof msg);
@@ -1625,7 +2015,8 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*            context,
     context->reset();
 
     const bool specifyEndpoint = !options.endpoint().isNull();
-    const bool specifyMetaData = !options.foreignHandle().isNull();
+    const bool specifyMetaData =
+        !options.foreignHandle().isNull() || options.segmentSize() != 0;
 
     msghdr msg;
     bsl::memset(&msg, 0, sizeof msg);
@@ -1710,7 +2101,8 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*               context,
     context->reset();
 
     const bool specifyEndpoint = !options.endpoint().isNull();
-    const bool specifyMetaData = !options.foreignHandle().isNull();
+    const bool specifyMetaData =
+        !options.foreignHandle().isNull() || options.segmentSize() != 0;
 
     msghdr msg;
     bsl::memset(&msg, 0, sizeof msg);
@@ -1795,7 +2187,8 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*         context,
     context->reset();
 
     const bool specifyEndpoint = !options.endpoint().isNull();
-    const bool specifyMetaData = !options.foreignHandle().isNull();
+    const bool specifyMetaData =
+        !options.foreignHandle().isNull() || options.segmentSize() != 0;
 
     msghdr msg;
     bsl::memset(&msg, 0, sizeof msg);
@@ -1885,7 +2278,8 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*         context,
     context->reset();
 
     const bool specifyEndpoint = !options.endpoint().isNull();
-    const bool specifyMetaData = !options.foreignHandle().isNull();
+    const bool specifyMetaData =
+        !options.foreignHandle().isNull() || options.segmentSize() != 0;
 
     msghdr msg;
     bsl::memset(&msg, 0, sizeof msg);
@@ -1970,7 +2364,8 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*              context,
     context->reset();
 
     const bool specifyEndpoint = !options.endpoint().isNull();
-    const bool specifyMetaData = !options.foreignHandle().isNull();
+    const bool specifyMetaData =
+        !options.foreignHandle().isNull() || options.segmentSize() != 0;
 
     msghdr msg;
     bsl::memset(&msg, 0, sizeof msg);
@@ -2055,7 +2450,8 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*                 context,
     context->reset();
 
     const bool specifyEndpoint = !options.endpoint().isNull();
-    const bool specifyMetaData = !options.foreignHandle().isNull();
+    const bool specifyMetaData =
+        !options.foreignHandle().isNull() || options.segmentSize() != 0;
 
     msghdr msg;
     bsl::memset(&msg, 0, sizeof msg);
@@ -2139,7 +2535,8 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*       context,
     context->reset();
 
     const bool specifyEndpoint = !options.endpoint().isNull();
-    const bool specifyMetaData = !options.foreignHandle().isNull();
+    const bool specifyMetaData =
+        !options.foreignHandle().isNull() || options.segmentSize() != 0;
 
     msghdr msg;
     bsl::memset(&msg, 0, sizeof msg);
@@ -2227,7 +2624,8 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*       context,
     context->reset();
 
     const bool specifyEndpoint = !options.endpoint().isNull();
-    const bool specifyMetaData = !options.foreignHandle().isNull();
+    const bool specifyMetaData =
+        !options.foreignHandle().isNull() || options.segmentSize() != 0;
 
     msghdr msg;
     bsl::memset(&msg, 0, sizeof msg);
@@ -2349,7 +2747,8 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*       context,
     context->reset();
 
     const bool specifyEndpoint = !options.endpoint().isNull();
-    const bool specifyMetaData = !options.foreignHandle().isNull();
+    const bool specifyMetaData =
+        !options.foreignHandle().isNull() || options.segmentSize() != 0;
 
     msghdr msg;
     bsl::memset(&msg, 0, sizeof msg);
@@ -2610,8 +3009,9 @@ ntsa::Error SocketUtil::sendToMultiple(bsl::size_t* numBytesSendable,
             *numBytesSendable += numBytesTotal;
         }
 
-        socklen_t socketAddressSize;
-        {
+        if (!messages[mmsgIndex].endpoint().isUndefined()) {
+            socklen_t socketAddressSize;
+
             ntsa::Error error =
                 SocketStorageUtil::convert(&socketAddress[mmsgIndex],
                                            &socketAddressSize,
@@ -2619,11 +3019,12 @@ ntsa::Error SocketUtil::sendToMultiple(bsl::size_t* numBytesSendable,
             if (error) {
                 return error;
             }
+
+            msg.msg_name    = &socketAddress[mmsgIndex];
+            msg.msg_namelen = socketAddressSize;
         }
 
-        msg.msg_name    = &socketAddress[mmsgIndex];
-        msg.msg_namelen = socketAddressSize;
-        msg.msg_iov     = const_cast<struct ::iovec*>(
+        msg.msg_iov = const_cast<struct ::iovec*>(
             reinterpret_cast<const struct ::iovec*>(
                 &messages[mmsgIndex].buffer(0)));
         msg.msg_iovlen = static_cast<int>(numBuffersTotal);
@@ -3137,6 +3538,25 @@ ntsa::Error SocketUtil::receive(ntsa::ReceiveContext*       context,
                                 const ntsa::ReceiveOptions& options,
                                 ntsa::Handle                socket)
 {
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    // Pages of TLS records decrypted by the operating system cannot be
+    // mapped: such records are always copied.
+
+    if (NTSCFG_UNLIKELY(options.zeroCopy() &&
+                        !options.encryptionOffloaded()))
+    {
+        // Without a pool owned by the caller, each region is unmapped when
+        // the data mapped into it is released.
+
+        bslma::Allocator* allocator = bslma::Default::defaultAllocator();
+
+        bsl::shared_ptr<ZeroCopyRegionPool> pool;
+        pool.createInplace(allocator, socket, 0, allocator);
+
+        return receiveZeroCopy(context, blob, options, pool, socket);
+    }
+#endif
+
     context->reset();
 
     const bool wantEndpoint = options.wantEndpoint();
@@ -3223,12 +3643,63 @@ ntsa::Error SocketUtil::receive(ntsa::ReceiveContext*       context,
         control.decode(context, msg, options);
     }
 
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    if (options.encryptionOffloaded()) {
+        unsigned char recordType = 0;
+        if (ReceiveControl::decodeRecordType(&recordType, msg) &&
+            recordType != TlsRecord::e_APPLICATION_DATA)
+        {
+            // The operating system never coalesces a record other than
+            // application data with any other record, so the data received
+            // is exactly that record, which is not appended to the 'blob'.
+
+            bool discard = false;
+
+            ntsa::Error error = interpretTlsRecord(&discard,
+                                                   recordType,
+                                                   msg.msg_iov,
+                                                   msg.msg_iovlen,
+                                                   recvmsgResult);
+            if (error) {
+                return error;
+            }
+
+            if (discard) {
+                return SocketUtil::receive(context, blob, options, socket);
+            }
+
+            context->setBytesReceived(0);
+            return ntsa::Error();
+        }
+    }
+#endif
+
     context->setBytesReceived(recvmsgResult);
     blob->setLength(NTSCFG_WARNING_NARROW(int, size + recvmsgResult));
 
     return ntsa::Error();
 }
 
+ntsa::Error SocketUtil::receive(
+    ntsa::ReceiveContext*                            context,
+    bdlbb::Blob*                                     blob,
+    const ntsa::ReceiveOptions&                      options,
+    const bsl::shared_ptr<ntsu::ZeroCopyRegionPool>& pool,
+    ntsa::Handle                                     socket)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    if (NTSCFG_UNLIKELY(options.zeroCopy() &&
+                        !options.encryptionOffloaded()))
+    {
+        return receiveZeroCopy(context, blob, options, pool, socket);
+    }
+#else
+    NTSCFG_WARNING_UNUSED(pool);
+#endif
+
+    return SocketUtil::receive(context, blob, options, socket);
+}
+
 ntsa::Error SocketUtil::receive(ntsa::ReceiveContext*       context,
                                 bdlbb::BlobBuffer*          blobBuffer,
                                 const ntsa::ReceiveOptions& options,
@@ -3651,6 +4122,47 @@ ntsa::Error SocketUtil::receiveNotifications(
 #endif
 }
 
+ntsa::Error SocketUtil::sendCloseNotify(ntsa::Handle socket)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    unsigned char alert[2] = {TlsRecord::e_WARNING, TlsRecord::e_CLOSE_NOTIFY};
+
+    struct iovec iovec;
+    iovec.iov_base = alert;
+    iovec.iov_len  = sizeof alert;
+
+    bsls::AlignedBuffer<CMSG_SPACE(sizeof(unsigned char))> control;
+    bsl::memset(control.buffer(), 0, sizeof control);
+
+    msghdr msg;
+    bsl::memset(&msg, 0, sizeof msg);
+
+    msg.msg_iov        = &iovec;
+    msg.msg_iovlen     = 1;
+    msg.msg_control    = control.buffer();
+    msg.msg_controllen = CMSG_SPACE(sizeof(unsigned char));
+
+    cmsghdr* hdr    = CMSG_FIRSTHDR(&msg);
+    hdr->cmsg_level = SOL_TLS;
+    hdr->cmsg_type  = TLS_SET_RECORD_TYPE;
+    hdr->cmsg_len   = CMSG_LEN(sizeof(unsigned char));
+
+    *CMSG_DATA(hdr) = static_cast<unsigned char>(TlsRecord::e_ALERT);
+
+    ssize_t sendmsgResult =
+        ::sendmsg(socket, &msg, NTSU_SOCKETUTIL_SENDMSG_FLAGS);
+    if (sendmsgResult < 0) {
+        return ntsa::Error(errno);
+    }
+
+    return ntsa::Error();
+#else
+    NTSCFG_WARNING_UNUSED(socket);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+#endif
+}
+
 ntsa::Error SocketUtil::shutdown(ntsa::ShutdownType::Value direction,
                                  ntsa::Handle              socket)
 {
@@ -4239,6 +4751,11 @@ bsl::size_t SocketUtil::maxMessagesPerReceive()
 {
     return NTSU_SOCKETUTIL_MAX_MESSAGES_PER_RECEIVE;
 }
+
+bsl::size_t SocketUtil::maxSegmentsPerSend()
+{
+    return NTSU_SOCKETUTIL_MAX_SEGMENTS_PER_SEND;
+}
 #endif
 
 bsl::size_t SocketUtil::maxBacklog()
@@ -7477,6 +7994,18 @@ ntsa::Error SocketUtil::receive(ntsa::ReceiveContext*       context,
     }
 }
 
+ntsa::Error SocketUtil::receive(
+    ntsa::ReceiveContext*                            context,
+    bdlbb::Blob*                                     blob,
+    const ntsa::ReceiveOptions&                      options,
+    const bsl::shared_ptr<ntsu::ZeroCopyRegionPool>& pool,
+    ntsa::Handle                                     socket)
+{
+    NTSCFG_WARNING_UNUSED(pool);
+
+    return SocketUtil::receive(context, blob, options, socket);
+}
+
 ntsa::Error SocketUtil::receive(ntsa::ReceiveContext*       context,
                                 bdlbb::BlobBuffer*          blobBuffer,
                                 const ntsa::ReceiveOptions& options,
@@ -7650,6 +8179,13 @@ ntsa::Error SocketUtil::receiveNotifications(
     return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
 }
 
+ntsa::Error SocketUtil::sendCloseNotify(ntsa::Handle socket)
+{
+    NTSCFG_WARNING_UNUSED(socket);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
 ntsa::Error SocketUtil::shutdown(ntsa::ShutdownType::Value direction,
                                  ntsa::Handle              socket)
 {
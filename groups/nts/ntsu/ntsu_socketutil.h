@@ -36,9 +36,11 @@ BSLS_IDENT("$Id: $")
 #include <ntsa_transport.h>
 #include <ntscfg_platform.h>
 #include <ntsscm_version.h>
+#include <ntsu_zerocopyregionpool.h>
 #include <bdlbb_blob.h>
 #include <bdls_filesystemutil.h>
 #include <bsl_iosfwd.h>
+#include <bsl_memory.h>
 
 namespace BloombergLP {
 namespace ntsu {
@@ -519,18 +521,18 @@ struct SocketUtil {
                             const ntsa::SendOptions& options,
                             ntsa::Handle             socket);
 
-    /// Send from the specified 'socket' the specified 'messages', each
-    /// message describing the buffers to send and the remote endpoint to
-    /// which the data referenced by those buffers should be sent. Load into
-    /// the specified 'numBytesSendable' the number of bytes that the
-    /// implementation tried to send, and load into the specified
-    /// 'numBytesSent' the actual number of bytes sent. Load into the
-    /// specified 'numMessagesSendable' the number of messages that the
-    /// implementation tried to send, and load into the specified
-    /// 'numMessagesSent' the actual number of messages sent. Return the
-    /// error. Note that this function is only supported on Linux when
-    /// the both the compile-time and run-time GNU libc version is >= 2.17;
-    /// this function is not supported on any other platform.
+    /// Send from the specified 'socket' the specified 'messages', each message
+    /// describing the buffers to send and the remote endpoint to which the
+    /// data referenced by those buffers should be sent, or an undefined
+    /// endpoint if 'socket' is connected. Load into the specified
+    /// 'numBytesSendable' the number of bytes that the implementation tried to
+    /// send, and load into the specified 'numBytesSent' the actual number of
+    /// bytes sent. Load into the specified 'numMessagesSendable' the number of
+    /// messages that the implementation tried to send, and load into the
+    /// specified 'numMessagesSent' the actual number of messages sent. Return
+    /// the error. Note that this function is only supported on Linux when the
+    /// both the compile-time and run-time GNU libc version is >= 2.17; this
+    /// function is not supported on any other platform.
     static ntsa::Error sendToMultiple(bsl::size_t* numBytesSendable,
                                       bsl::size_t* numBytesSent,
                                       bsl::size_t* numMessagesSendable,
@@ -607,11 +609,40 @@ struct SocketUtil {
     /// Dequeue from the receive buffer of the specified 'socket' into the
     /// specified 'data' according to the specified 'options'. Load into the
     /// specified 'context' the result of the operation. Return the error.
+    /// If 'options.zeroCopy()' is true and the 'socket' is a TCP socket,
+    /// map whole pages of received data, up to 'options.maxBytes()' or, if
+    /// zero, the capacity of the 'data', into buffers appended to the
+    /// 'data', each of which is unmapped when its last reference is
+    /// released, then copy any data that cannot be mapped into the capacity
+    /// of the 'data'. Note that zero-copy receive is only supported on
+    /// Linux; on other platforms the data is copied. Also note that this
+    /// function maps a new region of memory for each zero-copy receive:
+    /// callers that receive repeatedly from the same 'socket' should supply
+    /// a pool of regions to reuse.
     static ntsa::Error receive(ntsa::ReceiveContext*       context,
                                bdlbb::Blob*                data,
                                const ntsa::ReceiveOptions& options,
                                ntsa::Handle                socket);
 
+    /// Dequeue from the receive buffer of the specified 'socket' into the
+    /// specified 'data' according to the specified 'options'. Load into the
+    /// specified 'context' the result of the operation. Return the error.
+    /// If 'options.zeroCopy()' is true and the 'socket' is a TCP socket,
+    /// map whole pages of received data, up to 'options.maxBytes()' or, if
+    /// zero, the capacity of the 'data', into a region acquired from the
+    /// specified 'pool' and appended to the 'data', which is returned to
+    /// the 'pool' when its last reference is released, then copy any data
+    /// that cannot be mapped into the capacity of the 'data'. The behavior
+    /// is undefined unless the 'pool' maps regions from the 'socket'. Note
+    /// that zero-copy receive is only supported on Linux; on other
+    /// platforms the data is copied.
+    static ntsa::Error receive(
+        ntsa::ReceiveContext*                            context,
+        bdlbb::Blob*                                     data,
+        const ntsa::ReceiveOptions&                      options,
+        const bsl::shared_ptr<ntsu::ZeroCopyRegionPool>& pool,
+        ntsa::Handle                                     socket);
+
     /// Dequeue from the receive buffer of the specified 'socket' into the
     /// specified 'blobBuffer' according to the specified 'options'. Load
     /// into the specified 'context' the result of the operation. Return the
@@ -659,6 +690,13 @@ struct SocketUtil {
         ntsa::NotificationQueue* notifications,
         ntsa::Handle             socket);
 
+    /// Send a TLS "close_notify" alert through the specified 'socket', into
+    /// which TLS traffic keys have been installed so that records are
+    /// encrypted by the operating system. Return the error. Note that
+    /// 'e_NOT_IMPLEMENTED' is returned on platforms that do not support
+    /// encrypting TLS records in the operating system.
+    static ntsa::Error sendCloseNotify(ntsa::Handle socket);
+
     /// Shutdown the socket in the specified 'direction'. Return the error.
     static ntsa::Error shutdown(ntsa::ShutdownType::Value direction,
                                 ntsa::Handle              socket);
@@ -756,6 +794,11 @@ struct SocketUtil {
     /// the simultaneous reception of multiple messages. Additional
     /// messages beyond this limit are silently ignored.
     static bsl::size_t maxMessagesPerReceive();
+
+    /// Return the maximum number of datagrams into which the data of a
+    /// single send operation may be segmented by the operating system or
+    /// network interface.
+    static bsl::size_t maxSegmentsPerSend();
 #endif
 
     /// Return the maximum size of a listening socket's backlog, as
@@ -788,6 +788,75 @@ void testStreamSocketTransmissionBlob(ntsa::Transport::Value transport,
     }
 }
 
+void testStreamSocketTransmissionBlobZeroCopy(ntsa::Transport::Value transport,
+                                              ntsa::Handle           server,
+                                              ntsa::Handle           client,
+                                              bslma::Allocator*      allocator)
+{
+    NTSCFG_TEST_LOG_DEBUG << "Testing " << transport
+                          << ": zero-copy receive (blob)"
+                          << NTSCFG_TEST_LOG_END;
+
+    ntsa::Error error;
+
+    const bsl::size_t k_PAGE_SIZE = 4096;
+    const bsl::size_t k_DATA_SIZE = 8 * k_PAGE_SIZE + 100;
+
+    bsl::string data(allocator);
+    data.reserve(k_DATA_SIZE);
+    for (bsl::size_t i = 0; i < k_DATA_SIZE; ++i) {
+        data.push_back(static_cast<char>('a' + (i % 26)));
+    }
+
+    bdlbb::SimpleBlobBufferFactory blobBufferFactory(k_PAGE_SIZE, allocator);
+
+    bdlbb::Blob clientBlob(&blobBufferFactory, allocator);
+    bdlbb::BlobUtil::append(&clientBlob,
+                            data.data(),
+                            static_cast<int>(data.size()));
+
+    bdlbb::Blob serverBlob(&blobBufferFactory, allocator);
+
+    // Enqueue outgoing data to transmit by the client socket.
+
+    {
+        ntsa::SendContext context;
+        ntsa::SendOptions options;
+
+        error = ntsu::SocketUtil::send(&context, clientBlob, options, client);
+        NTSCFG_TEST_OK(error);
+
+        NTSCFG_TEST_EQ(context.bytesSent(), k_DATA_SIZE);
+    }
+
+    // Dequeue incoming data received by the server socket, mapping whole
+    // pages, if supported, and copying the remainder.
+
+    while (static_cast<bsl::size_t>(serverBlob.length()) < k_DATA_SIZE) {
+        const int length = serverBlob.length();
+
+        serverBlob.setLength(length + static_cast<int>(4 * k_PAGE_SIZE));
+        serverBlob.setLength(length);
+
+        ntsa::ReceiveContext context;
+        ntsa::ReceiveOptions options;
+        options.setZeroCopy(true);
+
+        error =
+            ntsu::SocketUtil::receive(&context, &serverBlob, options, server);
+        NTSCFG_TEST_OK(error);
+
+        NTSCFG_TEST_GT(context.bytesReceived(), 0);
+        NTSCFG_TEST_EQ(static_cast<bsl::size_t>(serverBlob.length()),
+                       static_cast<bsl::size_t>(length) +
+                           context.bytesReceived());
+    }
+
+    NTSCFG_TEST_EQ(static_cast<bsl::size_t>(serverBlob.length()),
+                   k_DATA_SIZE);
+    NTSCFG_TEST_EQ(bdlbb::BlobUtil::compare(serverBlob, clientBlob), 0);
+}
+
 void testStreamSocketTransmissionBlobWithControlMsg(
     ntsa::Transport::Value transport,
     ntsa::Handle           server,
@@ -8137,6 +8206,19 @@ NTSCFG_TEST_CASE(34)
     NTSCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+NTSCFG_TEST_CASE(35)
+{
+    // Concern: Stream socket transmission: blob, zero-copy receive.
+    // Plan:
+
+    ntscfg::TestAllocator ta;
+    {
+        test::executeStreamSocketTest(
+            &test::testStreamSocketTransmissionBlobZeroCopy);
+    }
+    NTSCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTSCFG_TEST_DRIVER
 {
     NTSCFG_TEST_REGISTER(1);
@@ -8173,5 +8255,6 @@ NTSCFG_TEST_DRIVER
     NTSCFG_TEST_REGISTER(32);
     NTSCFG_TEST_REGISTER(33);
     NTSCFG_TEST_REGISTER(34);
+    NTSCFG_TEST_REGISTER(35);
 }
 NTSCFG_TEST_DRIVER_END;
@@ -0,0 +1,162 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntsu_zerocopyregionpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntsu_zerocopyregionpool_cpp, "$Id$ $CSID$")
+
+#include <bslma_default.h>
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#include <sys/mman.h>
+#endif
+
+namespace BloombergLP {
+namespace ntsu {
+
+void ZeroCopyRegionPool::unmap(void* region, bsl::size_t size)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    int rc = ::munmap(region, size);
+    BSLS_ASSERT_OPT(rc == 0);
+    NTSCFG_WARNING_UNUSED(rc);
+#else
+    NTSCFG_WARNING_UNUSED(region);
+    NTSCFG_WARNING_UNUSED(size);
+#endif
+}
+
+ZeroCopyRegionPool::ZeroCopyRegionPool(ntsa::Handle      socket,
+                                       bsl::size_t       maxRegions,
+                                       bslma::Allocator* basicAllocator)
+: d_lock(bsls::SpinLock::s_unlocked)
+, d_socket(socket)
+, d_regionSize(0)
+, d_regions(basicAllocator)
+, d_maxRegions(maxRegions)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    // Reserve capacity for every retained region so that releasing a region,
+    // which may occur in a deleter on any thread, never allocates.
+
+    d_regions.reserve(d_maxRegions);
+}
+
+ZeroCopyRegionPool::~ZeroCopyRegionPool()
+{
+    for (RegionVector::const_iterator it = d_regions.begin();
+         it != d_regions.end();
+         ++it)
+    {
+        ZeroCopyRegionPool::unmap(*it, d_regionSize);
+    }
+}
+
+void* ZeroCopyRegionPool::acquire(bsl::size_t size)
+{
+    BSLS_ASSERT(size > 0);
+
+    RegionVector stale(d_allocator_p);
+    bsl::size_t  staleSize = 0;
+
+    {
+        bsls::SpinLockGuard guard(&d_lock);
+
+        if (size == d_regionSize) {
+            if (!d_regions.empty()) {
+                void* region = d_regions.back();
+                d_regions.pop_back();
+                return region;
+            }
+        }
+        else {
+            // The size of the receive has changed, typically because the
+            // socket receive buffer has been resized: regions of the previous
+            // size are no longer reused. Until the storage of the retained
+            // regions is restored, below, regions are not retained.
+
+            d_regions.swap(stale);
+            staleSize    = d_regionSize;
+            d_regionSize = size;
+        }
+    }
+
+    if (staleSize != 0 || stale.capacity() != 0) {
+        for (RegionVector::const_iterator it = stale.begin();
+             it != stale.end();
+             ++it)
+        {
+            ZeroCopyRegionPool::unmap(*it, staleSize);
+        }
+
+        stale.clear();
+
+        bsls::SpinLockGuard guard(&d_lock);
+        if (d_regions.capacity() < stale.capacity()) {
+            d_regions.swap(stale);
+        }
+    }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    void* region = ::mmap(0, size, PROT_READ, MAP_SHARED, d_socket, 0);
+    if (region == MAP_FAILED) {
+        return 0;
+    }
+
+    return region;
+#else
+    return 0;
+#endif
+}
+
+void ZeroCopyRegionPool::release(void* region, bsl::size_t size)
+{
+    BSLS_ASSERT(region);
+
+    {
+        bsls::SpinLockGuard guard(&d_lock);
+
+        if (size == d_regionSize && d_regions.size() < d_maxRegions &&
+            d_regions.size() < d_regions.capacity())
+        {
+            d_regions.push_back(region);
+            return;
+        }
+    }
+
+    ZeroCopyRegionPool::unmap(region, size);
+}
+
+ntsa::Handle ZeroCopyRegionPool::handle() const
+{
+    return d_socket;
+}
+
+bsl::size_t ZeroCopyRegionPool::numRegionsAvailable() const
+{
+    bsls::SpinLockGuard guard(&d_lock);
+    return d_regions.size();
+}
+
+bsl::size_t ZeroCopyRegionPool::maxRegionsAvailable() const
+{
+    return d_maxRegions;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,115 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTSU_ZEROCOPYREGIONPOOL
+#define INCLUDED_NTSU_ZEROCOPYREGIONPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntsa_handle.h>
+#include <ntscfg_platform.h>
+#include <ntsscm_version.h>
+#include <bslma_allocator.h>
+#include <bsls_spinlock.h>
+#include <bsl_cstddef.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ntsu {
+
+/// @internal @brief
+/// Provide a pool of regions of memory mapped from a TCP socket, into which
+/// pages of data received by that socket are mapped by zero-copy receive.
+///
+/// @details
+/// Mapping a region for each receive, and unmapping it when the data mapped
+/// into it is no longer referenced, modifies the page tables of the process
+/// and may require TLB shootdowns across the threads of the process each
+/// time. This class maps each region once and retains it when it is released
+/// so that it may be reused by a subsequent receive: the operating system
+/// replaces any pages still mapped in the target range of a zero-copy
+/// receive, so a released region needs no further preparation before it is
+/// reused. At most a configurable number of released regions are retained;
+/// regions released while that many are already retained, or of a size
+/// other than the most recently acquired, are unmapped. Note that a retained
+/// region may keep the pages last mapped into it resident until it is either
+/// reused or unmapped when this object is destroyed. Also note that mapping
+/// regions from a socket is only supported on Linux; on other platforms no
+/// region can be acquired.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntsu
+class ZeroCopyRegionPool
+{
+    typedef bsl::vector<void*> RegionVector;
+
+    mutable bsls::SpinLock d_lock;
+    ntsa::Handle           d_socket;
+    bsl::size_t            d_regionSize;
+    RegionVector           d_regions;
+    bsl::size_t            d_maxRegions;
+    bslma::Allocator*      d_allocator_p;
+
+  private:
+    ZeroCopyRegionPool(const ZeroCopyRegionPool&) BSLS_KEYWORD_DELETED;
+    ZeroCopyRegionPool& operator=(const ZeroCopyRegionPool&)
+        BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Unmap the specified 'region' having the specified 'size'.
+    static void unmap(void* region, bsl::size_t size);
+
+  public:
+    /// Create a new pool of regions mapped from the specified 'socket' that
+    /// retains at most the specified 'maxRegions' released regions.
+    /// Optionally specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
+    ZeroCopyRegionPool(ntsa::Handle      socket,
+                       bsl::size_t       maxRegions,
+                       bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object. Unmap each retained region.
+    ~ZeroCopyRegionPool();
+
+    /// Return a region of the specified 'size', reusing a retained region
+    /// if one of that 'size' is available, otherwise mapping a new region
+    /// from the socket. Return null if no region can be mapped. The
+    /// behavior is undefined unless 'size' is a non-zero multiple of the
+    /// page size.
+    void* acquire(bsl::size_t size);
+
+    /// Return the specified 'region' having the specified 'size' to this
+    /// pool, retaining it for reuse if possible, otherwise unmapping it. The
+    /// behavior is undefined unless 'region' was returned from 'acquire'
+    /// called on this object with the same 'size'.
+    void release(void* region, bsl::size_t size);
+
+    /// Return the handle to the socket from which regions are mapped.
+    ntsa::Handle handle() const;
+
+    /// Return the number of released regions currently retained for reuse.
+    bsl::size_t numRegionsAvailable() const;
+
+    /// Return the maximum number of released regions retained for reuse.
+    bsl::size_t maxRegionsAvailable() const;
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
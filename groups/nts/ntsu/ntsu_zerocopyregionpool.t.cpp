@@ -0,0 +1,108 @@
+// Copyright 2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntsu_zerocopyregionpool.h>
+
+#include <ntscfg_test.h>
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+using namespace BloombergLP;
+
+NTSCFG_TEST_CASE(1)
+{
+    // Concern: Released regions are reused by subsequent acquisitions of the
+    // same size, at most the maximum number of released regions are
+    // retained, and a change in size discards the retained regions.
+    //
+    // Plan: Map regions from a TCP socket, release and re-acquire them, and
+    // ensure the same regions are returned. Note that mapping a region from
+    // a TCP socket is only supported on Linux kernel versions greater than or
+    // equal to 4.18.0: when no region can be mapped the test is skipped.
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+    ntscfg::TestAllocator ta;
+    {
+        const bsl::size_t PAGE_SIZE =
+            static_cast<bsl::size_t>(::sysconf(_SC_PAGESIZE));
+
+        const bsl::size_t MAX_REGIONS = 2;
+
+        int socket = ::socket(AF_INET, SOCK_STREAM, 0);
+        NTSCFG_TEST_GE(socket, 0);
+
+        {
+            ntsu::ZeroCopyRegionPool pool(socket, MAX_REGIONS, &ta);
+
+            NTSCFG_TEST_EQ(pool.handle(), socket);
+            NTSCFG_TEST_EQ(pool.numRegionsAvailable(), 0);
+            NTSCFG_TEST_EQ(pool.maxRegionsAvailable(), MAX_REGIONS);
+
+            void* region1 = pool.acquire(4 * PAGE_SIZE);
+            if (region1 != 0) {
+                void* region2 = pool.acquire(4 * PAGE_SIZE);
+                void* region3 = pool.acquire(4 * PAGE_SIZE);
+
+                NTSCFG_TEST_NE(region2, 0);
+                NTSCFG_TEST_NE(region3, 0);
+
+                pool.release(region1, 4 * PAGE_SIZE);
+                pool.release(region2, 4 * PAGE_SIZE);
+                pool.release(region3, 4 * PAGE_SIZE);
+
+                NTSCFG_TEST_EQ(pool.numRegionsAvailable(), MAX_REGIONS);
+
+                void* region4 = pool.acquire(4 * PAGE_SIZE);
+                void* region5 = pool.acquire(4 * PAGE_SIZE);
+
+                NTSCFG_TEST_EQ(region4, region2);
+                NTSCFG_TEST_EQ(region5, region1);
+
+                NTSCFG_TEST_EQ(pool.numRegionsAvailable(), 0);
+
+                pool.release(region4, 4 * PAGE_SIZE);
+
+                NTSCFG_TEST_EQ(pool.numRegionsAvailable(), 1);
+
+                void* region6 = pool.acquire(8 * PAGE_SIZE);
+                NTSCFG_TEST_NE(region6, 0);
+
+                NTSCFG_TEST_EQ(pool.numRegionsAvailable(), 0);
+
+                pool.release(region5, 4 * PAGE_SIZE);
+                pool.release(region6, 8 * PAGE_SIZE);
+
+                NTSCFG_TEST_EQ(pool.numRegionsAvailable(), 1);
+            }
+        }
+
+        ::close(socket);
+    }
+    NTSCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+
+#endif
+}
+
+NTSCFG_TEST_DRIVER
+{
+    NTSCFG_TEST_REGISTER(1);
+}
+NTSCFG_TEST_DRIVER_END;
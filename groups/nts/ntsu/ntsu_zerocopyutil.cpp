@@ -23,6 +23,7 @@
 #include <sys/time.h>
 #include <linux/errqueue.h>
 #include <linux/version.h>
+#include <netinet/tcp.h>
 #include <sys/socket.h>
 #endif
 // clang-format on
@@ -43,6 +44,13 @@ BSLMF_ASSERT(ZeroCopyUtil::e_SO_EE_ORIGIN_ZEROCOPY ==
 BSLMF_ASSERT(ZeroCopyUtil::e_SO_EE_CODE_ZEROCOPY_COPIED ==
              static_cast<int>(SO_EE_CODE_ZEROCOPY_COPIED));
 
+#if defined(TCP_ZEROCOPY_RECEIVE)
+BSLMF_ASSERT(ZeroCopyUtil::e_TCP_ZEROCOPY_RECEIVE ==
+             static_cast<int>(TCP_ZEROCOPY_RECEIVE));
+#endif
+
+BSLMF_ASSERT(sizeof(ZeroCopyUtil::TcpZeroCopyReceive) == 16);
+
 #endif
 #endif
 
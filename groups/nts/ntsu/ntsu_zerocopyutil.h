@@ -19,6 +19,8 @@
 #include <bsls_ident.h>
 BSLS_IDENT("$Id: $")
 
+#include <bsl_cstdint.h>
+
 namespace BloombergLP {
 namespace ntsu {
 
@@ -38,6 +40,10 @@ namespace ntsu {
 /// @li Zero-copy for UDP sockets is only supported for Linux kernel versions
 /// greater than or equal to 5.0.0.
 ///
+/// @li Zero-copy receive, by which pages of data received by a TCP socket are
+/// mapped into the address space of the process rather than copied, is only
+/// supported for Linux kernel versions greater than or equal to 4.18.0.
+///
 /// @li To reduce the complexity in the implementation detected proper support,
 /// zero-copy is limited to only Linux kernel versions greater than or equal
 /// to 5.0.0. Technically zero-copy is supported for TCP sockets for Linux
@@ -57,6 +63,19 @@ struct ZeroCopyUtil {
         e_SO_EE_ORIGIN_ZEROCOPY      = 5,
         e_SO_EE_CODE_ZEROCOPY_COPIED = 1
     };
+
+    enum {  // copied from include/uapi/linux/tcp.h
+        e_TCP_ZEROCOPY_RECEIVE = 35
+    };
+
+    // Copy of the leading fields of Linux 'struct tcp_zerocopy_receive', as
+    // first defined in Linux 4.18. Later kernel versions extend the structure
+    // but continue to accept an argument having only these fields.
+    struct TcpZeroCopyReceive {
+        bsl::uint64_t address;
+        bsl::uint32_t length;
+        bsl::uint32_t recvSkipHint;
+    };
 };
 
 }  // close package namespace
@@ -160,6 +160,7 @@ if (${NTF_BUILD_WITH_NTS})
     ntf_component(NAME ntsa_transport)
     ntf_component(NAME ntsa_timestamp)
     ntf_component(NAME ntsa_timestamptype)
+    ntf_component(NAME ntsa_traffickeys)
     ntf_component(NAME ntsa_uri)
     ntf_component(NAME ntsa_zerocopy)
 
@@ -220,6 +221,7 @@ if (${NTF_BUILD_WITH_NTS})
 
     ntf_component(NAME ntsu_adapterutil)
     ntf_component(NAME ntsu_zerocopyutil)
+    ntf_component(NAME ntsu_zerocopyregionpool)
     ntf_component(NAME ntsu_resolverutil)
     ntf_component(NAME ntsu_socketutil)
     ntf_component(NAME ntsu_socketoptionutil)
@@ -348,6 +350,7 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_component(NAME ntccfg_foreach)
     ntf_component(NAME ntccfg_function)
     ntf_component(NAME ntccfg_inline)
+    ntf_component(NAME ntccfg_inplacefunctor)
     ntf_component(NAME ntccfg_likely)
     ntf_component(NAME ntccfg_limits)
     ntf_component(NAME ntccfg_lock)
@@ -522,6 +525,7 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_component(NAME ntci_closecallbackfactory)
     ntf_component(NAME ntci_closefuture)
     ntf_component(NAME ntci_closeresult)
+    ntf_component(NAME ntci_coroutine)
     ntf_component(NAME ntci_datapool)
     ntf_component(NAME ntci_datagramsocket)
     ntf_component(NAME ntci_datagramsocketfactory)
@@ -543,7 +547,11 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_component(NAME ntci_encryptionresourcefactory)
     ntf_component(NAME ntci_encryptionserver)
     ntf_component(NAME ntci_encryptionserverfactory)
+    ntf_component(NAME ntci_encryptionsessioncache)
     ntf_component(NAME ntci_executor)
+    ntf_component(NAME ntci_futurepool)
+    ntf_component(NAME ntci_futurestate)
+    ntf_component(NAME ntci_futureutil)
     ntf_component(NAME ntci_getipaddresscallback)
     ntf_component(NAME ntci_getipaddresscallbackfactory)
     ntf_component(NAME ntci_getdomainnamecallback)
@@ -658,6 +666,7 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_component(NAME ntcs_datapool)
     ntf_component(NAME ntcs_detachstate)
     ntf_component(NAME ntcs_dispatch)
+    ntf_component(NAME ntcs_encryptionsessioncache)
     ntf_component(NAME ntcs_driver)
     ntf_component(NAME ntcs_event)
     ntf_component(NAME ntcs_flowcontrolcontext)
@@ -665,7 +674,10 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_component(NAME ntcs_global)
     ntf_component(NAME ntcs_globalallocator)
     ntf_component(NAME ntcs_globalexecutor)
+    ntf_component(NAME ntcs_handshakepool)
+    ntf_component(NAME ntcs_inbox)
     ntf_component(NAME ntcs_interest)
+    ntf_component(NAME ntcs_interestjournal)
     ntf_component(NAME ntcs_leakybucket)
     ntf_component(NAME ntcs_memorymap)
     ntf_component(NAME ntcs_metrics)
@@ -682,10 +694,13 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_component(NAME ntcs_reactormetrics)
     ntf_component(NAME ntcs_registry)
     ntf_component(NAME ntcs_reservation)
+    ntf_component(NAME ntcs_sharedmemorypublisher)
     ntf_component(NAME ntcs_shutdowncontext)
     ntf_component(NAME ntcs_shutdownstate)
     ntf_component(NAME ntcs_skiplist)
+    ntf_component(NAME ntcs_timerwheel)
     ntf_component(NAME ntcs_strand)
+    ntf_component(NAME ntcs_strandscheduler)
     ntf_component(NAME ntcs_threadutil)
     ntf_component(NAME ntcs_watermarks)
     ntf_component(NAME ntcs_watermarkutil)
@@ -710,6 +725,7 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_component(NAME ntcq_bind)
     ntf_component(NAME ntcq_connect)
     ntf_component(NAME ntcq_receive)
+    ntf_component(NAME ntcq_ring)
     ntf_component(NAME ntcq_send)
     ntf_component(NAME ntcq_zerocopy)
 
@@ -821,6 +837,7 @@ if (${NTF_BUILD_WITH_NTC})
 
     ntf_component(NAME ntcr_datagramsocket)
     ntf_component(NAME ntcr_listenersocket)
+    ntf_component(NAME ntcr_shardedlistenersocket)
     ntf_component(NAME ntcr_streamsocket)
     ntf_component(NAME ntcr_interface)
     ntf_component(NAME ntcr_thread)
@@ -911,6 +928,21 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_group_end(NAME ntc)
 endif()
 
+if (${NTF_BUILD_WITH_APPLICATIONS})
+    if (${NTF_BUILD_WITH_NTC})
+        ntf_executable(
+            NAME
+                ntcperf
+            PATH
+                applications/m_ntcperf
+            REQUIRES
+                ntc nts
+            PRIVATE)
+
+        ntf_executable_end(NAME ntcperf)
+    endif()
+endif()
+
 if (${NTF_BUILD_WITH_USAGE_EXAMPLES})
     if (${NTF_BUILD_WITH_NTS})
         foreach (suffix 01;02;03;04;05;06;07;08)
@@ -251,6 +251,18 @@ if (NOT DEFINED NTF_BUILD_WITH_STACK_TRACE_TEST_ALLOCATOR)
     endif()
 endif()
 
+if (NOT DEFINED NTF_BUILD_WITH_APPLICATIONS)
+    if (DEFINED NTF_CONFIGURE_WITH_APPLICATIONS)
+        set(NTF_BUILD_WITH_APPLICATIONS
+            ${NTF_CONFIGURE_WITH_APPLICATIONS} CACHE INTERNAL "")
+    elseif (DEFINED ENV{NTF_CONFIGURE_WITH_APPLICATIONS})
+        set(NTF_BUILD_WITH_APPLICATIONS
+            $ENV{NTF_CONFIGURE_WITH_APPLICATIONS} CACHE INTERNAL "")
+    else()
+        set(NTF_BUILD_WITH_APPLICATIONS TRUE CACHE INTERNAL "")
+    endif()
+endif()
+
 if (NOT DEFINED NTF_BUILD_WITH_USAGE_EXAMPLES)
     if (DEFINED NTF_CONFIGURE_WITH_USAGE_EXAMPLES)
         set(NTF_BUILD_WITH_USAGE_EXAMPLES
@@ -572,6 +584,18 @@ if (NOT DEFINED NTF_BUILD_WITH_THREAD_SCALING)
     endif()
 endif()
 
+if (NOT DEFINED NTF_BUILD_WITH_COROUTINES)
+    if (DEFINED NTF_CONFIGURE_WITH_COROUTINES)
+        set(NTF_BUILD_WITH_COROUTINES
+            ${NTF_CONFIGURE_WITH_COROUTINES} CACHE INTERNAL "")
+    elseif (DEFINED ENV{NTF_CONFIGURE_WITH_COROUTINES})
+        set(NTF_BUILD_WITH_COROUTINES
+            $ENV{NTF_CONFIGURE_WITH_COROUTINES} CACHE INTERNAL "")
+    else()
+        set(NTF_BUILD_WITH_COROUTINES TRUE CACHE INTERNAL "")
+    endif()
+endif()
+
 if (NOT DEFINED NTF_BUILD_WITH_LOGGING)
     if (DEFINED NTF_CONFIGURE_WITH_LOGGING)
         set(NTF_BUILD_WITH_LOGGING
@@ -827,6 +851,12 @@ else()
     message(STATUS "NTF: Building from continuous integration:      no")
 endif()
 
+if (${NTF_BUILD_WITH_APPLICATIONS})
+    message(STATUS "NTF: Building with applications:                yes")
+else()
+    message(STATUS "NTF: Building with applications:                no")
+endif()
+
 if (${NTF_BUILD_WITH_USAGE_EXAMPLES})
     message(STATUS "NTF: Building with usage examples:              yes")
 else()
@@ -971,6 +1001,12 @@ else()
     message(STATUS "NTF: Building with thread scaling:              no")
 endif()
 
+if (${NTF_BUILD_WITH_COROUTINES})
+    message(STATUS "NTF: Building with coroutines:                  yes")
+else()
+    message(STATUS "NTF: Building with coroutines:                  no")
+endif()
+
 if (${NTF_BUILD_WITH_LOGGING})
     message(STATUS "NTF: Building with logging:                     yes")
 else()